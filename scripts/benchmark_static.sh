@@ -0,0 +1,33 @@
+#!/bin/sh -e
+# Measure static file throughput from a device over several connections
+#
+# Usage: benchmark_static.sh <host> [path] [connections]
+#
+# Each connection fetches the file once, the throughput of each and the
+# combined total is printed in KB/s. Build with -DENABLE_PROFILE to also
+# get the device's view of each transfer on the debug port.
+
+HOST=$1
+FILE=${2:-/lib.js}
+CONNECTIONS=${3:-4}
+
+if [ -z $HOST ]; then
+  echo "Usage: $0 <host> [path] [connections]"
+  exit 1
+fi
+
+TMP=$(mktemp -d)
+trap "rm -rf $TMP" EXIT
+
+START=$(date +%s%N)
+for i in $(seq $CONNECTIONS); do
+  curl -s -o /dev/null -H "Accept-Encoding: gzip" \
+    -w "%{size_download} %{time_total}\n" \
+    http://$HOST$FILE > $TMP/$i &
+done
+wait
+END=$(date +%s%N)
+
+cat $TMP/* | awk -v ms=$(( (END - START) / 1000000 )) '
+  { printf "%d bytes in %.0fms, %.1fKB/s\n", $1, $2 * 1000, $1 / $2 / 1000; total += $1 }
+  END { printf "Total %d bytes in %dms, %.1fKB/s\n", total, ms, total / ms }'
@@ -6,6 +6,9 @@ import re
 import requests
 import subprocess
 import sys
+import gzip
+import hashlib
+from io import BytesIO
 
 Import("env")
 
@@ -21,31 +24,44 @@ npm_installed = (0 == system("npm --version"))
 def get_c_name(source_file):
     return basename(source_file).upper().replace('.', '_').replace('-', '_')
 
-def text_to_header(source_file):
-    with open(source_file) as source_fh:
-        original = source_fh.read()
-    filename = get_c_name(source_file)
-    output = "static const char CONTENT_{}[] PROGMEM = ".format(filename)
-    for line in original.splitlines():
-        output += u"\n  \"{}\\n\"".format(line.replace('\\', '\\\\').replace('"', '\\"'))
-    output += ";\n"
-    return output
+# Text files are stored gzipped and served with Content-Encoding: gzip, the
+# images are already compressed
+def is_compressible(source_file):
+    return source_file.endswith(".css") or source_file.endswith(".js") or source_file.endswith(".htm") or source_file.endswith(".html") or source_file.endswith(".svg") or source_file.endswith(".json")
+
+def gzip_data(data):
+    out = BytesIO()
+    # mtime is fixed so the output only changes when the content does
+    with gzip.GzipFile(fileobj=out, mode="wb", compresslevel=9, mtime=0) as gz:
+        gz.write(data)
+    return out.getvalue()
+
+# FNV-1a, must match static_file_hash() in web_server_static.cpp
+def fnv1a(text):
+    hash = 0x811c9dc5
+    for byte in bytearray(text.encode("utf-8")):
+        hash ^= byte
+        hash = (hash * 0x01000193) & 0xffffffff
+    return hash
+
+def read_data(source_file):
+    with open(source_file, "rb") as source_fh:
+        data = source_fh.read()
+    if is_compressible(source_file):
+        data = gzip_data(data)
+    return data
 
-def binary_to_header(source_file):
+def binary_to_header(source_file, data):
     filename = get_c_name(source_file)
     output = "static const char CONTENT_"+filename+"[] PROGMEM = {\n  "
     count = 0
 
-    with open(source_file, "rb") as source_fh:
-        byte = source_fh.read(1)
-        while byte != b"":
-            output += "0x{:02x}, ".format(ord(byte))
-            count += 1
-            if 16 == count:
-                output += "\n  "
-                count = 0
-
-            byte = source_fh.read(1)
+    for byte in bytearray(data):
+        output += "0x{:02x}, ".format(byte)
+        count += 1
+        if 16 == count:
+            output += "\n  "
+            count = 0
 
     output += "0x00 };\n"
     return output
@@ -55,10 +71,7 @@ def data_to_header(env, target, source):
     for source_file in source:
         #print("Reading {}".format(source_file))
         file = source_file.get_abspath()
-        if file.endswith(".css") or file.endswith(".js") or file.endswith(".htm") or file.endswith(".html") or file.endswith(".svg"):
-            output += text_to_header(file)
-        else:
-            output += binary_to_header(file)
+        output += binary_to_header(file, read_data(file))
     target_file = target[0].get_abspath()
     print("Generating {}".format(target_file))
     with open(target_file, "w") as output_file:
@@ -80,9 +93,18 @@ def make_static(env, target, source):
         filename = "web_server."+out_file+".h"
         output += "#include \"{}\"\n".format(filename)
 
+    # The table is sorted by the hash of the path so it can be binary searched
+    paths = {}
+    for out_file in out_files:
+        path_hash = fnv1a("/"+out_file)
+        if path_hash in paths:
+            sys.exit("Error: /{} and /{} have the same hash".format(out_file, paths[path_hash]))
+        paths[path_hash] = out_file
+
     output += "StaticFile staticFiles[] = {\n"
 
-    for out_file in out_files:
+    for path_hash in sorted(paths):
+        out_file = paths[path_hash]
         filetype = "TEXT"
         if out_file.endswith(".css"):
             filetype = "CSS"
@@ -97,8 +119,15 @@ def make_static(env, target, source):
         elif out_file.endswith(".svg"):
             filetype = "SVG"
 
+        encoding = "NULL"
+        if is_compressible(out_file):
+            encoding = "_CONTENT_ENCODING_GZIP"
+
+        # Used as the ETag
+        content_hash = "0x"+hashlib.sha1(read_data(join(dist_dir, out_file))).hexdigest()[:8]
+
         c_name = get_c_name(out_file)
-        output += "  { \"/"+out_file+"\", CONTENT_"+c_name+", sizeof(CONTENT_"+c_name+") - 1, _CONTENT_TYPE_"+filetype+" },\n"
+        output += "  { \"/"+out_file+"\", "+str(len(out_file) + 1)+", 0x{:08x}, CONTENT_".format(path_hash)+c_name+", sizeof(CONTENT_"+c_name+") - 1, _CONTENT_TYPE_"+filetype+", "+encoding+", "+content_hash+" },\n"
 
     output += "};\n"
 
@@ -4,17 +4,32 @@
 #include "mqtt.h"
 #include "emoncms.h"
 #include "input.h"
+#include "event.h"
+#include "web_server_auth.h"
 
 #include "app_config.h"
-#include "app_config_mode.h"
+#include "app_config_parser.h"
+#include "app_config_store.h"
 
 #include <Arduino.h>
 #include <EEPROM.h>             // Save config settings
-#include <ConfigJson.h>
 
 #define EEPROM_SIZE     4096
 #define CHECKSUM_SEED    128
 
+uint32_t config_commits = 0;
+uint32_t config_commits_skipped = 0;
+uint32_t config_load_time = 0;
+
+// Deferred commit state, the options changed since the last write are
+// counted by config_changed()
+static uint32_t config_dirty = 0;
+static bool config_commit_pending = false;
+static uint32_t config_commit_time = 0;
+
+// Options changed since the subscribers were last told
+static uint32_t config_changed_options = 0;
+
 // Wifi Network Strings
 String esid;
 String epass;
@@ -57,60 +72,292 @@ uint32_t divert_min_charge_time;
 
 String esp_hostname_default = "openevse";
 
-void config_changed(String name);
+static void config_changed(int id);
 
-ConfigOptDefenition<uint32_t> flagsOpt = ConfigOptDefenition<uint32_t>(flags, 0, "flags", "f");
+// -------------------------------------------------------------------
+// Config options
+//
+// The options are a table in flash built at compile time from the list
+// below. Each entry has the long and short names along with their hashes,
+// so finding an option is mostly a compare of 32 bit values, the type,
+// the variable holding the value and the default.
+// -------------------------------------------------------------------
 
-ConfigOpt *opts[] = 
+// Option types
+#define CONFIG_OPT_STRING         0
+#define CONFIG_OPT_UINT32         1
+#define CONFIG_OPT_DOUBLE         2
+#define CONFIG_OPT_FLAG           3   // Bool held in flags, the number is the bit mask
+#define CONFIG_OPT_CHARGE_MODE    4   // "fast" or "eco" held in flags
+
+// Option flags
+#define CONFIG_OPT_SECRET         (1 << 0)  // Not shown when the config is read
+#define CONFIG_OPT_VIRTUAL        (1 << 1)  // Part of another option so not saved
+#define CONFIG_OPT_DEF_HOSTNAME   (1 << 2)  // Default is the hostname
+#define CONFIG_OPT_DEF_ID         (1 << 3)  // Default has the device ID appended
+
+// Sent in place of secrets, and ignored if sent back
+static const char _CONFIG_SECRET_DUMMY[] PROGMEM = "___DUMMY_PASSWORD___";
+
+// Enough for the full config as JSON
+#define CONFIG_JSON_DOC_SIZE      2048
+
+// X(name, short name, type, flags, variable, default string, default number)
+#define CONFIG_OPTIONS(X) \
+/* Wifi Network Strings */ \
+  X(ssid, ws, CONFIG_OPT_STRING, 0, esid, "", 0) \
+  X(pass, wp, CONFIG_OPT_STRING, CONFIG_OPT_SECRET, epass, "", 0) \
+/* Web server authentication (leave blank for none) */ \
+  X(www_username, au, CONFIG_OPT_STRING, 0, www_username, "", 0) \
+  X(www_password, ap, CONFIG_OPT_STRING, CONFIG_OPT_SECRET, www_password, "", 0) \
+/* Advanced settings */ \
+  X(hostname, hn, CONFIG_OPT_STRING, 0, esp_hostname, "openevse", 0) \
+/* EMONCMS SERVER strings */ \
+  X(emoncms_server, es, CONFIG_OPT_STRING, 0, emoncms_server, "data.openevse.com/emoncms", 0) \
+  X(emoncms_node, en, CONFIG_OPT_STRING, CONFIG_OPT_DEF_HOSTNAME, emoncms_node, "", 0) \
+  X(emoncms_apikey, ea, CONFIG_OPT_STRING, CONFIG_OPT_SECRET, emoncms_apikey, "", 0) \
+  X(emoncms_fingerprint, ef, CONFIG_OPT_STRING, 0, emoncms_fingerprint, "", 0) \
+/* MQTT Settings */ \
+  X(mqtt_server, ms, CONFIG_OPT_STRING, 0, mqtt_server, "emonpi", 0) \
+  X(mqtt_port, mpt, CONFIG_OPT_UINT32, 0, mqtt_port, "", 1883) \
+  X(mqtt_topic, mt, CONFIG_OPT_STRING, CONFIG_OPT_DEF_HOSTNAME, mqtt_topic, "", 0) \
+  X(mqtt_user, mu, CONFIG_OPT_STRING, 0, mqtt_user, "emonpi", 0) \
+  X(mqtt_pass, mp, CONFIG_OPT_STRING, CONFIG_OPT_SECRET, mqtt_pass, "emonpimqtt2016", 0) \
+  X(mqtt_solar, mo, CONFIG_OPT_STRING, 0, mqtt_solar, "", 0) \
+  X(mqtt_grid_ie, mg, CONFIG_OPT_STRING, 0, mqtt_grid_ie, "emon/emonpi/power1", 0) \
+  X(mqtt_vrms, mv, CONFIG_OPT_STRING, 0, mqtt_vrms, "emon/emonpi/vrms", 0) \
+  X(mqtt_announce_topic, ma, CONFIG_OPT_STRING, CONFIG_OPT_DEF_ID, mqtt_announce_topic, "openevse/announce/", 0) \
+/* Ohm Connect Settings */ \
+  X(ohm, o, CONFIG_OPT_STRING, 0, ohm, "", 0) \
+/* Divert settings */ \
+  X(divert_attack_smoothing_factor, da, CONFIG_OPT_DOUBLE, 0, divert_attack_smoothing_factor, "", 0.4) \
+  X(divert_decay_smoothing_factor, dd, CONFIG_OPT_DOUBLE, 0, divert_decay_smoothing_factor, "", 0.05) \
+  X(divert_min_charge_time, dt, CONFIG_OPT_UINT32, 0, divert_min_charge_time, "", (10 * 60)) \
+/* Flags */ \
+  X(flags, f, CONFIG_OPT_UINT32, 0, flags, "", 0) \
+/* Virtual Options */ \
+  X(emoncms_enabled, ee, CONFIG_OPT_FLAG, CONFIG_OPT_VIRTUAL, flags, "", CONFIG_SERVICE_EMONCMS) \
+  X(mqtt_enabled, me, CONFIG_OPT_FLAG, CONFIG_OPT_VIRTUAL, flags, "", CONFIG_SERVICE_MQTT) \
+  X(ohm_enabled, oe, CONFIG_OPT_FLAG, CONFIG_OPT_VIRTUAL, flags, "", CONFIG_SERVICE_OHM) \
+  X(divert_enabled, de, CONFIG_OPT_FLAG, CONFIG_OPT_VIRTUAL, flags, "", CONFIG_SERVICE_DIVERT) \
+  X(charge_mode, chmd, CONFIG_OPT_CHARGE_MODE, CONFIG_OPT_VIRTUAL, flags, "", 0)
+
+struct ConfigOption
 {
-// Wifi Network Strings
-  new ConfigOptDefenition<String>(esid, "", "ssid", "ws"),
-  new ConfigOptSecret(epass, "", "pass", "wp"),
+  const char *name;
+  const char *shortName;
+  uint32_t nameHash;
+  uint32_t shortNameHash;
+  void *value;
+  const char *defaultString;
+  double defaultNumber;
+  uint8_t type;
+  uint8_t flags;
+};
 
-// Web server authentication (leave blank for none)
-  new ConfigOptDefenition<String>(www_username, "", "www_username", "au"),
-  new ConfigOptSecret(www_password, "", "www_password", "ap"),
+// FNV-1a, evaluated by the compiler for the table
+constexpr uint32_t config_hash(const char *str, uint32_t hash = 2166136261UL) {
+  return *str ? config_hash(str + 1, (hash ^ (uint8_t)*str) * 16777619UL) : hash;
+}
 
-// Advanced settings
-  new ConfigOptDefenition<String>(esp_hostname, esp_hostname_default, "hostname", "hn"),
+static uint32_t config_name_hash(const char *str)
+{
+  uint32_t hash = 2166136261UL;
+  while(*str) {
+    hash = (hash ^ (uint8_t)*str++) * 16777619UL;
+  }
+  return hash;
+}
 
-// EMONCMS SERVER strings
-  new ConfigOptDefenition<String>(emoncms_server, "data.openevse.com/emoncms", "emoncms_server", "es"),
-  new ConfigOptDefenition<String>(emoncms_node, esp_hostname, "emoncms_node", "en"),
-  new ConfigOptSecret(emoncms_apikey, "", "emoncms_apikey", "ea"),
-  new ConfigOptDefenition<String>(emoncms_fingerprint, "", "emoncms_fingerprint", "ef"),
+#define CONFIG_OPT_STRINGS(name, shortName, type, optFlags, var, defString, defNumber) \
+  static const char _CONFIG_NAME_##name[] PROGMEM = #name; \
+  static const char _CONFIG_SHORT_##name[] PROGMEM = #shortName; \
+  static const char _CONFIG_DEFAULT_##name[] PROGMEM = defString;
 
-// MQTT Settings
-  new ConfigOptDefenition<String>(mqtt_server, "emonpi", "mqtt_server", "ms"),
-  new ConfigOptDefenition<uint32_t>(mqtt_port, 1883, "mqtt_port", "mpt"),
-  new ConfigOptDefenition<String>(mqtt_topic, esp_hostname, "mqtt_topic", "mt"),
-  new ConfigOptDefenition<String>(mqtt_user, "emonpi", "mqtt_user", "mu"),
-  new ConfigOptSecret(mqtt_pass, "emonpimqtt2016", "mqtt_pass", "mp"),
-  new ConfigOptDefenition<String>(mqtt_solar, "", "mqtt_solar", "mo"),
-  new ConfigOptDefenition<String>(mqtt_grid_ie, "emon/emonpi/power1", "mqtt_grid_ie", "mg"),
-  new ConfigOptDefenition<String>(mqtt_vrms, "emon/emonpi/vrms", "mqtt_vrms", "mv"),
-  new ConfigOptDefenition<String>(mqtt_announce_topic, "openevse/announce/"+ESPAL.getShortId(), "mqtt_announce_topic", "ma"),
+#define CONFIG_OPT_ID(name, shortName, type, optFlags, var, defString, defNumber) \
+  CONFIG_ID_##name,
 
-// Ohm Connect Settings
-  new ConfigOptDefenition<String>(ohm, "", "ohm", "o"),
+#define CONFIG_OPT_ENTRY(name, shortName, type, optFlags, var, defString, defNumber) \
+  { _CONFIG_NAME_##name, _CONFIG_SHORT_##name, config_hash(#name), config_hash(#shortName), \
+    &var, _CONFIG_DEFAULT_##name, defNumber, type, optFlags },
 
-// Divert settings
-  new ConfigOptDefenition<double>(divert_attack_smoothing_factor, 0.4, "divert_attack_smoothing_factor", "da"),
-  new ConfigOptDefenition<double>(divert_decay_smoothing_factor, 0.05, "divert_decay_smoothing_factor", "dd"),
-  new ConfigOptDefenition<uint32_t>(divert_min_charge_time, (10 * 60), "divert_min_charge_time", "dt"),
-
-// Flags
-  &flagsOpt,
-
-// Virtual Options
-  new ConfigOptVirtualBool(flagsOpt, CONFIG_SERVICE_EMONCMS, CONFIG_SERVICE_EMONCMS, "emoncms_enabled", "ee"),
-  new ConfigOptVirtualBool(flagsOpt, CONFIG_SERVICE_MQTT, CONFIG_SERVICE_MQTT, "mqtt_enabled", "me"),
-  new ConfigOptVirtualBool(flagsOpt, CONFIG_SERVICE_OHM, CONFIG_SERVICE_OHM, "ohm_enabled", "oe"),
-  new ConfigOptVirtualBool(flagsOpt, CONFIG_SERVICE_DIVERT, CONFIG_SERVICE_DIVERT, "divert_enabled", "de"),
-  new ConfigOptVirtualChargeMode(flagsOpt, "charge_mode", "chmd")
+// The option IDs are the index in to the table
+enum
+{
+  CONFIG_OPTIONS(CONFIG_OPT_ID)
+  CONFIG_OPTION_COUNT
 };
 
-ConfigJson config(opts, sizeof(opts) / sizeof(opts[0]), EEPROM_SIZE);
+// Changes are tracked as a bit mask of option IDs
+static_assert(CONFIG_OPTION_COUNT <= 32, "Too many config options");
+#define CONFIG_BIT(name) (1UL << CONFIG_ID_##name)
+
+CONFIG_OPTIONS(CONFIG_OPT_STRINGS)
+
+static const ConfigOption config_options[] PROGMEM =
+{
+  CONFIG_OPTIONS(CONFIG_OPT_ENTRY)
+};
+
+// Copy an option out of flash
+static void config_option(size_t index, ConfigOption &opt)
+{
+  memcpy_P(&opt, &config_options[index], sizeof(opt));
+}
+
+// Returns the index of the option with the given long or short name, or -1
+static int config_find(const char *name)
+{
+  uint32_t hash = config_name_hash(name);
+  for(size_t i = 0; i < CONFIG_OPTION_COUNT; i++)
+  {
+    const ConfigOption *opt = &config_options[i];
+    if(hash == pgm_read_dword(&opt->nameHash) &&
+       0 == strcmp_P(name, (PGM_P)pgm_read_ptr(&opt->name)))
+    {
+      return i;
+    }
+    if(hash == pgm_read_dword(&opt->shortNameHash) &&
+       0 == strcmp_P(name, (PGM_P)pgm_read_ptr(&opt->shortName)))
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static bool config_has_dynamic_default(const ConfigOption &opt) {
+  return opt.flags & (CONFIG_OPT_DEF_HOSTNAME | CONFIG_OPT_DEF_ID);
+}
+
+static void config_string_default(const ConfigOption &opt, String &value)
+{
+  if(opt.flags & CONFIG_OPT_DEF_HOSTNAME) {
+    value = esp_hostname;
+  } else {
+    value = FPSTR(opt.defaultString);
+    if(opt.flags & CONFIG_OPT_DEF_ID) {
+      value += ESPAL.getShortId();
+    }
+  }
+}
+
+static bool config_is_default(const ConfigOption &opt)
+{
+  switch(opt.type)
+  {
+    case CONFIG_OPT_STRING:
+      return false == config_has_dynamic_default(opt) &&
+             0 == strcmp_P(((String *)opt.value)->c_str(), opt.defaultString);
+    case CONFIG_OPT_UINT32:
+      return *(uint32_t *)opt.value == (uint32_t)opt.defaultNumber;
+    case CONFIG_OPT_DOUBLE:
+      return *(double *)opt.value == opt.defaultNumber;
+  }
+  return false;
+}
+
+// Set all the saved options to their defaults
+static void config_defaults()
+{
+  for(size_t i = 0; i < CONFIG_OPTION_COUNT; i++)
+  {
+    ConfigOption opt;
+    config_option(i, opt);
+    switch(opt.type)
+    {
+      case CONFIG_OPT_STRING:
+        config_string_default(opt, *(String *)opt.value);
+        break;
+      case CONFIG_OPT_UINT32:
+        *(uint32_t *)opt.value = (uint32_t)opt.defaultNumber;
+        break;
+      case CONFIG_OPT_DOUBLE:
+        *(double *)opt.value = opt.defaultNumber;
+        break;
+    }
+  }
+}
+
+// Set an option from a JSON value, the config is told if it changes
+static void config_option_set(int id, const ConfigOption &opt, JsonVariantConst value)
+{
+  if(value.isNull()) {
+    return;
+  }
+
+  bool changed = false;
+  switch(opt.type)
+  {
+    case CONFIG_OPT_STRING:
+    {
+      char number[32];
+      const char *text = value.as<const char *>();
+      if(NULL == text) {
+        serializeJson(value, number, sizeof(number));
+        text = number;
+      }
+      if((opt.flags & CONFIG_OPT_SECRET) && 0 == strcmp_P(text, _CONFIG_SECRET_DUMMY)) {
+        return;
+      }
+
+      String *str = (String *)opt.value;
+      if(*str != text) {
+        *str = text;
+        changed = true;
+      }
+    } break;
+
+    case CONFIG_OPT_UINT32:
+    {
+      uint32_t val = value.as<uint32_t>();
+      changed = *(uint32_t *)opt.value != val;
+      *(uint32_t *)opt.value = val;
+    } break;
+
+    case CONFIG_OPT_DOUBLE:
+    {
+      double val = value.as<double>();
+      changed = *(double *)opt.value != val;
+      *(double *)opt.value = val;
+    } break;
+
+    case CONFIG_OPT_FLAG:
+    {
+      uint32_t mask = (uint32_t)opt.defaultNumber;
+      uint32_t val = value.as<bool>() ? (flags | mask) : (flags & ~mask);
+      changed = flags != val;
+      flags = val;
+    } break;
+
+    case CONFIG_OPT_CHARGE_MODE:
+    {
+      const char *text = value.as<const char *>();
+      uint32_t val = flags & ~CONFIG_CHARGE_MODE;
+      if(text && 0 == strcmp(text, "eco")) {
+        val |= 1 << 10;
+      }
+      DBUGF("Set charge mode to %s", text ? text : "fast");
+      changed = flags != val;
+      flags = val;
+    } break;
+  }
+
+  if(changed) {
+    config_changed(id);
+  }
+}
+
+static void config_set_value(const char *name, JsonVariantConst value)
+{
+  int index = config_find(name);
+  if(index >= 0)
+  {
+    ConfigOption opt;
+    config_option(index, opt);
+    config_option_set(index, opt, value);
+  }
+}
 
 // -------------------------------------------------------------------
 // Reset EEPROM, wipes all settings
@@ -127,84 +374,329 @@ ResetEEPROM() {
   EEPROM.end();
 }
 
+// Load the JSON config saved in EEPROM by earlier firmware
+static bool config_load_json()
+{
+  EEPROM.begin(EEPROM_SIZE);
+
+  bool loaded = false;
+  if('{' == EEPROM.read(0))
+  {
+    ConfigParser parser(0);
+    uint8_t buffer[32];
+    bool end = false;
+    for(size_t offset = 0; false == end && offset < EEPROM_SIZE; offset += sizeof(buffer))
+    {
+      size_t len = 0;
+      while(len < sizeof(buffer) && offset + len < EEPROM_SIZE)
+      {
+        uint8_t c = EEPROM.read(offset + len);
+        if(0 == c || 0xff == c) {
+          end = true;
+          break;
+        }
+        buffer[len++] = c;
+      }
+      if(false == parser.parse(buffer, len)) {
+        break;
+      }
+    }
+    loaded = CONFIG_PARSER_OK == parser.end();
+  }
+
+  EEPROM.end();
+  return loaded;
+}
+
 // -------------------------------------------------------------------
-// Load saved settings from EEPROM
+// Load saved settings, from the binary store or else the older JSON and
+// v1 EEPROM formats
 // -------------------------------------------------------------------
 void
 config_load_settings() 
 {
-  config.onChanged(config_changed);
+  config_defaults();
+
+  uint32_t start = micros();
+  bool convert = false;
+  if(false == config_store_load())
+  {
+    if(config_load_json()) {
+      convert = true;
+    } else {
+      DBUGF("No JSON config found, trying v1 settings");
+      config_load_v1_settings();
+    }
+  }
+  config_load_time = micros() - start;
+  DBUGF("Config loaded in %uus", config_load_time);
+
+  // Loading is not a change, the subscribers read the config when they
+  // start
+  config_dirty = 0;
+  config_changed_options = 0;
+
+  if(convert) {
+    // Move it over to the binary store
+    DBUGF("Converting JSON config");
+    config_commit();
+  }
+}
+
+// -------------------------------------------------------------------
+// Change notifications
+//
+// Changes are collected and each subscriber is called once per commit
+// with the options it is interested in that have changed.
+// -------------------------------------------------------------------
+
+#define CONFIG_MQTT_SETTINGS ( \
+  CONFIG_BIT(mqtt_server) | CONFIG_BIT(mqtt_port) | CONFIG_BIT(mqtt_topic) | \
+  CONFIG_BIT(mqtt_user) | CONFIG_BIT(mqtt_pass) | CONFIG_BIT(mqtt_solar) | \
+  CONFIG_BIT(mqtt_grid_ie) | CONFIG_BIT(mqtt_vrms) | CONFIG_BIT(mqtt_announce_topic))
+
+#define CONFIG_EMONCMS_SETTINGS ( \
+  CONFIG_BIT(emoncms_server) | CONFIG_BIT(emoncms_node) | \
+  CONFIG_BIT(emoncms_apikey) | CONFIG_BIT(emoncms_fingerprint))
+
+static void config_mqtt_changed(uint32_t options)
+{
+  if((options & CONFIG_MQTT_SETTINGS) || mqtt_connected() != config_mqtt_enabled()) {
+    mqtt_restart();
+  }
+}
 
-  if(!config.load()) {
-    DBUGF("No JSON config found, trying v1 settings");
-    config_load_v1_settings();
+static void config_emoncms_changed(uint32_t options)
+{
+  if((options & CONFIG_EMONCMS_SETTINGS) || emoncms_connected != config_emoncms_enabled()) {
+    emoncms_updated = true;
   }
 }
 
-void config_changed(String name)
+static void config_divert_changed(uint32_t options)
 {
-  DBUGF("%s changed", name.c_str());
+  DBUGVAR(config_divert_enabled());
+  DBUGVAR(config_charge_mode());
+  divertmode_update((config_divert_enabled() && 1 == config_charge_mode()) ? DIVERT_MODE_ECO : DIVERT_MODE_NORMAL);
+}
 
-  if(name == "flags") {
-    divertmode_update((config_divert_enabled() && 1 == config_charge_mode()) ? DIVERT_MODE_ECO : DIVERT_MODE_NORMAL);
-    if(mqtt_connected() != config_mqtt_enabled()) {
-      mqtt_restart();
+static void config_www_changed(uint32_t options)
+{
+  web_session_clear();
+}
+
+struct ConfigSubscriber
+{
+  uint32_t options;
+  void (*changed)(uint32_t options);
+};
+
+static const ConfigSubscriber config_subscribers[] =
+{
+  { CONFIG_MQTT_SETTINGS | CONFIG_BIT(mqtt_enabled) | CONFIG_BIT(flags), config_mqtt_changed },
+  { CONFIG_EMONCMS_SETTINGS | CONFIG_BIT(emoncms_enabled) | CONFIG_BIT(flags), config_emoncms_changed },
+  { CONFIG_BIT(divert_enabled) | CONFIG_BIT(charge_mode) | CONFIG_BIT(flags), config_divert_changed },
+  { CONFIG_BIT(www_username) | CONFIG_BIT(www_password), config_www_changed }
+};
+
+#define CONFIG_SUBSCRIBER_COUNT (sizeof(config_subscribers) / sizeof(config_subscribers[0]))
+
+static void config_changed(int id)
+{
+  DBUGF("Config %d changed", id);
+  state_changed();
+
+  // Restart the quiet period
+  config_dirty++;
+  config_commit_time = millis();
+
+  config_changed_options |= 1UL << id;
+}
+
+static void config_notify()
+{
+  uint32_t options = config_changed_options;
+  config_changed_options = 0;
+
+  for(size_t i = 0; i < CONFIG_SUBSCRIBER_COUNT; i++)
+  {
+    uint32_t changed = options & config_subscribers[i].options;
+    if(changed) {
+      config_subscribers[i].changed(changed);
     }
-    if(emoncms_connected != config_emoncms_enabled()) {
-      emoncms_updated = true;
-    } 
-  } else if(name.startsWith("mqtt_")) {
-    mqtt_restart();
-  } else if(name.startsWith("emoncms_")) {
-    emoncms_updated = true;
-  } else if(name == "divert_enabled" || name == "charge_mode") {
-    DBUGVAR(config_divert_enabled());
-    DBUGVAR(config_charge_mode());
-    divertmode_update((config_divert_enabled() && 1 == config_charge_mode()) ? DIVERT_MODE_ECO : DIVERT_MODE_NORMAL);
   }
 }
 
 void config_commit()
 {
-  config.commit();
+  config_notify();
+
+  if(false == config_commit_pending) {
+    config_commit_pending = true;
+    config_commit_time = millis();
+  }
+}
+
+void config_flush()
+{
+  if(false == config_commit_pending) {
+    return;
+  }
+  config_commit_pending = false;
+
+  // Nothing changed, or everything was changed back so the record is
+  // the same as the one stored
+  bool dirty = config_dirty > 0 || false == config_store_valid();
+  config_dirty = 0;
+
+  Profile_Start(config_flush);
+  int ret = dirty ? config_store_save() : CONFIG_STORE_UNCHANGED;
+  Profile_End(config_flush, 10);
+
+  if(CONFIG_STORE_WRITTEN == ret) {
+    config_commits++;
+  } else if(CONFIG_STORE_UNCHANGED == ret) {
+    DBUGF("Config unchanged, not saving");
+    config_commits_skipped++;
+  }
+}
+
+void config_loop()
+{
+  if(config_commit_pending && millis() - config_commit_time >= CONFIG_COMMIT_DELAY) {
+    config_flush();
+  }
 }
 
 bool config_deserialize(String& json) {
-  return config.deserialize(json.c_str());
+  return config_deserialize(json.c_str());
 }
 
 bool config_deserialize(const char *json)
 {
-  return config.deserialize(json);
+  ConfigParser parser(0);
+  parser.parse((const uint8_t *)json, strlen(json));
+  return CONFIG_PARSER_OK == parser.end();
 }
 
-bool config_deserialize(DynamicJsonDocument &doc) 
+bool config_deserialize(JsonDocument &doc)
 {
-  return config.deserialize(doc);
+  if(false == doc.is<JsonObject>()) {
+    return false;
+  }
+
+  for(JsonPair kv : doc.as<JsonObject>()) {
+    config_set_value(kv.key().c_str(), kv.value());
+  }
+  return true;
 }
 
 bool config_serialize(String& json, bool longNames, bool compactOutput, bool hideSecrets)
 {
-  return config.serialize(json, longNames, compactOutput, hideSecrets);
+  DynamicJsonDocument doc(CONFIG_JSON_DOC_SIZE);
+  bool ret = config_serialize(doc, longNames, compactOutput, hideSecrets);
+  serializeJson(doc, json);
+  return ret;
+}
+
+// Bit mask of the options named in a comma separated list
+static uint32_t config_field_mask(const char *fields)
+{
+  uint32_t mask = 0;
+  while(*fields)
+  {
+    const char *end = strchr(fields, ',');
+    size_t len = end ? end - fields : strlen(fields);
+
+    char name[32];
+    if(len < sizeof(name))
+    {
+      memcpy(name, fields, len);
+      name[len] = '\0';
+      int index = config_find(name);
+      if(index >= 0) {
+        mask |= 1UL << index;
+      }
+    }
+
+    fields += len;
+    if(',' == *fields) {
+      fields++;
+    }
+  }
+  return mask;
 }
 
-bool config_serialize(DynamicJsonDocument &doc, bool longNames, bool compactOutput, bool hideSecrets)
+// The string values are added to the document by reference, so it must
+// be used before the config is next changed
+bool config_serialize(DynamicJsonDocument &doc, bool longNames, bool compactOutput, bool hideSecrets, const char *fields)
 {
-  return config.serialize(doc, longNames, compactOutput, hideSecrets);
+  uint32_t mask = fields ? config_field_mask(fields) : 0xffffffff;
+
+  for(size_t i = 0; i < CONFIG_OPTION_COUNT; i++)
+  {
+    if(0 == (mask & (1UL << i))) {
+      continue;
+    }
+
+    ConfigOption opt;
+    config_option(i, opt);
+
+    // Only the values that are not the default are needed to restore it
+    if(compactOutput && ((opt.flags & CONFIG_OPT_VIRTUAL) || config_is_default(opt))) {
+      continue;
+    }
+
+    const __FlashStringHelper *key = FPSTR(longNames ? opt.name : opt.shortName);
+    switch(opt.type)
+    {
+      case CONFIG_OPT_STRING:
+      {
+        const String *str = (const String *)opt.value;
+        if(hideSecrets && (opt.flags & CONFIG_OPT_SECRET)) {
+          doc[key] = str->length() > 0 ? FPSTR(_CONFIG_SECRET_DUMMY) : F("");
+        } else {
+          doc[key] = str->c_str();
+        }
+      } break;
+      case CONFIG_OPT_UINT32:
+        doc[key] = *(uint32_t *)opt.value;
+        break;
+      case CONFIG_OPT_DOUBLE:
+        doc[key] = *(double *)opt.value;
+        break;
+      case CONFIG_OPT_FLAG:
+        doc[key] = 0 != (flags & (uint32_t)opt.defaultNumber);
+        break;
+      case CONFIG_OPT_CHARGE_MODE:
+        doc[key] = 1 == config_charge_mode() ? "eco" : "fast";
+        break;
+    }
+  }
+
+  return false == doc.overflowed();
 }
 
 void config_set(const char *name, uint32_t val) {
-  config.set(name, val);
-} 
+  StaticJsonDocument<16> doc;
+  doc.set(val);
+  config_set_value(name, doc.as<JsonVariantConst>());
+}
 void config_set(const char *name, String val) {
-  config.set(name, val);
-} 
+  StaticJsonDocument<16> doc;
+  doc.set(val.c_str());
+  config_set_value(name, doc.as<JsonVariantConst>());
+}
 void config_set(const char *name, bool val) {
-  config.set(name, val);
-} 
+  StaticJsonDocument<16> doc;
+  doc.set(val);
+  config_set_value(name, doc.as<JsonVariantConst>());
+}
 void config_set(const char *name, double val) {
-  config.set(name, val);
-} 
+  StaticJsonDocument<16> doc;
+  doc.set(val);
+  config_set_value(name, doc.as<JsonVariantConst>());
+}
 
 void config_save_emoncms(bool enable, String server, String node, String apikey,
                     String fingerprint)
@@ -214,12 +706,12 @@ void config_save_emoncms(bool enable, String server, String node, String apikey,
     newflags |= CONFIG_SERVICE_EMONCMS;
   }
 
-  config.set("emoncms_server", server);
-  config.set("emoncms_node", node);
-  config.set("emoncms_apikey", apikey);
-  config.set("emoncms_fingerprint", fingerprint);
-  config.set("flags", newflags);
-  config.commit();
+  config_set("emoncms_server", server);
+  config_set("emoncms_node", node);
+  config_set("emoncms_apikey", apikey);
+  config_set("emoncms_fingerprint", fingerprint);
+  config_set("flags", newflags);
+  config_commit();
 }
 
 void
@@ -229,36 +721,36 @@ config_save_mqtt(bool enable, String server, uint16_t port, String topic, String
     newflags |= CONFIG_SERVICE_MQTT;
   }
 
-  config.set("mqtt_server", server);
-  config.set("mqtt_port", port);
-  config.set("mqtt_topic", topic);
-  config.set("mqtt_user", user);
-  config.set("mqtt_pass", pass);
-  config.set("mqtt_solar", solar);
-  config.set("mqtt_grid_ie", grid_ie);
-  config.set("flags", newflags);
-  config.commit();
+  config_set("mqtt_server", server);
+  config_set("mqtt_port", (uint32_t)port);
+  config_set("mqtt_topic", topic);
+  config_set("mqtt_user", user);
+  config_set("mqtt_pass", pass);
+  config_set("mqtt_solar", solar);
+  config_set("mqtt_grid_ie", grid_ie);
+  config_set("flags", newflags);
+  config_commit();
 }
 
 void
 config_save_admin(String user, String pass) {
-  config.set("www_username", user);
-  config.set("www_password", pass);
-  config.commit();
+  config_set("www_username", user);
+  config_set("www_password", pass);
+  config_commit();
 }
 
 void
 config_save_advanced(String hostname) {
-  config.set("hostname", hostname);
-  config.commit();
+  config_set("hostname", hostname);
+  config_commit();
 }
 
 void
 config_save_wifi(String qsid, String qpass)
 {
-  config.set("ssid", qsid);
-  config.set("pass", qpass);
-  config.commit();
+  config_set("ssid", qsid);
+  config_set("pass", qpass);
+  config_commit();
 }
 
 void
@@ -269,19 +761,24 @@ config_save_ohm(bool enable, String qohm)
     newflags |= CONFIG_SERVICE_OHM;
   }
 
-  config.set("ohm", qohm);
-  config.set("flags", newflags);
-  config.commit();
+  config_set("ohm", qohm);
+  config_set("flags", newflags);
+  config_commit();
 }
 
 void
 config_save_flags(uint32_t newFlags) {
-  config.set("flags", newFlags);
-  config.commit();
+  config_set("flags", newFlags);
+  config_commit();
 }
 
 void
 config_reset() {
   ResetEEPROM();
-  config.reset();
+  config_store_erase();
+  config_defaults();
+
+  // The defaults do not need saving
+  config_commit_pending = false;
+  config_dirty = 0;
 }
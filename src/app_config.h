@@ -4,10 +4,16 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 
+// Quiet period before changes are written to flash (ms)
+#ifndef CONFIG_COMMIT_DELAY
+#define CONFIG_COMMIT_DELAY     (5 * 1000)
+#endif
+
 // -------------------------------------------------------------------
 // Load and save the OpenEVSE WiFi config.
 //
-// This initial implementation saves the config to the EEPROM area of flash
+// The config is saved as a binary record in flash, see app_config_store.h,
+// JSON is used to import/export it
 // -------------------------------------------------------------------
 
 // Global config varables
@@ -132,11 +138,33 @@ void config_set(const char *name, double val);
 // Read config settings from JSON object
 bool config_deserialize(String& json);
 bool config_deserialize(const char *json);
-bool config_deserialize(DynamicJsonDocument &doc);
+bool config_deserialize(JsonDocument &doc);
+
+// -------------------------------------------------------------------
+// Save the config
+//
+// The subscribers to the options changed since the last commit are told
+// straight away, once per commit however many options changed. The write
+// is deferred until there have been no changes for CONFIG_COMMIT_DELAY,
+// so several saves in a row only cost one flash erase/write, and skipped
+// if the contents have not changed.
+// config_flush() writes any pending changes now, eg. before a restart.
+// -------------------------------------------------------------------
 void config_commit();
+void config_flush();
+void config_loop();
+
+// Number of times the config has been written to flash, and the commits
+// that did not need to be
+extern uint32_t config_commits;
+extern uint32_t config_commits_skipped;
+
+// Time taken to load the config at boot (us)
+extern uint32_t config_load_time;
 
 // Write config settings to JSON object
 bool config_serialize(String& json, bool longNames = true, bool compactOutput = false, bool hideSecrets = false);
-bool config_serialize(DynamicJsonDocument &doc, bool longNames = true, bool compactOutput = false, bool hideSecrets = false);
+// fields is an optional comma separated list of the option names to include
+bool config_serialize(DynamicJsonDocument &doc, bool longNames = true, bool compactOutput = false, bool hideSecrets = false, const char *fields = NULL);
 
 #endif // _EMONESP_CONFIG_H
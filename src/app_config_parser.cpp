@@ -0,0 +1,451 @@
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <new>
+
+#include "emonesp.h"
+#include "app_config.h"
+#include "app_config_parser.h"
+
+enum
+{
+  PARSER_START,             // Waiting for the opening {
+  PARSER_KEY_OR_END,        // After the {, a key or }
+  PARSER_KEY_START,         // After a comma, must be a key
+  PARSER_KEY,
+  PARSER_COLON,
+  PARSER_VALUE,
+  PARSER_STRING,
+  PARSER_LITERAL,           // Number, true, false or null
+  PARSER_SKIP,              // Nested object or array
+  PARSER_NEXT,              // After a value, a comma or }
+  PARSER_DONE
+};
+
+#define LITERAL_STRING      0
+#define LITERAL_OTHER       1
+
+// Returned by stringChar()
+#define STRING_MORE         0
+#define STRING_END          1
+#define STRING_ERROR        -1
+
+static bool isWhitespace(char c) {
+  return ' ' == c || '\t' == c || '\r' == c || '\n' == c;
+}
+
+static int hexValue(char c)
+{
+  if(c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if(c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if(c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+ConfigParser::ConfigParser(size_t total) :
+  ConfigParser(total, NULL, 0)
+{
+}
+
+ConfigParser::ConfigParser(size_t total, char *stage, size_t stageSize) :
+  _state(PARSER_START),
+  _literal(LITERAL_STRING),
+  _depth(0),
+  _unicode(0),
+  _codepoint(0),
+  _escape(false),
+  _skipString(false),
+  _ignoreKey(false),
+  _keyLen(0),
+  _valueLen(0),
+  _result(CONFIG_PARSER_OK),
+  _applied(0),
+  _stage(stage),
+  _stageSize(stageSize),
+  _stageLen(0)
+{
+  _key[0] = '\0';
+  _value[0] = '\0';
+
+  if(total > CONFIG_BODY_MAX) {
+    _result = CONFIG_PARSER_TOO_LARGE;
+  }
+}
+
+// The decoded key/values are never longer than the JSON they came from,
+// so the body length is enough room to stage them
+ConfigParser *ConfigParser::create(size_t total)
+{
+  size_t stageSize = total > CONFIG_BODY_MAX ? 0 : total;
+  void *mem = malloc(sizeof(ConfigParser) + stageSize);
+  if(NULL == mem) {
+    return NULL;
+  }
+  return new(mem) ConfigParser(total, (char *)mem + sizeof(ConfigParser), stageSize);
+}
+
+bool ConfigParser::fail(ConfigParserResult result)
+{
+  _result = result;
+  return false;
+}
+
+// Add a character to the key or value being read
+bool ConfigParser::put(char c)
+{
+  if(PARSER_KEY == _state)
+  {
+    if(_keyLen < CONFIG_PARSER_KEY_LEN) {
+      _key[_keyLen++] = c;
+    } else {
+      _ignoreKey = true;
+    }
+    return true;
+  }
+
+  if(_valueLen < CONFIG_PARSER_VALUE_LEN) {
+    _value[_valueLen++] = c;
+    return true;
+  }
+
+  // Does not matter if the value is not going to be used
+  return _ignoreKey ? true : fail(CONFIG_PARSER_VALUE_TOO_LONG);
+}
+
+int8_t ConfigParser::stringChar(char c)
+{
+  if(_unicode > 0)
+  {
+    int digit = hexValue(c);
+    if(digit < 0) {
+      return STRING_ERROR;
+    }
+    _codepoint = (_codepoint << 4) | digit;
+    if(0 == --_unicode)
+    {
+      // Encode as UTF-8, a NUL can not be held in a C string
+      bool ok;
+      if(0 == _codepoint) {
+        ok = false;
+      } else if(_codepoint < 0x80) {
+        ok = put(_codepoint);
+      } else if(_codepoint < 0x800) {
+        ok = put(0xc0 | (_codepoint >> 6)) &&
+             put(0x80 | (_codepoint & 0x3f));
+      } else {
+        ok = put(0xe0 | (_codepoint >> 12)) &&
+             put(0x80 | ((_codepoint >> 6) & 0x3f)) &&
+             put(0x80 | (_codepoint & 0x3f));
+      }
+      return ok ? STRING_MORE : STRING_ERROR;
+    }
+    return STRING_MORE;
+  }
+
+  if(_escape)
+  {
+    _escape = false;
+    switch(c)
+    {
+      case '"':
+      case '\\':
+      case '/':
+        break;
+      case 'b': c = '\b'; break;
+      case 'f': c = '\f'; break;
+      case 'n': c = '\n'; break;
+      case 'r': c = '\r'; break;
+      case 't': c = '\t'; break;
+      case 'u':
+        _unicode = 4;
+        _codepoint = 0;
+        return STRING_MORE;
+      default:
+        return STRING_ERROR;
+    }
+    return put(c) ? STRING_MORE : STRING_ERROR;
+  }
+
+  if('\\' == c) {
+    _escape = true;
+    return STRING_MORE;
+  }
+  if('"' == c) {
+    return STRING_END;
+  }
+  if((uint8_t)c < 0x20) {
+    return STRING_ERROR;
+  }
+
+  return put(c) ? STRING_MORE : STRING_ERROR;
+}
+
+// Put a key/value in to a document with just the one member, so the
+// config options handle long/short names, virtual options and type
+// conversion exactly as they do for a whole document. Returns false if a
+// number is not valid, the document is left empty for null.
+static bool config_parser_value(JsonDocument &doc, const char *key, uint8_t literal, const char *value)
+{
+  if(LITERAL_STRING == literal) {
+    doc[key] = value;
+  } else if(0 == strcmp(value, "true")) {
+    doc[key] = true;
+  } else if(0 == strcmp(value, "false")) {
+    doc[key] = false;
+  } else if(0 == strcmp(value, "null")) {
+    return true;
+  }
+  else
+  {
+    char *end;
+    if(strpbrk(value, ".eE")) {
+      doc[key] = strtod(value, &end);
+    } else if('-' == value[0]) {
+      doc[key] = strtol(value, &end, 10);
+    } else {
+      doc[key] = strtoul(value, &end, 10);
+    }
+    if(end == value || '\0' != *end) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Handle the completed key/value, either staging it or giving it straight
+// to the config
+bool ConfigParser::endValue()
+{
+  _value[_valueLen] = '\0';
+
+  if(_ignoreKey) {
+    return true;
+  }
+
+  StaticJsonDocument<JSON_OBJECT_SIZE(1)> doc;
+  if(false == config_parser_value(doc, _key, _literal, _value)) {
+    return fail(CONFIG_PARSER_INVALID);
+  }
+  if(0 == doc.size()) {
+    return true;
+  }
+
+  if(_stage)
+  {
+    // Staged as key, '\0', literal type, value, '\0'
+    size_t len = _keyLen + 1 + 1 + _valueLen + 1;
+    if(_stageLen + len > _stageSize) {
+      return fail(CONFIG_PARSER_TOO_LARGE);
+    }
+    char *ptr = _stage + _stageLen;
+    memcpy(ptr, _key, _keyLen + 1);
+    ptr += _keyLen + 1;
+    *ptr++ = _literal;
+    memcpy(ptr, _value, _valueLen + 1);
+    _stageLen += len;
+    return true;
+  }
+
+  DBUGF("Config %s = %s", _key, _value);
+  config_deserialize(doc);
+  _applied++;
+
+  return true;
+}
+
+bool ConfigParser::parse(const uint8_t *data, size_t len)
+{
+  size_t i = 0;
+  while(CONFIG_PARSER_OK == _result && i < len)
+  {
+    char c = (char)data[i];
+
+    switch(_state)
+    {
+      case PARSER_START:
+        if('{' == c) {
+          _state = PARSER_KEY_OR_END;
+        } else if(!isWhitespace(c)) {
+          return fail(CONFIG_PARSER_INVALID);
+        }
+        break;
+
+      case PARSER_KEY_OR_END:
+        if('}' == c) {
+          _state = PARSER_DONE;
+          break;
+        }
+        // Fall through
+      case PARSER_KEY_START:
+        if('"' == c) {
+          _state = PARSER_KEY;
+          _keyLen = 0;
+          _ignoreKey = false;
+        } else if(!isWhitespace(c)) {
+          return fail(CONFIG_PARSER_INVALID);
+        }
+        break;
+
+      case PARSER_KEY:
+        switch(stringChar(c))
+        {
+          case STRING_END:
+            _key[_keyLen] = '\0';
+            _state = PARSER_COLON;
+            break;
+          case STRING_ERROR:
+            return fail(CONFIG_PARSER_INVALID);
+        }
+        break;
+
+      case PARSER_COLON:
+        if(':' == c) {
+          _state = PARSER_VALUE;
+        } else if(!isWhitespace(c)) {
+          return fail(CONFIG_PARSER_INVALID);
+        }
+        break;
+
+      case PARSER_VALUE:
+        _valueLen = 0;
+        if('"' == c) {
+          _state = PARSER_STRING;
+          _literal = LITERAL_STRING;
+        } else if('{' == c || '[' == c) {
+          _state = PARSER_SKIP;
+          _depth = 1;
+          _skipString = false;
+        } else if('-' == c || isalnum(c)) {
+          _state = PARSER_LITERAL;
+          _literal = LITERAL_OTHER;
+          put(c);
+        } else if(!isWhitespace(c)) {
+          return fail(CONFIG_PARSER_INVALID);
+        }
+        break;
+
+      case PARSER_STRING:
+        switch(stringChar(c))
+        {
+          case STRING_END:
+            if(false == endValue()) {
+              return false;
+            }
+            _state = PARSER_NEXT;
+            break;
+          case STRING_ERROR:
+            return CONFIG_PARSER_OK == _result ? fail(CONFIG_PARSER_INVALID) : false;
+        }
+        break;
+
+      case PARSER_LITERAL:
+        if(',' == c || '}' == c || isWhitespace(c))
+        {
+          if(false == endValue()) {
+            return false;
+          }
+          // The , or } still needs to be handled
+          _state = PARSER_NEXT;
+          continue;
+        }
+        if(false == put(c)) {
+          return false;
+        }
+        break;
+
+      case PARSER_SKIP:
+        if(_skipString)
+        {
+          if(_escape) {
+            _escape = false;
+          } else if('\\' == c) {
+            _escape = true;
+          } else if('"' == c) {
+            _skipString = false;
+          }
+        }
+        else if('"' == c) {
+          _skipString = true;
+        } else if('{' == c || '[' == c) {
+          if(++_depth > 8) {
+            return fail(CONFIG_PARSER_INVALID);
+          }
+        } else if(('}' == c || ']' == c) && 0 == --_depth) {
+          _state = PARSER_NEXT;
+        }
+        break;
+
+      case PARSER_NEXT:
+        if(',' == c) {
+          _state = PARSER_KEY_START;
+        } else if('}' == c) {
+          _state = PARSER_DONE;
+        } else if(!isWhitespace(c)) {
+          return fail(CONFIG_PARSER_INVALID);
+        }
+        break;
+
+      case PARSER_DONE:
+        if(!isWhitespace(c)) {
+          return fail(CONFIG_PARSER_INVALID);
+        }
+        break;
+    }
+
+    i++;
+  }
+
+  return CONFIG_PARSER_OK == _result;
+}
+
+ConfigParserResult ConfigParser::end()
+{
+  if(CONFIG_PARSER_OK == _result && PARSER_DONE != _state) {
+    _result = CONFIG_PARSER_INCOMPLETE;
+  }
+  return _result;
+}
+
+void ConfigParser::apply()
+{
+  if(CONFIG_PARSER_OK != _result || PARSER_DONE != _state) {
+    return;
+  }
+
+  const char *ptr = _stage;
+  const char *end = _stage + _stageLen;
+  while(ptr < end)
+  {
+    const char *key = ptr;
+    ptr += strlen(key) + 1;
+    uint8_t literal = *ptr++;
+    const char *value = ptr;
+    ptr += strlen(value) + 1;
+
+    DBUGF("Config %s = %s", key, value);
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> doc;
+    config_parser_value(doc, key, literal, value);
+    config_deserialize(doc);
+    _applied++;
+  }
+
+  _stageLen = 0;
+}
+
+const __FlashStringHelper *ConfigParser::resultString(ConfigParserResult result)
+{
+  switch(result)
+  {
+    case CONFIG_PARSER_OK:              return F("done");
+    case CONFIG_PARSER_TOO_LARGE:       return F("Body too large");
+    case CONFIG_PARSER_VALUE_TOO_LONG:  return F("Value too long");
+    case CONFIG_PARSER_INVALID:         return F("Could not parse JSON");
+    case CONFIG_PARSER_INCOMPLETE:      return F("Incomplete JSON");
+  }
+  return F("Unknown error");
+}
@@ -0,0 +1,106 @@
+#ifndef _EMONESP_CONFIG_PARSER_H
+#define _EMONESP_CONFIG_PARSER_H
+
+// -------------------------------------------------------------------
+// Streaming config parser
+//
+// Parses a flat JSON object a chunk at a time as it is received, so the
+// body of a config POST never has to be held in RAM as JSON. Nested
+// objects and arrays are skipped.
+//
+// A parser made with create() stages the decoded key/values and only
+// gives them to the config when apply() is called, once the whole body
+// has been checked. A parser constructed directly, for config that has
+// already been saved, applies each key/value as soon as it is complete.
+// -------------------------------------------------------------------
+
+#include <Arduino.h>
+
+// Largest config body accepted
+#ifndef CONFIG_BODY_MAX
+#define CONFIG_BODY_MAX           4096
+#endif
+
+// Longer keys can not be config names so are ignored
+#ifndef CONFIG_PARSER_KEY_LEN
+#define CONFIG_PARSER_KEY_LEN     39
+#endif
+
+// Longest value accepted, well over the longest config values (the HTTPS
+// fingerprint, API keys and passwords), longer values fail the parse
+#ifndef CONFIG_PARSER_VALUE_LEN
+#define CONFIG_PARSER_VALUE_LEN   255
+#endif
+
+enum ConfigParserResult
+{
+  CONFIG_PARSER_OK,
+  CONFIG_PARSER_TOO_LARGE,
+  CONFIG_PARSER_VALUE_TOO_LONG,
+  CONFIG_PARSER_INVALID,
+  CONFIG_PARSER_INCOMPLETE
+};
+
+// No destructor, so it can be kept in request->_tempObject which is
+// free()ed with the request
+class ConfigParser
+{
+private:
+  uint8_t _state;
+  uint8_t _literal;         // Type of the value in _value
+  uint8_t _depth;           // Of the nested value being skipped
+  uint8_t _unicode;         // Hex digits of a \u escape still to come
+  uint16_t _codepoint;
+  bool _escape;
+  bool _skipString;         // In a string within a skipped value
+  bool _ignoreKey;
+  size_t _keyLen;
+  size_t _valueLen;
+  ConfigParserResult _result;
+  uint32_t _applied;
+  char *_stage;             // Decoded key/values waiting for apply()
+  size_t _stageSize;
+  size_t _stageLen;
+  char _key[CONFIG_PARSER_KEY_LEN + 1];
+  char _value[CONFIG_PARSER_VALUE_LEN + 1];
+
+  bool fail(ConfigParserResult result);
+  bool put(char c);
+  int8_t stringChar(char c);
+  bool endValue();
+
+  ConfigParser(size_t total, char *stage, size_t stageSize);
+
+public:
+  // Parser that applies each value as it is parsed, total is the full
+  // length of the body
+  ConfigParser(size_t total);
+
+  // Parser that stages the values until apply() is called, allocated
+  // with malloc() along with room to stage the body so must be free()ed.
+  // Returns NULL if there is not enough memory.
+  static ConfigParser *create(size_t total);
+
+  // Parse the next chunk, returns false once an error has been found
+  bool parse(const uint8_t *data, size_t len);
+
+  // Call once the whole body has been received
+  ConfigParserResult end();
+
+  // Give the staged values to the config, only if end() returned
+  // CONFIG_PARSER_OK
+  void apply();
+
+  ConfigParserResult result() {
+    return _result;
+  }
+
+  // Number of key/values given to the config
+  uint32_t applied() {
+    return _applied;
+  }
+
+  static const __FlashStringHelper *resultString(ConfigParserResult result);
+};
+
+#endif // _EMONESP_CONFIG_PARSER_H
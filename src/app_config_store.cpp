@@ -0,0 +1,430 @@
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <coredecls.h>          // crc32()
+
+extern "C" {
+#include "spi_flash.h"
+}
+
+#include "emonesp.h"
+#include "app_config.h"
+#include "app_config_store.h"
+
+extern "C" uint32_t _SPIFFS_start;
+extern "C" uint32_t _SPIFFS_end;
+
+// "OEC" plus the format version
+#define CONFIG_STORE_MAGIC        0x0143454f
+
+#define CONFIG_STORE_SLOTS        2
+#define CONFIG_STORE_SECTOR(slot) ((((uint32_t)&_SPIFFS_end - 0x40200000) / SPI_FLASH_SEC_SIZE) - CONFIG_STORE_SLOTS + (slot))
+
+// Enough for the serialised config, the strings are referenced not copied
+#define CONFIG_STORE_DOC_SIZE     1024
+
+// Value types
+#define CONFIG_TYPE_BOOL          0
+#define CONFIG_TYPE_UINT          1
+#define CONFIG_TYPE_INT           2
+#define CONFIG_TYPE_DOUBLE        3
+#define CONFIG_TYPE_STRING        4
+#define CONFIG_TYPE_NONE          0xff
+
+struct ConfigStoreHeader
+{
+  uint32_t magic;
+  uint32_t seq;
+  uint16_t length;              // Of the payload following the header
+  uint16_t count;               // Number of values
+  uint32_t crc;                 // Of the payload
+};
+
+#define CONFIG_STORE_MAX_PAYLOAD  (SPI_FLASH_SEC_SIZE - sizeof(ConfigStoreHeader))
+
+// Each value in the payload is:
+//
+//   uint8_t keyLength, key, '\0', uint8_t type, value
+//
+// Numbers are stored as their native little endian bytes, strings as a
+// uint16_t length, the text and a '\0' so they can be used in place.
+
+static int config_store_slot = -1;
+static uint32_t config_store_seq = 0;
+static uint32_t config_store_crc = 0;
+
+// -------------------------------------------------------------------
+// Encoding
+// -------------------------------------------------------------------
+
+static uint8_t config_store_type(JsonVariantConst value)
+{
+  if(value.is<bool>()) {
+    return CONFIG_TYPE_BOOL;
+  }
+  if(value.is<uint32_t>()) {
+    return CONFIG_TYPE_UINT;
+  }
+  if(value.is<int32_t>()) {
+    return CONFIG_TYPE_INT;
+  }
+  if(value.is<double>()) {
+    return CONFIG_TYPE_DOUBLE;
+  }
+  if(value.is<const char *>()) {
+    return CONFIG_TYPE_STRING;
+  }
+  return CONFIG_TYPE_NONE;
+}
+
+static size_t config_store_value_size(uint8_t type, JsonVariantConst value)
+{
+  switch(type)
+  {
+    case CONFIG_TYPE_BOOL:    return 1;
+    case CONFIG_TYPE_UINT:
+    case CONFIG_TYPE_INT:     return 4;
+    case CONFIG_TYPE_DOUBLE:  return sizeof(double);
+  }
+  return 2 + strlen(value.as<const char *>()) + 1;
+}
+
+static uint8_t *config_store_write_value(uint8_t *ptr, uint8_t type, JsonVariantConst value)
+{
+  switch(type)
+  {
+    case CONFIG_TYPE_BOOL:
+      *ptr++ = value.as<bool>() ? 1 : 0;
+      break;
+    case CONFIG_TYPE_UINT: {
+      uint32_t val = value.as<uint32_t>();
+      memcpy(ptr, &val, sizeof(val));
+      ptr += sizeof(val);
+    } break;
+    case CONFIG_TYPE_INT: {
+      int32_t val = value.as<int32_t>();
+      memcpy(ptr, &val, sizeof(val));
+      ptr += sizeof(val);
+    } break;
+    case CONFIG_TYPE_DOUBLE: {
+      double val = value.as<double>();
+      memcpy(ptr, &val, sizeof(val));
+      ptr += sizeof(val);
+    } break;
+    case CONFIG_TYPE_STRING: {
+      const char *val = value.as<const char *>();
+      uint16_t len = strlen(val);
+      memcpy(ptr, &len, sizeof(len));
+      ptr += sizeof(len);
+      memcpy(ptr, val, len + 1);
+      ptr += len + 1;
+    } break;
+  }
+  return ptr;
+}
+
+// Build the record for the current config, returns a buffer holding the
+// header and payload that must be freed, or NULL
+static uint32_t *config_store_encode(ConfigStoreHeader &header)
+{
+  // A partial document would be saved as a valid record with the missing
+  // options back at their defaults, keep the previous record instead
+  DynamicJsonDocument doc(CONFIG_STORE_DOC_SIZE);
+  if(false == config_serialize(doc, false, true, false) || doc.overflowed()) {
+    DBUGF("Config does not fit the %u byte document", CONFIG_STORE_DOC_SIZE);
+    return NULL;
+  }
+
+  JsonObject object = doc.as<JsonObject>();
+
+  size_t length = 0;
+  for(JsonPair kv : object)
+  {
+    JsonVariantConst value = kv.value();
+    uint8_t type = config_store_type(value);
+    if(CONFIG_TYPE_NONE != type) {
+      length += 1 + strlen(kv.key().c_str()) + 1 + 1 +
+                config_store_value_size(type, value);
+    }
+  }
+
+  if(length > CONFIG_STORE_MAX_PAYLOAD) {
+    DBUGF("Config too big to store, %u bytes", length);
+    return NULL;
+  }
+
+  // Rounded up to whole words for the flash
+  size_t size = (sizeof(ConfigStoreHeader) + length + 3) & ~3;
+  uint32_t *buffer = (uint32_t *)malloc(size);
+  if(NULL == buffer) {
+    return NULL;
+  }
+  memset(buffer, 0xff, size);
+
+  uint8_t *payload = (uint8_t *)buffer + sizeof(ConfigStoreHeader);
+  uint8_t *ptr = payload;
+  uint16_t count = 0;
+  for(JsonPair kv : object)
+  {
+    JsonVariantConst value = kv.value();
+    uint8_t type = config_store_type(value);
+    if(CONFIG_TYPE_NONE == type) {
+      continue;
+    }
+
+    const char *key = kv.key().c_str();
+    uint8_t keyLength = strlen(key);
+    *ptr++ = keyLength;
+    memcpy(ptr, key, keyLength + 1);
+    ptr += keyLength + 1;
+
+    *ptr++ = type;
+    ptr = config_store_write_value(ptr, type, value);
+    count++;
+  }
+
+  header.magic = CONFIG_STORE_MAGIC;
+  header.length = length;
+  header.count = count;
+  header.crc = crc32(payload, length);
+
+  return buffer;
+}
+
+// -------------------------------------------------------------------
+// Decoding
+// -------------------------------------------------------------------
+
+// Turn the payload in to a document for the config options, the strings
+// are left in the payload. Returns false if the payload is malformed.
+static bool config_store_decode(const uint8_t *payload, const ConfigStoreHeader &header, DynamicJsonDocument &doc)
+{
+  const uint8_t *ptr = payload;
+  const uint8_t *end = payload + header.length;
+
+  for(uint16_t i = 0; i < header.count; i++)
+  {
+    if(ptr >= end || ptr + 1 + *ptr + 1 + 1 > end) {
+      return false;
+    }
+    uint8_t keyLength = *ptr++;
+    const char *key = (const char *)ptr;
+    ptr += keyLength + 1;
+    if('\0' != key[keyLength]) {
+      return false;
+    }
+
+    uint8_t type = *ptr++;
+    switch(type)
+    {
+      case CONFIG_TYPE_BOOL:
+        if(ptr + 1 > end) {
+          return false;
+        }
+        doc[key] = 0 != *ptr++;
+        break;
+      case CONFIG_TYPE_UINT: {
+        uint32_t val;
+        if(ptr + sizeof(val) > end) {
+          return false;
+        }
+        memcpy(&val, ptr, sizeof(val));
+        ptr += sizeof(val);
+        doc[key] = val;
+      } break;
+      case CONFIG_TYPE_INT: {
+        int32_t val;
+        if(ptr + sizeof(val) > end) {
+          return false;
+        }
+        memcpy(&val, ptr, sizeof(val));
+        ptr += sizeof(val);
+        doc[key] = val;
+      } break;
+      case CONFIG_TYPE_DOUBLE: {
+        double val;
+        if(ptr + sizeof(val) > end) {
+          return false;
+        }
+        memcpy(&val, ptr, sizeof(val));
+        ptr += sizeof(val);
+        doc[key] = val;
+      } break;
+      case CONFIG_TYPE_STRING: {
+        uint16_t len;
+        if(ptr + sizeof(len) > end) {
+          return false;
+        }
+        memcpy(&len, ptr, sizeof(len));
+        ptr += sizeof(len);
+        const char *val = (const char *)ptr;
+        ptr += len + 1;
+        if(ptr > end || '\0' != val[len]) {
+          return false;
+        }
+        doc[key] = val;
+      } break;
+      default:
+        return false;
+    }
+  }
+
+  return true;
+}
+
+// -------------------------------------------------------------------
+// Flash access
+// -------------------------------------------------------------------
+
+// The slots are only there if the flash layout has room for them in the
+// SPIFFS area, with no SPIFFS the sectors would be sketch or OTA space
+static bool config_store_available()
+{
+  return (uint32_t)&_SPIFFS_end - (uint32_t)&_SPIFFS_start >= CONFIG_STORE_SLOTS * SPI_FLASH_SEC_SIZE;
+}
+
+static bool config_store_read_header(int slot, ConfigStoreHeader &header)
+{
+  uint32_t address = CONFIG_STORE_SECTOR(slot) * SPI_FLASH_SEC_SIZE;
+  if(SPI_FLASH_RESULT_OK != spi_flash_read(address, (uint32_t *)&header, sizeof(header))) {
+    return false;
+  }
+
+  return CONFIG_STORE_MAGIC == header.magic &&
+         header.length <= CONFIG_STORE_MAX_PAYLOAD;
+}
+
+// Read and apply the record in a slot
+static bool config_store_load_slot(int slot, const ConfigStoreHeader &header)
+{
+  uint32_t address = CONFIG_STORE_SECTOR(slot) * SPI_FLASH_SEC_SIZE + sizeof(ConfigStoreHeader);
+  size_t size = (header.length + 3) & ~3;
+  uint32_t *buffer = (uint32_t *)malloc(size);
+  if(NULL == buffer) {
+    return false;
+  }
+
+  bool loaded = false;
+  const uint8_t *payload = (const uint8_t *)buffer;
+  if(SPI_FLASH_RESULT_OK == spi_flash_read(address, buffer, size) &&
+     header.crc == crc32(payload, header.length))
+  {
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(header.count));
+    if(config_store_decode(payload, header, doc)) {
+      config_deserialize(doc);
+      loaded = true;
+    }
+  }
+
+  free(buffer);
+  return loaded;
+}
+
+bool config_store_load()
+{
+  if(false == config_store_available())
+  {
+    DEBUG.println(F("No SPIFFS area for the config, the config will not be saved. Use a flash layout with at least 8KB of SPIFFS."));
+    return false;
+  }
+
+  ConfigStoreHeader headers[CONFIG_STORE_SLOTS];
+  bool valid[CONFIG_STORE_SLOTS];
+  for(int slot = 0; slot < CONFIG_STORE_SLOTS; slot++) {
+    valid[slot] = config_store_read_header(slot, headers[slot]);
+  }
+
+  // Newest first, falling back to the other slot if that is corrupt
+  int first = 0;
+  if(valid[0] && valid[1]) {
+    first = (int32_t)(headers[1].seq - headers[0].seq) > 0 ? 1 : 0;
+  } else if(valid[1]) {
+    first = 1;
+  }
+
+  for(int i = 0; i < CONFIG_STORE_SLOTS; i++)
+  {
+    int slot = (first + i) % CONFIG_STORE_SLOTS;
+    if(valid[slot] && config_store_load_slot(slot, headers[slot]))
+    {
+      DBUGF("Config loaded from slot %d, seq %u", slot, headers[slot].seq);
+      config_store_slot = slot;
+      config_store_seq = headers[slot].seq;
+      config_store_crc = headers[slot].crc;
+      return true;
+    }
+    if(valid[slot]) {
+      DBUGF("Config slot %d is corrupt", slot);
+    }
+  }
+
+  return false;
+}
+
+int config_store_save()
+{
+  if(false == config_store_available()) {
+    DBUGF("No SPIFFS area for the config");
+    return CONFIG_STORE_FAILED;
+  }
+
+  ConfigStoreHeader header;
+  uint32_t *buffer = config_store_encode(header);
+  if(NULL == buffer) {
+    return CONFIG_STORE_FAILED;
+  }
+
+  if(config_store_valid() && header.crc == config_store_crc) {
+    free(buffer);
+    return CONFIG_STORE_UNCHANGED;
+  }
+
+  // Never overwrite the current record
+  int slot = (config_store_slot + 1) % CONFIG_STORE_SLOTS;
+  header.seq = config_store_seq + 1;
+  memcpy(buffer, &header, sizeof(header));
+
+  uint32_t sector = CONFIG_STORE_SECTOR(slot);
+  size_t size = (sizeof(header) + header.length + 3) & ~3;
+
+  // Header last, so an interrupted write does not look like a record
+  noInterrupts();
+  bool ok = SPI_FLASH_RESULT_OK == spi_flash_erase_sector(sector) &&
+            SPI_FLASH_RESULT_OK == spi_flash_write(sector * SPI_FLASH_SEC_SIZE + sizeof(header),
+                                                   buffer + sizeof(header) / 4,
+                                                   size - sizeof(header)) &&
+            SPI_FLASH_RESULT_OK == spi_flash_write(sector * SPI_FLASH_SEC_SIZE, buffer, sizeof(header));
+  interrupts();
+
+  free(buffer);
+
+  if(!ok) {
+    DBUGF("Failed to write config slot %d", slot);
+    return CONFIG_STORE_FAILED;
+  }
+
+  DBUGF("Config saved to slot %d, seq %u, %u bytes", slot, header.seq, header.length);
+  config_store_slot = slot;
+  config_store_seq = header.seq;
+  config_store_crc = header.crc;
+
+  return CONFIG_STORE_WRITTEN;
+}
+
+bool config_store_valid()
+{
+  return config_store_slot >= 0;
+}
+
+void config_store_erase()
+{
+  for(int slot = 0; slot < CONFIG_STORE_SLOTS && config_store_available(); slot++)
+  {
+    noInterrupts();
+    spi_flash_erase_sector(CONFIG_STORE_SECTOR(slot));
+    interrupts();
+  }
+
+  config_store_slot = -1;
+  config_store_seq = 0;
+  config_store_crc = 0;
+}
@@ -0,0 +1,38 @@
+#ifndef _EMONESP_CONFIG_STORE_H
+#define _EMONESP_CONFIG_STORE_H
+
+// -------------------------------------------------------------------
+// Binary config store
+//
+// The config is saved as a compact binary record in one of two flash
+// sectors, each with a sequence number and a CRC. Saves go to the sector
+// not holding the current record so a power cut mid write leaves the
+// previous record intact, and loading is a read and CRC check with no
+// JSON parsing.
+//
+// The sectors are the last two of the SPIFFS area, just below the EEPROM
+// sector. SPIFFS is not used by this firmware. On flash layouts without
+// two sectors of SPIFFS the store is not used, loading falls back to the
+// older formats and saving fails.
+// -------------------------------------------------------------------
+
+#include <Arduino.h>
+
+// Returned by config_store_save()
+#define CONFIG_STORE_WRITTEN      0
+#define CONFIG_STORE_UNCHANGED    1
+#define CONFIG_STORE_FAILED       -1
+
+// Load the newest valid record, returns false if neither slot has one
+extern bool config_store_load();
+
+// Save the current config if it is different to the stored record
+extern int config_store_save();
+
+// Check if a valid record has been loaded or saved
+extern bool config_store_valid();
+
+// Wipe both slots
+extern void config_store_erase();
+
+#endif // _EMONESP_CONFIG_STORE_H
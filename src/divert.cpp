@@ -7,10 +7,12 @@
 #include "input.h"
 #include "app_config.h"
 #include "RapiSender.h"
+#include "rapi_queue.h"
 #include "mqtt.h"
 #include "event.h"
 #include "openevse.h"
 #include "divert.h"
+#include "divert_calc.h"
 
 #include <sys/time.h>
 
@@ -26,8 +28,6 @@
 // If EVSE is sleeping charging will not start until solar PV / excess power > min chanrge rate
 // Once charging begins it will not pause even if solaer PV / excess power drops less then minimm charge rate. This avoids wear on the relay and the car
 
-#define GRID_IE_RESERVE_POWER   100.0
-
 // Default to normal charging unless set. Divert mode always defaults back to 1 if unit is reset (divertmode not saved in EEPROM)
 byte divertmode = DIVERT_MODE_NORMAL;     // default normal mode
 int solar = 0;
@@ -64,13 +64,14 @@ void divertmode_update(byte newmode)
   if(divertmode != newmode)
   {
     divertmode = newmode;
+    state_changed();
 
     // restore max charge current if normal mode or zero if eco mode
     switch(divertmode)
     {
       case DIVERT_MODE_NORMAL:
         // Restore the max charge current
-        rapiSender.sendCmdSync(String(F("$SC ")) + String(max_charge_current));
+        rapi_queue_send(String(F("$SC ")) + String(max_charge_current), RAPI_PRIORITY_CONTROL);
         DBUGF("Restore max I: %d", max_charge_current);
         break;
 
@@ -79,19 +80,29 @@ void divertmode_update(byte newmode)
         available_current = 0;
         smoothed_available_current = 0;
         min_charge_end = 0;
-        
+
         // Read the current charge current, assume this is the max set by the user
-        if(0 == rapiSender.sendCmdSync(F("$GE"))) {
-          max_charge_current = String(rapiSender.getToken(1)).toInt();
-          DBUGF("Read max I: %d", max_charge_current);
-        }
+        rapi_queue_send(F("$GE"), RAPI_PRIORITY_CONTROL, [](int ret)
+        {
+          if(RAPI_RESPONSE_OK == ret) {
+            max_charge_current = String(rapiSender.getToken(1)).toInt();
+            DBUGF("Read max I: %d", max_charge_current);
+          }
+        });
         if(OPENEVSE_STATE_SLEEPING != state)
         {
-          if(0 == rapiSender.sendCmdSync(F("$FS"))) 
+          rapi_queue_send(F("$FS"), RAPI_PRIORITY_SAFETY, [](int ret)
           {
-            DBUGLN(F("Divert activated, entered sleep mode"));
-            divert_active = false;
-          }
+            if(RAPI_RESPONSE_OK == ret)
+            {
+              DBUGLN(F("Divert activated, entered sleep mode"));
+              divert_active = false;
+
+              StaticJsonDocument<128> event;
+              event["divert_active"] = divert_active;
+              event_send(event);
+            }
+          });
         }
         break;
 
@@ -106,19 +117,126 @@ void divertmode_update(byte newmode)
   }
 }
 
-void divert_current_loop()
+// Steps of the eco mode state machine, each step that talks to the
+// OpenEVSE queues a single RAPI command and waits for the callback to
+// select the next step
+enum divert_step
 {
-  Profile_Start(divert_current_loop);
+  DIVERT_STEP_IDLE,
+  DIVERT_STEP_WAIT,             // Waiting for a RAPI response
+  DIVERT_STEP_READ_RATE,        // $GE, current charge rate
+  DIVERT_STEP_READ_CURRENT,     // $GG, current used by the EV
+  DIVERT_STEP_CALCULATE,
+  DIVERT_STEP_SET_RATE,         // $SC n V
+  DIVERT_STEP_SET_RATE_LEGACY,  // $SC n, for older firmware
+  DIVERT_STEP_CHECK_TIMER,      // $GD
+  DIVERT_STEP_PRESS_BUTTON,     // $F1, if the timer is enabled
+  DIVERT_STEP_START,            // $FE
+  DIVERT_STEP_STOP,             // $FS
+  DIVERT_STEP_RESTORE,          // $SC max
+  DIVERT_STEP_DONE
+};
+
+static divert_step step = DIVERT_STEP_IDLE;
+static bool sample_pending = false;
+static bool active_changed = false;
+static int current_charge_rate = 0;
+static double ev_amps = 0;
+
+static void divert_next(divert_step next) {
+  step = next;
+}
 
-  Profile_End(divert_current_loop, 5);
-} //end divert_current_loop
+// Queue a command for the current step, the callback picks the next step
+static void divert_send(const String &cmd, RapiQueueCompleteHandler callback)
+{
+  step = DIVERT_STEP_WAIT;
+  if(false == rapi_queue_send(cmd, RAPI_PRIORITY_CONTROL, callback)) {
+    // Could not queue, treat as a failed command
+    callback(RAPI_RESPONSE_QUEUE_FULL);
+  }
+}
 
-// Set charge rate depending on divert mode and solar / grid_ie
-void divert_update_state()
+// Step to take once the charge rate is correct
+static divert_step divert_after_rate()
 {
-  Profile_Start(divert_update_state);
+  // If charge rate > min current and EVSE is sleeping then start charging
+  return OPENEVSE_STATE_SLEEPING == state ? DIVERT_STEP_CHECK_TIMER : DIVERT_STEP_DONE;
+}
+
+// Work out the charge rate from the latest solar/grid_ie sample and select
+// the action needed
+static divert_step divert_update_rate()
+{
+  DivertCalcInput in;
+  in.feed = mqtt_grid_ie != "" ? DIVERT_FEED_GRID_IE :
+            mqtt_solar != "" ? DIVERT_FEED_SOLAR :
+            DIVERT_FEED_NONE;
+  in.solar = solar;
+  in.grid_ie = grid_ie;
+  in.voltage = voltage;
+  in.ev_amps = ev_amps;
+  in.attack_smoothing_factor = divert_attack_smoothing_factor;
+  in.decay_smoothing_factor = divert_decay_smoothing_factor;
+  in.min_charge_current = min_charge_current;
+  in.max_charge_current = max_charge_current;
+  in.current_charge_rate = current_charge_rate;
+  in.sleeping = OPENEVSE_STATE_SLEEPING == state;
+  in.divert_active = divert_active;
+  in.min_charge_time_elapsed = divertmode_get_time() >= min_charge_end;
+
+  DivertCalcState calc = { available_current, smoothed_available_current };
+  DivertCalcResult result;
+  divert_calculate(in, calc, result);
+
+  available_current = calc.available_current;
+  smoothed_available_current = calc.smoothed_available_current;
+  if(charge_rate != result.charge_rate) {
+    charge_rate = result.charge_rate;
+    state_changed();
+  }
 
-  StaticJsonDocument<128> event;
+  DBUGVAR(voltage);
+  DBUGVAR(available_current);
+  DBUGVAR(smoothed_available_current);
+  DBUGVAR(charge_rate);
+
+  if(result.set_rate) {
+    return DIVERT_STEP_SET_RATE;
+  }
+  if(result.start) {
+    return DIVERT_STEP_CHECK_TIMER;
+  }
+  if(result.stop) {
+    return DIVERT_STEP_STOP;
+  }
+
+  return DIVERT_STEP_DONE;
+}
+
+static void divert_set_rate_complete(int ret, divert_step fallback)
+{
+  if(RAPI_RESPONSE_OK == ret)
+  {
+    DBUGF("Charge rate set to %d", charge_rate);
+    pilot = charge_rate;
+    state_changed();
+    divert_next(divert_after_rate());
+  } else {
+    divert_next(fallback);
+  }
+}
+
+static void divert_charge_started()
+{
+  min_charge_end = divertmode_get_time() + divert_min_charge_time;
+  divert_active = true;
+  active_changed = true;
+}
+
+static void divert_send_event()
+{
+  StaticJsonDocument<256> event;
   event["divert_update"] = 0;
 
   if(mqtt_grid_ie != "") {
@@ -127,165 +245,166 @@ void divert_update_state()
     event["solar"] = solar;
   }
 
-  // If divert mode = Eco (2)
   if (divertmode == DIVERT_MODE_ECO)
   {
-    int current_charge_rate = charge_rate;
-
-    // Read the current charge rate
-    if(0 == rapiSender.sendCmdSync(F("$GE"))) {
-      current_charge_rate = String(rapiSender.getToken(1)).toInt();
-      DBUGVAR(current_charge_rate);
+    if(active_changed) {
+      event["divert_active"] = divert_active;
     }
+    event["charge_rate"] = charge_rate;
+    event["voltage"] = voltage;
+    event["available_current"] = available_current;
+    event["smoothed_available_current"] = smoothed_available_current;
+  }
 
-    // Calculate current
-    if (mqtt_grid_ie != "")
-    {
-      // if grid feed is available and exporting increment the charge rate,
-      // if importing drop the charge rate.
-      // grid_ie is negative when exporting
-      // If grid feeds is available and exporting (negative)
-
-      DBUGVAR(voltage);
-      double Igrid_ie = (double)grid_ie / voltage;
-      DBUGVAR(Igrid_ie);
-
-      // Subtract the current charge the EV is using from the Grid IE
-      if(0 == rapiSender.sendCmdSync(F("$GG"))) {
-        int milliAmps = String(rapiSender.getToken(1)).toInt();
-        double amps = (double)milliAmps / 1000.0;
-        DBUGVAR(amps);
-        Igrid_ie -= amps;
-        DBUGVAR(Igrid_ie);
-      }
+  event_send(event);
+}
 
-      if (Igrid_ie < 0)
-      {
-        // If excess power
-        double reserve = GRID_IE_RESERVE_POWER / voltage;
-        DBUGVAR(reserve);
-        available_current = (-Igrid_ie - reserve);
-      }
-      else
+// Advance the eco mode state machine, never blocks waiting for the OpenEVSE
+void divert_current_loop()
+{
+  Profile_Start(divert_current_loop);
+
+  switch(step)
+  {
+    case DIVERT_STEP_IDLE:
+      if(sample_pending)
       {
-        // no excess, so use the min charge
-        available_current = 0;
+        sample_pending = false;
+        active_changed = false;
+        divert_next(DIVERT_MODE_ECO == divertmode ? DIVERT_STEP_READ_RATE : DIVERT_STEP_DONE);
       }
-    }
-    else if (mqtt_solar!="")
-    {
-      // if grid feed is not available: charge rate = solar generation
-      DBUGVAR(voltage);
-      available_current = (double)solar / voltage;
-    }
-
-    if(available_current < 0) {
-      available_current = 0;
-    }
-    DBUGVAR(available_current);
-
-    double scale = available_current > smoothed_available_current ? divert_attack_smoothing_factor : divert_decay_smoothing_factor;
-    smoothed_available_current = (available_current * scale) + (smoothed_available_current * (1 - scale));
-    DBUGVAR(smoothed_available_current);
-
-    charge_rate = (int)floor(available_current);
-
-    if(OPENEVSE_STATE_SLEEPING != state) {
-      // If we are not sleeping, make sure we are the minimum current
-      charge_rate = max(charge_rate, static_cast<int>(min_charge_current));
-    }
+      break;
 
-    DBUGVAR(charge_rate);
+    case DIVERT_STEP_WAIT:
+      break;
 
-    if(smoothed_available_current >= min_charge_current)
-    {
-      // Cap the charge rate at the configured maximum
-      charge_rate = min(charge_rate, static_cast<int>(max_charge_current));
-
-      // Change the charge rate is needed
-      if(current_charge_rate != charge_rate)
+    case DIVERT_STEP_READ_RATE:
+      current_charge_rate = charge_rate;
+      divert_send(F("$GE"), [](int ret)
       {
-        // Set charge rate via RAPI
-        bool chargeRateSet = false;
-        // Try and set current with new API with volatile flag (don't save the current rate to EEPROM)
-        if(0 == rapiSender.sendCmdSync(String(F("$SC ")) + String(charge_rate) + String(F(" V")))) {
-          chargeRateSet = true;
-        } else if(0 == rapiSender.sendCmdSync(String(F("$SC ")) + String(charge_rate))) {
-          // Fallback to old API
-          chargeRateSet = true;
+        // Read the current charge rate
+        if(RAPI_RESPONSE_OK == ret) {
+          current_charge_rate = String(rapiSender.getToken(1)).toInt();
+          DBUGVAR(current_charge_rate);
         }
+        divert_next(mqtt_grid_ie != "" ? DIVERT_STEP_READ_CURRENT : DIVERT_STEP_CALCULATE);
+      });
+      break;
 
-        if(true == chargeRateSet) 
+    case DIVERT_STEP_READ_CURRENT:
+      ev_amps = 0;
+      divert_send(F("$GG"), [](int ret)
+      {
+        if(RAPI_RESPONSE_OK == ret) {
+          int milliAmps = String(rapiSender.getToken(1)).toInt();
+          ev_amps = (double)milliAmps / 1000.0;
+          DBUGVAR(ev_amps);
+        }
+        divert_next(DIVERT_STEP_CALCULATE);
+      });
+      break;
+
+    case DIVERT_STEP_CALCULATE:
+      divert_next(divert_update_rate());
+      break;
+
+    case DIVERT_STEP_SET_RATE:
+      // Try and set current with new API with volatile flag (don't save the current rate to EEPROM)
+      divert_send(String(F("$SC ")) + String(charge_rate) + String(F(" V")), [](int ret) {
+        divert_set_rate_complete(ret, DIVERT_STEP_SET_RATE_LEGACY);
+      });
+      break;
+
+    case DIVERT_STEP_SET_RATE_LEGACY:
+      // Fallback to old API
+      divert_send(String(F("$SC ")) + String(charge_rate), [](int ret) {
+        divert_set_rate_complete(ret, divert_after_rate());
+      });
+      break;
+
+    case DIVERT_STEP_CHECK_TIMER:
+      DBUGLN(F("Wake up EVSE"));
+      // Check if the timer is enabled, we need to do a bit of hackery if it is
+      divert_send(F("$GD"), [](int ret)
+      {
+        if(RAPI_RESPONSE_OK == ret &&
+           rapiSender.getTokenCnt() >= 5 &&
+           (0 != String(rapiSender.getToken(1)).toInt() ||
+            0 != String(rapiSender.getToken(2)).toInt() ||
+            0 != String(rapiSender.getToken(3)).toInt() ||
+            0 != String(rapiSender.getToken(4)).toInt()))
         {
-          DBUGF("Charge rate set to %d", charge_rate);
-          pilot = charge_rate;
+          // Timer is enabled so we need to emulate a button press to work around
+          // an issue with $FE not working
+          divert_next(DIVERT_STEP_PRESS_BUTTON);
+        } else {
+          divert_next(DIVERT_STEP_START);
         }
-      }
+      });
+      break;
 
-      // If charge rate > min current and EVSE is sleeping then start charging
-      if (state == OPENEVSE_STATE_SLEEPING)
+    case DIVERT_STEP_PRESS_BUTTON:
+      divert_send(F("$F1"), [](int ret)
       {
-        DBUGLN(F("Wake up EVSE"));
-        bool chargeStarted = false;
-
-        // Check if the timer is enabled, we need to do a bit of hackery if it is
-        if(0 == rapiSender.sendCmdSync("$GD"))
-        {
-          if(rapiSender.getTokenCnt() >= 5 &&
-             (0 != String(rapiSender.getToken(1)).toInt() ||
-              0 != String(rapiSender.getToken(2)).toInt() ||
-              0 != String(rapiSender.getToken(3)).toInt() ||
-              0 != String(rapiSender.getToken(4)).toInt()))
-          {
-            // Timer is enabled so we need to emulate a button press to work around
-            // an issue with $FE not working
-            if(false == chargeStarted && 0 == rapiSender.sendCmdSync(F("$F1"))) {
-              DBUGLN(F("Starting charge with button press"));
-              chargeStarted = true;
-            }
-          }
+        if(RAPI_RESPONSE_OK == ret) {
+          DBUGLN(F("Starting charge with button press"));
+          divert_charge_started();
+          divert_next(DIVERT_STEP_DONE);
+        } else {
+          divert_next(DIVERT_STEP_START);
         }
+      });
+      break;
 
-        if(false == chargeStarted && 0 == rapiSender.sendCmdSync(F("$FE"))) {
+    case DIVERT_STEP_START:
+      divert_send(F("$FE"), [](int ret)
+      {
+        if(RAPI_RESPONSE_OK == ret) {
           DBUGLN(F("Starting charge"));
-          chargeStarted = true;
+          divert_charge_started();
         }
+        divert_next(DIVERT_STEP_DONE);
+      });
+      break;
 
-        if(chargeStarted)
-        {
-          min_charge_end = divertmode_get_time() + divert_min_charge_time;
-          event["divert_active"] = divert_active = true;
-        }
-      }
-    }
-    else
-    {
-      if(OPENEVSE_STATE_SLEEPING != state)
+    case DIVERT_STEP_STOP:
+      divert_send(F("$FS"), [](int ret)
       {
-        if(divert_active && divertmode_get_time() >= min_charge_end) 
-        {
-          if(0 == rapiSender.sendCmdSync(F("$FS"))) 
-          {
-            DBUGLN(F("Charge Stopped"));
-            event["divert_active"] = divert_active = false;
-
-            if(0 == rapiSender.sendCmdSync(String(F("$SC ")) + String(max_charge_current))) {
-              DBUGF("Restore max I: %d", max_charge_current);
-            }
-          }
+        if(RAPI_RESPONSE_OK == ret) {
+          DBUGLN(F("Charge Stopped"));
+          divert_active = false;
+          active_changed = true;
+          divert_next(DIVERT_STEP_RESTORE);
+        } else {
+          divert_next(DIVERT_STEP_DONE);
         }
-      }
-    }
+      });
+      break;
 
-    event["charge_rate"] = charge_rate;
-    event["voltage"] = voltage;
-    event["available_current"] = available_current;
-    event["smoothed_available_current"] = smoothed_available_current;
-  } // end ecomode
-
-  event_send(event);
+    case DIVERT_STEP_RESTORE:
+      divert_send(String(F("$SC ")) + String(max_charge_current), [](int ret)
+      {
+        if(RAPI_RESPONSE_OK == ret) {
+          DBUGF("Restore max I: %d", max_charge_current);
+        }
+        divert_next(DIVERT_STEP_DONE);
+      });
+      break;
+
+    case DIVERT_STEP_DONE:
+      divert_send_event();
+      lastUpdate = millis();
+      divert_next(DIVERT_STEP_IDLE);
+      break;
+  }
 
-  lastUpdate = millis();
+  Profile_End(divert_current_loop, 5);
+} //end divert_current_loop
 
-  Profile_End(divert_update_state, 5);
+// A new solar / grid_ie sample has arrived, the charge rate is updated from
+// divert_current_loop(). Samples that arrive while an update is in progress
+// are merged, only the latest value is used.
+void divert_update_state()
+{
+  sample_pending = true;
 } //end divert_update_state
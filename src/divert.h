@@ -21,10 +21,11 @@ extern bool divert_active;
 // Change mode
 void divertmode_update(byte divertmode);
 
-// Set charge rate depending on charge mode and solarPV output
+// Signal a new solar PV / grid_ie sample, the charge rate is updated
+// depending on charge mode from divert_current_loop()
 void divert_update_state();
 
-//
+// Run the divert state machine, must be called in the main loop
 void divert_current_loop();
 
 #endif // _EMONESP_DIVERT_H
@@ -0,0 +1,77 @@
+// Solar PV power diversion
+// Charge rate calculation for Eco mode
+
+#include <math.h>
+
+#include "divert_calc.h"
+
+void divert_calculate(const DivertCalcInput &in, DivertCalcState &state, DivertCalcResult &result)
+{
+  result.set_rate = false;
+  result.start = false;
+  result.stop = false;
+
+  // Calculate current
+  if (DIVERT_FEED_GRID_IE == in.feed)
+  {
+    // if grid feed is available and exporting increment the charge rate,
+    // if importing drop the charge rate.
+    // grid_ie is negative when exporting
+    // If grid feeds is available and exporting (negative)
+    double Igrid_ie = (double)in.grid_ie / in.voltage;
+
+    // Subtract the current charge the EV is using from the Grid IE
+    Igrid_ie -= in.ev_amps;
+
+    if (Igrid_ie < 0)
+    {
+      // If excess power
+      double reserve = GRID_IE_RESERVE_POWER / in.voltage;
+      state.available_current = (-Igrid_ie - reserve);
+    }
+    else
+    {
+      // no excess, so use the min charge
+      state.available_current = 0;
+    }
+  }
+  else if (DIVERT_FEED_SOLAR == in.feed)
+  {
+    // if grid feed is not available: charge rate = solar generation
+    state.available_current = (double)in.solar / in.voltage;
+  }
+
+  if(state.available_current < 0) {
+    state.available_current = 0;
+  }
+
+  double scale = state.available_current > state.smoothed_available_current ?
+    in.attack_smoothing_factor :
+    in.decay_smoothing_factor;
+  state.smoothed_available_current = (state.available_current * scale) + (state.smoothed_available_current * (1 - scale));
+
+  result.charge_rate = (int)floor(state.available_current);
+
+  if(!in.sleeping && result.charge_rate < in.min_charge_current) {
+    // If we are not sleeping, make sure we are the minimum current
+    result.charge_rate = in.min_charge_current;
+  }
+
+  if(state.smoothed_available_current >= in.min_charge_current)
+  {
+    // Cap the charge rate at the configured maximum
+    if(result.charge_rate > in.max_charge_current) {
+      result.charge_rate = in.max_charge_current;
+    }
+
+    // Change the charge rate is needed
+    result.set_rate = in.current_charge_rate != result.charge_rate;
+
+    // If charge rate > min current and EVSE is sleeping then start charging
+    result.start = in.sleeping;
+  }
+  else if(!in.sleeping && in.divert_active && in.min_charge_time_elapsed)
+  {
+    result.stop = true;
+  }
+}
@@ -0,0 +1,54 @@
+// Solar PV power diversion
+// Charge rate calculation for Eco mode
+//
+// Kept free of any Arduino/ESP8266 dependencies so the control logic can
+// be built and exercised on a host machine.
+
+#ifndef _EMONESP_DIVERT_CALC_H
+#define _EMONESP_DIVERT_CALC_H
+
+#include <stdint.h>
+
+#define GRID_IE_RESERVE_POWER   100.0
+
+#define DIVERT_FEED_NONE        0
+#define DIVERT_FEED_SOLAR       1
+#define DIVERT_FEED_GRID_IE     2
+
+// Inputs for a single update
+struct DivertCalcInput
+{
+  uint8_t feed;                   // DIVERT_FEED_*
+  int solar;                      // W
+  int grid_ie;                    // W, negative when exporting
+  double voltage;                 // V
+  double ev_amps;                 // Current being used by the EV, A
+  double attack_smoothing_factor;
+  double decay_smoothing_factor;
+  int min_charge_current;         // A
+  int max_charge_current;         // A
+  int current_charge_rate;        // Charge rate the EVSE is set to, A
+  bool sleeping;                  // EVSE is sleeping
+  bool divert_active;             // Charging was started by divert
+  bool min_charge_time_elapsed;
+};
+
+// State carried between updates
+struct DivertCalcState
+{
+  double available_current;
+  double smoothed_available_current;
+};
+
+// What needs to be done on the EVSE
+struct DivertCalcResult
+{
+  int charge_rate;
+  bool set_rate;                  // Send $SC charge_rate
+  bool start;                     // Wake the EVSE, $FE (or $F1 if the timer is set)
+  bool stop;                      // Put the EVSE to sleep, $FS and restore max current
+};
+
+void divert_calculate(const DivertCalcInput &in, DivertCalcState &state, DivertCalcResult &result);
+
+#endif // _EMONESP_DIVERT_CALC_H
@@ -26,6 +26,7 @@ static void emoncms_result(bool success, String message)
   StaticJsonDocument<128> event;
   
   emoncms_connected = success;
+  state_changed();
   event["emoncms_connected"] = (int)emoncms_connected;
   event["emoncms_message"] = message.substring(0, 64);
   event_send(event);
@@ -2,8 +2,17 @@
 #define __EVENT_H
 
 #include <Arduino.h>
+#include <ArduinoJson.h>
 
 void event_send(String event);
 void event_send(JsonDocument &event);
 
+// Generation count of the status and config values, incremented whenever
+// any of them change so clients can tell if their copy is up to date
+extern uint32_t state_generation;
+
+inline void state_changed() {
+  state_generation++;
+}
+
 #endif
@@ -17,14 +17,13 @@
 #include "event.h"
 #include "wifi.h"
 #include "openevse.h"
+#include "rapi_queue.h"
 
 #include "RapiSender.h"
 
 int espflash = 0;
 int espfree = 0;
 
-int rapi_command = 1;
-
 double amp = 0;                         // OpenEVSE Current Sensor
 double voltage = DEFAULT_VOLTAGE;     // Voltage from OpenEVSE or MQTT
 double temp1 = 0;                       // Sensor DS3232 Ambient
@@ -87,6 +86,8 @@ unsigned long comm_success = 0;
 
 void create_rapi_json(JsonDocument &doc)
 {
+  Profile_Stats_Start(create_rapi_json);
+
   doc["amp"] = amp * AMPS_SCALE_FACTOR;
   doc["voltage"] = voltage * VOLTS_SCALE_FACTOR;
   doc["pilot"] = pilot;
@@ -110,113 +111,337 @@ void create_rapi_json(JsonDocument &doc)
   doc["freeram"] = ESPAL.getFreeHeap();
   doc["divertmode"] = divertmode;
   doc["srssi"] = WiFi.RSSI();
+
+  Profile_Stats_End(create_rapi_json);
 }
 
 // -------------------------------------------------------------------
-// OpenEVSE Request
+// RAPI poll schedule
 //
-// Get RAPI Values
-// Runs from arduino main loop, runs a new command in the loop
-// on each call.  Used for values that change at runtime.
+// Each value read from the OpenEVSE has its own refresh period that
+// depends on what the EVSE is doing, eg. the charge current is polled
+// every second while charging but only occasionally when no car is
+// connected.
 // -------------------------------------------------------------------
 
-void
-update_rapi_values() {
-  Profile_Start(update_rapi_values);
+#define RAPI_POLL_CHARGING      0
+#define RAPI_POLL_CONNECTED     1
+#define RAPI_POLL_IDLE          2
+#define RAPI_POLL_CLASSES       3
+
+// How long to wait for a poll response before moving on, the RAPI queue
+// should always call us back, this is just a safety net
+#ifndef RAPI_POLL_TIMEOUT
+#define RAPI_POLL_TIMEOUT       (10 * 1000)
+#endif
 
-  switch(rapi_command)
+typedef struct RapiPoll_s RapiPoll;
+
+struct RapiPoll_s
+{
+  const char *name;
+  uint32_t period[RAPI_POLL_CLASSES];   // Charging, connected, idle (ms)
+  bool (*poll)(RapiPoll *entry, uint32_t id);
+  uint32_t lastRequest;
+  uint32_t lastUpdate;
+  bool requested;
+  bool updated;
+};
+
+static bool rapi_poll_state(RapiPoll *entry, uint32_t id);
+static bool rapi_poll_current(RapiPoll *entry, uint32_t id);
+static bool rapi_poll_temperature(RapiPoll *entry, uint32_t id);
+static bool rapi_poll_energy(RapiPoll *entry, uint32_t id);
+static bool rapi_poll_pilot(RapiPoll *entry, uint32_t id);
+static bool rapi_poll_faults(RapiPoll *entry, uint32_t id);
+
+static RapiPoll rapi_poll_table[] =
+{
+  //  name           charging  connected     idle
+  { "state",       {    2000,      2000,     5000 }, rapi_poll_state },
+  { "amp",         {    1000,      5000,    30000 }, rapi_poll_current },
+  { "temp",        {    5000,     30000,    60000 }, rapi_poll_temperature },
+  { "energy",      {    5000,     30000,    60000 }, rapi_poll_energy },
+  { "pilot",       {   10000,     10000,    30000 }, rapi_poll_pilot },
+  { "faults",      {   60000,     60000,   300000 }, rapi_poll_faults }
+};
+
+#define RAPI_POLL_COUNT (sizeof(rapi_poll_table) / sizeof(rapi_poll_table[0]))
+
+static bool rapi_poll_pending = false;
+static uint32_t rapi_poll_started = 0;
+
+// Incremented for each poll, so a response that arrives after its poll
+// timed out can be told apart from the response to the current poll
+static uint32_t rapi_poll_id = 0;
+
+static int rapi_poll_class()
+{
+  switch(state)
   {
-    case 1:
-      rapiSender.sendCmd("$GE", [](int ret)
-      {
-        if(RAPI_RESPONSE_OK == ret)
-        {
-          if(rapiSender.getTokenCnt() >= 3)
-          {
-            const char *val = rapiSender.getToken(1);
-            pilot = strtol(val, NULL, 10);
-          }
-        }
-      });
-      break;
-    case 2:
-      OpenEVSE.getStatus([](int ret, uint8_t evse_state, uint32_t session_time, uint8_t pilot_state, uint32_t vflags)
+    case OPENEVSE_STATE_CHARGING:
+      return RAPI_POLL_CHARGING;
+
+    case OPENEVSE_STATE_STARTING:
+    case OPENEVSE_STATE_NOT_CONNECTED:
+    case OPENEVSE_STATE_SLEEPING:
+    case OPENEVSE_STATE_DISABLED:
+      return RAPI_POLL_IDLE;
+
+    default:
+      // Car connected or one of the error states
+      return RAPI_POLL_CONNECTED;
+  }
+}
+
+// Check if a response is for a poll that has been given up on
+static bool rapi_poll_stale(uint32_t id)
+{
+  if(false == rapi_poll_pending || id != rapi_poll_id) {
+    DBUGF("Ignoring late RAPI poll response %u", id);
+    return true;
+  }
+  return false;
+}
+
+static void rapi_poll_complete(RapiPoll *entry, int ret)
+{
+  rapi_poll_pending = false;
+  if(RAPI_RESPONSE_OK == ret)
+  {
+    entry->lastUpdate = millis();
+    entry->updated = true;
+  }
+}
+
+// Update a value, bumping the state generation if it changed
+template <typename T, typename V>
+static void input_set(T &var, V value)
+{
+  T newValue = (T)value;
+  if(var != newValue) {
+    var = newValue;
+    state_changed();
+  }
+}
+
+static bool rapi_poll_state(RapiPoll *entry, uint32_t id)
+{
+  return rapi_queue_send("$GS", RAPI_PRIORITY_POLL, [entry, id](int ret)
+  {
+    if(rapi_poll_stale(id)) {
+      return;
+    }
+    if(RAPI_RESPONSE_OK == ret)
+    {
+      if(rapiSender.getTokenCnt() >= 3)
       {
-        if(RAPI_RESPONSE_OK == ret)
-        {
-          DBUGF("evse_state = %02x, session_time = %d, pilot_state = %02x, vflags = %08x", evse_state, session_time, pilot_state, vflags);
+        const char *val;
+        val = rapiSender.getToken(1);
+        input_set(state, strtol(val, NULL, 16));
+        val = rapiSender.getToken(2);
+        input_set(elapsed, strtol(val, NULL, 10));
+        DBUGF("evse_state = %02x, session_time = %d", state, elapsed);
+      }
+    }
+    rapi_poll_complete(entry, ret);
+  });
+}
 
-          state = evse_state;
-          elapsed = session_time;
-        }
-      });
-      break;
-    case 3:
-      OpenEVSE.getChargeCurrentAndVoltage([](int ret, double a, double volts)
+static bool rapi_poll_current(RapiPoll *entry, uint32_t id)
+{
+  return rapi_queue_send("$GG", RAPI_PRIORITY_POLL, [entry, id](int ret)
+  {
+    if(rapi_poll_stale(id)) {
+      return;
+    }
+    if(RAPI_RESPONSE_OK == ret)
+    {
+      if(rapiSender.getTokenCnt() >= 3)
       {
-        if(RAPI_RESPONSE_OK == ret)
-        {
-          amp = a;
-          if(volts >= 0) {
-            voltage = volts;
-          }
+        const char *val;
+        val = rapiSender.getToken(1);
+        input_set(amp, (double)strtol(val, NULL, 10) / 1000.0);
+        val = rapiSender.getToken(2);
+        long millivolts = strtol(val, NULL, 10);
+        if(millivolts >= 0) {
+          input_set(voltage, (double)millivolts / 1000.0);
         }
-      });
-      break;
-    case 4:
-      OpenEVSE.getTemperature([](int ret, double t1, bool t1_valid, double t2, bool t2_valid, double t3, bool t3_valid)
+      }
+    }
+    rapi_poll_complete(entry, ret);
+  });
+}
+
+// Temperatures are reported in tenths of a degree, this value means the
+// sensor is not fitted
+#define RAPI_TEMP_NOT_INSTALLED   -2560
+
+static bool rapi_poll_temperature(RapiPoll *entry, uint32_t id)
+{
+  return rapi_queue_send("$GP", RAPI_PRIORITY_POLL, [entry, id](int ret)
+  {
+    if(rapi_poll_stale(id)) {
+      return;
+    }
+    if(RAPI_RESPONSE_OK == ret)
+    {
+      if(rapiSender.getTokenCnt() >= 4)
       {
-        if(RAPI_RESPONSE_OK == ret)
-        {
-          temp1 = t1;
-          temp1_valid = t1_valid;
-          temp2 = t2;
-          temp2_valid = t2_valid;
-          temp3 = t3;
-          temp3_valid = t3_valid;
-        }
-      });
-      break;
-    case 5:
-      rapiSender.sendCmd("$GU", [](int ret)
+        long t1 = strtol(rapiSender.getToken(1), NULL, 10);
+        long t2 = strtol(rapiSender.getToken(2), NULL, 10);
+        long t3 = strtol(rapiSender.getToken(3), NULL, 10);
+        input_set(temp1, (double)t1 / 10.0);
+        input_set(temp1_valid, RAPI_TEMP_NOT_INSTALLED != t1);
+        input_set(temp2, (double)t2 / 10.0);
+        input_set(temp2_valid, RAPI_TEMP_NOT_INSTALLED != t2);
+        input_set(temp3, (double)t3 / 10.0);
+        input_set(temp3_valid, RAPI_TEMP_NOT_INSTALLED != t3);
+      }
+    }
+    rapi_poll_complete(entry, ret);
+  });
+}
+
+static bool rapi_poll_energy(RapiPoll *entry, uint32_t id)
+{
+  return rapi_queue_send("$GU", RAPI_PRIORITY_POLL, [entry, id](int ret)
+  {
+    if(rapi_poll_stale(id)) {
+      return;
+    }
+    if(RAPI_RESPONSE_OK == ret)
+    {
+      if(rapiSender.getTokenCnt() >= 3)
       {
-        if(RAPI_RESPONSE_OK == ret)
-        {
-          if(rapiSender.getTokenCnt() >= 3)
-          {
-            const char *val;
-            val = rapiSender.getToken(1);
-            wattsec = strtol(val, NULL, 10);
-            val = rapiSender.getToken(2);
-            watthour_total = strtol(val, NULL, 10);
-          }
-        }
-      });
-      break;
-    case 6:
-      rapiSender.sendCmd("$GF", [](int ret)
+        const char *val;
+        val = rapiSender.getToken(1);
+        input_set(wattsec, strtol(val, NULL, 10));
+        val = rapiSender.getToken(2);
+        input_set(watthour_total, strtol(val, NULL, 10));
+      }
+    }
+    rapi_poll_complete(entry, ret);
+  });
+}
+
+static bool rapi_poll_pilot(RapiPoll *entry, uint32_t id)
+{
+  return rapi_queue_send("$GE", RAPI_PRIORITY_POLL, [entry, id](int ret)
+  {
+    if(rapi_poll_stale(id)) {
+      return;
+    }
+    if(RAPI_RESPONSE_OK == ret)
+    {
+      if(rapiSender.getTokenCnt() >= 3)
       {
-        if(RAPI_RESPONSE_OK == ret) {
-          if(rapiSender.getTokenCnt() >= 4)
-          {
-            const char *val;
-            val = rapiSender.getToken(1);
-            gfci_count = strtol(val, NULL, 16);
-            val = rapiSender.getToken(2);
-            nognd_count = strtol(val, NULL, 16);
-            val = rapiSender.getToken(3);
-            stuck_count = strtol(val, NULL, 16);
-          }
-        }
-      });
-      rapi_command = 0;         //Last RAPI command
+        const char *val = rapiSender.getToken(1);
+        input_set(pilot, strtol(val, NULL, 10));
+      }
+    }
+    rapi_poll_complete(entry, ret);
+  });
+}
+
+static bool rapi_poll_faults(RapiPoll *entry, uint32_t id)
+{
+  return rapi_queue_send("$GF", RAPI_PRIORITY_POLL, [entry, id](int ret)
+  {
+    if(rapi_poll_stale(id)) {
+      return;
+    }
+    if(RAPI_RESPONSE_OK == ret) {
+      if(rapiSender.getTokenCnt() >= 4)
+      {
+        const char *val;
+        val = rapiSender.getToken(1);
+        input_set(gfci_count, strtol(val, NULL, 16));
+        val = rapiSender.getToken(2);
+        input_set(nognd_count, strtol(val, NULL, 16));
+        val = rapiSender.getToken(3);
+        input_set(stuck_count, strtol(val, NULL, 16));
+      }
+    }
+    rapi_poll_complete(entry, ret);
+  });
+}
+
+// -------------------------------------------------------------------
+// OpenEVSE Request
+//
+// Get RAPI Values
+// Runs from arduino main loop, sends the most overdue poll from the
+// schedule above, only one poll is outstanding at a time.
+// -------------------------------------------------------------------
+
+void
+update_rapi_values() {
+  Profile_Start(update_rapi_values);
+
+  uint32_t now = millis();
+
+  if(rapi_poll_pending)
+  {
+    if(now - rapi_poll_started < RAPI_POLL_TIMEOUT) {
+      return;
+    }
+    DBUGLN("RAPI poll timed out");
+    rapi_poll_pending = false;
+  }
+
+  int pollClass = rapi_poll_class();
+
+  RapiPoll *next = NULL;
+  uint32_t nextOverdue = 0;
+  for(size_t i = 0; i < RAPI_POLL_COUNT; i++)
+  {
+    RapiPoll *entry = &rapi_poll_table[i];
+    uint32_t since = now - entry->lastRequest;
+    uint32_t period = entry->period[pollClass];
+    if(false == entry->requested) {
+      next = entry;
       break;
+    }
+    if(since >= period && (NULL == next || since - period > nextOverdue)) {
+      next = entry;
+      nextOverdue = since - period;
+    }
+  }
+
+  if(next)
+  {
+    rapi_poll_pending = true;
+    rapi_poll_started = now;
+    rapi_poll_id++;
+    next->lastRequest = now;
+    next->requested = true;
+    if(false == next->poll(next, rapi_poll_id)) {
+      rapi_poll_pending = false;
+    }
   }
-  rapi_command++;
 
   Profile_End(update_rapi_values, 5);
 }
 
+void create_rapi_poll_json(JsonObject data)
+{
+  int pollClass = rapi_poll_class();
+  uint32_t now = millis();
+
+  for(size_t i = 0; i < RAPI_POLL_COUNT; i++)
+  {
+    RapiPoll *entry = &rapi_poll_table[i];
+    JsonObject item = data.createNestedObject(entry->name);
+    item["period"] = entry->period[pollClass];
+    if(entry->updated) {
+      item["age"] = now - entry->lastUpdate;
+    } else {
+      item["age"] = -1;
+    }
+  }
+}
+
 void
 handleRapiRead()
 {
@@ -227,6 +452,7 @@ handleRapiRead()
     {
       firmware = returned_firmware;
       protocol = returned_protocol;
+      state_changed();
     }
   });
 
@@ -239,7 +465,7 @@ handleRapiRead()
     }
   });
 
-  rapiSender.sendCmd("$GA", [](int ret)
+  rapi_queue_send("$GA", RAPI_PRIORITY_POLL, [](int ret)
   {
     if(RAPI_RESPONSE_OK == ret)
     {
@@ -251,10 +477,11 @@ handleRapiRead()
         val = rapiSender.getToken(2);
         current_offset = strtol(val, NULL, 10);
       }
+      state_changed();
     }
   });
 
-  rapiSender.sendCmd("$GE", [](int ret)
+  rapi_queue_send("$GE", RAPI_PRIORITY_POLL, [](int ret)
   {
     if(RAPI_RESPONSE_OK == ret)
     {
@@ -277,6 +504,7 @@ handleRapiRead()
       rgb_lcd = bitRead(flags, 8);
       gfci_test = bitRead(flags, 9);
       temp_ck = bitRead(flags, 10);
+      state_changed();
     }
   });
 
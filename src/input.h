@@ -69,6 +69,13 @@ extern void handleRapiRead();
 extern void update_rapi_values();
 extern void create_rapi_json(JsonDocument &data);
 
+// Size of the document needed by create_rapi_json(), all the keys are
+// literals so only the members need space
+#define RAPI_JSON_SIZE JSON_OBJECT_SIZE(11)
+
+// Poll period and age of the last update (ms) for each RAPI value
+extern void create_rapi_poll_json(JsonObject data);
+
 extern void input_setup();
 
 #endif // _EMONESP_INPUT_H
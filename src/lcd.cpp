@@ -3,11 +3,10 @@
 #include "RapiSender.h"
 #include "openevse.h"
 #include "input.h"
+#include "rapi_queue.h"
 
 #define LCD_MAX_LEN 16
 
-extern RapiSender rapiSender;
-
 typedef struct Message_s Message;
 
 struct Message_s
@@ -54,7 +53,7 @@ void lcd_display(Message *msg, int x, int y, int time, uint32_t flags)
 
   if(flags & LCD_DISPLAY_NOW) {
     lcd_loop();
-    rapiSender.flush();
+    rapi_queue_flush();
   }
 }
 
@@ -100,7 +99,7 @@ void lcd_loop()
 
       // If the LCD has not been claimed, claim in
       if(false == lcdClaimed) {
-        rapiSender.sendCmd(F("$F0 0"));
+        rapi_queue_send(F("$F0 0"), RAPI_PRIORITY_LCD);
         lcdClaimed = true;
       }
 
@@ -111,7 +110,7 @@ void lcd_loop()
       cmd += msg->y;
       cmd += " ";
       cmd += msg->msg;
-      rapiSender.sendCmd(cmd);
+      rapi_queue_send(cmd, RAPI_PRIORITY_LCD);
 
       if(msg->clear)
       {
@@ -124,7 +123,7 @@ void lcd_loop()
           cmd += " ";
           cmd += msg->y;
           cmd += "       "; // 7 spaces 1 separator and 6 to display
-          rapiSender.sendCmd(cmd);
+          rapi_queue_send(cmd, RAPI_PRIORITY_LCD);
         }
       }
 
@@ -136,7 +135,7 @@ void lcd_loop()
     else if (lcdClaimed)
     {
       // No messages to display release the LCD.
-      rapiSender.sendCmd(F("$F0 1"));
+      rapi_queue_send(F("$F0 1"), RAPI_PRIORITY_LCD);
       lcdClaimed = false;
     } else {
       break;
@@ -4,6 +4,8 @@
 #include "divert.h"
 #include "input.h"
 #include "espal.h"
+#include "rapi_queue.h"
+#include "event.h"
 
 #include "openevse.h"
 
@@ -16,6 +18,7 @@ PubSubClient mqttclient(espClient);   // Create client for MQTT
 
 static long nextMqttReconnectAttempt = 0;
 static unsigned long mqttRestartTime = 0;
+static bool mqttWasConnected = false;
 
 int clientTimeout = 0;
 int i = 0;
@@ -24,6 +27,37 @@ int i = 0;
 #define MQTT_CONNECT_TIMEOUT (5 * 1000)
 #endif // !MQTT_CONNECT_TIMEOUT
 
+// Longest topic that can be published, including the base topic
+#ifndef MQTT_TOPIC_MAX
+#define MQTT_TOPIC_MAX 128
+#endif // !MQTT_TOPIC_MAX
+
+// Topics are built here, the base topic and '/' are written once when
+// connecting so only the sub topic needs to be added for each publish
+static char mqttTopic[MQTT_TOPIC_MAX];
+static size_t mqttTopicPrefixLen = 0;
+
+static void mqtt_topic_prefix()
+{
+  mqttTopicPrefixLen = snprintf(mqttTopic, sizeof(mqttTopic), "%s/", mqtt_topic.c_str());
+  if(mqttTopicPrefixLen >= sizeof(mqttTopic)) {
+    DBUGF("MQTT base topic too long");
+    mqttTopicPrefixLen = 0;
+  }
+}
+
+// Returns <base-topic>/<name> or NULL if it does not fit, the result is
+// only valid until the next call
+static const char *mqtt_sub_topic(const char *name)
+{
+  size_t len = strlen(name);
+  if(0 == mqttTopicPrefixLen || mqttTopicPrefixLen + len >= sizeof(mqttTopic)) {
+    return NULL;
+  }
+  memcpy(mqttTopic + mqttTopicPrefixLen, name, len + 1);
+  return mqttTopic;
+}
+
 // -------------------------------------------------------------------
 // MQTT msg Received callback function:
 // Function to be called when msg is received on MQTT subscribed topic
@@ -47,11 +81,13 @@ void mqttmsg_callback(char *topic, byte * payload, unsigned int length) {
   // If MQTT message is solar PV
   if (topic_string == mqtt_solar){
     solar = payload_str.toInt();
+    state_changed();
     DBUGF("solar:%dW", solar);
     divert_update_state();
   }
   else if (topic_string == mqtt_grid_ie){
     grid_ie = payload_str.toInt();
+    state_changed();
     DBUGF("grid:%dW", grid_ie);
     divert_update_state();
   }
@@ -63,7 +99,9 @@ void mqttmsg_callback(char *topic, byte * payload, unsigned int length) {
     });
   }
   // If MQTT message to set divert mode is received
-  else if (topic_string == mqtt_topic + "/divertmode/set"){
+  else if (mqttTopicPrefixLen > 0 &&
+           0 == strncmp(topic, mqttTopic, mqttTopicPrefixLen) &&
+           0 == strcmp(topic + mqttTopicPrefixLen, "divertmode/set")){
     byte newdivert = payload_str.toInt();
     if ((newdivert==1) || (newdivert==2)){
       divertmode_update(newdivert);
@@ -89,14 +127,15 @@ void mqttmsg_callback(char *topic, byte * payload, unsigned int length) {
         }
       }
 
-      rapiSender.sendCmd(cmd, [](int ret)
+      rapi_queue_send(cmd, RAPI_PRIORITY_USER, [](int ret)
       {
         if (RAPI_RESPONSE_OK == ret || RAPI_RESPONSE_NK == ret)
         {
           String rapiString = rapiSender.getResponse();
-          String mqtt_data = rapiString;
-          String mqtt_sub_topic = mqtt_topic + "/rapi/out";
-          mqttclient.publish(mqtt_sub_topic.c_str(), mqtt_data.c_str());
+          const char *topic = mqtt_sub_topic("rapi/out");
+          if(topic) {
+            mqttclient.publish(topic, rapiString.c_str());
+          }
         }
       });
     }
@@ -108,6 +147,7 @@ void mqttmsg_callback(char *topic, byte * payload, unsigned int length) {
 // -------------------------------------------------------------------
 boolean
 mqtt_connect() {
+  mqtt_topic_prefix();
   mqttclient.setServer(mqtt_server.c_str(), mqtt_port);
   mqttclient.setCallback(mqttmsg_callback); //function to be called when mqtt msg is received on subscribed topic
   DEBUG.print("MQTT Connecting to...");
@@ -116,9 +156,12 @@ mqtt_connect() {
   if (mqttclient.connect(strID.c_str(), mqtt_user.c_str(), mqtt_pass.c_str(),mqtt_topic.c_str(),1,0,(char*)"disconnected")) {  // Attempt to connect
     DEBUG.println("MQTT connected");
     mqttclient.publish(mqtt_topic.c_str(), "connected"); // Once connected, publish an announcement..
-    String mqtt_sub_topic = mqtt_topic + "/rapi/in/#";      // MQTT Topic to subscribe to receive RAPI commands via MQTT
+    // MQTT Topic to subscribe to receive RAPI commands via MQTT
     //e.g to set current to 13A: <base-topic>/rapi/in/$SC 13
-    mqttclient.subscribe(mqtt_sub_topic.c_str());
+    const char *topic = mqtt_sub_topic("rapi/in/#");
+    if(topic) {
+      mqttclient.subscribe(topic);
+    }
     // subscribe to solar PV / grid_ie MQTT feeds
     if(config_divert_enabled())
     {
@@ -133,8 +176,10 @@ mqtt_connect() {
       mqttclient.subscribe(mqtt_vrms.c_str());
     }
 
-    mqtt_sub_topic = mqtt_topic + "/divertmode/set";      // MQTT Topic to change divert mode
-    mqttclient.subscribe(mqtt_sub_topic.c_str());
+    topic = mqtt_sub_topic("divertmode/set");      // MQTT Topic to change divert mode
+    if(topic) {
+      mqttclient.subscribe(topic);
+    }
 
   } else {
     DEBUG.print("MQTT failed: ");
@@ -157,14 +202,28 @@ mqtt_publish(JsonDocument &data) {
     return;
   }
 
+  Profile_Stats_Start(mqtt_publish);
+
+  // Strings are sent as they are, anything else as its JSON text
+  char text[32];
+
   JsonObject root = data.as<JsonObject>();
   for (JsonPair kv : root) {
-    String topic = mqtt_topic + "/";
-    topic += kv.key().c_str();
-    String val = kv.value().as<String>();
-    mqttclient.publish(topic.c_str(), val.c_str());
+    const char *topic = mqtt_sub_topic(kv.key().c_str());
+    if(NULL == topic) {
+      DBUGF("MQTT topic too long: %s", kv.key().c_str());
+      continue;
+    }
+
+    const char *val = kv.value().as<const char *>();
+    if(NULL == val) {
+      serializeJson(kv.value(), text, sizeof(text));
+      val = text;
+    }
+    mqttclient.publish(topic, val);
   }
 
+  Profile_Stats_End(mqtt_publish);
   Profile_End(mqtt_publish, 5);
 }
 
@@ -177,6 +236,12 @@ void
 mqtt_loop() {
   Profile_Start(mqtt_loop);
 
+  // Let status clients know the connection state has changed
+  if(mqttclient.connected() != mqttWasConnected) {
+    mqttWasConnected = !mqttWasConnected;
+    state_changed();
+  }
+
   // Do we need to restart MQTT?
   if(mqttRestartTime > 0 && millis() > mqttRestartTime) 
   {
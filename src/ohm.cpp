@@ -2,7 +2,8 @@
 #include "input.h"
 #include "wifi.h"
 #include "app_config.h"
-#include "RapiSender.h"
+#include "rapi_queue.h"
+#include "event.h"
 
 #include <WiFiClientSecure.h>
 #include <ESP8266HTTPClient.h>
@@ -21,8 +22,6 @@ const char *ohm_fingerprint =
 String ohm_hour = "NotConnected";
 int evse_sleep = 0;
 
-extern RapiSender rapiSender;
-
 // -------------------------------------------------------------------
 // Ohm Connect "Ohm Hour"
 //
@@ -63,13 +62,14 @@ void ohm_loop()
         if(new_ohm_hour != ohm_hour)
         {
           ohm_hour = new_ohm_hour;
+          state_changed();
           if(ohm_hour == "True")
           {
             DBUGLN(F("Ohm Hour"));
             if (evse_sleep == 0)
             {
               evse_sleep = 1;
-              rapiSender.sendCmd(F("$FS"), [](int ret)
+              rapi_queue_send(F("$FS"), RAPI_PRIORITY_SAFETY, [](int ret)
               {
                 if(RAPI_RESPONSE_OK == ret) {
                   DBUGLN(F("Charge Stopped"));
@@ -83,7 +83,7 @@ void ohm_loop()
             if (evse_sleep == 1)
             {
               evse_sleep = 0;
-              rapiSender.sendCmd(F("$FE"), [](int ret)
+              rapi_queue_send(F("$FE"), RAPI_PRIORITY_CONTROL, [](int ret)
               {
                 if(RAPI_RESPONSE_OK == ret) {
                   DBUGLN(F("Charging enabled"));
@@ -17,6 +17,8 @@ void ota_setup()
   ArduinoOTA.begin();
 
   ArduinoOTA.onStart([]() {
+    // The device restarts once the update is done
+    config_flush();
     lcd_display(F("Updating WiFi"), 0, 0, 0, LCD_CLEAR_LINE);
     lcd_display(F(""), 0, 1, 10 * 1000, LCD_CLEAR_LINE);
     lcd_loop();
@@ -12,11 +12,62 @@
     DBUGF(">> Slow " #x " %lums", profile ## x ## Diff);\
   }
 
+// Number of calls between printing the stats
+#ifndef PROFILE_STATS_INTERVAL
+#define PROFILE_STATS_INTERVAL 100
+#endif
+
+struct ProfileStats
+{
+  uint32_t count;
+  uint32_t total_us;
+  uint32_t max_us;
+  int32_t total_heap;
+  int32_t max_heap;
+};
+
+inline void profile_stats_update(ProfileStats &stats, const char *name, uint32_t us, int32_t heap)
+{
+  stats.count++;
+  stats.total_us += us;
+  stats.total_heap += heap;
+  if(us > stats.max_us) {
+    stats.max_us = us;
+  }
+  if(heap > stats.max_heap) {
+    stats.max_heap = heap;
+  }
+
+  if(stats.count >= PROFILE_STATS_INTERVAL)
+  {
+    DBUGF(">> %s: %u calls, %uus/call (max %uus), heap %dB/call (max %dB)", name,
+      stats.count, stats.total_us / stats.count, stats.max_us,
+      stats.total_heap / (int32_t)stats.count, stats.max_heap);
+    stats = ProfileStats();
+  }
+}
+
+// Time and heap use of a code path averaged over a number of calls. The
+// heap figure is the memory still allocated at Profile_Stats_End(), so
+// place it before any large locals go out of scope to get the peak use.
+#define Profile_Stats_Start(x) \
+  static ProfileStats profile ## x ## Stats; \
+  unsigned long profile ## x ## Us = micros(); \
+  uint32_t profile ## x ## Heap = ESP.getFreeHeap()
+
+#define Profile_Stats_End(x) \
+  profile_stats_update(profile ## x ## Stats, #x, \
+    micros() - profile ## x ## Us, \
+    (int32_t)(profile ## x ## Heap - ESP.getFreeHeap()))
+
 #else // ENABLE_PROFILE
 
 #define Profile_Start(x)
 #define Profile_End(x, min)
 
+#define Profile_Stats_Start(x)
+#define Profile_Stats_End(x)
+
 #endif // ENABLE_PROFILE
 
 #endif
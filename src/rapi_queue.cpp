@@ -0,0 +1,281 @@
+#if defined(ENABLE_DEBUG) && !defined(ENABLE_DEBUG_RAPI)
+#undef ENABLE_DEBUG
+#endif
+
+#include <Arduino.h>
+
+#include "emonesp.h"
+#include "rapi_queue.h"
+
+extern RapiSender rapiSender;
+
+typedef struct RapiQueueEntry_s RapiQueueEntry;
+
+struct RapiQueueEntry_s
+{
+  char cmd[RAPI_QUEUE_CMD_LEN + 1];
+  RapiQueueCompleteHandler callback;
+  uint32_t seq;
+  uint32_t queued;
+  uint32_t deadline;
+  uint8_t priority;
+  bool used;
+};
+
+static RapiQueueEntry queue[RAPI_QUEUE_SIZE];
+static size_t queued_count = 0;
+static size_t in_flight = 0;
+static uint32_t next_seq = 0;
+
+uint32_t rapi_queue_dropped = 0;
+uint32_t rapi_queue_expired = 0;
+
+// Commands that stop or disable charging always go to the front
+static bool rapi_queue_is_safety(const char *cmd)
+{
+  return '$' == cmd[0] && 'F' == cmd[1] &&
+         ('S' == cmd[2] || 'D' == cmd[2] || 'R' == cmd[2]) &&
+         (' ' == cmd[3] || '^' == cmd[3] || '\0' == cmd[3]);
+}
+
+static void rapi_queue_complete(RapiQueueEntry *entry, int ret)
+{
+  RapiQueueCompleteHandler callback = entry->callback;
+  entry->callback = nullptr;
+  entry->used = false;
+  queued_count--;
+
+  if(callback) {
+    callback(ret);
+  }
+}
+
+// Number of slots available to a command of the given priority, including
+// those held by lower priority commands
+static size_t rapi_queue_available(uint8_t priority)
+{
+  size_t available = RAPI_QUEUE_SIZE - queued_count;
+  for(size_t i = 0; i < RAPI_QUEUE_SIZE; i++) {
+    if(queue[i].used && queue[i].priority > priority) {
+      available++;
+    }
+  }
+  return available;
+}
+
+// Find a slot for a command of the given priority, dropping a lower
+// priority command if the queue is full. The dropped command's callback is
+// returned rather than called as it may queue another command, so must
+// not be run until the slot has been filled.
+static RapiQueueEntry *rapi_queue_alloc(uint8_t priority, RapiQueueCompleteHandler &dropped)
+{
+  RapiQueueEntry *victim = NULL;
+  for(size_t i = 0; i < RAPI_QUEUE_SIZE; i++)
+  {
+    RapiQueueEntry *entry = &queue[i];
+    if(false == entry->used) {
+      return entry;
+    }
+
+    // Newest of the lowest priority commands
+    if(entry->priority > priority &&
+       (NULL == victim ||
+        entry->priority > victim->priority ||
+        (entry->priority == victim->priority && entry->seq > victim->seq)))
+    {
+      victim = entry;
+    }
+  }
+
+  if(victim)
+  {
+    DBUGF("RAPI queue full, dropping %s", victim->cmd);
+    rapi_queue_dropped++;
+    dropped = victim->callback;
+    victim->callback = nullptr;
+    victim->used = false;
+    queued_count--;
+    return victim;
+  }
+
+  return NULL;
+}
+
+static void rapi_queue_add(RapiQueueEntry *entry, const char *cmd, uint8_t priority, RapiQueueCompleteHandler callback, uint32_t deadline)
+{
+  strcpy(entry->cmd, cmd);
+  entry->callback = callback;
+  entry->priority = priority;
+  entry->seq = next_seq++;
+  entry->queued = millis();
+  entry->deadline = deadline;
+  entry->used = true;
+  queued_count++;
+}
+
+bool rapi_queue_send(const char *cmd, uint8_t priority, RapiQueueCompleteHandler callback, uint32_t deadline)
+{
+  if(rapi_queue_is_safety(cmd)) {
+    priority = RAPI_PRIORITY_SAFETY;
+  }
+
+  if(strlen(cmd) > RAPI_QUEUE_CMD_LEN) {
+    return false;
+  }
+
+  RapiQueueCompleteHandler dropped = nullptr;
+  RapiQueueEntry *entry = rapi_queue_alloc(priority, dropped);
+  if(NULL == entry) {
+    DBUGF("RAPI queue full, %s not sent", cmd);
+    rapi_queue_dropped++;
+    return false;
+  }
+
+  rapi_queue_add(entry, cmd, priority, callback, deadline);
+
+  if(dropped) {
+    dropped(RAPI_RESPONSE_QUEUE_FULL);
+  }
+
+  return true;
+}
+
+bool rapi_queue_send(const String &cmd, uint8_t priority, RapiQueueCompleteHandler callback, uint32_t deadline)
+{
+  return rapi_queue_send(cmd.c_str(), priority, callback, deadline);
+}
+
+bool rapi_queue_send(const __FlashStringHelper *cmd, uint8_t priority, RapiQueueCompleteHandler callback, uint32_t deadline)
+{
+  char buffer[RAPI_QUEUE_CMD_LEN + 1];
+  strncpy_P(buffer, reinterpret_cast<PGM_P>(cmd), RAPI_QUEUE_CMD_LEN);
+  buffer[RAPI_QUEUE_CMD_LEN] = '\0';
+  return rapi_queue_send(buffer, priority, callback, deadline);
+}
+
+bool rapi_queue_batch(const char * const *cmds, size_t count, uint8_t priority, RapiQueueBatchHandler callback, uint32_t deadline)
+{
+  // Safety commands are promoted as in rapi_queue_send(), so the batch
+  // only needs room at the lowest priority it uses
+  bool all_safety = true;
+  for(size_t i = 0; i < count; i++)
+  {
+    if('\0' == cmds[i][0] || strlen(cmds[i]) > RAPI_QUEUE_CMD_LEN) {
+      return false;
+    }
+    if(false == rapi_queue_is_safety(cmds[i])) {
+      all_safety = false;
+    }
+  }
+
+  if(rapi_queue_available(all_safety ? RAPI_PRIORITY_SAFETY : priority) < count) {
+    rapi_queue_dropped += count;
+    return false;
+  }
+
+  // Fill all the slots before any dropped callbacks are run, count is at
+  // most RAPI_QUEUE_SIZE as it fitted in the queue
+  RapiQueueCompleteHandler dropped[RAPI_QUEUE_SIZE];
+  for(size_t i = 0; i < count; i++)
+  {
+    uint8_t cmd_priority = rapi_queue_is_safety(cmds[i]) ? RAPI_PRIORITY_SAFETY : priority;
+    RapiQueueEntry *entry = rapi_queue_alloc(cmd_priority, dropped[i]);
+    rapi_queue_add(entry, cmds[i], cmd_priority, [callback, i](int ret) {
+      if(callback) {
+        callback(i, ret);
+      }
+    }, deadline);
+  }
+
+  for(size_t i = 0; i < count; i++)
+  {
+    if(dropped[i]) {
+      dropped[i](RAPI_RESPONSE_QUEUE_FULL);
+    }
+  }
+
+  return true;
+}
+
+static RapiQueueEntry *rapi_queue_next()
+{
+  RapiQueueEntry *next = NULL;
+  for(size_t i = 0; i < RAPI_QUEUE_SIZE; i++)
+  {
+    RapiQueueEntry *entry = &queue[i];
+    if(entry->used &&
+       (NULL == next ||
+        entry->priority < next->priority ||
+        (entry->priority == next->priority && entry->seq < next->seq)))
+    {
+      next = entry;
+    }
+  }
+  return next;
+}
+
+void rapi_queue_loop()
+{
+  Profile_Start(rapi_queue_loop);
+
+  // Drop anything that has been waiting too long
+  uint32_t now = millis();
+  for(size_t i = 0; i < RAPI_QUEUE_SIZE; i++)
+  {
+    RapiQueueEntry *entry = &queue[i];
+    if(entry->used && now - entry->queued > entry->deadline)
+    {
+      DBUGF("RAPI %s expired", entry->cmd);
+      rapi_queue_expired++;
+      rapi_queue_complete(entry, RAPI_RESPONSE_TIMEOUT);
+    }
+  }
+
+  // Keep RapiSender fed
+  while(in_flight < RAPI_QUEUE_IN_FLIGHT)
+  {
+    RapiQueueEntry *entry = rapi_queue_next();
+    if(NULL == entry) {
+      break;
+    }
+
+    DBUGF("RAPI send %s", entry->cmd);
+    RapiQueueCompleteHandler callback = entry->callback;
+    in_flight++;
+    int ret = rapiSender.sendCmd(entry->cmd, [callback](int ret)
+    {
+      in_flight--;
+      if(callback) {
+        callback(ret);
+      }
+    });
+
+    if(RAPI_RESPONSE_QUEUE_FULL == ret) {
+      // Leave it queued and try again next time around
+      in_flight--;
+      break;
+    }
+
+    entry->callback = nullptr;
+    entry->used = false;
+    queued_count--;
+  }
+
+  Profile_End(rapi_queue_loop, 5);
+}
+
+void rapi_queue_flush()
+{
+  uint32_t start = millis();
+  while(rapi_queue_length() > 0 && millis() - start < RAPI_QUEUE_DEFAULT_DEADLINE)
+  {
+    rapi_queue_loop();
+    rapiSender.loop();
+    yield();
+  }
+}
+
+size_t rapi_queue_length()
+{
+  return queued_count + in_flight;
+}
@@ -0,0 +1,95 @@
+#ifndef _EMONESP_RAPI_QUEUE_H
+#define _EMONESP_RAPI_QUEUE_H
+
+// -------------------------------------------------------------------
+// Prioritised RAPI command queue
+//
+// All RAPI traffic to the OpenEVSE should go through here rather than
+// directly to RapiSender. Commands are held in a bounded queue, sent in
+// priority order and completed via a callback so nothing needs to block
+// waiting for the serial line.
+// -------------------------------------------------------------------
+
+#include <Arduino.h>
+#include <functional>
+
+#include "RapiSender.h"
+
+// Priorities, lower numbers are sent first
+#define RAPI_PRIORITY_SAFETY      0   // Stopping/disabling the EVSE, $FS, $FD, ...
+#define RAPI_PRIORITY_CONTROL     1   // Charge control, $SC, $FE, ...
+#define RAPI_PRIORITY_USER        2   // Commands from HTTP/MQTT clients
+#define RAPI_PRIORITY_POLL        3   // Background status polling
+#define RAPI_PRIORITY_LCD         4   // LCD messages, $FP, ...
+#define RAPI_PRIORITY_COUNT       5
+
+// Max number of commands waiting to be sent
+#ifndef RAPI_QUEUE_SIZE
+#define RAPI_QUEUE_SIZE           12
+#endif
+
+// Max number of commands handed to RapiSender at once, allows the next
+// command to be written as soon as the previous response is received
+#ifndef RAPI_QUEUE_IN_FLIGHT
+#define RAPI_QUEUE_IN_FLIGHT      2
+#endif
+
+#ifndef RAPI_QUEUE_CMD_LEN
+#define RAPI_QUEUE_CMD_LEN        40
+#endif
+
+// Default time a command may wait in the queue before being dropped (ms)
+#ifndef RAPI_QUEUE_DEFAULT_DEADLINE
+#define RAPI_QUEUE_DEFAULT_DEADLINE (5 * 1000)
+#endif
+
+// Called when the command completes, ret is one of the RAPI_RESPONSE_*
+// values. The response can be read using rapiSender.getToken() etc, but
+// only from within the callback.
+typedef std::function<void(int ret)> RapiQueueCompleteHandler;
+
+// Called for each command in a batch, index is the position of the
+// command in the batch
+typedef std::function<void(size_t index, int ret)> RapiQueueBatchHandler;
+
+// -------------------------------------------------------------------
+// Queue a RAPI command
+//
+// Safety commands are always promoted to RAPI_PRIORITY_SAFETY. If the
+// queue is full a lower priority command is dropped to make room.
+//
+// Returns false if the command could not be queued, in which case the
+// callback is not called.
+// -------------------------------------------------------------------
+extern bool rapi_queue_send(const char *cmd, uint8_t priority, RapiQueueCompleteHandler callback = nullptr, uint32_t deadline = RAPI_QUEUE_DEFAULT_DEADLINE);
+extern bool rapi_queue_send(const String &cmd, uint8_t priority, RapiQueueCompleteHandler callback = nullptr, uint32_t deadline = RAPI_QUEUE_DEFAULT_DEADLINE);
+extern bool rapi_queue_send(const __FlashStringHelper *cmd, uint8_t priority, RapiQueueCompleteHandler callback = nullptr, uint32_t deadline = RAPI_QUEUE_DEFAULT_DEADLINE);
+
+// -------------------------------------------------------------------
+// Queue a batch of RAPI commands, either all are queued or none are
+//
+// Safety commands in the batch are promoted to RAPI_PRIORITY_SAFETY.
+// Returns false without queuing anything if a command is empty or too
+// long, or if there is no room for the whole batch.
+// -------------------------------------------------------------------
+extern bool rapi_queue_batch(const char * const *cmds, size_t count, uint8_t priority, RapiQueueBatchHandler callback, uint32_t deadline = RAPI_QUEUE_DEFAULT_DEADLINE);
+
+// -------------------------------------------------------------------
+// Dispatch queued commands, must be called in the main loop
+// -------------------------------------------------------------------
+extern void rapi_queue_loop();
+
+// -------------------------------------------------------------------
+// Block until all queued commands have been sent. Only for use when the
+// main loop is not running, eg. showing progress during an update
+// -------------------------------------------------------------------
+extern void rapi_queue_flush();
+
+// Number of commands waiting or in flight
+extern size_t rapi_queue_length();
+
+// Commands dropped because the queue was full or the deadline passed
+extern uint32_t rapi_queue_dropped;
+extern uint32_t rapi_queue_expired;
+
+#endif // _EMONESP_RAPI_QUEUE_H
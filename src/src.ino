@@ -41,6 +41,7 @@
 #include "lcd.h"
 #include "espal.h"
 #include "event.h"
+#include "rapi_queue.h"
 
 #include "RapiSender.h"
 
@@ -51,6 +52,8 @@ unsigned long Timer3; // Timer for events once every 2 seconds
 
 boolean rapi_read = 0; //flag to indicate first read of RAPI status
 
+uint32_t state_generation = 0;
+
 static uint32_t start_mem = 0;
 static uint32_t last_mem = 0;
 
@@ -64,6 +67,10 @@ void setup()
   hardware_setup();
   ESPAL.begin();
 
+  // Start each boot from a different generation so ETags cached by a
+  // client before a reboot do not match the new state
+  state_generation = RANDOM_REG32;
+
   DEBUG.println();
   DEBUG.printf("OpenEVSE WiFI %s\n", ESPAL.getShortId().c_str());
   DEBUG.printf("Firmware: %s\n", currentfirmware.c_str());
@@ -102,9 +109,11 @@ loop() {
   lcd_loop();
   web_server_loop();
   wifi_loop();
+  config_loop();
 #ifdef ENABLE_OTA
   ota_loop();
 #endif
+  rapi_queue_loop();
   rapiSender.loop();
   divert_current_loop();
 
@@ -135,9 +144,11 @@ loop() {
           DEBUG.printf("Free memory %u - diff %d %d\n", current, diff, start_mem - current);
           last_mem = current;
         }
-        update_rapi_values();
         Timer3 = millis();
       }
+
+      // Poll the OpenEVSE values that are due a refresh
+      update_rapi_values();
     }
   }
   else
@@ -209,6 +220,8 @@ void event_send(String &json)
 
 void event_send(JsonDocument &event)
 {
+  state_changed();
+
   #ifdef ENABLE_DEBUG
   serializeJson(event, DEBUG_PORT);
   DBUGLN("");
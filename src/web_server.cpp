@@ -9,7 +9,11 @@
 #include "emonesp.h"
 #include "web_server.h"
 #include "web_server_static.h"
+#include "web_server_ws.h"
+#include "web_server_events.h"
+#include "web_server_auth.h"
 #include "app_config.h"
+#include "app_config_parser.h"
 #include "wifi.h"
 #include "mqtt.h"
 #include "input.h"
@@ -17,13 +21,17 @@
 #include "divert.h"
 #include "lcd.h"
 #include "espal.h"
+#include "rapi_queue.h"
+#include "event.h"
 
 AsyncWebServer server(80);          // Create class for Web server
-AsyncWebSocket ws("/ws");
 StaticFileWebHandler staticFile;
 
 bool enableCors = true;
 
+// Number of HTTP connections, currently each one only carries one request
+uint32_t web_server_connections = 0;
+
 // Event timeouts
 unsigned long wifiRestartTime = 0;
 unsigned long mqttRestartTime = 0;
@@ -93,29 +101,168 @@ void dumpRequest(AsyncWebServerRequest *request) {
 #endif
 }
 
+// -------------------------------------------------------------------
+// Request admission
+//
+// Each request holds a response, and often a JSON document, until it is
+// sent. Requests are turned away with a 503 rather than being allowed to
+// run the heap out when too many are in flight or memory is short.
+// -------------------------------------------------------------------
+
+struct RequestCost
+{
+  const char *url;
+  uint16_t cost;        // Estimated peak heap use (bytes)
+};
+
+static const RequestCost requestCosts[] =
+{
+  { "/status", 1024 },
+  { "/config", 3072 },
+  { "/scan", 2048 },
+  { "/r", 1536 },
+  { "/rapi", 1536 }
+};
+
+static uint8_t requestsInFlight = 0;
+
+uint32_t web_server_rejected_busy = 0;
+uint32_t web_server_rejected_heap = 0;
+uint32_t web_server_rejected_block = 0;
+
+// Set the disconnect handler of an admitted request, the request is only
+// finished with once the client has gone
+static void requestOnDisconnect(AsyncWebServerRequest *request, std::function<void()> fn)
+{
+  request->onDisconnect([fn]() {
+    requestsInFlight--;
+    if(fn) {
+      fn();
+    }
+  });
+}
+
+bool web_server_has_heap(size_t cost)
+{
+  if(ESPAL.getFreeHeap() < WEB_SERVER_MIN_FREE_HEAP + cost) {
+    web_server_rejected_heap++;
+    return false;
+  }
+  if(ESP.getMaxFreeBlockSize() < WEB_SERVER_MIN_FREE_BLOCK + cost) {
+    web_server_rejected_block++;
+    return false;
+  }
+  return true;
+}
+
+void web_server_busy(AsyncWebServerRequest *request)
+{
+  DBUGF("Rejecting %s, %u in flight, %uB free", request->url().c_str(), requestsInFlight, ESPAL.getFreeHeap());
+  AsyncWebServerResponse *response = request->beginResponse(503, CONTENT_TYPE_JSON, F("{\"msg\":\"Busy\"}"));
+  response->addHeader(F("Retry-After"), F(ESCAPEQUOTE(WEB_SERVER_RETRY_AFTER)));
+  request->send(response);
+}
+
+bool web_server_admit(AsyncWebServerRequest *request, size_t cost)
+{
+  const char *url = request->url().c_str();
+  for(size_t i = 0; i < sizeof(requestCosts) / sizeof(requestCosts[0]); i++) {
+    if(0 == strcmp(url, requestCosts[i].url)) {
+      cost = requestCosts[i].cost;
+      break;
+    }
+  }
+
+  bool admit = false;
+  if(requestsInFlight >= WEB_SERVER_MAX_IN_FLIGHT) {
+    web_server_rejected_busy++;
+  } else {
+    admit = web_server_has_heap(cost);
+  }
+
+  if(false == admit) {
+    web_server_busy(request);
+    return false;
+  }
+
+  requestsInFlight++;
+  requestOnDisconnect(request, nullptr);
+  return true;
+}
+
+// Check the request's credentials, if any are needed
+static bool requestAuthenticated(AsyncWebServerRequest *request)
+{
+  return false == wifi_mode_is_sta() || www_username == "" ||
+         web_server_authenticate(request, www_username.c_str(), www_password.c_str());
+}
+
 // -------------------------------------------------------------------
 // Helper function to perform the standard operations on a request
 // -------------------------------------------------------------------
-bool requestPreProcess(AsyncWebServerRequest *request, AsyncResponseStream *&response, const __FlashStringHelper *contentType = CONTENT_TYPE_JSON)
+bool requestPreProcess(AsyncWebServerRequest *request, AsyncResponseStream *&response, const __FlashStringHelper *contentType = CONTENT_TYPE_JSON, bool revalidate = false)
 {
   dumpRequest(request);
 
-  if(wifi_mode_is_sta() && www_username!="" &&
-     false == request->authenticate(www_username.c_str(), www_password.c_str())) {
+  if(false == web_server_admit(request)) {
+    return false;
+  }
+
+  if(false == requestAuthenticated(request)) {
     request->requestAuthentication(esp_hostname.c_str());
     return false;
   }
 
+  web_server_connections++;
+
   response = request->beginResponseStream(String(contentType));
+
+  // The server closes the connection once the response is sent, say so up
+  // front so clients do not try to reuse it. ESPAsyncWebServer 1.2.3 has
+  // no keep-alive support, each request owns its connection.
+  response->addHeader(F("Connection"), F("close"));
+
   if(enableCors) {
     response->addHeader(F("Access-Control-Allow-Origin"), F("*"));
   }
 
-  response->addHeader(F("Cache-Control"), F("no-cache, private, no-store, must-revalidate, max-stale=0, post-check=0, pre-check=0"));
+  if(revalidate) {
+    // Allow the client to keep a copy but check with us before using it
+    response->addHeader(F("Cache-Control"), F("no-cache, private"));
+  } else {
+    response->addHeader(F("Cache-Control"), F("no-cache, private, no-store, must-revalidate, max-stale=0, post-check=0, pre-check=0"));
+  }
 
   return true;
 }
 
+// -------------------------------------------------------------------
+// Helper function to add an ETag for the current state and check it
+// against If-None-Match
+//
+// The tag is the state generation, so must only be used for responses
+// where every value bumps the generation when it changes.
+//
+// Returns true if the client's copy is current, in which case a 304 has
+// been sent and the caller should not send anything else.
+// -------------------------------------------------------------------
+bool requestNotModified(AsyncWebServerRequest *request, AsyncResponseStream *response, char type)
+{
+  char etag[32];
+  snprintf_P(etag, sizeof(etag), PSTR("W/\"%c%x\""), type, state_generation);
+  response->addHeader(F("ETag"), etag);
+
+  AsyncWebHeader *header = request->getHeader(F("If-None-Match"));
+  if(header && header->value() == etag)
+  {
+    response->setCode(304);
+    request->send(response);
+    return true;
+  }
+
+  return false;
+}
+
 // -------------------------------------------------------------------
 // Helper function to detect positive string
 // -------------------------------------------------------------------
@@ -315,9 +462,6 @@ handleSaveMqtt(AsyncWebServerRequest *request) {
   response->setCode(200);
   response->print(tmpStr);
   request->send(response);
-
-  // If connected disconnect MQTT to trigger re-connect with new details
-  mqtt_restart();
 }
 
 // -------------------------------------------------------------------
@@ -403,90 +547,222 @@ handleSaveOhmkey(AsyncWebServerRequest *request) {
 }
 
 // -------------------------------------------------------------------
-// Returns status json
-// url: /status
+// Status fields
+//
+// /status is streamed straight to the response from this table so no
+// JSON document needs to be allocated for each request.
+//
+// Live fields change without bumping the state generation (counters,
+// heap, RSSI, etc) so a response with any of them in can not be given an
+// ETag.
 // -------------------------------------------------------------------
-void
-handleStatus(AsyncWebServerRequest *request) {
-  AsyncResponseStream *response;
-  if(false == requestPreProcess(request, response)) {
-    return;
-  }
 
-  const size_t capacity = JSON_OBJECT_SIZE(40) + 1024;
-  DynamicJsonDocument doc(capacity);
+typedef void (*StatusFieldWriter)(Print &out);
 
-  String s = "{";
+struct StatusField
+{
+  const char *name;
+  StatusFieldWriter write;
+  bool live;
+};
+
+// Write a single JSON value, strings must be passed as const char * so
+// they are not copied
+template <typename T>
+static void json_write(Print &out, T value)
+{
+  StaticJsonDocument<16> doc;
+  doc.set(value);
+  serializeJson(doc, out);
+}
+
+static void status_write_temp(Print &out, bool valid, double temp)
+{
+  if(valid) {
+    json_write(out, temp * TEMP_SCALE_FACTOR);
+  } else {
+    json_write(out, false);
+  }
+}
+
+static void status_write_mode(Print &out)
+{
   if (wifi_mode_is_sta_only()) {
-    doc["mode"] = "STA";
+    json_write(out, "STA");
   } else if (wifi_mode_is_ap_only()) {
-    doc["mode"] = "AP";
+    json_write(out, "AP");
   } else if (wifi_mode_is_ap() && wifi_mode_is_sta()) {
-    doc["mode"] = "STA+AP";
+    json_write(out, "STA+AP");
+  } else {
+    out.print(F("null"));
   }
+}
 
-  doc["wifi_client_connected"] = (int)wifi_client_connected();
-  doc["net_connected"] = (int)wifi_client_connected();
-  doc["srssi"] = WiFi.RSSI();
-  doc["ipaddress"] = ipaddress;
+static void status_write_rapi_poll(Print &out)
+{
+  StaticJsonDocument<JSON_OBJECT_SIZE(6) + 6 * JSON_OBJECT_SIZE(2)> doc;
+  create_rapi_poll_json(doc.to<JsonObject>());
+  serializeJson(doc, out);
+}
 
-  doc["emoncms_connected"] = (int)emoncms_connected;
-  doc["packets_sent"] = packets_sent;
-  doc["packets_success"] = packets_success;
+#define STATUS_FIELD(name, value) \
+  { name, [](Print &out) { json_write(out, value); }, false }
 
-  doc["mqtt_connected"] = (int)mqtt_connected();
+#define STATUS_LIVE_FIELD(name, value) \
+  { name, [](Print &out) { json_write(out, value); }, true }
 
-  doc["ohm_hour"] = ohm_hour;
+static const StatusField status_fields[] =
+{
+  { "mode", status_write_mode, true },
+
+  STATUS_LIVE_FIELD("wifi_client_connected", (int)wifi_client_connected()),
+  STATUS_LIVE_FIELD("net_connected", (int)wifi_client_connected()),
+  STATUS_LIVE_FIELD("srssi", WiFi.RSSI()),
+  STATUS_FIELD("ipaddress", ipaddress.c_str()),
+
+  STATUS_FIELD("emoncms_connected", (int)emoncms_connected),
+  STATUS_FIELD("packets_sent", packets_sent),
+  STATUS_FIELD("packets_success", packets_success),
+
+  STATUS_FIELD("mqtt_connected", (int)mqtt_connected()),
+
+  STATUS_FIELD("ohm_hour", ohm_hour.c_str()),
+
+  STATUS_LIVE_FIELD("free_heap", ESPAL.getFreeHeap()),
+  STATUS_LIVE_FIELD("heap_frag", ESP.getHeapFragmentation()),
+
+  STATUS_LIVE_FIELD("comm_sent", rapiSender.getSent()),
+  STATUS_LIVE_FIELD("comm_success", rapiSender.getSuccess()),
+  STATUS_LIVE_FIELD("rapi_connected", (int)rapiSender.isConnected()),
+  STATUS_LIVE_FIELD("rapi_queue", rapi_queue_length()),
+  STATUS_LIVE_FIELD("rapi_dropped", rapi_queue_dropped + rapi_queue_expired),
+
+  STATUS_FIELD("amp", amp * AMPS_SCALE_FACTOR),
+  STATUS_FIELD("voltage", voltage * VOLTS_SCALE_FACTOR),
+  STATUS_FIELD("pilot", pilot),
+  { "temp1", [](Print &out) { status_write_temp(out, temp1_valid, temp1); }, false },
+  { "temp2", [](Print &out) { status_write_temp(out, temp2_valid, temp2); }, false },
+  { "temp3", [](Print &out) { status_write_temp(out, temp3_valid, temp3); }, false },
+  STATUS_FIELD("state", state),
+  STATUS_FIELD("elapsed", elapsed),
+  STATUS_FIELD("wattsec", wattsec),
+  STATUS_FIELD("watthour", watthour_total),
+
+  STATUS_FIELD("gfcicount", gfci_count),
+  STATUS_FIELD("nogndcount", nognd_count),
+  STATUS_FIELD("stuckcount", stuck_count),
+
+  STATUS_FIELD("divertmode", divertmode),
+  STATUS_FIELD("solar", solar),
+  STATUS_FIELD("grid_ie", grid_ie),
+  STATUS_FIELD("charge_rate", charge_rate),
+  STATUS_LIVE_FIELD("divert_update", (millis() - lastUpdate) / 1000),
+
+  STATUS_LIVE_FIELD("ota_update", (int)Update.isRunning()),
+  STATUS_LIVE_FIELD("config_commits", config_commits),
+  STATUS_LIVE_FIELD("config_commits_skipped", config_commits_skipped),
+  STATUS_LIVE_FIELD("config_load_time", config_load_time),
+
+  STATUS_LIVE_FIELD("http_connections", web_server_connections),
+  STATUS_LIVE_FIELD("http_rejected_busy", web_server_rejected_busy),
+  STATUS_LIVE_FIELD("http_rejected_heap", web_server_rejected_heap),
+  STATUS_LIVE_FIELD("http_rejected_block", web_server_rejected_block),
+  STATUS_LIVE_FIELD("ws_bytes", ws_bytes_sent),
+  STATUS_LIVE_FIELD("ws_closed", ws_clients_closed),
+  { "ws_clients", ws_write_status, true },
+  STATUS_LIVE_FIELD("sse_clients", events.count()),
+
+  { "rapi_poll", status_write_rapi_poll, true }
+};
+
+#define STATUS_FIELD_COUNT (sizeof(status_fields) / sizeof(status_fields[0]))
+
+// Check if a name is in a comma separated list, a NULL list has every
+// name in it
+static bool field_selected(const char *fields, const char *name)
+{
+  if(NULL == fields) {
+    return true;
+  }
 
-  doc["free_heap"] = ESPAL.getFreeHeap();
+  size_t len = strlen(name);
+  for(const char *ptr = fields; ptr; ptr = strchr(ptr, ','))
+  {
+    if(',' == *ptr) {
+      ptr++;
+    }
+    if(0 == strncmp(ptr, name, len) && (',' == ptr[len] || '\0' == ptr[len])) {
+      return true;
+    }
+  }
+  return false;
+}
 
-  doc["comm_sent"] = rapiSender.getSent();
-  doc["comm_success"] = rapiSender.getSuccess();
-  doc["rapi_connected"] = (int)rapiSender.isConnected();
+// The fields to return, from the fields query parameter, or NULL for all
+static const char *requestFields(AsyncWebServerRequest *request)
+{
+  return request->hasArg("fields") ? request->arg("fields").c_str() : NULL;
+}
 
-  doc["amp"] = amp * AMPS_SCALE_FACTOR;
-  doc["voltage"] = voltage * VOLTS_SCALE_FACTOR;
-  doc["pilot"] = pilot;
-  if(temp1_valid) {
-    doc["temp1"] = temp1 * TEMP_SCALE_FACTOR;
-  } else {
-    doc["temp1"] = false;
-  }
-  if(temp2_valid) {
-    doc["temp2"] = temp2 * TEMP_SCALE_FACTOR;
-  } else {
-    doc["temp2"] = false;
-  }
-  if(temp3_valid) {
-    doc["temp3"] = temp3 * TEMP_SCALE_FACTOR;
-  } else {
-    doc["temp3"] = false;
+// Check if none of the selected fields are live, so the response can be
+// tagged with the state generation
+static bool status_cacheable(const char *fields)
+{
+  for(size_t i = 0; i < STATUS_FIELD_COUNT; i++)
+  {
+    if(status_fields[i].live && field_selected(fields, status_fields[i].name)) {
+      return false;
+    }
   }
-  doc["state"] = state;
-  doc["elapsed"] = elapsed;
-  doc["wattsec"] = wattsec;
-  doc["watthour"] = watthour_total;
-
-  doc["gfcicount"] = gfci_count;
-  doc["nogndcount"] = nognd_count;
-  doc["stuckcount"] = stuck_count;
+  return true;
+}
 
-  doc["divertmode"] = divertmode;
-  doc["solar"] = solar;
-  doc["grid_ie"] = grid_ie;
-  doc["charge_rate"] = charge_rate;
-  doc["divert_update"] = (millis() - lastUpdate) / 1000;
+static void status_serialize(Print &out, const char *fields = NULL)
+{
+  bool first = true;
+  out.print('{');
+  for(size_t i = 0; i < STATUS_FIELD_COUNT; i++)
+  {
+    if(false == field_selected(fields, status_fields[i].name)) {
+      continue;
+    }
+    if(false == first) {
+      out.print(',');
+    }
+    first = false;
+    out.print('"');
+    out.print(status_fields[i].name);
+    out.print(F("\":"));
+    status_fields[i].write(out);
+  }
+  out.print('}');
+}
 
-  doc["ota_update"] = (int)Update.isRunning();
+// -------------------------------------------------------------------
+// Returns status json
+// url: /status
+// -------------------------------------------------------------------
+void
+handleStatus(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response;
+  if(false == requestPreProcess(request, response, CONTENT_TYPE_JSON, true)) {
+    return;
+  }
 
+  const char *fields = requestFields(request);
+  if(status_cacheable(fields) && requestNotModified(request, response, 's')) {
+    return;
+  }
 
+  Profile_Stats_Start(handleStatus);
 
   DBUGVAR(lastUpdate);
   DBUGVAR(millis());
   DBUGVAR((millis() - lastUpdate) / 1000);
 
   response->setCode(200);
-  serializeJson(doc, *response);
+  status_serialize(*response, fields);
+  Profile_Stats_End(handleStatus);
   request->send(response);
 }
 
@@ -497,32 +773,59 @@ handleStatus(AsyncWebServerRequest *request) {
 void
 handleConfigGet(AsyncWebServerRequest *request) {
   AsyncResponseStream *response;
-  if(false == requestPreProcess(request, response)) {
+  if(false == requestPreProcess(request, response, CONTENT_TYPE_JSON, true)) {
+    return;
+  }
+
+  if(requestNotModified(request, response, 'c')) {
     return;
   }
 
-  const size_t capacity = JSON_OBJECT_SIZE(40) + 1024;
+  Profile_Stats_Start(handleConfigGet);
+
+  const char *fields = requestFields(request);
+
+  // A few fields need much less than the whole config
+  size_t capacity = JSON_OBJECT_SIZE(40) + 1024;
+  if(fields)
+  {
+    size_t count = 1;
+    for(const char *ptr = fields; *ptr; ptr++) {
+      count += ',' == *ptr;
+    }
+    if(JSON_OBJECT_SIZE(count) + count * 32 < capacity) {
+      capacity = JSON_OBJECT_SIZE(count) + count * 32;
+    }
+  }
   DynamicJsonDocument doc(capacity);
 
+  #define CONFIG_FIELD(name, value) \
+    if(field_selected(fields, name)) { \
+      doc[name] = value; \
+    }
+
   // EVSE Config
-  doc["firmware"] = firmware;
-  doc["protocol"] = protocol;
-  doc["espflash"] = ESPAL.getFlashChipSize();
-  doc["version"] = currentfirmware;
-  doc["diodet"] = diode_ck;
-  doc["gfcit"] = gfci_test;
-  doc["groundt"] = ground_ck;
-  doc["relayt"] = stuck_relay;
-  doc["ventt"] = vent_ck;
-  doc["tempt"] = temp_ck;
-  doc["service"] = service;
-  doc["scale"] = current_scale;
-  doc["offset"] = current_offset;
-
-  config_serialize(doc, true, false, true);
+  CONFIG_FIELD("firmware", firmware);
+  CONFIG_FIELD("protocol", protocol);
+  CONFIG_FIELD("espflash", ESPAL.getFlashChipSize());
+  CONFIG_FIELD("version", currentfirmware);
+  CONFIG_FIELD("diodet", diode_ck);
+  CONFIG_FIELD("gfcit", gfci_test);
+  CONFIG_FIELD("groundt", ground_ck);
+  CONFIG_FIELD("relayt", stuck_relay);
+  CONFIG_FIELD("ventt", vent_ck);
+  CONFIG_FIELD("tempt", temp_ck);
+  CONFIG_FIELD("service", service);
+  CONFIG_FIELD("scale", current_scale);
+  CONFIG_FIELD("offset", current_offset);
+
+  #undef CONFIG_FIELD
+
+  config_serialize(doc, true, false, true, fields);
 
   response->setCode(200);
   serializeJson(doc, *response);
+  Profile_Stats_End(handleConfigGet);
   request->send(response);
 }
 
@@ -536,19 +839,29 @@ handleConfigPost(AsyncWebServerRequest *request)
 
   if(request->_tempObject)
   {
-    String *body = (String *)request->_tempObject;
+    ConfigParser *parser = (ConfigParser *)request->_tempObject;
+    request->_tempObject = NULL;
 
-    if(config_deserialize(*body)) {
+    // Nothing has been applied yet, the values are only given to the
+    // config once the whole body is known to be valid and the request has
+    // been admitted
+    ConfigParserResult result = parser->end();
+    if(CONFIG_PARSER_OK == result) {
+      parser->apply();
       config_commit();
       response->setCode(200);
-      response->print("{\"msg\":\"done\"}");
     } else {
-      response->setCode(400);
-      response->print("{\"msg\":\"Could not parse JSON\"}");
+      response->setCode(CONFIG_PARSER_TOO_LARGE == result ? 413 : 400);
     }
-
-    delete body;
-    request->_tempObject = NULL;
+    response->print("{\"msg\":\"");
+    response->print(ConfigParser::resultString(result));
+    response->print("\"}");
+
+    free(parser);
+  } else if(request->contentLength() > 0) {
+    // Could not allocate the parser
+    response->setCode(503);
+    response->print("{\"msg\":\"Busy\"}");
   } else {
     response->setCode(400);
     response->print("{\"msg\":\"No Body\"}");
@@ -752,43 +1065,139 @@ handleUpdateUpload(AsyncWebServerRequest *request, String filename, size_t index
 
 String delayTimer = "0 0 0 0";
 
-void
-handleRapi(AsyncWebServerRequest *request) {
-  bool json = isPositive(request, "json");
+// Max number of commands in a /r batch request
+#ifndef RAPI_WEB_BATCH_MAX
+#define RAPI_WEB_BATCH_MAX 8
+#endif
 
-  int code = 200;
+// Space for each command and its response in the batch results
+#define RAPI_WEB_BATCH_ENTRY_SIZE (JSON_OBJECT_SIZE(2) + 2 * 64)
 
+// -------------------------------------------------------------------
+// A /r request waiting for its RAPI commands to complete
+//
+// The client may go away before the commands complete, in which case
+// request is cleared and the response is thrown away.
+// -------------------------------------------------------------------
+struct RapiWebRequest
+{
+  AsyncWebServerRequest *request;
   AsyncResponseStream *response;
-  if(false == requestPreProcess(request, response, json ? CONTENT_TYPE_JSON : CONTENT_TYPE_HTML)) {
-    return;
-  }
+  bool json;
+  String rapi;
+  String body;                    // Response text for a single command
+  DynamicJsonDocument *results;   // Results of a batch
+  size_t pending;
+};
+
+static RapiWebRequest *rapi_web_request_create(AsyncWebServerRequest *request, AsyncResponseStream *response, bool json)
+{
+  RapiWebRequest *ctx = new RapiWebRequest();
+  ctx->request = request;
+  ctx->response = response;
+  ctx->json = json;
+  ctx->results = NULL;
+  ctx->pending = 0;
+
+  requestOnDisconnect(request, [ctx]() {
+    ctx->request = NULL;
+  });
+
+  return ctx;
+}
 
-  String s;
+static void rapi_web_request_send(RapiWebRequest *ctx, int code)
+{
+  AsyncWebServerRequest *request = ctx->request;
+  if(request)
+  {
+    requestOnDisconnect(request, nullptr);
+    ctx->response->setCode(code);
+    if(ctx->results) {
+      serializeJson(*ctx->results, *ctx->response);
+    } else {
+      ctx->response->print(ctx->body);
+    }
+    request->send(ctx->response);
+  } else {
+    DBUGF("RAPI %s client gone", ctx->rapi.c_str());
+    delete ctx->response;
+  }
 
-  if(false == json) {
-    s = F("<html><font size='20'><font color=006666>Open</font><b>EVSE</b></font><p>"
-          "<b>Open Source Hardware</b><p>RAPI Command Sent<p>Common Commands:<p>"
-          "Set Current - $SC XX<p>Set Service Level - $SL 1 - $SL 2 - $SL A<p>"
-          "Get Real-time Current - $GG<p>Get Temperatures - $GP<p>"
-          "<p>"
-          "<form method='get' action='r'><label><b><i>RAPI Command:</b></i></label>"
-          "<input id='rapi' name='rapi' length=32><p><input type='submit'></form>");
+  if(ctx->results) {
+    delete ctx->results;
   }
+  delete ctx;
+}
 
-  if (request->hasArg("rapi"))
+static const __FlashStringHelper *rapi_error_string(int ret)
+{
+  return
+    RAPI_RESPONSE_QUEUE_FULL == ret ? F("RAPI_RESPONSE_QUEUE_FULL") :
+    RAPI_RESPONSE_BUFFER_OVERFLOW == ret ? F("RAPI_RESPONSE_BUFFER_OVERFLOW") :
+    RAPI_RESPONSE_TIMEOUT == ret ? F("RAPI_RESPONSE_TIMEOUT") :
+    RAPI_RESPONSE_OK == ret ? F("RAPI_RESPONSE_OK") :
+    RAPI_RESPONSE_NK == ret ? F("RAPI_RESPONSE_NK") :
+    RAPI_RESPONSE_INVALID_RESPONSE == ret ? F("RAPI_RESPONSE_INVALID_RESPONSE") :
+    RAPI_RESPONSE_CMD_TOO_LONG == ret ? F("RAPI_RESPONSE_CMD_TOO_LONG") :
+    RAPI_RESPONSE_BAD_CHECKSUM == ret ? F("RAPI_RESPONSE_BAD_CHECKSUM") :
+    RAPI_RESPONSE_BAD_SEQUENCE_ID == ret ? F("RAPI_RESPONSE_BAD_SEQUENCE_ID") :
+    RAPI_RESPONSE_ASYNC_EVENT == ret ? F("RAPI_RESPONSE_ASYNC_EVENT") :
+    F("UNKNOWN");
+}
+
+static void rapi_web_complete(RapiWebRequest *ctx, int ret, const String &rapiString)
+{
+  int code = 200;
+  const String &rapi = ctx->rapi;
+  String &s = ctx->body;
+
+  if(RAPI_RESPONSE_OK == ret ||
+     RAPI_RESPONSE_NK == ret)
+  {
+    if (ctx->json) {
+      s = "{\"cmd\":\""+rapi+"\",\"ret\":\""+rapiString+"\"}";
+    } else {
+      s += rapi;
+      s += F("<p>&gt;");
+      s += rapiString;
+    }
+  }
+    else
   {
-    String rapi = request->arg("rapi");
+    String errorString = rapi_error_string(ret);
 
-    // BUG: Really we should do this in the main loop not here...
-    RAPI_PORT.flush();
-    DBUGVAR(rapi);
-    int ret = rapiSender.sendCmdSync(rapi);
+    if (ctx->json) {
+      s = "{\"cmd\":\""+rapi+"\",\"error\":\""+errorString+"\"}";
+    } else {
+      s += rapi;
+      s += F("<p><strong>Error:</strong>");
+      s += errorString;
+    }
+    code = 500;
+  }
+
+  if (false == ctx->json) {
+    s += F("<script type='text/javascript'>document.getElementById('rapi').focus();</script>");
+    s += F("<p></html>\r\n\r\n");
+  }
+
+  rapi_web_request_send(ctx, code);
+}
+
+static void rapi_web_command(RapiWebRequest *ctx)
+{
+  DBUGVAR(ctx->rapi);
+  bool queued = rapi_queue_send(ctx->rapi, RAPI_PRIORITY_USER, [ctx](int ret)
+  {
     DBUGVAR(ret);
+    const String &rapi = ctx->rapi;
+    String rapiString;
 
     if(RAPI_RESPONSE_OK == ret ||
        RAPI_RESPONSE_NK == ret)
     {
-      String rapiString = rapiSender.getResponse();
+      rapiString = rapiSender.getResponse();
 
       // Fake $GD if not supported by firmware
       if(RAPI_RESPONSE_OK == ret && rapi.startsWith(F("$ST"))) {
@@ -810,56 +1219,140 @@ handleRapi(AsyncWebServerRequest *request) {
 
           DBUGF("Attempting %s", fallback.c_str());
 
-          int ret = rapiSender.sendCmdSync(fallback.c_str());
-          if(RAPI_RESPONSE_OK == ret)
+          bool fallbackQueued = rapi_queue_send(fallback, RAPI_PRIORITY_USER, [ctx, rapiString](int ret)
           {
-            String rapiString = rapiSender.getResponse();
+            if(RAPI_RESPONSE_OK == ret) {
+              rapi_web_complete(ctx, ret, rapiSender.getResponse());
+            } else {
+              rapi_web_complete(ctx, RAPI_RESPONSE_NK, rapiString);
+            }
+          });
+          if(fallbackQueued) {
+            return;
           }
         }
       }
+    }
 
-      if (json) {
-        s = "{\"cmd\":\""+rapi+"\",\"ret\":\""+rapiString+"\"}";
-      } else {
-        s += rapi;
-        s += F("<p>&gt;");
-        s += rapiString;
-      }
+    rapi_web_complete(ctx, ret, rapiString);
+  });
+
+  if(false == queued) {
+    rapi_web_complete(ctx, RAPI_RESPONSE_QUEUE_FULL, "");
+  }
+}
+
+// Send a JSON array of commands, the response is an array of the results
+// in the same order
+static void rapi_web_batch(RapiWebRequest *ctx, const String &body)
+{
+  const size_t capacity = JSON_ARRAY_SIZE(RAPI_WEB_BATCH_MAX) + body.length();
+  DynamicJsonDocument cmds(capacity);
+  DeserializationError error = deserializeJson(cmds, body);
+  JsonArray array = cmds.as<JsonArray>();
+  if(error || array.isNull() || 0 == array.size() || array.size() > RAPI_WEB_BATCH_MAX) {
+    ctx->body = F("{\"msg\":\"Expected an array of commands\"}");
+    rapi_web_request_send(ctx, 400);
+    return;
+  }
+
+  size_t count = array.size();
+  const char *batch[RAPI_WEB_BATCH_MAX];
+  for(size_t i = 0; i < count; i++)
+  {
+    batch[i] = array[i].as<const char *>();
+    if(NULL == batch[i] || '\0' == batch[i][0] || strlen(batch[i]) > RAPI_QUEUE_CMD_LEN) {
+      ctx->body = F("{\"msg\":\"Commands must be strings of 1 to " ESCAPEQUOTE(RAPI_QUEUE_CMD_LEN) " characters\"}");
+      rapi_web_request_send(ctx, 400);
+      return;
     }
-      else
-    {
-      String errorString =
-        RAPI_RESPONSE_QUEUE_FULL == ret ? F("RAPI_RESPONSE_QUEUE_FULL") :
-        RAPI_RESPONSE_BUFFER_OVERFLOW == ret ? F("RAPI_RESPONSE_BUFFER_OVERFLOW") :
-        RAPI_RESPONSE_TIMEOUT == ret ? F("RAPI_RESPONSE_TIMEOUT") :
-        RAPI_RESPONSE_OK == ret ? F("RAPI_RESPONSE_OK") :
-        RAPI_RESPONSE_NK == ret ? F("RAPI_RESPONSE_NK") :
-        RAPI_RESPONSE_INVALID_RESPONSE == ret ? F("RAPI_RESPONSE_INVALID_RESPONSE") :
-        RAPI_RESPONSE_CMD_TOO_LONG == ret ? F("RAPI_RESPONSE_CMD_TOO_LONG") :
-        RAPI_RESPONSE_BAD_CHECKSUM == ret ? F("RAPI_RESPONSE_BAD_CHECKSUM") :
-        RAPI_RESPONSE_BAD_SEQUENCE_ID == ret ? F("RAPI_RESPONSE_BAD_SEQUENCE_ID") :
-        RAPI_RESPONSE_ASYNC_EVENT == ret ? F("RAPI_RESPONSE_ASYNC_EVENT") :
-        F("UNKNOWN");
-
-      if (json) {
-        s = "{\"cmd\":\""+rapi+"\",\"error\":\""+errorString+"\"}";
-      } else {
-        s += rapi;
-        s += F("<p><strong>Error:</strong>");
-        s += errorString;
-      }
+  }
+
+  ctx->results = new DynamicJsonDocument(JSON_ARRAY_SIZE(count) + count * RAPI_WEB_BATCH_ENTRY_SIZE);
+  JsonArray results = ctx->results->to<JsonArray>();
+  for(size_t i = 0; i < count; i++)
+  {
+    JsonObject result = results.createNestedObject();
+    result["cmd"] = array[i];
+  }
 
-      code = 500;
+  ctx->pending = count;
+  bool queued = rapi_queue_batch(batch, count, RAPI_PRIORITY_USER, [ctx](size_t index, int ret)
+  {
+    JsonObject result = (*ctx->results)[index];
+    if(RAPI_RESPONSE_OK == ret || RAPI_RESPONSE_NK == ret) {
+      result["ret"] = String(rapiSender.getResponse());
+    } else {
+      result["error"] = rapi_error_string(ret);
     }
+
+    if(0 == --ctx->pending) {
+      rapi_web_request_send(ctx, 200);
+    }
+  });
+
+  // The commands have been checked, so the only failure is no room
+  if(false == queued)
+  {
+    delete ctx->results;
+    ctx->results = NULL;
+    ctx->body = F("{\"msg\":\"RAPI queue full\"}");
+    rapi_web_request_send(ctx, 503);
+  }
 }
+
+// -------------------------------------------------------------------
+// Send RAPI commands to the OpenEVSE, the response is sent once the
+// commands complete
+// url: /r?rapi=$GS or POST /r with a JSON array of commands
+// -------------------------------------------------------------------
+void
+handleRapi(AsyncWebServerRequest *request) {
+  String *body = (String *)request->_tempObject;
+  request->_tempObject = NULL;
+
+  bool json = NULL != body || isPositive(request, "json");
+
+  AsyncResponseStream *response;
+  if(false == requestPreProcess(request, response, json ? CONTENT_TYPE_JSON : CONTENT_TYPE_HTML)) {
+    if(body) {
+      delete body;
+    }
+    return;
+  }
+
+  RapiWebRequest *ctx = rapi_web_request_create(request, response, json);
+
+  if(body)
+  {
+    rapi_web_batch(ctx, *body);
+    delete body;
+    return;
+  }
+
+  if(false == json) {
+    ctx->body = F("<html><font size='20'><font color=006666>Open</font><b>EVSE</b></font><p>"
+                  "<b>Open Source Hardware</b><p>RAPI Command Sent<p>Common Commands:<p>"
+                  "Set Current - $SC XX<p>Set Service Level - $SL 1 - $SL 2 - $SL A<p>"
+                  "Get Real-time Current - $GG<p>Get Temperatures - $GP<p>"
+                  "<p>"
+                  "<form method='get' action='r'><label><b><i>RAPI Command:</b></i></label>"
+                  "<input id='rapi' name='rapi' length=32><p><input type='submit'></form>");
+  }
+
+  if (request->hasArg("rapi"))
+  {
+    ctx->rapi = request->arg("rapi");
+    rapi_web_command(ctx);
+    return;
+  }
+
   if (false == json) {
-    s += F("<script type='text/javascript'>document.getElementById('rapi').focus();</script>");
-    s += F("<p></html>\r\n\r\n");
+    ctx->body += F("<script type='text/javascript'>document.getElementById('rapi').focus();</script>");
+    ctx->body += F("<p></html>\r\n\r\n");
   }
 
-  response->setCode(code);
-  response->print(s);
-  request->send(response);
+  rapi_web_request_send(ctx, 200);
 }
 
 void handleNotFound(AsyncWebServerRequest *request)
@@ -901,26 +1394,17 @@ void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_
   }
 }
 
-void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
-  if(type == WS_EVT_CONNECT) {
-    DBUGF("ws[%s][%u] connect", server->url(), client->id());
-    client->ping();
-  } else if(type == WS_EVT_DISCONNECT) {
-    DBUGF("ws[%s][%u] disconnect: %u", server->url(), client->id());
-  } else if(type == WS_EVT_ERROR) {
-    DBUGF("ws[%s][%u] error(%u): %s", server->url(), client->id(), *((uint16_t*)arg), (char*)data);
-  } else if(type == WS_EVT_PONG) {
-    DBUGF("ws[%s][%u] pong[%u]: %s", server->url(), client->id(), len, (len)?(char*)data:"");
-  } else if(type == WS_EVT_DATA) {
-    AwsFrameInfo * info = (AwsFrameInfo*)arg;
-    String msg = "";
-    if(info->final && info->index == 0 && info->len == len)
-    {
-      //the whole message is in a single frame and we got all of it's data
-      DBUGF("ws[%s][%u] %s-message[%u]: ", server->url(), client->id(), (info->opcode == WS_TEXT)?"text":"binary", len);
-    } else {
-      // TODO: handle messages that are comprised of multiple frames or the frame is split into multiple packets
-    }
+// Parse the config as it is received rather than buffering the body
+void handleConfigBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+  // Do not spend any memory on requests handleConfigPost() will reject
+  if(!index && requestAuthenticated(request)) {
+    DBUGF("ConfigBodyStart: %u", total);
+    request->_tempObject = ConfigParser::create(total);
+  }
+  ConfigParser *parser = (ConfigParser *)request->_tempObject;
+  if(parser) {
+    parser->parse(data, len);
   }
 }
 
@@ -933,8 +1417,14 @@ web_server_setup() {
 //    .setDefaultFile("index.html");
 
   // Add the Web Socket server
-  ws.onEvent(onWsEvent);
+  ws_setup();
   server.addHandler(&ws);
+
+  // Add the Server-Sent Events stream
+  sse_setup();
+  server.addHandler(&events);
+  // Only reached if the stream's filter turned the client away
+  server.on("/events", HTTP_GET, web_server_busy);
   server.addHandler(&staticFile);
 
   // Start server & server root html /
@@ -943,7 +1433,7 @@ web_server_setup() {
   // Handle status updates
   server.on("/status", handleStatus);
   server.on("/config", HTTP_GET, handleConfigGet);
-  server.on("/config", HTTP_POST, handleConfigPost, NULL, handleBody);
+  server.on("/config", HTTP_POST, handleConfigPost, NULL, handleConfigBody);
 #ifdef ENABLE_LEGACY_API
   server.on("/rapiupdate", handleUpdate);
 #endif
@@ -953,12 +1443,14 @@ web_server_setup() {
   server.on("/saveemoncms", handleSaveEmoncms);
   server.on("/savemqtt", handleSaveMqtt);
   server.on("/saveadmin", handleSaveAdmin);
+  server.on("/login", handleLogin);
+  server.on("/logout", handleLogout);
   server.on("/saveadvanced", handleSaveAdvanced);
   server.on("/saveohmkey", handleSaveOhmkey);
   server.on("/reset", handleRst);
   server.on("/restart", handleRestart);
-  server.on("/rapi", handleRapi);
-  server.on("/r", handleRapi);
+  server.on("/rapi", HTTP_ANY, handleRapi, NULL, handleBody);
+  server.on("/r", HTTP_ANY, handleRapi, NULL, handleBody);
   server.on("/scan", handleScan);
   server.on("/apoff", handleAPOff);
   server.on("/divertmode", handleDivertMode);
@@ -1001,6 +1493,7 @@ web_server_loop() {
   // Do we need to restart the system?
   if(systemRestartTime > 0 && millis() > systemRestartTime) {
     systemRestartTime = 0;
+    config_flush();
     wifi_disconnect();
     ESP.restart();
   }
@@ -1008,16 +1501,22 @@ web_server_loop() {
   // Do we need to reboot the system?
   if(systemRebootTime > 0 && millis() > systemRebootTime) {
     systemRebootTime = 0;
+    config_flush();
     wifi_disconnect();
     ESP.reset();
   }
 
+  ws_loop();
+
   Profile_End(web_server_loop, 5);
 }
 
 void web_server_event(JsonDocument &event)
 {
-  String json;
-  serializeJson(event, json);
-  ws.textAll(json);
+  Profile_Stats_Start(web_server_event);
+
+  ws_event(event);
+  sse_event(event);
+
+  Profile_Stats_End(web_server_event);
 }
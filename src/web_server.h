@@ -31,8 +31,46 @@ extern const char _CONTENT_TYPE_PNG[];
 extern const char _CONTENT_TYPE_SVG[];
 #define CONTENT_TYPE_SVG FPSTR(_CONTENT_TYPE_SVG)
 
+// Request admission limits, requests are rejected with a 503 if there are
+// too many in flight or the free heap or largest free block minus the
+// estimated cost of the request would be below these. Static files only
+// have the heap checked.
+#ifndef WEB_SERVER_MAX_IN_FLIGHT
+#define WEB_SERVER_MAX_IN_FLIGHT    6
+#endif
+
+#ifndef WEB_SERVER_MIN_FREE_HEAP
+#define WEB_SERVER_MIN_FREE_HEAP    (8 * 1024)
+#endif
+
+#ifndef WEB_SERVER_MIN_FREE_BLOCK
+#define WEB_SERVER_MIN_FREE_BLOCK   1024
+#endif
+
+// Seconds the client is told to wait before trying again
+#ifndef WEB_SERVER_RETRY_AFTER
+#define WEB_SERVER_RETRY_AFTER      2
+#endif
+
+// Estimated cost of requests without their own entry
+#define WEB_SERVER_DEFAULT_COST     1024
+
 extern AsyncWebServer server;
 extern String currentfirmware;
+extern uint32_t web_server_connections;
+extern uint32_t web_server_rejected_busy;
+extern uint32_t web_server_rejected_heap;
+extern uint32_t web_server_rejected_block;
+
+// Check the request can be handled without running short of memory, if
+// not a 503 is sent and false returned
+extern bool web_server_admit(AsyncWebServerRequest *request, size_t cost = WEB_SERVER_DEFAULT_COST);
+
+// The parts of web_server_admit() for handlers that can not use it, eg.
+// streams that stay open or static files, so are not counted as in flight. Check there is
+// heap for the request, counting it as rejected if not, and send the 503.
+extern bool web_server_has_heap(size_t cost);
+extern void web_server_busy(AsyncWebServerRequest *request);
 
 extern void web_server_setup();
 extern void web_server_loop();
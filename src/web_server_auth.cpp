@@ -0,0 +1,204 @@
+#if defined(ENABLE_DEBUG) && !defined(ENABLE_DEBUG_WEB)
+#undef ENABLE_DEBUG
+#endif
+
+#include <Arduino.h>
+
+#include "emonesp.h"
+#include "web_server.h"
+#include "web_server_auth.h"
+#include "app_config.h"
+
+// 128 bit token as hex
+#define WEB_SESSION_TOKEN_LEN     32
+
+struct WebSession
+{
+  char token[WEB_SESSION_TOKEN_LEN + 1];
+  uint32_t lastUsed;
+  bool used;
+};
+
+static WebSession sessions[WEB_SESSION_COUNT];
+
+static const char _SESSION_COOKIE[] PROGMEM = "session=";
+static const char _BEARER[] PROGMEM = "Bearer ";
+
+static WebSession *web_session_create()
+{
+  WebSession *session = &sessions[0];
+  for(size_t i = 0; i < WEB_SESSION_COUNT; i++)
+  {
+    if(false == sessions[i].used) {
+      session = &sessions[i];
+      break;
+    }
+    if(sessions[i].lastUsed - session->lastUsed > 0x80000000) {
+      session = &sessions[i];
+    }
+  }
+
+  // Hardware RNG
+  for(size_t i = 0; i < WEB_SESSION_TOKEN_LEN; i += 8) {
+    sprintf(session->token + i, "%08x", RANDOM_REG32);
+  }
+  session->lastUsed = millis();
+  session->used = true;
+
+  return session;
+}
+
+static WebSession *web_session_find(const char *token)
+{
+  for(size_t i = 0; i < WEB_SESSION_COUNT; i++)
+  {
+    WebSession *session = &sessions[i];
+    if(session->used && millis() - session->lastUsed > WEB_SESSION_TIMEOUT) {
+      session->used = false;
+    }
+
+    if(session->used)
+    {
+      // Compare all of it so the time taken does not leak the token
+      uint8_t diff = 0;
+      for(size_t c = 0; c < WEB_SESSION_TOKEN_LEN; c++) {
+        diff |= session->token[c] ^ token[c];
+      }
+      if(0 == diff) {
+        return session;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+// A token is exactly WEB_SESSION_TOKEN_LEN characters, ended by the end
+// of the header, the next cookie or whitespace
+static bool web_session_token_valid(const char *token)
+{
+  for(size_t i = 0; i < WEB_SESSION_TOKEN_LEN; i++)
+  {
+    if('\0' == token[i] || ';' == token[i] || ' ' == token[i] || '\t' == token[i]) {
+      return false;
+    }
+  }
+
+  char end = token[WEB_SESSION_TOKEN_LEN];
+  return '\0' == end || ';' == end || ' ' == end || '\t' == end;
+}
+
+// Find the token in the session cookie or a Bearer Authorization header,
+// returns NULL if there is none
+static const char *web_session_token(AsyncWebServerRequest *request)
+{
+  AsyncWebHeader *header = request->getHeader(F("Cookie"));
+  if(header)
+  {
+    // Cookies are separated by "; ", only match the start of a name so
+    // eg. xsession= is not taken as the session
+    for(const char *cookie = header->value().c_str(); cookie; cookie = strchr(cookie, ';'))
+    {
+      if(';' == *cookie) {
+        cookie++;
+      }
+      while(' ' == *cookie) {
+        cookie++;
+      }
+      if(0 == strncmp_P(cookie, _SESSION_COOKIE, sizeof(_SESSION_COOKIE) - 1) &&
+         web_session_token_valid(cookie + sizeof(_SESSION_COOKIE) - 1))
+      {
+        return cookie + sizeof(_SESSION_COOKIE) - 1;
+      }
+    }
+  }
+
+  header = request->getHeader(F("Authorization"));
+  if(header)
+  {
+    const char *auth = header->value().c_str();
+    if(0 == strncmp_P(auth, _BEARER, sizeof(_BEARER) - 1) &&
+       web_session_token_valid(auth + sizeof(_BEARER) - 1))
+    {
+      return auth + sizeof(_BEARER) - 1;
+    }
+  }
+
+  return NULL;
+}
+
+bool web_server_authenticate(AsyncWebServerRequest *request, const char *username, const char *password)
+{
+  const char *token = web_session_token(request);
+  if(token)
+  {
+    WebSession *session = web_session_find(token);
+    if(session) {
+      session->lastUsed = millis();
+      return true;
+    }
+  }
+
+  return request->authenticate(username, password);
+}
+
+void web_session_clear()
+{
+  for(size_t i = 0; i < WEB_SESSION_COUNT; i++) {
+    sessions[i].used = false;
+  }
+}
+
+// -------------------------------------------------------------------
+// Start a session, the client must send the Basic auth credentials
+//
+// The credentials are checked even in AP mode, where other requests are
+// not authenticated, as the session stays valid once connected to the
+// network.
+// url: /login
+// -------------------------------------------------------------------
+void handleLogin(AsyncWebServerRequest *request)
+{
+  dumpRequest(request);
+
+  if(www_username != "" &&
+     false == request->authenticate(www_username.c_str(), www_password.c_str()))
+  {
+    request->requestAuthentication(esp_hostname.c_str());
+    return;
+  }
+
+  WebSession *session = web_session_create();
+
+  char cookie[80];
+  snprintf_P(cookie, sizeof(cookie), PSTR("session=%s; Path=/; HttpOnly; SameSite=Strict"), session->token);
+
+  AsyncResponseStream *response = request->beginResponseStream(String(CONTENT_TYPE_JSON));
+  response->addHeader(F("Set-Cookie"), cookie);
+  response->addHeader(F("Cache-Control"), F("no-store"));
+  response->setCode(200);
+  response->printf_P(PSTR("{\"token\":\"%s\",\"timeout\":%u}"), session->token, WEB_SESSION_TIMEOUT / 1000);
+  request->send(response);
+}
+
+// -------------------------------------------------------------------
+// End the session
+// url: /logout
+// -------------------------------------------------------------------
+void handleLogout(AsyncWebServerRequest *request)
+{
+  dumpRequest(request);
+
+  const char *token = web_session_token(request);
+  if(token)
+  {
+    WebSession *session = web_session_find(token);
+    if(session) {
+      session->used = false;
+    }
+  }
+
+  AsyncWebServerResponse *response = request->beginResponse(200, CONTENT_TYPE_JSON, "{\"msg\":\"done\"}");
+  response->addHeader(F("Set-Cookie"), F("session=; Path=/; Max-Age=0"));
+  request->send(response);
+}
@@ -0,0 +1,38 @@
+#ifndef _EMONESP_WEB_SERVER_AUTH_H
+#define _EMONESP_WEB_SERVER_AUTH_H
+
+// -------------------------------------------------------------------
+// Web server authentication
+//
+// Clients log in once with Basic auth at /login and are given a session
+// token. The token can then be sent as the session cookie or as a Bearer
+// token, which is much cheaper to check than the Basic auth credentials.
+// -------------------------------------------------------------------
+
+#include <Hash.h>
+#include <ESPAsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+
+// Max number of active sessions, the least recently used is dropped when
+// a new session is needed
+#ifndef WEB_SESSION_COUNT
+#define WEB_SESSION_COUNT         4
+#endif
+
+// Time a session stays valid after it was last used (ms)
+#ifndef WEB_SESSION_TIMEOUT
+#define WEB_SESSION_TIMEOUT       (30 * 60 * 1000)
+#endif
+
+// Check if the request has a valid session token or else the given Basic
+// auth credentials
+extern bool web_server_authenticate(AsyncWebServerRequest *request, const char *username, const char *password);
+
+// url: /login and /logout
+extern void handleLogin(AsyncWebServerRequest *request);
+extern void handleLogout(AsyncWebServerRequest *request);
+
+// End all sessions, eg. when the credentials change
+extern void web_session_clear();
+
+#endif // _EMONESP_WEB_SERVER_AUTH_H
@@ -0,0 +1,93 @@
+#if defined(ENABLE_DEBUG) && !defined(ENABLE_DEBUG_WEB)
+#undef ENABLE_DEBUG
+#endif
+
+#include <Arduino.h>
+
+#include "emonesp.h"
+#include "web_server.h"
+#include "web_server_events.h"
+#include "input.h"
+
+AsyncEventSource events("/events");
+
+struct SseEvent
+{
+  uint32_t id;
+  String data;
+};
+
+static SseEvent sse_ring[SSE_RING_SIZE];
+
+// Ids start at 1, 0 means no id
+static uint32_t sse_next_id = 1;
+
+static void sse_send_snapshot(AsyncEventSourceClient *client)
+{
+  StaticJsonDocument<RAPI_JSON_SIZE> data;
+  create_rapi_json(data);
+
+  String json;
+  serializeJson(data, json);
+
+  // The snapshot includes everything up to the latest event
+  client->send(json.c_str(), NULL, sse_next_id - 1, SSE_RETRY);
+}
+
+static void sse_connect(AsyncEventSourceClient *client)
+{
+  uint32_t lastId = client->lastId();
+  uint32_t oldest = sse_next_id > SSE_RING_SIZE ? sse_next_id - SSE_RING_SIZE : 1;
+
+  DBUGF("SSE client connected, last id %u, have %u to %u", lastId, oldest, sse_next_id - 1);
+
+  // Ids from before a restart will not be in the ring
+  if(lastId > 0 && lastId < sse_next_id && lastId + 1 >= oldest)
+  {
+    for(uint32_t id = lastId + 1; id < sse_next_id; id++)
+    {
+      SseEvent &entry = sse_ring[id % SSE_RING_SIZE];
+      client->send(entry.data.c_str(), NULL, entry.id, SSE_RETRY);
+    }
+  } else {
+    sse_send_snapshot(client);
+  }
+}
+
+// Turn clients away when there are too many or the heap is short. The
+// stream can not send the 503 itself so the request falls through to the
+// /events handler that does.
+static bool sse_admit(AsyncWebServerRequest *request)
+{
+  // Called for every request that gets this far, not just the stream
+  if(request->url() != events.url()) {
+    return true;
+  }
+
+  if(events.count() >= SSE_MAX_CLIENTS) {
+    web_server_rejected_busy++;
+    return false;
+  }
+
+  return web_server_has_heap(SSE_CONNECT_COST);
+}
+
+void sse_setup()
+{
+  events.onConnect(sse_connect);
+  events.setFilter(sse_admit);
+}
+
+void sse_event(JsonDocument &event)
+{
+  // Kept even if no one is listening so a client that reconnects can
+  // catch up
+  SseEvent &entry = sse_ring[sse_next_id % SSE_RING_SIZE];
+  entry.id = sse_next_id++;
+  entry.data = "";
+  serializeJson(event, entry.data);
+
+  if(events.count() > 0) {
+    events.send(entry.data.c_str(), NULL, entry.id);
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef _EMONESP_WEB_SERVER_EVENTS_H
+#define _EMONESP_WEB_SERVER_EVENTS_H
+
+// -------------------------------------------------------------------
+// Server-Sent Events state stream
+//
+// A one way alternative to the WebSocket for clients that only need the
+// state updates. Recent events are kept so a client that reconnects with
+// Last-Event-ID is sent what it missed, otherwise it is sent a snapshot
+// of the current state.
+// -------------------------------------------------------------------
+
+#include <Hash.h>
+#include <ESPAsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+
+// Number of events kept for resuming clients
+#ifndef SSE_RING_SIZE
+#define SSE_RING_SIZE             8
+#endif
+
+// Max number of connected clients
+#ifndef SSE_MAX_CLIENTS
+#define SSE_MAX_CLIENTS           4
+#endif
+
+// Heap needed to connect a client and send it the snapshot
+#ifndef SSE_CONNECT_COST
+#define SSE_CONNECT_COST          1024
+#endif
+
+// Time the client should wait before reconnecting (ms)
+#ifndef SSE_RETRY
+#define SSE_RETRY                 5000
+#endif
+
+extern AsyncEventSource events;
+
+extern void sse_setup();
+
+// Send the event to all clients
+extern void sse_event(JsonDocument &event);
+
+#endif // _EMONESP_WEB_SERVER_EVENTS_H
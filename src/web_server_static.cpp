@@ -7,44 +7,78 @@
 #include "emonesp.h"
 #include "web_server.h"
 #include "web_server_static.h"
+#include "web_server_auth.h"
 #include "app_config.h"
 #include "wifi.h"
 
+// Content encodings
+static const char _CONTENT_ENCODING_GZIP[] PROGMEM = "gzip";
+
 // Static files
 #include "web_static/web_server_static_files.h"
 
 #define ARRAY_LENGTH(x) (sizeof(x)/sizeof((x)[0]))
 
-#define IS_ALIGNED(x)   (0 == ((uint32_t)(x) & 0x3))
+// Shared by all responses, the data is copied by add() before we return
+static uint32_t staticFileBuffer[STATIC_FILE_BUFFER_SIZE / sizeof(uint32_t)];
 
 // Pages
 static const char _HOME_PAGE[] PROGMEM = "/home.html";
-#define HOME_PAGE FPSTR(_HOME_PAGE)
-
 static const char _WIFI_PAGE[] PROGMEM = "/wifi_portal.html";
-#define WIFI_PAGE FPSTR(_WIFI_PAGE)
 
 StaticFileWebHandler::StaticFileWebHandler()
 {
 }
 
+// FNV-1a, must match fnv1a() in scripts/extra_script.py
+static uint32_t static_file_hash(const char *str, size_t &length)
+{
+  uint32_t hash = 0x811c9dc5;
+  const char *ptr = str;
+  while(*ptr) {
+    hash ^= (uint8_t)*ptr++;
+    hash *= 0x01000193;
+  }
+  length = ptr - str;
+  return hash;
+}
+
 bool StaticFileWebHandler::_getFile(AsyncWebServerRequest *request, StaticFile **file)
 {
-  // Remove the found uri
-  String path = request->url();
-  if(path == "/") {
-    path = String(wifi_mode_is_ap_only() ? WIFI_PAGE : HOME_PAGE);
+  const char *path = request->url().c_str();
+
+  char page[sizeof(_WIFI_PAGE) > sizeof(_HOME_PAGE) ? sizeof(_WIFI_PAGE) : sizeof(_HOME_PAGE)];
+  if(0 == strcmp(path, "/")) {
+    strcpy_P(page, wifi_mode_is_ap_only() ? _WIFI_PAGE : _HOME_PAGE);
+    path = page;
   }
 
-  DBUGF("Looking for %s", path.c_str());
+  DBUGF("Looking for %s", path);
 
-  for(int i = 0; i < ARRAY_LENGTH(staticFiles); i++) {
-    if(path == staticFiles[i].filename)
-    {
-      DBUGF("Found %s %d@%p", staticFiles[i].filename, staticFiles[i].length, staticFiles[i].data);
+  size_t length;
+  uint32_t hash = static_file_hash(path, length);
+
+  size_t first = 0;
+  size_t last = ARRAY_LENGTH(staticFiles);
+  while(first < last)
+  {
+    size_t mid = first + (last - first) / 2;
+    StaticFile *entry = &staticFiles[mid];
+    if(entry->filenameHash < hash) {
+      first = mid + 1;
+    } else if(entry->filenameHash > hash) {
+      last = mid;
+    } else {
+      // The build checks there are no collisions in the table, but the
+      // request could still collide with one of them
+      if(entry->filenameLength != length || 0 != strcmp(entry->filename, path)) {
+        return false;
+      }
+
+      DBUGF("Found %s %d@%p", entry->filename, entry->length, entry->data);
 
       if(file) {
-        *file = &staticFiles[i];
+        *file = entry;
       }
       return true;
     }
@@ -59,6 +93,14 @@ bool StaticFileWebHandler::canHandle(AsyncWebServerRequest *request)
   if (request->method() == HTTP_GET &&
       _getFile(request, &file))
   {
+    if(file->encoding) {
+      request->addInterestingHeader(F("Accept-Encoding"));
+    }
+    request->addInterestingHeader(F("If-None-Match"));
+    if(_username != "") {
+      request->addInterestingHeader(F("Authorization"));
+      request->addInterestingHeader(F("Cookie"));
+    }
     request->_tempObject = file;
     DBUGF("[StaticFileWebHandler::canHandle] TRUE");
     return true;
@@ -67,24 +109,141 @@ bool StaticFileWebHandler::canHandle(AsyncWebServerRequest *request)
   return false;
 }
 
+// Quoted 8 digit hash
+#define ETAG_SIZE 11
+
+static void getEtag(StaticFile *file, char *etag)
+{
+  snprintf_P(etag, ETAG_SIZE, PSTR("\"%08x\""), file->hash);
+}
+
+static void addCacheHeaders(AsyncWebServerResponse *response, StaticFile *file)
+{
+  char etag[ETAG_SIZE];
+  getEtag(file, etag);
+  response->addHeader(F("ETag"), etag);
+  if(file->encoding) {
+    response->addHeader(F("Vary"), F("Accept-Encoding"));
+  }
+
+  // The asset URLs are not versioned, so every file is checked with us to
+  // stop new html running against old scripts after an update. The check
+  // is a 304 with no body.
+  response->addHeader(F("Cache-Control"), F("no-cache"));
+}
+
+// Check the client accepts the encoding, with no Accept-Encoding header
+// any encoding is acceptable (RFC 7231 5.3.4)
+static bool acceptsEncoding(AsyncWebServerRequest *request, PGM_P encoding)
+{
+  AsyncWebHeader *header = request->getHeader(F("Accept-Encoding"));
+  if(NULL == header) {
+    return true;
+  }
+
+  size_t encodingLength = strlen_P(encoding);
+  bool wildcard = false;
+
+  // Each entry is "coding[;q=value]", a q of 0 means not acceptable
+  const char *ptr = header->value().c_str();
+  while(*ptr)
+  {
+    while(',' == *ptr || ' ' == *ptr || '\t' == *ptr) {
+      ptr++;
+    }
+
+    const char *name = ptr;
+    while(*ptr && ',' != *ptr && ';' != *ptr && ' ' != *ptr && '\t' != *ptr) {
+      ptr++;
+    }
+    size_t nameLength = ptr - name;
+
+    float q = 1;
+    while(*ptr && ',' != *ptr)
+    {
+      if(';' == *ptr++)
+      {
+        while(' ' == *ptr || '\t' == *ptr) {
+          ptr++;
+        }
+        if(('q' == *ptr || 'Q' == *ptr) && '=' == ptr[1]) {
+          q = atof(ptr + 2);
+        }
+      }
+    }
+
+    if(nameLength == encodingLength && 0 == strncasecmp_P(name, encoding, nameLength)) {
+      return q > 0;
+    }
+    if(1 == nameLength && '*' == *name) {
+      wildcard = q > 0;
+    }
+  }
+
+  return wildcard;
+}
+
+// Check if the browser's copy is up to date and if so send a 304
+bool StaticFileWebHandler::_notModified(AsyncWebServerRequest *request, StaticFile *file)
+{
+  AsyncWebHeader *header = request->getHeader(F("If-None-Match"));
+  if(NULL == header) {
+    return false;
+  }
+
+  char etag[ETAG_SIZE];
+  getEtag(file, etag);
+  if(-1 == header->value().indexOf(etag) && header->value() != "*") {
+    return false;
+  }
+
+  DBUGF("%s not modified", file->filename);
+  AsyncWebServerResponse *response = request->beginResponse(304);
+  addCacheHeaders(response, file);
+  request->send(response);
+  return true;
+}
+
 void StaticFileWebHandler::handleRequest(AsyncWebServerRequest *request)
 {
   dumpRequest(request);
 
+  // Take the file from request->_tempObject first, it points in to the
+  // static file table so must not be left to be free()ed with the request
+  StaticFile *file = (StaticFile *)request->_tempObject;
+  request->_tempObject = NULL;
+
+  // Static files are copied through a shared buffer so only need room for
+  // the response and its headers. They are not counted as in flight, a
+  // page load fetches more assets at once than the API limit allows.
+  if(false == web_server_has_heap(512)) {
+    web_server_busy(request);
+    return;
+  }
+  web_server_connections++;
+
   // Are we authenticated
   if(wifi_mode_is_sta() &&
      _username != "" && _password != "" &&
-     false == request->authenticate(_username.c_str(), _password.c_str()))
+     false == web_server_authenticate(request, _username.c_str(), _password.c_str()))
   {
     request->requestAuthentication(esp_hostname.c_str());
     return;
   }
 
-  // Get the filename from request->_tempObject and free it
-  StaticFile *file = (StaticFile *)request->_tempObject;
   if (file)
   {
-    request->_tempObject = NULL;
+    // There is no room to keep an uncompressed copy, or to decompress on
+    // the fly, so clients have to accept the encoding we have
+    if(file->encoding && false == acceptsEncoding(request, file->encoding)) {
+      request->send(406);
+      return;
+    }
+
+    if(_notModified(request, file)) {
+      return;
+    }
+
     AsyncWebServerResponse *response = new StaticFileResponse(200, file);
     request->send(response);
   } else {
@@ -99,6 +258,10 @@ StaticFileResponse::StaticFileResponse(int code, StaticFile *content){
   _contentLength = content->length;
   ptr = content->data;
   addHeader("Connection","close");
+  if(content->encoding) {
+    addHeader(F("Content-Encoding"), FPSTR(content->encoding));
+  }
+  addCacheHeaders(this, content);
 }
 
 size_t StaticFileResponse::write(AsyncWebServerRequest *request)
@@ -119,6 +282,8 @@ size_t StaticFileResponse::write(AsyncWebServerRequest *request)
     // How should failures to send be handled?
     request->client()->send();
   }
+
+  return total;
 }
 
 size_t StaticFileResponse::writeData(AsyncWebServerRequest *request)
@@ -139,28 +304,35 @@ size_t StaticFileResponse::writeData(AsyncWebServerRequest *request)
   {
     size_t written = 0;
 
-    bool aligned = RESPONSE_CONTENT == _state;
-    char buffer[128];
-    uint32_t copy = sizeof(buffer);
-    if(copy > length) {
-      copy = length;
-    }
-    if(copy > space) {
-      copy = space;
+    if(RESPONSE_HEADERS == _state)
+    {
+      // Headers are in RAM, add() copies them directly
+      written = request->client()->add(ptr, length > space ? space : length);
     }
-    //DBUGF("%p: write %d@%p", request, copy, ptr);
-    if(IS_ALIGNED(ptr)) {
-      uint32_t *end = (uint32_t *)(ptr + copy);
-      for(uint32_t *src = (uint32_t *)ptr, *dst = (uint32_t *)buffer;
-          src < end; src++, dst++)
-      {
+    else
+    {
+      // Flash can only be read a word at a time and lwIP can not be handed
+      // flash backed data, so copy as much as fits in the send window using
+      // aligned reads. An unaligned start is handled by reading from the
+      // word before and skipping the extra bytes.
+      size_t offset = (uint32_t)ptr & 0x3;
+      size_t copy = sizeof(staticFileBuffer) - offset;
+      if(copy > length) {
+        copy = length;
+      }
+      if(copy > space) {
+        copy = space;
+      }
+
+      const uint32_t *src = (const uint32_t *)(ptr - offset);
+      const uint32_t *end = (const uint32_t *)(ptr + copy);
+      for(uint32_t *dst = staticFileBuffer; src < end; src++, dst++) {
         *dst = *src;
       }
-    } else {
-      memcpy_P(buffer, ptr, copy);
+
+      written = request->client()->add((const char *)staticFileBuffer + offset, copy);
     }
 
-    written = request->client()->add(buffer, copy);
     if(written > 0) {
       _writtenLength += written;
       ptr += written;
@@ -169,46 +341,6 @@ size_t StaticFileResponse::writeData(AsyncWebServerRequest *request)
       DBUGF("Failed to write data");
     }
 
-/*
-    bool aligned = RESPONSE_CONTENT == _state;
-    if(aligned && (!IS_ALIGNED(ptr) || length < 32))
-    {
-      char buffer[32];
-      uint32_t copy = sizeof(buffer) - ((uint32_t)ptr & 0x00000003); // byte aligned mask
-      if(copy > length) {
-        copy = length;
-      }
-      DBUGF("None aligned write %d@%p", copy, ptr);
-      memcpy_P(buffer, ptr, copy);
-
-      written = request->client()->write(buffer, copy);
-      if(written > 0) {
-        _writtenLength += written;
-        ptr += written;
-        length -= written;
-      } else {
-        DBUGF("Failed to write data");
-      }
-    }
-
-    if(!aligned || IS_ALIGNED(ptr))
-    {
-      size_t outLen = length;
-      if(outLen > space) {
-        outLen = space;
-      }
-      DBUGF("Aligned write %d@%p", outLen, ptr);
-      written = request->client()->write(ptr, outLen);
-      if(written > 0) {
-        _writtenLength += written;
-        ptr += written;
-        length -= written;
-      } else {
-        DBUGF("Failed to write data");
-      }
-    }
-*/
-
     if(0 == length)
     {
       switch(_state)
@@ -231,6 +363,9 @@ size_t StaticFileResponse::writeData(AsyncWebServerRequest *request)
 }
 
 void StaticFileResponse::_respond(AsyncWebServerRequest *request){
+#ifdef ENABLE_PROFILE
+  _start = millis();
+#endif
   _state = RESPONSE_HEADERS;
   _header = _assembleHead(request->version());
 
@@ -243,5 +378,18 @@ void StaticFileResponse::_respond(AsyncWebServerRequest *request){
 
 size_t StaticFileResponse::_ack(AsyncWebServerRequest *request, size_t len, uint32_t time){
   _ackedLength += len;
-  return write(request);
+  size_t written = write(request);
+
+  if(RESPONSE_WAIT_ACK == _state && _ackedLength >= _writtenLength)
+  {
+    _state = RESPONSE_END;
+
+#ifdef ENABLE_PROFILE
+    uint32_t elapsed = millis() - _start;
+    DBUGF(">> %s: %u bytes in %ums, %uKB/s", _content->filename,
+      _writtenLength, elapsed, elapsed > 0 ? _writtenLength / elapsed : 0);
+#endif
+  }
+
+  return written;
 }
@@ -8,15 +8,20 @@
 struct StaticFile
 {
   const char *filename;
+  size_t filenameLength;
+  uint32_t filenameHash;      // staticFiles[] is sorted by this
   const char *data;
   size_t length;
   const char *type;
+  const char *encoding;       // Content-Encoding of data, NULL if not encoded
+  uint32_t hash;              // Hash of data, used as the ETag
 };
 
 class StaticFileWebHandler: public AsyncWebHandler
 {
   private:
     bool _getFile(AsyncWebServerRequest *request, StaticFile **file = NULL);
+    bool _notModified(AsyncWebServerRequest *request, StaticFile *file);
   protected:
   public:
     StaticFileWebHandler();
@@ -24,11 +29,20 @@ class StaticFileWebHandler: public AsyncWebHandler
     virtual void handleRequest(AsyncWebServerRequest *request) override final;
 };
 
+// Size of the buffer used to copy static files out of flash, one full
+// sized TCP segment
+#ifndef STATIC_FILE_BUFFER_SIZE
+#define STATIC_FILE_BUFFER_SIZE 1460
+#endif
+
 class StaticFileResponse: public AsyncWebServerResponse
 {
   private:
     String _header;
     StaticFile *_content;
+#ifdef ENABLE_PROFILE
+    uint32_t _start;
+#endif
 
     const char *ptr;
     size_t length;
@@ -0,0 +1,404 @@
+#if defined(ENABLE_DEBUG) && !defined(ENABLE_DEBUG_WEB)
+#undef ENABLE_DEBUG
+#endif
+
+#include <Arduino.h>
+
+#include "emonesp.h"
+#include "web_server_ws.h"
+#include "input.h"
+
+#define ARRAY_LENGTH(x) (sizeof(x)/sizeof((x)[0]))
+
+// How often the per client byte counts are sampled (ms)
+#define WS_STATS_PERIOD           (60 * 1000)
+
+// Pending fields are tracked as a bit mask
+#if WS_STATE_FIELDS > 32
+#error WS_STATE_FIELDS must be 32 or less
+#endif
+
+AsyncWebSocket ws("/ws");
+
+uint32_t ws_bytes_sent = 0;
+uint32_t ws_clients_closed = 0;
+
+// -------------------------------------------------------------------
+// Last value sent for each field, held as serialised JSON so the
+// snapshot can be written without a JSON document
+// -------------------------------------------------------------------
+
+struct WsStateField
+{
+  char key[WS_STATE_KEY_LEN + 1];
+  char value[WS_STATE_VALUE_LEN + 1];
+  double number;
+  bool isNumber;
+};
+
+static WsStateField ws_state[WS_STATE_FIELDS];
+static size_t ws_state_count = 0;
+
+struct WsDeadband
+{
+  const char *key;
+  double deadband;
+};
+
+static const WsDeadband ws_deadbands[] =
+{
+  { "srssi", WS_DEADBAND_SRSSI },
+  { "freeram", WS_DEADBAND_FREERAM }
+};
+
+// Keys that are events rather than state, these are always sent even if
+// the value is the same as last time, eg. divert_update is sent as 0 on
+// every divert update so the GUI can reset its timer
+static const char * const ws_event_keys[] =
+{
+  "divert_update"
+};
+
+// -------------------------------------------------------------------
+// Connected clients
+//
+// While a client's send queue is full, changes are not queued behind it
+// but marked as pending against the remembered state, so however many
+// events arrive the client only gets the latest value of each field once
+// it catches up. A client that does not catch up is disconnected.
+// -------------------------------------------------------------------
+
+struct WsClient
+{
+  uint32_t id;
+  bool used;
+  bool snapshot;              // Waiting for the initial state
+  uint32_t pending;           // Bit mask of ws_state fields waiting to be sent
+  uint32_t stalled;           // When the client was last able to send (ms)
+  uint32_t coalesced;         // Events merged in to the pending fields
+  uint32_t dropped;           // Events or fields too big to remember lost while waiting
+  uint32_t bytes;             // Sent in the current period
+  uint32_t bytesPerMinute;    // Sent in the last full period
+};
+
+static WsClient ws_clients[WS_MAX_CLIENTS];
+static bool ws_snapshot_pending = false;
+static uint32_t ws_stats_time = 0;
+
+static WsClient *ws_client_find(uint32_t id)
+{
+  for(size_t i = 0; i < WS_MAX_CLIENTS; i++) {
+    if(ws_clients[i].used && ws_clients[i].id == id) {
+      return &ws_clients[i];
+    }
+  }
+  return NULL;
+}
+
+static WsClient *ws_client_add(uint32_t id)
+{
+  for(size_t i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    WsClient *entry = &ws_clients[i];
+    if(false == entry->used)
+    {
+      entry->id = id;
+      entry->used = true;
+      entry->snapshot = true;
+      entry->pending = 0;
+      entry->stalled = millis();
+      entry->coalesced = 0;
+      entry->dropped = 0;
+      entry->bytes = 0;
+      entry->bytesPerMinute = 0;
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static void ws_client_send(WsClient *entry, AsyncWebSocketClient *client, const char *message, size_t len)
+{
+  client->text(message, len);
+  entry->bytes += len;
+  ws_bytes_sent += len;
+}
+
+// Returned by ws_state_update()
+#define WS_STATE_UNCHANGED        -1
+#define WS_STATE_NOT_REMEMBERED   -2
+
+// -------------------------------------------------------------------
+// Update the remembered value of a field
+//
+// Returns the index of the field if it has changed, WS_STATE_UNCHANGED or
+// WS_STATE_NOT_REMEMBERED if the value needs to be sent but could not be
+// stored.
+// -------------------------------------------------------------------
+static int ws_state_update(const char *key, JsonVariantConst value)
+{
+  for(size_t i = 0; i < ARRAY_LENGTH(ws_event_keys); i++) {
+    if(0 == strcmp(ws_event_keys[i], key)) {
+      return WS_STATE_NOT_REMEMBERED;
+    }
+  }
+
+  if(strlen(key) > WS_STATE_KEY_LEN || measureJson(value) > WS_STATE_VALUE_LEN) {
+    return WS_STATE_NOT_REMEMBERED;
+  }
+
+  WsStateField *field = NULL;
+  for(size_t i = 0; i < ws_state_count; i++) {
+    if(0 == strcmp(ws_state[i].key, key)) {
+      field = &ws_state[i];
+      break;
+    }
+  }
+
+  if(NULL == field)
+  {
+    if(ws_state_count >= WS_STATE_FIELDS) {
+      return WS_STATE_NOT_REMEMBERED;
+    }
+
+    field = &ws_state[ws_state_count++];
+    strcpy(field->key, key);
+    field->value[0] = '\0';
+    field->isNumber = false;
+  }
+  else if(field->isNumber && value.is<double>())
+  {
+    for(size_t i = 0; i < ARRAY_LENGTH(ws_deadbands); i++)
+    {
+      if(0 == strcmp(ws_deadbands[i].key, key) &&
+         fabs(value.as<double>() - field->number) < ws_deadbands[i].deadband)
+      {
+        return WS_STATE_UNCHANGED;
+      }
+    }
+  }
+
+  char text[WS_STATE_VALUE_LEN + 1];
+  serializeJson(value, text, sizeof(text));
+  if(0 == strcmp(field->value, text)) {
+    return WS_STATE_UNCHANGED;
+  }
+
+  strcpy(field->value, text);
+  field->isNumber = value.is<double>();
+  field->number = field->isNumber ? value.as<double>() : 0;
+
+  return field - ws_state;
+}
+
+// Send the remembered values of the pending fields
+static void ws_send_pending(WsClient *entry, AsyncWebSocketClient *client)
+{
+  size_t len = 2;
+  for(size_t i = 0; i < ws_state_count; i++) {
+    if(entry->pending & (1UL << i)) {
+      len += strlen(ws_state[i].key) + strlen(ws_state[i].value) + 4;
+    }
+  }
+
+  char *message = (char *)malloc(len + 1);
+  if(NULL == message) {
+    return;
+  }
+
+  char *ptr = message;
+  *ptr++ = '{';
+  for(size_t i = 0; i < ws_state_count; i++) {
+    if(entry->pending & (1UL << i)) {
+      ptr += sprintf(ptr, "%s\"%s\":%s", ptr - message > 1 ? "," : "", ws_state[i].key, ws_state[i].value);
+    }
+  }
+  *ptr++ = '}';
+  *ptr = '\0';
+
+  DBUGF("ws[%u] sending %u pending bytes", entry->id, ptr - message);
+  ws_client_send(entry, client, message, ptr - message);
+  entry->pending = 0;
+
+  free(message);
+}
+
+void ws_event(JsonDocument &event)
+{
+  DynamicJsonDocument delta(event.memoryUsage() + JSON_OBJECT_SIZE(1));
+  uint32_t changed = 0;
+  bool notRemembered = false;
+
+  for(JsonPair kv : event.as<JsonObject>())
+  {
+    int index = ws_state_update(kv.key().c_str(), kv.value());
+    if(WS_STATE_UNCHANGED != index)
+    {
+      delta[kv.key().c_str()] = kv.value();
+      if(index >= 0) {
+        changed |= 1UL << index;
+      } else {
+        notRemembered = true;
+      }
+    }
+  }
+
+  if(0 == delta.size() || 0 == ws.count()) {
+    return;
+  }
+
+  String json;
+  serializeJson(delta, json);
+
+  for(size_t i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    WsClient *entry = &ws_clients[i];
+    if(false == entry->used) {
+      continue;
+    }
+
+    AsyncWebSocketClient *client = ws.client(entry->id);
+    if(NULL == client || WS_CONNECTED != client->status()) {
+      continue;
+    }
+
+    if(entry->pending || entry->snapshot || client->queueIsFull())
+    {
+      // Client is behind, merge the changes with what is already waiting
+      entry->pending |= changed;
+      if(false == entry->snapshot) {
+        entry->coalesced++;
+      }
+      if(notRemembered) {
+        entry->dropped++;
+      }
+    } else {
+      ws_client_send(entry, client, json.c_str(), json.length());
+    }
+  }
+}
+
+static void onWsEvent(AsyncWebSocket * server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+  if(type == WS_EVT_CONNECT) {
+    DBUGF("ws[%s][%u] connect", server->url(), client->id());
+    if(NULL == ws_client_add(client->id())) {
+      DBUGF("ws[%s][%u] too many clients", server->url(), client->id());
+      client->close(1013);
+      return;
+    }
+    ws_snapshot_pending = true;
+    client->ping();
+  } else if(type == WS_EVT_DISCONNECT) {
+    DBUGF("ws[%s][%u] disconnect", server->url(), client->id());
+    WsClient *entry = ws_client_find(client->id());
+    if(entry) {
+      entry->used = false;
+    }
+  } else if(type == WS_EVT_ERROR) {
+    DBUGF("ws[%s][%u] error(%u): %s", server->url(), client->id(), *((uint16_t*)arg), (char*)data);
+  } else if(type == WS_EVT_PONG) {
+    DBUGF("ws[%s][%u] pong[%u]: %s", server->url(), client->id(), len, (len)?(char*)data:"");
+  } else if(type == WS_EVT_DATA) {
+    AwsFrameInfo * info = (AwsFrameInfo*)arg;
+    String msg = "";
+    if(info->final && info->index == 0 && info->len == len)
+    {
+      //the whole message is in a single frame and we got all of it's data
+      DBUGF("ws[%s][%u] %s-message[%u]: ", server->url(), client->id(), (info->opcode == WS_TEXT)?"text":"binary", len);
+    } else {
+      // TODO: handle messages that are comprised of multiple frames or the frame is split into multiple packets
+    }
+  }
+}
+
+void ws_setup()
+{
+  ws.onEvent(onWsEvent);
+}
+
+void ws_loop()
+{
+  Profile_Start(ws_loop);
+
+  if(ws_snapshot_pending)
+  {
+    ws_snapshot_pending = false;
+
+    // Bring the remembered state up to date before sending it
+    StaticJsonDocument<RAPI_JSON_SIZE> data;
+    create_rapi_json(data);
+    ws_event(data);
+
+    for(size_t i = 0; i < WS_MAX_CLIENTS; i++)
+    {
+      WsClient *entry = &ws_clients[i];
+      if(entry->used && entry->snapshot)
+      {
+        entry->snapshot = false;
+        entry->pending = (1ULL << ws_state_count) - 1;
+      }
+    }
+  }
+
+  // Send any pending changes to the clients that have caught up and
+  // drop the ones that have not
+  for(size_t i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    WsClient *entry = &ws_clients[i];
+    if(false == entry->used) {
+      continue;
+    }
+
+    AsyncWebSocketClient *client = ws.client(entry->id);
+    if(NULL == client || WS_CONNECTED != client->status()) {
+      continue;
+    }
+
+    if(false == client->queueIsFull())
+    {
+      entry->stalled = millis();
+      if(entry->pending) {
+        ws_send_pending(entry, client);
+      }
+    }
+    else if(millis() - entry->stalled > WS_CLIENT_STALL_TIMEOUT)
+    {
+      DBUGF("ws[%u] not keeping up, closing", entry->id);
+      ws_clients_closed++;
+      entry->pending = 0;
+      client->close(1008);
+    }
+  }
+
+  if(millis() - ws_stats_time >= WS_STATS_PERIOD)
+  {
+    ws_stats_time = millis();
+    for(size_t i = 0; i < WS_MAX_CLIENTS; i++) {
+      ws_clients[i].bytesPerMinute = ws_clients[i].bytes;
+      ws_clients[i].bytes = 0;
+    }
+  }
+
+  Profile_End(ws_loop, 5);
+}
+
+void ws_write_status(Print &out)
+{
+  bool first = true;
+  out.print('[');
+  for(size_t i = 0; i < WS_MAX_CLIENTS; i++)
+  {
+    WsClient *entry = &ws_clients[i];
+    if(entry->used)
+    {
+      AsyncWebSocketClient *client = ws.client(entry->id);
+      out.printf_P(PSTR("%s{\"id\":%u,\"full\":%s,\"pending\":%u,\"coalesced\":%u,\"dropped\":%u,\"bytes_per_min\":%u}"),
+                   first ? "" : ",", entry->id,
+                   client && client->queueIsFull() ? "true" : "false",
+                   __builtin_popcount(entry->pending),
+                   entry->coalesced, entry->dropped, entry->bytesPerMinute);
+      first = false;
+    }
+  }
+  out.print(']');
+}
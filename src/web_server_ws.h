@@ -0,0 +1,66 @@
+#ifndef _EMONESP_WEB_SERVER_WS_H
+#define _EMONESP_WEB_SERVER_WS_H
+
+// -------------------------------------------------------------------
+// WebSocket state stream
+//
+// Clients are sent a snapshot of the current state when they connect and
+// after that only the fields that have changed since they were last sent.
+// -------------------------------------------------------------------
+
+#include <Hash.h>
+#include <ESPAsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+
+// Max number of WebSocket clients, any more are turned away
+#ifndef WS_MAX_CLIENTS
+#define WS_MAX_CLIENTS            4
+#endif
+
+// Number of fields for which the last sent value is remembered
+#ifndef WS_STATE_FIELDS
+#define WS_STATE_FIELDS           32
+#endif
+
+#ifndef WS_STATE_KEY_LEN
+#define WS_STATE_KEY_LEN          15
+#endif
+
+// Values that serialise to more than this are always sent
+#ifndef WS_STATE_VALUE_LEN
+#define WS_STATE_VALUE_LEN        23
+#endif
+
+// Minimum change before a noisy value is sent again, 0 to send every change
+#ifndef WS_DEADBAND_SRSSI
+#define WS_DEADBAND_SRSSI         3
+#endif
+
+#ifndef WS_DEADBAND_FREERAM
+#define WS_DEADBAND_FREERAM       1024
+#endif
+
+// How long a client's send queue may stay full before it is disconnected
+#ifndef WS_CLIENT_STALL_TIMEOUT
+#define WS_CLIENT_STALL_TIMEOUT   (30 * 1000)
+#endif
+
+extern AsyncWebSocket ws;
+
+extern void ws_setup();
+extern void ws_loop();
+
+// Send the fields of the event that have changed to all clients
+extern void ws_event(JsonDocument &event);
+
+// Write the per client queue and traffic stats as a JSON array
+extern void ws_write_status(Print &out);
+
+// Total bytes sent to all WebSocket clients
+extern uint32_t ws_bytes_sent;
+
+// Clients disconnected for not keeping up
+extern uint32_t ws_clients_closed;
+
+#endif // _EMONESP_WEB_SERVER_WS_H
@@ -1,2 +1,31 @@
-static const char CONTENT_ASSETS_JS[] PROGMEM = 
-  "!function(r){var n={};function o(e){if(n[e])return n[e].exports;var t=n[e]={i:e,l:!1,exports:{}};return r[e].call(t.exports,t,t.exports,o),t.l=!0,t.exports}o.m=r,o.c=n,o.d=function(e,t,r){o.o(e,t)||Object.defineProperty(e,t,{enumerable:!0,get:r})},o.r=function(e){\"undefined\"!=typeof Symbol&&Symbol.toStringTag&&Object.defineProperty(e,Symbol.toStringTag,{value:\"Module\"}),Object.defineProperty(e,\"__esModule\",{value:!0})},o.t=function(t,e){if(1&e&&(t=o(t)),8&e)return t;if(4&e&&\"object\"==typeof t&&t&&t.__esModule)return t;var r=Object.create(null);if(o.r(r),Object.defineProperty(r,\"default\",{enumerable:!0,value:t}),2&e&&\"string\"!=typeof t)for(var n in t)o.d(r,n,function(e){return t[e]}.bind(null,n));return r},o.n=function(e){var t=e&&e.__esModule?function(){return e.default}:function(){return e};return o.d(t,\"a\",t),t},o.o=function(e,t){return Object.prototype.hasOwnProperty.call(e,t)},o.p=\"\",o(o.s=0)}([function(e,t,r){\"use strict\";r.r(t);r(1)},function(e,t,r){}]);\n";
+static const char CONTENT_ASSETS_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x75, 0x53, 0xdb, 0x8a, 0xdb, 0x30, 
+  0x10, 0x7d, 0xef, 0x57, 0xd8, 0x7a, 0x30, 0x12, 0x08, 0x91, 0x94, 0x3e, 0x14, 0x1b, 0xb1, 0x5f, 
+  0xb0, 0x6c, 0x61, 0xfb, 0xb6, 0x2c, 0x8b, 0x63, 0x4f, 0x52, 0x17, 0x45, 0x32, 0xf2, 0xb8, 0x6d, 
+  0xf0, 0xea, 0xdf, 0x3b, 0xf2, 0x35, 0x9b, 0x36, 0x60, 0x62, 0x65, 0x34, 0x67, 0xe6, 0xcc, 0x99, 
+  0xe3, 0xf4, 0xd8, 0xdb, 0x0a, 0x1b, 0x67, 0xb9, 0x17, 0xc3, 0xaf, 0xd2, 0x27, 0x56, 0x0f, 0xa1, 
+  0x58, 0x82, 0x89, 0xe3, 0x20, 0x86, 0xe6, 0xc8, 0xed, 0x0b, 0xbc, 0x0a, 0x0f, 0xd8, 0x7b, 0x9b, 
+  0xc4, 0xb3, 0x82, 0x3f, 0xad, 0xf3, 0xd8, 0x15, 0x11, 0x82, 0x3a, 0x86, 0xf4, 0xd0, 0xe4, 0x20, 
+  0x4d, 0x9e, 0xee, 0xe5, 0x7c, 0x99, 0x0f, 0x21, 0x14, 0x33, 0xc8, 0x47, 0x50, 0x55, 0x1a, 0xc3, 
+  0x71, 0xc1, 0x4a, 0x94, 0xdb, 0xd9, 0x09, 0xfa, 0x63, 0x74, 0xba, 0xdb, 0x62, 0xc1, 0xa9, 0xb3, 
+  0xf6, 0xd2, 0xa9, 0x4a, 0x5b, 0xfa, 0xad, 0xf5, 0x4a, 0x15, 0x08, 0x4a, 0x74, 0x9d, 0x72, 0xf1, 
+  0x28, 0xde, 0xdf, 0x9f, 0x0e, 0x3f, 0xa1, 0x42, 0x55, 0xc3, 0xb1, 0xb1, 0xf0, 0xcd, 0xbb, 0x16, 
+  0x3c, 0x5e, 0xc6, 0xb4, 0x01, 0x6c, 0x7f, 0x06, 0x5f, 0x1e, 0x0c, 0xe4, 0x54, 0xfc, 0x04, 0x98, 
+  0xfb, 0x20, 0x02, 0xd5, 0xf3, 0x57, 0xf5, 0xc4, 0xc0, 0x7a, 0x3b, 0xa1, 0x6b, 0x96, 0x6a, 0xbc, 
+  0xb4, 0xe0, 0x8e, 0xc9, 0xf3, 0xe5, 0x7c, 0x70, 0x26, 0xcb, 0xa6, 0xb7, 0x42, 0xf7, 0x8c, 0xbe, 
+  0xb1, 0xa7, 0xef, 0xe5, 0x29, 0xcb, 0xee, 0x75, 0xfc, 0x37, 0x57, 0x92, 0xac, 0xa6, 0x87, 0x9c, 
+  0x3d, 0xba, 0xba, 0x37, 0xc0, 0x82, 0x90, 0xf7, 0xc0, 0xec, 0xed, 0x0d, 0xba, 0x39, 0x6d, 0x81, 
+  0xa5, 0xbb, 0x89, 0x2e, 0x6e, 0x74, 0x51, 0x4e, 0x4b, 0xd9, 0x67, 0x90, 0x65, 0x1c, 0xb5, 0xe3, 
+  0x28, 0x84, 0xfc, 0x9a, 0xc1, 0xb2, 0x21, 0x2c, 0xe8, 0xf6, 0x4b, 0xbc, 0x65, 0x6e, 0x6c, 0xc5, 
+  0xf4, 0x32, 0x13, 0x66, 0x59, 0x7c, 0xd4, 0xd6, 0x69, 0x03, 0xc5, 0x5d, 0x7a, 0x3d, 0x93, 0xab, 
+  0x3c, 0x94, 0x08, 0xdc, 0xf6, 0xc6, 0x88, 0x58, 0x8e, 0x04, 0x23, 0x8b, 0xdc, 0xa1, 0xee, 0x25, 
+  0xa3, 0x48, 0xd9, 0x1b, 0x64, 0xb7, 0x8a, 0x4f, 0x53, 0x20, 0x4d, 0xfd, 0x79, 0x24, 0xd4, 0x8d, 
+  0xba, 0x6c, 0x22, 0xa3, 0x38, 0x3a, 0xcf, 0x47, 0xe7, 0x25, 0x0d, 0xb1, 0x10, 0xb4, 0x69, 0xaa, 
+  0x67, 0xe5, 0xf5, 0x76, 0x16, 0x8a, 0x64, 0xa2, 0xa0, 0x0e, 0x8d, 0xad, 0x47, 0x5e, 0xd2, 0x0a, 
+  0xb1, 0xfa, 0x2b, 0x6a, 0x64, 0x3f, 0xac, 0x74, 0xb2, 0x26, 0xf5, 0x84, 0xab, 0x69, 0x1f, 0xd6, 
+  0x8c, 0xb5, 0x2a, 0xa8, 0x99, 0x7b, 0xc8, 0xff, 0x73, 0xb9, 0x3a, 0x38, 0xf2, 0x42, 0xc9, 0x4a, 
+  0x46, 0x8e, 0x93, 0x18, 0xdb, 0xb9, 0x0f, 0x8e, 0x5c, 0x21, 0xb3, 0x44, 0xad, 0x77, 0xe8, 0xe2, 
+  0x90, 0xea, 0x47, 0xd9, 0x3d, 0xfd, 0xb6, 0x8b, 0x58, 0xd3, 0x57, 0x10, 0x01, 0xb1, 0x46, 0xab, 
+  0x19, 0x93, 0x8e, 0xd4, 0xed, 0xf4, 0x4e, 0x04, 0xfe, 0x72, 0xeb, 0x71, 0xd6, 0x77, 0x90, 0x44, 
+  0xcd, 0x68, 0x89, 0x85, 0xa7, 0x1d, 0x20, 0x8d, 0xcc, 0xf7, 0x84, 0xbd, 0xcd, 0x0c, 0xaf, 0xa2, 
+  0xf8, 0xf4, 0x17, 0x5c, 0xbb, 0x1d, 0xef, 0xcf, 0x03, 0x00, 0x00, 0x00 };
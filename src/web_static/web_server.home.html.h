@@ -1,48 +1,511 @@
-static const char CONTENT_HOME_HTML[] PROGMEM = 
-  "<!doctype html> <html lang=\"en\"> <head> <meta charset=\"utf-8\"> <title>OpenEVSE</title> <meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"> <meta name=\"viewport\" content=\"width=device-width,user-scalable=no\"> <meta name=\"description\" content=\"OpenEVSE\"> <meta name=\"author\" content=\"OpenEVSE\"> <meta name=\"theme-color\" content=\"#000000\"> <link rel=\"stylesheet\" type=\"text/css\" href=\"style.css\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-32x32.png\" sizes=\"32x32\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-16x16.png\" sizes=\"16x16\"> </head> <body> <div id=\"page\"> <div class=\"header\"> <h1>Open<span>EVSE</span></h1> <h3>WiFi</h3> </div> <div class=\"container\" data-bind=\"visible: !initialised()\"> Loading, please wait... (<span data-bind=\"text: itemsLoaded\"></span>/<span data-bind=\"text: itemsTotal\"></span>) </div> <div class=\"container\" data-bind=\"visible: initialised\" style=\"display: none\"> <div class=\"tabs\"> <input id=\"tab-3\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"status\"> <label for=\"tab-3\">OpenEVSE</label> <input id=\"tab-1\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"system\"> <label for=\"tab-1\">System</label> <input id=\"tab-2\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"services\"> <label for=\"tab-2\">Services</label> <input id=\"tab-4\" type=\"radio\" name=\"tab-group\" data-bind=\"checked: tab\" value=\"rapi\"> <label for=\"tab-4\" data-bind=\"visible: developerMode() &amp;&amp; status.rapi_connected()\">RAPI</label> </div> <div id=\"content\"> <div id=\"content-1\" data-bind=\"visible: isSystem\"> <div class=\"box380 left\"> <h2>WiFi Setup</h2> <p><b>Mode:</b> <span id=\"mode\" data-bind=\"text: status.fullMode\"></span></p> <div id=\"wired-view\" data-bind=\"visible: status.isWired\"> <p><b>IP Address:</b><br><a data-bind=\"text: status.ipaddress, attr: {href: 'http://'+status.ipaddress()}\"></a></p> <p> <b>Successful packets:</b><br> <span data-bind=\"text: status.packets_success\"></span> of <span data-bind=\"text: status.packets_sent\"></span> </p> <p><b>OpenEVSE</b></p> <p><b>RAPI packets:</b><br><span data-bind=\"text: status.comm_success\"></span> of <span data-bind=\"text: status.comm_sent\"></span></p> </div> <div id=\"client-view\" data-bind=\"visible: !wifi.canConfigure() &amp;&amp; !wifi.wifiConnecting() &amp;&amp; !status.isWired()\"> <table> <tr> <th>Network</th> <th>RSSI dBm</th> </tr> <tbody id=\"sta-ssid\"> <tr data-bind=\"click: function () { wifi.forceConfig(true); }\"> <td data-bind=\"text: config.ssid\"></td> <td data-bind=\"text: status.srssi\"></td> </tr> </tbody> </table> <button data-bind=\"click: function () { wifi.forceConfig(true); }\">Change WiFi network</button> <p><b>IP Address:</b><br><a data-bind=\"text: status.ipaddress, attr: {href: 'http://'+status.ipaddress()}\"></a></p> <p> <b>Successful packets:</b><br> <span data-bind=\"text: status.packets_success\"></span> of <span data-bind=\"text: status.packets_sent\"></span> </p> <p><b>OpenEVSE</b></p> <p><b>RAPI packets:</b><br><span data-bind=\"text: status.comm_success\"></span> of <span data-bind=\"text: status.comm_sent\"></span></p> <button id=\"apoff\" data-bind=\"visible: status.isWifiAccessPoint, click: wifi.turnOffAccessPoint, disable: wifi.turnOffAccessPointFetching\">Turn off Access Point</button> </div> <div id=\"ap-view\" data-bind=\"visible: wifi.canConfigure() &amp;&amp; !wifi.wifiConnecting() &amp;&amp; !status.isWired()\"> <p>Connect to network:</p> <div id=\"wifiList\"> <ul class=\"list-group\" data-bind=\"foreach: scan.filteredResults, visible: 0 != scan.results().length\"> <li class=\"list-group-item\" data-bind=\"click: $root.wifi.select, css: { active: $root.wifi.selectedNet() === $data }\"> <span data-bind=\"text: ssid\"></span> <img width=\"24px\" height=\"24px\" data-bind=\"attr:{src: 'wifi_signal_'+strength()+'.svg'}\"> </li> </ul> </div> <div data-bind=\"visible: 0 == scan.results().length\"> Scanning... </div> <p> <b>SSID:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.ssid\"> </p> <p> <b>Passkey:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: wifiPassword.value, attr: { type: wifiPassword.show() ? 'text' : 'password' }\"><br> </p><div> <input id=\"wifipassword\" type=\"checkbox\" data-bind=\"checked: wifiPassword.show\"> <label for=\"wifipassword\">Show password</label> </div> <p></p> <p> <button data-bind=\"click: wifi.saveNetwork, text: (wifi.saveNetworkFetching() ? 'Saving' : (wifi.saveNetworkSuccess() ? 'Saved' : 'Connect')), disable: wifi.saveNetworkFetching\">Connect</button> </p> </div> <div data-bind=\"visible: wifi.wifiConnecting\"> <p>Connecting to WIFI Network...</p> </div> </div> <div class=\"box380 right\"> <h2>Administration</h2> <p> <b>Username:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.www_username\" pattern=\".{15}\" title=\"The field requires 15 characters\" maxlength=\"15\" required=\"\"> <span class=\"small-text validMessage\">15 characters max</span> </p> <p> <b>Password:</b><br> <input type=\"password\" autocapitalize=\"none\" data-bind=\"textInput: wwwPassword.value, attr: { type: wwwPassword.show() ? 'text' : 'password' }\" pattern=\".{15}\" title=\"The field requires 15 characters\" maxlength=\"15\" required=\"\"><br> <span> <input id=\"wwwPassword\" type=\"checkbox\" data-bind=\"checked: wwwPassword.show\"> <label for=\"wwwPassword\">Show password</label> </span><br> <span class=\"small-text validMessage\">15 characters max</span><br> <span class=\"small-text\">Web interface HTTP authentication.</span><br><br> <button data-bind=\"click: saveAdmin, text: (saveAdminFetching() ? 'Saving' : (saveAdminSuccess() ? 'Saved' : 'Save')), disable: saveAdminFetching\">Save</button> </p> </div> <div class=\"box380 right\"> <h2>WiFi Firmware</h2> <p><b>Version: </b><span data-bind=\"text: config.version\"></span></p> <div data-bind=\"visible: !updateFetching() && !updateComplete()\"> <form action=\"#\" method=\"post\" enctype=\"multipart/form-data\" id=\"upload_form\" data-bind=\"submit: otaUpdate\"> <input type=\"file\" name=\"update\" data-bind=\"value: updateFilename\"> <button data-bind=\"click: otaUpdate, text: (updateFetching() ? 'Updating...' : 'Update'), disable: ('' == updateFilename())\">Update</button> </form> </div> <div data-bind=\"visible: (updateError() !== '')\" class=\"box error\"> <h4>Error:</h4> <span data-bind=\"text: updateError\"></span> </div> <div data-bind=\"visible: updateFetching() && !updateComplete()\"> Updating... <br> <div id=\"progressBack\"> <div id=\"progressBar\" data-bind=\"style: { width: updateProgress()+'%' }\"></div> </div> </div> <div data-bind=\"visible: updateComplete\"> Firmware update completed ok </div> <p> <button data-bind=\"click: restart, text: (restartFetching() ? 'Restarting...' : 'Restart'), disable: restartFetching\">Restart</button> <button data-bind=\"click: factoryReset, text: (factoryResetFetching() ? 'Resetting...' : 'Factory Reset'), disable: factoryResetFetching\">Factory Reset</button> </p> </div> <div class=\"box380 left\" data-bind=\"visible: advancedMode()\"> <h2>Advanced Settings</h2> <p data-bind=\"visible: false !== config.hostname()\"> <b>Hostname:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.hostname\" pattern=\".{31}\" title=\"The field max 31 characters\" maxlength=\"31\" required=\"\"> <span class=\"small-text validMessage\">31 characters max</span> </p> <p data-bind=\"visible: false !== config.sntp_hostname()\"> <b>NTP Server:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.sntp_hostname\" pattern=\".{31}\"> </p> <p> <button data-bind=\"click: advancedGroup.save, text: (advancedGroup.fetching() ? 'Saving' : (advancedGroup.success() ? 'Saved' : 'Save')), disable: advancedGroup.fetching\">Save</button> </p> </div> <div class=\"box380 left\"> <h2>Developer Mode</h2> <div> <b>Enabled: </b> <label class=\"switch\"> <input type=\"checkbox\" data-bind=\"checked: developerMode\"> <div class=\"slider round\"></div> </label> </div> </div> </div> <div id=\"content-2\" data-bind=\"visible: isServices\"> <div class=\"box380 left\"> <h2>&nbsp; Energy Monitoring <img src=\"data:image/png;base64,R0lGODlhAQABAAD/ACwAAAAAAQABAAACADs=\" data-src=\"emoncms.jpg\" align=\"left\"></h2> <p> <input type=\"checkbox\" id=\"emoncms_enabled\" data-bind=\"checked: config.emoncms_enabled\"> <label for=\"emoncms_enabled\"><b>Enable Emoncms</b></label> </p> <div data-bind=\"visible: config.emoncms_enabled\"> <div><b>Emoncms Server*:</b></div> <div data-bind=\"css: { protocol: config.http_supported_protocols().length > 0 }\"> <select data-bind=\"visible: config.http_supported_protocols().length > 0,\n"
-  "                  options: config.http_supported_protocols,\n"
-  "                  optionsText: function(item) {\n"
-  "                    return item + '://'\n"
-  "                  },\n"
-  "                  value: emoncms_protocol\"></select> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: emoncms_server\"> </div> <div class=\"small-text\">e.g: <a href=\"https://data.openevse.com/emoncms\">data.openevse.com/emoncms</a>, <a href=\"https://emoncms.org\">emoncms.org</a>, <a href=\"http://emonpi/emoncms\">emonpi/emoncms</a> </div> </div> <p data-bind=\"visible: config.emoncms_enabled\"> <b>Emoncms Node*:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.emoncms_node\"> </p> <p data-bind=\"visible: config.emoncms_enabled\"> <b>Emoncms write-apikey*:</b><br> <input type=\"password\" autocapitalize=\"none\" data-bind=\"textInput: emoncmsApiKey.value, attr: { type: emoncmsApiKey.show() ? 'text' : 'password' }\"><br> <span> <input id=\"emoncmsApiKey\" type=\"checkbox\" data-bind=\"checked: emoncmsApiKey.show\"> <label for=\"emoncmsApiKey\">Show password</label> </span> </p> <p data-bind=\"visible: config.emoncms_enabled && config.http_supported_protocols().length === 0\"> <b>Emoncms SSL SHA-1 Fingerprint (optional):</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.emoncms_fingerprint\"><br> <br><span class=\"small-text\">HTTPS will be enabled if present e.g:</span> <span class=\"small-text\"> 7D:82:15:BE:D7:BC:72:58:87:7D:8E:40:D4:80:BA:1A:9F:8B:8D:DA </span> </p> <p> <button data-bind=\"click: saveEmonCms, text: (saveEmonCmsFetching() ? 'Saving' : (saveEmonCmsSuccess() ? 'Saved' : 'Save')), disable: saveEmonCmsFetching\">Save</button> <span data-bind=\"visible: config.emoncms_enabled\"><b>&nbsp; Connected:&nbsp;<span data-bind=\"text: 1 === status.emoncms_connected() ? 'Yes' : 'No'\"></span></b></span> <span data-bind=\"visible: config.emoncms_enabled() &amp;&amp; 1 === status.emoncms_connected()\"><b>&nbsp; Successful posts:&nbsp;<span data-bind=\"text: status.packets_success\"></span></b></span> </p> <p data-bind=\"visible: config.emoncms_enabled() &amp;&amp; 0 === status.emoncms_connected() &amp;&amp; false !== status.emoncms_message(), text: status.emoncms_message\"></p> </div> <div class=\"box380 right\"> <h2>MQTT</h2> <p> <input type=\"checkbox\" id=\"mqtt_enabled\" data-bind=\"checked: config.mqtt_enabled\"> <label for=\"mqtt_enabled\"><b>Enable MQTT</b></label> <span class=\"info\" data-bind=\"click: toggle.bind($data, showMqttInfo)\"></span> </p> <div class=\"box\" data-bind=\"visible: showMqttInfo\"> <div> Status published to:<br> <span class=\"small-text\">{base-topic}/{status} value</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/amp 16</span><br> </div> <p> RAPI control subscribes to:<br> <span class=\"small-text\">{base-topic}/rapi/in/{command} value</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/rapi/in/$SC 16</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/rapi/in/$GC</span><br> </p> <p> RAPI response published to:<br> <span class=\"small-text\">{base-topic}/rapi/out response</span><br> <span class=\"small-text\">e.g. <span data-bind=\"text: '' !== config.mqtt_topic() ? config.mqtt_topic() : 'openevse'\"></span>/rapi/out $OK 6 32</span><br> </p> </div> <div data-bind=\"visible: config.mqtt_enabled\"> <b>Host*:</b><br> <div data-bind=\"css: { protocol: config.mqtt_supported_protocols().length > 0 }\"> <select data-bind=\"visible: config.mqtt_protocol_enable,\n"
-  "                                    options: config.mqtt_supported_protocols,\n"
-  "                                    optionsText: function(item) {\n"
-  "                                      return item + '://'\n"
-  "                                    },\n"
-  "                                    value: config.mqtt_protocol\"></select> <input data-bind=\"textInput: config.mqtt_server\" type=\"text\" autocapitalize=\"none\"><br> <span class=\"small-text\">e.g 'emonpi', 'test.mosquitto.org', '192.168.1.4'</span> </div> </div> <p data-bind=\"visible: config.mqtt_enabled() &amp;&amp; config.mqtt_port_enable()\"> <b>Port*:</b><br> <input data-bind=\"textInput: config.mqtt_port\" type=\"number\" autocapitalize=\"none\"><br> </p> <div data-bind=\"visible: config.mqtt_enabled() &amp;&amp; config.mqtt_reject_unauthorized_enable() &amp;&amp; advancedMode()\"> <b>Reject self-signed certificates:</b> <label class=\"switch\"> <input type=\"checkbox\" data-bind=\"checked: config.mqtt_reject_unauthorized\"> <div class=\"slider round\"></div> </label> </div> <div data-bind=\"visible: config.mqtt_enabled() &amp;&amp; !config.mqtt_reject_unauthorized()\" class=\"box warning\" style=\"margin-top: 20px;\"> <h4>Warning!!</h4> Certificate validation is disabled, although the connection to MQTT server will be encrypted the connection is still vulnerable to man-in-the-middle attacks. </div> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Username:</b><span> blank - no authentication</span> <input data-bind=\"textInput: config.mqtt_user\" type=\"text\" autocapitalize=\"none\"> </p> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Password:</b><span> blank - no authentication</span> <input type=\"password\" autocapitalize=\"none\" data-bind=\"textInput: mqttPassword.value, attr: { type: mqttPassword.show() ? 'text' : 'password' }\"><br> <span> <input id=\"mqttPassword\" type=\"checkbox\" data-bind=\"checked: mqttPassword.show\"> <label for=\"mqttPassword\">Show password</label> </span> </p> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Base-topic*:</b><br> <input data-bind=\"textInput: config.mqtt_topic\" type=\"text\" autocapitalize=\"none\"><br> <span class=\"small-text\">e.g 'openevse'</span> </p> <p data-bind=\"visible: config.mqtt_enabled\"> <b>Voltage topic:</b> <input data-bind=\"textInput: config.mqtt_vrms\" type=\"text\" autocapitalize=\"none\" hint=\"emon/emonpi/vrms\"><br> <span class=\"small-text\">Voltage MQTT topic to improve power calculations </span></p> <p> <button data-bind=\"click: mqttGroup.save, text: (mqttGroup.fetching() ? 'Saving' : (mqttGroup.success() ? 'Saved' : 'Save')), disable: mqttGroup.fetching\">Save</button> <span data-bind=\"visible: config.mqtt_enabled\"><b>&nbsp; Connected:&nbsp;<span data-bind=\"text: 1 === status.mqtt_connected() ? 'Yes' : 'No'\"></span></b></span> </p> </div> <div class=\"box380 left\"> <h2>&nbsp; OhmConnect <img src=\"data:image/png;base64,R0lGODlhAQABAAD/ACwAAAAAAQABAAACADs=\" data-src=\"ohm.jpg\" align=\"left\"></h2> <p> <input type=\"checkbox\" id=\"ohm_enabled\" data-bind=\"checked: config.ohm_enabled\"> <label for=\"ohm_enabled\"><b>Enable OhmConnect</b></label> <a href=\"https://ohm.co/openevse\" rel=\"nofollow\">Click Here to Join</a> </p> <p data-bind=\"visible: config.ohm_enabled\"> OhmConnect monitors real-time conditions on the electricity grid. When dirty and unsustainable power plants turn on, our users receive a notification to save energy. </p> <p data-bind=\"visible: config.ohm_enabled\"> <b>Ohm Hour:</b> <span data-bind=\"text: status.ohm_hour\"></span> </p> <p data-bind=\"visible: config.ohm_enabled\"> <b>Ohm key:</b><br> <input data-bind=\"textInput: config.ohmkey\" type=\"text\" autocapitalize=\"none\"> </p> <p data-bind=\"visible: config.ohm_enabled\"> <strong>USA - California only</strong> </p> <div style=\"padding:56.25% 0 0 0;position:relative;\"><iframe src=\"https://player.vimeo.com/video/119419875\" style=\"position:absolute;top:0;left:0;width:100%;height:100%;\" frameborder=\"0\" webkitallowfullscreen mozallowfullscreen allowfullscreen></iframe></div><script src=\"https://player.vimeo.com/api/player.js\"></script> <p data-bind=\"visible: config.ohm_enabled\"> Ohm Key can be obtained by logging in to OhmConnect, enter Settings and locate the link in \"Open Source Projects\"<br> Example: https://login.ohmconnect.com/verify-ohm-hour/OpnEoVse<br> <b>Key: </b>OpnEoVse </p> <p> <button data-bind=\"click: saveOhmKey, text: (saveOhmKeyFetching() ? 'Saving' : (saveOhmKeySuccess() ? 'Saved' : 'Save')), disable: saveOhmKeyFetching\">Save</button> </p> </div> <div class=\"box380 right\"> <h2>Solar PV divert</h2> <p data-bind=\"visible: config.mqtt_enabled\"> <input type=\"checkbox\" id=\"divert_enabled\" data-bind=\"checked: config.divert_enabled\"> <label for=\"divert_enabled\"><b>Enable Solar PV Divert</b></label> <span class=\"info\" data-bind=\"click: toggle.bind($data, showSolarDivert)\"></span> </p> <div class=\"box error\" data-bind=\"visible: !config.mqtt_enabled()\"> <h4>MQTT not enabled.</h4> Solar PV Divert requires an SolarPV-gen or Grid (+I/-E) feed to be delivered via MQTT. </div> <div class=\"box\" data-bind=\"visible: showSolarDivert()\"> <div>Dynamically adjust charge rate based on solar PV generation or excess power (grid export).</div> <p> </p><ul> <li><span class=\"small-text\">If only solar PV feed available: charge rate is modulated based on <b>solar PV generation.</b></span></li> <li><span class=\"small-text\">If grid +I/-E (positive Import / negative Export) feed is available: charge rate will be modulated by available <b>excess power.</b></span></li> <li><span class=\"small-text\">If EVSE is sleeping: charging will begin when solar PV / excess power > min charge rate.</span></li> <li><span class=\"small-text\">Charging will pause if the excess power drops below the nim charge rate for a period of time.</span></li> </ul> <span class=\"small-text\"><i>Note: It's assumed that EVSE power is included in the grid feed</i></span><br> <p></p> </div> <p data-bind=\"visible: config.divert_enabled() &amp;&amp; config.mqtt_enabled()\"> <br> <span data-bind=\"visible: divertFeedType() === 'solar'\"><b>Solar:</b></span> <span data-bind=\"visible: divertFeedType() === 'grid_ie'\"><b>Grid Import/Export:</b></span> <span data-bind=\"text: divertFeedType() === 'grid_ie' ? status.grid_ie() : status.solar()\"></span>W - <span data-bind=\"text: formatUpdate(openevse.time.divert_update()), css: updateClass(openevse.time.divert_update())\"></span> <span data-bind=\"visible: ecoMode\"> | <b>Charge rate:</b> <span data-bind=\"text: status.charge_rate\"></span>A</span> </p> <div data-bind=\"visible: config.divert_enabled() &amp;&amp; config.mqtt_enabled()\"> <b>Feed*:</b><br> <div class=\"divert\"> <select data-bind=\"value: divertFeedType\"> <option value=\"solar\">SolarPV-gen</option> <option value=\"grid_ie\">Grid (+I/-E)</option> </select> <input data-bind=\"textInput: divertFeedValue\" type=\"text\" autocapitalize=\"none\"><br> <span data-bind=\"visible: divertFeedType() === 'solar'\" class=\"small-text\">Solar PV MQTT topic to modulate charge rate based on solar</span> <span data-bind=\"visible: divertFeedType() === 'grid_ie'\" class=\"small-text\">Grid (+I/-E) MQTT topic to modulate charge rate based on <b>excess power</b></span> </div> </div> <p data-bind=\"visible: advancedMode() &amp;&amp; config.divert_enabled() &amp;&amp; config.mqtt_enabled()\"> <b>Divert smoothing attack:</b><br> <input data-bind=\"textInput: config.divert_attack_smoothing_factor\" type=\"number\" autocapitalize=\"none\" hint=\"0.4\" min=\"0\" max=\"1\" step=\"0.01\"><br> <span class=\"small-text\">The amount of the new feed value to add to the divert available power rolling average </span> </p> <p data-bind=\"visible: advancedMode() &amp;&amp; config.divert_enabled() &amp;&amp; config.mqtt_enabled()\"> <b>Divert smoothing decay:</b><br> <input data-bind=\"textInput: config.divert_decay_smoothing_factor\" type=\"number\" autocapitalize=\"none\" hint=\"0.05\" min=\"0\" max=\"1\" step=\"0.01\"><br> <span class=\"small-text\">The amount of the new feed value to remove to the divert available power rolling average </span> </p> <p data-bind=\"visible: advancedMode() &amp;&amp; config.divert_enabled() &amp;&amp; config.mqtt_enabled()\"> <b>Minimum charge time:</b><br> <input data-bind=\"textInput: config.divert_min_charge_time\" type=\"number\" autocapitalize=\"none\" hint=\"600\" min=\"0\" max=\"100000\" step=\"10\"><br> <span class=\"small-text\">The minimum amount of time (seconds) to charge the car once enabled via the Solar PV divert. This can help minimise wear and tear on the EVSE.</span> </p> <p data-bind=\"visible: isEcoModeAvailable\"> <button data-bind=\"click: divertGroup.save, text: (divertGroup.fetching() ? 'Saving' : (divertGroup.success() ? 'Saved' : 'Save')), disable: divertGroup.fetching\">Save</button> </p> </div> </div> <div id=\"content-3\" data-bind=\"visible: isStatus\"> <div data-bind=\"visible: openevse.isError\" class=\"box box-full left error\"> <h4>EVSE Error</h4> <span data-bind=\"text: status.estate\"></span> </div> <div data-bind=\"visible: !status.rapi_connected()\" class=\"box box-full left error\"> <h4>EVSE Error</h4> <span>OpenEVSE not responding or not connected</span> </div> <div data-bind=\"visible: !openevse.isError() &amp;&amp; status.rapi_connected(),\n"
-  "                          css: { ready: openevse.isReady(),\n"
-  "                                 connected: openevse.isConnected() &amp;&amp; !openevse.isCharging(),\n"
-  "                                 charging: openevse.isCharging(),\n"
-  "                                 sleeping: openevse.isSleeping() }\" class=\"box box-full left\"> <h2 class=\"left\">Session Status</h2> <h2 class=\"right\" data-bind=\"text: status.estate\"></h2> <table> <tr> <th>Current</th> <th>Energy</th> <th>Temp</th> <th>Elapsed</th> </tr> <tr> <td><span data-bind=\"text: scaleString(status.amp(), 1000, 2) + ' A'\"></span></td> <td><span data-bind=\"text: scaleString(status.wattsec(), 3600000, 2) + ' kWh'\"></span></td> <td><span data-bind=\"text: scaleString(status.temp1(), 10, 1) + ' &deg;C'\"></span></td> <td><span data-bind=\"text: openevse.time.elapsed\"></span></td> </tr> </table> <div data-bind=\"visible: ecoMode() &amp;&amp; isEcoModeAvailable()\"> <br> <span data-bind=\"visible: haveSolar\"><b>Solar:</b></span> <span data-bind=\"visible: haveGridIe\"><b>Grid Import/Export:</b></span> <span data-bind=\"text: haveGridIe() ? status.grid_ie() : status.solar()\"></span>W - <span data-bind=\"text: formatUpdate(openevse.time.divert_update()), css: updateClass(openevse.time.divert_update())\"></span> | <span data-bind=\"visible: openevse.isReady()\"><b>Vehicle not connected</b></span> <span data-bind=\"visible: openevse.isSleeping() || (openevse.isConnected() &amp;&amp; !openevse.isCharging())\"><b>Waiting for solar</b></span> <span data-bind=\"visible: openevse.isCharging()\"><b>Charging from solar</b></span> <span data-bind=\"visible: openevse.isCharging()\"> | <b>Charge rate:</b> <span data-bind=\"text: status.charge_rate\"></span>A </span> <span data-bind=\"visible: advancedMode\"> <br> <b>Voltage:</b> <span data-bind=\"text: status.voltage\"></span>V <span data-bind=\"visible: status.available_current() !== false\">| <b>Available Current:</b> <span data-bind=\"text: status.available_current\"></span>A</span> <span data-bind=\"visible: status.smoothed_available_current() !== false\">| <b>Smoothed Current:</b> <span data-bind=\"text: status.smoothed_available_current\"></span>A</span> </span> </div> </div> <div class=\"box380 left\" data-bind=\"visible: status.rapi_connected\"> <h2>Charge Options</h2> <div data-bind=\"visible: isEcoModeAvailable\"> <span data-bind=\"css: {selected: !ecoMode() }\">Normal (fast)</span> <label class=\"switch\"> <input type=\"checkbox\" data-bind=\"checked: ecoMode\"> <div class=\"slider round\"></div> </label> <span data-bind=\"css: {selected: ecoMode }\">Eco (PV divert)</span><br> </div> <p data-bind=\"with: openevse, visible: !openevse.isError() &amp;&amp; !ecoMode()\"> <button data-bind=\"click: setStatus.bind($data, 'enable'), visible: !isEnabled()\">Start</button> <button data-bind=\"click: setStatus.bind($data, 'sleep'), visible: !isSleeping()\">Pause</button> </p> <span data-bind=\"with: openevse, visible: !openevse.isError() &amp;&amp; !ecoMode()\"> <hr \\> <p> <b>Time limit:</b><br \\> <select data-bind=\"options: timeLimits,\n"
-  "                optionsText: 'name',\n"
-  "                optionsValue: 'value',\n"
-  "                value: timeLimit,\n"
-  "                enable: !updatingTimeLimit() &amp;&amp; isConnected(),\n"
-  "                css: { saved: savedTimeLimit }\"></select> </p> <p> <b>Energy limit:</b><br \\> <select type=\"text\" data-bind=\"options: chargeLimits,\n"
-  "                optionsText: 'name',\n"
-  "                optionsValue: 'value',\n"
-  "                value: chargeLimit,\n"
-  "                enable: !updatingChargeLimit() &amp;&amp; isConnected(),\n"
-  "                css: { saved: savedChargeLimit }\"></select> </p> </span> <hr> <br> <div data-bind=\"with: openevse\"> <b>Timer:</b><br> Start: <input type=\"time\" data-bind=\"value: delayTimerStart, disable: isError\"> &nbsp;&nbsp; Stop: <input type=\"time\" data-bind=\"value: delayTimerStop, disable: isError\"><br> <br> <button data-bind=\"text: delayTimerEnabled() ? 'Update' : 'Set',\n"
-  "                                   enable: !updatingDelayTimer() &amp;&amp;\n"
-  "                                           delayTimerValid() &amp;&amp;\n"
-  "                                           !isError(),\n"
-  "                                   click: startDelayTimer\">Set</button> <button data-bind=\"visible: delayTimerEnabled(),\n"
-  "                                   enable: !updatingDelayTimer() &amp;&amp;\n"
-  "                                           !isError(),\n"
-  "                                   click: stopDelayTimer\">Cancel</button> </div> </div> <div class=\"box380 right\" data-bind=\"visible: advancedMode() &amp;&amp; status.rapi_connected()\"> <h2>Energy</h2> <table> <tr> <th>Energy</th> <th></th> </tr> <tr> <td>This Session:</td> <td><span data-bind=\"text: scaleString(status.wattsec(), 3600000, 2)+ ' kWh'\"></span></td> </tr> <tr> <td>Total:</td> <td><span data-bind=\"text: scaleString(status.watthour(), 1000, 2)+ ' kWh'\"></span></td> </tr> </table> </div> <div class=\"box380 right\" data-bind=\"visible: advancedMode() &amp;&amp; status.rapi_connected()\"> <h2>Sensor Values</h2> <table> <tr> <th>Sensor</th> <th>Value</th> </tr> <tr> <td>Pilot:</td> <td><span data-bind=\"text: status.pilot() + ' A'\"></span></td> </tr> <tr> <td>Current Now:</td> <td><span data-bind=\"text: scaleString(status.amp(), 1000, 2) + ' A'\"></span></td> </tr> <tr data-bind=\"visible: false !== status.voltage()\"> <td>Voltage:</td> <td><span data-bind=\"text: scaleString(status.voltage(), 1, 2) + ' V'\"></span></td> </tr> <tr data-bind=\"visible: false !== status.temp1()\"> <td>Temp1:</td> <td><span data-bind=\"text: scaleString(status.temp1(), 10, 1) + ' &deg;C'\"></span></td> </tr> <tr data-bind=\"visible: false !== status.temp2()\"> <td>Temp2:</td> <td><span data-bind=\"text: scaleString(status.temp2(), 10, 1) + ' &deg;C'\"></span></td> </tr> <tr data-bind=\"visible: false !== status.temp3()\"> <td>Temp3:</td> <td><span data-bind=\"text: scaleString(status.temp3(), 10, 1) + ' &deg;C'\"></span></td> </tr> </table> </div> <div class=\"box380 setup\" data-bind=\"visible: status.rapi_connected, css: { right: !advancedMode(), left: advancedMode() }\"> <h2>Setup</h2> <p data-bind=\"visible: !openevse.time.hasRTC()\"> <b>Time: No RTC detected</b> </p> <p data-bind=\"with: openevse.time, visible: openevse.time.hasRTC()\"> <b>Time:</b><br> <input type=\"date\" data-bind=\"value: date, disable: automaticTime\"> <input type=\"time\" data-bind=\"value: time, disable: automaticTime\"><br> </p> <p data-bind=\"visible: openevse.time.hasRTC() && false !== config.time_zone() && 'ntp' === timeSource()\"> <b>Time zone:</b><br> <select data-bind=\"options: zones.zones,\n"
-  "                        optionsText: 'name',\n"
-  "                        optionsValue: 'value',\n"
-  "                        value: time_zone\"></select> </p> <div data-bind=\"visible: openevse.time.hasRTC()\"> Set time from <select data-bind=\"value: timeSource\" style=\"width: 100px\"> <option value=\"manual\">Manual</option> <option value=\"browser\">Browser</option> <option value=\"ntp\" data-bind=\"visible: false !== config.sntp_hostname()\">NTP</option> </select> <button data-bind=\"click: setTime, text: (setTimeFetching() ? 'Saving' : (setTimeSuccess() ? 'Saved' : 'Set time')), disable: setTimeFetching\">Set time</button> </div> <hr> <p> <b>Service Level:</b><br> <select data-bind=\"options: openevse.serviceLevels,\n"
-  "                                 optionsText: 'name',\n"
-  "                                 optionsValue: 'value',\n"
-  "                                 value: openevse.serviceLevel,\n"
-  "                                 disable: openevse.updatingServiceLevel(),\n"
-  "                                 css: { saved: openevse.savedServiceLevel }\"></select> </p> <p> <b>Max Current:</b><br> <select data-bind=\"options: openevse.currentLevels,\n"
-  "                                  optionsText: 'name',\n"
-  "                                  optionsValue: 'value',\n"
-  "                                  value: openevse.currentCapacity,\n"
-  "                                  disable: openevse.updatingServiceLevel() || openevse.updatingCurrentCapacity(),\n"
-  "                                  css: { saved: openevse.savedCurrentCapacity }\"></select> </p> </div> <div class=\"box380 right\" data-bind=\"visible: advancedMode() &amp;&amp; status.rapi_connected()\"> <h2>Current</h2> <table> <tr> <th>Name</th> <th> </th> </tr> <tr> <td>Service Level:</td> <td> <span data-bind=\"text: openevse.actualServiceLevel\"></span> </td> </tr> <tr> <td>Level <span data-bind=\"text: openevse.actualServiceLevel\"></span> Minimum:</td> <td> <span data-bind=\"text: openevse.minCurrentLevel() + ' A'\"></span> </td> </tr> <tr> <td>Level <span data-bind=\"text: openevse.actualServiceLevel\"></span> Maximum:</td> <td> <span data-bind=\"text: openevse.maxCurrentLevel() + ' A'\"></span> </td> </tr> <tr> <td>Sensor Scale:</td> <td><span data-bind=\"text: config.scale\"></span></td> </tr> <tr> <td>Sensor Offset:</td> <td><span data-bind=\"text: config.offset\"></span></td> </tr> </table> </div> <div class=\"box380 left\" data-bind=\"visible: status.rapi_connected() &amp;&amp; (advancedMode() || !openevse.allTestsEnabled())\"> <h2>Safety<span class=\"info\" data-bind=\"click: toggle.bind($data, showSafety)\"></span></h2> <div class=\"box\" data-bind=\"visible: showSafety()\"> Hardware safety checks. Enable dev mode (System > Developer Mode) to enable/disable or use the physical LCD + menu button. </div> <div data-bind=\"visible: !openevse.allTestsEnabled()\" class=\"box warning\"> <h4>Warning!!</h4> Not all the safety tests are enabled, please take extra care before charging your vehicle. </div> <table> <tr> <th>Test</th> <th>Status</th> </tr> <tr data-bind=\"css: {error: 9 === status.state() }\"> <td>GFI Self Test:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.gfiSelfTestEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.gfiSelfTestEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 7 === status.state() }\"> <td>Ground Monitoring:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.groundCheckEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.groundCheckEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 8 === status.state() }\"> <td>Stuck Contact Detection:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.stuckRelayEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.stuckRelayEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 10 === status.state() }\"> <td>Temperature Monitoring:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode() &amp;&amp; openevse.tempCheckSupported()\"> <input type=\"checkbox\" data-bind=\"checked: openevse.tempCheckEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.tempCheckEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 5 === status.state() }\"> <td>Diode Check:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.diodeCheckEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.diodeCheckEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr data-bind=\"css: {error: 4 === status.state() }\"> <td>Vent Required:</td> <td> <label class=\"switch\" data-bind=\"visible: developerMode\"> <input type=\"checkbox\" data-bind=\"checked: openevse.ventRequiredEnabled\"> <div class=\"slider round\"></div> </label> <span data-bind=\"text: openevse.ventRequiredEnabled() ? 'Enabled' : 'Disabled'\"></span> </td> </tr> <tr> <th>Error</th> <th>Count</th> </tr> <tr> <td>GFCI:</td> <td><span data-bind=\"text: status.gfcicount\"></span></td> </tr> <tr> <td>No Ground:</td> <td><span data-bind=\"text: status.nogndcount\"></span></td> </tr> <tr> <td>Stuck Contact:</td> <td><span data-bind=\"text: status.stuckcount\"></span></td> </tr> </table> </div> <div class=\"box380 right\" data-bind=\"visible: advancedMode() &amp;&amp; status.rapi_connected()\"> <h2>Hardware</h2> <table> <tr> <th>OpenEVSE</th> <th></th> </tr> <tr> <td>Firmware:</td> <td><span data-bind=\"text: config.firmware\"></span></td> </tr> <tr> <td>Protocol:</td> <td><span data-bind=\"text: config.protocol\"></span></td> </tr> <tr> <td colspan=\"2\" data-bind=\"with: openevse\"> <button data-bind=\"click: restart, text: (restartFetching() ? 'Restarting...' : 'Restart'), disable: restartFetching\">Restart</button> </td> </tr> <tr> <th>OpenEVSE WiFi</th> <th></th> </tr> <tr> <td>Firmware:</td> <td><span data-bind=\"text: config.version\"></span></td> </tr> <tr> <td>Flash Size:</td> <td><span data-bind=\"text: scaleString(config.espflash(), 1024, 0) + 'K'\"></span></td> </tr> <tr> <td>Free RAM:</td> <td><span data-bind=\"text: scaleString(status.free_heap(), 1024, 0) + 'K'\"></span></td> </tr> <tr> <td colspan=\"2\"> <button data-bind=\"click: restart, text: (restartFetching() ? 'Restarting...' : 'Restart'), disable: restartFetching\">Restart</button> </td> </tr> </table> </div> <div class=\"box380\" data-bind=\"visible: status.rapi_connected,\n"
-  "                                         css: { right: !advancedMode() &amp;&amp; !openevse.allTestsEnabled(),\n"
-  "                                                left: advancedMode() || openevse.allTestsEnabled() }\"> <h2>Display</h2> <div> <span data-bind=\"css: {selected: !advancedMode() }\">Simple</span> <label class=\"switch\"> <input type=\"checkbox\" data-bind=\"checked: advancedMode\"> <div class=\"slider round\"></div> </label> <span data-bind=\"css: {selected: advancedMode }\">Advanced</span><br> </div> </div> </div> <div id=\"content-4\" data-bind=\"visible: isRapi() &amp;&amp; status.rapi_connected()\"> <div class=\"box380 left\"> <form method=\"get\" action=\"r\" data-bind=\"with: rapi\"> <p> <b>RAPI Command:</b> <input type=\"text\" autocapitalize=\"none\" name=\"rapi\" length=\"32\" data-bind=\"textInput: cmd\"> </p> <p> <button data-bind=\"click: send, disable: rapiSend\">Send</button> </p> <p data-bind=\"text: ret\"></p> </form> </div> <div class=\"box380 right\"> <h2>RAPI System Functions</h2> <table> <tr> <th>Function</th> <th>Description</th> </tr> <tr> <td>$FB</td> <td>LCD Backlight Color (0-7)</td> </tr> <tr> <td>$FD</td> <td>Disable EVSE</td> </tr> <tr> <td>$FE</td> <td>Enable EVSE</td> </tr> <tr> <td>$FP</td> <td>Output text at x y position text to LCD (x y text)</td> </tr> <tr> <td>$FR</td> <td>Reset EVSE</td> </tr> <tr> <td>$FS</td> <td>Put EVSE to sleep</td> </tr> </table> </div> <div class=\"box380 left\"> <h2>RAPI Get Commands</h2> <table> <tr> <th>Get</th> <th>Description</th> </tr> <tr> <td>$G3</td> <td>Get Charge Time Limit, 15-minutes (1), 30-minutes (2), etc...</td> </tr> <tr> <td>$GA</td> <td>Get Ammeter Scale/Offset, scale offset</td> </tr> <tr> <td>$GC</td> <td>Get current capacity range, integers</td> </tr> <tr> <td>$GD</td> <td>Get delay timer, starthr startmin endhr endmin</td> </tr> <tr> <td>$GE</td> <td>Get settings, amps flags</td> </tr> <tr> <td>$GF</td> <td>Get fault counters, gfi ground stuck (in hex)</td> </tr> <tr> <td>$GG</td> <td>Get charge current and voltage, milliamps millivolts</td> </tr> <tr> <td>$GH</td> <td>Get charge limit in kWh, integer</td> </tr> <tr> <td>$GM</td> <td>Get Voltmeter Scale/Offset, scale offset</td> </tr> <tr> <td>$GO</td> <td>Get Overtemperature thresholds, ambient infrared</td> </tr> <tr> <td>$GP</td> <td>Get Temperatures, LCD mcp9808 infrared (all integers, Celsius * 10)</td> </tr> <tr> <td>$GS</td> <td>Get EVSE State, state elapsed_seconds</td> </tr> <tr> <td>$GT</td> <td>Get time, year month day hour minute second</td> </tr> <tr> <td>$GU</td> <td>Get Energy usage, wattseconds watt_hour_accumulated</td> </tr> <tr> <td>$GV</td> <td>Get Versions, evse_firmware protocol_version</td> </tr> </table> </div> <div class=\"box380 right\"> <h2>RAPI Set Commands</h2> <table> <tr> <th>Set</th> <th>Description</th> </tr> <tr> <td>$S0</td> <td>Set LCD Type, Monochrome (0), Color (1)</td> </tr> <tr> <td>$S1</td> <td>Set RTC Year Month Day Hour Minute Second (all 2-digit max)</td> </tr> <tr> <td>$S2</td> <td>Enable (1)/ Disable (0) Ammeter Calibration Mode</td> </tr> <tr> <td>$S3</td> <td>Set Charge Time Limit, 15-minutes (1), 30-minutes (2), etc...</td> </tr> <tr> <td>$SA</td> <td>Set Ammeter Scale/Offset, scale offset</td> </tr> <tr> <td>$SC</td> <td>Set current capacity, integer</td> </tr> <tr><td>$SD</td><td>Enable (1) / Disable (0) Diode self-check</td></tr> <tr> <td>$SF</td> <td>Enable (1) / Disable (0) GFI self-check</td> </tr> <tr> <td>$SG</td> <td>Enable (1) / Disable (0) Ground check</td> </tr> <tr> <td>$SH</td> <td>Set charge limit in kWh, integer</td> </tr> <tr> <td>$SK</td> <td>Set accumulated Wh, integer</td> </tr> <tr><td>$SL</td><td>Set service level (1/2/A)</td></tr> <tr> <td>$SM</td> <td>Set Voltmeter Scale/Offset, scale offset</td> </tr> <tr> <td>$SO</td> <td>Set Overtemperature thresholds, ambient infrared</td> </tr> <tr> <td>$SR</td> <td>Enable (1) / Disable (0) Stuck-relay check</td> </tr> <tr> <td>$SS</td> <td>Enable (1) / Disable (0) GFI self-check</td> </tr> <tr> <td>$ST</td> <td>Set timer, start_hour start_min end_hour end_min</td> </tr> <tr> <td>$SV</td> <td>Enable (1) / Disable (0) vent required check</td> </tr> </table> </div> </div> </div> <div id=\"footer\"> <br><b> Powered by <a href=\"http://www.openevse.com\">OpenEVSE</a> and <a href=\"https://openenergymonitor.org\">OpenEnergyMonitor</a></b> <br> <b>Version: </b>V<span data-bind=\"text: config.version\"></span> </div> </div> </div> <script src=\"lib.js\"></script> <script src=\"home.js\"></script> </body> </html> \n";
+static const char CONTENT_HOME_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x3d, 0x69, 0x73, 0xdb, 0x46, 
+  0xb2, 0xdf, 0xf7, 0x57, 0x8c, 0xb1, 0xd9, 0x90, 0x4a, 0x24, 0x1e, 0x92, 0xaf, 0xd0, 0x12, 0xb7, 
+  0x64, 0x4a, 0xb2, 0xf5, 0xe2, 0x43, 0x6b, 0x2a, 0x72, 0x6d, 0xd5, 0xab, 0x52, 0x81, 0xc4, 0x90, 
+  0x44, 0x84, 0x6b, 0x01, 0x50, 0x12, 0xe3, 0xf8, 0xbf, 0xbf, 0xee, 0x9e, 0x01, 0x30, 0x83, 0x8b, 
+  0x20, 0x25, 0x27, 0xd9, 0xaa, 0x97, 0xad, 0xb5, 0x4d, 0x60, 0xa6, 0xa7, 0xa7, 0xef, 0xee, 0x39, 
+  0x70, 0xf8, 0xc4, 0xf2, 0xa7, 0xf1, 0x2a, 0xe0, 0x6c, 0x11, 0xbb, 0xce, 0x90, 0x1d, 0xe2, 0x5f, 
+  0xcc, 0x31, 0xbd, 0xf9, 0x91, 0xc1, 0x3d, 0x03, 0x1f, 0x70, 0xd3, 0x82, 0xbf, 0x5c, 0x1e, 0x9b, 
+  0x6c, 0xba, 0x30, 0xc3, 0x88, 0xc7, 0x47, 0xc6, 0x32, 0x9e, 0xed, 0xbd, 0xc4, 0xb7, 0xb1, 0x1d, 
+  0x3b, 0x7c, 0xf8, 0x31, 0xe0, 0xde, 0xe9, 0xd5, 0xf8, 0xf4, 0xb0, 0x2b, 0x7e, 0xcb, 0xe6, 0x9e, 
+  0xe9, 0xf2, 0x23, 0xe3, 0xd6, 0xe6, 0x77, 0x81, 0x1f, 0xc6, 0x06, 0x9b, 0xfa, 0x5e, 0xcc, 0x3d, 
+  0xe8, 0x7e, 0x67, 0x5b, 0xf1, 0xe2, 0xc8, 0xe2, 0xb7, 0xf6, 0x94, 0xef, 0xd1, 0x8f, 0x5d, 0xdb, 
+  0xb3, 0x63, 0xdb, 0x74, 0xf6, 0xa2, 0xa9, 0xe9, 0xf0, 0xa3, 0xbe, 0xb1, 0x0d, 0x8c, 0x65, 0xc4, 
+  0x43, 0x02, 0x60, 0x4e, 0x00, 0x86, 0xe7, 0xe7, 0x80, 0x58, 0x3c, 0x9a, 0x86, 0x76, 0x10, 0xdb, 
+  0xbe, 0xa7, 0xc0, 0x49, 0x70, 0xcf, 0x35, 0x36, 0x97, 0xf1, 0xc2, 0x0f, 0xd7, 0xb7, 0x8b, 0x17, 
+  0xdc, 0xe5, 0x7b, 0x53, 0xdf, 0xd1, 0x1a, 0xff, 0xbd, 0x47, 0xff, 0x61, 0x5b, 0xc7, 0xf6, 0x6e, 
+  0x58, 0xc8, 0x9d, 0x23, 0x23, 0x8a, 0x57, 0x0e, 0x8f, 0x16, 0x9c, 0xc3, 0x34, 0x90, 0xe4, 0xd0, 
+  0x99, 0xdf, 0xc7, 0xdd, 0x69, 0x14, 0x19, 0x6c, 0x11, 0xf2, 0x99, 0x6c, 0xd1, 0xc1, 0x07, 0x5a, 
+  0x47, 0x7b, 0x8a, 0x18, 0x8b, 0x2e, 0xb6, 0x6b, 0xce, 0x79, 0x37, 0xf0, 0xe6, 0x49, 0x9f, 0x99, 
+  0x79, 0x8b, 0xef, 0xf7, 0x0e, 0xf6, 0xef, 0x0f, 0xf6, 0x3b, 0xf4, 0x22, 0xb2, 0x7f, 0xe3, 0xd1, 
+  0x91, 0x41, 0x4f, 0xb6, 0x80, 0xd4, 0x7f, 0x7e, 0xdf, 0x7f, 0xae, 0x41, 0xa2, 0x27, 0x08, 0xa9, 
+  0x2b, 0xa5, 0x61, 0xe2, 0x5b, 0x2b, 0xf8, 0xcb, 0xb2, 0x6f, 0x99, 0x6d, 0x1d, 0x19, 0x01, 0x40, 
+  0x32, 0xe4, 0xef, 0xa9, 0x63, 0x46, 0xd0, 0x05, 0x1b, 0xf2, 0x90, 0x04, 0xa8, 0x4f, 0xf2, 0x71, 
+  0x18, 0x05, 0xa6, 0x37, 0x14, 0x52, 0x42, 0xff, 0x04, 0x60, 0x7d, 0x7c, 0x7d, 0x30, 0xfc, 0x6c, 
+  0x9f, 0xd9, 0xf0, 0xeb, 0x00, 0x07, 0x00, 0x10, 0x3a, 0x20, 0xa4, 0xa9, 0x69, 0x7b, 0x00, 0x8b, 
+  0x59, 0x66, 0x6c, 0xee, 0x4d, 0x6c, 0xcf, 0x42, 0x81, 0x88, 0x6c, 0x60, 0xf2, 0x80, 0x3d, 0x91, 
+  0x82, 0x63, 0x47, 0xdc, 0x6a, 0xef, 0xc0, 0x78, 0xef, 0x7c, 0xd3, 0xb2, 0xbd, 0xf9, 0x2e, 0x0b, 
+  0x1c, 0x6e, 0x46, 0x9c, 0xdd, 0x99, 0x76, 0xdc, 0xe9, 0x74, 0x58, 0x9b, 0x10, 0x50, 0x61, 0x20, 
+  0xf5, 0x07, 0xcc, 0x8e, 0xb9, 0x1b, 0x61, 0x27, 0x6e, 0x19, 0x43, 0x89, 0x5a, 0xb7, 0xae, 0xed, 
+  0xa5, 0x1f, 0x9b, 0x4e, 0xda, 0x74, 0x67, 0x0b, 0x9c, 0x15, 0x94, 0x81, 0xc4, 0xc8, 0x73, 0x10, 
+  0x4e, 0x3b, 0x0a, 0x1c, 0x73, 0x35, 0x60, 0x9e, 0xef, 0xe5, 0x69, 0x19, 0x9b, 0x13, 0x92, 0x08, 
+  0xdb, 0x0b, 0x96, 0x31, 0x11, 0x1c, 0x9e, 0xec, 0x1d, 0x24, 0x8c, 0x0c, 0x61, 0xc2, 0xbe, 0x91, 
+  0xc8, 0x23, 0xbc, 0x99, 0x87, 0xfe, 0x32, 0xd0, 0x86, 0x9e, 0x2e, 0xf8, 0xf4, 0x86, 0x5b, 0x03, 
+  0x06, 0xaf, 0x0d, 0x76, 0x6b, 0x3a, 0x4b, 0x8e, 0xd2, 0x66, 0xc6, 0x4b, 0x21, 0x6a, 0xe6, 0x84, 
+  0x3b, 0x6c, 0xe6, 0x87, 0x09, 0x64, 0x45, 0xa3, 0xe9, 0x5d, 0x61, 0xf0, 0xfe, 0x83, 0x07, 0x5f, 
+  0x45, 0x40, 0xcc, 0x92, 0xc1, 0x41, 0xf5, 0xc7, 0xf4, 0xae, 0x6a, 0xe8, 0xfd, 0x07, 0x0f, 0xcd, 
+  0x43, 0x34, 0x1a, 0x65, 0x33, 0x07, 0x75, 0x19, 0xcb, 0xb7, 0x55, 0xc3, 0x3f, 0x7d, 0xe8, 0xf0, 
+  0xa1, 0x19, 0xd8, 0x25, 0x43, 0x3f, 0x2d, 0x97, 0x15, 0x30, 0x70, 0xdc, 0xf1, 0x03, 0x1e, 0xbe, 
+  0xf7, 0x2d, 0xde, 0xde, 0x61, 0xdf, 0x9b, 0x6e, 0xf0, 0x8a, 0xfe, 0x60, 0x82, 0x7f, 0x1d, 0x84, 
+  0x77, 0x0d, 0x12, 0xe7, 0xf1, 0x69, 0x2c, 0x74, 0xe0, 0xd3, 0xf1, 0xc5, 0x79, 0x86, 0xbe, 0x22, 
+  0x9e, 0x38, 0x07, 0x69, 0xa3, 0x8c, 0xe2, 0x23, 0x64, 0x6a, 0xa9, 0xb8, 0x46, 0xe3, 0x94, 0x59, 
+  0x8a, 0x54, 0x4e, 0xfc, 0xfb, 0x83, 0x97, 0x3d, 0xe6, 0xf0, 0x19, 0x01, 0x5b, 0xec, 0x93, 0x1e, 
+  0xb3, 0x31, 0x8f, 0x97, 0x01, 0x68, 0xf3, 0x3e, 0x3c, 0x0b, 0x86, 0x87, 0x93, 0x21, 0x22, 0x3e, 
+  0x38, 0xec, 0x4e, 0xe0, 0x37, 0x69, 0x15, 0x8e, 0xe8, 0xc2, 0x33, 0xa3, 0xa8, 0x5f, 0x72, 0x46, 
+  0xb3, 0xa5, 0xe3, 0x60, 0xaf, 0x54, 0xc9, 0x0e, 0xbb, 0x81, 0x82, 0xee, 0x9d, 0x1d, 0x72, 0x6b, 
+  0x0f, 0x5d, 0x42, 0x39, 0xbe, 0x12, 0x8a, 0x1d, 0x7d, 0xc6, 0x86, 0x46, 0x82, 0xc7, 0xf9, 0x05, 
+  0x3b, 0xb6, 0xac, 0x90, 0x47, 0x11, 0x61, 0x73, 0x38, 0x09, 0x87, 0x87, 0x66, 0x25, 0x0e, 0x76, 
+  0x60, 0x8a, 0xc6, 0xbb, 0xcc, 0x8c, 0xe3, 0x70, 0xc0, 0xbe, 0xa0, 0x91, 0x1c, 0xb0, 0xd6, 0x22, 
+  0x8e, 0x83, 0x41, 0xb7, 0xdb, 0xfa, 0x31, 0xdf, 0xb0, 0xbd, 0xf3, 0x15, 0x11, 0x36, 0x25, 0xb6, 
+  0xf8, 0xff, 0xc9, 0x70, 0xbc, 0x9c, 0x82, 0x2c, 0x45, 0x30, 0x23, 0x16, 0x98, 0x20, 0x0b, 0x71, 
+  0x36, 0x38, 0xab, 0x30, 0x32, 0x12, 0xae, 0x6c, 0x7e, 0x1d, 0x09, 0x08, 0x29, 0x2d, 0x98, 0x3f, 
+  0x6b, 0xda, 0x93, 0xd8, 0x9c, 0x74, 0x4b, 0xb0, 0x02, 0xa4, 0x32, 0xe5, 0x9e, 0x0c, 0x95, 0xc7, 
+  0x28, 0x36, 0x05, 0x2c, 0xeb, 0x87, 0x9a, 0xfa, 0xae, 0xbb, 0x05, 0x86, 0xa2, 0x9b, 0x8a, 0x9e, 
+  0x40, 0x23, 0x2f, 0xaa, 0x8e, 0x8d, 0x62, 0x59, 0xcd, 0xe9, 0x27, 0x77, 0xf6, 0xcc, 0xee, 0x4c, 
+  0x4d, 0x6f, 0xe4, 0x7b, 0x33, 0x7b, 0xbe, 0x0c, 0x73, 0x1a, 0x22, 0xde, 0xe3, 0x1f, 0x23, 0xa1, 
+  0x1f, 0xe0, 0x18, 0x72, 0x2d, 0x74, 0x61, 0x21, 0x0f, 0x72, 0x18, 0x63, 0xfc, 0x80, 0x7f, 0x23, 
+  0x93, 0xe2, 0xc5, 0xf0, 0x03, 0x8f, 0xef, 0xfc, 0xf0, 0x06, 0xa2, 0x9b, 0x85, 0x78, 0xf0, 0x69, 
+  0x3c, 0x3e, 0x67, 0xd6, 0x6b, 0x57, 0x3e, 0xe9, 0x8a, 0x86, 0xe8, 0x14, 0x09, 0x6f, 0x80, 0xb9, 
+  0x17, 0x45, 0x36, 0x89, 0x5e, 0x1c, 0x6a, 0x06, 0xc1, 0xb1, 0xa7, 0x37, 0x03, 0x36, 0x5b, 0x7a, 
+  0x53, 0x0c, 0x43, 0x18, 0x20, 0xf3, 0x85, 0x11, 0x92, 0x60, 0x07, 0xa6, 0x5c, 0x4c, 0xa3, 0x1d, 
+  0x87, 0x4b, 0xbe, 0xf3, 0x8a, 0x7d, 0xa5, 0xfe, 0x56, 0x91, 0x8a, 0x53, 0x6a, 0xd6, 0x11, 0x43, 
+  0xc0, 0xe8, 0x56, 0x45, 0x3b, 0x39, 0xb7, 0x28, 0x84, 0x96, 0x69, 0x43, 0x81, 0x6c, 0x37, 0x96, 
+  0x2e, 0xbc, 0x9b, 0x4c, 0x76, 0xb2, 0x8c, 0x63, 0xdf, 0x7b, 0x08, 0xb2, 0xa3, 0x05, 0x84, 0x8d, 
+  0x9c, 0x91, 0x15, 0xf0, 0x12, 0x92, 0x09, 0xb0, 0xff, 0xaf, 0x83, 0xff, 0x35, 0x3a, 0x28, 0xe5, 
+  0x00, 0xe5, 0xd8, 0x0c, 0xfc, 0xd9, 0x6c, 0xad, 0x8d, 0x9d, 0xd9, 0xc7, 0x34, 0xf6, 0x85, 0x6f, 
+  0x7b, 0xf1, 0x2e, 0x93, 0x52, 0x43, 0x72, 0x12, 0x2f, 0x43, 0xef, 0xe3, 0x6c, 0xa6, 0xbd, 0x87, 
+  0x40, 0xc7, 0x24, 0x10, 0x15, 0x2d, 0xce, 0x78, 0x3c, 0x5d, 0x80, 0x9e, 0x1a, 0xc3, 0x4b, 0x78, 
+  0x07, 0xf3, 0x98, 0x31, 0xf1, 0x96, 0xd1, 0x6b, 0x45, 0xa2, 0x72, 0xd6, 0xc2, 0x0c, 0x6a, 0x2c, 
+  0xc5, 0xb7, 0x31, 0x14, 0xc1, 0x50, 0x36, 0x67, 0xb1, 0x9f, 0x88, 0xfc, 0x20, 0xef, 0xac, 0x66, 
+  0xf6, 0x3b, 0x3b, 0x22, 0x17, 0x09, 0x02, 0x28, 0x7d, 0x27, 0xc4, 0x7e, 0x71, 0x49, 0xbc, 0x00, 
+  0x7a, 0xc5, 0xcd, 0xe9, 0x02, 0xc8, 0x0b, 0xa8, 0x76, 0x66, 0xb6, 0x13, 0x73, 0x18, 0xeb, 0x13, 
+  0x8f, 0x96, 0x4e, 0x0c, 0x4a, 0x90, 0xce, 0xa6, 0xc7, 0x9e, 0x1c, 0x89, 0x36, 0xa1, 0x78, 0xd7, 
+  0xde, 0xe9, 0x38, 0xdc, 0x9b, 0xc7, 0x0b, 0x11, 0xee, 0x17, 0x87, 0xd9, 0xc3, 0xd0, 0xd5, 0x28, 
+  0xd1, 0xee, 0xef, 0x42, 0xdf, 0x8f, 0x69, 0xe6, 0x9d, 0x88, 0x3b, 0x30, 0x15, 0xe0, 0x20, 0x68, 
+  0x27, 0x68, 0xba, 0x09, 0x54, 0xb8, 0xe5, 0x25, 0x2d, 0xb8, 0x05, 0x06, 0x11, 0xa8, 0x73, 0x74, 
+  0x74, 0xc4, 0xbe, 0x43, 0x88, 0xc2, 0x52, 0x55, 0x48, 0x9b, 0x34, 0x52, 0x52, 0x01, 0x6c, 0x77, 
+  0xce, 0x44, 0xe6, 0x66, 0xec, 0x3f, 0x0d, 0xee, 0x21, 0xf5, 0xe0, 0xf6, 0x7c, 0x11, 0x27, 0xbf, 
+  0x94, 0xee, 0xa4, 0xf1, 0x5f, 0xa2, 0x70, 0x0a, 0xfa, 0x8e, 0x83, 0x5f, 0x47, 0xf6, 0xdc, 0x33, 
+  0x9d, 0x6b, 0x54, 0xfa, 0x90, 0xe6, 0xda, 0xde, 0xf9, 0xb1, 0xd5, 0x89, 0x6e, 0xe7, 0x2d, 0x1a, 
+  0xbe, 0xeb, 0xd8, 0xf8, 0xe7, 0x32, 0x17, 0xf2, 0x94, 0x09, 0x43, 0x0f, 0x50, 0xaf, 0x24, 0xdf, 
+  0x18, 0x9e, 0x7b, 0xc0, 0x7e, 0xcc, 0x19, 0x12, 0x40, 0xd2, 0x8e, 0x8c, 0xcf, 0x4f, 0x14, 0xcb, 
+  0x21, 0xc2, 0xc2, 0x2c, 0x91, 0x33, 0x18, 0xe4, 0x8c, 0xfe, 0x14, 0xa2, 0x31, 0xc8, 0x0f, 0x20, 
+  0x6f, 0x3a, 0x32, 0x28, 0x94, 0xcf, 0x93, 0xe4, 0x1c, 0xbb, 0xe5, 0x6c, 0x38, 0x53, 0xcd, 0xd5, 
+  0x05, 0xb0, 0xee, 0x86, 0xaf, 0x1e, 0x6d, 0x24, 0x24, 0x1e, 0xc2, 0x04, 0xe1, 0xb4, 0x3a, 0x14, 
+  0x83, 0xa6, 0xe6, 0x94, 0x60, 0xe6, 0x5a, 0x44, 0x0b, 0xff, 0x0e, 0x98, 0xfb, 0x4f, 0xd6, 0x42, 
+  0x18, 0x2d, 0x06, 0xe4, 0x0f, 0xe4, 0xbb, 0x16, 0x32, 0x5a, 0xa0, 0x04, 0xf8, 0x1e, 0x0a, 0xda, 
+  0x64, 0xd1, 0x31, 0x82, 0x49, 0x9a, 0x26, 0x41, 0x32, 0x45, 0xc0, 0x10, 0x29, 0x96, 0x87, 0xc5, 
+  0x85, 0x81, 0x73, 0x71, 0xb1, 0x06, 0x71, 0x38, 0x86, 0x06, 0x2c, 0xf9, 0x59, 0x88, 0x6f, 0x03, 
+  0xd5, 0xe6, 0x57, 0xf9, 0x32, 0x21, 0xc5, 0xe6, 0x2d, 0x97, 0x2e, 0x7d, 0x97, 0x09, 0x29, 0x6d, 
+  0xe7, 0x5f, 0x24, 0x56, 0x48, 0x50, 0x62, 0x0c, 0x99, 0xb1, 0x37, 0x47, 0x5a, 0x14, 0x1a, 0x4a, 
+  0xe7, 0x92, 0xb6, 0xe3, 0x16, 0x91, 0x4c, 0xda, 0x85, 0xd6, 0xce, 0x4e, 0xde, 0xe2, 0x95, 0x0c, 
+  0x62, 0x24, 0x66, 0x44, 0x35, 0x6e, 0xc1, 0x7a, 0x39, 0x2e, 0x31, 0x5a, 0x9a, 0x55, 0x82, 0xdf, 
+  0x68, 0x98, 0x3e, 0x9f, 0x9f, 0x9d, 0x33, 0x39, 0x24, 0x48, 0xb5, 0x06, 0xba, 0x98, 0xbb, 0xca, 
+  0xb0, 0x3e, 0x44, 0xb5, 0x94, 0x71, 0xfd, 0xb1, 0xe5, 0x42, 0xca, 0x0a, 0x6a, 0x67, 0x62, 0x1c, 
+  0x90, 0xc6, 0xf6, 0x28, 0xac, 0xbf, 0x40, 0x32, 0x85, 0x19, 0xd0, 0x63, 0xeb, 0xc5, 0xdd, 0xdd, 
+  0xdd, 0xf5, 0x52, 0xc2, 0x36, 0x80, 0xe9, 0x31, 0x58, 0x42, 0xef, 0xc8, 0xe8, 0x7c, 0xe9, 0x3f, 
+  0xfb, 0x0a, 0xb2, 0x85, 0x55, 0xa6, 0x23, 0xe3, 0x72, 0xc1, 0xd9, 0xcc, 0xe6, 0x8e, 0xc5, 0x42, 
+  0xfe, 0x9f, 0x25, 0x98, 0xe5, 0x88, 0xf5, 0x9f, 0x51, 0x91, 0x0a, 0x6c, 0x17, 0x0f, 0x23, 0x83, 
+  0xb9, 0xe6, 0xbd, 0x50, 0xec, 0x23, 0xa3, 0xff, 0xcc, 0x48, 0x9a, 0xc1, 0x88, 0xa9, 0xc1, 0x92, 
+  0xb3, 0x8e, 0x5c, 0xd3, 0x71, 0xf6, 0x10, 0x0f, 0x4c, 0xd3, 0x6c, 0xeb, 0x3d, 0xf0, 0x94, 0x8a, 
+  0x1a, 0x1a, 0x40, 0x84, 0x97, 0xf7, 0xe5, 0x89, 0xca, 0xa2, 0x50, 0x56, 0x50, 0x21, 0x53, 0x8a, 
+  0x8d, 0xf4, 0xf6, 0xee, 0x6e, 0x8d, 0xda, 0x2a, 0x0d, 0xd6, 0x68, 0xed, 0x37, 0xa1, 0x60, 0x16, 
+  0x40, 0xe9, 0x66, 0x20, 0x43, 0xab, 0xa1, 0x15, 0xc8, 0xcd, 0x23, 0x6f, 0x04, 0x14, 0x78, 0x95, 
+  0x36, 0x40, 0x04, 0x30, 0x59, 0x44, 0xb7, 0x2d, 0x5b, 0xeb, 0x40, 0x18, 0xc3, 0xcf, 0x7c, 0xc2, 
+  0x20, 0x06, 0xe1, 0xe1, 0xcc, 0x9c, 0x72, 0xf6, 0xf6, 0xf2, 0xf2, 0x02, 0x39, 0xba, 0x80, 0x20, 
+  0xca, 0x9e, 0x92, 0x6e, 0x74, 0x14, 0x30, 0x02, 0x54, 0xa5, 0x29, 0x42, 0x3b, 0x40, 0x8a, 0x95, 
+  0xda, 0xa0, 0xf4, 0x49, 0xa5, 0xf1, 0x49, 0x5b, 0x54, 0x58, 0x1d, 0xfc, 0x97, 0x6e, 0x72, 0x0a, 
+  0x30, 0x81, 0x84, 0xf0, 0xa8, 0xc6, 0xd0, 0x54, 0x9b, 0x01, 0x0a, 0xec, 0xcf, 0xec, 0xd0, 0xbd, 
+  0x33, 0x43, 0xae, 0x66, 0xf8, 0x57, 0x40, 0x43, 0x98, 0xfc, 0x80, 0x91, 0xf8, 0x97, 0xc7, 0x01, 
+  0x52, 0xaf, 0x6f, 0x45, 0xd3, 0x92, 0xcc, 0xbe, 0x34, 0xbf, 0x5b, 0x06, 0xf0, 0x98, 0x2b, 0xf4, 
+  0xf8, 0xfe, 0xfb, 0xe4, 0xe1, 0xc8, 0x77, 0x03, 0x87, 0xc7, 0x5c, 0x44, 0x62, 0x20, 0x29, 0x2e, 
+  0x45, 0x2c, 0x3e, 0xc8, 0xf8, 0xdf, 0x41, 0x6c, 0x79, 0xbc, 0xf0, 0xb1, 0x32, 0xe9, 0x43, 0xe8, 
+  0xc5, 0xb8, 0x37, 0x15, 0x82, 0xe8, 0x82, 0xb7, 0x07, 0x8f, 0x12, 0xc6, 0x5d, 0xec, 0xb0, 0x87, 
+  0x63, 0x1a, 0x24, 0xb4, 0xcb, 0xc0, 0xf1, 0x4d, 0xeb, 0x1a, 0x9f, 0x6a, 0x42, 0x1a, 0x2d, 0x27, 
+  0xae, 0x0d, 0xe8, 0xfb, 0xb1, 0xf9, 0x0b, 0x0d, 0x6b, 0xe4, 0x74, 0x1b, 0x82, 0x34, 0x9e, 0x14, 
+  0x81, 0x04, 0x62, 0x7a, 0x00, 0x8a, 0x8a, 0x3b, 0x60, 0x72, 0x1e, 0xd0, 0x96, 0x0c, 0x5a, 0x9d, 
+  0x5c, 0xa4, 0x23, 0xa5, 0x72, 0x51, 0x20, 0x02, 0xf0, 0x9c, 0x9a, 0x88, 0x28, 0x85, 0x38, 0x2f, 
+  0xba, 0xb4, 0x54, 0xd6, 0xb7, 0x5b, 0x2d, 0x8c, 0x73, 0xf4, 0xa1, 0xdb, 0x3b, 0x40, 0x2e, 0xd1, 
+  0x58, 0x95, 0x01, 0x9c, 0xf7, 0x7a, 0x7f, 0x23, 0x31, 0x39, 0x0d, 0x43, 0x3f, 0x04, 0x34, 0x9e, 
+  0x00, 0xf4, 0x56, 0x6b, 0xc7, 0x50, 0x44, 0x86, 0x71, 0x7c, 0x47, 0xf2, 0xf2, 0x74, 0x48, 0xed, 
+  0xc0, 0x24, 0xc2, 0x3f, 0xab, 0xa2, 0x43, 0x05, 0xa0, 0x9a, 0x25, 0xd5, 0xa3, 0xd1, 0x54, 0x28, 
+  0x14, 0x1a, 0x31, 0xa1, 0x8c, 0x69, 0xbd, 0x3a, 0xf4, 0xe7, 0x98, 0x2e, 0xbe, 0x86, 0x44, 0xcb, 
+  0x28, 0x7d, 0xae, 0x57, 0x6e, 0xa9, 0x46, 0x3b, 0xa0, 0xec, 0x17, 0x42, 0xd7, 0x04, 0x83, 0x0b, 
+  0xd9, 0x1a, 0xe3, 0xd0, 0x7f, 0x88, 0xd8, 0x48, 0xf7, 0xaa, 0x8d, 0xe6, 0x91, 0xa0, 0x0c, 0x78, 
+  0x24, 0xba, 0x25, 0xdf, 0x80, 0xce, 0x88, 0x57, 0x16, 0xf3, 0x6f, 0xf4, 0x58, 0xb4, 0x4a, 0x78, 
+  0x00, 0x9d, 0x18, 0xa4, 0x3b, 0x15, 0x1d, 0xf9, 0x5b, 0x97, 0x9d, 0x4f, 0xe2, 0xa1, 0x22, 0x3d, 
+  0xf2, 0x89, 0x26, 0x3e, 0xb9, 0xae, 0xc6, 0x50, 0x36, 0x52, 0xc4, 0xa6, 0xba, 0x64, 0x00, 0x9a, 
+  0xe8, 0x87, 0x2b, 0xe8, 0xc1, 0x33, 0x5c, 0xd4, 0x87, 0x05, 0x84, 0x78, 0xac, 0xe2, 0x73, 0x26, 
+  0x9a, 0x32, 0x7a, 0xa1, 0x61, 0x55, 0x06, 0xc4, 0x18, 0x6a, 0xed, 0x1b, 0xdb, 0x36, 0xaa, 0x5c, 
+  0x96, 0x72, 0xc6, 0xb4, 0x6e, 0x4d, 0x6f, 0xca, 0x2d, 0x51, 0x73, 0x4d, 0xa3, 0x20, 0xf1, 0x10, 
+  0x2b, 0x9c, 0x88, 0x6c, 0x94, 0x98, 0xc0, 0x52, 0x10, 0x33, 0xd3, 0x89, 0x38, 0xa9, 0x88, 0xb4, 
+  0x7c, 0x0b, 0xb0, 0x44, 0x42, 0x03, 0x49, 0xfd, 0x87, 0x6f, 0xe5, 0xef, 0xc7, 0x8e, 0x9c, 0x92, 
+  0x71, 0x34, 0x9f, 0x7f, 0xd0, 0x2f, 0xf3, 0xf9, 0xe0, 0xf6, 0xd8, 0x41, 0xbf, 0xca, 0xdd, 0x1f, 
+  0xf4, 0xb7, 0x0a, 0x98, 0x34, 0x80, 0x25, 0x01, 0x53, 0x33, 0x6a, 0x45, 0x5e, 0x1c, 0x5c, 0xe7, 
+  0x49, 0xf6, 0x01, 0xfc, 0x2d, 0x96, 0xe7, 0x79, 0xf8, 0xe8, 0x69, 0x98, 0x3a, 0x5c, 0x81, 0x72, 
+  0x5a, 0xb0, 0x57, 0x25, 0xf3, 0x89, 0xcc, 0xbc, 0xc1, 0x74, 0x9b, 0xa2, 0xfc, 0x54, 0xf2, 0xf5, 
+  0x57, 0xb3, 0x2a, 0xef, 0x9e, 0x83, 0xd0, 0xd4, 0xc5, 0x97, 0x43, 0xdf, 0xd0, 0xcf, 0x2b, 0x55, 
+  0xfc, 0x93, 0x64, 0xc5, 0x81, 0xa1, 0xf8, 0x4b, 0x21, 0x17, 0xfd, 0x26, 0xc3, 0x53, 0x0f, 0x07, 
+  0xb5, 0x84, 0xab, 0x4f, 0xc2, 0xb4, 0x44, 0x24, 0xee, 0x6c, 0x18, 0x3b, 0xef, 0x20, 0xeb, 0x63, 
+  0x3f, 0x6d, 0x79, 0x23, 0xb7, 0xc0, 0x10, 0x81, 0x58, 0x01, 0x16, 0x30, 0x2d, 0xcf, 0x52, 0x6c, 
+  0x6b, 0x2e, 0xef, 0x2b, 0xda, 0x5a, 0x75, 0x49, 0x63, 0xbf, 0x72, 0x49, 0x43, 0x59, 0x04, 0xaa, 
+  0x25, 0xc7, 0xf7, 0xde, 0x24, 0x0a, 0x5e, 0xb1, 0x53, 0x8f, 0x87, 0xf3, 0x15, 0x90, 0xc4, 0xb3, 
+  0xc1, 0xd4, 0x60, 0x66, 0x45, 0xb5, 0x8c, 0x28, 0x9c, 0x1e, 0x19, 0x38, 0xc2, 0x20, 0x5d, 0x4e, 
+  0x7d, 0x35, 0x31, 0x23, 0xfe, 0xfc, 0xe9, 0xee, 0xa7, 0x9e, 0xf3, 0xe6, 0xe3, 0x89, 0xb3, 0x38, 
+  0xfe, 0xd7, 0xf1, 0xeb, 0xe3, 0xe3, 0x93, 0xee, 0xf1, 0xe8, 0xee, 0x98, 0xfe, 0xa3, 0xdf, 0xc7, 
+  0xa3, 0xe3, 0x13, 0x18, 0x4f, 0x60, 0x47, 0x50, 0xb8, 0xeb, 0x7b, 0x53, 0x37, 0xea, 0xfc, 0x1a, 
+  0xcc, 0x41, 0x86, 0x1d, 0x7b, 0x0e, 0xf2, 0x27, 0xf0, 0x50, 0x32, 0xae, 0x72, 0xca, 0xe2, 0x8c, 
+  0x65, 0xf7, 0x6b, 0x2e, 0x38, 0x54, 0x4e, 0x6e, 0x29, 0xee, 0xf9, 0xb6, 0x7a, 0xc0, 0x5d, 0x78, 
+  0x9b, 0xf2, 0x9d, 0x9d, 0x8a, 0x57, 0xa2, 0x68, 0x99, 0x32, 0xa2, 0x2e, 0x84, 0xab, 0x1e, 0x11, 
+  0x19, 0x86, 0x90, 0xc5, 0x1b, 0xa9, 0xd8, 0x3f, 0x08, 0xcd, 0x2e, 0xf7, 0x9c, 0xb2, 0x30, 0x05, 
+  0x5e, 0x1a, 0x14, 0xdc, 0x77, 0x32, 0x93, 0x17, 0x83, 0xf6, 0x46, 0xcb, 0x00, 0x77, 0x08, 0x70, 
+  0xeb, 0x3a, 0x79, 0x9f, 0x95, 0x75, 0xd8, 0x90, 0xf5, 0x64, 0x91, 0x8a, 0x2a, 0x58, 0x75, 0x98, 
+  0x36, 0x02, 0xb6, 0xfb, 0x37, 0x56, 0xf8, 0xcf, 0xa7, 0x9d, 0x05, 0xd1, 0x5a, 0x40, 0x35, 0x7d, 
+  0x2f, 0xc9, 0x5e, 0x24, 0x05, 0xf7, 0x36, 0xd6, 0xec, 0x76, 0xd8, 0x97, 0x92, 0xf6, 0x0c, 0x2c, 
+  0x33, 0x96, 0x4e, 0x69, 0x45, 0x9a, 0xfd, 0xc8, 0x5a, 0x58, 0x0d, 0x2f, 0x69, 0xf7, 0xb5, 0x6c, 
+  0x30, 0x19, 0x93, 0x26, 0x2c, 0x49, 0x10, 0xa3, 0x00, 0x8c, 0xc8, 0xf3, 0x60, 0xab, 0x9a, 0x80, 
+  0x8e, 0x88, 0xa7, 0x46, 0xa9, 0xe1, 0x51, 0xf3, 0x2a, 0xde, 0x99, 0x83, 0x45, 0x31, 0xe5, 0x3e, 
+  0x04, 0x24, 0x5c, 0x04, 0x13, 0x42, 0xd8, 0x1d, 0xb0, 0x0d, 0x1e, 0xbf, 0x8d, 0x38, 0xd6, 0xab, 
+  0xbb, 0x12, 0xae, 0x31, 0xac, 0x7c, 0x85, 0xb5, 0xff, 0xdd, 0x22, 0xa8, 0x44, 0xb7, 0xfc, 0x10, 
+  0x0c, 0xa3, 0xf2, 0xa3, 0xa4, 0xb9, 0x6c, 0x1d, 0xd8, 0xd9, 0x68, 0xfa, 0x6f, 0xec, 0x93, 0x37, 
+  0x3b, 0xc1, 0x86, 0xb2, 0x9f, 0x89, 0xfd, 0x07, 0xb0, 0x7b, 0x3f, 0x3c, 0xb6, 0x3b, 0x4b, 0x46, 
+  0xf4, 0xa4, 0x51, 0xad, 0xf1, 0xbc, 0x4d, 0x70, 0xbc, 0x0b, 0x41, 0xcc, 0xf6, 0x00, 0x85, 0x1b, 
+  0xbe, 0xfa, 0xe1, 0x51, 0x6b, 0x1c, 0x72, 0xd8, 0xe3, 0xc0, 0xfe, 0x99, 0xaf, 0xca, 0xab, 0x1c, 
+  0x7a, 0x93, 0x66, 0xd5, 0xc9, 0x42, 0x4d, 0x42, 0x03, 0xd2, 0xac, 0x2a, 0x51, 0x1c, 0xb7, 0xdc, 
+  0x4c, 0x4a, 0x98, 0xf5, 0x95, 0x89, 0x2d, 0x58, 0x80, 0x59, 0x4d, 0x63, 0x93, 0x84, 0xa5, 0xf8, 
+  0x9e, 0xce, 0xb4, 0xf1, 0xf8, 0x1d, 0x1b, 0xbf, 0x3d, 0xde, 0xeb, 0x43, 0x5a, 0xe1, 0xcd, 0x79, 
+  0x18, 0x80, 0xd3, 0x8a, 0x59, 0x5b, 0x58, 0x1a, 0xd3, 0xd9, 0xf9, 0x56, 0x32, 0x37, 0xcb, 0x46, 
+  0x4b, 0xd8, 0x91, 0x2e, 0x61, 0x95, 0xa8, 0x3e, 0x16, 0x51, 0xc6, 0x90, 0x57, 0x39, 0x0e, 0x9b, 
+  0x70, 0x96, 0xcc, 0xdd, 0x9e, 0x81, 0x95, 0xe7, 0xb8, 0x3a, 0xc5, 0xd0, 0x36, 0xa4, 0x54, 0xac, 
+  0x82, 0xc2, 0x5e, 0x9c, 0x0c, 0x5e, 0xee, 0x0f, 0xfa, 0xcf, 0x06, 0xaf, 0x4f, 0x07, 0x27, 0x2f, 
+  0x06, 0xaf, 0x47, 0x83, 0x17, 0xfb, 0x83, 0x67, 0x2f, 0x07, 0x2f, 0x5f, 0x0c, 0xf0, 0xd5, 0xe9, 
+  0xe0, 0x69, 0x6f, 0x70, 0xf2, 0x74, 0xf0, 0xb2, 0x37, 0x78, 0x7d, 0x3c, 0xe8, 0x1f, 0x0f, 0x7e, 
+  0x3a, 0x1b, 0xbc, 0x7c, 0x3d, 0x78, 0x79, 0x32, 0x38, 0x39, 0x66, 0x25, 0x15, 0xbd, 0xba, 0xa2, 
+  0x0d, 0x12, 0x78, 0xe4, 0x46, 0x5a, 0xd9, 0x46, 0x3e, 0xab, 0x2d, 0xdc, 0xc8, 0x36, 0x1b, 0x95, 
+  0x6e, 0x72, 0x70, 0x0b, 0x41, 0x5d, 0x3e, 0xab, 0x5e, 0xab, 0xd6, 0x20, 0x20, 0x32, 0xa0, 0x19, 
+  0x25, 0x3b, 0x46, 0x06, 0xe2, 0x41, 0x45, 0x86, 0xde, 0x27, 0xd9, 0x92, 0x8b, 0x5f, 0x09, 0x38, 
+  0x65, 0xb7, 0x09, 0xce, 0xe2, 0xdf, 0x3c, 0xa2, 0x39, 0x7c, 0xf0, 0x5b, 0x4a, 0x61, 0x67, 0x32, 
+  0xd4, 0xd9, 0xd6, 0x1c, 0x4d, 0x7d, 0xe5, 0x6d, 0x1d, 0x06, 0xea, 0xa4, 0xd4, 0xa5, 0x5e, 0x88, 
+  0xe6, 0xa3, 0xfa, 0xb9, 0xad, 0x59, 0xe5, 0xd5, 0xa6, 0xb0, 0xb1, 0xfe, 0xea, 0x93, 0xe8, 0xad, 
+  0x23, 0xa3, 0xd2, 0x36, 0x4b, 0x86, 0x72, 0xed, 0x5d, 0x91, 0x63, 0xb5, 0x77, 0x12, 0xd9, 0x2b, 
+  0x7f, 0x6f, 0x0c, 0x37, 0x28, 0xea, 0xbd, 0xff, 0xd7, 0xe5, 0x65, 0xa3, 0xf8, 0xd2, 0xfd, 0x4f, 
+  0x1c, 0x37, 0x0a, 0x2e, 0xb5, 0x86, 0xba, 0xc9, 0xd4, 0x5f, 0x65, 0x61, 0xa5, 0x40, 0x42, 0x8d, 
+  0x29, 0x55, 0x45, 0xb7, 0xbd, 0x99, 0x5f, 0xb6, 0x74, 0x19, 0xfb, 0xf3, 0xb9, 0xc3, 0x3b, 0xf8, 
+  0xac, 0x4d, 0xeb, 0x90, 0xbb, 0x0c, 0xcd, 0xf4, 0x7b, 0x18, 0xe4, 0x1c, 0xba, 0xec, 0xe4, 0xd7, 
+  0xdd, 0x75, 0x42, 0x54, 0xac, 0x6b, 0x2b, 0x00, 0x92, 0x20, 0x95, 0x8d, 0x89, 0xcc, 0x2c, 0x58, 
+  0x4e, 0x1c, 0x3b, 0x5a, 0x80, 0x79, 0x8a, 0xfd, 0x41, 0x7d, 0xa1, 0xf8, 0x0b, 0xe6, 0x00, 0x7b, 
+  0xb1, 0x1f, 0xd8, 0xd3, 0xaf, 0xdd, 0x2f, 0x82, 0x4d, 0x5f, 0x45, 0xe0, 0xd5, 0xa8, 0xd0, 0x0c, 
+  0x46, 0xaf, 0x53, 0x55, 0x33, 0x6b, 0xb5, 0xd4, 0x44, 0x99, 0x48, 0x4a, 0x03, 0x91, 0x2e, 0x96, 
+  0x3d, 0x85, 0x2e, 0x49, 0xa8, 0x94, 0xe9, 0x67, 0x17, 0x44, 0x8d, 0xf5, 0x9f, 0x6b, 0xd8, 0x64, 
+  0x15, 0x26, 0xda, 0x86, 0x80, 0x39, 0x54, 0xe8, 0x3b, 0x2c, 0x5a, 0x4e, 0x70, 0xe3, 0xec, 0x84, 
+  0x47, 0x1b, 0x4e, 0x1c, 0x77, 0xa6, 0x75, 0x6d, 0xaf, 0xfb, 0x05, 0xf7, 0x1a, 0x98, 0x9e, 0xf5, 
+  0x17, 0xa3, 0x40, 0x82, 0xde, 0x77, 0xe3, 0x51, 0x9e, 0x12, 0x7f, 0x05, 0xac, 0xde, 0x8c, 0x74, 
+  0xe6, 0x04, 0x0a, 0x6b, 0xc0, 0x37, 0x06, 0x90, 0x2f, 0xf0, 0xad, 0x65, 0x92, 0x46, 0xf1, 0x41, 
+  0xd5, 0x13, 0x48, 0x7f, 0xa9, 0xe9, 0x23, 0x62, 0xdf, 0x7d, 0xfc, 0x99, 0x3d, 0x67, 0x07, 0xfb, 
+  0x45, 0x22, 0xac, 0x29, 0xab, 0x56, 0x98, 0x21, 0x51, 0x71, 0x53, 0xc3, 0xd7, 0x86, 0xd9, 0x25, 
+  0x01, 0x7a, 0xac, 0xec, 0x92, 0x80, 0x25, 0x20, 0x24, 0x7a, 0xbb, 0xa5, 0x09, 0xde, 0xba, 0xf4, 
+  0xb2, 0x0a, 0xad, 0x8d, 0xa0, 0x6d, 0x90, 0x70, 0x6e, 0x9b, 0x82, 0x36, 0x4c, 0x4a, 0x2b, 0xd3, 
+  0xd4, 0x32, 0xc2, 0x95, 0xa4, 0xaa, 0xb5, 0xb1, 0xa9, 0xa0, 0x95, 0x48, 0x46, 0xd7, 0xc7, 0xb9, 
+  0xeb, 0x95, 0x80, 0xb5, 0x44, 0x4a, 0xd8, 0xda, 0xc5, 0x3c, 0x24, 0x8a, 0x3b, 0xae, 0x1f, 0xfd, 
+  0x67, 0x69, 0x43, 0x50, 0x86, 0x49, 0x25, 0x3e, 0xed, 0xff, 0xb4, 0xdf, 0xe9, 0x3f, 0x7f, 0xd9, 
+  0xe9, 0x77, 0x9e, 0xb6, 0xf2, 0xeb, 0x1a, 0x4d, 0x72, 0x46, 0x55, 0x7a, 0xf5, 0xe8, 0x40, 0xa3, 
+  0x07, 0xf0, 0x5e, 0xb6, 0x4a, 0x6a, 0xa4, 0x17, 0xf0, 0xa8, 0x98, 0xa3, 0xad, 0xa7, 0x8e, 0x38, 
+  0x5d, 0x21, 0x68, 0xe3, 0x2d, 0xdd, 0x09, 0x52, 0xaa, 0x8e, 0x3a, 0x4d, 0x8a, 0x3e, 0xcd, 0x26, 
+  0x11, 0xf2, 0x5f, 0x81, 0x91, 0xd7, 0x4b, 0x4f, 0x1c, 0xb9, 0x80, 0x91, 0xac, 0x74, 0x4e, 0x6a, 
+  0x9f, 0x62, 0x51, 0x7e, 0x32, 0xfc, 0x44, 0x7d, 0x19, 0xc8, 0xc2, 0x6c, 0x0f, 0xf7, 0x07, 0x81, 
+  0x1d, 0x9c, 0xf2, 0x30, 0xb6, 0x67, 0xb8, 0x1e, 0xcb, 0xa3, 0xc1, 0x23, 0x55, 0x29, 0xd7, 0xa0, 
+  0xbb, 0x55, 0xdd, 0x72, 0x6b, 0xda, 0x3d, 0x59, 0x83, 0x4d, 0x5b, 0x5f, 0x91, 0xbb, 0x33, 0x43, 
+  0xdc, 0xce, 0x94, 0x1e, 0x34, 0x70, 0xcd, 0x70, 0x6e, 0x7b, 0xe8, 0x07, 0x06, 0x6c, 0xbf, 0x17, 
+  0xdc, 0xbf, 0x92, 0xab, 0x75, 0x9f, 0x45, 0xbb, 0x27, 0x4f, 0xc4, 0x82, 0xdd, 0x28, 0x23, 0xa3, 
+  0x28, 0xf0, 0xd3, 0xfa, 0x36, 0xb3, 0xa3, 0x24, 0x41, 0xb1, 0x20, 0x51, 0x77, 0x60, 0xcc, 0xe5, 
+  0x7c, 0xc1, 0xe2, 0x05, 0x2e, 0x56, 0x89, 0x3d, 0x27, 0xd0, 0x28, 0xf6, 0x29, 0xa2, 0x63, 0x42, 
+  0xe3, 0x94, 0xe4, 0x6e, 0x1a, 0xae, 0x02, 0x5c, 0xce, 0xca, 0xb5, 0x07, 0xa0, 0x51, 0x8c, 0x8d, 
+  0x6e, 0x97, 0x8e, 0xc7, 0x43, 0x0a, 0x09, 0x01, 0x06, 0x84, 0x0c, 0x7b, 0x88, 0xe9, 0x82, 0xef, 
+  0xb9, 0xb6, 0x65, 0xc1, 0x43, 0x33, 0x8e, 0x21, 0x56, 0x8f, 0x3a, 0x9b, 0xeb, 0x90, 0x51, 0xb2, 
+  0x5b, 0x45, 0x68, 0xe5, 0xc4, 0x31, 0xbd, 0x1b, 0xb6, 0xc7, 0x3c, 0x3f, 0xb7, 0x96, 0x9f, 0xed, 
+  0x59, 0x6b, 0xa8, 0x42, 0xb8, 0x5f, 0xa5, 0x89, 0x79, 0x69, 0x92, 0x4c, 0x14, 0x71, 0xd7, 0xf7, 
+  0x98, 0x6c, 0x86, 0xfb, 0x43, 0x4a, 0x34, 0x88, 0x49, 0xfd, 0x3e, 0x14, 0xad, 0xc5, 0x96, 0x05, 
+  0x1a, 0x15, 0x46, 0xb3, 0xfa, 0x4c, 0x61, 0xd4, 0x92, 0x5c, 0xa3, 0xe1, 0xbe, 0x91, 0xed, 0x18, 
+  0xf2, 0x3a, 0x0d, 0xa7, 0xb6, 0xb1, 0xb7, 0xd4, 0xf1, 0x91, 0x9c, 0x51, 0x1a, 0x46, 0x3d, 0x68, 
+  0x3e, 0x57, 0xbe, 0x13, 0x43, 0xf6, 0xc8, 0x08, 0x33, 0x69, 0x39, 0x9b, 0xce, 0xe6, 0x36, 0x74, 
+  0xa3, 0x06, 0x93, 0x61, 0x0b, 0x1b, 0x4f, 0xc7, 0xa1, 0xf3, 0x4c, 0x8a, 0xac, 0xd4, 0x73, 0xcd, 
+  0x24, 0x13, 0xcc, 0xc8, 0xa8, 0x10, 0x7a, 0x68, 0x1e, 0x6c, 0x17, 0xc2, 0x81, 0x5b, 0x08, 0x81, 
+  0xfd, 0x3b, 0x30, 0x32, 0x53, 0xd3, 0x99, 0x2e, 0x1d, 0x12, 0xfe, 0x88, 0x69, 0x9b, 0x4b, 0x6a, 
+  0x0b, 0x3a, 0x88, 0x7d, 0xc9, 0x8a, 0x5d, 0xf6, 0xb8, 0x72, 0xb5, 0x4e, 0xe9, 0xd9, 0xb4, 0xa2, 
+  0x53, 0x84, 0xba, 0x71, 0x41, 0xa7, 0x90, 0x41, 0x3f, 0xa0, 0x9a, 0x43, 0xb0, 0x36, 0x2d, 0xe5, 
+  0x34, 0x5e, 0x46, 0x94, 0x88, 0x7d, 0x5c, 0xb8, 0xc9, 0x1e, 0xe9, 0xc7, 0x5e, 0x30, 0xf3, 0x17, 
+  0xee, 0xb6, 0x8b, 0x65, 0xd0, 0xb5, 0x51, 0x2d, 0x43, 0x6d, 0xa7, 0x9b, 0x17, 0xed, 0x4d, 0x56, 
+  0xc9, 0xc8, 0xa6, 0xab, 0xd7, 0x33, 0xf2, 0x0b, 0x12, 0x88, 0xfb, 0xd4, 0xef, 0x26, 0x9a, 0x6b, 
+  0x88, 0xe3, 0x99, 0x9e, 0x3f, 0xf3, 0x1d, 0x07, 0x4d, 0xd9, 0x08, 0xc5, 0x93, 0xbd, 0xe5, 0x21, 
+  0x79, 0xc2, 0xff, 0xf1, 0x6d, 0x4f, 0x2e, 0x3b, 0xac, 0x55, 0x6c, 0x1d, 0x65, 0x85, 0xfc, 0xae, 
+  0x58, 0xba, 0x8c, 0x60, 0x28, 0x13, 0x34, 0xcb, 0x76, 0xc9, 0x07, 0x5b, 0xb6, 0x50, 0x19, 0x74, 
+  0xdb, 0xe0, 0x95, 0x29, 0xa8, 0x0e, 0xed, 0xa9, 0x1d, 0xaf, 0xd8, 0x3c, 0xb4, 0xad, 0x0e, 0xfb, 
+  0x0c, 0x6e, 0x05, 0x44, 0x38, 0x84, 0x07, 0x90, 0xc2, 0xb3, 0xa5, 0x17, 0x2d, 0x23, 0x3c, 0xdc, 
+  0x48, 0xd3, 0x15, 0xba, 0x17, 0x80, 0x1b, 0x8a, 0x23, 0x46, 0xd9, 0x80, 0xef, 0xed, 0x32, 0x7f, 
+  0x19, 0x32, 0x74, 0x86, 0x38, 0xd4, 0x94, 0xdb, 0xa0, 0xa3, 0x26, 0xb8, 0x28, 0x19, 0x4e, 0xc8, 
+  0x00, 0x01, 0xd5, 0x0d, 0x22, 0x02, 0x5c, 0x54, 0xed, 0x6c, 0x3e, 0x2d, 0x3c, 0x40, 0xb1, 0x70, 
+  0xd9, 0x5b, 0x18, 0x49, 0x3d, 0x5a, 0x56, 0x55, 0xe1, 0xc3, 0xce, 0x10, 0xa9, 0x84, 0xc6, 0x26, 
+  0xf5, 0xbc, 0xd2, 0x11, 0xcb, 0x36, 0x66, 0xd7, 0x9a, 0x47, 0x80, 0x72, 0x93, 0x2d, 0x39, 0x3c, 
+  0x34, 0x2c, 0xc8, 0xe1, 0x14, 0xc5, 0xa1, 0xef, 0xcd, 0x87, 0xbf, 0x8c, 0x8f, 0x21, 0x08, 0x18, 
+  0x01, 0x34, 0x10, 0x4d, 0xcf, 0x36, 0x81, 0x09, 0xce, 0x0a, 0x66, 0x2a, 0xde, 0x2a, 0xb1, 0xba, 
+  0x0c, 0x01, 0xf1, 0xb4, 0x0c, 0x18, 0x9f, 0xc1, 0xb3, 0xe7, 0x9d, 0xfd, 0x67, 0xff, 0x80, 0xe4, 
+  0x15, 0xfe, 0xf7, 0x2a, 0xf0, 0x23, 0x12, 0x85, 0x01, 0x48, 0xa2, 0x89, 0x3b, 0xff, 0x21, 0x30, 
+  0x3c, 0xb4, 0x67, 0x21, 0x84, 0x4b, 0x42, 0x69, 0x13, 0xd1, 0xc5, 0x63, 0xaa, 0x3c, 0xec, 0xdc, 
+  0x82, 0x00, 0xf9, 0xb4, 0xf4, 0x76, 0x0b, 0xe1, 0xae, 0xdf, 0xed, 0xf7, 0x7f, 0x7a, 0xda, 0xff, 
+  0xe9, 0xe5, 0x8b, 0x67, 0x69, 0xa4, 0x99, 0x42, 0x34, 0x27, 0x91, 0xef, 0x2c, 0x63, 0xfe, 0x0a, 
+  0x83, 0xce, 0xde, 0x2b, 0xd4, 0x53, 0xf8, 0x4b, 0xec, 0xa5, 0xea, 0xf7, 0x7a, 0xff, 0x78, 0x25, 
+  0x0e, 0x01, 0x88, 0x7f, 0x1b, 0x8c, 0xc6, 0x9c, 0x80, 0x9f, 0xe6, 0xa0, 0x67, 0x3d, 0x83, 0xdd, 
+  0xf1, 0xc9, 0x0d, 0xd2, 0x0a, 0x14, 0x03, 0x4f, 0x06, 0x46, 0xd3, 0x90, 0x83, 0x48, 0xba, 0xfe, 
+  0x6f, 0xf9, 0x47, 0xb9, 0xdf, 0xc0, 0x6c, 0x81, 0xbf, 0x8c, 0xc1, 0x0f, 0xc5, 0xf1, 0xef, 0x35, 
+  0xb3, 0xc1, 0xfa, 0x83, 0x7c, 0xf8, 0xab, 0xa8, 0x05, 0x53, 0xaf, 0x8d, 0xd5, 0x8e, 0xfd, 0xcc, 
+  0x57, 0xe0, 0x95, 0x3c, 0x8c, 0x7c, 0xfd, 0x09, 0x1d, 0x07, 0xb6, 0xd8, 0x64, 0xc5, 0x1c, 0x7f, 
+  0x3e, 0xc7, 0xed, 0x03, 0x36, 0xa9, 0x41, 0xa6, 0x9f, 0xbb, 0xa0, 0x0d, 0x31, 0x28, 0x53, 0xb2, 
+  0xbb, 0x88, 0xb4, 0xcd, 0xf1, 0x29, 0x00, 0x47, 0xcd, 0xa4, 0x43, 0xdc, 0xd0, 0x89, 0x0e, 0xa2, 
+  0xb3, 0x31, 0x48, 0xf3, 0x94, 0xb3, 0x8b, 0xd0, 0xc7, 0xf8, 0x3f, 0x32, 0x48, 0x1e, 0x4f, 0xef, 
+  0x4d, 0xdc, 0x30, 0x36, 0x60, 0xc9, 0xe4, 0x60, 0x2c, 0xdb, 0x43, 0xd4, 0xa4, 0x95, 0x17, 0xec, 
+  0xe2, 0xa1, 0x3d, 0x5b, 0xed, 0xc1, 0xd3, 0x3d, 0xd4, 0x89, 0xee, 0xc7, 0xc0, 0x3b, 0xf5, 0xaf, 
+  0x22, 0x2e, 0xd7, 0x6a, 0x86, 0x80, 0xb7, 0xd8, 0xde, 0x91, 0xbc, 0x68, 0xba, 0x30, 0x02, 0x73, 
+  0x81, 0xbe, 0xda, 0xba, 0x88, 0x78, 0x54, 0xbb, 0x2c, 0x22, 0x9a, 0x6c, 0xb4, 0x2a, 0xa2, 0x43, 
+  0x7d, 0xc0, 0x8e, 0xd6, 0xb1, 0xef, 0x98, 0x21, 0xbb, 0xb8, 0x02, 0xf0, 0x40, 0x95, 0xb8, 0x76, 
+  0x43, 0x57, 0x45, 0xdc, 0x54, 0xed, 0x63, 0x04, 0xcc, 0x46, 0x6e, 0x26, 0xd7, 0x54, 0xf7, 0x34, 
+  0xf9, 0x97, 0x99, 0xb3, 0x49, 0xd1, 0x3f, 0x91, 0xe8, 0x3f, 0x52, 0x05, 0x9d, 0xe0, 0x0a, 0x98, 
+  0x6b, 0x8a, 0xe8, 0x72, 0xbf, 0x67, 0xf9, 0xe6, 0xdd, 0xd2, 0x4c, 0x56, 0x66, 0x9b, 0x14, 0xca, 
+  0x81, 0x4f, 0x48, 0x56, 0xfc, 0x3a, 0x22, 0xeb, 0xcc, 0xcd, 0x28, 0xdb, 0x95, 0x6e, 0x7a, 0xe2, 
+  0xdd, 0xc5, 0xd5, 0xde, 0x1c, 0xc4, 0xdf, 0x0f, 0xd9, 0x1b, 0xf0, 0x4e, 0xac, 0xfd, 0xe3, 0x79, 
+  0x77, 0xef, 0x74, 0x87, 0xcd, 0x38, 0x55, 0x40, 0x51, 0xd7, 0x2c, 0xee, 0x60, 0x5f, 0xf8, 0x7d, 
+  0x0b, 0x96, 0x10, 0xc7, 0xe9, 0x54, 0x48, 0x43, 0xf5, 0x0a, 0x80, 0x42, 0x00, 0x81, 0x31, 0x76, 
+  0x3f, 0x59, 0x41, 0xea, 0x08, 0x1e, 0xcc, 0x71, 0xc0, 0x13, 0x5a, 0xbf, 0x82, 0x17, 0xa4, 0x8d, 
+  0x6e, 0x10, 0x97, 0x86, 0xa8, 0xa3, 0x18, 0xc4, 0x58, 0xe8, 0x46, 0xa3, 0x64, 0x0e, 0x73, 0x74, 
+  0x6f, 0xc2, 0xe1, 0x01, 0xbe, 0xfc, 0x9e, 0x0e, 0xb1, 0x09, 0x8f, 0xd9, 0x46, 0xdf, 0x0a, 0x8f, 
+  0xb0, 0xea, 0xb2, 0xd3, 0x51, 0xb7, 0x76, 0xe2, 0xc1, 0x1a, 0x3a, 0xc3, 0xe4, 0xd8, 0xd5, 0x8b, 
+  0xa6, 0xe7, 0x33, 0x32, 0xf1, 0xd9, 0x50, 0x34, 0x7f, 0xf3, 0xd6, 0xb4, 0x1d, 0xa1, 0x25, 0x2a, 
+  0x62, 0x90, 0x5d, 0xbb, 0xbe, 0x85, 0xb1, 0x31, 0x1a, 0xa0, 0x04, 0x4b, 0x90, 0xa2, 0x12, 0x44, 
+  0x3b, 0x4a, 0xac, 0x27, 0x4f, 0x54, 0xad, 0xc1, 0x83, 0x26, 0x42, 0x5c, 0x60, 0x6d, 0x61, 0xf0, 
+  0xc1, 0xaf, 0x9f, 0xbb, 0x38, 0x31, 0xd6, 0x65, 0x1e, 0x9f, 0x93, 0x2f, 0x01, 0xd3, 0x44, 0x53, 
+  0x15, 0x88, 0x02, 0x46, 0x15, 0xb8, 0x26, 0xa5, 0x02, 0x05, 0xe1, 0x55, 0xd6, 0x16, 0x91, 0x56, 
+  0xc9, 0xb8, 0x39, 0xb6, 0x78, 0xe2, 0x92, 0xca, 0x0d, 0x0e, 0xe7, 0x01, 0xba, 0x40, 0x31, 0x3a, 
+  0xda, 0x63, 0x39, 0x34, 0xfc, 0x9b, 0xdd, 0x61, 0xc8, 0x93, 0x52, 0xa7, 0xab, 0xb3, 0x6e, 0xc8, 
+  0x5c, 0x68, 0xa2, 0x20, 0xdd, 0x69, 0x8e, 0xc1, 0x48, 0x1b, 0x2c, 0x30, 0x21, 0x48, 0xc2, 0xa5, 
+  0x6e, 0x0a, 0xbc, 0xd4, 0x31, 0xac, 0xd0, 0x0f, 0x22, 0x40, 0x06, 0xdc, 0x19, 0xbd, 0xf4, 0x6c, 
+  0x57, 0x23, 0x13, 0xd8, 0x05, 0x08, 0xa9, 0x02, 0x30, 0xe4, 0xbe, 0x85, 0x27, 0x3d, 0x31, 0x98, 
+  0xcb, 0xa1, 0x21, 0x0e, 0xc2, 0x55, 0x21, 0x72, 0x68, 0x0f, 0x3f, 0xf8, 0x31, 0x10, 0xff, 0x3c, 
+  0x6e, 0x01, 0x33, 0xa2, 0x68, 0xe9, 0x52, 0x59, 0xc6, 0x8c, 0x05, 0x89, 0x04, 0x1a, 0x40, 0x28, 
+  0xdb, 0x9b, 0x3a, 0x4b, 0x0b, 0x79, 0x26, 0xe2, 0x43, 0x62, 0x37, 0x32, 0x11, 0x7c, 0xeb, 0x50, 
+  0x2b, 0xcd, 0x07, 0xfa, 0xaa, 0x63, 0xad, 0x11, 0xd5, 0x4d, 0x5a, 0x75, 0x69, 0x50, 0xb3, 0x1a, 
+  0xa5, 0xc7, 0x75, 0xb3, 0x7b, 0x12, 0x08, 0xe4, 0x19, 0x60, 0x76, 0x09, 0xb6, 0x58, 0x9e, 0x4e, 
+  0x6c, 0x11, 0x13, 0x5b, 0x64, 0x33, 0x49, 0xa7, 0x07, 0xcd, 0x96, 0xa5, 0xcb, 0x81, 0xe1, 0xdc, 
+  0xaf, 0x6d, 0x2e, 0xc0, 0x91, 0xf9, 0x11, 0x72, 0xde, 0x15, 0xc2, 0x5d, 0x0f, 0x5b, 0x38, 0xc5, 
+  0x7a, 0xc0, 0xe0, 0xfb, 0x64, 0xc0, 0x2a, 0x9f, 0xd0, 0x2a, 0x49, 0x72, 0x8a, 0x1b, 0xf1, 0x6f, 
+  0x67, 0xf6, 0xf8, 0x33, 0x84, 0x7c, 0x15, 0xa3, 0xe0, 0x6e, 0x7e, 0x33, 0x16, 0xbb, 0xfc, 0xdb, 
+  0xe9, 0x2e, 0x29, 0x12, 0x12, 0x49, 0x79, 0xb1, 0xc1, 0xbc, 0x8d, 0x9e, 0x95, 0x96, 0x3d, 0xe4, 
+  0x56, 0x74, 0x14, 0x94, 0x35, 0x1d, 0x8c, 0x06, 0xe4, 0xe3, 0x53, 0x5f, 0x6e, 0xe7, 0xfc, 0x1d, 
+  0x55, 0x76, 0x94, 0x49, 0x6e, 0x93, 0x60, 0x5d, 0x08, 0xfa, 0x75, 0x48, 0x87, 0x2d, 0xe4, 0x60, 
+  0xc7, 0x45, 0x27, 0xf4, 0xe8, 0xe2, 0x35, 0x44, 0xb6, 0xe4, 0xd7, 0x87, 0xa4, 0xee, 0x08, 0x88, 
+  0x15, 0x4b, 0x3c, 0x62, 0x9d, 0x42, 0x67, 0x2d, 0x36, 0x15, 0x6b, 0x2c, 0xe9, 0xad, 0x23, 0xc8, 
+  0x3f, 0x63, 0xa8, 0x78, 0xb1, 0xc3, 0xae, 0x68, 0x51, 0x68, 0x2a, 0xb9, 0x6f, 0x0c, 0x55, 0x1f, 
+  0xa7, 0xb4, 0x6e, 0xb6, 0xf6, 0x91, 0x21, 0x74, 0x85, 0x60, 0x37, 0xac, 0x35, 0x6d, 0xac, 0x63, 
+  0x65, 0x66, 0x26, 0x75, 0xe7, 0x7a, 0xe5, 0x26, 0xb1, 0xee, 0x35, 0xfe, 0xf3, 0xc1, 0x3a, 0x5a, 
+  0x86, 0x8e, 0x16, 0x32, 0x6c, 0x82, 0x52, 0xce, 0xef, 0xe8, 0x05, 0x91, 0x06, 0x8b, 0x3a, 0xfa, 
+  0xd2, 0x45, 0x89, 0x38, 0x6e, 0x29, 0xb1, 0x32, 0x4a, 0x8a, 0x5c, 0xdf, 0x8f, 0x31, 0x14, 0x96, 
+  0x05, 0xf2, 0xcd, 0x32, 0x54, 0x39, 0xb6, 0xe8, 0x7a, 0x9d, 0xc2, 0xba, 0x16, 0x47, 0x2d, 0x1a, 
+  0xad, 0x09, 0xc9, 0xba, 0x5e, 0xaf, 0xf3, 0xd4, 0x40, 0xef, 0x48, 0x59, 0x9b, 0x6b, 0xde, 0x1f, 
+  0x19, 0x7d, 0x4c, 0x06, 0x79, 0x80, 0xaf, 0x7a, 0xfd, 0x75, 0x65, 0x3e, 0x3c, 0x98, 0x60, 0xba, 
+  0xfe, 0xd2, 0x8b, 0xc9, 0xa7, 0xa1, 0xdf, 0xe3, 0x77, 0x22, 0x62, 0x20, 0xc5, 0x40, 0x3e, 0x41, 
+  0xe6, 0x8a, 0x7f, 0xe1, 0x4b, 0x81, 0xb7, 0x12, 0x1d, 0x08, 0xa7, 0x15, 0xfa, 0x8e, 0x43, 0xa4, 
+  0x80, 0xb7, 0x58, 0x34, 0x6c, 0x92, 0xf1, 0xff, 0x61, 0xfc, 0xb1, 0xf8, 0xd4, 0x5c, 0x6d, 0xc5, 
+  0x1e, 0xea, 0xf9, 0x40, 0xee, 0xf4, 0x9e, 0x7d, 0x6b, 0xf6, 0x84, 0xdc, 0xc5, 0x92, 0xec, 0x7f, 
+  0x0f, 0x87, 0xde, 0xdb, 0x10, 0x5b, 0x2d, 0xd3, 0xe8, 0x0a, 0x5d, 0xde, 0x56, 0xec, 0x01, 0xb2, 
+  0x5e, 0x4b, 0xc7, 0x85, 0x30, 0x36, 0xe1, 0xcb, 0xf3, 0x5e, 0x2f, 0xcf, 0x16, 0x71, 0x79, 0x9c, 
+  0xe4, 0x4d, 0xbf, 0xd7, 0x84, 0x33, 0xae, 0x9c, 0x88, 0xc2, 0x21, 0xac, 0xf0, 0xb5, 0x23, 0x8e, 
+  0x45, 0xbe, 0x68, 0x07, 0x79, 0x92, 0x4c, 0x12, 0x57, 0xdf, 0xc0, 0x2e, 0xfb, 0x40, 0xd0, 0x74, 
+  0xc7, 0x25, 0x26, 0x4b, 0xf8, 0x22, 0x97, 0x12, 0x77, 0xd8, 0xe5, 0x02, 0xc2, 0x40, 0xac, 0x63, 
+  0x2c, 0xb8, 0x13, 0x88, 0x61, 0x6c, 0xbc, 0x56, 0x8d, 0x43, 0x33, 0x2c, 0x51, 0xc4, 0x9c, 0x40, 
+  0x51, 0x67, 0x8c, 0x1d, 0x3b, 0x4d, 0xd8, 0x69, 0x47, 0xa7, 0x22, 0x46, 0x38, 0x4e, 0x64, 0xa3, 
+  0xf6, 0x4c, 0xa4, 0xc0, 0xa5, 0xa4, 0x4e, 0xaf, 0xbe, 0xa8, 0xac, 0xd4, 0x6b, 0xbd, 0x9b, 0xd6, 
+  0x19, 0xca, 0x20, 0xd7, 0x56, 0x1a, 0x2a, 0x0e, 0xa0, 0x1c, 0x54, 0x1e, 0x40, 0x49, 0x6f, 0x5f, 
+  0xab, 0x8a, 0x66, 0xd2, 0x40, 0x0c, 0xa8, 0x25, 0xd2, 0x6c, 0x25, 0xf1, 0x86, 0xff, 0xef, 0x61, 
+  0xa9, 0x8b, 0x4a, 0xee, 0xfa, 0xb1, 0x4b, 0x0c, 0xe0, 0xa9, 0x43, 0xed, 0xd1, 0xcb, 0x64, 0xef, 
+  0x20, 0xfe, 0xcd, 0x9b, 0x1f, 0xbe, 0x7c, 0x52, 0x75, 0xeb, 0xd8, 0x03, 0x90, 0x4b, 0x2f, 0xc3, 
+  0xa1, 0x8a, 0x80, 0xd8, 0x91, 0x84, 0x05, 0x4a, 0x4c, 0x9b, 0xf1, 0x49, 0x3a, 0x4c, 0x63, 0x24, 
+  0xf3, 0xa4, 0x6b, 0x74, 0x71, 0x5a, 0xdd, 0xb6, 0x14, 0xb9, 0x39, 0x28, 0xe4, 0xa6, 0xb5, 0xd2, 
+  0x38, 0xf3, 0x09, 0x9f, 0xd4, 0xf7, 0x4d, 0x40, 0xa4, 0x4b, 0x34, 0x6a, 0xff, 0x51, 0xf9, 0x1e, 
+  0x50, 0x75, 0x06, 0x49, 0xd6, 0xd8, 0x6c, 0x14, 0xd9, 0x58, 0x1f, 0x64, 0x13, 0x08, 0x59, 0x6e, 
+  0xac, 0x40, 0x18, 0xcb, 0x87, 0x80, 0xe5, 0xd7, 0x6a, 0x56, 0x8b, 0xb2, 0x5a, 0x7a, 0xfb, 0x0c, 
+  0x3d, 0x19, 0x83, 0xba, 0x61, 0x6c, 0x2b, 0xe4, 0x5d, 0x96, 0xd8, 0xb2, 0x46, 0xa2, 0x1c, 0xd7, 
+  0x40, 0x3c, 0xa9, 0x5f, 0xfe, 0x66, 0xae, 0xd1, 0x32, 0x0c, 0x39, 0x5e, 0x0a, 0x94, 0xdc, 0xcc, 
+  0x25, 0x8e, 0x69, 0x65, 0xbf, 0x2f, 0xb9, 0x1b, 0x28, 0x6f, 0x1d, 0x33, 0x88, 0x50, 0x8c, 0xd4, 
+  0x6b, 0xbb, 0xe8, 0x0f, 0xab, 0xf2, 0x92, 0x25, 0xbc, 0x8f, 0x74, 0x1c, 0xe3, 0x89, 0xaf, 0xb6, 
+  0xc4, 0x09, 0x18, 0x84, 0x5b, 0x70, 0xd1, 0x4a, 0xef, 0xb2, 0xfd, 0x1d, 0xdc, 0xfb, 0xc4, 0x8e, 
+  0xd5, 0xe5, 0x32, 0x79, 0x21, 0xd7, 0x06, 0x20, 0xef, 0x20, 0xfa, 0x02, 0x4b, 0x8d, 0x60, 0x0f, 
+  0x9e, 0x93, 0xf5, 0x4f, 0x21, 0xdf, 0x7c, 0x5e, 0x3c, 0x0c, 0x76, 0x0c, 0x24, 0xe8, 0x0b, 0x84, 
+  0xe1, 0xff, 0x02, 0xe8, 0xf7, 0x16, 0x9f, 0xbf, 0x1a, 0x6d, 0x00, 0x57, 0x4f, 0x0a, 0xb9, 0xa0, 
+  0x63, 0xbe, 0x7b, 0x72, 0xb5, 0x98, 0x64, 0x52, 0x95, 0x76, 0xca, 0xf4, 0x50, 0x17, 0xf8, 0xa2, 
+  0x47, 0x68, 0x92, 0xf5, 0x2f, 0xc0, 0x1e, 0x8f, 0x45, 0x62, 0xb5, 0x61, 0x8a, 0x8f, 0x3d, 0x31, 
+  0x1f, 0x38, 0xe7, 0x0f, 0x48, 0xe7, 0x33, 0x20, 0xe4, 0x50, 0xfe, 0x8b, 0x92, 0xf7, 0xdf, 0x6b, 
+  0x48, 0x53, 0xb4, 0x6e, 0x86, 0xb8, 0xe5, 0x61, 0x61, 0x4f, 0x21, 0x88, 0xcb, 0x59, 0xe4, 0x26, 
+  0xc4, 0x2e, 0x37, 0x24, 0xbf, 0xff, 0xce, 0xda, 0xdb, 0x5a, 0x42, 0x81, 0xd2, 0x67, 0xd3, 0xa6, 
+  0x4b, 0x6e, 0xb0, 0x1e, 0x26, 0xd3, 0xc6, 0x0d, 0xd1, 0xc9, 0x20, 0x12, 0xc0, 0xb4, 0x40, 0x37, 
+  0x0b, 0x7d, 0xf7, 0x11, 0x40, 0x3e, 0x5e, 0x01, 0x84, 0xad, 0xc7, 0x41, 0x8d, 0x91, 0x53, 0xd5, 
+  0x49, 0xf7, 0x75, 0x34, 0x19, 0xf9, 0x56, 0x34, 0x4d, 0x47, 0xbd, 0xaa, 0x19, 0x2d, 0x31, 0x86, 
+  0x89, 0xba, 0x5e, 0x4f, 0x85, 0x2d, 0x96, 0x17, 0x43, 0xd0, 0x21, 0x06, 0x63, 0x48, 0xf3, 0x4f, 
+  0x55, 0x9a, 0x49, 0x7b, 0xdd, 0x04, 0x97, 0x02, 0xe0, 0x92, 0x62, 0xd0, 0x3a, 0xe4, 0x44, 0xba, 
+  0xc4, 0xad, 0xeb, 0x26, 0x58, 0x8e, 0x65, 0xe3, 0x4d, 0x90, 0xac, 0x1e, 0xa0, 0xac, 0x74, 0x55, 
+  0x5a, 0x31, 0xd8, 0xe4, 0x5e, 0x82, 0xd2, 0xc0, 0x45, 0xae, 0x65, 0x49, 0x21, 0xfb, 0x28, 0x36, 
+  0xf6, 0x66, 0xc7, 0xb6, 0x37, 0x88, 0xbf, 0xf3, 0x53, 0x15, 0x41, 0x4f, 0x72, 0xe9, 0x1b, 0x84, 
+  0x55, 0x99, 0xe5, 0xfe, 0x6a, 0x0c, 0x3f, 0xa0, 0xa1, 0x72, 0xf0, 0x5e, 0x87, 0x28, 0xde, 0x49, 
+  0x27, 0xf7, 0xe0, 0xbd, 0x96, 0x59, 0xf1, 0x70, 0x83, 0x3d, 0x95, 0xeb, 0x30, 0x97, 0x40, 0x11, 
+  0x6d, 0x98, 0x38, 0x6b, 0xa7, 0xf9, 0xcd, 0x4e, 0xe9, 0x01, 0x08, 0x15, 0x14, 0x4c, 0x61, 0x91, 
+  0xe9, 0xb7, 0x72, 0x09, 0xdf, 0x9a, 0x20, 0x33, 0x23, 0x56, 0x6d, 0x6a, 0x13, 0xf1, 0x58, 0x44, 
+  0x46, 0xda, 0x2a, 0x5c, 0x4b, 0xa4, 0x65, 0x78, 0xf5, 0x85, 0x72, 0xd3, 0x75, 0x74, 0x9a, 0x25, 
+  0xaf, 0xe3, 0xa6, 0x77, 0x71, 0x54, 0x0c, 0x40, 0x51, 0x5e, 0x1e, 0x7e, 0x66, 0x9c, 0x8d, 0xe1, 
+  0x05, 0xae, 0x4e, 0xe4, 0x73, 0x9d, 0x3c, 0x9d, 0x1f, 0x87, 0x38, 0x8b, 0x90, 0xfd, 0x6f, 0x7a, 
+  0x97, 0xd6, 0x25, 0xa6, 0xad, 0x8e, 0x8d, 0xb7, 0xee, 0xc8, 0x44, 0x9c, 0x5e, 0x16, 0xeb, 0xae, 
+  0xe9, 0x86, 0x78, 0x74, 0x75, 0xef, 0xb0, 0x43, 0xc9, 0xde, 0x77, 0x6d, 0x9f, 0x7b, 0x0b, 0xf7, 
+  0x7e, 0xb6, 0x2a, 0x1b, 0x5d, 0x89, 0x42, 0x6e, 0x8b, 0xaa, 0x19, 0x25, 0xcd, 0x64, 0xa1, 0x37, 
+  0x1d, 0xae, 0xd8, 0x42, 0x70, 0x2d, 0xb9, 0xb7, 0x08, 0x08, 0x79, 0x99, 0xb4, 0xcd, 0x07, 0x3b, 
+  0xa3, 0xba, 0xb4, 0x43, 0x26, 0x1b, 0x98, 0xe9, 0x5a, 0x62, 0xc5, 0xdb, 0x4a, 0x01, 0x89, 0x6b, 
+  0x66, 0xd2, 0x02, 0xb0, 0x72, 0x09, 0x99, 0xbc, 0xa1, 0xa0, 0x92, 0x74, 0x6a, 0xf9, 0xb7, 0x8c, 
+  0x8c, 0xc2, 0xed, 0xfc, 0x81, 0x84, 0x54, 0x06, 0x6c, 0x40, 0xca, 0x51, 0xd6, 0xfa, 0xa1, 0xc4, 
+  0x54, 0x40, 0x95, 0x91, 0x33, 0x31, 0x65, 0x8b, 0x70, 0xc8, 0x4a, 0x4f, 0x8a, 0xe8, 0x52, 0x6f, 
+  0xa4, 0x62, 0xab, 0x5c, 0x4b, 0x42, 0xea, 0x39, 0xc8, 0x1d, 0xad, 0xa5, 0xc2, 0x50, 0xc9, 0xca, 
+  0x01, 0x84, 0xd3, 0x2b, 0xea, 0x3f, 0x16, 0x97, 0xf7, 0xa4, 0x45, 0x88, 0x24, 0xf1, 0x1f, 0x32, 
+  0xb1, 0x9b, 0x2e, 0x39, 0xe5, 0x48, 0x9b, 0xb7, 0x37, 0x86, 0xed, 0x07, 0x65, 0xa0, 0xd3, 0x23, 
+  0xba, 0x65, 0x36, 0x44, 0xae, 0x5a, 0xa5, 0x40, 0x52, 0x03, 0x94, 0xde, 0x41, 0xc5, 0x45, 0xfd, 
+  0x84, 0xc7, 0xad, 0x46, 0xa7, 0x3a, 0x0a, 0x6c, 0x3d, 0x49, 0x61, 0x6b, 0x5c, 0x6d, 0x78, 0x04, 
+  0x85, 0xfe, 0xcb, 0xd0, 0xbb, 0xc2, 0x8d, 0xea, 0x5b, 0xc3, 0x79, 0x92, 0x9a, 0xaa, 0x46, 0x53, 
+  0x49, 0xec, 0x2b, 0xf2, 0x2c, 0x9b, 0x05, 0x26, 0xbc, 0xf5, 0x76, 0x59, 0xb9, 0xda, 0xbd, 0x40, 
+  0xd6, 0x3f, 0x8d, 0x86, 0xdb, 0xce, 0xdd, 0x0f, 0xd4, 0xa9, 0x8f, 0x30, 0xfe, 0x74, 0x8a, 0x57, 
+  0xf4, 0xae, 0xd9, 0x8c, 0xb3, 0x61, 0xc5, 0xb7, 0xf2, 0xde, 0x7b, 0x8a, 0x83, 0x92, 0x0a, 0x40, 
+  0x69, 0xbd, 0x20, 0x5f, 0x1e, 0x28, 0xad, 0x04, 0x50, 0xc5, 0x53, 0x96, 0x2d, 0x06, 0x8f, 0x97, 
+  0xcd, 0x57, 0x25, 0xf3, 0xb9, 0xc1, 0xf1, 0xeb, 0x12, 0x5b, 0x8f, 0x8a, 0x1b, 0xba, 0xd4, 0xda, 
+  0x44, 0xfd, 0x98, 0x69, 0xa6, 0xfe, 0x47, 0xf2, 0x67, 0xcc, 0xbd, 0x08, 0xd2, 0x35, 0xf2, 0x11, 
+  0x51, 0x05, 0x9b, 0x44, 0x9b, 0x8c, 0x4d, 0x57, 0xe2, 0xd8, 0x68, 0x09, 0xaf, 0x2e, 0x6c, 0xc7, 
+  0x8f, 0x1b, 0x90, 0x4b, 0x9e, 0xf4, 0xc6, 0xd6, 0xed, 0xaa, 0x8a, 0x8d, 0x0e, 0x59, 0x66, 0x01, 
+  0xec, 0x83, 0x7f, 0xb7, 0x15, 0x3b, 0x9a, 0x55, 0x89, 0x92, 0x31, 0xd7, 0xdc, 0x8a, 0xa5, 0xe7, 
+  0x67, 0xf2, 0x96, 0x7a, 0x4b, 0x49, 0xed, 0x36, 0xc7, 0x2f, 0x85, 0x05, 0x38, 0xa6, 0x08, 0x5e, 
+  0x3d, 0x10, 0x41, 0x59, 0x6b, 0x92, 0xe8, 0x61, 0xf1, 0xad, 0x3f, 0xf8, 0xc6, 0x35, 0xab, 0xcd, 
+  0x11, 0xdc, 0xd7, 0x10, 0xdc, 0xdf, 0x1a, 0xc1, 0xfd, 0x6f, 0x85, 0xe0, 0x81, 0x86, 0xe0, 0xc1, 
+  0xd6, 0x08, 0x1e, 0x6c, 0x82, 0xe0, 0x7a, 0x63, 0x10, 0xe1, 0x97, 0x3d, 0x36, 0x48, 0x4c, 0xd3, 
+  0x9b, 0xc4, 0xc9, 0x8a, 0x80, 0xbf, 0xd2, 0x4d, 0xc6, 0x2e, 0x25, 0xba, 0x05, 0x43, 0xf2, 0x35, 
+  0xb5, 0x13, 0xca, 0x77, 0x44, 0xd6, 0x54, 0xf9, 0xa9, 0xd8, 0xb5, 0x30, 0xa3, 0x4f, 0x97, 0xa3, 
+  0x64, 0x61, 0x0f, 0x3d, 0xd2, 0x00, 0x94, 0x97, 0xc1, 0x33, 0xf0, 0xb4, 0x71, 0x5a, 0xad, 0x2a, 
+  0x5b, 0x97, 0xd2, 0x03, 0x3a, 0x02, 0xa7, 0xe4, 0x32, 0x6b, 0x87, 0x29, 0xbf, 0x49, 0xa5, 0xea, 
+  0x2e, 0x50, 0x71, 0xb7, 0x67, 0x76, 0x7d, 0xdb, 0x32, 0xf6, 0x5d, 0x70, 0xe3, 0x53, 0x04, 0x95, 
+  0x4f, 0x95, 0xab, 0xc2, 0x3a, 0x81, 0x61, 0x15, 0x0c, 0xf5, 0xc0, 0x78, 0x7d, 0xb5, 0x4a, 0x9b, 
+  0x11, 0xde, 0x38, 0x53, 0xb8, 0x88, 0x0f, 0x5b, 0x5c, 0xff, 0xe6, 0x7b, 0x5c, 0xbc, 0x6f, 0x79, 
+  0x71, 0xd0, 0xa2, 0xad, 0x16, 0xf8, 0x42, 0xec, 0x42, 0x56, 0x69, 0xc1, 0xb0, 0xa9, 0xfa, 0x79, 
+  0x85, 0xea, 0xb4, 0x0d, 0x5b, 0x46, 0x1d, 0xfa, 0xb3, 0x3a, 0xe6, 0x68, 0x94, 0x76, 0x6c, 0x98, 
+  0x7e, 0x94, 0xe4, 0x73, 0x34, 0xc3, 0x62, 0x26, 0xb0, 0x76, 0x65, 0x2e, 0x2f, 0x11, 0x20, 0xb4, 
+  0x62, 0xdd, 0x95, 0xea, 0x87, 0xd5, 0x9b, 0x85, 0x32, 0xe2, 0xa5, 0xbb, 0xe5, 0xe5, 0xd5, 0xa2, 
+  0xe0, 0x2f, 0x82, 0xfb, 0xe2, 0xee, 0x21, 0xd7, 0xf4, 0x96, 0xf8, 0xd5, 0xa9, 0xf7, 0xf4, 0x77, 
+  0xe5, 0xce, 0xa1, 0x49, 0xe8, 0xdf, 0xe1, 0x29, 0xc4, 0xe1, 0x6b, 0xf1, 0x8f, 0xca, 0x86, 0xc0, 
+  0x46, 0x63, 0xcb, 0x9b, 0x18, 0x3f, 0x5c, 0x5e, 0x94, 0xee, 0x45, 0xaa, 0xab, 0x40, 0x5c, 0x92, 
+  0xbc, 0x26, 0x1b, 0xc3, 0xc5, 0xef, 0xea, 0x5d, 0xe1, 0xe2, 0x7d, 0xd5, 0x96, 0x70, 0x49, 0xe2, 
+  0xdc, 0xb6, 0x70, 0x1d, 0x26, 0x45, 0xe1, 0xd4, 0xac, 0x18, 0x8c, 0x2e, 0xc2, 0xec, 0x46, 0x7f, 
+  0x71, 0x09, 0x20, 0x7b, 0x87, 0xb7, 0x10, 0x36, 0x93, 0xda, 0x94, 0xf5, 0xf2, 0x2b, 0x52, 0xd4, 
+  0xb5, 0xc9, 0xa1, 0xfb, 0x8d, 0x24, 0x79, 0x5b, 0x91, 0xce, 0xcb, 0x76, 0x29, 0xb6, 0x0d, 0xba, 
+  0xa7, 0x74, 0x4d, 0x01, 0x24, 0xb9, 0xc6, 0x58, 0x01, 0xd4, 0x6c, 0x41, 0x52, 0xcb, 0xbf, 0x33, 
+  0x84, 0xf0, 0xb7, 0x0a, 0xac, 0xba, 0xb0, 0xf1, 0xde, 0xbc, 0xd7, 0x6a, 0xb2, 0xcd, 0x79, 0x24, 
+  0x6b, 0xb1, 0x8d, 0x79, 0xb4, 0x25, 0x93, 0xb6, 0xe6, 0x52, 0x81, 0x4d, 0x12, 0xe1, 0x91, 0x19, 
+  0x98, 0x78, 0x04, 0xab, 0x09, 0x88, 0xa6, 0xac, 0xc2, 0xe5, 0x96, 0x42, 0x93, 0x91, 0x3e, 0x5e, 
+  0xb3, 0xec, 0xaf, 0x8e, 0xa3, 0x39, 0x80, 0xa5, 0xe5, 0x95, 0x3f, 0x30, 0xd9, 0x48, 0xd7, 0x87, 
+  0x4b, 0xd3, 0x8c, 0x0f, 0xa6, 0xcb, 0xb3, 0x24, 0x83, 0x95, 0x26, 0x18, 0x79, 0x13, 0x91, 0x44, 
+  0x62, 0x6c, 0xdd, 0x42, 0xa9, 0x39, 0x8d, 0xc1, 0x52, 0xab, 0x3c, 0x50, 0x37, 0x59, 0x94, 0x24, 
+  0x1c, 0x42, 0x0b, 0x1e, 0x02, 0x56, 0x6e, 0x66, 0xda, 0x04, 0x4b, 0xd7, 0xf6, 0x46, 0x8a, 0x92, 
+  0x14, 0x73, 0xa3, 0x6f, 0x86, 0xab, 0x79, 0xbf, 0x31, 0xae, 0xe6, 0xfd, 0x36, 0xb8, 0xca, 0x84, 
+  0x73, 0x8c, 0x31, 0xf2, 0xfa, 0x50, 0x3a, 0xf1, 0x7a, 0xd8, 0xba, 0x3e, 0x41, 0x94, 0x70, 0x3f, 
+  0xce, 0x66, 0xe0, 0x7c, 0x1a, 0x03, 0xf6, 0xa9, 0xf9, 0xb6, 0x21, 0xf8, 0x86, 0x4b, 0x43, 0xba, 
+  0xaa, 0xb4, 0x73, 0x5a, 0x04, 0x06, 0x21, 0x0b, 0xa1, 0x4d, 0xc7, 0xb9, 0xe4, 0x51, 0x9c, 0x2d, 
+  0x31, 0xa4, 0xf9, 0xba, 0x39, 0xe3, 0xf1, 0xea, 0x41, 0xc7, 0x89, 0x08, 0xc2, 0x8e, 0x32, 0xe7, 
+  0x74, 0x6d, 0xaa, 0xd1, 0x61, 0x1c, 0xea, 0x4e, 0x2a, 0xfd, 0xd6, 0x0c, 0x2d, 0xba, 0x20, 0x3d, 
+  0xa2, 0x67, 0x8c, 0x16, 0x8d, 0xa2, 0x0e, 0x93, 0xe7, 0xa1, 0x2c, 0x7e, 0x8b, 0x1b, 0x79, 0x39, 
+  0x6b, 0x8b, 0x0f, 0x16, 0xb2, 0x21, 0xd3, 0x2f, 0x33, 0xa6, 0x5d, 0x70, 0xa2, 0x7c, 0xd6, 0x95, 
+  0x76, 0x13, 0xf7, 0x18, 0xe1, 0x31, 0x0c, 0xdc, 0xbe, 0x16, 0x2c, 0x56, 0x11, 0x1e, 0xf0, 0x61, 
+  0xef, 0x46, 0x27, 0x20, 0x5b, 0x2e, 0xf7, 0x96, 0x4c, 0x44, 0x0f, 0x9d, 0x0d, 0xb6, 0x1c, 0x15, 
+  0x28, 0x59, 0x7a, 0x1d, 0x47, 0xe9, 0xa5, 0x1b, 0x1f, 0xfc, 0x18, 0x0f, 0x31, 0x12, 0x32, 0x72, 
+  0x8a, 0x78, 0xbd, 0x4c, 0xc4, 0x70, 0xce, 0x72, 0xa7, 0x5e, 0xfa, 0x61, 0xd3, 0xd8, 0xbc, 0xc1, 
+  0x63, 0x23, 0x71, 0x68, 0xe2, 0x6e, 0x3e, 0xce, 0x26, 0x1c, 0x3f, 0x1f, 0x95, 0x1d, 0x68, 0x59, 
+  0xe1, 0x31, 0xdc, 0x5b, 0xb1, 0x68, 0x9f, 0xe1, 0x9f, 0xb7, 0x81, 0x88, 0x6a, 0x66, 0x03, 0x93, 
+  0x4d, 0x3a, 0x9a, 0x21, 0x2c, 0x2e, 0xac, 0xd1, 0x8e, 0xae, 0x01, 0xfb, 0x49, 0x3d, 0x4d, 0x4e, 
+  0x1b, 0x75, 0x92, 0xfc, 0x0d, 0x84, 0xfa, 0xcd, 0xd9, 0x39, 0x84, 0xc3, 0xce, 0x8c, 0xe1, 0x08, 
+  0x9a, 0x9a, 0x97, 0x2d, 0x11, 0xae, 0xff, 0xf6, 0xe5, 0x66, 0xab, 0x88, 0x29, 0x37, 0xe6, 0x33, 
+  0x1b, 0xb1, 0x40, 0x24, 0x4e, 0xb5, 0xbb, 0x87, 0xb7, 0x5c, 0x59, 0xcc, 0xd9, 0xa4, 0x22, 0x78, 
+  0x11, 0xaf, 0xca, 0x1f, 0x14, 0xb1, 0x9e, 0xc8, 0x0b, 0x53, 0xaa, 0x0d, 0x55, 0x25, 0x85, 0x5f, 
+  0xd4, 0x52, 0x98, 0x70, 0x56, 0xae, 0xa4, 0xfe, 0x13, 0xa9, 0x4c, 0xa8, 0x8c, 0xf0, 0xf9, 0x37, 
+  0xa1, 0x72, 0x01, 0xfc, 0xa3, 0x52, 0xf9, 0x65, 0x1d, 0x95, 0xc7, 0xf1, 0x72, 0x7a, 0x83, 0xf7, 
+  0x2b, 0xc4, 0xe0, 0xce, 0xc0, 0x9e, 0xc4, 0xe2, 0xd2, 0x9a, 0x3f, 0x8f, 0xd6, 0x11, 0x22, 0xf4, 
+  0x09, 0xab, 0xee, 0xdf, 0x82, 0xd4, 0x05, 0xe8, 0x8f, 0x4a, 0xe9, 0x7e, 0xaf, 0x8e, 0xd4, 0x58, 
+  0xed, 0xc2, 0x83, 0x88, 0x4b, 0x30, 0x63, 0x8f, 0x2a, 0xd5, 0xba, 0x1f, 0xcc, 0xb2, 0x77, 0x18, 
+  0x8f, 0x84, 0x6a, 0x9c, 0x5c, 0xa3, 0x26, 0x02, 0xc7, 0x2d, 0x98, 0x92, 0x82, 0xfa, 0x16, 0x3c, 
+  0xc9, 0x03, 0x7f, 0x54, 0x96, 0x3c, 0xab, 0xe3, 0xc8, 0x89, 0x8d, 0xee, 0x94, 0xc6, 0xfe, 0xf3, 
+  0x04, 0xde, 0x42, 0x24, 0xbe, 0x19, 0x71, 0x0b, 0xd0, 0x1f, 0x95, 0xba, 0x4f, 0xeb, 0xa8, 0x7b, 
+  0x85, 0xeb, 0x0b, 0x9f, 0xe4, 0x27, 0x36, 0xfe, 0x3c, 0xfa, 0xde, 0x02, 0x1a, 0x09, 0x16, 0xdf, 
+  0x82, 0xc2, 0x25, 0xf0, 0xb7, 0xa1, 0xb1, 0x5c, 0xc1, 0x13, 0x7b, 0xc7, 0x93, 0x80, 0x65, 0x84, 
+  0xa7, 0x1d, 0x4a, 0x13, 0xb7, 0x37, 0x67, 0xa3, 0xf3, 0xc6, 0x0b, 0x43, 0xf3, 0xd9, 0xd4, 0x9e, 
+  0x22, 0xa8, 0xfa, 0x90, 0xff, 0x83, 0xcf, 0x84, 0xd3, 0x6d, 0x0c, 0xd8, 0xf3, 0xe7, 0x9e, 0xd5, 
+  0x00, 0xb2, 0xe6, 0x65, 0x1a, 0x43, 0x27, 0x63, 0x5d, 0x03, 0xfd, 0x4f, 0x59, 0xe0, 0x4b, 0x82, 
+  0xf4, 0x8a, 0xa4, 0x3b, 0xfb, 0xf0, 0x6d, 0xed, 0x22, 0x6c, 0xf2, 0x2d, 0xa4, 0xc6, 0x89, 0xd5, 
+  0x4c, 0x76, 0xa8, 0xa7, 0xf3, 0x45, 0x72, 0xbb, 0x67, 0x53, 0xb0, 0xda, 0x95, 0x93, 0x55, 0x60, 
+  0x19, 0x5e, 0xbc, 0x09, 0x2f, 0x8f, 0x0c, 0xfd, 0x7b, 0x23, 0x25, 0x1b, 0x45, 0xfe, 0x1a, 0x5f, 
+  0x6e, 0x2a, 0xd3, 0xac, 0xf4, 0x10, 0x06, 0x7e, 0xe7, 0xed, 0xb1, 0xb9, 0x53, 0xfc, 0xee, 0x5b, 
+  0x09, 0x73, 0xce, 0x40, 0x34, 0x17, 0x6c, 0x6c, 0xff, 0xb6, 0xe1, 0x8a, 0x66, 0x72, 0x01, 0x77, 
+  0x14, 0xcc, 0x10, 0x82, 0x58, 0xf5, 0xda, 0x7f, 0xba, 0xcb, 0x7a, 0x54, 0x22, 0xf8, 0x79, 0xcd, 
+  0x4a, 0xef, 0x59, 0xc8, 0x39, 0xfb, 0x74, 0xfc, 0x7e, 0xab, 0x75, 0xb6, 0x19, 0x74, 0xbe, 0x5e, 
+  0x70, 0x33, 0xd8, 0x70, 0x54, 0x55, 0x64, 0xfe, 0x9a, 0x72, 0xb1, 0xd6, 0x78, 0x6c, 0xb2, 0x14, 
+  0xd8, 0x7c, 0x2f, 0x4a, 0xed, 0x9a, 0x61, 0xf9, 0xc6, 0xf0, 0x42, 0xc6, 0xbd, 0xbb, 0xc9, 0xd6, 
+  0x17, 0xfa, 0xaf, 0x74, 0x29, 0x52, 0xad, 0x98, 0x16, 0xc6, 0x48, 0x17, 0x2a, 0xc1, 0x73, 0xe1, 
+  0x7d, 0x41, 0xda, 0x87, 0x92, 0xd6, 0xee, 0xa4, 0x2d, 0x2e, 0x7a, 0x8e, 0x6d, 0xbc, 0xbb, 0xe7, 
+  0xf1, 0xf6, 0xd1, 0xe6, 0x77, 0x83, 0x3f, 0xde, 0x66, 0x5a, 0x15, 0x32, 0x62, 0x9e, 0x7c, 0x18, 
+  0xad, 0x6c, 0x2b, 0x6d, 0xfd, 0xe1, 0xb8, 0xa7, 0x55, 0x87, 0xe3, 0x3e, 0x81, 0xf4, 0x34, 0xf6, 
+  0x39, 0xd5, 0xd7, 0xd0, 0xd1, 0x57, 0x21, 0x93, 0x4f, 0x41, 0xce, 0x39, 0x9e, 0x7b, 0x97, 0x9f, 
+  0x88, 0x0c, 0x4b, 0xec, 0x34, 0xc2, 0x36, 0xd2, 0x55, 0x07, 0xba, 0x67, 0x7b, 0x24, 0x2e, 0x2e, 
+  0xd7, 0x6e, 0x43, 0x5c, 0x7f, 0xcb, 0xa1, 0xf8, 0x1a, 0x24, 0x81, 0x63, 0xe9, 0xd7, 0xd4, 0xf6, 
+  0x2b, 0xbf, 0x9f, 0xe1, 0x5a, 0xcd, 0xbe, 0x30, 0x16, 0x71, 0xcf, 0x52, 0xd5, 0x19, 0xe0, 0x8f, 
+  0x39, 0x72, 0x10, 0xff, 0xcc, 0xef, 0xd4, 0x0d, 0x8a, 0xd6, 0x2b, 0x14, 0x75, 0xc7, 0xa0, 0xfc, 
+  0x83, 0x8f, 0xd5, 0xb7, 0x24, 0x11, 0x25, 0x64, 0x45, 0xed, 0x4c, 0x5e, 0x15, 0x5d, 0xb5, 0x73, 
+  0x27, 0x79, 0x9f, 0xf9, 0x8f, 0x13, 0x2e, 0x2e, 0xd0, 0xca, 0x1e, 0xea, 0xd6, 0xf7, 0xbb, 0xb3, 
+  0xd7, 0x99, 0xdd, 0xc5, 0xc2, 0x1b, 0x7e, 0x94, 0xd1, 0xc1, 0xe1, 0x81, 0xfa, 0x8e, 0x1f, 0xb2, 
+  0x76, 0x6f, 0xef, 0xc5, 0x4e, 0xa9, 0xe1, 0xfe, 0xee, 0xec, 0x24, 0xeb, 0x2a, 0x03, 0x48, 0x26, 
+  0x63, 0x8b, 0xb2, 0xd6, 0xa7, 0x59, 0xeb, 0xe4, 0x7b, 0x56, 0xd5, 0x8d, 0x2f, 0xb2, 0xc6, 0x1f, 
+  0x97, 0x31, 0x31, 0x1e, 0x3f, 0x76, 0x67, 0xc6, 0xec, 0x9e, 0xad, 0x58, 0x72, 0xb7, 0x99, 0x78, 
+  0x18, 0xfb, 0x54, 0x32, 0x6c, 0xe3, 0x1b, 0x7c, 0x50, 0x85, 0xee, 0xa7, 0x0c, 0x26, 0x7d, 0xaa, 
+  0xb0, 0x6e, 0xfc, 0x71, 0xd6, 0xf6, 0x62, 0x29, 0xaf, 0x65, 0xc1, 0x7b, 0xf3, 0x70, 0x8b, 0xf6, 
+  0x36, 0x55, 0x63, 0x85, 0x97, 0x6f, 0x78, 0x9c, 0x48, 0x76, 0x15, 0x1f, 0xdf, 0xf0, 0x78, 0x03, 
+  0x16, 0xbe, 0x39, 0xc8, 0x90, 0x25, 0xe0, 0xe2, 0x2c, 0x02, 0x6d, 0x08, 0x10, 0xfb, 0x7b, 0x59, 
+  0xff, 0xd9, 0x9e, 0x6b, 0x7b, 0xcb, 0x98, 0x47, 0xac, 0xdd, 0xc7, 0x8d, 0x71, 0xbd, 0xec, 0xf7, 
+  0x3e, 0xfc, 0x06, 0xa7, 0x44, 0xdf, 0xa6, 0x2e, 0xa3, 0xc5, 0x9b, 0x63, 0x1d, 0xfc, 0xb1, 0x0b, 
+  0x3a, 0xcd, 0x65, 0x49, 0xbf, 0x2b, 0x0a, 0xf0, 0xbb, 0xc2, 0x39, 0x33, 0x51, 0x5f, 0xaf, 0x80, 
+  0x33, 0xd2, 0xe1, 0xc8, 0xd5, 0x36, 0x36, 0x4d, 0x56, 0xab, 0x42, 0xd3, 0x9b, 0xf3, 0x5d, 0xfa, 
+  0xc4, 0xef, 0x1c, 0x02, 0x96, 0x0a, 0x28, 0x27, 0x3a, 0x14, 0xda, 0xc6, 0x49, 0x6b, 0xcd, 0xe1, 
+  0xae, 0xd8, 0x0d, 0xba, 0x08, 0xc5, 0xdf, 0x78, 0x51, 0x10, 0xa8, 0x26, 0xfc, 0x84, 0x3f, 0x5d, 
+  0xbc, 0xc2, 0xb1, 0x14, 0xde, 0xa9, 0x0e, 0x4f, 0x7e, 0x0b, 0x33, 0xda, 0x65, 0x60, 0xf8, 0x22, 
+  0x06, 0x21, 0xcd, 0xbc, 0x0a, 0x93, 0x33, 0xbd, 0xe7, 0xcc, 0x5c, 0x3a, 0x78, 0x36, 0x6b, 0x89, 
+  0x17, 0xc9, 0x41, 0xff, 0xf9, 0xcc, 0x66, 0xa2, 0x74, 0xc6, 0x28, 0x53, 0x60, 0x6d, 0x1b, 0x8f, 
+  0x71, 0xdf, 0x57, 0x88, 0xe7, 0x9b, 0x37, 0x39, 0xf2, 0x08, 0x2e, 0x26, 0x54, 0xc2, 0xc3, 0xde, 
+  0x72, 0xd3, 0xd8, 0x2e, 0x73, 0x6d, 0xc7, 0xb1, 0x09, 0x3f, 0xfa, 0x17, 0x3e, 0xaf, 0x42, 0xf2, 
+  0x6d, 0x29, 0x54, 0xda, 0xa6, 0x8e, 0xb7, 0x0a, 0xdd, 0x7c, 0x5e, 0xa4, 0x14, 0xaf, 0x80, 0xf0, 
+  0x5e, 0x87, 0x80, 0xbb, 0xde, 0xb6, 0x14, 0x80, 0x8f, 0x3a, 0xa4, 0x8f, 0x78, 0x04, 0x44, 0x29, 
+  0x3a, 0x01, 0xe7, 0x78, 0xb4, 0xf0, 0x1d, 0x8b, 0x88, 0x3f, 0xb1, 0x71, 0xda, 0xb6, 0x37, 0x0b, 
+  0x21, 0xd2, 0xb5, 0x2a, 0x20, 0x5e, 0xe8, 0x10, 0x95, 0x12, 0x16, 0xc0, 0x40, 0xa3, 0xe0, 0x4e, 
+  0x83, 0x9f, 0x5e, 0xf6, 0x5e, 0xa6, 0x70, 0x58, 0x1b, 0x2b, 0xfc, 0x89, 0x88, 0xed, 0xb2, 0x11, 
+  0x77, 0x22, 0x7b, 0x19, 0xb1, 0x1f, 0x20, 0x7a, 0xac, 0x62, 0xcc, 0x58, 0x1f, 0x84, 0x6c, 0x01, 
+  0x96, 0xea, 0x39, 0x09, 0x5c, 0x8c, 0xd7, 0x76, 0xd2, 0x81, 0xcc, 0x6b, 0x79, 0xda, 0xbf, 0x02, 
+  0xcc, 0xa5, 0x0e, 0x46, 0x6c, 0x22, 0x5a, 0xe1, 0xf9, 0x7d, 0x17, 0x1c, 0xf2, 0x02, 0x3c, 0xc6, 
+  0x8a, 0xe1, 0x0e, 0x52, 0x26, 0x34, 0x93, 0x09, 0x68, 0x15, 0xc0, 0x7e, 0xc9, 0xe1, 0x24, 0x4e, 
+  0x1f, 0x2c, 0x23, 0x12, 0x0f, 0xb9, 0x03, 0x16, 0x71, 0xa1, 0x7f, 0xd3, 0xed, 0x9b, 0xd7, 0xe6, 
+  0x74, 0xba, 0x74, 0xc5, 0xbd, 0x5e, 0x15, 0x40, 0xaf, 0x72, 0x9c, 0x16, 0x59, 0x03, 0x50, 0x09, 
+  0x63, 0xb0, 0xeb, 0x24, 0xc5, 0x4b, 0xbf, 0xd1, 0x70, 0x2d, 0xd3, 0x8a, 0xad, 0x92, 0x5e, 0xd5, 
+  0xb9, 0xad, 0x37, 0x88, 0xe3, 0x8d, 0x0c, 0xe2, 0xb8, 0x97, 0x4d, 0x04, 0x81, 0xa3, 0x20, 0xe0, 
+  0x35, 0x35, 0xbb, 0x58, 0xd7, 0xf4, 0xa7, 0x8b, 0xd0, 0xc7, 0xbb, 0x19, 0x7a, 0x60, 0xf7, 0xa4, 
+  0x8f, 0xeb, 0x57, 0xb0, 0x7e, 0xdc, 0xd7, 0x01, 0xe1, 0x6e, 0xb6, 0x7f, 0x23, 0xc7, 0xde, 0x13, 
+  0xc7, 0x4e, 0x80, 0x63, 0x78, 0x09, 0x2a, 0x2e, 0xfd, 0x22, 0xc7, 0xc6, 0x44, 0x73, 0x21, 0x62, 
+  0xfb, 0x7b, 0x96, 0x3d, 0x07, 0x1d, 0x73, 0xcd, 0x2a, 0x85, 0x1f, 0xef, 0x17, 0x1c, 0x22, 0x20, 
+  0xd2, 0x65, 0x89, 0x2b, 0x05, 0x04, 0x53, 0x5b, 0x8b, 0xb7, 0x8b, 0x4e, 0xe4, 0x6d, 0x76, 0xe2, 
+  0xbb, 0xa0, 0xa5, 0x10, 0x0f, 0x74, 0x74, 0x1f, 0xd9, 0x11, 0x8c, 0x8f, 0x75, 0xf0, 0xdb, 0x3a, 
+  0x82, 0xf1, 0x48, 0x87, 0x93, 0x77, 0x04, 0x95, 0x06, 0x49, 0xf4, 0x16, 0x0e, 0x40, 0xa7, 0x1a, 
+  0xd3, 0xc9, 0x26, 0x0a, 0xa7, 0xf4, 0x5d, 0x02, 0x8a, 0xc8, 0x45, 0x8f, 0x3c, 0x1a, 0x67, 0x65, 
+  0xf4, 0xcf, 0x41, 0xc2, 0x75, 0xb4, 0x1c, 0x9c, 0xe2, 0x7c, 0xde, 0x34, 0x01, 0x24, 0x3c, 0x41, 
+  0x1d, 0x98, 0xb7, 0x39, 0xb2, 0x6c, 0x6c, 0xaa, 0xc7, 0x3f, 0xeb, 0x10, 0x14, 0x8d, 0x67, 0x35, 
+  0x9d, 0x45, 0xdf, 0x77, 0x29, 0x59, 0xc7, 0xe4, 0x06, 0xc5, 0xc6, 0x0b, 0x87, 0xb6, 0x1a, 0xb4, 
+  0xfb, 0xdd, 0xfd, 0xee, 0xf1, 0x4e, 0x39, 0x19, 0xdf, 0xeb, 0x83, 0x6e, 0xef, 0x1f, 0xc6, 0x1f, 
+  0x75, 0x48, 0x0f, 0xf7, 0x0f, 0xe3, 0x4f, 0x0d, 0x38, 0x43, 0xc5, 0xbf, 0xbd, 0x90, 0xe2, 0x88, 
+  0x3a, 0xf6, 0x8c, 0x1f, 0x4b, 0x5c, 0x2e, 0xf5, 0x69, 0xaa, 0xb1, 0x0b, 0x59, 0x6a, 0xf9, 0x4f, 
+  0x19, 0xbf, 0x88, 0x47, 0xf8, 0x8f, 0xca, 0x18, 0x66, 0x7c, 0xd5, 0x00, 0x35, 0xac, 0x03, 0xa7, 
+  0x5f, 0x94, 0x2e, 0x99, 0x68, 0xde, 0x70, 0x97, 0xe7, 0x8e, 0x33, 0xdf, 0x8f, 0xc5, 0x37, 0x45, 
+  0xf1, 0xb3, 0x82, 0x90, 0x96, 0x5d, 0xe0, 0xa5, 0x42, 0xe2, 0xa6, 0xc8, 0xfc, 0x87, 0x3c, 0xef, 
+  0xee, 0xee, 0xb4, 0xaf, 0x84, 0x1a, 0x4a, 0xf5, 0xd1, 0x1c, 0x52, 0x44, 0x53, 0xbc, 0x99, 0x1b, 
+  0xdb, 0x93, 0x33, 0x93, 0x17, 0x66, 0x8b, 0x8f, 0x86, 0x52, 0x47, 0x7a, 0x2c, 0x57, 0xa6, 0x10, 
+  0x82, 0x48, 0x0b, 0x93, 0x73, 0xd6, 0xc2, 0x17, 0x89, 0xbb, 0x73, 0xaf, 0x36, 0x2b, 0x87, 0x55, 
+  0xcc, 0x59, 0xbd, 0xb0, 0x18, 0xcc, 0x6f, 0xfe, 0x42, 0x62, 0xed, 0x3e, 0x63, 0xf0, 0x28, 0xf9, 
+  0xf7, 0xdd, 0x89, 0x6f, 0xad, 0xf0, 0xef, 0x45, 0xec, 0x42, 0x62, 0xff, 0xb7, 0xff, 0x03, 0x0f, 
+  0x10, 0xd9, 0x04, 0xed, 0x97, 0x00, 0x00, 0x00 };
@@ -1,3 +1,533 @@
-static const char CONTENT_HOME_JS[] PROGMEM = 
-  "\"use strict\";function OpenEVSEError(e){var t=1<arguments.length&&void 0!==arguments[1]?arguments[1]:\"\";this.type=e,this.message=t}function OpenEVSERequest(){var t=this;t._done=function(){},t._error=function(){},t._always=function(){},t.done=function(e){return t._done=e,t},t.error=function(e){return t._error=e,t},t.always=function(e){return t._always=e,t}}function OpenEVSE(e){var l=this;l._version=\"0.1\",l._endpoint=e,l.states={0:\"unknown\",1:\"not connected\",2:\"connected\",3:\"charging\",4:\"vent required\",5:\"diode check failed\",6:\"gfci fault\",7:\"no ground\",8:\"stuck relay\",9:\"gfci self-test failure\",10:\"over temperature\",11:\"over current\",254:\"sleeping\",255:\"disabled\"},l._lcd_colors=[\"off\",\"red\",\"green\",\"yellow\",\"blue\",\"violet\",\"teal\",\"white\"],l._status_functions={disable:\"FD\",enable:\"FE\",sleep:\"FS\"},l._lcd_types=[\"monochrome\",\"rgb\"],l._service_levels=[\"A\",\"1\",\"2\"],l.STANDARD_SERIAL_TIMEOUT=.5,l.RESET_SERIAL_TIMEOUT=10,l.STATUS_SERIAL_TIMEOUT=0,l.SYNC_SERIAL_TIMEOUT=.5,l.NEWLINE_MAX_AGE=5,l.CORRECT_RESPONSE_PREFIXES=\"$NK\",l.regex=/\\$([^^]*)(\\^..)?/,l._request=function(e){var o=1<arguments.length&&void 0!==arguments[1]?arguments[1]:function(){},t=\"$\"+(Array.isArray(e)?e.join(\"+\"):e),r=new OpenEVSERequest;return $.get(l._endpoint+\"?json=1&rapi=\"+encodeURI(t),function(e){var t=e.ret.match(l.regex);if(null!==t){var n=t[1].split(\" \");\"OK\"===n[0]?(o(n.slice(1)),r._done(n.slice(1))):r._error(new OpenEVSEError(\"OperationFailed\"))}else r._error(new OpenEVSEError(\"UnexpectedResponse\"))},\"json\").always(function(){r._always()}).fail(function(){r._error(new OpenEVSEError(\"RequestFailed\"))}),r},l._flags=function(n){var o=l._request(\"GE\",function(e){var t=parseInt(e[1],16);isNaN(t)?o._error(new OpenEVSEError(\"ParseError\",'Failed to parse \"'+e[0]+'\"')):n({service_level:1+(1&t),diode_check:0==(2&t),vent_required:0==(4&t),ground_check:0==(8&t),stuck_relay_check:0==(16&t),auto_service_level:0==(32&t),auto_start:0==(64&t),serial_debug:0!=(128&t),lcd_type:0!=(256&t)?\"monochrome\":\"rgb\",gfi_self_test:0==(512&t),temp_check:0==(1024&t)})});return o},l.reset=function(){return l._request(\"FR\")},l.time=function(u){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"S1\",e.getFullYear()-2e3,e.getMonth()+1,e.getDate(),e.getHours(),e.getMinutes(),e.getSeconds()],function(){l.time(u)});var c=l._request(\"GT\",function(e){if(6<=e.length){var t=parseInt(e[0]),n=parseInt(e[1]),o=parseInt(e[2]),r=parseInt(e[3]),a=parseInt(e[4]),i=parseInt(e[5]);if(isNaN(t)||isNaN(n)||isNaN(o)||isNaN(r)||isNaN(a)||isNaN(i))c._error(new OpenEVSEError(\"ParseError\",'Could not parse time \"'+e.join(\" \")+'\" arguments'));else if(165==t&&165==n&&165==o&&165==r&&165==a&&85==i)u(new Date(0),!1);else{var s=new Date(2e3+t,n-1,o,r,a,i);u(s,!0)}}else c._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return c},l.timer=function(a){var i=1<arguments.length&&void 0!==arguments[1]&&arguments[1],s=2<arguments.length&&void 0!==arguments[2]&&arguments[2];function u(e){return(e<10?\"0\":\"\")+e}if(!1!==i&&!1!==s){var e=/([01]\\d|2[0-3]):([0-5]\\d)/,t=i.match(e),n=s.match(e);return null!==t&&null!==n&&l._request([\"ST\",parseInt(t[1]),parseInt(t[2]),parseInt(n[1]),parseInt(n[2])],function(){l.timer(a)})}var c=l._request(\"GD\",function(e){if(4<=e.length){var t=parseInt(e[0]),n=parseInt(e[1]),o=parseInt(e[2]),r=parseInt(e[3]);isNaN(t)||isNaN(n)||isNaN(o)||isNaN(r)?c._error(new OpenEVSEError(\"ParseError\",'Could not parse time \"'+e.join(\" \")+'\" arguments')):0===t&&0===n&&0===o&&0===r?a(!1,\"--:--\",\"--:--\"):(i=u(t)+\":\"+u(n),s=u(o)+\":\"+u(r),a(!0,i,s))}else c._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return c},l.cancelTimer=function(e){return l._request([\"ST\",0,0,0,0],function(){e()})},l.time_limit=function(n){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"S3\",Math.round(e/15)],function(){l.time_limit(n)});var o=l._request(\"G3\",function(e){if(1<=e.length){var t=parseInt(e[0]);isNaN(t)?o._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):n(15*t)}else o._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return o},l.charge_limit=function(n){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"SH\",e],function(){l.charge_limit(n)});var o=l._request(\"GH\",function(e){if(1<=e.length){var t=parseInt(e[0]);isNaN(t)?o._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):n(t)}else o._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return o},l.ammeter_settings=function(o){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1],t=2<arguments.length&&void 0!==arguments[2]&&arguments[2];if(!1!==e&&!1!==t)return l._request([\"SA\",e,t],function(){o(e,t)});var r=l._request(\"GA\",function(e){if(2<=e.length){var t=parseInt(e[0]),n=parseInt(e[1]);isNaN(t)||isNaN(n)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):o(t,n)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.current_capacity=function(n){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e)return l._request([\"SC\",e],function(){l.current_capacity(n)});var o=l._request(\"GE\",function(e){if(1<=e.length){var t=parseInt(e[0]);isNaN(t)?o._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):n(t)}else o._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return o},l.service_level=function(t){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];return!1!==e?l._request([\"SL\",l._service_levels[e]],function(){l.service_level(t)}):l._flags(function(e){t(e.auto_service_level?0:e.service_level,e.service_level)})},l.current_capacity_range=function(o){var r=l._request(\"GC\",function(e){if(2<=e.length){var t=parseInt(e[0]),n=parseInt(e[1]);isNaN(t)||isNaN(n)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):o(t,n)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.status=function(o){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1];if(!1!==e){var t=l._status_functions[e];return l._request([t],function(){l.status(o)})}var r=l._request(\"GS\",function(e){if(1<=e.length){var t=parseInt(e[0]),n=parseInt(e[1]);isNaN(t)||isNaN(n)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):o(t,n)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.diode_check=function(t){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF\",\"D\",e?\"1\":\"0\"],function(){l.diode_check(t)}):l._flags(function(e){t(e.diode_check)})},l.gfi_self_test=function(t){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF F\",e?\"1\":\"0\"],function(){l.gfi_self_test(t)}):l._flags(function(e){t(e.gfi_self_test)})},l.ground_check=function(t){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF G\",e?\"1\":\"0\"],function(){l.ground_check(t)}):l._flags(function(e){t(e.ground_check)})},l.stuck_relay_check=function(t){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF R\",e?\"1\":\"0\"],function(){l.stuck_relay_check(t)}):l._flags(function(e){t(e.stuck_relay_check)})},l.vent_required=function(t){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF V\",e?\"1\":\"0\"],function(){l.vent_required(t)}):l._flags(function(e){t(e.vent_required)})},l.temp_check=function(t){var e=1<arguments.length&&void 0!==arguments[1]?arguments[1]:null;return null!==e?l._request([\"FF T\",e?\"1\":\"0\"],function(){l.temp_check(t)}):l._flags(function(e){t(e.temp_check)})},l.over_temperature_thresholds=function(o){var e=1<arguments.length&&void 0!==arguments[1]&&arguments[1],t=2<arguments.length&&void 0!==arguments[2]&&arguments[2];if(!1!==e&&!1!==t)return l._request([\"SO\",e,t],function(){l.over_temperature_thresholds(o)});var r=l._request(\"GO\",function(e){if(2<=e.length){var t=parseInt(e[0]),n=parseInt(e[1]);isNaN(t)||isNaN(n)?r._error(new OpenEVSEError(\"ParseError\",'Could not parse \"'+e.join(\" \")+'\" arguments')):o(t,n)}else r._error(new OpenEVSEError(\"ParseError\",\"Only received \"+e.length+\" arguments\"))});return r},l.press_button=function(e){return l._request(\"F1\",function(){e()})},l.setEndpoint=function(e){l._endpoint=e}}function RapiViewModel(e){var t=this;t.baseEndpoint=e,t.rapiSend=ko.observable(!1),t.cmd=ko.observable(\"\"),t.ret=ko.observable(\"\"),t.send=function(){t.rapiSend(!0),$.get(t.baseEndpoint()+\"/r?json=1&rapi=\"+encodeURI(t.cmd()),function(e){t.ret(\">\"+e.ret),t.cmd(e.cmd)},\"json\").always(function(){t.rapiSend(!1)})}}function TimeViewModel(n){var o=this;function r(e){return(e<10?\"0\":\"\")+e}o.evseTimedate=ko.observable(new Date),o.localTimedate=ko.observable(new Date),o.nowTimedate=ko.observable(null),o.hasRTC=ko.observable(!0),o.elapsedNow=ko.observable(new Date(0)),o.elapsedLocal=ko.observable(new Date),o.divertUpdateNow=ko.observable(new Date(0)),o.divertUpdateLocal=ko.observable(new Date),o.date=ko.pureComputed({read:function(){if(null===o.nowTimedate())return\"\";var e=o.nowTimedate();return e.getFullYear()+\"-\"+r(e.getMonth()+1)+\"-\"+r(e.getDate())},write:function(e){var t=o.evseTimedate();e+=\" \"+r(t.getHours())+\":\"+r(t.getMinutes())+\":\"+r(t.getSeconds()),o.evseTimedate(new Date(e)),o.localTimedate(new Date)}}),o.time=ko.pureComputed({read:function(){if(null===o.nowTimedate())return\"--:--:--\";var e=o.nowTimedate();return r(e.getHours())+\":\"+r(e.getMinutes())+\":\"+r(e.getSeconds())},write:function(e){var t=e.split(\":\"),n=o.evseTimedate();n.setHours(parseInt(t[0])),n.setMinutes(parseInt(t[1])),o.evseTimedate(n),o.localTimedate(new Date)}}),o.elapsed=ko.pureComputed(function(){if(null===o.nowTimedate())return\"0:00:00\";var e=o.elapsedNow().getTime(),t=(e=Math.floor(e/1e3))%60,n=(e=Math.floor(e/60))%60;return Math.floor(e/60)+\":\"+r(n)+\":\"+r(t)}),n.status.elapsed.subscribe(function(e){o.elapsedNow(new Date(1e3*e)),o.elapsedLocal(new Date)}),o.divert_update=ko.pureComputed(function(){if(null===o.nowTimedate())return!1;var e=o.divertUpdateNow().getTime();return Math.floor(e/1e3)}),n.status.divert_update.subscribe(function(e){o.divertUpdateNow(new Date(1e3*e)),o.divertUpdateLocal(new Date)});var a=null;o.automaticTime=ko.observable(!0),o.timeUpdate=function(e){var t=!(1<arguments.length&&void 0!==arguments[1])||arguments[1];o.hasRTC(t),null!==a&&(clearInterval(a),a=null),o.evseTimedate(e),o.nowTimedate(e),o.localTimedate(new Date),a=setInterval(function(){o.automaticTime()&&o.nowTimedate(new Date(o.evseTimedate().getTime()+(new Date-o.localTimedate()))),n.isCharging()&&o.elapsedNow(new Date(1e3*n.status.elapsed()+(new Date-o.elapsedLocal()))),o.divertUpdateNow(new Date(1e3*n.status.divert_update()+(new Date-o.divertUpdateLocal())))},1e3)}}function TimeZoneViewModel(e){this.name=ko.observable(e.name),this.value=ko.observable(e.name+\"|\"+e.tz)}function ZonesViewModel(e){var o=this,t=ko.pureComputed(function(){return e()+\"/zones.json\"});o.fetching=ko.observable(!1),o.zones=ko.mapping.fromJS([],{key:function(e){return ko.utils.unwrapObservable(e.name)},create:function(e){return new TimeZoneViewModel(e.data)}}),o.initialValue=function(e){var t=e.split(\"|\",2);2==t.length?o.zones.push(new TimeZoneViewModel({name:t[0],tz:t[1]})):o.zones.push(new TimeZoneViewModel({name:\"Default\",tz:t[1]}))},o.update=function(){var e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){};o.fetching(!0),$.get(t(),function(e){var t=[];for(var n in e)e.hasOwnProperty(n)&&t.push({name:n,tz:e[n]});ko.mapping.fromJS(t,o.zones)},\"json\").always(function(){o.fetching(!1),e()})}}function DummyRequest(){var t=this;t.always=function(e){return e(),t}}function OpenEvseViewModel(e,t){var r=this,n=ko.pureComputed(function(){return e()+\"/r\"});r.openevse=new OpenEVSE(n()),n.subscribe(function(e){r.openevse.setEndpoint(e)}),r.status=t,r.time=new TimeViewModel(r),r.serviceLevels=[{name:\"Auto\",value:0},{name:\"1\",value:1},{name:\"2\",value:2}],r.currentLevels=ko.observableArray([]),r.timeLimits=[{name:\"none\",value:0},{name:\"15 min\",value:15},{name:\"30 min\",value:30},{name:\"45 min\",value:45},{name:\"1 hour\",value:60},{name:\"1.5 hours\",value:90},{name:\"2 hours\",value:120},{name:\"2.5 hours\",value:150},{name:\"3 hours\",value:180},{name:\"4 hours\",value:240},{name:\"5 hours\",value:300},{name:\"6 hours\",value:360},{name:\"7 hours\",value:420},{name:\"8 hours\",value:480}],r.chargeLimits=[{name:\"none\",value:0},{name:\"1 kWh\",value:1},{name:\"2 kWh\",value:2},{name:\"3 kWh\",value:3},{name:\"4 kWh\",value:4},{name:\"5 kWh\",value:5},{name:\"6 kWh\",value:6},{name:\"7 kWh\",value:7},{name:\"8 kWh\",value:8},{name:\"9 kWh\",value:9},{name:\"10 kWh\",value:10},{name:\"15 kWh\",value:11},{name:\"20 kWh\",value:12},{name:\"25 kWh\",value:25},{name:\"30 kWh\",value:30},{name:\"35 kWh\",value:35},{name:\"40 kWh\",value:40},{name:\"45 kWh\",value:45},{name:\"50 kWh\",value:50},{name:\"55 kWh\",value:55},{name:\"60 kWh\",value:60},{name:\"70 kWh\",value:70},{name:\"80 kWh\",value:80},{name:\"90 kWh\",value:90}],r.serviceLevel=ko.observable(-1),r.actualServiceLevel=ko.observable(-1),r.minCurrentLevel=ko.observable(-1),r.maxCurrentLevel=ko.observable(-1),r.currentCapacity=ko.observable(-1),r.timeLimit=ko.observable(-1),r.chargeLimit=ko.observable(-1),r.delayTimerEnabled=ko.observable(!1),r.delayTimerStart=ko.observable(\"--:--\"),r.delayTimerStop=ko.observable(\"--:--\"),r.gfiSelfTestEnabled=ko.observable(!1),r.groundCheckEnabled=ko.observable(!1),r.stuckRelayEnabled=ko.observable(!1),r.tempCheckEnabled=ko.observable(!1),r.diodeCheckEnabled=ko.observable(!1),r.ventRequiredEnabled=ko.observable(!1),r.allTestsEnabled=ko.pureComputed(function(){return r.gfiSelfTestEnabled()&&r.groundCheckEnabled()&&r.stuckRelayEnabled()&&r.tempCheckEnabled()&&r.diodeCheckEnabled()&&r.ventRequiredEnabled()}),r.tempCheckSupported=ko.observable(!1),r.isConnected=ko.pureComputed(function(){return-1!==[2,3].indexOf(r.status.state())}),r.isReady=ko.pureComputed(function(){return-1!==[0,1].indexOf(r.status.state())}),r.isCharging=ko.pureComputed(function(){return 3===r.status.state()}),r.isError=ko.pureComputed(function(){return-1!==[4,5,6,7,8,9,10,11].indexOf(r.status.state())}),r.isEnabled=ko.pureComputed(function(){return-1!==[0,1,2,3].indexOf(r.status.state())}),r.isSleeping=ko.pureComputed(function(){return 254===r.status.state()}),r.isDisabled=ko.pureComputed(function(){return 255===r.status.state()}),r.selectTimeLimit=function(e){if(r.timeLimit()!==e)for(var t=0;t<r.timeLimits.length;t++){var n=r.timeLimits[t];if(n.value>=e){r.timeLimit(n.value);break}}},r.selectChargeLimit=function(e){if(r.chargeLimit()!==e)for(var t=0;t<r.chargeLimits.length;t++){var n=r.chargeLimits[t];if(n.value>=e){r.chargeLimit(n.value);break}}};var o=[function(){return!1===r.status.time()?r.openevse.time(r.time.timeUpdate):new DummyRequest},function(){return r.openevse.service_level(function(e,t){r.serviceLevel(e),r.actualServiceLevel(t)})},function(){return r.updateCurrentCapacity()},function(){return r.openevse.current_capacity(function(e){r.currentCapacity(e)})},function(){return r.openevse.time_limit(function(e){r.selectTimeLimit(e)})},function(){return r.openevse.charge_limit(function(e){r.selectChargeLimit(e)})},function(){return r.openevse.gfi_self_test(function(e){r.gfiSelfTestEnabled(e)})},function(){return r.openevse.ground_check(function(e){r.groundCheckEnabled(e)})},function(){return r.openevse.stuck_relay_check(function(e){r.stuckRelayEnabled(e)})},function(){return r.openevse.temp_check(function(e){r.tempCheckEnabled(e)})},function(){return r.openevse.diode_check(function(e){r.diodeCheckEnabled(e)})},function(){return r.openevse.vent_required(function(e){r.ventRequiredEnabled(e)})},function(){return r.openevse.temp_check(function(){r.tempCheckSupported(!0)},r.tempCheckEnabled()).error(function(){r.tempCheckSupported(!1)})},function(){return r.openevse.timer(function(e,t,n){r.delayTimerEnabled(e),r.delayTimerStart(t),r.delayTimerStop(n)})}];r.updateCount=ko.observable(0),r.updateTotal=ko.observable(o.length),r.updateCurrentCapacity=function(){return r.openevse.current_capacity_range(function(e,t){r.minCurrentLevel(e),r.maxCurrentLevel(t);var n=r.currentCapacity();r.currentLevels.removeAll();for(var o=r.minCurrentLevel();o<=r.maxCurrentLevel();o++)r.currentLevels.push({name:o+\" A\",value:o});r.currentCapacity(n)})},r.updatingServiceLevel=ko.observable(!1),r.savedServiceLevel=ko.observable(!1),r.updatingCurrentCapacity=ko.observable(!1),r.savedCurrentCapacity=ko.observable(!1),r.updatingTimeLimit=ko.observable(!1),r.savedTimeLimit=ko.observable(!1),r.updatingChargeLimit=ko.observable(!1),r.savedChargeLimit=ko.observable(!1),r.updatingDelayTimer=ko.observable(!1),r.savedDelayTimer=ko.observable(!1),r.updatingStatus=ko.observable(!1),r.savedStatus=ko.observable(!1),r.updatingGfiSelfTestEnabled=ko.observable(!1),r.savedGfiSelfTestEnabled=ko.observable(!1),r.updatingGroundCheckEnabled=ko.observable(!1),r.savedGroundCheckEnabled=ko.observable(!1),r.updatingStuckRelayEnabled=ko.observable(!1),r.savedStuckRelayEnabled=ko.observable(!1),r.updatingTempCheckEnabled=ko.observable(!1),r.savedTempCheckEnabled=ko.observable(!1),r.updatingDiodeCheckEnabled=ko.observable(!1),r.savedDiodeCheckEnabled=ko.observable(!1),r.updatingVentRequiredEnabled=ko.observable(!1),r.savedVentRequiredEnabled=ko.observable(!1);var a=!(r.setForTime=function(e,t){e(!0),setTimeout(function(){e(!1)},t)});function i(e){return/([01]\\d|2[0-3]):([0-5]\\d)/.test(e)}r.subscribe=function(){a||(r.serviceLevel.subscribe(function(e){r.updatingServiceLevel(!0),r.openevse.service_level(function(e,t){r.setForTime(r.savedServiceLevel,2e3),r.actualServiceLevel(t),r.updateCurrentCapacity().always(function(){})},e).always(function(){r.updatingServiceLevel(!1)})}),r.currentCapacity.subscribe(function(t){!0!==r.updatingServiceLevel()&&(r.updatingCurrentCapacity(!0),r.openevse.current_capacity(function(e){r.setForTime(r.savedCurrentCapacity,2e3),t!==e&&r.currentCapacity(e)},t).always(function(){r.updatingCurrentCapacity(!1)}))}),r.timeLimit.subscribe(function(t){r.updatingTimeLimit(!0),r.openevse.time_limit(function(e){r.setForTime(r.savedTimeLimit,2e3),t!==e&&r.selectTimeLimit(e)},t).always(function(){r.updatingTimeLimit(!1)})}),r.chargeLimit.subscribe(function(t){r.updatingChargeLimit(!0),r.openevse.charge_limit(function(e){r.setForTime(r.savedChargeLimit,2e3),t!==e&&r.selectChargeLimit(e)},t).always(function(){r.updatingChargeLimit(!1)})}),r.gfiSelfTestEnabled.subscribe(function(t){r.updatingGfiSelfTestEnabled(!0),r.openevse.gfi_self_test(function(e){r.setForTime(r.savedGfiSelfTestEnabled,2e3),t!==e&&r.gfiSelfTestEnabled(e)},t).always(function(){r.updatingGfiSelfTestEnabled(!1)})}),r.groundCheckEnabled.subscribe(function(t){r.updatingGroundCheckEnabled(!0),r.openevse.ground_check(function(e){r.setForTime(r.savedGroundCheckEnabled,2e3),t!==e&&r.groundCheckEnabled(e)},t).always(function(){r.updatingGroundCheckEnabled(!1)})}),r.stuckRelayEnabled.subscribe(function(t){r.updatingStuckRelayEnabled(!0),r.savedStuckRelayEnabled(!1),r.openevse.stuck_relay_check(function(e){r.savedStuckRelayEnabled(!0),setTimeout(function(){r.savedStuckRelayEnabled(!1)},2e3),t!==e&&r.stuckRelayEnabled(e)},t).always(function(){r.updatingStuckRelayEnabled(!1)})}),r.tempCheckEnabled.subscribe(function(t){r.updatingTempCheckEnabled(!0),r.openevse.temp_check(function(e){r.setForTime(r.savedTempCheckEnabled,2e3),t!==e&&r.tempCheckEnabled(e)},t).always(function(){r.updatingTempCheckEnabled(!1)})}),r.diodeCheckEnabled.subscribe(function(t){r.updatingDiodeCheckEnabled(!0),r.openevse.diode_check(function(e){r.setForTime(r.savedDiodeCheckEnabled,2e3),t!==e&&r.diodeCheckEnabled(e)},t).always(function(){r.updatingDiodeCheckEnabled(!1)})}),r.ventRequiredEnabled.subscribe(function(t){r.updatingVentRequiredEnabled(!0),r.openevse.vent_required(function(e){r.setForTime(r.savedVentRequiredEnabled,2e3),t!==e&&r.ventRequiredEnabled(e)},t).always(function(){r.updatingVentRequiredEnabled(!1)})}),a=!0)},r.update=function(){var e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){};r.updateCount(0),r.nextUpdate(e)},r.nextUpdate=function(e){(0,o[r.updateCount()])().always(function(){r.updateCount(r.updateCount()+1),r.updateCount()<o.length?r.nextUpdate(e):(r.subscribe(),e())})},r.delayTimerValid=ko.pureComputed(function(){return i(r.delayTimerStart())&&i(r.delayTimerStop())}),r.startDelayTimer=function(){r.updatingDelayTimer(!0),r.openevse.timer(function(){r.delayTimerEnabled(!0)},r.delayTimerStart(),r.delayTimerStop()).always(function(){r.updatingDelayTimer(!1)})},r.stopDelayTimer=function(){r.updatingDelayTimer(!0),r.openevse.cancelTimer(function(){r.delayTimerEnabled(!1)}).always(function(){r.updatingDelayTimer(!1)})},r.setStatus=function(e){var t=r.status.state();\"disabled\"===e&&255===t||\"sleep\"===e&&254===t||\"enable\"===e&&t<254||(r.updatingStatus(!0),!r.delayTimerEnabled()||\"sleep\"!==e&&\"enable\"!==e?r.openevse.status(function(e){r.status.state(e)},e).always(function(){r.updatingStatus(!1)}):r.openevse.press_button(function(){e=!1}).always(function(){r.openevse.status(function(e){r.status.state(e)},e).always(function(){r.updatingStatus(!1)})}))},r.restartFetching=ko.observable(!1),r.restart=function(){confirm(\"Restart OpenEVSE? Current config will be saved, takes approximately 10s.\")&&(r.restartFetching(!0),r.openevse.reset().always(function(){r.restartFetching(!1)}))}}function OpenEvseWiFiViewModel(e,t,n){var r=this;r.baseHost=ko.observable(\"\"!==e?e:\"openevse.local\"),r.basePort=ko.observable(t),r.baseProtocol=ko.observable(n),r.baseEndpoint=ko.pureComputed(function(){var e=\"//\"+r.baseHost();return 80!==r.basePort()&&(e+=\":\"+r.basePort()),e}),r.wsEndpoint=ko.pureComputed(function(){var e=\"ws://\"+r.baseHost();return\"https:\"===r.baseProtocol()&&(e=\"wss://\"+r.baseHost()),80!==r.basePort()&&(e+=\":\"+r.basePort()),e+=\"/ws\"}),r.config=new ConfigViewModel(r.baseEndpoint),r.status=new StatusViewModel(r.baseEndpoint),r.rapi=new RapiViewModel(r.baseEndpoint),r.scan=new WiFiScanViewModel(r.baseEndpoint),r.wifi=new WiFiConfigViewModel(r.baseEndpoint,r.config,r.status,r.scan),r.openevse=new OpenEvseViewModel(r.baseEndpoint,r.status),r.zones=new ZonesViewModel(r.baseEndpoint),r.initialised=ko.observable(!1),r.updating=ko.observable(!1),r.scanUpdating=ko.observable(!1),r.wifi.selectedNet.subscribe(function(e){!1!==e&&r.config.ssid(e.ssid())}),r.config.ssid.subscribe(function(e){r.wifi.setSsid(e)}),r.showMqttInfo=ko.observable(!1),r.showSolarDivert=ko.observable(!1),r.showSafety=ko.observable(!1),r.toggle=function(e){e(!e())},r.advancedMode=ko.observable(!1),r.advancedMode.subscribe(function(e){r.setCookie(\"advancedMode\",e.toString())}),r.developerMode=ko.observable(!1),r.developerMode.subscribe(function(e){r.setCookie(\"developerMode\",e.toString()),e&&r.advancedMode(!0)});var o=null,a=null;r.status.time.subscribe(function(e){r.openevse.time.timeUpdate(new Date(e))}),r.timeSource=ko.computed({read:function(){return r.config.sntp_enabled()?\"ntp\":r.openevse.time.automaticTime()?\"browser\":\"manual\"},write:function(e){switch(e){case\"ntp\":r.config.sntp_enabled(!0),r.openevse.time.automaticTime(!0);break;case\"browser\":r.config.sntp_enabled(!1),r.openevse.time.automaticTime(!0);break;case\"manual\":r.config.sntp_enabled(!1),r.openevse.time.automaticTime(!1)}}}),r.time_zone=ko.computed({read:function(){return r.config.time_zone()},write:function(e){void 0!==e&&!1===r.zones.fetching()&&r.config.time_zone(e)}});var i=\"status\";function s(){var e=r.config.emoncms_server().split(\"://\",2);return 1<e.length?e:[r.config.http_supported_protocols()[0],e[0]]}\"\"!==window.location.hash&&(i=window.location.hash.substr(1)),r.tab=ko.observable(i),r.tab.subscribe(function(e){window.location.hash=\"#\"+e}),r.isSystem=ko.pureComputed(function(){return\"system\"===r.tab()}),r.isServices=ko.pureComputed(function(){return\"services\"===r.tab()}),r.isStatus=ko.pureComputed(function(){return\"status\"===r.tab()}),r.isRapi=ko.pureComputed(function(){return\"rapi\"===r.tab()}),r.upgradeUrl=ko.observable(\"about:blank\"),r.wifiPassword=new PasswordViewModel(r.config.pass),r.emoncmsApiKey=new PasswordViewModel(r.config.emoncms_apikey),r.mqttPassword=new PasswordViewModel(r.config.mqtt_pass),r.wwwPassword=new PasswordViewModel(r.config.www_password),r.emoncms_protocol=ko.computed({read:function(){return 0==r.config.http_supported_protocols().length?\"\":s()[0]},write:function(e){0<r.config.http_supported_protocols().length&&r.config.emoncms_server(e+\"://\"+s()[1])}}),r.emoncms_server=ko.computed({read:function(){return 0==r.config.http_supported_protocols().length?r.config.emoncms_server():s()[1]},write:function(e){if(0<r.config.http_supported_protocols().length){var t=e.split(\"://\",2),n=1<t.length?t[0]:s()[0],o=1<t.length?t[1]:e;r.config.emoncms_server(n+\"://\"+o)}else r.config.emoncms_server(e)}}),r.config.mqtt_protocol.subscribe(function(e){switch(e){case\"mqtt\":\"8883\"==r.config.mqtt_port()&&r.config.mqtt_port(\"1883\");break;case\"mqtts\":\"1883\"==r.config.mqtt_port()&&r.config.mqtt_port(\"8883\")}}),r.loadedCount=ko.observable(0),r.itemsLoaded=ko.pureComputed(function(){return r.loadedCount()+r.openevse.updateCount()}),r.itemsTotal=ko.observable(2+r.openevse.updateTotal()),r.start=function(){r.updating(!0),r.status.update(function(){r.loadedCount(r.loadedCount()+1),r.config.update(function(){r.loadedCount(r.loadedCount()+1),r.baseHost().endsWith(\".local\")&&\"\"!==r.status.ipaddress()&&(\"\"===r.config.www_username()?r.baseHost(r.status.ipaddress()):window.location.replace(\"http://\"+r.status.ipaddress()+\":\"+r.basePort())),r.status.rapi_connected()?r.openevse.update(r.finishedStarting):(r.finishedStarting(),r.status.rapi_connected.subscribe(function(e){e&&r.config.update(function(){r.openevse.update(function(){})})}))}),r.connect()}),r.advancedMode(\"true\"===r.getCookie(\"advancedMode\",\"false\")),r.developerMode(\"true\"===r.getCookie(\"developerMode\",\"false\"))},r.finishedStarting=function(){r.initialised(!0),o=setTimeout(r.update,5e3),r.upgradeUrl(r.baseEndpoint()+\"/update\");for(var e=document.getElementsByTagName(\"img\"),t=0;t<e.length;t++)e[t].getAttribute(\"data-src\")&&e[t].setAttribute(\"src\",e[t].getAttribute(\"data-src\"));!1!==r.config.time_zone()&&(r.zones.initialValue(r.config.time_zone()),r.zones.update(function(){r.config.time_zone.valueHasMutated()})),r.updating(!1)};var u=!(r.update=function(){r.updating()||(r.updating(!0),null!==o&&(clearTimeout(o),o=null),r.status.update(function(){o=setTimeout(r.update,5e3),r.updating(!1)}))});r.startScan=function(){r.scanUpdating()||(u=!0,r.scanUpdating(!0),null!==a&&(clearTimeout(a),a=null),r.scan.update(function(){u&&(a=setTimeout(r.startScan,3e3)),r.scanUpdating(!1)}))},r.stopScan=function(){u=!1,r.scanUpdating()||null!==a&&(clearTimeout(a),a=null)},r.wifiConnecting=ko.observable(!1),r.status.mode.subscribe(function(e){\"STA+AP\"!==e&&\"STA\"!==e||r.wifiConnecting(!1),\"STA+AP\"===e||\"AP\"===e?r.startScan():r.stopScan()}),r.saveNetworkFetching=ko.observable(!1),r.saveNetworkSuccess=ko.observable(!1),r.saveNetwork=function(){\"\"===r.config.ssid()?alert(\"Please select network\"):(r.saveNetworkFetching(!0),r.saveNetworkSuccess(!1),$.post(r.baseEndpoint()+\"/savenetwork\",{ssid:r.config.ssid(),pass:r.config.pass()},function(){r.saveNetworkSuccess(!0),r.wifiConnecting(!0)}).fail(function(){alert(\"Failed to save WiFi config\")}).always(function(){r.saveNetworkFetching(!1)}))},r.saveAdminFetching=ko.observable(!1),r.saveAdminSuccess=ko.observable(!1),r.saveAdmin=function(){r.saveAdminFetching(!0),r.saveAdminSuccess(!1),$.post(r.baseEndpoint()+\"/saveadmin\",{user:r.config.www_username(),pass:r.config.www_password()},function(){r.saveAdminSuccess(!0)}).fail(function(){alert(\"Failed to save Admin config\")}).always(function(){r.saveAdminFetching(!1)})},r.advancedGroup=new ConfigGroupViewModel(r.baseEndpoint,function(){return{hostname:r.config.hostname(),sntp_hostname:r.config.sntp_hostname()}}).done(function(){confirm(\"These changes require a reboot to take effect. Reboot now?\")&&$.post(r.baseEndpoint()+\"/restart\",{},function(){setTimeout(function(){var e=\"http://\"+r.config.hostname()+\".local\";80!=r.basePort()&&(e+=\":\"+r.basePort()),e+=\"/\",window.location.replace(e)},5e3)}).fail(function(){alert(\"Failed to restart\")})}),r.saveEmonCmsFetching=ko.observable(!1),r.saveEmonCmsSuccess=ko.observable(!1),r.saveEmonCms=function(){var e={enable:r.config.emoncms_enabled(),server:r.config.emoncms_server(),apikey:r.config.emoncms_apikey(),node:r.config.emoncms_node(),fingerprint:r.config.emoncms_fingerprint()};!e.enable||\"\"!==e.server&&\"\"!==e.node?e.enable&&32!==e.apikey.length&&!r.emoncmsApiKey.isDummy()?alert(\"Please enter valid Emoncms apikey\"):e.enable&&\"\"!==e.fingerprint&&59!==e.fingerprint.length?alert(\"Please enter valid SSL SHA-1 fingerprint\"):(r.saveEmonCmsFetching(!0),r.saveEmonCmsSuccess(!1),$.post(r.baseEndpoint()+\"/saveemoncms\",e,function(){r.saveEmonCmsSuccess(!0)}).fail(function(){alert(\"Failed to save Admin config\")}).always(function(){r.saveEmonCmsFetching(!1)})):alert(\"Please enter Emoncms server and node\")},r.mqttGroup=new ConfigGroupViewModel(r.baseEndpoint,function(){return{mqtt_enabled:r.config.mqtt_enabled(),divert_enabled:r.config.divert_enabled(),mqtt_protocol:r.config.mqtt_protocol(),mqtt_server:r.config.mqtt_server(),mqtt_port:r.config.mqtt_port(),mqtt_reject_unauthorized:r.config.mqtt_reject_unauthorized(),mqtt_topic:r.config.mqtt_topic(),mqtt_user:r.config.mqtt_user(),mqtt_pass:r.config.mqtt_pass(),mqtt_vrms:r.config.mqtt_vrms()}}).validate(function(e){return r.config.mqtt_enabled()||r.config.divert_enabled(!1),!e.mqtt_enabled||\"\"!==e.mqtt_server||(alert(\"Please enter MQTT server\"),!1)}),r.divertGroup=new ConfigGroupViewModel(r.baseEndpoint,function(){return{divert_enabled:r.config.divert_enabled(),mqtt_solar:r.config.mqtt_solar(),mqtt_grid_ie:r.config.mqtt_grid_ie(),divert_attack_smoothing_factor:r.config.divert_attack_smoothing_factor(),divert_decay_smoothing_factor:r.config.divert_decay_smoothing_factor(),divert_min_charge_time:r.config.divert_min_charge_time()}}).validate(function(e){return!e.divert_enabled||\"\"!==e.mqtt_solar||\"\"!==e.mqtt_grid_ie||(alert(\"Please enter either a Solar PV or Grid I/E feed\"),!1)}),r.chargeMode=new ConfigGroupViewModel(r.baseEndpoint,function(){return{charge_mode:r.config.charge_mode()}}),r.isEcoModeAvailable=ko.pureComputed(function(){return r.config.mqtt_enabled()&&(\"\"!==r.config.mqtt_solar()||\"\"!==r.config.mqtt_grid_ie())}),r.ecoMode=ko.pureComputed({read:function(){return\"eco\"===r.config.charge_mode()},write:function(e){r.config.charge_mode(e&&r.config.divert_enabled()?\"eco\":\"fast\"),r.chargeMode.save()}}),r.status.divertmode.subscribe(function(e){switch(e){case 1:r.config.charge_mode(\"fast\");break;case 2:r.config.charge_mode(\"eco\")}}),r.haveSolar=ko.pureComputed(function(){return\"\"!==r.config.mqtt_solar()}),r.haveGridIe=ko.pureComputed(function(){return\"\"!==r.config.mqtt_grid_ie()}),r._divertFeedType=\"grid_ie\",r.divertFeedType=ko.computed({read:function(){var e=r.haveSolar()?\"solar\":r.haveGridIe()?\"grid_ie\":r._divertFeedType;return r._divertFeedType=e},write:function(e){\"solar\"===e&&r.haveGridIe()?(r.config.mqtt_solar(r.config.mqtt_grid_ie()),r.config.mqtt_grid_ie(\"\")):\"grid_ie\"===e&&r.haveSolar()&&(r.config.mqtt_grid_ie(r.config.mqtt_solar()),r.config.mqtt_solar(\"\")),r._divertFeedType=e}}),r.divertFeedValue=ko.computed({read:function(){return\"solar\"===r.divertFeedType()?r.config.mqtt_solar():r.config.mqtt_grid_ie()},write:function(e){\"solar\"===r.divertFeedType()?r.config.mqtt_solar(e):r.config.mqtt_grid_ie(e)}}),r.saveOhmKeyFetching=ko.observable(!1),r.saveOhmKeySuccess=ko.observable(!1),r.saveOhmKey=function(){r.saveOhmKeyFetching(!0),r.saveOhmKeySuccess(!1),$.post(r.baseEndpoint()+\"/saveohmkey\",{enable:r.config.ohm_enabled(),ohm:r.config.ohmkey()},function(){r.saveOhmKeySuccess(!0)}).fail(function(){alert(\"Failed to save Ohm key config\")}).always(function(){r.saveOhmKeyFetching(!1)})},r.setTimeFetching=ko.observable(!1),r.setTimeSuccess=ko.observable(!1),r.setTime=function(){r.setTimeFetching(!0),r.setTimeSuccess(!1);var e=r.openevse.time.automaticTime()?new Date:r.openevse.time.evseTimedate();if(0==r.status.time())r.openevse.openevse.time(function(e){var t=!(1<arguments.length&&void 0!==arguments[1])||arguments[1];r.setTimeFetching(!1),r.setTimeSuccess(t),r.openevse.time.timeUpdate(e,t)},e);else{var t=r.config.sntp_enabled(),n={ntp:t,tz:r.time_zone()};!1===t&&(n.time=e.toISOString()),$.post(r.baseEndpoint()+\"/settime\",n,function(){r.setTimeFetching(!1),r.setTimeSuccess(!0)}).fail(function(){alert(\"Failed to set time\"),r.setTimeFetching(!1)})}},r.turnOffAccessPointFetching=ko.observable(!1),r.turnOffAccessPointSuccess=ko.observable(!1),r.turnOffAccessPoint=function(){r.turnOffAccessPointFetching(!0),r.turnOffAccessPointSuccess(!1),$.post(r.baseEndpoint()+\"/apoff\",{},function(e){console.log(e),\"\"!==r.status.ipaddress()?setTimeout(function(){window.location=\"http://\"+r.status.ipaddress(),r.turnOffAccessPointSuccess(!0)},3e3):r.turnOffAccessPointSuccess(!0)}).fail(function(){alert(\"Failed to turn off Access Point\")}).always(function(){r.turnOffAccessPointFetching(!1)})},r.factoryResetFetching=ko.observable(!1),r.factoryResetSuccess=ko.observable(!1),r.factoryReset=function(){confirm(\"CAUTION: Do you really want to Factory Reset? All setting and config will be lost.\")&&(r.factoryResetFetching(!0),r.factoryResetSuccess(!1),$.post(r.baseEndpoint()+\"/reset\",{},function(){r.factoryResetSuccess(!0)}).fail(function(){alert(\"Failed to Factory Reset\")}).always(function(){r.factoryResetFetching(!1)}))},r.restartFetching=ko.observable(!1),r.restartSuccess=ko.observable(!1),r.restart=function(){confirm(\"Restart OpenEVSE WiFi? Current config will be saved, takes approximately 10s.\")&&(r.restartFetching(!0),r.restartSuccess(!1),$.post(r.baseEndpoint()+\"/restart\",{},function(){r.restartSuccess(!0)}).fail(function(){alert(\"Failed to restart\")}).always(function(){r.restartFetching(!1)}))},r.updateFetching=ko.observable(!1),r.updateComplete=ko.observable(!1),r.updateError=ko.observable(\"\"),r.updateFilename=ko.observable(\"\"),r.updateLoaded=ko.observable(0),r.updateTotal=ko.observable(1),r.updateProgress=ko.pureComputed(function(){return r.updateLoaded()/r.updateTotal()*100}),r.otaUpdate=function(){if(\"\"!==r.updateFilename()){r.updateFetching(!0),r.updateError(\"\");var e=$(\"#upload_form\")[0],t=new FormData(e);$.ajax({url:\"/update\",type:\"POST\",data:t,contentType:!1,processData:!1,xhr:function(){var e=new window.XMLHttpRequest;return e.upload.addEventListener(\"progress\",function(e){e.lengthComputable&&(r.updateLoaded(e.loaded),r.updateTotal(e.total))},!1),e}}).done(function(e){console.log(e),\"OK\"==e?r.updateComplete(!0):r.updateError(e)}).fail(function(){r.updateError(\"HTTP Update failed\")}).always(function(){r.updateFetching(!1)})}else r.updateError(\"Filename not set\")},r.pingInterval=!1,r.reconnectInterval=!1,r.socket=!1,r.connect=function(){r.socket=new WebSocket(r.wsEndpoint()),r.socket.onopen=function(e){console.log(e),r.pingInterval=setInterval(function(){r.socket.send('{\"ping\":1}')},1e3)},r.socket.onclose=function(e){console.log(e),r.reconnect()},r.socket.onmessage=function(e){console.log(e),ko.mapping.fromJSON(e.data,r.status)},r.socket.onerror=function(e){console.log(e),r.socket.close(),r.reconnect()}},r.reconnect=function(){!1!==r.pingInterval&&(clearInterval(r.pingInterval),r.pingInterval=!1),!1===r.reconnectInterval&&(r.reconnectInterval=setTimeout(function(){r.reconnectInterval=!1,r.connect()},500))},r.setCookie=function(e,t){var n=2<arguments.length&&void 0!==arguments[2]&&arguments[2],o=\"\";if(!1!==n){var r=new Date;r.setTime(r.getTime()+24*n*60*60*1e3),o=\";expires=\"+r.toUTCString()}document.cookie=e+\"=\"+t+o+\";path=/\"},r.getCookie=function(e){for(var t=1<arguments.length&&void 0!==arguments[1]?arguments[1]:\"\",n=e+\"=\",o=document.cookie.split(\";\"),r=0;r<o.length;r++){for(var a=o[r];\" \"===a.charAt(0);)a=a.substring(1);if(0===a.indexOf(n))return a.substring(n.length,a.length)}return t}}function scaleString(e,t,n){return((\"number\"==typeof e?e:parseInt(e))/t).toFixed(n)}function formatUpdate(e){if(!1===e)return\"N/A\";var t=e/60,n=e/3600,o=n/24,r=e.toFixed(0)+\"s\";return 0===e.toFixed(0)?r=\"now\":7<o?r=\"inactive\":2<o?r=o.toFixed(1)+\" days\":2<n?r=n.toFixed(0)+\" hrs\":180<e&&(r=t.toFixed(0)+\" mins\"),r}function updateClass(e){if(!1===e)return\"\";var t=\"updateBad\";return(e=Math.abs(e))<25?t=\"updateGood\":e<60?t=\"updateSlow\":e<7200&&(t=\"updateSlower\"),t}!function(){var t=window.location.hostname,n=window.location.port,o=window.location.protocol;$(function(){var e=new OpenEvseWiFiViewModel(t,n,o);ko.applyBindings(e),e.start()})}();\n"
-  "//# sourceMappingURL=home.js.map\n";
+static const char CONTENT_HOME_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x3d, 0x7f, 0x77, 0xdb, 0x36, 
+  0x92, 0xff, 0xef, 0xa7, 0xa0, 0xb1, 0x3d, 0x97, 0xac, 0x18, 0x59, 0x92, 0xe3, 0x34, 0x91, 0xa2, 
+  0xf5, 0xf3, 0x3a, 0x76, 0x93, 0x6b, 0x12, 0xe7, 0x6c, 0x27, 0xbb, 0x7b, 0x5e, 0xaf, 0x1e, 0x2d, 
+  0x41, 0x36, 0x1b, 0x8a, 0xd4, 0x92, 0x94, 0x1d, 0x37, 0xd1, 0x77, 0xbf, 0x19, 0xfc, 0x20, 0x01, 
+  0x10, 0x14, 0xe9, 0x74, 0xd3, 0x77, 0xf7, 0xf6, 0x5e, 0xf3, 0x6a, 0x11, 0x18, 0x0c, 0x66, 0x06, 
+  0x83, 0x01, 0x66, 0x30, 0x20, 0xc9, 0x2a, 0xa3, 0x4e, 0x96, 0xa7, 0xe1, 0x34, 0x27, 0xa3, 0xf9, 
+  0x2a, 0x9e, 0xe6, 0x61, 0x12, 0x3b, 0x27, 0x4b, 0x1a, 0x1f, 0x7d, 0x38, 0x3b, 0x3a, 0x4a, 0xd3, 
+  0x24, 0x75, 0xa9, 0xf7, 0xf9, 0x36, 0x48, 0x9d, 0x7c, 0xdc, 0x7f, 0x1e, 0xa4, 0xd7, 0xab, 0x05, 
+  0x8d, 0xf3, 0xac, 0x1b, 0xd1, 0xf8, 0x3a, 0xbf, 0xd9, 0xde, 0xbe, 0x4d, 0xc2, 0x99, 0xd3, 0xdb, 
+  0x1a, 0x8f, 0x8b, 0xaa, 0x8b, 0xfe, 0xe5, 0xbe, 0xfa, 0x30, 0x24, 0x64, 0x94, 0xdf, 0x84, 0x59, 
+  0x37, 0xbf, 0x5f, 0xd2, 0x31, 0xf5, 0xd9, 0xef, 0x05, 0xcd, 0xb2, 0xe0, 0x9a, 0x8e, 0xf3, 0x75, 
+  0xa5, 0xd3, 0x53, 0xfa, 0xcf, 0x15, 0xcd, 0x72, 0x57, 0xf6, 0x8a, 0xf0, 0xa3, 0xbc, 0x3b, 0x99, 
+  0x25, 0x31, 0x1d, 0x4b, 0x68, 0xa8, 0x5d, 0xfb, 0x50, 0x48, 0x91, 0xc2, 0x4a, 0x69, 0x10, 0xdd, 
+  0x05, 0xf7, 0x99, 0x59, 0xac, 0x23, 0x00, 0xae, 0x52, 0x9a, 0xaf, 0xd2, 0xd8, 0x91, 0xb8, 0x81, 
+  0x34, 0x04, 0x33, 0x50, 0x6a, 0x70, 0xbc, 0x4e, 0x00, 0x9a, 0xbd, 0x68, 0x90, 0xa2, 0x12, 0x41, 
+  0xab, 0x2c, 0x4a, 0x91, 0x46, 0x9c, 0xb9, 0xa8, 0x3b, 0xb9, 0xa5, 0x69, 0x06, 0x10, 0x63, 0xd2, 
+  0xeb, 0xf6, 0x89, 0x0f, 0x05, 0x34, 0x9e, 0x2d, 0x93, 0x30, 0xce, 0x01, 0x43, 0xd4, 0xcd, 0xf2, 
+  0x20, 0xa7, 0xd9, 0xf8, 0x73, 0x6f, 0x48, 0x56, 0xf1, 0xc7, 0x38, 0xb9, 0x8b, 0x89, 0xdf, 0x1f, 
+  0x92, 0x38, 0xc9, 0x9d, 0x69, 0x12, 0xc7, 0x74, 0x9a, 0xd3, 0x19, 0xf1, 0x07, 0x43, 0xa2, 0x3c, 
+  0xed, 0xc2, 0xd3, 0x0d, 0x8c, 0x43, 0x18, 0x5f, 0x13, 0xff, 0xf1, 0x90, 0xdc, 0xc2, 0x70, 0x38, 
+  0x29, 0xc8, 0x36, 0x4c, 0xb1, 0x7a, 0x6f, 0x48, 0x66, 0x61, 0x32, 0xa3, 0xce, 0xf4, 0x86, 0x4e, 
+  0x3f, 0x3a, 0xf3, 0x20, 0x8c, 0xb0, 0xf8, 0xc9, 0x90, 0x5c, 0xcf, 0xa7, 0x21, 0x3c, 0xaf, 0xa2, 
+  0x9c, 0xf8, 0x3f, 0x62, 0x27, 0xce, 0x75, 0x9a, 0xac, 0x62, 0xa8, 0x7c, 0x3a, 0x24, 0x59, 0xbe, 
+  0x02, 0xe8, 0x94, 0x46, 0xc1, 0x3d, 0xf1, 0x9f, 0x09, 0xe0, 0x8c, 0x46, 0xf3, 0x47, 0x40, 0x60, 
+  0xce, 0xd0, 0xac, 0x52, 0x0a, 0xd4, 0x01, 0xa9, 0x09, 0x30, 0xe5, 0xe4, 0x74, 0xb1, 0xa4, 0x69, 
+  0x90, 0xf3, 0xd2, 0xbe, 0x28, 0x9d, 0xae, 0xd2, 0x14, 0xe8, 0x01, 0x9a, 0xf7, 0x80, 0xb4, 0x2c, 
+  0xa2, 0x74, 0xc9, 0xe8, 0x1c, 0xec, 0x31, 0xba, 0xb2, 0xe0, 0x0a, 0xa9, 0x59, 0xa3, 0x20, 0xa2, 
+  0xe9, 0x6c, 0x32, 0x4d, 0xa2, 0x24, 0xcd, 0xc6, 0x17, 0x24, 0x99, 0xcf, 0x89, 0x4f, 0x18, 0x03, 
+  0xe4, 0x3a, 0xa5, 0x14, 0xe4, 0x40, 0xee, 0x69, 0x14, 0x25, 0x77, 0xf0, 0xe3, 0x2a, 0x5a, 0x41, 
+  0x1f, 0xe4, 0x36, 0x4c, 0x22, 0x0a, 0xa8, 0x49, 0x4e, 0x83, 0x08, 0xfe, 0xdc, 0xdd, 0x84, 0x39, 
+  0x25, 0x97, 0x88, 0x0b, 0xe5, 0xb8, 0xca, 0x26, 0x72, 0x3c, 0x40, 0xa2, 0xa2, 0xaf, 0x21, 0x39, 
+  0x7e, 0x41, 0x7c, 0x1a, 0x8b, 0xdf, 0x47, 0xc4, 0x67, 0x34, 0xc1, 0xcf, 0xb3, 0x92, 0x0a, 0xd4, 
+  0x5f, 0x24, 0x62, 0x91, 0xc4, 0xc9, 0xf4, 0x26, 0x4d, 0x16, 0xd8, 0x5b, 0x7a, 0x7d, 0x25, 0x70, 
+  0xd3, 0xf4, 0x36, 0x9c, 0xd2, 0x49, 0x44, 0x6f, 0x69, 0x84, 0x60, 0x07, 0x50, 0x0b, 0x63, 0x49, 
+  0x06, 0xac, 0xfe, 0xec, 0xfc, 0xe0, 0xed, 0x8b, 0x83, 0xd3, 0x17, 0x13, 0x50, 0xf0, 0x57, 0x07, 
+  0xaf, 0x27, 0xe7, 0xaf, 0xde, 0x1c, 0x9d, 0xbc, 0x3f, 0x1f, 0x77, 0xf7, 0xa0, 0xf2, 0xf4, 0xe8, 
+  0xec, 0xe8, 0xdc, 0xac, 0xe9, 0xf7, 0x78, 0xb3, 0xf3, 0xf7, 0x67, 0x66, 0x15, 0xab, 0xf9, 0xdb, 
+  0xdb, 0x43, 0x2b, 0xb2, 0xb7, 0x47, 0x7f, 0x79, 0xfd, 0xea, 0xed, 0xd1, 0xe4, 0xcd, 0xc1, 0x5f, 
+  0x27, 0x07, 0x3f, 0x1d, 0x8d, 0xb1, 0xec, 0xf0, 0xe4, 0xf4, 0xf4, 0xe8, 0xf0, 0x7c, 0x02, 0x1d, 
+  0xbd, 0x3b, 0x79, 0x7b, 0x76, 0x34, 0x79, 0x77, 0x7a, 0x74, 0xfc, 0xea, 0xaf, 0x47, 0x67, 0x63, 
+  0xf2, 0xdd, 0xdb, 0x9f, 0x51, 0xe1, 0x52, 0x7a, 0x4d, 0x3f, 0x8d, 0x77, 0xfe, 0xfe, 0x9d, 0x7b, 
+  0xf1, 0x8f, 0x7f, 0x5c, 0xfe, 0xe0, 0xb9, 0x7f, 0xff, 0x47, 0xb7, 0xeb, 0xed, 0xef, 0x20, 0x6b, 
+  0x29, 0x9f, 0x91, 0x9a, 0xa6, 0xa3, 0xfa, 0x26, 0x5f, 0x6b, 0x11, 0xf4, 0x89, 0x09, 0x34, 0x90, 
+  0x8e, 0x7b, 0x90, 0xa6, 0xc1, 0x7d, 0x37, 0xcc, 0xd8, 0x5f, 0xe8, 0x61, 0x9f, 0x76, 0x7f, 0x81, 
+  0x09, 0xe0, 0x92, 0x0e, 0xf1, 0x86, 0xd4, 0xf3, 0xd3, 0x71, 0x4c, 0xef, 0x4c, 0x23, 0x31, 0x12, 
+  0x13, 0xee, 0xbb, 0xee, 0x35, 0xcd, 0x5d, 0x65, 0xda, 0x74, 0xc8, 0xfe, 0x2f, 0x19, 0xcc, 0xa7, 
+  0xfe, 0x76, 0x1a, 0x2c, 0xc3, 0x31, 0xe9, 0xd0, 0x78, 0x0a, 0xda, 0xfe, 0xfe, 0xf4, 0x95, 0x9b, 
+  0x7b, 0xbe, 0xc9, 0x08, 0xcc, 0x32, 0x10, 0x40, 0xde, 0x5d, 0x04, 0xf9, 0xf4, 0xc6, 0x15, 0xc2, 
+  0xf0, 0x46, 0xe1, 0xdc, 0x8d, 0x57, 0x51, 0x04, 0xac, 0xe4, 0x1c, 0x2e, 0x1e, 0xe7, 0x40, 0x7e, 
+  0x37, 0x5b, 0x46, 0x61, 0xee, 0x12, 0x87, 0x78, 0x23, 0x72, 0xf2, 0x33, 0x19, 0x8f, 0xc7, 0xf1, 
+  0x45, 0xef, 0x72, 0xdf, 0x4d, 0xdc, 0xb8, 0x9b, 0x45, 0xa0, 0x04, 0x6e, 0xdf, 0x03, 0x82, 0xb9, 
+  0x59, 0x51, 0xcb, 0xbc, 0x61, 0x2a, 0x6c, 0x88, 0xab, 0x32, 0xc3, 0xcd, 0x2c, 0x39, 0x61, 0x13, 
+  0x05, 0xc8, 0x3a, 0xe6, 0x93, 0xd1, 0xf3, 0xd6, 0xa0, 0x49, 0xd4, 0xd9, 0xd4, 0xe6, 0x7d, 0x4c, 
+  0x3f, 0x2d, 0xd9, 0x8c, 0x3f, 0xa5, 0xd9, 0x12, 0x54, 0x9a, 0x62, 0x33, 0x9f, 0x20, 0xf3, 0xc4, 
+  0x13, 0x26, 0xca, 0x55, 0xe4, 0x9d, 0x4a, 0xd3, 0xe4, 0x7a, 0x6b, 0xaf, 0x8b, 0xf3, 0xd5, 0xa8, 
+  0xad, 0xed, 0x4a, 0x88, 0xbc, 0x24, 0x0e, 0x58, 0x64, 0x73, 0x63, 0x1e, 0x05, 0xd7, 0x8a, 0x19, 
+  0x8c, 0xa5, 0x72, 0x94, 0x9a, 0xe3, 0x92, 0x9f, 0x60, 0x4a, 0x55, 0xa5, 0xbe, 0x0c, 0xd2, 0x8c, 
+  0xbe, 0x8a, 0x73, 0x97, 0x82, 0x58, 0xfd, 0xfe, 0x13, 0x10, 0x79, 0xf6, 0x36, 0x78, 0x0b, 0x43, 
+  0xb4, 0x9f, 0x6c, 0xa0, 0xe4, 0x1d, 0x36, 0x63, 0xbf, 0x89, 0xff, 0x3d, 0xa7, 0xc7, 0xc9, 0x13, 
+  0x87, 0x61, 0x73, 0xc8, 0xf7, 0x1d, 0x0a, 0xa3, 0xd1, 0xf9, 0x9e, 0x7c, 0x0f, 0xf2, 0x8e, 0xdd, 
+  0xcf, 0xda, 0xc4, 0x1c, 0xf6, 0x3b, 0x6e, 0x7f, 0x1b, 0x54, 0x80, 0x19, 0xbf, 0x09, 0x33, 0x7e, 
+  0xc3, 0xde, 0x78, 0xec, 0x0e, 0xb0, 0x10, 0x6d, 0xe4, 0x44, 0xda, 0x48, 0x56, 0xfc, 0x18, 0x8b, 
+  0xb9, 0xfd, 0x53, 0x80, 0x9f, 0x62, 0x29, 0x33, 0x85, 0x13, 0x66, 0x0a, 0x95, 0xaa, 0xfe, 0x13, 
+  0xac, 0x0b, 0x56, 0x79, 0xa2, 0x5b, 0x04, 0x56, 0xb9, 0x3b, 0x28, 0x2b, 0xf3, 0x20, 0xcd, 0x59, 
+  0xe1, 0x13, 0xd6, 0x07, 0x00, 0x87, 0x41, 0x34, 0x99, 0xd1, 0xab, 0xd5, 0xf5, 0x10, 0x66, 0x8f, 
+  0xdb, 0x1f, 0xb0, 0x5e, 0xa4, 0xe1, 0x61, 0x65, 0x83, 0x3d, 0xc4, 0xbe, 0xaf, 0x5a, 0xa0, 0x21, 
+  0xb3, 0x40, 0xfe, 0xf5, 0x3c, 0x9c, 0xa0, 0x19, 0x9e, 0xa0, 0x19, 0x66, 0x68, 0xf7, 0xfa, 0xac, 
+  0x33, 0xb4, 0xbf, 0x2a, 0x79, 0xbd, 0x01, 0x76, 0xb7, 0x86, 0xff, 0xe4, 0xdc, 0x49, 0xd6, 0x6c, 
+  0xfa, 0x67, 0x34, 0x57, 0x17, 0x4c, 0x51, 0xa9, 0x8e, 0xe1, 0xf1, 0x29, 0xf1, 0x10, 0x36, 0x0f, 
+  0x17, 0xca, 0x3a, 0xba, 0xe2, 0x83, 0x49, 0xdb, 0xdb, 0x82, 0xed, 0x6d, 0xf5, 0x09, 0x67, 0xd9, 
+  0x56, 0x1f, 0x40, 0xa8, 0x57, 0xed, 0xf3, 0x82, 0x9c, 0x81, 0x09, 0xa5, 0x38, 0xbb, 0x8f, 0x61, 
+  0x26, 0xfe, 0x8d, 0x06, 0xa9, 0xeb, 0x3d, 0x1a, 0xd0, 0x5d, 0x5e, 0xf6, 0x26, 0x89, 0xf3, 0x1b, 
+  0xd7, 0xeb, 0xf4, 0xf9, 0xe3, 0x0b, 0x58, 0x25, 0x5d, 0x8f, 0xff, 0x7e, 0x99, 0xac, 0xd2, 0x4c, 
+  0x3e, 0xbc, 0x09, 0xe3, 0x15, 0x08, 0x46, 0x3e, 0x9e, 0x51, 0x58, 0x27, 0x67, 0xf0, 0x78, 0xe9, 
+  0x2b, 0x1c, 0x73, 0xc6, 0x80, 0x1f, 0x10, 0x0d, 0x72, 0x34, 0xd5, 0x15, 0xf8, 0x5c, 0x57, 0x60, 
+  0xa0, 0xfa, 0xc9, 0x73, 0x30, 0x1b, 0x9c, 0x53, 0x8b, 0x42, 0xf7, 0x2e, 0x3d, 0x3f, 0xd6, 0x35, 
+  0xdc, 0xf3, 0x13, 0xb5, 0x60, 0x70, 0x89, 0x56, 0x4d, 0x29, 0xd8, 0x85, 0x82, 0x40, 0x2d, 0x78, 
+  0x0c, 0x05, 0xa1, 0x5a, 0xb0, 0x77, 0xc9, 0xac, 0x92, 0x9c, 0x25, 0x5f, 0xbe, 0xf0, 0x5f, 0x71, 
+  0xf1, 0x2b, 0x29, 0x7e, 0xa5, 0xc5, 0xaf, 0xa0, 0xf8, 0x15, 0x7a, 0xde, 0xb4, 0xed, 0xbc, 0x3a, 
+  0x4c, 0x56, 0xd1, 0xcc, 0xc1, 0x2d, 0x06, 0x9f, 0x57, 0x28, 0x1c, 0x36, 0xb9, 0x84, 0x59, 0x06, 
+  0xeb, 0x07, 0x73, 0xcc, 0x29, 0x86, 0x12, 0x66, 0xdb, 0x88, 0x99, 0x2b, 0xa0, 0xaf, 0xff, 0x64, 
+  0x0f, 0x6c, 0xe6, 0xf6, 0x36, 0xfb, 0x1b, 0x8b, 0xbf, 0x89, 0xf8, 0x9b, 0x8a, 0xbf, 0xc1, 0xf6, 
+  0xf6, 0x53, 0xf8, 0x13, 0x7a, 0x2b, 0x46, 0x0b, 0x1b, 0xbc, 0x9e, 0xe7, 0x6f, 0xf5, 0x39, 0x1e, 
+  0x26, 0xd1, 0x6c, 0x5c, 0x54, 0xc1, 0xa0, 0x77, 0x72, 0x3f, 0x7e, 0xd4, 0xf7, 0x13, 0x3f, 0xf5, 
+  0x03, 0x3f, 0xf4, 0x46, 0x2b, 0x37, 0xf3, 0xb7, 0x7a, 0xde, 0x9a, 0x9b, 0xc9, 0xb6, 0x9c, 0x91, 
+  0x93, 0x38, 0xba, 0x87, 0x2d, 0xcc, 0x94, 0x86, 0xb7, 0x60, 0x38, 0x60, 0x69, 0x10, 0x83, 0xd8, 
+  0x51, 0xb8, 0x61, 0xf6, 0x4d, 0xce, 0x90, 0xa9, 0xd4, 0x7a, 0x65, 0x5b, 0x18, 0xf0, 0x21, 0x0f, 
+  0xbf, 0x56, 0xed, 0xfd, 0x6c, 0x3c, 0x68, 0xd7, 0x72, 0xa0, 0xb5, 0x1c, 0x5c, 0x96, 0xdb, 0xf4, 
+  0x55, 0xb9, 0xe5, 0x74, 0xe9, 0xf3, 0x7e, 0x6f, 0x9f, 0xf4, 0xc0, 0x1e, 0xc0, 0xb8, 0xd0, 0xb5, 
+  0x9c, 0x54, 0xe1, 0xf6, 0x36, 0xfb, 0x9b, 0xc9, 0x59, 0xba, 0xe3, 0x5e, 0xf4, 0xfa, 0x97, 0x7f, 
+  0x9f, 0x7d, 0x19, 0x5c, 0xf4, 0x1e, 0x81, 0xc2, 0x0d, 0xe1, 0xf9, 0xd1, 0x1e, 0x14, 0x78, 0x3b, 
+  0xb0, 0x12, 0x87, 0x62, 0x09, 0xa4, 0xa8, 0xbb, 0x59, 0xf1, 0x20, 0x05, 0x21, 0x57, 0xc3, 0xed, 
+  0x6d, 0xf1, 0x0b, 0xc6, 0x56, 0x9f, 0xad, 0x30, 0x4b, 0x0a, 0x75, 0xcd, 0x99, 0xca, 0x2b, 0x8f, 
+  0x03, 0xf5, 0x31, 0xd6, 0x6b, 0x63, 0xac, 0xb5, 0xcc, 0xc7, 0x14, 0x24, 0x0d, 0xd6, 0xca, 0x32, 
+  0x21, 0x5f, 0x54, 0x26, 0xe4, 0xe3, 0x6f, 0x30, 0x21, 0x47, 0xed, 0xe6, 0xda, 0xfe, 0xb7, 0x9c, 
+  0x57, 0x68, 0xb9, 0x51, 0xe8, 0xf8, 0x27, 0xe6, 0x7f, 0x12, 0xfe, 0x27, 0xdd, 0x0f, 0x60, 0x9c, 
+  0x7d, 0xf2, 0xe8, 0xd1, 0xf0, 0xd1, 0x23, 0x22, 0xff, 0xc2, 0xa0, 0x86, 0xe3, 0x15, 0xd0, 0xdc, 
+  0x01, 0x75, 0xe8, 0xc0, 0xf4, 0x82, 0xe5, 0x05, 0x9e, 0x13, 0xf9, 0x9c, 0x82, 0x99, 0x71, 0xb7, 
+  0x7a, 0x7e, 0xe8, 0x67, 0x72, 0x8f, 0xf1, 0x8d, 0x27, 0xcf, 0x34, 0x88, 0xa7, 0x34, 0x3a, 0xd7, 
+  0xa7, 0x10, 0xb5, 0xad, 0x32, 0x5c, 0x87, 0x7a, 0xfc, 0x3f, 0x4d, 0x1f, 0x28, 0xee, 0x58, 0xe4, 
+  0x4c, 0x9c, 0x44, 0xe1, 0x22, 0xcc, 0x2b, 0x9b, 0x8e, 0x6f, 0xb6, 0x0a, 0xed, 0x12, 0xff, 0x4d, 
+  0x90, 0xdf, 0x74, 0xd9, 0x4e, 0xc0, 0xa5, 0x3b, 0xfd, 0x3d, 0x9b, 0xb2, 0x72, 0xaa, 0x80, 0x18, 
+  0xb1, 0x84, 0x18, 0x7b, 0xa0, 0xdd, 0x8a, 0xc6, 0xf6, 0x9b, 0x34, 0xf6, 0x2b, 0x36, 0x44, 0xa6, 
+  0x82, 0x35, 0xe8, 0x56, 0xec, 0xf6, 0xf7, 0x7e, 0xc8, 0x85, 0x1a, 0x24, 0xdf, 0x4c, 0x0d, 0xd8, 
+  0x2e, 0x83, 0x39, 0xa4, 0xbf, 0xfb, 0xd8, 0xbd, 0x84, 0x1d, 0x84, 0x31, 0x58, 0x2a, 0x21, 0xb5, 
+  0xc3, 0xf5, 0xf2, 0x7f, 0xe7, 0x70, 0xfd, 0x4e, 0x63, 0x15, 0x2c, 0x16, 0x34, 0xa7, 0x29, 0xec, 
+  0x2a, 0xf3, 0x1c, 0x7c, 0x73, 0x65, 0x83, 0x9f, 0xfc, 0xc6, 0xf1, 0x82, 0x75, 0xe6, 0x6b, 0x97, 
+  0xbe, 0x62, 0xa4, 0xc5, 0xb2, 0x96, 0xdb, 0x47, 0x1c, 0x5c, 0x6f, 0xea, 0xe7, 0xda, 0x98, 0x27, 
+  0x2e, 0x94, 0xc8, 0x81, 0x4e, 0xf5, 0x81, 0x3e, 0xa8, 0x0c, 0xf4, 0xe0, 0xc1, 0x2b, 0x89, 0x65, 
+  0x9d, 0xd8, 0x4f, 0xbf, 0x91, 0x0e, 0x24, 0x2e, 0x6c, 0x84, 0x5a, 0x38, 0x87, 0xbf, 0x4d, 0x0b, 
+  0x98, 0x73, 0x27, 0x02, 0x35, 0x93, 0x69, 0xb0, 0x0c, 0xa6, 0x61, 0x7e, 0xff, 0xfb, 0xcd, 0xda, 
+  0x43, 0xcb, 0xac, 0x35, 0x88, 0xa9, 0x9d, 0xb9, 0x47, 0xff, 0xd6, 0x33, 0x57, 0xf3, 0x3b, 0xcb, 
+  0x01, 0xcb, 0x7f, 0xeb, 0x80, 0xf1, 0x3e, 0xf8, 0x98, 0xed, 0xeb, 0x83, 0xf5, 0x9a, 0x54, 0x43, 
+  0x60, 0x17, 0xf4, 0xd2, 0x18, 0x3f, 0xad, 0x1e, 0xa5, 0xe1, 0x0d, 0x65, 0xf8, 0xc0, 0x55, 0xc7, 
+  0x0b, 0x86, 0xa4, 0x5b, 0xf5, 0xa0, 0xf7, 0x7b, 0x43, 0xaa, 0xa3, 0xf0, 0x8d, 0x67, 0xb1, 0x3f, 
+  0x30, 0xd5, 0x64, 0x92, 0x06, 0xf1, 0x35, 0xad, 0xd8, 0x2f, 0xc3, 0x08, 0x1c, 0xfe, 0xbf, 0x11, 
+  0xa8, 0x33, 0x02, 0x3c, 0x6c, 0xfa, 0xaf, 0x5b, 0x00, 0x94, 0xa9, 0x2f, 0xe4, 0x6a, 0x89, 0xcd, 
+  0x82, 0xfa, 0x8c, 0x2c, 0x86, 0x21, 0x37, 0x75, 0x8a, 0x35, 0x03, 0x92, 0x84, 0x93, 0x60, 0x8c, 
+  0xea, 0xd9, 0xc3, 0x2d, 0xc1, 0xbf, 0xcb, 0xa8, 0x2a, 0x11, 0xb0, 0xdf, 0x62, 0x24, 0xf4, 0xc8, 
+  0x2e, 0xfa, 0x85, 0x86, 0xb7, 0x68, 0xd8, 0x8a, 0xe3, 0x63, 0xa0, 0x18, 0x83, 0xed, 0xfb, 0xa4, 
+  0x0f, 0xee, 0x48, 0x8f, 0x18, 0x03, 0xaa, 0x90, 0xd5, 0x60, 0x22, 0x14, 0x48, 0x31, 0xf3, 0xb5, 
+  0x28, 0xd8, 0xef, 0xcb, 0x94, 0x73, 0x5c, 0xcf, 0x92, 0x46, 0x56, 0x03, 0x53, 0x1a, 0xac, 0x64, 
+  0x4b, 0x89, 0x3f, 0xfe, 0xce, 0x5c, 0xfd, 0xb4, 0x81, 0x2b, 0x85, 0xaa, 0x26, 0xa6, 0x14, 0x50, 
+  0xc1, 0x53, 0x25, 0x7a, 0xfa, 0x3b, 0x33, 0x76, 0x5a, 0xcf, 0x58, 0x85, 0xb4, 0x06, 0xee, 0x2a, 
+  0xf0, 0x82, 0x45, 0x2d, 0x9a, 0xfc, 0x3b, 0xb3, 0xf7, 0xa1, 0x9e, 0x3d, 0x8d, 0xac, 0x06, 0xd6, 
+  0x34, 0x58, 0xe9, 0x7e, 0x17, 0x11, 0xe5, 0xdf, 0x99, 0xa7, 0xf3, 0x7a, 0x9e, 0x4a, 0x9a, 0x1a, 
+  0x18, 0x2a, 0x01, 0x05, 0x37, 0x78, 0x1c, 0x39, 0x51, 0x0e, 0x29, 0x27, 0xf9, 0x4d, 0x4a, 0xb3, 
+  0x9b, 0x24, 0x9a, 0xfd, 0x9f, 0xf2, 0x78, 0x4e, 0xaa, 0x1e, 0xcf, 0x46, 0xde, 0xd8, 0x82, 0x69, 
+  0xf3, 0x85, 0x4e, 0xfe, 0x7f, 0x1b, 0x54, 0xb7, 0x60, 0x2e, 0x41, 0x78, 0xd9, 0xe4, 0x6a, 0x95, 
+  0xe7, 0x49, 0xdc, 0x10, 0xc5, 0x22, 0xc7, 0x7d, 0x62, 0x8d, 0x5d, 0x81, 0x37, 0x7d, 0x24, 0x4f, 
+  0xf6, 0x55, 0x14, 0xda, 0x89, 0xbf, 0x92, 0x31, 0x70, 0x1a, 0x2c, 0xc3, 0x0f, 0x21, 0xbd, 0x7b, 
+  0x03, 0x4b, 0x5d, 0x54, 0x1e, 0x9c, 0x89, 0x9c, 0x88, 0xab, 0x00, 0x78, 0x2a, 0x13, 0x05, 0xf2, 
+  0x2e, 0x1e, 0x76, 0x9e, 0x01, 0xa2, 0xf1, 0xc7, 0xa4, 0x9b, 0x5c, 0xe1, 0xe6, 0x18, 0x4f, 0xb4, 
+  0x41, 0x83, 0x3c, 0xa8, 0x9c, 0x2e, 0xcc, 0x72, 0x42, 0xb0, 0x1c, 0xc8, 0xb7, 0x96, 0x67, 0x88, 
+  0x48, 0x61, 0xa2, 0x44, 0xef, 0x6e, 0xf5, 0x3c, 0x9f, 0x9f, 0xb9, 0xea, 0x44, 0xb8, 0x5e, 0x87, 
+  0xec, 0xa4, 0xf5, 0x47, 0xaf, 0x48, 0x83, 0xeb, 0xe9, 0x07, 0xb0, 0x8c, 0x00, 0x97, 0xfc, 0x09, 
+  0x87, 0x01, 0x7e, 0x09, 0x4a, 0x61, 0xae, 0xc2, 0xff, 0x37, 0x1e, 0x65, 0xaa, 0xf4, 0xf4, 0x51, 
+  0xbe, 0xa5, 0xd8, 0x30, 0xd2, 0x58, 0x8a, 0xad, 0x38, 0x91, 0x64, 0x62, 0x2b, 0x80, 0xd2, 0xfa, 
+  0xf0, 0x79, 0xd2, 0xa5, 0xb7, 0x19, 0x45, 0x2c, 0xb3, 0x20, 0xa7, 0x86, 0x74, 0xe4, 0x91, 0x84, 
+  0xe7, 0x27, 0xdd, 0x28, 0x99, 0x06, 0x51, 0x0b, 0xb8, 0x38, 0xb9, 0xab, 0x83, 0x02, 0x73, 0x87, 
+  0x10, 0x37, 0x41, 0x76, 0x7a, 0x7e, 0x68, 0x0e, 0x5c, 0x0f, 0xab, 0x60, 0x65, 0x59, 0x66, 0x74, 
+  0xf6, 0x36, 0xb9, 0xab, 0xe9, 0xc1, 0xed, 0x79, 0x0a, 0xdc, 0x6b, 0xa4, 0x69, 0x03, 0x2d, 0x33, 
+  0xd0, 0xfa, 0x34, 0x7f, 0xbf, 0x44, 0x62, 0x1a, 0x71, 0xaa, 0xc0, 0x8d, 0x88, 0x05, 0x77, 0x4b, 
+  0xb0, 0x35, 0x87, 0xc9, 0x62, 0xb9, 0xca, 0x61, 0x81, 0x01, 0x09, 0x07, 0x33, 0xf5, 0xc4, 0x5f, 
+  0x9c, 0xaa, 0x63, 0x10, 0x5b, 0x15, 0x0b, 0xa8, 0x05, 0x1f, 0x0b, 0x42, 0x46, 0xdc, 0xd8, 0x1a, 
+  0xd5, 0x72, 0x2e, 0x1a, 0xa7, 0x81, 0x1d, 0xf2, 0x88, 0x74, 0x52, 0x57, 0x3f, 0x0f, 0xd4, 0x4a, 
+  0xf9, 0xb1, 0x20, 0xa8, 0xd2, 0x5d, 0x1a, 0xe6, 0x74, 0x58, 0x3d, 0x86, 0xd6, 0x47, 0x1b, 0x7a, 
+  0xa2, 0x9d, 0x31, 0x18, 0x1b, 0x68, 0x9f, 0x2b, 0x47, 0x89, 0x3c, 0x7a, 0x2e, 0xca, 0x8a, 0x13, 
+  0x45, 0xad, 0xb4, 0x38, 0x58, 0x64, 0xa3, 0xa1, 0xe2, 0x2c, 0xa4, 0x4a, 0xbd, 0x8a, 0xda, 0x94, 
+  0x32, 0x5c, 0xaf, 0xb1, 0x92, 0x9d, 0xaf, 0xfe, 0x76, 0x31, 0xb2, 0xb3, 0x00, 0x3c, 0x0e, 0xd8, 
+  0x2c, 0x4e, 0x21, 0x24, 0x83, 0x49, 0x6a, 0x65, 0x52, 0x3f, 0x3d, 0xdd, 0x20, 0x51, 0x2a, 0x73, 
+  0x24, 0x86, 0x04, 0x97, 0x87, 0x8a, 0x80, 0x63, 0x34, 0x84, 0xbc, 0x4b, 0xe5, 0x7c, 0x08, 0xd6, 
+  0x12, 0x80, 0xc6, 0x2a, 0xd9, 0xb3, 0x7e, 0x96, 0x54, 0x95, 0x6a, 0xa3, 0x2c, 0xc5, 0x94, 0xa8, 
+  0x88, 0xf3, 0x21, 0x82, 0xec, 0x0d, 0x7b, 0xf8, 0xaf, 0x94, 0x63, 0x39, 0x1f, 0x5d, 0x0f, 0x25, 
+  0x82, 0x4d, 0x5c, 0xb0, 0x5b, 0x63, 0x97, 0x8e, 0xd9, 0x29, 0xc1, 0x3c, 0x4a, 0x30, 0x6f, 0x6e, 
+  0xa7, 0x4f, 0x77, 0x3d, 0xef, 0x3f, 0x9e, 0xf4, 0x40, 0x04, 0x66, 0xd5, 0x93, 0x1e, 0xab, 0x91, 
+  0xa3, 0x60, 0xd6, 0x09, 0x81, 0xc7, 0x85, 0x7a, 0x61, 0xba, 0x45, 0x2c, 0xbc, 0x5d, 0x49, 0x40, 
+  0x37, 0x5b, 0x5d, 0x65, 0xd3, 0x34, 0xbc, 0xa2, 0xda, 0x3e, 0x47, 0x23, 0xb0, 0x50, 0x3c, 0xa0, 
+  0xe5, 0x07, 0x5a, 0x31, 0x13, 0x8a, 0xbc, 0xca, 0xd9, 0x3e, 0x59, 0x2d, 0xad, 0x53, 0xf9, 0x01, 
+  0x42, 0xdb, 0xea, 0x17, 0xd2, 0x32, 0xcc, 0x8d, 0x2a, 0x32, 0x2b, 0xf7, 0x28, 0x34, 0x95, 0x59, 
+  0x8d, 0xa6, 0x5a, 0x96, 0xcd, 0x5e, 0x2c, 0x7c, 0x57, 0x4c, 0x99, 0xca, 0x3c, 0x23, 0x37, 0x18, 
+  0xb3, 0x8d, 0x68, 0xc2, 0xa2, 0x4f, 0x8b, 0x20, 0x0f, 0xa7, 0xe7, 0x62, 0x2e, 0x56, 0x6c, 0x32, 
+  0x4e, 0x52, 0x8e, 0x6a, 0x5c, 0x55, 0xff, 0x2d, 0xb7, 0xf5, 0x46, 0x11, 0xf6, 0x48, 0x5a, 0x68, 
+  0x44, 0x2e, 0x04, 0x98, 0xa6, 0x24, 0x76, 0xc2, 0xc1, 0xf6, 0xb6, 0x3b, 0x8d, 0xc0, 0xd8, 0xc1, 
+  0x44, 0x40, 0x22, 0x22, 0x37, 0xc0, 0x3c, 0x01, 0xb9, 0x70, 0x68, 0x33, 0xc2, 0x5c, 0x6c, 0x5c, 
+  0xba, 0x61, 0x8a, 0x00, 0x12, 0x98, 0x6b, 0x05, 0x56, 0x35, 0x5a, 0xae, 0x4b, 0xc0, 0xf5, 0xb6, 
+  0xb7, 0x75, 0xb4, 0x85, 0x78, 0xcd, 0xa9, 0x5d, 0x0e, 0x6e, 0xa7, 0x00, 0x7a, 0x64, 0x52, 0xe0, 
+  0x79, 0x6c, 0xa2, 0x87, 0xd9, 0xa1, 0xc8, 0x50, 0xe4, 0x1d, 0xd4, 0xa9, 0xad, 0xa9, 0xf7, 0x06, 
+  0x6e, 0x4d, 0x9f, 0x19, 0xea, 0x06, 0x75, 0xb0, 0xab, 0x96, 0x81, 0xb5, 0xaa, 0x2d, 0x88, 0x7a, 
+  0xed, 0x33, 0xf5, 0xd4, 0x77, 0x1a, 0xff, 0x9d, 0xc4, 0x54, 0xdb, 0xa4, 0xb1, 0x14, 0xd7, 0x38, 
+  0xa8, 0xa8, 0x0e, 0x65, 0x85, 0x1e, 0x4f, 0x81, 0x05, 0x91, 0xaf, 0xec, 0x00, 0x1d, 0xf2, 0x05, 
+  0x37, 0x43, 0xf9, 0xaf, 0x5e, 0xd9, 0x0f, 0xf6, 0x91, 0x55, 0x76, 0x82, 0x7c, 0x4b, 0xe3, 0xe7, 
+  0x9b, 0xa6, 0xaa, 0x5c, 0x36, 0xd9, 0xde, 0xec, 0x57, 0x44, 0xd3, 0x65, 0x5b, 0x2a, 0xd0, 0xf9, 
+  0xa4, 0x3b, 0xa7, 0xf9, 0xf4, 0x06, 0x06, 0xc0, 0xb2, 0x61, 0x4c, 0xba, 0x0c, 0x18, 0x6b, 0x16, 
+  0xc1, 0x12, 0xf3, 0x33, 0xbb, 0xf3, 0x34, 0x59, 0xfc, 0xe7, 0x99, 0x7b, 0x71, 0xe9, 0x7f, 0xfe, 
+  0x48, 0xef, 0x87, 0x96, 0x3d, 0x30, 0x00, 0xaf, 0xf2, 0x30, 0xca, 0xba, 0xab, 0xf8, 0x0e, 0x76, 
+  0x67, 0x27, 0x15, 0xde, 0xd7, 0xfe, 0x14, 0x56, 0x32, 0x63, 0xd1, 0x90, 0x9e, 0x1f, 0x48, 0xdf, 
+  0x22, 0x4f, 0xdc, 0x57, 0x04, 0xc2, 0x9e, 0x87, 0x71, 0x98, 0x87, 0x41, 0xf4, 0x81, 0xc9, 0x6e, 
+  0xc3, 0xba, 0xf3, 0x85, 0xf8, 0x03, 0x6f, 0x34, 0x00, 0x7f, 0x49, 0x4c, 0xbf, 0x7d, 0xc1, 0x0e, 
+  0x88, 0x29, 0xbb, 0x71, 0xed, 0x3d, 0x7d, 0x46, 0x0a, 0x87, 0xb8, 0x0e, 0xf9, 0xf9, 0xaf, 0x43, 
+  0x5c, 0x72, 0xd6, 0xe8, 0x61, 0xb4, 0x6d, 0x48, 0x5e, 0x50, 0x91, 0x36, 0x5b, 0xb6, 0x5e, 0x03, 
+  0xcd, 0x2b, 0xc3, 0x4c, 0x48, 0x67, 0xb2, 0xd7, 0xce, 0x46, 0xf4, 0x54, 0x5f, 0xb9, 0xa7, 0x27, 
+  0x4f, 0x2a, 0x23, 0xa8, 0xee, 0xc9, 0x5d, 0x5b, 0x8a, 0xe3, 0xc5, 0xe5, 0x68, 0x0e, 0x06, 0x96, 
+  0xe5, 0x31, 0x3a, 0x21, 0x28, 0x84, 0x47, 0xd1, 0xd6, 0x9c, 0xdc, 0xc5, 0xef, 0xd2, 0x04, 0x5c, 
+  0x44, 0x76, 0x9e, 0xb2, 0xbd, 0x9d, 0x73, 0x46, 0x39, 0x4b, 0x31, 0xb2, 0x42, 0x2f, 0x62, 0x60, 
+  0x65, 0x54, 0xd5, 0x83, 0x5c, 0xea, 0xc8, 0xc6, 0x6d, 0xba, 0x4a, 0x22, 0xa8, 0x15, 0x77, 0x85, 
+  0x4a, 0xc5, 0x7e, 0xb1, 0x5a, 0x2c, 0xee, 0x6b, 0x72, 0xbe, 0xeb, 0x33, 0xac, 0xd9, 0x7a, 0x6b, 
+  0x66, 0x56, 0x83, 0x21, 0x52, 0xd4, 0xc6, 0xcf, 0x65, 0x9c, 0x9f, 0xcd, 0x91, 0xb8, 0xf5, 0x1c, 
+  0x49, 0x71, 0x6a, 0xa4, 0x5d, 0x90, 0x49, 0x8c, 0xb6, 0x4d, 0xcb, 0x3b, 0x75, 0x63, 0x97, 0xef, 
+  0x51, 0xac, 0xcb, 0x50, 0xd9, 0x48, 0x75, 0xf4, 0x5c, 0xb6, 0xb8, 0xa6, 0x32, 0x8c, 0x9e, 0xc3, 
+  0x4f, 0xb6, 0xc5, 0x93, 0xba, 0x54, 0xd2, 0x9c, 0x32, 0x30, 0x7e, 0xa4, 0xf1, 0x5a, 0xe4, 0x11, 
+  0x0b, 0xdd, 0x3a, 0x00, 0x7b, 0x4c, 0x7c, 0x66, 0x33, 0x86, 0xbd, 0xb5, 0x2f, 0x4a, 0xfb, 0xb2, 
+  0xa8, 0x5f, 0x14, 0x0d, 0x64, 0xd1, 0x60, 0x7d, 0x09, 0xd8, 0xc4, 0x61, 0x88, 0xc0, 0xa6, 0xcd, 
+  0x72, 0x9e, 0x69, 0x7b, 0x81, 0x49, 0x2f, 0x8c, 0xa0, 0xd7, 0x78, 0x1a, 0x5e, 0xf6, 0x18, 0xc3, 
+  0xc8, 0x5a, 0x7a, 0xdc, 0x73, 0x16, 0x61, 0x5c, 0x74, 0xbb, 0x57, 0x54, 0xec, 0xf6, 0xd4, 0x8a, 
+  0xdd, 0xb2, 0xc5, 0x63, 0xad, 0xc5, 0xe3, 0xb2, 0x45, 0xdf, 0xb9, 0x81, 0x1d, 0xa0, 0xac, 0x78, 
+  0xa2, 0xf4, 0xd1, 0xdd, 0x63, 0x55, 0x99, 0xac, 0x7b, 0x56, 0xd6, 0x0d, 0xf4, 0x9a, 0xfe, 0x40, 
+  0xa9, 0x32, 0x9b, 0xf5, 0xf7, 0xca, 0xca, 0x5d, 0xa3, 0xea, 0xa9, 0x42, 0xa0, 0x5e, 0x35, 0x78, 
+  0x5c, 0x56, 0x19, 0x08, 0x77, 0x7b, 0x65, 0xd5, 0x13, 0xa3, 0x4a, 0xa1, 0xff, 0x47, 0xbd, 0xea, 
+  0xb1, 0x42, 0xe3, 0x53, 0xa3, 0x0a, 0xc8, 0x60, 0xa3, 0xc4, 0xf2, 0x11, 0xda, 0x0d, 0x80, 0xf3, 
+  0xf1, 0x2f, 0x37, 0x96, 0x61, 0x57, 0x8b, 0x07, 0x0a, 0xdb, 0x4a, 0xf1, 0xae, 0xc2, 0xb2, 0x52, 
+  0xfc, 0x58, 0x61, 0x57, 0x29, 0xde, 0x53, 0x58, 0x55, 0x8a, 0x9f, 0x28, 0x6c, 0x2a, 0xc5, 0x3f, 
+  0x2a, 0x2c, 0x2a, 0xc5, 0x4f, 0x8b, 0xe2, 0x67, 0x6a, 0xf1, 0xb3, 0x92, 0x9d, 0x9e, 0xc6, 0x8f, 
+  0xa6, 0x68, 0x6a, 0x85, 0xc2, 0xa9, 0xde, 0xa2, 0xe4, 0x75, 0xa0, 0xb5, 0x18, 0x68, 0xaa, 0xa9, 
+  0x4a, 0x41, 0x51, 0x0a, 0xad, 0xc5, 0x6e, 0xd9, 0xe2, 0xb1, 0xd6, 0xe2, 0xb1, 0xa6, 0xcc, 0x6a, 
+  0x45, 0xd9, 0x62, 0x4f, 0x6b, 0xa1, 0x28, 0xde, 0x9e, 0x2e, 0x54, 0x45, 0xaa, 0x5a, 0x0b, 0x55, 
+  0x7d, 0xb4, 0x8a, 0x1f, 0x15, 0xe5, 0xd1, 0x2a, 0x14, 0x0d, 0x7e, 0xa6, 0x55, 0x3c, 0xe3, 0x3a, 
+  0xa5, 0xda, 0x11, 0x63, 0x79, 0x7f, 0xd4, 0xc7, 0x39, 0x1f, 0x4c, 0xf3, 0x55, 0x10, 0x9d, 0x35, 
+  0x81, 0xc1, 0xe4, 0x3d, 0x54, 0x8c, 0x88, 0x1d, 0x26, 0xf8, 0xd4, 0x08, 0x23, 0x2c, 0xd1, 0xa1, 
+  0xcc, 0x24, 0xb0, 0xc1, 0x14, 0x66, 0xc8, 0x8e, 0xa1, 0x9c, 0x25, 0xd6, 0xfa, 0x19, 0x86, 0xe0, 
+  0x59, 0x92, 0xd9, 0x11, 0xbb, 0xc9, 0x61, 0x0b, 0x83, 0xa9, 0x50, 0x67, 0x98, 0x83, 0x6d, 0x86, 
+  0xbe, 0x44, 0x0a, 0x9d, 0x01, 0x98, 0x2c, 0xeb, 0xe1, 0xae, 0xe7, 0xe1, 0x19, 0x8d, 0xe6, 0xe7, 
+  0xb0, 0x80, 0x6d, 0xea, 0x97, 0x1f, 0x82, 0x1c, 0x62, 0xec, 0x79, 0x13, 0x18, 0x3b, 0x4d, 0x38, 
+  0xc5, 0xae, 0x37, 0x41, 0x61, 0x54, 0xb7, 0x11, 0x15, 0x3b, 0x20, 0x6b, 0x84, 0xc2, 0x18, 0xff, 
+  0xa9, 0x08, 0xf1, 0x6f, 0x82, 0x0b, 0xa2, 0x08, 0x59, 0xcc, 0x14, 0x98, 0x86, 0xe5, 0xd4, 0x26, 
+  0x1a, 0xdc, 0xe9, 0xdb, 0x64, 0xc1, 0xcb, 0x2b, 0xcc, 0xf3, 0x62, 0x93, 0x5b, 0x5e, 0x5a, 0x61, 
+  0x8f, 0x17, 0x5b, 0xf8, 0x71, 0xf9, 0x02, 0x5c, 0xa0, 0x39, 0x5b, 0x2d, 0x97, 0x49, 0x9a, 0xd7, 
+  0x30, 0x0a, 0x6e, 0x89, 0xbc, 0x46, 0xd5, 0xcc, 0xe4, 0x23, 0x0c, 0xca, 0x5f, 0x0c, 0xfc, 0xdd, 
+  0x4b, 0xd8, 0x9b, 0xce, 0xe8, 0xa7, 0x93, 0xb9, 0x2b, 0x57, 0x7a, 0x7e, 0x6d, 0xcb, 0xe5, 0x37, 
+  0x25, 0x00, 0xeb, 0x29, 0x0d, 0x66, 0xf7, 0x6d, 0x31, 0xf6, 0xfc, 0x7e, 0x33, 0x46, 0xe9, 0x3e, 
+  0xb5, 0x18, 0x8b, 0x5d, 0xcc, 0x16, 0x35, 0xd0, 0x08, 0x2c, 0x2c, 0x2a, 0xde, 0x96, 0xae, 0xc7, 
+  0xfe, 0x9e, 0xff, 0xc4, 0xff, 0xd1, 0x7f, 0xea, 0x3f, 0xf3, 0xfb, 0x40, 0x64, 0x0b, 0x2a, 0x5b, 
+  0x2b, 0x4c, 0xc1, 0xb9, 0xdf, 0x4a, 0x9e, 0x67, 0xe2, 0xda, 0x58, 0x0b, 0xee, 0x07, 0x7b, 0x8f, 
+  0xeb, 0xf9, 0x7f, 0x21, 0xee, 0x9b, 0xb5, 0xc2, 0xb3, 0x57, 0x87, 0x27, 0xa3, 0x11, 0xa8, 0xcc, 
+  0x79, 0x61, 0xc0, 0x8c, 0x53, 0x14, 0xc5, 0xb6, 0xb9, 0x1e, 0x4b, 0x7d, 0x90, 0x9b, 0xf1, 0x7c, 
+  0xdc, 0x1b, 0xe5, 0xcf, 0xd5, 0x2d, 0x98, 0xf0, 0x06, 0x46, 0x79, 0xa7, 0x23, 0xef, 0x1d, 0xa9, 
+  0xd5, 0x17, 0x39, 0x3b, 0x16, 0x8a, 0xb9, 0x07, 0xf9, 0xa7, 0x31, 0xdb, 0x78, 0x96, 0xd8, 0x45, 
+  0xb9, 0x37, 0xba, 0x02, 0x47, 0xeb, 0xe3, 0x7a, 0xbd, 0x2e, 0x88, 0x3b, 0x54, 0xec, 0x67, 0x85, 
+  0x3c, 0xc5, 0xb8, 0xd6, 0x10, 0xa8, 0x6e, 0x52, 0xac, 0x24, 0xaa, 0x00, 0x56, 0x22, 0xd5, 0x3e, 
+  0x2a, 0x64, 0x8a, 0x44, 0xae, 0x8b, 0x8a, 0xd4, 0xb7, 0xfa, 0xaa, 0xcc, 0xd9, 0x25, 0x0d, 0x3c, 
+  0x4f, 0x2a, 0xb6, 0xda, 0xac, 0x84, 0x4b, 0x40, 0x09, 0xcb, 0x78, 0x43, 0xe6, 0xcc, 0x2b, 0xde, 
+  0xc5, 0xda, 0xb7, 0x99, 0x28, 0x65, 0xc7, 0xae, 0x66, 0x27, 0x95, 0xf2, 0x41, 0x3f, 0x42, 0x5f, 
+  0x4d, 0x31, 0xa8, 0x62, 0x5b, 0x3e, 0x5d, 0x7e, 0x60, 0x6f, 0xeb, 0x85, 0xfb, 0x80, 0x87, 0xfa, 
+  0x12, 0xe8, 0x7a, 0x0d, 0x24, 0x55, 0x12, 0xde, 0x74, 0x67, 0xc3, 0x58, 0x51, 0x99, 0x9f, 0xd1, 
+  0x80, 0x51, 0xc9, 0x52, 0xd6, 0x71, 0x19, 0xea, 0xdb, 0x06, 0x97, 0x96, 0x44, 0x6b, 0xc3, 0xa6, 
+  0xe8, 0x5b, 0x1b, 0x7c, 0x7a, 0x9a, 0x84, 0x8e, 0xd0, 0xb2, 0x90, 0xb4, 0xc1, 0xa8, 0xa6, 0x28, 
+  0x18, 0x08, 0xab, 0x2b, 0x50, 0x0b, 0x84, 0xd5, 0xd4, 0x00, 0x83, 0xef, 0xca, 0xfa, 0xd5, 0x66, 
+  0x4c, 0xca, 0xc3, 0x6b, 0x1d, 0x5b, 0x65, 0xd9, 0x6b, 0x81, 0x4c, 0x4d, 0x9f, 0xd1, 0xb1, 0x55, 
+  0x97, 0xcb, 0x16, 0xe8, 0xf4, 0x64, 0x01, 0x1d, 0xa1, 0x6d, 0xa1, 0xfd, 0x4a, 0x76, 0x35, 0x6e, 
+  0x8b, 0xd5, 0x19, 0x43, 0x1a, 0x6b, 0xdf, 0xb6, 0xfc, 0x7b, 0xfc, 0x96, 0x76, 0x33, 0x82, 0x7e, 
+  0xbb, 0x29, 0x91, 0x6a, 0xf3, 0xdd, 0x8f, 0x99, 0xbc, 0xcc, 0xdd, 0x24, 0x9f, 0xf6, 0xc6, 0xf6, 
+  0x11, 0xe3, 0xb4, 0xe6, 0x56, 0x91, 0xe5, 0xa5, 0xae, 0x2f, 0x47, 0xc5, 0xb4, 0x07, 0x55, 0x33, 
+  0xf7, 0x99, 0x3d, 0x6c, 0xc6, 0xab, 0xcf, 0x93, 0xbc, 0x72, 0xac, 0x96, 0xc8, 0x13, 0x77, 0xbf, 
+  0xc6, 0x76, 0x8c, 0x1f, 0x64, 0x38, 0x78, 0x0a, 0x64, 0xc5, 0xa8, 0x19, 0x5b, 0x7b, 0xce, 0xa0, 
+  0xb1, 0x97, 0x07, 0x06, 0x47, 0x85, 0x81, 0x37, 0xed, 0xd7, 0xc8, 0x08, 0x30, 0x74, 0x53, 0xba, 
+  0x48, 0x6e, 0xe9, 0x41, 0x14, 0x41, 0x9d, 0x5c, 0x3f, 0x92, 0x71, 0xb5, 0x27, 0x6f, 0x94, 0x3c, 
+  0x1f, 0x57, 0xfb, 0x82, 0x62, 0x58, 0x50, 0x4c, 0xa4, 0x4a, 0x40, 0x2a, 0xe9, 0x10, 0xe7, 0x40, 
+  0x3a, 0x3a, 0xc9, 0x5a, 0x21, 0xe0, 0x50, 0x4d, 0x0a, 0x5e, 0x4b, 0xb1, 0xc1, 0xf6, 0x60, 0x83, 
+  0x83, 0x23, 0x76, 0xdc, 0xc1, 0x2d, 0x9d, 0x35, 0x42, 0x49, 0x74, 0x87, 0x1b, 0xdd, 0x18, 0x05, 
+  0x63, 0x1b, 0x40, 0x89, 0xf4, 0xbc, 0xc6, 0xef, 0x51, 0xd0, 0x6d, 0x06, 0x29, 0xa8, 0xab, 0x75, 
+  0x91, 0x54, 0xca, 0x1a, 0x80, 0x24, 0xb2, 0x17, 0x85, 0x56, 0xd7, 0xe3, 0x6a, 0x80, 0x29, 0x06, 
+  0x81, 0xc7, 0xbe, 0xea, 0xc5, 0x5f, 0x5f, 0x2f, 0x51, 0xfc, 0xd4, 0xce, 0xcd, 0x62, 0xe8, 0x5a, 
+  0xc2, 0x16, 0xa8, 0x5b, 0xba, 0x66, 0x0c, 0x75, 0x3b, 0xd8, 0x92, 0xf1, 0x36, 0xee, 0x9c, 0x90, 
+  0x41, 0x1b, 0xd0, 0x42, 0x65, 0xda, 0x78, 0x80, 0x5c, 0x73, 0xda, 0x40, 0x16, 0x63, 0xde, 0xca, 
+  0x67, 0xe4, 0x43, 0xdf, 0x0a, 0x54, 0x22, 0xfe, 0xd0, 0xd2, 0xcd, 0x64, 0xa8, 0x5b, 0x01, 0x8b, 
+  0x23, 0xbb, 0x2d, 0x74, 0x10, 0x68, 0x7e, 0x9c, 0xa4, 0xe7, 0xda, 0xc5, 0x64, 0x66, 0xe3, 0xf8, 
+  0x71, 0x5d, 0xc6, 0xcf, 0xa4, 0x92, 0x55, 0xee, 0x6a, 0x49, 0x39, 0xb8, 0x3c, 0xf0, 0x5b, 0x21, 
+  0x45, 0x20, 0x39, 0x2c, 0x83, 0xcc, 0x1b, 0xae, 0x4a, 0x76, 0xd9, 0x16, 0x05, 0x16, 0xbb, 0xb4, 
+  0x8c, 0x04, 0xab, 0x16, 0x39, 0xf8, 0xf2, 0xc5, 0xd5, 0xf7, 0x8c, 0xb5, 0x11, 0x63, 0x9b, 0x99, 
+  0x62, 0x44, 0x3f, 0x60, 0x6b, 0x2a, 0x99, 0x77, 0x2d, 0xc6, 0xcc, 0x1f, 0xd0, 0xdd, 0xda, 0xed, 
+  0xaa, 0x5f, 0xbb, 0x33, 0xb5, 0x04, 0xf2, 0xd1, 0xac, 0x52, 0xfb, 0x3b, 0x05, 0xec, 0x4c, 0xb0, 
+  0xc5, 0xd7, 0x12, 0xfa, 0xb1, 0xc9, 0x02, 0x38, 0xd9, 0xc2, 0x73, 0x8f, 0x1a, 0x5c, 0xe0, 0xd9, 
+  0xbb, 0xb5, 0x36, 0xd8, 0x14, 0x57, 0xc3, 0xb6, 0xb9, 0x2a, 0x2f, 0x03, 0x1f, 0x17, 0x59, 0xce, 
+  0xb3, 0xee, 0xac, 0xdb, 0x6c, 0x10, 0xfc, 0x46, 0x39, 0x54, 0x08, 0x44, 0x51, 0x88, 0x20, 0x84, 
+  0xb4, 0xe3, 0x35, 0x52, 0xb0, 0x2c, 0x0a, 0x26, 0x7f, 0x1b, 0x36, 0xf1, 0x26, 0x67, 0x05, 0x0e, 
+  0x83, 0x27, 0xcb, 0x76, 0xbf, 0x89, 0x27, 0x85, 0x9c, 0x72, 0x60, 0xcb, 0x95, 0xa4, 0x91, 0x1d, 
+  0xd5, 0x1b, 0x30, 0x07, 0x6c, 0x93, 0x27, 0x51, 0x19, 0xac, 0x12, 0x8f, 0x95, 0x29, 0xc3, 0xeb, 
+  0x68, 0x1c, 0x2a, 0x95, 0xac, 0x82, 0xb1, 0xaa, 0xbf, 0xd1, 0xc8, 0x5f, 0x75, 0xcd, 0x31, 0xd9, 
+  0xdc, 0xe4, 0xe0, 0x54, 0xf9, 0xac, 0xe2, 0x33, 0xd8, 0xb5, 0xfb, 0x44, 0x4d, 0xfc, 0xda, 0xc8, 
+  0x2c, 0xd9, 0xae, 0x2c, 0x6e, 0xcd, 0x6c, 0x57, 0x1d, 0x29, 0x93, 0xed, 0x7a, 0x2f, 0xcc, 0xc2, 
+  0x75, 0x05, 0x9d, 0xc9, 0xb5, 0xd5, 0x71, 0x6b, 0xe4, 0xda, 0x42, 0x65, 0xc1, 0x75, 0xc5, 0x6b, 
+  0x6b, 0x64, 0xba, 0xb2, 0x54, 0x0b, 0x9e, 0xed, 0xeb, 0xb8, 0x58, 0xd9, 0xda, 0x7b, 0x91, 0x35, 
+  0x58, 0x6a, 0x57, 0xb2, 0x4d, 0x1d, 0xaf, 0xcd, 0x49, 0x62, 0x73, 0x51, 0x9b, 0xc4, 0x67, 0xc7, 
+  0x6c, 0x44, 0x55, 0xdb, 0x0a, 0xcf, 0xdc, 0x8f, 0x54, 0xcc, 0x5b, 0x9d, 0x3f, 0x6c, 0x31, 0x6f, 
+  0x06, 0x2a, 0x83, 0x57, 0x9b, 0x03, 0xdd, 0x68, 0xe6, 0x2a, 0xd4, 0x15, 0x9c, 0x56, 0x3c, 0xe8, 
+  0x46, 0x56, 0x2b, 0x5b, 0x24, 0x93, 0xd7, 0x7a, 0x77, 0xbd, 0xca, 0x6c, 0x05, 0x99, 0xc1, 0xad, 
+  0xd5, 0xc1, 0x6f, 0x62, 0xd7, 0x42, 0x61, 0xc1, 0xaf, 0xc5, 0xc1, 0x6f, 0xe4, 0xd8, 0xb2, 0x73, 
+  0x33, 0x79, 0xde, 0x14, 0x53, 0xa8, 0x72, 0x6d, 0x41, 0x68, 0xf0, 0x5d, 0x13, 0x87, 0x68, 0xe2, 
+  0xdc, 0x4a, 0xa9, 0xe0, 0x1d, 0x76, 0x95, 0xbd, 0xd2, 0x89, 0xfc, 0x46, 0xb9, 0x1b, 0x5a, 0x78, 
+  0x80, 0x07, 0x04, 0x62, 0xfa, 0x49, 0xa4, 0x1c, 0x31, 0x0e, 0xd4, 0x02, 0x2d, 0x62, 0xeb, 0xf6, 
+  0xfc, 0xe4, 0x42, 0x6f, 0xef, 0x5d, 0x7a, 0xee, 0x06, 0x86, 0x05, 0x94, 0xd1, 0xa6, 0xd3, 0x57, 
+  0xb6, 0x80, 0xbc, 0xe8, 0xb9, 0x0c, 0x3d, 0xec, 0x1b, 0xe4, 0x0c, 0x5d, 0x65, 0xb3, 0xeb, 0xb2, 
+  0x44, 0x0e, 0xe1, 0x69, 0x97, 0xd1, 0x8f, 0x0f, 0x41, 0x14, 0xb6, 0x89, 0xa3, 0x87, 0x6e, 0x35, 
+  0x90, 0xe2, 0xc1, 0x1e, 0xcf, 0x2c, 0x4f, 0x96, 0x32, 0xdc, 0xcf, 0xde, 0x97, 0xa4, 0x38, 0x9b, 
+  0x76, 0x65, 0x2e, 0xea, 0x6d, 0x5b, 0x26, 0x23, 0x5c, 0x54, 0x8d, 0xef, 0x88, 0x31, 0xaf, 0x10, 
+  0xe6, 0x5b, 0x88, 0xda, 0x3c, 0xa9, 0x14, 0x3a, 0xfa, 0x42, 0x48, 0x19, 0xb4, 0xfb, 0x7a, 0xfa, 
+  0x95, 0x17, 0x68, 0x34, 0x72, 0x81, 0x3d, 0x3e, 0x9c, 0x3c, 0x9a, 0x9f, 0x19, 0xd7, 0x3c, 0x8b, 
+  0xcc, 0x21, 0xf3, 0xbc, 0x63, 0x54, 0xbe, 0xa2, 0x6f, 0xcc, 0xe6, 0x20, 0x3f, 0x16, 0xc9, 0xbf, 
+  0x7c, 0xe1, 0xaf, 0xf2, 0x2b, 0x4a, 0x1f, 0x8b, 0x52, 0xfe, 0x62, 0x3d, 0x51, 0x9c, 0x3f, 0x87, 
+  0x0a, 0xe6, 0x1f, 0xe9, 0xc1, 0x01, 0xc6, 0xf2, 0x96, 0x8d, 0x23, 0xaf, 0x40, 0xcc, 0xa7, 0xbc, 
+  0xc4, 0xc7, 0x6e, 0x09, 0x69, 0xeb, 0x2a, 0xc3, 0x63, 0x86, 0x64, 0x15, 0xd2, 0x69, 0x0b, 0x17, 
+  0x46, 0x10, 0x83, 0x82, 0x19, 0x2a, 0xc8, 0xd5, 0xdb, 0x1f, 0x9a, 0x17, 0x39, 0xde, 0xea, 0xd7, 
+  0xc8, 0xfb, 0xdb, 0x11, 0xc6, 0x32, 0xcb, 0x52, 0x7c, 0x6b, 0x17, 0x6a, 0xe8, 0x71, 0x7d, 0x12, 
+  0x5f, 0x01, 0xa3, 0x2a, 0xdc, 0x34, 0x89, 0xe7, 0x61, 0xba, 0xc0, 0x57, 0xba, 0xb1, 0xba, 0x22, 
+  0xbb, 0x69, 0xdf, 0x11, 0x8e, 0x8b, 0xc3, 0x40, 0xae, 0x9d, 0xbb, 0x30, 0x8a, 0x9c, 0x2b, 0xea, 
+  0x30, 0x4b, 0xec, 0x3b, 0x79, 0xf0, 0x91, 0x66, 0x4e, 0xb0, 0x5c, 0xa6, 0xc9, 0xa7, 0x70, 0x01, 
+  0x74, 0x47, 0xf7, 0x4e, 0xbf, 0x97, 0x75, 0x09, 0x77, 0xcf, 0x0c, 0x72, 0x4c, 0x1d, 0x66, 0xef, 
+  0x18, 0xab, 0xb1, 0x51, 0x95, 0xa6, 0xdc, 0x61, 0xaa, 0x26, 0x78, 0xfd, 0x25, 0x3c, 0x0e, 0xb5, 
+  0x24, 0x2f, 0x3f, 0x56, 0xd3, 0xbc, 0xc0, 0xa8, 0xe2, 0x7d, 0x94, 0x97, 0x49, 0x56, 0xbd, 0xd3, 
+  0xc2, 0xd4, 0x85, 0x0e, 0x49, 0x41, 0x10, 0x4b, 0x4a, 0x65, 0x47, 0xf8, 0xd8, 0xe6, 0x5d, 0x52, 
+  0x49, 0x06, 0xc8, 0x8b, 0xba, 0x34, 0xc9, 0x93, 0x69, 0x52, 0xb9, 0xfc, 0x20, 0xeb, 0x8b, 0x4b, 
+  0x38, 0x1b, 0x4c, 0x1f, 0x5f, 0x38, 0xc8, 0xce, 0x0e, 0xe9, 0x94, 0x44, 0x96, 0x39, 0xd0, 0x4f, 
+  0xb9, 0xf7, 0x2b, 0x29, 0x61, 0x1e, 0x2f, 0xde, 0x43, 0x18, 0x4a, 0x70, 0x5e, 0x0a, 0x76, 0x97, 
+  0xd9, 0xc3, 0xbb, 0xec, 0x01, 0x7d, 0xde, 0x65, 0xc3, 0x9a, 0x6e, 0xc9, 0x4d, 0x9e, 0x2f, 0xb3, 
+  0x21, 0x19, 0x17, 0x7d, 0x0b, 0x4e, 0x79, 0xff, 0xd8, 0xb4, 0xda, 0xd6, 0xf3, 0xdb, 0x13, 0x0b, 
+  0x85, 0x3b, 0x77, 0x19, 0xe1, 0xde, 0x22, 0x53, 0x2a, 0x96, 0xf7, 0x76, 0xc8, 0x7e, 0x2a, 0x99, 
+  0x6f, 0x9a, 0x18, 0x95, 0x6c, 0x39, 0x04, 0xe6, 0x9a, 0xbf, 0x09, 0x98, 0xdd, 0x34, 0x42, 0x50, 
+  0xfd, 0xbe, 0x94, 0x05, 0x2b, 0x18, 0x52, 0x06, 0x88, 0x7a, 0x74, 0x06, 0x0f, 0x9b, 0x80, 0xef, 
+  0xc2, 0x79, 0x58, 0x00, 0x6f, 0xa6, 0xb8, 0xe0, 0xae, 0xa0, 0x5c, 0x74, 0xa6, 0xce, 0x80, 0x32, 
+  0x93, 0x50, 0xcb, 0x54, 0xac, 0x60, 0xe2, 0x08, 0xb0, 0x25, 0xcf, 0xc0, 0xc5, 0x66, 0x46, 0xfe, 
+  0x6f, 0x95, 0x58, 0x91, 0x19, 0x1b, 0x66, 0x0d, 0x71, 0x38, 0x7b, 0xd0, 0x0d, 0x28, 0x7d, 0xbf, 
+  0x09, 0x00, 0x45, 0x21, 0xfc, 0x6b, 0x3a, 0x7b, 0x4b, 0xf3, 0x9a, 0x70, 0x96, 0xbc, 0xaa, 0x28, 
+  0xa5, 0xd1, 0xcd, 0xb2, 0x10, 0xaf, 0x72, 0xb1, 0x3f, 0x62, 0x25, 0x57, 0x6a, 0x6a, 0x83, 0x62, 
+  0xa2, 0xbb, 0xfc, 0x8c, 0x35, 0x17, 0x3b, 0x80, 0x9b, 0xe4, 0xee, 0xcd, 0x3f, 0xf3, 0xfc, 0x55, 
+  0x3c, 0x4f, 0xec, 0x4c, 0x00, 0xc0, 0x59, 0x12, 0x05, 0xe9, 0x0b, 0x96, 0xba, 0x5d, 0x0f, 0x13, 
+  0xcc, 0x69, 0x4d, 0x3c, 0x3e, 0x4f, 0xae, 0xaf, 0x23, 0x7d, 0xab, 0x05, 0x55, 0xfc, 0xf6, 0x50, 
+  0xda, 0x0d, 0x66, 0xb7, 0xb8, 0x0c, 0xcf, 0x70, 0x08, 0xec, 0x29, 0x32, 0x0a, 0x40, 0x2d, 0x6f, 
+  0xc0, 0xd6, 0x61, 0x92, 0x7c, 0x0c, 0xc1, 0x24, 0xa9, 0xf0, 0xf8, 0x9a, 0xc3, 0x3c, 0x39, 0xcb, 
+  0x53, 0x96, 0x0e, 0x2f, 0x1c, 0x0e, 0x8c, 0x7d, 0x61, 0x6e, 0x6e, 0x6d, 0x8f, 0x1a, 0x44, 0x9b, 
+  0x2e, 0xb5, 0x06, 0x46, 0x9f, 0x3e, 0x1b, 0x39, 0x95, 0x28, 0xb6, 0x25, 0x92, 0xaf, 0x58, 0xc1, 
+  0x0b, 0x07, 0xe2, 0xde, 0xc1, 0x48, 0x3b, 0x8e, 0x6f, 0xce, 0x86, 0x35, 0xce, 0xe6, 0xb5, 0xeb, 
+  0x50, 0x45, 0x54, 0xec, 0x2c, 0x59, 0xa5, 0x53, 0xc6, 0xe6, 0xb4, 0xf6, 0xd6, 0x53, 0x71, 0xd4, 
+  0x25, 0xb5, 0x28, 0xce, 0x97, 0x13, 0x2a, 0xf7, 0x09, 0xfb, 0x04, 0x1e, 0xc9, 0xd0, 0xec, 0xd8, 
+  0xb8, 0xcb, 0xb0, 0x4f, 0xae, 0xd2, 0xe4, 0x0e, 0x04, 0x09, 0xe6, 0x6a, 0x11, 0xc4, 0x2b, 0x58, 
+  0x03, 0x6c, 0x37, 0x99, 0xb2, 0xbb, 0x90, 0xbf, 0xfd, 0xee, 0xf3, 0x14, 0xa6, 0x9a, 0xc4, 0x6c, 
+  0xeb, 0xd7, 0xb2, 0xd7, 0x34, 0xfa, 0x04, 0x08, 0x9e, 0xe7, 0x30, 0x62, 0xb8, 0x8a, 0xfe, 0x6b, 
+  0xf0, 0xf5, 0x1f, 0x88, 0x4f, 0x70, 0xf1, 0xf5, 0xe8, 0x60, 0xb5, 0x5d, 0x17, 0xe3, 0x30, 0x41, 
+  0xab, 0xf3, 0xb0, 0x61, 0x28, 0x9a, 0xb9, 0xf6, 0x4b, 0x61, 0xd2, 0x33, 0x62, 0xb7, 0x98, 0xd9, 
+  0x5a, 0xc3, 0x73, 0xea, 0x8b, 0xcc, 0x70, 0x4f, 0xb1, 0x19, 0x25, 0x32, 0x76, 0x8b, 0x6b, 0xc4, 
+  0xdf, 0xb3, 0x48, 0xb8, 0xc2, 0x29, 0x6f, 0x29, 0xcf, 0x8a, 0x05, 0xae, 0x68, 0x4a, 0x17, 0x49, 
+  0x3c, 0x5d, 0x64, 0xec, 0xc5, 0x31, 0xb0, 0xbb, 0xf5, 0x8a, 0x6b, 0x68, 0xb0, 0x84, 0xe1, 0x85, 
+  0x00, 0x41, 0x77, 0xff, 0xb9, 0xbc, 0xf1, 0x0b, 0xfb, 0x81, 0x8b, 0xa2, 0x35, 0xae, 0x85, 0x93, 
+  0x4c, 0x1e, 0x1e, 0x4f, 0x96, 0x62, 0x29, 0x84, 0x7e, 0xf0, 0x4a, 0x00, 0xde, 0x75, 0xbe, 0x5c, 
+  0xb3, 0x6d, 0xc4, 0x5d, 0x18, 0xcf, 0x92, 0x3b, 0xb6, 0x7f, 0x40, 0x4a, 0x30, 0x8d, 0x1e, 0xfc, 
+  0x3f, 0x37, 0xb4, 0x56, 0xb0, 0xd9, 0x91, 0xa7, 0xe2, 0x9d, 0xc0, 0x79, 0x70, 0x65, 0x4c, 0xe4, 
+  0x50, 0x14, 0xd7, 0xcc, 0x22, 0x1b, 0xca, 0x31, 0xf9, 0x23, 0xe9, 0x50, 0x99, 0x06, 0x75, 0x9f, 
+  0xe5, 0x74, 0xd1, 0xec, 0x74, 0x91, 0x8c, 0x01, 0xf2, 0xa5, 0x1e, 0xfa, 0x2b, 0xf2, 0x9f, 0x44, 
+  0xa0, 0x3d, 0x6b, 0x83, 0x42, 0x80, 0x5a, 0x90, 0x14, 0x07, 0x78, 0x4d, 0x28, 0xf8, 0x30, 0x56, 
+  0x10, 0xe0, 0xca, 0xdd, 0xa2, 0x39, 0xae, 0xf4, 0x66, 0xe3, 0xd5, 0xf2, 0x3a, 0x0d, 0x66, 0xf4, 
+  0x7d, 0x6a, 0xee, 0xcf, 0x48, 0x70, 0x95, 0xac, 0xf2, 0xe1, 0x55, 0x14, 0xc4, 0x1f, 0x89, 0x5c, 
+  0xc6, 0xde, 0x05, 0x59, 0x76, 0x97, 0xa4, 0x33, 0xb6, 0xac, 0xca, 0x07, 0x75, 0x65, 0x15, 0xda, 
+  0xb0, 0x84, 0x2a, 0x6c, 0x23, 0x74, 0xea, 0x60, 0x19, 0xfe, 0x4c, 0xef, 0x9b, 0x1a, 0x49, 0x05, 
+  0x04, 0x2a, 0x3f, 0xd2, 0x7b, 0x76, 0x9c, 0x0e, 0x4b, 0x56, 0xdb, 0x2e, 0x11, 0x76, 0x22, 0xfb, 
+  0xbd, 0xbb, 0xbb, 0x6b, 0xdb, 0x0e, 0x40, 0x59, 0x33, 0xac, 0x56, 0x48, 0x2e, 0x34, 0xb8, 0xd5, 
+  0x64, 0xee, 0x8d, 0xc7, 0x2d, 0x66, 0x82, 0x9c, 0x37, 0x84, 0x0c, 0xf9, 0xbc, 0xb0, 0xcd, 0xf7, 
+  0xde, 0xf3, 0xf6, 0x98, 0x94, 0x89, 0x6f, 0xcc, 0x5e, 0xda, 0x61, 0xf3, 0xb6, 0x83, 0xfd, 0xf4, 
+  0x2f, 0x3d, 0x6e, 0xa0, 0x74, 0x98, 0x6f, 0xc0, 0x58, 0xad, 0x2d, 0x19, 0x72, 0x3a, 0x6c, 0xfc, 
+  0x86, 0x73, 0xf7, 0x21, 0x2c, 0x57, 0x6f, 0xc9, 0x72, 0xf3, 0xe4, 0xc7, 0xe3, 0xfe, 0xf3, 0xe2, 
+  0xc2, 0x12, 0xde, 0x43, 0x12, 0x32, 0xf6, 0x13, 0xbd, 0xa2, 0x7f, 0x39, 0xa4, 0xa3, 0x3a, 0x42, 
+  0x63, 0x21, 0xb6, 0xa4, 0x78, 0x2b, 0x42, 0x8d, 0x78, 0x85, 0x44, 0x35, 0xdd, 0x13, 0xb4, 0xd6, 
+  0xd8, 0x22, 0x63, 0x49, 0xc4, 0x26, 0xb0, 0x86, 0x3e, 0x7d, 0xfa, 0x74, 0x97, 0x28, 0x32, 0xe6, 
+  0x98, 0x84, 0x5b, 0x60, 0x29, 0x25, 0x7d, 0x6c, 0xa0, 0x2f, 0x60, 0x50, 0x99, 0x01, 0xaa, 0xfe, 
+  0x43, 0x51, 0xb1, 0xbe, 0x05, 0x23, 0x51, 0x02, 0x46, 0x60, 0x56, 0x9b, 0x6c, 0x03, 0x83, 0xb6, 
+  0xc8, 0x5e, 0x33, 0x98, 0x56, 0xb9, 0xcb, 0x0a, 0x3a, 0xd7, 0xeb, 0x28, 0x0b, 0xa8, 0x16, 0x2e, 
+  0x5b, 0x17, 0xa8, 0x6d, 0x69, 0x3c, 0x83, 0x6a, 0x3b, 0x06, 0xe6, 0x7a, 0x45, 0x4c, 0xcb, 0x1e, 
+  0x09, 0x92, 0xe7, 0x09, 0x7c, 0x93, 0x25, 0x2e, 0x28, 0x6a, 0x90, 0x2a, 0x79, 0x26, 0xb1, 0x7d, 
+  0x65, 0x5c, 0xbf, 0xaa, 0x6d, 0xe9, 0xeb, 0x75, 0x69, 0x3c, 0xcb, 0xfe, 0x12, 0xe6, 0x37, 0x2e, 
+  0x91, 0xfe, 0xf2, 0xf6, 0x36, 0x5b, 0x04, 0x0b, 0xea, 0xc2, 0x65, 0x30, 0x9b, 0x61, 0x74, 0x84, 
+  0xb9, 0x81, 0x84, 0x5b, 0x67, 0xc5, 0x32, 0xad, 0x40, 0x1c, 0x98, 0xbc, 0xc3, 0xb2, 0x36, 0x0b, 
+  0xcc, 0xb6, 0xe6, 0xde, 0xd0, 0x5c, 0xed, 0x52, 0xba, 0x8c, 0x82, 0x29, 0x58, 0x72, 0x9c, 0x54, 
+  0xc2, 0x11, 0xad, 0xb6, 0xeb, 0x54, 0x1c, 0x4f, 0x45, 0x78, 0xb8, 0x62, 0x4c, 0x8a, 0x0f, 0x63, 
+  0xe8, 0xa9, 0xa3, 0x42, 0x38, 0x69, 0x77, 0x0e, 0xee, 0x53, 0x76, 0xc3, 0xf2, 0x50, 0x52, 0x94, 
+  0x3f, 0x8b, 0x76, 0x9a, 0x85, 0x6e, 0x2d, 0xd6, 0x9a, 0xf9, 0xa2, 0x7a, 0x42, 0xb6, 0x71, 0x30, 
+  0xe9, 0xd0, 0x0f, 0xdb, 0x8b, 0x23, 0x63, 0xd1, 0x8d, 0x50, 0x36, 0x6d, 0x7f, 0x4e, 0xf2, 0x74, 
+  0x45, 0xb9, 0xc4, 0xaf, 0xeb, 0xfc, 0x0a, 0x32, 0x0f, 0x22, 0xf6, 0x5d, 0x00, 0xd3, 0x5f, 0xa8, 
+  0x69, 0x6d, 0xb8, 0x08, 0x45, 0x73, 0x74, 0x81, 0x4c, 0x91, 0xe8, 0xda, 0xab, 0xf8, 0xa0, 0xfc, 
+  0x9a, 0xf4, 0x58, 0x39, 0xaf, 0x92, 0x71, 0x66, 0x7f, 0x8f, 0x27, 0x24, 0x94, 0xab, 0xb6, 0xe1, 
+  0xcd, 0xb2, 0x4b, 0x78, 0x1c, 0x96, 0x94, 0x59, 0x64, 0x74, 0x3c, 0x4b, 0xa6, 0x2c, 0x92, 0x8e, 
+  0xb4, 0x1e, 0x45, 0x94, 0x05, 0xd5, 0xff, 0x7c, 0x7f, 0x1e, 0x5c, 0xbf, 0x45, 0xe5, 0x22, 0xe1, 
+  0xe2, 0x1a, 0x5f, 0x5b, 0xc2, 0x92, 0x95, 0xa9, 0x9a, 0x9f, 0x4c, 0x2f, 0xf2, 0x4b, 0x6c, 0x73, 
+  0x90, 0x83, 0xa3, 0x73, 0x05, 0xf3, 0x1d, 0x58, 0x0c, 0xf2, 0xe0, 0x51, 0x96, 0x4e, 0x51, 0x99, 
+  0x59, 0x75, 0xa6, 0x55, 0x63, 0x8d, 0xbf, 0xb1, 0x99, 0x37, 0x62, 0xae, 0xae, 0x6d, 0x03, 0xcc, 
+  0x42, 0x61, 0x7c, 0x7b, 0xab, 0xde, 0x56, 0x75, 0x6d, 0xb0, 0x85, 0x8f, 0x6f, 0x55, 0x0f, 0x13, 
+  0x9e, 0x67, 0x4c, 0xbf, 0x0c, 0xb2, 0x37, 0x2b, 0x0c, 0x1a, 0xb2, 0x6b, 0x0d, 0xaa, 0x6b, 0xcf, 
+  0xf6, 0xf1, 0x6c, 0xbb, 0xbc, 0x62, 0x59, 0x31, 0xd5, 0xc3, 0x0b, 0x05, 0xd6, 0xd3, 0x42, 0xb0, 
+  0x6c, 0xb8, 0xc4, 0x7d, 0xf3, 0x44, 0xde, 0x37, 0x97, 0x23, 0x97, 0xe0, 0x48, 0xf2, 0xeb, 0xe6, 
+  0x1b, 0x4c, 0x52, 0xc3, 0x60, 0x2b, 0x24, 0xf2, 0x37, 0xeb, 0x70, 0xf3, 0x87, 0x31, 0x18, 0x9d, 
+  0x42, 0x35, 0x16, 0xc1, 0xa8, 0x04, 0x66, 0x7a, 0x46, 0x8c, 0x42, 0x25, 0x37, 0x30, 0xc9, 0x55, 
+  0x6e, 0xc7, 0xf3, 0x56, 0x16, 0x62, 0x57, 0xd0, 0x28, 0xd0, 0x09, 0x2e, 0xc8, 0xf1, 0x77, 0xf1, 
+  0xb5, 0x0d, 0x95, 0x1e, 0xfb, 0x32, 0xea, 0x8a, 0x91, 0x7c, 0x93, 0x6c, 0xa0, 0xb1, 0xef, 0x57, 
+  0x69, 0x6f, 0x26, 0x71, 0x2d, 0x76, 0xa5, 0xe2, 0xca, 0x49, 0x6d, 0x80, 0x86, 0x4b, 0x7d, 0x51, 
+  0xef, 0xe5, 0x93, 0xb3, 0xf3, 0x83, 0xce, 0xc1, 0x3b, 0x19, 0x22, 0x87, 0x27, 0xf6, 0xf3, 0xcb, 
+  0x17, 0x13, 0x3f, 0xc3, 0x28, 0xa1, 0xc7, 0x0c, 0x84, 0x88, 0x5f, 0xfb, 0x8a, 0x14, 0x5c, 0x8c, 
+  0x7e, 0x4b, 0x56, 0xe5, 0x1d, 0x87, 0xe0, 0x96, 0xbe, 0xa5, 0x39, 0x6c, 0x33, 0x3f, 0x6e, 0x8c, 
+  0x39, 0x2b, 0x70, 0x67, 0xab, 0x29, 0xf8, 0x0b, 0x59, 0x13, 0x98, 0x2a, 0x4b, 0x7d, 0x05, 0xe1, 
+  0xa1, 0xa3, 0xfd, 0x20, 0xa2, 0xb8, 0xde, 0xbf, 0x03, 0x29, 0xe2, 0x17, 0xab, 0x58, 0x24, 0xca, 
+  0x89, 0x79, 0x63, 0xc2, 0xcf, 0xa6, 0xaa, 0xc4, 0x29, 0xa7, 0xf2, 0x3a, 0x39, 0x8c, 0x80, 0xef, 
+  0xba, 0x4b, 0xbe, 0x10, 0x55, 0x8c, 0x0f, 0x36, 0x90, 0xb8, 0xfd, 0xcf, 0x48, 0xc1, 0xd0, 0xa0, 
+  0xc7, 0xc7, 0xed, 0xf6, 0x50, 0xf3, 0x15, 0xcc, 0x6c, 0x7e, 0x6b, 0xb7, 0x3d, 0xcf, 0xaf, 0x8e, 
+  0x47, 0xcf, 0xf6, 0x29, 0x16, 0xc1, 0x70, 0xf9, 0x79, 0x13, 0x44, 0xc7, 0x22, 0x91, 0x22, 0x38, 
+  0x4f, 0xea, 0x8e, 0x79, 0xac, 0x82, 0x28, 0xb5, 0x17, 0x6a, 0x0f, 0x66, 0x8b, 0x30, 0x6e, 0x1c, 
+  0x41, 0x06, 0xd5, 0x34, 0x7e, 0x0c, 0x68, 0x5c, 0xe9, 0x5f, 0xeb, 0x41, 0x19, 0x06, 0x15, 0x67, 
+  0x8b, 0x41, 0x08, 0x66, 0xec, 0xea, 0xf0, 0x67, 0xdc, 0x42, 0x0c, 0x6b, 0x36, 0x15, 0xc6, 0x50, 
+  0xa8, 0xbe, 0x90, 0x75, 0x48, 0x74, 0x12, 0x1e, 0x20, 0x7b, 0xd6, 0xb0, 0x8d, 0xf0, 0x0d, 0xe6, 
+  0xe5, 0x11, 0x9b, 0x5c, 0x95, 0x31, 0x17, 0x65, 0xa9, 0x44, 0xc1, 0xd9, 0x73, 0x6d, 0x38, 0xb8, 
+  0xb2, 0x35, 0xfd, 0x7c, 0x03, 0x02, 0x63, 0xc9, 0xd0, 0xa5, 0xc7, 0x21, 0x4a, 0x40, 0x18, 0x2c, 
+  0xf2, 0x53, 0x85, 0xd0, 0x8a, 0x5d, 0xdc, 0x30, 0xb3, 0xcf, 0xa1, 0xb9, 0xb6, 0x53, 0xa1, 0xf3, 
+  0x1b, 0x8a, 0x5f, 0x04, 0xb8, 0xc1, 0x94, 0xf1, 0x4c, 0x7e, 0x32, 0xcc, 0x09, 0xe0, 0xd7, 0x55, 
+  0x92, 0xe4, 0x28, 0x0e, 0x3c, 0x07, 0x72, 0xe8, 0x7c, 0x0e, 0x0a, 0xdc, 0x75, 0x4e, 0x79, 0x71, 
+  0x9c, 0xdc, 0xed, 0xe3, 0x72, 0x5a, 0x3f, 0xa0, 0xe2, 0x8c, 0x07, 0x86, 0x53, 0x1b, 0x15, 0x7b, 
+  0x4a, 0x8b, 0x38, 0xb9, 0x50, 0xb6, 0x7d, 0x15, 0x5e, 0x3b, 0x72, 0x47, 0x3a, 0xc2, 0xe3, 0x88, 
+  0xd6, 0xa7, 0x11, 0xc4, 0xaf, 0xdb, 0x64, 0xe2, 0x21, 0xdc, 0x1e, 0x7b, 0xfb, 0x4c, 0xb3, 0x46, 
+  0x48, 0x66, 0x8a, 0x1c, 0x22, 0x18, 0xf7, 0x23, 0x70, 0xb0, 0x0e, 0x17, 0x59, 0xe3, 0xc4, 0x12, 
+  0x70, 0x4d, 0x53, 0x4b, 0x80, 0x55, 0x93, 0x0f, 0x3e, 0x8b, 0x0f, 0x95, 0x55, 0x3c, 0xbb, 0x22, 
+  0x10, 0xea, 0x73, 0x1f, 0x6f, 0x58, 0xeb, 0xcc, 0xfa, 0x3c, 0x40, 0x31, 0xac, 0x09, 0x5c, 0x00, 
+  0x40, 0x0c, 0xca, 0x58, 0xad, 0xc6, 0x52, 0x7c, 0xbb, 0x04, 0xb0, 0x47, 0xd3, 0x65, 0x0a, 0x43, 
+  0x5b, 0x85, 0x51, 0x2a, 0x41, 0xd3, 0x46, 0x5b, 0xb4, 0xcb, 0xe9, 0x82, 0x75, 0x86, 0x2d, 0x49, 
+  0x5d, 0x4e, 0x84, 0x70, 0x23, 0x68, 0x17, 0x71, 0xee, 0x4b, 0xa0, 0xed, 0xed, 0xdd, 0x01, 0x2b, 
+  0xe5, 0x84, 0x14, 0x41, 0x82, 0x2d, 0x23, 0x10, 0x83, 0xf7, 0xf6, 0xf0, 0x6e, 0x57, 0x65, 0x69, 
+  0xa0, 0xf8, 0x3a, 0x1b, 0xe7, 0x16, 0x13, 0x11, 0x9c, 0x23, 0xde, 0xc2, 0xe1, 0xb8, 0xf0, 0x3b, 
+  0x62, 0x45, 0x2f, 0xa2, 0x6f, 0x85, 0xd6, 0xed, 0xed, 0xbd, 0x67, 0x66, 0x99, 0x74, 0xb9, 0xeb, 
+  0xbb, 0x38, 0x3b, 0x7b, 0xed, 0x9c, 0xbd, 0x3c, 0x78, 0xd4, 0x77, 0x94, 0x66, 0xe5, 0x82, 0x64, 
+  0xa8, 0x84, 0x62, 0x09, 0x75, 0x25, 0x68, 0x61, 0x0b, 0x05, 0xfb, 0xf8, 0xa2, 0xc7, 0x8a, 0xc5, 
+  0x31, 0x91, 0x7d, 0x0b, 0xab, 0x56, 0x61, 0x85, 0x2d, 0x29, 0x43, 0x9b, 0x68, 0xa4, 0xdc, 0xf9, 
+  0x40, 0x3b, 0x41, 0x8c, 0x2f, 0x74, 0x04, 0x5f, 0x82, 0x99, 0x41, 0xf4, 0xde, 0x7f, 0xab, 0x09, 
+  0x64, 0x11, 0x00, 0xa1, 0xed, 0x43, 0x3d, 0x2e, 0x50, 0xce, 0x01, 0xf1, 0x76, 0x9f, 0x0a, 0x98, 
+  0x5e, 0x0e, 0x80, 0x5a, 0xe8, 0x63, 0x68, 0x8f, 0x88, 0x48, 0x30, 0x73, 0x62, 0x29, 0x85, 0x05, 
+  0x26, 0xb0, 0x36, 0x43, 0x5b, 0x08, 0x83, 0x57, 0xa7, 0xf4, 0x17, 0xb0, 0x9b, 0x93, 0x55, 0x1c, 
+  0xac, 0xf2, 0x9b, 0x24, 0x0d, 0x7f, 0xad, 0xb0, 0x60, 0x81, 0x90, 0x8d, 0x61, 0x3f, 0x16, 0x4e, 
+  0x0d, 0x70, 0x56, 0x26, 0x01, 0xf4, 0x95, 0xb2, 0x28, 0x2a, 0x68, 0xd3, 0xd6, 0xca, 0xa2, 0x48, 
+  0x56, 0xdf, 0xa6, 0x0b, 0xb3, 0x1a, 0x8b, 0xf8, 0x82, 0xc1, 0x14, 0x5e, 0xdb, 0x47, 0xd3, 0xea, 
+  0x49, 0x80, 0x3e, 0x06, 0xb8, 0xfb, 0xb4, 0x4b, 0x1d, 0xf5, 0x1d, 0x2c, 0x83, 0x0a, 0x5e, 0xd8, 
+  0x07, 0x45, 0xa6, 0xb0, 0xfd, 0xb7, 0x29, 0xd8, 0x9b, 0xff, 0x3a, 0x3f, 0x17, 0xda, 0x45, 0xd8, 
+  0x27, 0xa3, 0x44, 0x7e, 0x1e, 0x76, 0xf1, 0x5b, 0x75, 0xeb, 0x61, 0x6a, 0x93, 0xe1, 0x81, 0xa3, 
+  0xa9, 0x0e, 0x58, 0x26, 0x01, 0xae, 0xd3, 0x70, 0x36, 0x09, 0xa9, 0x01, 0x22, 0x4a, 0x4b, 0x2d, 
+  0x0d, 0xf2, 0x3c, 0x98, 0x7e, 0x9c, 0x64, 0x0b, 0x58, 0x4b, 0x71, 0x7a, 0x4d, 0xe6, 0xc1, 0x34, 
+  0x4f, 0xd2, 0x4a, 0xf7, 0x35, 0x70, 0x25, 0xa2, 0x19, 0x9d, 0x06, 0xf7, 0xcd, 0x78, 0xec, 0x60, 
+  0x25, 0x1a, 0x30, 0x0a, 0x13, 0x91, 0x96, 0x8d, 0xfe, 0x67, 0xa5, 0xbd, 0x51, 0xdf, 0xa8, 0x21, 
+  0x5b, 0xd4, 0x10, 0xa0, 0x31, 0xda, 0x28, 0x32, 0xbd, 0x48, 0x88, 0xa8, 0x46, 0x03, 0x68, 0x98, 
+  0xdf, 0xa0, 0x69, 0x71, 0xd8, 0x89, 0xaf, 0xf3, 0xee, 0x83, 0x93, 0xa4, 0xce, 0x4f, 0xd0, 0xc4, 
+  0x79, 0xb5, 0x73, 0xe4, 0xcc, 0x29, 0x7e, 0xa2, 0xb0, 0x50, 0x0c, 0x4e, 0x28, 0x3b, 0x44, 0xfd, 
+  0x7a, 0xbd, 0x10, 0xdc, 0x2e, 0xb4, 0x75, 0x51, 0x29, 0x74, 0x45, 0x18, 0x32, 0xcc, 0x8e, 0xa6, 
+  0x09, 0xe2, 0x3c, 0xb8, 0x05, 0x4b, 0x8b, 0xbc, 0xb6, 0x0a, 0x37, 0x5a, 0xe7, 0x0f, 0x8b, 0xa7, 
+  0x6d, 0x99, 0x01, 0x51, 0xa1, 0x5f, 0x42, 0x5c, 0x35, 0x8a, 0xc5, 0x39, 0xa7, 0x9c, 0x94, 0xe6, 
+  0xd7, 0x49, 0x8a, 0xe3, 0x15, 0x80, 0xd7, 0xbc, 0x2f, 0x9d, 0x3f, 0x4b, 0xe8, 0xdb, 0x0a, 0xa9, 
+  0xc6, 0xbd, 0xcc, 0x69, 0xb3, 0xcf, 0xfa, 0x18, 0x92, 0x79, 0x90, 0xe5, 0x44, 0x1f, 0x1c, 0xb6, 
+  0xcc, 0x48, 0x31, 0x6a, 0xaf, 0x68, 0xdb, 0xe0, 0xf7, 0xea, 0x31, 0x69, 0xa7, 0x6f, 0x1f, 0x1b, 
+  0xd1, 0x9d, 0x12, 0x73, 0x76, 0x06, 0x35, 0x90, 0x48, 0x9e, 0xa0, 0xe1, 0x06, 0xe8, 0x61, 0xfa, 
+  0xd5, 0xe2, 0x60, 0xaa, 0x76, 0x98, 0x0a, 0x4c, 0xa8, 0x9d, 0xaf, 0xe8, 0x57, 0xa1, 0x2a, 0x46, 
+  0x75, 0xcd, 0xbf, 0x2b, 0xca, 0x84, 0x72, 0x0c, 0x4a, 0x7e, 0x8e, 0xdf, 0x54, 0x26, 0xa2, 0x9a, 
+  0x14, 0x36, 0xb0, 0xa8, 0xda, 0x78, 0x3e, 0x22, 0x0f, 0x4f, 0x0b, 0x36, 0x71, 0x74, 0x18, 0xd5, 
+  0x78, 0x94, 0x5c, 0x92, 0x8c, 0xc5, 0xb2, 0x8b, 0x61, 0xa5, 0xfb, 0xe2, 0x45, 0xa2, 0x15, 0xba, 
+  0xa8, 0x4d, 0x61, 0x44, 0x07, 0x63, 0x91, 0x27, 0xa2, 0xf5, 0xe2, 0xda, 0x04, 0x58, 0xa7, 0xdf, 
+  0xbe, 0xbd, 0x82, 0x10, 0xd8, 0x94, 0x14, 0xe4, 0xaa, 0xdd, 0x08, 0x16, 0x59, 0x7c, 0xce, 0xd6, 
+  0xd2, 0x3a, 0x7a, 0x66, 0x37, 0xbc, 0x98, 0x10, 0xcf, 0x36, 0x10, 0x74, 0xad, 0xac, 0x43, 0x58, 
+  0xfa, 0x41, 0xbe, 0xe3, 0xaf, 0xe9, 0x90, 0xaa, 0x94, 0x8a, 0x39, 0x84, 0x2c, 0x60, 0x6d, 0x21, 
+  0xac, 0x6e, 0x41, 0xd9, 0x2c, 0xf3, 0x96, 0xd8, 0x69, 0x1d, 0x7a, 0x79, 0x68, 0x84, 0x33, 0xf5, 
+  0xe4, 0x66, 0x01, 0x1b, 0xf1, 0x46, 0x6f, 0x87, 0x83, 0x35, 0x39, 0x3b, 0x1c, 0xaa, 0x1a, 0x48, 
+  0xd0, 0x3b, 0x51, 0xf6, 0xcf, 0x1a, 0xda, 0x16, 0xdb, 0xe7, 0xe4, 0x66, 0x81, 0x3e, 0x80, 0x5f, 
+  0x71, 0x9e, 0xa0, 0x42, 0x59, 0xd4, 0xe1, 0x49, 0xab, 0x62, 0xce, 0x90, 0x25, 0x8a, 0x60, 0x74, 
+  0xff, 0x80, 0x0d, 0x37, 0xb4, 0x74, 0x00, 0x6b, 0x9b, 0x2d, 0xb7, 0xc9, 0xbc, 0x92, 0xac, 0x8b, 
+  0x2e, 0xf3, 0x66, 0xd1, 0x73, 0x98, 0x8d, 0x72, 0xe7, 0x20, 0x86, 0xd0, 0x75, 0xdc, 0x52, 0xe2, 
+  0x1a, 0xb6, 0xe2, 0xf6, 0x25, 0x5a, 0x8f, 0xcd, 0xb9, 0x36, 0x32, 0xd3, 0xa7, 0x92, 0x94, 0x63, 
+  0xbc, 0x11, 0x18, 0x8f, 0x50, 0x2b, 0x6f, 0xf9, 0xf0, 0x94, 0x46, 0xfa, 0xeb, 0x3e, 0xfe, 0xa5, 
+  0xef, 0x5c, 0xb5, 0x30, 0x6d, 0x11, 0x21, 0xcf, 0x06, 0xad, 0x4d, 0x69, 0x62, 0x9f, 0x17, 0xf3, 
+  0xa9, 0xf2, 0xf1, 0xd2, 0x7c, 0x5c, 0x93, 0xa6, 0xe4, 0xc7, 0xe3, 0xcf, 0x50, 0x30, 0xcc, 0xf1, 
+  0xed, 0x8a, 0xa9, 0x96, 0x3c, 0x33, 0x62, 0xe9, 0x31, 0xe0, 0x8b, 0xba, 0x31, 0x7f, 0x49, 0x20, 
+  0x26, 0x68, 0xbd, 0x3a, 0x3b, 0x29, 0x73, 0xb4, 0x36, 0x68, 0x39, 0x7e, 0xa9, 0x0d, 0x3f, 0x4a, 
+  0x1e, 0xfb, 0x9b, 0x47, 0xd4, 0xc6, 0x5c, 0x5b, 0x0d, 0xa6, 0x39, 0xfb, 0x62, 0x25, 0xf1, 0x7c, 
+  0x2b, 0x62, 0x7c, 0xb5, 0x23, 0xa6, 0xb3, 0x80, 0x49, 0x3b, 0x99, 0xcf, 0x0f, 0x18, 0xee, 0x77, 
+  0x48, 0xe1, 0x46, 0x5d, 0xad, 0x82, 0x6f, 0x52, 0xdb, 0x2a, 0xb4, 0xae, 0xc1, 0xf5, 0x9d, 0x0b, 
+  0x65, 0xae, 0xed, 0xae, 0xc1, 0x8c, 0x04, 0x4b, 0xf6, 0xfd, 0x79, 0x35, 0x7c, 0x45, 0x59, 0xdc, 
+  0x0c, 0x8c, 0x26, 0x66, 0x13, 0x5f, 0xe3, 0x0b, 0x14, 0x6a, 0xcf, 0x46, 0xf7, 0xed, 0x81, 0x2e, 
+  0x23, 0x18, 0x35, 0xde, 0x7c, 0xd2, 0xb9, 0x99, 0x7a, 0xbc, 0xbf, 0x80, 0x87, 0x17, 0xc3, 0x26, 
+  0xa8, 0x16, 0x23, 0xcd, 0xbf, 0x27, 0x36, 0x9f, 0x3b, 0x1c, 0x85, 0xc3, 0x70, 0xd4, 0x5a, 0xab, 
+  0x4d, 0x32, 0x97, 0x56, 0x8b, 0xbb, 0x18, 0xf7, 0xa7, 0x98, 0x06, 0xbe, 0x51, 0x1d, 0x54, 0xc0, 
+  0x4d, 0x8a, 0xa0, 0xc2, 0x59, 0xf3, 0xdb, 0x0f, 0x0f, 0xde, 0x9f, 0xbf, 0x3a, 0x79, 0x3b, 0x74, 
+  0x5e, 0x24, 0xce, 0x7d, 0xb2, 0x72, 0x60, 0xed, 0x8d, 0xa2, 0x7b, 0xe7, 0x2e, 0x88, 0x59, 0x18, 
+  0xf3, 0x98, 0xb7, 0x77, 0x18, 0x82, 0x7d, 0xe7, 0x20, 0x8a, 0x1c, 0xf1, 0xb5, 0x43, 0x16, 0xb2, 
+  0x30, 0x72, 0xe0, 0x23, 0xd0, 0x0a, 0x99, 0xe9, 0x6e, 0x63, 0x45, 0x28, 0x97, 0x85, 0xf8, 0x06, 
+  0xb5, 0x62, 0x79, 0xf1, 0x66, 0x54, 0xb4, 0x06, 0x51, 0xbb, 0xb1, 0xd3, 0x18, 0xab, 0x1d, 0x33, 
+  0x3b, 0x13, 0xfd, 0xaf, 0xb8, 0x5c, 0xb0, 0x69, 0x90, 0x1e, 0x72, 0xff, 0x80, 0x1d, 0x6f, 0x7c, 
+  0x93, 0x4b, 0x08, 0x3a, 0xa1, 0xcd, 0x03, 0x62, 0x0b, 0x54, 0x57, 0xb1, 0xf4, 0x1e, 0x1a, 0x2a, 
+  0x7e, 0xc8, 0xdd, 0x87, 0xe2, 0x62, 0xd6, 0xc6, 0x11, 0x90, 0xc9, 0x28, 0x8b, 0x65, 0x44, 0x73, 
+  0xba, 0x01, 0xa4, 0x78, 0xcb, 0x9b, 0xf1, 0x9d, 0x8f, 0xa2, 0x17, 0x20, 0xd7, 0xf2, 0xca, 0x6a, 
+  0x15, 0xa4, 0x4c, 0x9e, 0x69, 0xff, 0x22, 0x1b, 0x85, 0x82, 0x77, 0x69, 0x72, 0x9d, 0x0a, 0x35, 
+  0x69, 0x74, 0x87, 0xd5, 0x1e, 0x5d, 0x6f, 0x27, 0xd5, 0xb3, 0x67, 0x7e, 0xe8, 0xf7, 0x7a, 0x6c, 
+  0x1f, 0x0a, 0x8f, 0xef, 0x2b, 0xa7, 0xdc, 0xb0, 0x97, 0x10, 0x56, 0x58, 0x67, 0x0d, 0x96, 0xcf, 
+  0xcf, 0xa6, 0x50, 0x85, 0x7e, 0x28, 0x32, 0x42, 0x96, 0xc5, 0xe6, 0xe6, 0x3b, 0x97, 0xfc, 0x71, 
+  0xb5, 0xc4, 0xfc, 0x98, 0xc9, 0x3c, 0x49, 0x17, 0x84, 0xe5, 0x62, 0xe5, 0x2c, 0x86, 0x70, 0x0c, 
+  0xcf, 0xb0, 0xaf, 0x09, 0xf0, 0xeb, 0xd8, 0xdf, 0x75, 0x83, 0x5f, 0x82, 0x4f, 0xee, 0xe7, 0x55, 
+  0x1a, 0x0d, 0x8b, 0xcc, 0x05, 0x3f, 0x87, 0xed, 0xf5, 0x90, 0xbc, 0x3b, 0xc1, 0xef, 0x19, 0x63, 
+  0xe2, 0x00, 0x2c, 0xf7, 0xa0, 0xd0, 0x39, 0x28, 0x36, 0x6e, 0xbc, 0x87, 0x5b, 0x7d, 0x1f, 0x34, 
+  0x18, 0xf5, 0x08, 0xd1, 0xe0, 0xe3, 0xa7, 0x9b, 0xb4, 0xea, 0x9d, 0x61, 0x5f, 0x62, 0x89, 0xf8, 
+  0xeb, 0x9b, 0xd7, 0x2f, 0x61, 0x6d, 0x10, 0x6f, 0x33, 0x2b, 0x3f, 0x87, 0xc1, 0x29, 0xec, 0xc2, 
+  0x1a, 0x71, 0x84, 0x57, 0x21, 0x5f, 0x87, 0x19, 0x74, 0x42, 0x81, 0x8f, 0xa5, 0x10, 0xb8, 0xfe, 
+  0x49, 0x1f, 0x99, 0x1b, 0xc1, 0xc5, 0xcf, 0xa3, 0xe1, 0xae, 0x21, 0x70, 0x2a, 0x92, 0x82, 0x8c, 
+  0xb1, 0xc5, 0x0f, 0x28, 0xe1, 0x5f, 0xd4, 0x4e, 0xf6, 0x2e, 0xe7, 0xea, 0x39, 0x92, 0x65, 0x41, 
+  0x3c, 0xf9, 0x99, 0xf0, 0xb3, 0x65, 0x5d, 0x57, 0x51, 0xf2, 0x43, 0x5d, 0xf2, 0xd4, 0x36, 0x9f, 
+  0x8c, 0xc1, 0x79, 0x79, 0x7e, 0xfe, 0xce, 0xe1, 0x63, 0xee, 0xcc, 0xd9, 0x1c, 0x23, 0x1b, 0xef, 
+  0xbb, 0x99, 0xdb, 0x13, 0x91, 0x13, 0xa7, 0xe1, 0x94, 0x0a, 0xc2, 0x3e, 0x3b, 0xc4, 0x4d, 0x26, 
+  0x30, 0x8e, 0xef, 0x16, 0x94, 0x2f, 0xc7, 0xe7, 0xc7, 0xfb, 0x29, 0x15, 0xa9, 0x38, 0x7a, 0x71, 
+  0x96, 0x4c, 0x3f, 0xc2, 0x0a, 0xc4, 0x7e, 0x0b, 0x00, 0x63, 0x4f, 0xcd, 0x01, 0xd8, 0x55, 0x12, 
+  0x7a, 0x75, 0xc6, 0x9e, 0x5c, 0xf5, 0x0e, 0x8f, 0xc8, 0x07, 0x63, 0x15, 0xdd, 0x24, 0xc6, 0x4d, 
+  0xe6, 0x78, 0x83, 0x48, 0x0d, 0xda, 0x6a, 0x5e, 0xe2, 0x5f, 0x20, 0xc4, 0x0f, 0xf9, 0xb8, 0xdf, 
+  0x7f, 0x26, 0xd8, 0x88, 0x0c, 0xfb, 0xeb, 0xef, 0xe5, 0x6b, 0xec, 0xd5, 0x3e, 0xa7, 0xb0, 0xbe, 
+  0xd1, 0xcd, 0x9d, 0x16, 0xec, 0xbb, 0x7a, 0xd3, 0x05, 0xe8, 0x58, 0x70, 0xbd, 0xb1, 0x71, 0xe5, 
+  0xe5, 0xe1, 0x27, 0x6f, 0xc5, 0x8b, 0xdd, 0xcb, 0xfb, 0x2e, 0x1a, 0x4e, 0xf6, 0x7e, 0xaf, 0xcd, 
+  0xe4, 0x08, 0x58, 0x46, 0xb8, 0x6b, 0xd2, 0xb7, 0x56, 0x9f, 0xd5, 0xd1, 0x10, 0x79, 0x3b, 0xaa, 
+  0x00, 0x2b, 0xdf, 0x57, 0xd0, 0xab, 0xbd, 0xaa, 0x2e, 0x60, 0x68, 0x91, 0x79, 0xd3, 0x15, 0x8d, 
+  0x10, 0x6b, 0x90, 0xa9, 0x27, 0x75, 0xf7, 0xf6, 0x6b, 0x34, 0x4a, 0x91, 0xf3, 0x5e, 0xaf, 0xe7, 
+  0x49, 0xa7, 0x8f, 0x67, 0x68, 0x19, 0xaf, 0xb8, 0xe1, 0x2f, 0xe7, 0xfa, 0xca, 0xef, 0x8b, 0xf9, 
+  0xc9, 0x98, 0x90, 0xe2, 0x23, 0x63, 0xc5, 0x55, 0x3a, 0xe9, 0xb5, 0x95, 0xae, 0x91, 0x9b, 0x2a, 
+  0x5f, 0x76, 0x18, 0x3c, 0xfe, 0x21, 0xfe, 0xe1, 0x49, 0x0f, 0xff, 0xa1, 0x1e, 0x21, 0x92, 0x11, 
+  0xfd, 0xb4, 0x0c, 0xc1, 0xd8, 0x8c, 0x71, 0xdf, 0x9a, 0x27, 0xef, 0xcf, 0x0f, 0xa5, 0xcb, 0xb2, 
+  0x2e, 0xf2, 0xb6, 0xa6, 0x9c, 0x7c, 0xda, 0x21, 0x00, 0x95, 0x77, 0x92, 0x0e, 0x19, 0x2d, 0x83, 
+  0xfc, 0x66, 0xbc, 0x43, 0x90, 0xbf, 0x6b, 0x0b, 0x7f, 0xde, 0xe7, 0xf2, 0x25, 0x94, 0x5f, 0xf9, 
+  0x69, 0x39, 0x02, 0xfe, 0x10, 0xef, 0x12, 0xc8, 0x34, 0x48, 0x91, 0xf9, 0xb7, 0x23, 0x5c, 0xe4, 
+  0xc6, 0xbd, 0x51, 0x5a, 0x5c, 0x7e, 0x1e, 0xa5, 0xf8, 0x62, 0x4b, 0xd9, 0x79, 0x30, 0x4e, 0x2e, 
+  0xd2, 0xcb, 0x11, 0x71, 0x30, 0x84, 0x12, 0xb0, 0x70, 0xe1, 0x01, 0xde, 0xd8, 0x1e, 0x79, 0x01, 
+  0x3c, 0xf2, 0xfc, 0x7e, 0xe4, 0xb5, 0x2f, 0xfd, 0x58, 0x28, 0x95, 0x6f, 0x2f, 0x8d, 0xe5, 0x27, 
+  0x51, 0x1c, 0x15, 0x32, 0x16, 0xfd, 0xf8, 0x81, 0xcc, 0x09, 0x5e, 0x0b, 0x28, 0xf5, 0xad, 0xf6, 
+  0xd9, 0x14, 0x36, 0x13, 0x42, 0x8e, 0xf2, 0xbd, 0x74, 0xfc, 0x7b, 0x55, 0x2e, 0x89, 0x57, 0x8b, 
+  0x2b, 0x8a, 0x31, 0x1d, 0x5c, 0x67, 0x92, 0xb9, 0x83, 0x57, 0x1b, 0xcb, 0xcf, 0xb0, 0x79, 0xde, 
+  0x4e, 0xee, 0xc1, 0x38, 0x1c, 0x87, 0x9f, 0xc0, 0x9c, 0xc7, 0xca, 0x87, 0x24, 0x70, 0x21, 0x0b, 
+  0xca, 0x5b, 0xdd, 0x9f, 0xd9, 0xd8, 0x8f, 0xcb, 0xcf, 0x30, 0x93, 0xb7, 0x3b, 0x07, 0xfc, 0x53, 
+  0x37, 0xf9, 0x18, 0x3f, 0x45, 0x83, 0xd2, 0xdb, 0xd9, 0x7d, 0xd2, 0xeb, 0x61, 0x0e, 0xd8, 0xce, 
+  0xe0, 0x31, 0x08, 0x8a, 0x16, 0x88, 0xf1, 0x43, 0x35, 0x19, 0x19, 0x95, 0x89, 0xd6, 0x5a, 0xdd, 
+  0x7e, 0x3a, 0x26, 0x71, 0x72, 0x47, 0x86, 0x3f, 0x3e, 0x4f, 0xf0, 0x77, 0x18, 0xc3, 0x8e, 0x33, 
+  0xbc, 0xa5, 0x64, 0x38, 0x60, 0x05, 0x49, 0x01, 0x8b, 0x1f, 0x6c, 0x72, 0x66, 0x60, 0xc0, 0xb1, 
+  0x2a, 0x86, 0xaa, 0x58, 0xeb, 0xc2, 0xb9, 0x49, 0xa1, 0xa6, 0xff, 0xb4, 0xf7, 0x9c, 0xad, 0x55, 
+  0xe3, 0x5c, 0xaf, 0x5d, 0x84, 0x71, 0x86, 0x23, 0x58, 0x32, 0x29, 0x56, 0x9a, 0x08, 0x8f, 0xb6, 
+  0x6c, 0x3c, 0x4a, 0x06, 0x09, 0x07, 0xfc, 0x73, 0x30, 0x93, 0x4c, 0xc8, 0xef, 0xf4, 0x04, 0x57, 
+  0xd8, 0xd2, 0x7b, 0x3e, 0xd8, 0xdb, 0x2f, 0xc0, 0x7e, 0x4a, 0x92, 0x19, 0x19, 0xd2, 0xe7, 0x4f, 
+  0x7a, 0x65, 0xd9, 0x59, 0x84, 0x0c, 0xd2, 0xe7, 0x3f, 0x0e, 0x7a, 0x3d, 0xa0, 0x4d, 0x2b, 0x67, 
+  0x87, 0x53, 0xf9, 0x7a, 0xcb, 0x58, 0xd4, 0xf3, 0xea, 0x35, 0x11, 0x91, 0xd3, 0x00, 0xb2, 0x36, 
+  0xab, 0xf0, 0xe4, 0x10, 0x24, 0x5f, 0x29, 0x16, 0xc7, 0x92, 0xa3, 0xef, 0x5c, 0xeb, 0x96, 0xc1, 
+  0x7e, 0x5d, 0x16, 0x34, 0xc8, 0x4f, 0xd8, 0x97, 0x1c, 0xc0, 0x16, 0x47, 0xf7, 0x7f, 0x06, 0xa4, 
+  0xf8, 0x69, 0x77, 0x34, 0xa7, 0x94, 0x67, 0x7e, 0xb1, 0x8f, 0x33, 0xb8, 0xde, 0xe8, 0x0f, 0x3b, 
+  0x3b, 0x7f, 0x74, 0x32, 0x76, 0x21, 0xeb, 0x0d, 0xb7, 0xdb, 0xef, 0x4f, 0x5f, 0x8f, 0x6f, 0x92, 
+  0x05, 0xed, 0xfe, 0x92, 0xa1, 0x29, 0xff, 0xc3, 0xff, 0x00, 0x74, 0x47, 0xf1, 0x25, 0x3a, 0x90, 
+  0x00, 0x00, 0x00 };
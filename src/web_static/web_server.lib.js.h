@@ -1,3 +1,3749 @@
-static const char CONTENT_LIB_JS[] PROGMEM = 
-  "\"use strict\";function _typeof(e){return(_typeof=\"function\"==typeof Symbol&&\"symbol\"==typeof Symbol.iterator?function(e){return typeof e}:function(e){return e&&\"function\"==typeof Symbol&&e.constructor===Symbol&&e!==Symbol.prototype?\"symbol\":typeof e})(e)}function BaseViewModel(e,t){var n=2<arguments.length&&void 0!==arguments[2]?arguments[2]:{};this.remoteUrl=t,ko.mapping.fromJS(e,n,this),this.fetching=ko.observable(!1)}function ConfigViewModel(e){var t=ko.pureComputed(function(){return e()+\"/config\"});BaseViewModel.call(this,{ssid:\"\",pass:\"\",emoncms_server:\"data.openevse.com/emoncms\",emoncms_apikey:\"\",emoncms_node:\"\",emoncms_fingerprint:\"\",emoncms_enabled:0,mqtt_protocol:\"mqtt\",mqtt_protocol_enable:!1,mqtt_server:\"\",mqtt_port:1883,mqtt_port_enable:!1,mqtt_reject_unauthorized:!0,mqtt_reject_unauthorized_enable:!1,mqtt_topic:\"\",mqtt_user:\"\",mqtt_pass:\"\",mqtt_solar:\"\",mqtt_grid_ie:\"\",mqtt_vrms:\"\",mqtt_enabled:0,mqtt_supported_protocols:[\"mqtt\"],http_supported_protocols:[],ohm_enabled:0,ohmkey:\"\",www_username:\"\",www_password:\"\",hostname:!1,sntp_enabled:!1,sntp_hostname:!1,firmware:\"-\",protocol:\"-\",espflash:0,diodet:0,gfcit:0,groundt:0,relayt:0,ventt:0,tempt:0,scale:1,offset:0,version:\"0.0.0\",time_zone:!1,divert_enabled:!1,divert_attack_smoothing_factor:.4,divert_decay_smoothing_factor:.05,divert_min_charge_time:600,charge_mode:\"full\"},t)}function StatusViewModel(e){var t=this,n=ko.pureComputed(function(){return e()+\"/status\"});BaseViewModel.call(t,{mode:\"ERR\",wifi_client_connected:0,eth_connected:0,net_connected:0,srssi:\"\",ipaddress:\"\",packets_sent:0,packets_success:0,emoncms_connected:0,emoncms_message:!1,mqtt_connected:0,ohm_hour:\"\",free_heap:0,comm_sent:0,comm_success:0,rapi_connected:!0,amp:0,voltage:!1,pilot:0,temp1:0,temp2:0,temp3:0,state:0,elapsed:0,wattsec:0,watthour:0,gfcicount:0,nogndcount:0,stuckcount:0,divertmode:1,solar:0,grid_ie:0,charge_rate:0,available_current:!1,smoothed_available_current:!1,divert_update:0,divert_active:!1,ota_update:!1,time:!1,offset:!1},n),t.isWiFiError=ko.pureComputed(function(){return\"ERR\"===t.mode()}),t.isWifiClient=ko.pureComputed(function(){return\"STA\"===t.mode()||\"STA+AP\"===t.mode()}),t.isWifiAccessPoint=ko.pureComputed(function(){return\"AP\"===t.mode()||\"STA+AP\"===t.mode()}),t.isWired=ko.pureComputed(function(){return\"Wired\"===t.mode()}),t.fullMode=ko.pureComputed(function(){switch(t.mode()){case\"AP\":return\"Access Point (AP)\";case\"STA\":return\"Client (STA)\";case\"STA+AP\":return\"Client + Access Point (STA+AP)\";case\"Wired\":return\"Wired Ethernet\"}return\"Unknown (\"+t.mode()+\")\"}),this.estate=ko.pureComputed(function(){var e;switch(t.state()){case 0:e=\"Starting\";break;case 1:e=\"Not Connected\";break;case 2:e=\"EV Connected\";break;case 3:e=\"Charging\";break;case 4:e=\"Vent Required\";break;case 5:e=\"Diode Check Failed\";break;case 6:e=\"GFCI Fault\";break;case 7:e=\"No Earth Ground\";break;case 8:e=\"Stuck Relay\";break;case 9:e=\"GFCI Self Test Failed\";break;case 10:e=\"Over Temperature\";break;case 11:e=\"Over Current\";break;case 254:e=\"Waiting\";break;case 255:e=\"Disabled\";break;default:e=\"Invalid\"}return e})}function WiFiScanResultViewModel(e){var t=this;ko.mapping.fromJS(e,{},t),t.strength=ko.computed(function(){var e=t.rssi();return-50<=e?5:-60<=e?4:-67<=e?3:-70<=e?2:-80<=e?1:0})}function WiFiScanViewModel(e){var t=this,n=ko.pureComputed(function(){return e()+\"/scan\"}),r={key:function(e){return ko.utils.unwrapObservable(e.bssid)},create:function(e){return new WiFiScanResultViewModel(e.data)}};t.results=ko.mapping.fromJS([],r),t.filteredResults=ko.mapping.fromJS([],r),t.fetching=ko.observable(!1),t.update=function(){var e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){};t.fetching(!0),$.get(n(),function(n){if(0<n.length){n=n.sort(function(e,t){return e.ssid===t.ssid?e.rssi<t.rssi?1:-1:e.ssid<t.ssid?-1:1}),ko.mapping.fromJS(n,t.results);var e=n.filter(function(t,e){return-80<=t.rssi&&e===n.findIndex(function(e){return t.ssid===e.ssid})}).sort(function(e,t){return e.rssi<t.rssi?1:-1});ko.mapping.fromJS(e,t.filteredResults)}},\"json\").always(function(){t.fetching(!1),e()})}}function WiFiConfigViewModel(e,t,n,r){var i=this;i.baseEndpoint=e,i.config=t,i.status=n,i.scan=r,i.scanUpdating=ko.observable(!1),i.selectedNet=ko.observable(!1),i.bssid=ko.pureComputed({read:function(){return!1===i.selectedNet()?\"\":i.selectedNet().bssid()},write:function(e){for(var t=0;t<i.scan.results().length;t++){var n=i.scan.results()[t];if(e===n.bssid())return void i.selectedNet(n)}}}),i.select=function(e){i.selectedNet(e)},i.setSsid=function(e){if(!1===i.selectedNet()||e!==i.selectedNet().ssid()){for(var t=0;t<i.scan.filteredResults().length;t++){if(e===(n=i.scan.filteredResults()[t]).ssid())return void i.selectedNet(n)}for(t=0;t<i.scan.results().length;t++){var n;if(e===(n=i.scan.results()[t]).ssid())return void i.selectedNet(n)}i.selectedNet(!1)}};var o=null,a=!1;i.startScan=function(){i.scanUpdating()||(a=!0,i.scanUpdating(!0),null!==o&&(clearTimeout(o),o=null),i.scan.update(function(){if(a&&(o=setTimeout(i.startScan,3e3)),\"\"===i.bssid())for(var e=i.config.ssid(),t=0;t<i.scan.results().length;t++){var n=i.scan.results()[t];if(e===n.ssid()){i.bssid(n.bssid());break}}i.scanUpdating(!1)}))},i.stopScan=function(){a=!1,i.scanUpdating()||null!==o&&(clearTimeout(o),o=null)},i.enableScan=function(e){e?i.startScan():i.stopScan()},i.forceConfig=ko.observable(!1),i.canConfigure=ko.pureComputed(function(){return!(i.status.isWiFiError()||i.wifiConnecting()||i.status.isWired())&&(!i.status.isWifiClient()||i.forceConfig())}),i.wifiConnecting=ko.observable(!1),i.canConfigure.subscribe(function(e){i.enableScan(e)}),i.status.wifi_client_connected.subscribe(function(e){e&&i.wifiConnecting(!1)}),i.enableScan(i.canConfigure()),i.saveNetworkFetching=ko.observable(!1),i.saveNetworkSuccess=ko.observable(!1),i.saveNetwork=function(){\"\"===i.config.ssid()?alert(\"Please select network\"):(i.saveNetworkFetching(!0),i.saveNetworkSuccess(!1),$.post(i.baseEndpoint()+\"/savenetwork\",{ssid:i.config.ssid(),pass:i.config.pass()},function(){i.status.wifi_client_connected(!1),i.forceConfig(!1),i.wifiConnecting(!0),i.saveNetworkSuccess(!0)}).fail(function(){alert(\"Failed to save WiFi config\")}).always(function(){i.saveNetworkFetching(!1)}))},i.turnOffAccessPointFetching=ko.observable(!1),i.turnOffAccessPointSuccess=ko.observable(!1),i.turnOffAccessPoint=function(){i.turnOffAccessPointFetching(!0),i.turnOffAccessPointSuccess(!1),$.post(i.baseEndpoint()+\"/apoff\",{},function(e){console.log(e),\"\"!==i.status.ipaddress()?setTimeout(function(){window.location=\"//\"+i.status.ipaddress(),i.turnOffAccessPointSuccess(!0)},3e3):i.turnOffAccessPointSuccess(!0)}).fail(function(){alert(\"Failed to turn off Access Point\")}).always(function(){i.turnOffAccessPointFetching(!1)})}}function PasswordViewModel(t){var e=this;e.show=ko.observable(!1),e.value=ko.computed({read:function(){return e.show()&&e.isDummy()?\"\":t()},write:function(e){t(e)}}),e.isDummy=ko.computed(function(){return[\"___DUMMY_PASSWORD___\",\"_DUMMY_PASSWORD\"].includes(t())})}function ConfigGroupViewModel(t,e){var n=this;n.fetching=ko.observable(!1),n.success=ko.observable(!1),n.value=ko.computed(e),n._validate=function(){return!0},n._done=function(){return!0},n._fail=function(){alert(\"Failed to save config\")},n._always=function(){return!0},n.value.subscribe(function(){n.success(!1)}),n.save=function(){var e=n.value();n._validate(e)&&(n.fetching(!0),n.success(!1),$.ajax(t()+\"/config\",{method:\"POST\",data:JSON.stringify(e),contentType:\"application/json\"}).done(function(){n.success(!0),n._done()}).fail(n._fail).always(function(){n.fetching(!1),n._always()}))},n.validate=function(e){return n._validate=e,this},n.done=function(e){return n._done=e,this},n.fail=function(e){return n._fail=e,this},n.always=function(e){return n._always=e,this}}!function(e,t){\"object\"===(\"undefined\"==typeof module?\"undefined\":_typeof(module))&&\"object\"===_typeof(module.exports)?module.exports=e.document?t(e,!0):function(e){if(!e.document)throw new Error(\"jQuery requires a window with a document\");return t(e)}:t(e)}(\"undefined\"!=typeof window?window:void 0,function(T,e){function v(e){return null!=e&&e===e.window}var t=[],r=Object.getPrototypeOf,s=t.slice,g=t.flat?function(e){return t.flat.call(e)}:function(e){return t.concat.apply([],e)},u=t.push,i=t.indexOf,n={},o=n.toString,m=n.hasOwnProperty,a=m.toString,c=a.call(Object),b={},y=function(e){return\"function\"==typeof e&&\"number\"!=typeof e.nodeType},k=T.document,l={type:!0,src:!0,nonce:!0,noModule:!0};function w(e,t,n){var r,i,o=(n=n||k).createElement(\"script\");if(o.text=e,t)for(r in l)(i=t[r]||t.getAttribute&&t.getAttribute(r))&&o.setAttribute(r,i);n.head.appendChild(o).parentNode.removeChild(o)}function x(e){return null==e?e+\"\":\"object\"===_typeof(e)||\"function\"==typeof e?n[o.call(e)]||\"object\":_typeof(e)}var f=\"3.5.0\",E=function e(t,n){return new e.fn.init(t,n)};function d(e){var t=!!e&&\"length\"in e&&e.length,n=x(e);return!y(e)&&!v(e)&&(\"array\"===n||0===t||\"number\"==typeof t&&0<t&&t-1 in e)}E.fn=E.prototype={jquery:f,constructor:E,length:0,toArray:function(){return s.call(this)},get:function(e){return null==e?s.call(this):e<0?this[e+this.length]:this[e]},pushStack:function(e){var t=E.merge(this.constructor(),e);return t.prevObject=this,t},each:function(e){return E.each(this,e)},map:function(n){return this.pushStack(E.map(this,function(e,t){return n.call(e,t,e)}))},slice:function(){return this.pushStack(s.apply(this,arguments))},first:function(){return this.eq(0)},last:function(){return this.eq(-1)},even:function(){return this.pushStack(E.grep(this,function(e,t){return(t+1)%2}))},odd:function(){return this.pushStack(E.grep(this,function(e,t){return t%2}))},eq:function(e){var t=this.length,n=+e+(e<0?t:0);return this.pushStack(0<=n&&n<t?[this[n]]:[])},end:function(){return this.prevObject||this.constructor()},push:u,sort:t.sort,splice:t.splice},E.extend=E.fn.extend=function(){var e,t,n,r,i,o,a=arguments[0]||{},s=1,u=arguments.length,c=!1;for(\"boolean\"==typeof a&&(c=a,a=arguments[s]||{},s++),\"object\"===_typeof(a)||y(a)||(a={}),s===u&&(a=this,s--);s<u;s++)if(null!=(e=arguments[s]))for(t in e)r=e[t],\"__proto__\"!==t&&a!==r&&(c&&r&&(E.isPlainObject(r)||(i=Array.isArray(r)))?(n=a[t],o=i&&!Array.isArray(n)?[]:i||E.isPlainObject(n)?n:{},i=!1,a[t]=E.extend(c,o,r)):void 0!==r&&(a[t]=r));return a},E.extend({expando:\"jQuery\"+(f+Math.random()).replace(/\\D/g,\"\"),isReady:!0,error:function(e){throw new Error(e)},noop:function(){},isPlainObject:function(e){var t,n;return!(!e||\"[object Object]\"!==o.call(e))&&(!(t=r(e))||\"function\"==typeof(n=m.call(t,\"constructor\")&&t.constructor)&&a.call(n)===c)},isEmptyObject:function(e){var t;for(t in e)return!1;return!0},globalEval:function(e,t,n){w(e,{nonce:t&&t.nonce},n)},each:function(e,t){var n,r=0;if(d(e))for(n=e.length;r<n&&!1!==t.call(e[r],r,e[r]);r++);else for(r in e)if(!1===t.call(e[r],r,e[r]))break;return e},makeArray:function(e,t){var n=t||[];return null!=e&&(d(Object(e))?E.merge(n,\"string\"==typeof e?[e]:e):u.call(n,e)),n},inArray:function(e,t,n){return null==t?-1:i.call(t,e,n)},merge:function(e,t){for(var n=+t.length,r=0,i=e.length;r<n;r++)e[i++]=t[r];return e.length=i,e},grep:function(e,t,n){for(var r=[],i=0,o=e.length,a=!n;i<o;i++)!t(e[i],i)!=a&&r.push(e[i]);return r},map:function(e,t,n){var r,i,o=0,a=[];if(d(e))for(r=e.length;o<r;o++)null!=(i=t(e[o],o,n))&&a.push(i);else for(o in e)null!=(i=t(e[o],o,n))&&a.push(i);return g(a)},guid:1,support:b}),\"function\"==typeof Symbol&&(E.fn[Symbol.iterator]=t[Symbol.iterator]),E.each(\"Boolean Number String Function Array Date RegExp Object Error Symbol\".split(\" \"),function(e,t){n[\"[object \"+t+\"]\"]=t.toLowerCase()});var p=function(n){function f(e,t){var n=\"0x\"+e.slice(1)-65536;return t||(n<0?String.fromCharCode(65536+n):String.fromCharCode(n>>10|55296,1023&n|56320))}function i(){C()}var e,p,w,o,a,h,d,v,x,u,c,C,T,s,k,g,l,m,b,E=\"sizzle\"+1*new Date,y=n.document,S=0,r=0,N=ue(),_=ue(),A=ue(),D=ue(),O=function(e,t){return e===t&&(c=!0),0},j={}.hasOwnProperty,t=[],q=t.pop,M=t.push,L=t.push,P=t.slice,R=function(e,t){for(var n=0,r=e.length;n<r;n++)if(e[n]===t)return n;return-1},B=\"checked|selected|async|autofocus|autoplay|controls|defer|disabled|hidden|ismap|loop|multiple|open|readonly|required|scoped\",I=\"[\\\\x20\\\\t\\\\r\\\\n\\\\f]\",H=\"(?:\\\\\\\\[\\\\da-fA-F]{1,6}\"+I+\"?|\\\\\\\\[^\\\\r\\\\n\\\\f]|[\\\\w-]|[^\\0-\\\\x7f])+\",F=\"\\\\[\"+I+\"*(\"+H+\")(?:\"+I+\"*([*^$|!~]?=)\"+I+\"*(?:'((?:\\\\\\\\.|[^\\\\\\\\'])*)'|\\\"((?:\\\\\\\\.|[^\\\\\\\\\\\"])*)\\\"|(\"+H+\"))|)\"+I+\"*\\\\]\",$=\":(\"+H+\")(?:\\\\((('((?:\\\\\\\\.|[^\\\\\\\\'])*)'|\\\"((?:\\\\\\\\.|[^\\\\\\\\\\\"])*)\\\")|((?:\\\\\\\\.|[^\\\\\\\\()[\\\\]]|\"+F+\")*)|.*)\\\\)|)\",W=new RegExp(I+\"+\",\"g\"),V=new RegExp(\"^\"+I+\"+|((?:^|[^\\\\\\\\])(?:\\\\\\\\.)*)\"+I+\"+$\",\"g\"),U=new RegExp(\"^\"+I+\"*,\"+I+\"*\"),J=new RegExp(\"^\"+I+\"*([>+~]|\"+I+\")\"+I+\"*\"),z=new RegExp(I+\"|>\"),G=new RegExp($),X=new RegExp(\"^\"+H+\"$\"),Y={ID:new RegExp(\"^#(\"+H+\")\"),CLASS:new RegExp(\"^\\\\.(\"+H+\")\"),TAG:new RegExp(\"^(\"+H+\"|[*])\"),ATTR:new RegExp(\"^\"+F),PSEUDO:new RegExp(\"^\"+$),CHILD:new RegExp(\"^:(only|first|last|nth|nth-last)-(child|of-type)(?:\\\\(\"+I+\"*(even|odd|(([+-]|)(\\\\d*)n|)\"+I+\"*(?:([+-]|)\"+I+\"*(\\\\d+)|))\"+I+\"*\\\\)|)\",\"i\"),bool:new RegExp(\"^(?:\"+B+\")$\",\"i\"),needsContext:new RegExp(\"^\"+I+\"*[>+~]|:(even|odd|eq|gt|lt|nth|first|last)(?:\\\\(\"+I+\"*((?:-\\\\d)?\\\\d*)\"+I+\"*\\\\)|)(?=[^-]|$)\",\"i\")},K=/HTML$/i,Q=/^(?:input|select|textarea|button)$/i,Z=/^h\\d$/i,ee=/^[^{]+\\{\\s*\\[native \\w/,te=/^(?:#([\\w-]+)|(\\w+)|\\.([\\w-]+))$/,ne=/[+~]/,re=new RegExp(\"\\\\\\\\[\\\\da-fA-F]{1,6}\"+I+\"?|\\\\\\\\([^\\\\r\\\\n\\\\f])\",\"g\"),ie=/([\\0-\\x1f\\x7f]|^-?\\d)|^-$|[^\\0-\\x1f\\x7f-\\uFFFF\\w-]/g,oe=function(e,t){return t?\"\\0\"===e?\"�\":e.slice(0,-1)+\"\\\\\"+e.charCodeAt(e.length-1).toString(16)+\" \":\"\\\\\"+e},ae=we(function(e){return!0===e.disabled&&\"fieldset\"===e.nodeName.toLowerCase()},{dir:\"parentNode\",next:\"legend\"});try{L.apply(t=P.call(y.childNodes),y.childNodes),t[y.childNodes.length].nodeType}catch(e){L={apply:t.length?function(e,t){M.apply(e,P.call(t))}:function(e,t){for(var n=e.length,r=0;e[n++]=t[r++];);e.length=n-1}}}function se(t,e,n,r){var i,o,a,s,u,c,l,f=e&&e.ownerDocument,d=e?e.nodeType:9;if(n=n||[],\"string\"!=typeof t||!t||1!==d&&9!==d&&11!==d)return n;if(!r&&(C(e),e=e||T,k)){if(11!==d&&(u=te.exec(t)))if(i=u[1]){if(9===d){if(!(a=e.getElementById(i)))return n;if(a.id===i)return n.push(a),n}else if(f&&(a=f.getElementById(i))&&b(e,a)&&a.id===i)return n.push(a),n}else{if(u[2])return L.apply(n,e.getElementsByTagName(t)),n;if((i=u[3])&&p.getElementsByClassName&&e.getElementsByClassName)return L.apply(n,e.getElementsByClassName(i)),n}if(p.qsa&&!D[t+\" \"]&&(!g||!g.test(t))&&(1!==d||\"object\"!==e.nodeName.toLowerCase())){if(l=t,f=e,1===d&&(z.test(t)||J.test(t))){for((f=ne.test(t)&&me(e.parentNode)||e)===e&&p.scope||((s=e.getAttribute(\"id\"))?s=s.replace(ie,oe):e.setAttribute(\"id\",s=E)),o=(c=h(t)).length;o--;)c[o]=(s?\"#\"+s:\":scope\")+\" \"+ye(c[o]);l=c.join(\",\")}try{return L.apply(n,f.querySelectorAll(l)),n}catch(e){D(t,!0)}finally{s===E&&e.removeAttribute(\"id\")}}}return v(t.replace(V,\"$1\"),e,n,r)}function ue(){var r=[];return function e(t,n){return r.push(t+\" \")>w.cacheLength&&delete e[r.shift()],e[t+\" \"]=n}}function ce(e){return e[E]=!0,e}function le(e){var t=T.createElement(\"fieldset\");try{return!!e(t)}catch(e){return!1}finally{t.parentNode&&t.parentNode.removeChild(t),t=null}}function fe(e,t){for(var n=e.split(\"|\"),r=n.length;r--;)w.attrHandle[n[r]]=t}function de(e,t){var n=t&&e,r=n&&1===e.nodeType&&1===t.nodeType&&e.sourceIndex-t.sourceIndex;if(r)return r;if(n)for(;n=n.nextSibling;)if(n===t)return-1;return e?1:-1}function pe(t){return function(e){return\"input\"===e.nodeName.toLowerCase()&&e.type===t}}function he(n){return function(e){var t=e.nodeName.toLowerCase();return(\"input\"===t||\"button\"===t)&&e.type===n}}function ve(t){return function(e){return\"form\"in e?e.parentNode&&!1===e.disabled?\"label\"in e?\"label\"in e.parentNode?e.parentNode.disabled===t:e.disabled===t:e.isDisabled===t||e.isDisabled!==!t&&ae(e)===t:e.disabled===t:\"label\"in e&&e.disabled===t}}function ge(a){return ce(function(o){return o=+o,ce(function(e,t){for(var n,r=a([],e.length,o),i=r.length;i--;)e[n=r[i]]&&(e[n]=!(t[n]=e[n]))})})}function me(e){return e&&void 0!==e.getElementsByTagName&&e}for(e in p=se.support={},a=se.isXML=function(e){var t=e.namespaceURI,n=(e.ownerDocument||e).documentElement;return!K.test(t||n&&n.nodeName||\"HTML\")},C=se.setDocument=function(e){var t,n,r=e?e.ownerDocument||e:y;return r!=T&&9===r.nodeType&&r.documentElement&&(s=(T=r).documentElement,k=!a(T),y!=T&&(n=T.defaultView)&&n.top!==n&&(n.addEventListener?n.addEventListener(\"unload\",i,!1):n.attachEvent&&n.attachEvent(\"onunload\",i)),p.scope=le(function(e){return s.appendChild(e).appendChild(T.createElement(\"div\")),void 0!==e.querySelectorAll&&!e.querySelectorAll(\":scope fieldset div\").length}),p.attributes=le(function(e){return e.className=\"i\",!e.getAttribute(\"className\")}),p.getElementsByTagName=le(function(e){return e.appendChild(T.createComment(\"\")),!e.getElementsByTagName(\"*\").length}),p.getElementsByClassName=ee.test(T.getElementsByClassName),p.getById=le(function(e){return s.appendChild(e).id=E,!T.getElementsByName||!T.getElementsByName(E).length}),p.getById?(w.filter.ID=function(e){var t=e.replace(re,f);return function(e){return e.getAttribute(\"id\")===t}},w.find.ID=function(e,t){if(void 0!==t.getElementById&&k){var n=t.getElementById(e);return n?[n]:[]}}):(w.filter.ID=function(e){var n=e.replace(re,f);return function(e){var t=void 0!==e.getAttributeNode&&e.getAttributeNode(\"id\");return t&&t.value===n}},w.find.ID=function(e,t){if(void 0!==t.getElementById&&k){var n,r,i,o=t.getElementById(e);if(o){if((n=o.getAttributeNode(\"id\"))&&n.value===e)return[o];for(i=t.getElementsByName(e),r=0;o=i[r++];)if((n=o.getAttributeNode(\"id\"))&&n.value===e)return[o]}return[]}}),w.find.TAG=p.getElementsByTagName?function(e,t){return void 0!==t.getElementsByTagName?t.getElementsByTagName(e):p.qsa?t.querySelectorAll(e):void 0}:function(e,t){var n,r=[],i=0,o=t.getElementsByTagName(e);if(\"*\"!==e)return o;for(;n=o[i++];)1===n.nodeType&&r.push(n);return r},w.find.CLASS=p.getElementsByClassName&&function(e,t){if(void 0!==t.getElementsByClassName&&k)return t.getElementsByClassName(e)},l=[],g=[],(p.qsa=ee.test(T.querySelectorAll))&&(le(function(e){var t;s.appendChild(e).innerHTML=\"<a id='\"+E+\"'></a><select id='\"+E+\"-\\r\\\\' msallowcapture=''><option selected=''></option></select>\",e.querySelectorAll(\"[msallowcapture^='']\").length&&g.push(\"[*^$]=\"+I+\"*(?:''|\\\"\\\")\"),e.querySelectorAll(\"[selected]\").length||g.push(\"\\\\[\"+I+\"*(?:value|\"+B+\")\"),e.querySelectorAll(\"[id~=\"+E+\"-]\").length||g.push(\"~=\"),(t=T.createElement(\"input\")).setAttribute(\"name\",\"\"),e.appendChild(t),e.querySelectorAll(\"[name='']\").length||g.push(\"\\\\[\"+I+\"*name\"+I+\"*=\"+I+\"*(?:''|\\\"\\\")\"),e.querySelectorAll(\":checked\").length||g.push(\":checked\"),e.querySelectorAll(\"a#\"+E+\"+*\").length||g.push(\".#.+[+~]\"),e.querySelectorAll(\"\\\\\\f\"),g.push(\"[\\\\r\\\\n\\\\f]\")}),le(function(e){e.innerHTML=\"<a href='' disabled='disabled'></a><select disabled='disabled'><option/></select>\";var t=T.createElement(\"input\");t.setAttribute(\"type\",\"hidden\"),e.appendChild(t).setAttribute(\"name\",\"D\"),e.querySelectorAll(\"[name=d]\").length&&g.push(\"name\"+I+\"*[*^$|!~]?=\"),2!==e.querySelectorAll(\":enabled\").length&&g.push(\":enabled\",\":disabled\"),s.appendChild(e).disabled=!0,2!==e.querySelectorAll(\":disabled\").length&&g.push(\":enabled\",\":disabled\"),e.querySelectorAll(\"*,:x\"),g.push(\",.*:\")})),(p.matchesSelector=ee.test(m=s.matches||s.webkitMatchesSelector||s.mozMatchesSelector||s.oMatchesSelector||s.msMatchesSelector))&&le(function(e){p.disconnectedMatch=m.call(e,\"*\"),m.call(e,\"[s!='']:x\"),l.push(\"!=\",$)}),g=g.length&&new RegExp(g.join(\"|\")),l=l.length&&new RegExp(l.join(\"|\")),t=ee.test(s.compareDocumentPosition),b=t||ee.test(s.contains)?function(e,t){var n=9===e.nodeType?e.documentElement:e,r=t&&t.parentNode;return e===r||!(!r||1!==r.nodeType||!(n.contains?n.contains(r):e.compareDocumentPosition&&16&e.compareDocumentPosition(r)))}:function(e,t){if(t)for(;t=t.parentNode;)if(t===e)return!0;return!1},O=t?function(e,t){if(e===t)return c=!0,0;var n=!e.compareDocumentPosition-!t.compareDocumentPosition;return n||(1&(n=(e.ownerDocument||e)==(t.ownerDocument||t)?e.compareDocumentPosition(t):1)||!p.sortDetached&&t.compareDocumentPosition(e)===n?e==T||e.ownerDocument==y&&b(y,e)?-1:t==T||t.ownerDocument==y&&b(y,t)?1:u?R(u,e)-R(u,t):0:4&n?-1:1)}:function(e,t){if(e===t)return c=!0,0;var n,r=0,i=e.parentNode,o=t.parentNode,a=[e],s=[t];if(!i||!o)return e==T?-1:t==T?1:i?-1:o?1:u?R(u,e)-R(u,t):0;if(i===o)return de(e,t);for(n=e;n=n.parentNode;)a.unshift(n);for(n=t;n=n.parentNode;)s.unshift(n);for(;a[r]===s[r];)r++;return r?de(a[r],s[r]):a[r]==y?-1:s[r]==y?1:0}),T},se.matches=function(e,t){return se(e,null,null,t)},se.matchesSelector=function(e,t){if(C(e),p.matchesSelector&&k&&!D[t+\" \"]&&(!l||!l.test(t))&&(!g||!g.test(t)))try{var n=m.call(e,t);if(n||p.disconnectedMatch||e.document&&11!==e.document.nodeType)return n}catch(e){D(t,!0)}return 0<se(t,T,null,[e]).length},se.contains=function(e,t){return(e.ownerDocument||e)!=T&&C(e),b(e,t)},se.attr=function(e,t){(e.ownerDocument||e)!=T&&C(e);var n=w.attrHandle[t.toLowerCase()],r=n&&j.call(w.attrHandle,t.toLowerCase())?n(e,t,!k):void 0;return void 0!==r?r:p.attributes||!k?e.getAttribute(t):(r=e.getAttributeNode(t))&&r.specified?r.value:null},se.escape=function(e){return(e+\"\").replace(ie,oe)},se.error=function(e){throw new Error(\"Syntax error, unrecognized expression: \"+e)},se.uniqueSort=function(e){var t,n=[],r=0,i=0;if(c=!p.detectDuplicates,u=!p.sortStable&&e.slice(0),e.sort(O),c){for(;t=e[i++];)t===e[i]&&(r=n.push(i));for(;r--;)e.splice(n[r],1)}return u=null,e},o=se.getText=function(e){var t,n=\"\",r=0,i=e.nodeType;if(i){if(1===i||9===i||11===i){if(\"string\"==typeof e.textContent)return e.textContent;for(e=e.firstChild;e;e=e.nextSibling)n+=o(e)}else if(3===i||4===i)return e.nodeValue}else for(;t=e[r++];)n+=o(t);return n},(w=se.selectors={cacheLength:50,createPseudo:ce,match:Y,attrHandle:{},find:{},relative:{\">\":{dir:\"parentNode\",first:!0},\" \":{dir:\"parentNode\"},\"+\":{dir:\"previousSibling\",first:!0},\"~\":{dir:\"previousSibling\"}},preFilter:{ATTR:function(e){return e[1]=e[1].replace(re,f),e[3]=(e[3]||e[4]||e[5]||\"\").replace(re,f),\"~=\"===e[2]&&(e[3]=\" \"+e[3]+\" \"),e.slice(0,4)},CHILD:function(e){return e[1]=e[1].toLowerCase(),\"nth\"===e[1].slice(0,3)?(e[3]||se.error(e[0]),e[4]=+(e[4]?e[5]+(e[6]||1):2*(\"even\"===e[3]||\"odd\"===e[3])),e[5]=+(e[7]+e[8]||\"odd\"===e[3])):e[3]&&se.error(e[0]),e},PSEUDO:function(e){var t,n=!e[6]&&e[2];return Y.CHILD.test(e[0])?null:(e[3]?e[2]=e[4]||e[5]||\"\":n&&G.test(n)&&(t=h(n,!0))&&(t=n.indexOf(\")\",n.length-t)-n.length)&&(e[0]=e[0].slice(0,t),e[2]=n.slice(0,t)),e.slice(0,3))}},filter:{TAG:function(e){var t=e.replace(re,f).toLowerCase();return\"*\"===e?function(){return!0}:function(e){return e.nodeName&&e.nodeName.toLowerCase()===t}},CLASS:function(e){var t=N[e+\" \"];return t||(t=new RegExp(\"(^|\"+I+\")\"+e+\"(\"+I+\"|$)\"))&&N(e,function(e){return t.test(\"string\"==typeof e.className&&e.className||void 0!==e.getAttribute&&e.getAttribute(\"class\")||\"\")})},ATTR:function(n,r,i){return function(e){var t=se.attr(e,n);return null==t?\"!=\"===r:!r||(t+=\"\",\"=\"===r?t===i:\"!=\"===r?t!==i:\"^=\"===r?i&&0===t.indexOf(i):\"*=\"===r?i&&-1<t.indexOf(i):\"$=\"===r?i&&t.slice(-i.length)===i:\"~=\"===r?-1<(\" \"+t.replace(W,\" \")+\" \").indexOf(i):\"|=\"===r&&(t===i||t.slice(0,i.length+1)===i+\"-\"))}},CHILD:function(h,e,t,v,g){var m=\"nth\"!==h.slice(0,3),b=\"last\"!==h.slice(-4),y=\"of-type\"===e;return 1===v&&0===g?function(e){return!!e.parentNode}:function(e,t,n){var r,i,o,a,s,u,c=m!=b?\"nextSibling\":\"previousSibling\",l=e.parentNode,f=y&&e.nodeName.toLowerCase(),d=!n&&!y,p=!1;if(l){if(m){for(;c;){for(a=e;a=a[c];)if(y?a.nodeName.toLowerCase()===f:1===a.nodeType)return!1;u=c=\"only\"===h&&!u&&\"nextSibling\"}return!0}if(u=[b?l.firstChild:l.lastChild],b&&d){for(p=(s=(r=(i=(o=(a=l)[E]||(a[E]={}))[a.uniqueID]||(o[a.uniqueID]={}))[h]||[])[0]===S&&r[1])&&r[2],a=s&&l.childNodes[s];a=++s&&a&&a[c]||(p=s=0)||u.pop();)if(1===a.nodeType&&++p&&a===e){i[h]=[S,s,p];break}}else if(d&&(p=s=(r=(i=(o=(a=e)[E]||(a[E]={}))[a.uniqueID]||(o[a.uniqueID]={}))[h]||[])[0]===S&&r[1]),!1===p)for(;(a=++s&&a&&a[c]||(p=s=0)||u.pop())&&((y?a.nodeName.toLowerCase()!==f:1!==a.nodeType)||!++p||(d&&((i=(o=a[E]||(a[E]={}))[a.uniqueID]||(o[a.uniqueID]={}))[h]=[S,p]),a!==e)););return(p-=g)===v||p%v==0&&0<=p/v}}},PSEUDO:function(e,o){var t,a=w.pseudos[e]||w.setFilters[e.toLowerCase()]||se.error(\"unsupported pseudo: \"+e);return a[E]?a(o):1<a.length?(t=[e,e,\"\",o],w.setFilters.hasOwnProperty(e.toLowerCase())?ce(function(e,t){for(var n,r=a(e,o),i=r.length;i--;)e[n=R(e,r[i])]=!(t[n]=r[i])}):function(e){return a(e,0,t)}):a}},pseudos:{not:ce(function(e){var r=[],i=[],s=d(e.replace(V,\"$1\"));return s[E]?ce(function(e,t,n,r){for(var i,o=s(e,null,r,[]),a=e.length;a--;)(i=o[a])&&(e[a]=!(t[a]=i))}):function(e,t,n){return r[0]=e,s(r,null,n,i),r[0]=null,!i.pop()}}),has:ce(function(t){return function(e){return 0<se(t,e).length}}),contains:ce(function(t){return t=t.replace(re,f),function(e){return-1<(e.textContent||o(e)).indexOf(t)}}),lang:ce(function(n){return X.test(n||\"\")||se.error(\"unsupported lang: \"+n),n=n.replace(re,f).toLowerCase(),function(e){var t;do{if(t=k?e.lang:e.getAttribute(\"xml:lang\")||e.getAttribute(\"lang\"))return(t=t.toLowerCase())===n||0===t.indexOf(n+\"-\")}while((e=e.parentNode)&&1===e.nodeType);return!1}}),target:function(e){var t=n.location&&n.location.hash;return t&&t.slice(1)===e.id},root:function(e){return e===s},focus:function(e){return e===T.activeElement&&(!T.hasFocus||T.hasFocus())&&!!(e.type||e.href||~e.tabIndex)},enabled:ve(!1),disabled:ve(!0),checked:function(e){var t=e.nodeName.toLowerCase();return\"input\"===t&&!!e.checked||\"option\"===t&&!!e.selected},selected:function(e){return e.parentNode&&e.parentNode.selectedIndex,!0===e.selected},empty:function(e){for(e=e.firstChild;e;e=e.nextSibling)if(e.nodeType<6)return!1;return!0},parent:function(e){return!w.pseudos.empty(e)},header:function(e){return Z.test(e.nodeName)},input:function(e){return Q.test(e.nodeName)},button:function(e){var t=e.nodeName.toLowerCase();return\"input\"===t&&\"button\"===e.type||\"button\"===t},text:function(e){var t;return\"input\"===e.nodeName.toLowerCase()&&\"text\"===e.type&&(null==(t=e.getAttribute(\"type\"))||\"text\"===t.toLowerCase())},first:ge(function(){return[0]}),last:ge(function(e,t){return[t-1]}),eq:ge(function(e,t,n){return[n<0?n+t:n]}),even:ge(function(e,t){for(var n=0;n<t;n+=2)e.push(n);return e}),odd:ge(function(e,t){for(var n=1;n<t;n+=2)e.push(n);return e}),lt:ge(function(e,t,n){for(var r=n<0?n+t:t<n?t:n;0<=--r;)e.push(r);return e}),gt:ge(function(e,t,n){for(var r=n<0?n+t:n;++r<t;)e.push(r);return e})}}).pseudos.nth=w.pseudos.eq,{radio:!0,checkbox:!0,file:!0,password:!0,image:!0})w.pseudos[e]=pe(e);for(e in{submit:!0,reset:!0})w.pseudos[e]=he(e);function be(){}function ye(e){for(var t=0,n=e.length,r=\"\";t<n;t++)r+=e[t].value;return r}function we(s,e,t){var u=e.dir,c=e.next,l=c||u,f=t&&\"parentNode\"===l,d=r++;return e.first?function(e,t,n){for(;e=e[u];)if(1===e.nodeType||f)return s(e,t,n);return!1}:function(e,t,n){var r,i,o,a=[S,d];if(n){for(;e=e[u];)if((1===e.nodeType||f)&&s(e,t,n))return!0}else for(;e=e[u];)if(1===e.nodeType||f)if(i=(o=e[E]||(e[E]={}))[e.uniqueID]||(o[e.uniqueID]={}),c&&c===e.nodeName.toLowerCase())e=e[u]||e;else{if((r=i[l])&&r[0]===S&&r[1]===d)return a[2]=r[2];if((i[l]=a)[2]=s(e,t,n))return!0}return!1}}function xe(i){return 1<i.length?function(e,t,n){for(var r=i.length;r--;)if(!i[r](e,t,n))return!1;return!0}:i[0]}function Ce(e,t,n,r,i){for(var o,a=[],s=0,u=e.length,c=null!=t;s<u;s++)(o=e[s])&&(n&&!n(o,r,i)||(a.push(o),c&&t.push(s)));return a}function Te(p,h,v,g,m,e){return g&&!g[E]&&(g=Te(g)),m&&!m[E]&&(m=Te(m,e)),ce(function(e,t,n,r){var i,o,a,s=[],u=[],c=t.length,l=e||function(e,t,n){for(var r=0,i=t.length;r<i;r++)se(e,t[r],n);return n}(h||\"*\",n.nodeType?[n]:n,[]),f=!p||!e&&h?l:Ce(l,s,p,n,r),d=v?m||(e?p:c||g)?[]:t:f;if(v&&v(f,d,n,r),g)for(i=Ce(d,u),g(i,[],n,r),o=i.length;o--;)(a=i[o])&&(d[u[o]]=!(f[u[o]]=a));if(e){if(m||p){if(m){for(i=[],o=d.length;o--;)(a=d[o])&&i.push(f[o]=a);m(null,d=[],i,r)}for(o=d.length;o--;)(a=d[o])&&-1<(i=m?R(e,a):s[o])&&(e[i]=!(t[i]=a))}}else d=Ce(d===t?d.splice(c,d.length):d),m?m(null,t,d,r):L.apply(t,d)})}function ke(e){for(var i,t,n,r=e.length,o=w.relative[e[0].type],a=o||w.relative[\" \"],s=o?1:0,u=we(function(e){return e===i},a,!0),c=we(function(e){return-1<R(i,e)},a,!0),l=[function(e,t,n){var r=!o&&(n||t!==x)||((i=t).nodeType?u(e,t,n):c(e,t,n));return i=null,r}];s<r;s++)if(t=w.relative[e[s].type])l=[we(xe(l),t)];else{if((t=w.filter[e[s].type].apply(null,e[s].matches))[E]){for(n=++s;n<r&&!w.relative[e[n].type];n++);return Te(1<s&&xe(l),1<s&&ye(e.slice(0,s-1).concat({value:\" \"===e[s-2].type?\"*\":\"\"})).replace(V,\"$1\"),t,s<n&&ke(e.slice(s,n)),n<r&&ke(e=e.slice(n)),n<r&&ye(e))}l.push(t)}return xe(l)}return be.prototype=w.filters=w.pseudos,w.setFilters=new be,h=se.tokenize=function(e,t){var n,r,i,o,a,s,u,c=_[e+\" \"];if(c)return t?0:c.slice(0);for(a=e,s=[],u=w.preFilter;a;){for(o in n&&!(r=U.exec(a))||(r&&(a=a.slice(r[0].length)||a),s.push(i=[])),n=!1,(r=J.exec(a))&&(n=r.shift(),i.push({value:n,type:r[0].replace(V,\" \")}),a=a.slice(n.length)),w.filter)!(r=Y[o].exec(a))||u[o]&&!(r=u[o](r))||(n=r.shift(),i.push({value:n,type:o,matches:r}),a=a.slice(n.length));if(!n)break}return t?a.length:a?se.error(e):_(e,s).slice(0)},d=se.compile=function(e,t){var n,r=[],i=[],o=A[e+\" \"];if(!o){for(n=(t=t||h(e)).length;n--;)(o=ke(t[n]))[E]?r.push(o):i.push(o);(o=A(e,function(g,m){function e(e,t,n,r,i){var o,a,s,u=0,c=\"0\",l=e&&[],f=[],d=x,p=e||y&&w.find.TAG(\"*\",i),h=S+=null==d?1:Math.random()||.1,v=p.length;for(i&&(x=t==T||t||i);c!==v&&null!=(o=p[c]);c++){if(y&&o){for(a=0,t||o.ownerDocument==T||(C(o),n=!k);s=g[a++];)if(s(o,t||T,n)){r.push(o);break}i&&(S=h)}b&&((o=!s&&o)&&u--,e&&l.push(o))}if(u+=c,b&&c!==u){for(a=0;s=m[a++];)s(l,f,t,n);if(e){if(0<u)for(;c--;)l[c]||f[c]||(f[c]=q.call(r));f=Ce(f)}L.apply(r,f),i&&!e&&0<f.length&&1<u+m.length&&se.uniqueSort(r)}return i&&(S=h,x=d),l}var b=0<m.length,y=0<g.length;return b?ce(e):e}(i,r))).selector=e}return o},v=se.select=function(e,t,n,r){var i,o,a,s,u,c=\"function\"==typeof e&&e,l=!r&&h(e=c.selector||e);if(n=n||[],1===l.length){if(2<(o=l[0]=l[0].slice(0)).length&&\"ID\"===(a=o[0]).type&&9===t.nodeType&&k&&w.relative[o[1].type]){if(!(t=(w.find.ID(a.matches[0].replace(re,f),t)||[])[0]))return n;c&&(t=t.parentNode),e=e.slice(o.shift().value.length)}for(i=Y.needsContext.test(e)?0:o.length;i--&&(a=o[i],!w.relative[s=a.type]);)if((u=w.find[s])&&(r=u(a.matches[0].replace(re,f),ne.test(o[0].type)&&me(t.parentNode)||t))){if(o.splice(i,1),!(e=r.length&&ye(o)))return L.apply(n,r),n;break}}return(c||d(e,l))(r,t,!k,n,!t||ne.test(e)&&me(t.parentNode)||t),n},p.sortStable=E.split(\"\").sort(O).join(\"\")===E,p.detectDuplicates=!!c,C(),p.sortDetached=le(function(e){return 1&e.compareDocumentPosition(T.createElement(\"fieldset\"))}),le(function(e){return e.innerHTML=\"<a href='#'></a>\",\"#\"===e.firstChild.getAttribute(\"href\")})||fe(\"type|href|height|width\",function(e,t,n){if(!n)return e.getAttribute(t,\"type\"===t.toLowerCase()?1:2)}),p.attributes&&le(function(e){return e.innerHTML=\"<input/>\",e.firstChild.setAttribute(\"value\",\"\"),\"\"===e.firstChild.getAttribute(\"value\")})||fe(\"value\",function(e,t,n){if(!n&&\"input\"===e.nodeName.toLowerCase())return e.defaultValue}),le(function(e){return null==e.getAttribute(\"disabled\")})||fe(B,function(e,t,n){var r;if(!n)return!0===e[t]?t.toLowerCase():(r=e.getAttributeNode(t))&&r.specified?r.value:null}),se}(T);E.find=p,E.expr=p.selectors,E.expr[\":\"]=E.expr.pseudos,E.uniqueSort=E.unique=p.uniqueSort,E.text=p.getText,E.isXMLDoc=p.isXML,E.contains=p.contains,E.escapeSelector=p.escape;function h(e,t,n){for(var r=[],i=void 0!==n;(e=e[t])&&9!==e.nodeType;)if(1===e.nodeType){if(i&&E(e).is(n))break;r.push(e)}return r}function C(e,t){for(var n=[];e;e=e.nextSibling)1===e.nodeType&&e!==t&&n.push(e);return n}var S=E.expr.match.needsContext;function N(e,t){return e.nodeName&&e.nodeName.toLowerCase()===t.toLowerCase()}var _=/^<([a-z][^\\/\\0>:\\x20\\t\\r\\n\\f]*)[\\x20\\t\\r\\n\\f]*\\/?>(?:<\\/\\1>|)$/i;function A(e,n,r){return y(n)?E.grep(e,function(e,t){return!!n.call(e,t,e)!==r}):n.nodeType?E.grep(e,function(e){return e===n!==r}):\"string\"!=typeof n?E.grep(e,function(e){return-1<i.call(n,e)!==r}):E.filter(n,e,r)}E.filter=function(e,t,n){var r=t[0];return n&&(e=\":not(\"+e+\")\"),1===t.length&&1===r.nodeType?E.find.matchesSelector(r,e)?[r]:[]:E.find.matches(e,E.grep(t,function(e){return 1===e.nodeType}))},E.fn.extend({find:function(e){var t,n,r=this.length,i=this;if(\"string\"!=typeof e)return this.pushStack(E(e).filter(function(){for(t=0;t<r;t++)if(E.contains(i[t],this))return!0}));for(n=this.pushStack([]),t=0;t<r;t++)E.find(e,i[t],n);return 1<r?E.uniqueSort(n):n},filter:function(e){return this.pushStack(A(this,e||[],!1))},not:function(e){return this.pushStack(A(this,e||[],!0))},is:function(e){return!!A(this,\"string\"==typeof e&&S.test(e)?E(e):e||[],!1).length}});var D,O=/^(?:\\s*(<[\\w\\W]+>)[^>]*|#([\\w-]+))$/;(E.fn.init=function(e,t,n){var r,i;if(!e)return this;if(n=n||D,\"string\"!=typeof e)return e.nodeType?(this[0]=e,this.length=1,this):y(e)?void 0!==n.ready?n.ready(e):e(E):E.makeArray(e,this);if(!(r=\"<\"===e[0]&&\">\"===e[e.length-1]&&3<=e.length?[null,e,null]:O.exec(e))||!r[1]&&t)return!t||t.jquery?(t||n).find(e):this.constructor(t).find(e);if(r[1]){if(t=t instanceof E?t[0]:t,E.merge(this,E.parseHTML(r[1],t&&t.nodeType?t.ownerDocument||t:k,!0)),_.test(r[1])&&E.isPlainObject(t))for(r in t)y(this[r])?this[r](t[r]):this.attr(r,t[r]);return this}return(i=k.getElementById(r[2]))&&(this[0]=i,this.length=1),this}).prototype=E.fn,D=E(k);var j=/^(?:parents|prev(?:Until|All))/,q={children:!0,contents:!0,next:!0,prev:!0};function M(e,t){for(;(e=e[t])&&1!==e.nodeType;);return e}E.fn.extend({has:function(e){var t=E(e,this),n=t.length;return this.filter(function(){for(var e=0;e<n;e++)if(E.contains(this,t[e]))return!0})},closest:function(e,t){var n,r=0,i=this.length,o=[],a=\"string\"!=typeof e&&E(e);if(!S.test(e))for(;r<i;r++)for(n=this[r];n&&n!==t;n=n.parentNode)if(n.nodeType<11&&(a?-1<a.index(n):1===n.nodeType&&E.find.matchesSelector(n,e))){o.push(n);break}return this.pushStack(1<o.length?E.uniqueSort(o):o)},index:function(e){return e?\"string\"==typeof e?i.call(E(e),this[0]):i.call(this,e.jquery?e[0]:e):this[0]&&this[0].parentNode?this.first().prevAll().length:-1},add:function(e,t){return this.pushStack(E.uniqueSort(E.merge(this.get(),E(e,t))))},addBack:function(e){return this.add(null==e?this.prevObject:this.prevObject.filter(e))}}),E.each({parent:function(e){var t=e.parentNode;return t&&11!==t.nodeType?t:null},parents:function(e){return h(e,\"parentNode\")},parentsUntil:function(e,t,n){return h(e,\"parentNode\",n)},next:function(e){return M(e,\"nextSibling\")},prev:function(e){return M(e,\"previousSibling\")},nextAll:function(e){return h(e,\"nextSibling\")},prevAll:function(e){return h(e,\"previousSibling\")},nextUntil:function(e,t,n){return h(e,\"nextSibling\",n)},prevUntil:function(e,t,n){return h(e,\"previousSibling\",n)},siblings:function(e){return C((e.parentNode||{}).firstChild,e)},children:function(e){return C(e.firstChild)},contents:function(e){return null!=e.contentDocument&&r(e.contentDocument)?e.contentDocument:(N(e,\"template\")&&(e=e.content||e),E.merge([],e.childNodes))}},function(r,i){E.fn[r]=function(e,t){var n=E.map(this,i,e);return\"Until\"!==r.slice(-5)&&(t=e),t&&\"string\"==typeof t&&(n=E.filter(t,n)),1<this.length&&(q[r]||E.uniqueSort(n),j.test(r)&&n.reverse()),this.pushStack(n)}});var L=/[^\\x20\\t\\r\\n\\f]+/g;function P(e){return e}function R(e){throw e}function B(e,t,n,r){var i;try{e&&y(i=e.promise)?i.call(e).done(t).fail(n):e&&y(i=e.then)?i.call(e,t,n):t.apply(void 0,[e].slice(r))}catch(e){n.apply(void 0,[e])}}E.Callbacks=function(r){r=\"string\"==typeof r?function(e){var n={};return E.each(e.match(L)||[],function(e,t){n[t]=!0}),n}(r):E.extend({},r);function n(){for(o=o||r.once,t=i=!0;s.length;u=-1)for(e=s.shift();++u<a.length;)!1===a[u].apply(e[0],e[1])&&r.stopOnFalse&&(u=a.length,e=!1);r.memory||(e=!1),i=!1,o&&(a=e?[]:\"\")}var i,e,t,o,a=[],s=[],u=-1,c={add:function(){return a&&(e&&!i&&(u=a.length-1,s.push(e)),function n(e){E.each(e,function(e,t){y(t)?r.unique&&c.has(t)||a.push(t):t&&t.length&&\"string\"!==x(t)&&n(t)})}(arguments),e&&!i&&n()),this},remove:function(){return E.each(arguments,function(e,t){for(var n;-1<(n=E.inArray(t,a,n));)a.splice(n,1),n<=u&&u--}),this},has:function(e){return e?-1<E.inArray(e,a):0<a.length},empty:function(){return a=a&&[],this},disable:function(){return o=s=[],a=e=\"\",this},disabled:function(){return!a},lock:function(){return o=s=[],e||i||(a=e=\"\"),this},locked:function(){return!!o},fireWith:function(e,t){return o||(t=[e,(t=t||[]).slice?t.slice():t],s.push(t),i||n()),this},fire:function(){return c.fireWith(this,arguments),this},fired:function(){return!!t}};return c},E.extend({Deferred:function(e){var o=[[\"notify\",\"progress\",E.Callbacks(\"memory\"),E.Callbacks(\"memory\"),2],[\"resolve\",\"done\",E.Callbacks(\"once memory\"),E.Callbacks(\"once memory\"),0,\"resolved\"],[\"reject\",\"fail\",E.Callbacks(\"once memory\"),E.Callbacks(\"once memory\"),1,\"rejected\"]],i=\"pending\",a={state:function(){return i},always:function(){return s.done(arguments).fail(arguments),this},catch:function(e){return a.then(null,e)},pipe:function(){var i=arguments;return E.Deferred(function(r){E.each(o,function(e,t){var n=y(i[t[4]])&&i[t[4]];s[t[1]](function(){var e=n&&n.apply(this,arguments);e&&y(e.promise)?e.promise().progress(r.notify).done(r.resolve).fail(r.reject):r[t[0]+\"With\"](this,n?[e]:arguments)})}),i=null}).promise()},then:function(t,n,r){var u=0;function c(i,o,a,s){return function(){function e(){var e,t;if(!(i<u)){if((e=a.apply(n,r))===o.promise())throw new TypeError(\"Thenable self-resolution\");t=e&&(\"object\"===_typeof(e)||\"function\"==typeof e)&&e.then,y(t)?s?t.call(e,c(u,o,P,s),c(u,o,R,s)):(u++,t.call(e,c(u,o,P,s),c(u,o,R,s),c(u,o,P,o.notifyWith))):(a!==P&&(n=void 0,r=[e]),(s||o.resolveWith)(n,r))}}var n=this,r=arguments,t=s?e:function(){try{e()}catch(e){E.Deferred.exceptionHook&&E.Deferred.exceptionHook(e,t.stackTrace),u<=i+1&&(a!==R&&(n=void 0,r=[e]),o.rejectWith(n,r))}};i?t():(E.Deferred.getStackHook&&(t.stackTrace=E.Deferred.getStackHook()),T.setTimeout(t))}}return E.Deferred(function(e){o[0][3].add(c(0,e,y(r)?r:P,e.notifyWith)),o[1][3].add(c(0,e,y(t)?t:P)),o[2][3].add(c(0,e,y(n)?n:R))}).promise()},promise:function(e){return null!=e?E.extend(e,a):a}},s={};return E.each(o,function(e,t){var n=t[2],r=t[5];a[t[1]]=n.add,r&&n.add(function(){i=r},o[3-e][2].disable,o[3-e][3].disable,o[0][2].lock,o[0][3].lock),n.add(t[3].fire),s[t[0]]=function(){return s[t[0]+\"With\"](this===s?void 0:this,arguments),this},s[t[0]+\"With\"]=n.fireWith}),a.promise(s),e&&e.call(s,s),s},when:function(e){function t(t){return function(e){i[t]=this,o[t]=1<arguments.length?s.call(arguments):e,--n||a.resolveWith(i,o)}}var n=arguments.length,r=n,i=Array(r),o=s.call(arguments),a=E.Deferred();if(n<=1&&(B(e,a.done(t(r)).resolve,a.reject,!n),\"pending\"===a.state()||y(o[r]&&o[r].then)))return a.then();for(;r--;)B(o[r],t(r),a.reject);return a.promise()}});var I=/^(Eval|Internal|Range|Reference|Syntax|Type|URI)Error$/;E.Deferred.exceptionHook=function(e,t){T.console&&T.console.warn&&e&&I.test(e.name)&&T.console.warn(\"jQuery.Deferred exception: \"+e.message,e.stack,t)},E.readyException=function(e){T.setTimeout(function(){throw e})};var H=E.Deferred();function F(){k.removeEventListener(\"DOMContentLoaded\",F),T.removeEventListener(\"load\",F),E.ready()}E.fn.ready=function(e){return H.then(e).catch(function(e){E.readyException(e)}),this},E.extend({isReady:!1,readyWait:1,ready:function(e){(!0===e?--E.readyWait:E.isReady)||(E.isReady=!0)!==e&&0<--E.readyWait||H.resolveWith(k,[E])}}),E.ready.then=H.then,\"complete\"===k.readyState||\"loading\"!==k.readyState&&!k.documentElement.doScroll?T.setTimeout(E.ready):(k.addEventListener(\"DOMContentLoaded\",F),T.addEventListener(\"load\",F));function $(e,t,n,r,i,o,a){var s=0,u=e.length,c=null==n;if(\"object\"===x(n))for(s in i=!0,n)$(e,t,s,n[s],!0,o,a);else if(void 0!==r&&(i=!0,y(r)||(a=!0),c&&(t=a?(t.call(e,r),null):(c=t,function(e,t,n){return c.call(E(e),n)})),t))for(;s<u;s++)t(e[s],n,a?r:r.call(e[s],s,t(e[s],n)));return i?e:c?t.call(e):u?t(e[0],n):o}var W=/^-ms-/,V=/-([a-z])/g;function U(e,t){return t.toUpperCase()}function J(e){return e.replace(W,\"ms-\").replace(V,U)}function z(e){return 1===e.nodeType||9===e.nodeType||!+e.nodeType}function G(){this.expando=E.expando+G.uid++}G.uid=1,G.prototype={cache:function(e){var t=e[this.expando];return t||(t=Object.create(null),z(e)&&(e.nodeType?e[this.expando]=t:Object.defineProperty(e,this.expando,{value:t,configurable:!0}))),t},set:function(e,t,n){var r,i=this.cache(e);if(\"string\"==typeof t)i[J(t)]=n;else for(r in t)i[J(r)]=t[r];return i},get:function(e,t){return void 0===t?this.cache(e):e[this.expando]&&e[this.expando][J(t)]},access:function(e,t,n){return void 0===t||t&&\"string\"==typeof t&&void 0===n?this.get(e,t):(this.set(e,t,n),void 0!==n?n:t)},remove:function(e,t){var n,r=e[this.expando];if(void 0!==r){if(void 0!==t){n=(t=Array.isArray(t)?t.map(J):(t=J(t))in r?[t]:t.match(L)||[]).length;for(;n--;)delete r[t[n]]}void 0!==t&&!E.isEmptyObject(r)||(e.nodeType?e[this.expando]=void 0:delete e[this.expando])}},hasData:function(e){var t=e[this.expando];return void 0!==t&&!E.isEmptyObject(t)}};var X=new G,Y=new G,K=/^(?:\\{[\\w\\W]*\\}|\\[[\\w\\W]*\\])$/,Q=/[A-Z]/g;function Z(e,t,n){var r;if(void 0===n&&1===e.nodeType)if(r=\"data-\"+t.replace(Q,\"-$&\").toLowerCase(),\"string\"==typeof(n=e.getAttribute(r))){try{n=function(e){return\"true\"===e||\"false\"!==e&&(\"null\"===e?null:e===+e+\"\"?+e:K.test(e)?JSON.parse(e):e)}(n)}catch(e){}Y.set(e,t,n)}else n=void 0;return n}E.extend({hasData:function(e){return Y.hasData(e)||X.hasData(e)},data:function(e,t,n){return Y.access(e,t,n)},removeData:function(e,t){Y.remove(e,t)},_data:function(e,t,n){return X.access(e,t,n)},_removeData:function(e,t){X.remove(e,t)}}),E.fn.extend({data:function(n,e){var t,r,i,o=this[0],a=o&&o.attributes;if(void 0!==n)return\"object\"===_typeof(n)?this.each(function(){Y.set(this,n)}):$(this,function(e){var t;if(o&&void 0===e)return void 0!==(t=Y.get(o,n))?t:void 0!==(t=Z(o,n))?t:void 0;this.each(function(){Y.set(this,n,e)})},null,e,1<arguments.length,null,!0);if(this.length&&(i=Y.get(o),1===o.nodeType&&!X.get(o,\"hasDataAttrs\"))){for(t=a.length;t--;)a[t]&&0===(r=a[t].name).indexOf(\"data-\")&&(r=J(r.slice(5)),Z(o,r,i[r]));X.set(o,\"hasDataAttrs\",!0)}return i},removeData:function(e){return this.each(function(){Y.remove(this,e)})}}),E.extend({queue:function(e,t,n){var r;if(e)return t=(t||\"fx\")+\"queue\",r=X.get(e,t),n&&(!r||Array.isArray(n)?r=X.access(e,t,E.makeArray(n)):r.push(n)),r||[]},dequeue:function(e,t){t=t||\"fx\";var n=E.queue(e,t),r=n.length,i=n.shift(),o=E._queueHooks(e,t);\"inprogress\"===i&&(i=n.shift(),r--),i&&(\"fx\"===t&&n.unshift(\"inprogress\"),delete o.stop,i.call(e,function(){E.dequeue(e,t)},o)),!r&&o&&o.empty.fire()},_queueHooks:function(e,t){var n=t+\"queueHooks\";return X.get(e,n)||X.access(e,n,{empty:E.Callbacks(\"once memory\").add(function(){X.remove(e,[t+\"queue\",n])})})}}),E.fn.extend({queue:function(t,n){var e=2;return\"string\"!=typeof t&&(n=t,t=\"fx\",e--),arguments.length<e?E.queue(this[0],t):void 0===n?this:this.each(function(){var e=E.queue(this,t,n);E._queueHooks(this,t),\"fx\"===t&&\"inprogress\"!==e[0]&&E.dequeue(this,t)})},dequeue:function(e){return this.each(function(){E.dequeue(this,e)})},clearQueue:function(e){return this.queue(e||\"fx\",[])},promise:function(e,t){function n(){--i||o.resolveWith(a,[a])}var r,i=1,o=E.Deferred(),a=this,s=this.length;for(\"string\"!=typeof e&&(t=e,e=void 0),e=e||\"fx\";s--;)(r=X.get(a[s],e+\"queueHooks\"))&&r.empty&&(i++,r.empty.add(n));return n(),o.promise(t)}});var ee=/[+-]?(?:\\d*\\.|)\\d+(?:[eE][+-]?\\d+|)/.source,te=new RegExp(\"^(?:([+-])=|)(\"+ee+\")([a-z%]*)$\",\"i\"),ne=[\"Top\",\"Right\",\"Bottom\",\"Left\"],re=k.documentElement,ie=function(e){return E.contains(e.ownerDocument,e)},oe={composed:!0};re.getRootNode&&(ie=function(e){return E.contains(e.ownerDocument,e)||e.getRootNode(oe)===e.ownerDocument});var ae=function(e,t){return\"none\"===(e=t||e).style.display||\"\"===e.style.display&&ie(e)&&\"none\"===E.css(e,\"display\")};function se(e,t,n,r){var i,o,a=20,s=r?function(){return r.cur()}:function(){return E.css(e,t,\"\")},u=s(),c=n&&n[3]||(E.cssNumber[t]?\"\":\"px\"),l=e.nodeType&&(E.cssNumber[t]||\"px\"!==c&&+u)&&te.exec(E.css(e,t));if(l&&l[3]!==c){for(u/=2,c=c||l[3],l=+u||1;a--;)E.style(e,t,l+c),(1-o)*(1-(o=s()/u||.5))<=0&&(a=0),l/=o;l*=2,E.style(e,t,l+c),n=n||[]}return n&&(l=+l||+u||0,i=n[1]?l+(n[1]+1)*n[2]:+n[2],r&&(r.unit=c,r.start=l,r.end=i)),i}var ue={};function ce(e,t){for(var n,r,i,o,a,s,u,c=[],l=0,f=e.length;l<f;l++)(r=e[l]).style&&(n=r.style.display,t?(\"none\"===n&&(c[l]=X.get(r,\"display\")||null,c[l]||(r.style.display=\"\")),\"\"===r.style.display&&ae(r)&&(c[l]=(u=a=o=void 0,a=(i=r).ownerDocument,s=i.nodeName,(u=ue[s])||(o=a.body.appendChild(a.createElement(s)),u=E.css(o,\"display\"),o.parentNode.removeChild(o),\"none\"===u&&(u=\"block\"),ue[s]=u)))):\"none\"!==n&&(c[l]=\"none\",X.set(r,\"display\",n)));for(l=0;l<f;l++)null!=c[l]&&(e[l].style.display=c[l]);return e}E.fn.extend({show:function(){return ce(this,!0)},hide:function(){return ce(this)},toggle:function(e){return\"boolean\"==typeof e?e?this.show():this.hide():this.each(function(){ae(this)?E(this).show():E(this).hide()})}});var le,fe,de=/^(?:checkbox|radio)$/i,pe=/<([a-z][^\\/\\0>\\x20\\t\\r\\n\\f]*)/i,he=/^$|^module$|\\/(?:java|ecma)script/i;le=k.createDocumentFragment().appendChild(k.createElement(\"div\")),(fe=k.createElement(\"input\")).setAttribute(\"type\",\"radio\"),fe.setAttribute(\"checked\",\"checked\"),fe.setAttribute(\"name\",\"t\"),le.appendChild(fe),b.checkClone=le.cloneNode(!0).cloneNode(!0).lastChild.checked,le.innerHTML=\"<textarea>x</textarea>\",b.noCloneChecked=!!le.cloneNode(!0).lastChild.defaultValue,le.innerHTML=\"<option></option>\",b.option=!!le.lastChild;var ve={thead:[1,\"<table>\",\"</table>\"],col:[2,\"<table><colgroup>\",\"</colgroup></table>\"],tr:[2,\"<table><tbody>\",\"</tbody></table>\"],td:[3,\"<table><tbody><tr>\",\"</tr></tbody></table>\"],_default:[0,\"\",\"\"]};function ge(e,t){var n;return n=void 0!==e.getElementsByTagName?e.getElementsByTagName(t||\"*\"):void 0!==e.querySelectorAll?e.querySelectorAll(t||\"*\"):[],void 0===t||t&&N(e,t)?E.merge([e],n):n}function me(e,t){for(var n=0,r=e.length;n<r;n++)X.set(e[n],\"globalEval\",!t||X.get(t[n],\"globalEval\"))}ve.tbody=ve.tfoot=ve.colgroup=ve.caption=ve.thead,ve.th=ve.td,b.option||(ve.optgroup=ve.option=[1,\"<select multiple='multiple'>\",\"</select>\"]);var be=/<|&#?\\w+;/;function ye(e,t,n,r,i){for(var o,a,s,u,c,l,f=t.createDocumentFragment(),d=[],p=0,h=e.length;p<h;p++)if((o=e[p])||0===o)if(\"object\"===x(o))E.merge(d,o.nodeType?[o]:o);else if(be.test(o)){for(a=a||f.appendChild(t.createElement(\"div\")),s=(pe.exec(o)||[\"\",\"\"])[1].toLowerCase(),u=ve[s]||ve._default,a.innerHTML=u[1]+E.htmlPrefilter(o)+u[2],l=u[0];l--;)a=a.lastChild;E.merge(d,a.childNodes),(a=f.firstChild).textContent=\"\"}else d.push(t.createTextNode(o));for(f.textContent=\"\",p=0;o=d[p++];)if(r&&-1<E.inArray(o,r))i&&i.push(o);else if(c=ie(o),a=ge(f.appendChild(o),\"script\"),c&&me(a),n)for(l=0;o=a[l++];)he.test(o.type||\"\")&&n.push(o);return f}var we=/^key/,xe=/^(?:mouse|pointer|contextmenu|drag|drop)|click/,Ce=/^([^.]*)(?:\\.(.+)|)/;function Te(){return!0}function ke(){return!1}function Ee(e,t){return e===function(){try{return k.activeElement}catch(e){}}()==(\"focus\"===t)}function Se(e,t,n,r,i,o){var a,s;if(\"object\"===_typeof(t)){for(s in\"string\"!=typeof n&&(r=r||n,n=void 0),t)Se(e,s,n,r,t[s],o);return e}if(null==r&&null==i?(i=n,r=n=void 0):null==i&&(\"string\"==typeof n?(i=r,r=void 0):(i=r,r=n,n=void 0)),!1===i)i=ke;else if(!i)return e;return 1===o&&(a=i,(i=function(e){return E().off(e),a.apply(this,arguments)}).guid=a.guid||(a.guid=E.guid++)),e.each(function(){E.event.add(this,t,i,r,n)})}function Ne(e,i,o){o?(X.set(e,i,!1),E.event.add(e,i,{namespace:!1,handler:function(e){var t,n,r=X.get(this,i);if(1&e.isTrigger&&this[i]){if(r.length)(E.event.special[i]||{}).delegateType&&e.stopPropagation();else if(r=s.call(arguments),X.set(this,i,r),t=o(this,i),this[i](),r!==(n=X.get(this,i))||t?X.set(this,i,!1):n={},r!==n)return e.stopImmediatePropagation(),e.preventDefault(),n.value}else r.length&&(X.set(this,i,{value:E.event.trigger(E.extend(r[0],E.Event.prototype),r.slice(1),this)}),e.stopImmediatePropagation())}})):void 0===X.get(e,i)&&E.event.add(e,i,Te)}E.event={global:{},add:function(t,e,n,r,i){var o,a,s,u,c,l,f,d,p,h,v,g=X.get(t);if(z(t))for(n.handler&&(n=(o=n).handler,i=o.selector),i&&E.find.matchesSelector(re,i),n.guid||(n.guid=E.guid++),(u=g.events)||(u=g.events=Object.create(null)),(a=g.handle)||(a=g.handle=function(e){return void 0!==E&&E.event.triggered!==e.type?E.event.dispatch.apply(t,arguments):void 0}),c=(e=(e||\"\").match(L)||[\"\"]).length;c--;)p=v=(s=Ce.exec(e[c])||[])[1],h=(s[2]||\"\").split(\".\").sort(),p&&(f=E.event.special[p]||{},p=(i?f.delegateType:f.bindType)||p,f=E.event.special[p]||{},l=E.extend({type:p,origType:v,data:r,handler:n,guid:n.guid,selector:i,needsContext:i&&E.expr.match.needsContext.test(i),namespace:h.join(\".\")},o),(d=u[p])||((d=u[p]=[]).delegateCount=0,f.setup&&!1!==f.setup.call(t,r,h,a)||t.addEventListener&&t.addEventListener(p,a)),f.add&&(f.add.call(t,l),l.handler.guid||(l.handler.guid=n.guid)),i?d.splice(d.delegateCount++,0,l):d.push(l),E.event.global[p]=!0)},remove:function(e,t,n,r,i){var o,a,s,u,c,l,f,d,p,h,v,g=X.hasData(e)&&X.get(e);if(g&&(u=g.events)){for(c=(t=(t||\"\").match(L)||[\"\"]).length;c--;)if(p=v=(s=Ce.exec(t[c])||[])[1],h=(s[2]||\"\").split(\".\").sort(),p){for(f=E.event.special[p]||{},d=u[p=(r?f.delegateType:f.bindType)||p]||[],s=s[2]&&new RegExp(\"(^|\\\\.)\"+h.join(\"\\\\.(?:.*\\\\.|)\")+\"(\\\\.|$)\"),a=o=d.length;o--;)l=d[o],!i&&v!==l.origType||n&&n.guid!==l.guid||s&&!s.test(l.namespace)||r&&r!==l.selector&&(\"**\"!==r||!l.selector)||(d.splice(o,1),l.selector&&d.delegateCount--,f.remove&&f.remove.call(e,l));a&&!d.length&&(f.teardown&&!1!==f.teardown.call(e,h,g.handle)||E.removeEvent(e,p,g.handle),delete u[p])}else for(p in u)E.event.remove(e,p+t[c],n,r,!0);E.isEmptyObject(u)&&X.remove(e,\"handle events\")}},dispatch:function(e){var t,n,r,i,o,a,s=new Array(arguments.length),u=E.event.fix(e),c=(X.get(this,\"events\")||Object.create(null))[u.type]||[],l=E.event.special[u.type]||{};for(s[0]=u,t=1;t<arguments.length;t++)s[t]=arguments[t];if(u.delegateTarget=this,!l.preDispatch||!1!==l.preDispatch.call(this,u)){for(a=E.event.handlers.call(this,u,c),t=0;(i=a[t++])&&!u.isPropagationStopped();)for(u.currentTarget=i.elem,n=0;(o=i.handlers[n++])&&!u.isImmediatePropagationStopped();)u.rnamespace&&!1!==o.namespace&&!u.rnamespace.test(o.namespace)||(u.handleObj=o,u.data=o.data,void 0!==(r=((E.event.special[o.origType]||{}).handle||o.handler).apply(i.elem,s))&&!1===(u.result=r)&&(u.preventDefault(),u.stopPropagation()));return l.postDispatch&&l.postDispatch.call(this,u),u.result}},handlers:function(e,t){var n,r,i,o,a,s=[],u=t.delegateCount,c=e.target;if(u&&c.nodeType&&!(\"click\"===e.type&&1<=e.button))for(;c!==this;c=c.parentNode||this)if(1===c.nodeType&&(\"click\"!==e.type||!0!==c.disabled)){for(o=[],a={},n=0;n<u;n++)void 0===a[i=(r=t[n]).selector+\" \"]&&(a[i]=r.needsContext?-1<E(i,this).index(c):E.find(i,this,null,[c]).length),a[i]&&o.push(r);o.length&&s.push({elem:c,handlers:o})}return c=this,u<t.length&&s.push({elem:c,handlers:t.slice(u)}),s},addProp:function(t,e){Object.defineProperty(E.Event.prototype,t,{enumerable:!0,configurable:!0,get:y(e)?function(){if(this.originalEvent)return e(this.originalEvent)}:function(){if(this.originalEvent)return this.originalEvent[t]},set:function(e){Object.defineProperty(this,t,{enumerable:!0,configurable:!0,writable:!0,value:e})}})},fix:function(e){return e[E.expando]?e:new E.Event(e)},special:{load:{noBubble:!0},click:{setup:function(e){var t=this||e;return de.test(t.type)&&t.click&&N(t,\"input\")&&Ne(t,\"click\",Te),!1},trigger:function(e){var t=this||e;return de.test(t.type)&&t.click&&N(t,\"input\")&&Ne(t,\"click\"),!0},_default:function(e){var t=e.target;return de.test(t.type)&&t.click&&N(t,\"input\")&&X.get(t,\"click\")||N(t,\"a\")}},beforeunload:{postDispatch:function(e){void 0!==e.result&&e.originalEvent&&(e.originalEvent.returnValue=e.result)}}}},E.removeEvent=function(e,t,n){e.removeEventListener&&e.removeEventListener(t,n)},E.Event=function(e,t){if(!(this instanceof E.Event))return new E.Event(e,t);e&&e.type?(this.originalEvent=e,this.type=e.type,this.isDefaultPrevented=e.defaultPrevented||void 0===e.defaultPrevented&&!1===e.returnValue?Te:ke,this.target=e.target&&3===e.target.nodeType?e.target.parentNode:e.target,this.currentTarget=e.currentTarget,this.relatedTarget=e.relatedTarget):this.type=e,t&&E.extend(this,t),this.timeStamp=e&&e.timeStamp||Date.now(),this[E.expando]=!0},E.Event.prototype={constructor:E.Event,isDefaultPrevented:ke,isPropagationStopped:ke,isImmediatePropagationStopped:ke,isSimulated:!1,preventDefault:function(){var e=this.originalEvent;this.isDefaultPrevented=Te,e&&!this.isSimulated&&e.preventDefault()},stopPropagation:function(){var e=this.originalEvent;this.isPropagationStopped=Te,e&&!this.isSimulated&&e.stopPropagation()},stopImmediatePropagation:function(){var e=this.originalEvent;this.isImmediatePropagationStopped=Te,e&&!this.isSimulated&&e.stopImmediatePropagation(),this.stopPropagation()}},E.each({altKey:!0,bubbles:!0,cancelable:!0,changedTouches:!0,ctrlKey:!0,detail:!0,eventPhase:!0,metaKey:!0,pageX:!0,pageY:!0,shiftKey:!0,view:!0,char:!0,code:!0,charCode:!0,key:!0,keyCode:!0,button:!0,buttons:!0,clientX:!0,clientY:!0,offsetX:!0,offsetY:!0,pointerId:!0,pointerType:!0,screenX:!0,screenY:!0,targetTouches:!0,toElement:!0,touches:!0,which:function(e){var t=e.button;return null==e.which&&we.test(e.type)?null!=e.charCode?e.charCode:e.keyCode:!e.which&&void 0!==t&&xe.test(e.type)?1&t?1:2&t?3:4&t?2:0:e.which}},E.event.addProp),E.each({focus:\"focusin\",blur:\"focusout\"},function(e,t){E.event.special[e]={setup:function(){return Ne(this,e,Ee),!1},trigger:function(){return Ne(this,e),!0},delegateType:t}}),E.each({mouseenter:\"mouseover\",mouseleave:\"mouseout\",pointerenter:\"pointerover\",pointerleave:\"pointerout\"},function(e,i){E.event.special[e]={delegateType:i,bindType:i,handle:function(e){var t,n=e.relatedTarget,r=e.handleObj;return n&&(n===this||E.contains(this,n))||(e.type=r.origType,t=r.handler.apply(this,arguments),e.type=i),t}}}),E.fn.extend({on:function(e,t,n,r){return Se(this,e,t,n,r)},one:function(e,t,n,r){return Se(this,e,t,n,r,1)},off:function(e,t,n){var r,i;if(e&&e.preventDefault&&e.handleObj)return r=e.handleObj,E(e.delegateTarget).off(r.namespace?r.origType+\".\"+r.namespace:r.origType,r.selector,r.handler),this;if(\"object\"!==_typeof(e))return!1!==t&&\"function\"!=typeof t||(n=t,t=void 0),!1===n&&(n=ke),this.each(function(){E.event.remove(this,e,n,t)});for(i in e)this.off(i,t,e[i]);return this}});var _e=/<script|<style|<link/i,Ae=/checked\\s*(?:[^=]|=\\s*.checked.)/i,De=/^\\s*<!(?:\\[CDATA\\[|--)|(?:\\]\\]|--)>\\s*$/g;function Oe(e,t){return N(e,\"table\")&&N(11!==t.nodeType?t:t.firstChild,\"tr\")&&E(e).children(\"tbody\")[0]||e}function je(e){return e.type=(null!==e.getAttribute(\"type\"))+\"/\"+e.type,e}function qe(e){return\"true/\"===(e.type||\"\").slice(0,5)?e.type=e.type.slice(5):e.removeAttribute(\"type\"),e}function Me(e,t){var n,r,i,o,a,s;if(1===t.nodeType){if(X.hasData(e)&&(s=X.get(e).events))for(i in X.remove(t,\"handle events\"),s)for(n=0,r=s[i].length;n<r;n++)E.event.add(t,i,s[i][n]);Y.hasData(e)&&(o=Y.access(e),a=E.extend({},o),Y.set(t,a))}}function Le(n,r,i,o){r=g(r);var e,t,a,s,u,c,l=0,f=n.length,d=f-1,p=r[0],h=y(p);if(h||1<f&&\"string\"==typeof p&&!b.checkClone&&Ae.test(p))return n.each(function(e){var t=n.eq(e);h&&(r[0]=p.call(this,e,t.html())),Le(t,r,i,o)});if(f&&(t=(e=ye(r,n[0].ownerDocument,!1,n,o)).firstChild,1===e.childNodes.length&&(e=t),t||o)){for(s=(a=E.map(ge(e,\"script\"),je)).length;l<f;l++)u=e,l!==d&&(u=E.clone(u,!0,!0),s&&E.merge(a,ge(u,\"script\"))),i.call(n[l],u,l);if(s)for(c=a[a.length-1].ownerDocument,E.map(a,qe),l=0;l<s;l++)u=a[l],he.test(u.type||\"\")&&!X.access(u,\"globalEval\")&&E.contains(c,u)&&(u.src&&\"module\"!==(u.type||\"\").toLowerCase()?E._evalUrl&&!u.noModule&&E._evalUrl(u.src,{nonce:u.nonce||u.getAttribute(\"nonce\")},c):w(u.textContent.replace(De,\"\"),u,c))}return n}function Pe(e,t,n){for(var r,i=t?E.filter(t,e):e,o=0;null!=(r=i[o]);o++)n||1!==r.nodeType||E.cleanData(ge(r)),r.parentNode&&(n&&ie(r)&&me(ge(r,\"script\")),r.parentNode.removeChild(r));return e}E.extend({htmlPrefilter:function(e){return e},clone:function(e,t,n){var r,i,o,a,s,u,c,l=e.cloneNode(!0),f=ie(e);if(!(b.noCloneChecked||1!==e.nodeType&&11!==e.nodeType||E.isXMLDoc(e)))for(a=ge(l),r=0,i=(o=ge(e)).length;r<i;r++)s=o[r],u=a[r],void 0,\"input\"===(c=u.nodeName.toLowerCase())&&de.test(s.type)?u.checked=s.checked:\"input\"!==c&&\"textarea\"!==c||(u.defaultValue=s.defaultValue);if(t)if(n)for(o=o||ge(e),a=a||ge(l),r=0,i=o.length;r<i;r++)Me(o[r],a[r]);else Me(e,l);return 0<(a=ge(l,\"script\")).length&&me(a,!f&&ge(e,\"script\")),l},cleanData:function(e){for(var t,n,r,i=E.event.special,o=0;void 0!==(n=e[o]);o++)if(z(n)){if(t=n[X.expando]){if(t.events)for(r in t.events)i[r]?E.event.remove(n,r):E.removeEvent(n,r,t.handle);n[X.expando]=void 0}n[Y.expando]&&(n[Y.expando]=void 0)}}}),E.fn.extend({detach:function(e){return Pe(this,e,!0)},remove:function(e){return Pe(this,e)},text:function(e){return $(this,function(e){return void 0===e?E.text(this):this.empty().each(function(){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||(this.textContent=e)})},null,e,arguments.length)},append:function(){return Le(this,arguments,function(e){1!==this.nodeType&&11!==this.nodeType&&9!==this.nodeType||Oe(this,e).appendChild(e)})},prepend:function(){return Le(this,arguments,function(e){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var t=Oe(this,e);t.insertBefore(e,t.firstChild)}})},before:function(){return Le(this,arguments,function(e){this.parentNode&&this.parentNode.insertBefore(e,this)})},after:function(){return Le(this,arguments,function(e){this.parentNode&&this.parentNode.insertBefore(e,this.nextSibling)})},empty:function(){for(var e,t=0;null!=(e=this[t]);t++)1===e.nodeType&&(E.cleanData(ge(e,!1)),e.textContent=\"\");return this},clone:function(e,t){return e=null!=e&&e,t=null==t?e:t,this.map(function(){return E.clone(this,e,t)})},html:function(e){return $(this,function(e){var t=this[0]||{},n=0,r=this.length;if(void 0===e&&1===t.nodeType)return t.innerHTML;if(\"string\"==typeof e&&!_e.test(e)&&!ve[(pe.exec(e)||[\"\",\"\"])[1].toLowerCase()]){e=E.htmlPrefilter(e);try{for(;n<r;n++)1===(t=this[n]||{}).nodeType&&(E.cleanData(ge(t,!1)),t.innerHTML=e);t=0}catch(e){}}t&&this.empty().append(e)},null,e,arguments.length)},replaceWith:function(){var n=[];return Le(this,arguments,function(e){var t=this.parentNode;E.inArray(this,n)<0&&(E.cleanData(ge(this)),t&&t.replaceChild(e,this))},n)}}),E.each({appendTo:\"append\",prependTo:\"prepend\",insertBefore:\"before\",insertAfter:\"after\",replaceAll:\"replaceWith\"},function(e,a){E.fn[e]=function(e){for(var t,n=[],r=E(e),i=r.length-1,o=0;o<=i;o++)t=o===i?this:this.clone(!0),E(r[o])[a](t),u.apply(n,t.get());return this.pushStack(n)}});function Re(e,t,n){var r,i,o={};for(i in t)o[i]=e.style[i],e.style[i]=t[i];for(i in r=n.call(e),t)e.style[i]=o[i];return r}var Be,Ie,He,Fe,$e,We,Ve,Ue,Je=new RegExp(\"^(\"+ee+\")(?!px)[a-z%]+$\",\"i\"),ze=function(e){var t=e.ownerDocument.defaultView;return t&&t.opener||(t=T),t.getComputedStyle(e)},Ge=new RegExp(ne.join(\"|\"),\"i\");function Xe(){if(Ue){Ve.style.cssText=\"position:absolute;left:-11111px;width:60px;margin-top:1px;padding:0;border:0\",Ue.style.cssText=\"position:relative;display:block;box-sizing:border-box;overflow:scroll;margin:auto;border:1px;padding:1px;width:60%;top:1%\",re.appendChild(Ve).appendChild(Ue);var e=T.getComputedStyle(Ue);Be=\"1%\"!==e.top,We=12===Ye(e.marginLeft),Ue.style.right=\"60%\",Fe=36===Ye(e.right),Ie=36===Ye(e.width),Ue.style.position=\"absolute\",He=12===Ye(Ue.offsetWidth/3),re.removeChild(Ve),Ue=null}}function Ye(e){return Math.round(parseFloat(e))}function Ke(e,t,n){var r,i,o,a,s=e.style;return(n=n||ze(e))&&(\"\"!==(a=n.getPropertyValue(t)||n[t])||ie(e)||(a=E.style(e,t)),!b.pixelBoxStyles()&&Je.test(a)&&Ge.test(t)&&(r=s.width,i=s.minWidth,o=s.maxWidth,s.minWidth=s.maxWidth=s.width=a,a=n.width,s.width=r,s.minWidth=i,s.maxWidth=o)),void 0!==a?a+\"\":a}function Qe(e,t){return{get:function(){if(!e())return(this.get=t).apply(this,arguments);delete this.get}}}Ve=k.createElement(\"div\"),(Ue=k.createElement(\"div\")).style&&(Ue.style.backgroundClip=\"content-box\",Ue.cloneNode(!0).style.backgroundClip=\"\",b.clearCloneStyle=\"content-box\"===Ue.style.backgroundClip,E.extend(b,{boxSizingReliable:function(){return Xe(),Ie},pixelBoxStyles:function(){return Xe(),Fe},pixelPosition:function(){return Xe(),Be},reliableMarginLeft:function(){return Xe(),We},scrollboxSize:function(){return Xe(),He},reliableTrDimensions:function(){var e,t,n,r;return null==$e&&(e=k.createElement(\"table\"),t=k.createElement(\"tr\"),n=k.createElement(\"div\"),e.style.cssText=\"position:absolute;left:-11111px\",t.style.height=\"1px\",n.style.height=\"9px\",re.appendChild(e).appendChild(t).appendChild(n),r=T.getComputedStyle(t),$e=3<parseInt(r.height),re.removeChild(e)),$e}}));var Ze=[\"Webkit\",\"Moz\",\"ms\"],et=k.createElement(\"div\").style,tt={};function nt(e){var t=E.cssProps[e]||tt[e];return t||(e in et?e:tt[e]=function(e){for(var t=e[0].toUpperCase()+e.slice(1),n=Ze.length;n--;)if((e=Ze[n]+t)in et)return e}(e)||e)}var rt=/^(none|table(?!-c[ea]).+)/,it=/^--/,ot={position:\"absolute\",visibility:\"hidden\",display:\"block\"},at={letterSpacing:\"0\",fontWeight:\"400\"};function st(e,t,n){var r=te.exec(t);return r?Math.max(0,r[2]-(n||0))+(r[3]||\"px\"):t}function ut(e,t,n,r,i,o){var a=\"width\"===t?1:0,s=0,u=0;if(n===(r?\"border\":\"content\"))return 0;for(;a<4;a+=2)\"margin\"===n&&(u+=E.css(e,n+ne[a],!0,i)),r?(\"content\"===n&&(u-=E.css(e,\"padding\"+ne[a],!0,i)),\"margin\"!==n&&(u-=E.css(e,\"border\"+ne[a]+\"Width\",!0,i))):(u+=E.css(e,\"padding\"+ne[a],!0,i),\"padding\"!==n?u+=E.css(e,\"border\"+ne[a]+\"Width\",!0,i):s+=E.css(e,\"border\"+ne[a]+\"Width\",!0,i));return!r&&0<=o&&(u+=Math.max(0,Math.ceil(e[\"offset\"+t[0].toUpperCase()+t.slice(1)]-o-u-s-.5))||0),u}function ct(e,t,n){var r=ze(e),i=(!b.boxSizingReliable()||n)&&\"border-box\"===E.css(e,\"boxSizing\",!1,r),o=i,a=Ke(e,t,r),s=\"offset\"+t[0].toUpperCase()+t.slice(1);if(Je.test(a)){if(!n)return a;a=\"auto\"}return(!b.boxSizingReliable()&&i||!b.reliableTrDimensions()&&N(e,\"tr\")||\"auto\"===a||!parseFloat(a)&&\"inline\"===E.css(e,\"display\",!1,r))&&e.getClientRects().length&&(i=\"border-box\"===E.css(e,\"boxSizing\",!1,r),(o=s in e)&&(a=e[s])),(a=parseFloat(a)||0)+ut(e,t,n||(i?\"border\":\"content\"),o,r,a)+\"px\"}function lt(e,t,n,r,i){return new lt.prototype.init(e,t,n,r,i)}E.extend({cssHooks:{opacity:{get:function(e,t){if(t){var n=Ke(e,\"opacity\");return\"\"===n?\"1\":n}}}},cssNumber:{animationIterationCount:!0,columnCount:!0,fillOpacity:!0,flexGrow:!0,flexShrink:!0,fontWeight:!0,gridArea:!0,gridColumn:!0,gridColumnEnd:!0,gridColumnStart:!0,gridRow:!0,gridRowEnd:!0,gridRowStart:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,widows:!0,zIndex:!0,zoom:!0},cssProps:{},style:function(e,t,n,r){if(e&&3!==e.nodeType&&8!==e.nodeType&&e.style){var i,o,a,s=J(t),u=it.test(t),c=e.style;if(u||(t=nt(s)),a=E.cssHooks[t]||E.cssHooks[s],void 0===n)return a&&\"get\"in a&&void 0!==(i=a.get(e,!1,r))?i:c[t];\"string\"===(o=_typeof(n))&&(i=te.exec(n))&&i[1]&&(n=se(e,t,i),o=\"number\"),null!=n&&n==n&&(\"number\"!==o||u||(n+=i&&i[3]||(E.cssNumber[s]?\"\":\"px\")),b.clearCloneStyle||\"\"!==n||0!==t.indexOf(\"background\")||(c[t]=\"inherit\"),a&&\"set\"in a&&void 0===(n=a.set(e,n,r))||(u?c.setProperty(t,n):c[t]=n))}},css:function(e,t,n,r){var i,o,a,s=J(t);return it.test(t)||(t=nt(s)),(a=E.cssHooks[t]||E.cssHooks[s])&&\"get\"in a&&(i=a.get(e,!0,n)),void 0===i&&(i=Ke(e,t,r)),\"normal\"===i&&t in at&&(i=at[t]),\"\"===n||n?(o=parseFloat(i),!0===n||isFinite(o)?o||0:i):i}}),E.each([\"height\",\"width\"],function(e,u){E.cssHooks[u]={get:function(e,t,n){if(t)return!rt.test(E.css(e,\"display\"))||e.getClientRects().length&&e.getBoundingClientRect().width?ct(e,u,n):Re(e,ot,function(){return ct(e,u,n)})},set:function(e,t,n){var r,i=ze(e),o=!b.scrollboxSize()&&\"absolute\"===i.position,a=(o||n)&&\"border-box\"===E.css(e,\"boxSizing\",!1,i),s=n?ut(e,u,n,a,i):0;return a&&o&&(s-=Math.ceil(e[\"offset\"+u[0].toUpperCase()+u.slice(1)]-parseFloat(i[u])-ut(e,u,\"border\",!1,i)-.5)),s&&(r=te.exec(t))&&\"px\"!==(r[3]||\"px\")&&(e.style[u]=t,t=E.css(e,u)),st(0,t,s)}}}),E.cssHooks.marginLeft=Qe(b.reliableMarginLeft,function(e,t){if(t)return(parseFloat(Ke(e,\"marginLeft\"))||e.getBoundingClientRect().left-Re(e,{marginLeft:0},function(){return e.getBoundingClientRect().left}))+\"px\"}),E.each({margin:\"\",padding:\"\",border:\"Width\"},function(i,o){E.cssHooks[i+o]={expand:function(e){for(var t=0,n={},r=\"string\"==typeof e?e.split(\" \"):[e];t<4;t++)n[i+ne[t]+o]=r[t]||r[t-2]||r[0];return n}},\"margin\"!==i&&(E.cssHooks[i+o].set=st)}),E.fn.extend({css:function(e,t){return $(this,function(e,t,n){var r,i,o={},a=0;if(Array.isArray(t)){for(r=ze(e),i=t.length;a<i;a++)o[t[a]]=E.css(e,t[a],!1,r);return o}return void 0!==n?E.style(e,t,n):E.css(e,t)},e,t,1<arguments.length)}}),((E.Tween=lt).prototype={constructor:lt,init:function(e,t,n,r,i,o){this.elem=e,this.prop=n,this.easing=i||E.easing._default,this.options=t,this.start=this.now=this.cur(),this.end=r,this.unit=o||(E.cssNumber[n]?\"\":\"px\")},cur:function(){var e=lt.propHooks[this.prop];return e&&e.get?e.get(this):lt.propHooks._default.get(this)},run:function(e){var t,n=lt.propHooks[this.prop];return this.options.duration?this.pos=t=E.easing[this.easing](e,this.options.duration*e,0,1,this.options.duration):this.pos=t=e,this.now=(this.end-this.start)*t+this.start,this.options.step&&this.options.step.call(this.elem,this.now,this),n&&n.set?n.set(this):lt.propHooks._default.set(this),this}}).init.prototype=lt.prototype,(lt.propHooks={_default:{get:function(e){var t;return 1!==e.elem.nodeType||null!=e.elem[e.prop]&&null==e.elem.style[e.prop]?e.elem[e.prop]:(t=E.css(e.elem,e.prop,\"\"))&&\"auto\"!==t?t:0},set:function(e){E.fx.step[e.prop]?E.fx.step[e.prop](e):1!==e.elem.nodeType||!E.cssHooks[e.prop]&&null==e.elem.style[nt(e.prop)]?e.elem[e.prop]=e.now:E.style(e.elem,e.prop,e.now+e.unit)}}}).scrollTop=lt.propHooks.scrollLeft={set:function(e){e.elem.nodeType&&e.elem.parentNode&&(e.elem[e.prop]=e.now)}},E.easing={linear:function(e){return e},swing:function(e){return.5-Math.cos(e*Math.PI)/2},_default:\"swing\"},E.fx=lt.prototype.init,E.fx.step={};var ft,dt,pt,ht,vt=/^(?:toggle|show|hide)$/,gt=/queueHooks$/;function mt(){dt&&(!1===k.hidden&&T.requestAnimationFrame?T.requestAnimationFrame(mt):T.setTimeout(mt,E.fx.interval),E.fx.tick())}function bt(){return T.setTimeout(function(){ft=void 0}),ft=Date.now()}function yt(e,t){var n,r=0,i={height:e};for(t=t?1:0;r<4;r+=2-t)i[\"margin\"+(n=ne[r])]=i[\"padding\"+n]=e;return t&&(i.opacity=i.width=e),i}function wt(e,t,n){for(var r,i=(xt.tweeners[t]||[]).concat(xt.tweeners[\"*\"]),o=0,a=i.length;o<a;o++)if(r=i[o].call(n,t,e))return r}function xt(o,e,t){var n,a,r=0,i=xt.prefilters.length,s=E.Deferred().always(function(){delete u.elem}),u=function(){if(a)return!1;for(var e=ft||bt(),t=Math.max(0,c.startTime+c.duration-e),n=1-(t/c.duration||0),r=0,i=c.tweens.length;r<i;r++)c.tweens[r].run(n);return s.notifyWith(o,[c,n,t]),n<1&&i?t:(i||s.notifyWith(o,[c,1,0]),s.resolveWith(o,[c]),!1)},c=s.promise({elem:o,props:E.extend({},e),opts:E.extend(!0,{specialEasing:{},easing:E.easing._default},t),originalProperties:e,originalOptions:t,startTime:ft||bt(),duration:t.duration,tweens:[],createTween:function(e,t){var n=E.Tween(o,c.opts,e,t,c.opts.specialEasing[e]||c.opts.easing);return c.tweens.push(n),n},stop:function(e){var t=0,n=e?c.tweens.length:0;if(a)return this;for(a=!0;t<n;t++)c.tweens[t].run(1);return e?(s.notifyWith(o,[c,1,0]),s.resolveWith(o,[c,e])):s.rejectWith(o,[c,e]),this}}),l=c.props;for(!function(e,t){var n,r,i,o,a;for(n in e)if(i=t[r=J(n)],o=e[n],Array.isArray(o)&&(i=o[1],o=e[n]=o[0]),n!==r&&(e[r]=o,delete e[n]),(a=E.cssHooks[r])&&\"expand\"in a)for(n in o=a.expand(o),delete e[r],o)n in e||(e[n]=o[n],t[n]=i);else t[r]=i}(l,c.opts.specialEasing);r<i;r++)if(n=xt.prefilters[r].call(c,o,l,c.opts))return y(n.stop)&&(E._queueHooks(c.elem,c.opts.queue).stop=n.stop.bind(n)),n;return E.map(l,wt,c),y(c.opts.start)&&c.opts.start.call(o,c),c.progress(c.opts.progress).done(c.opts.done,c.opts.complete).fail(c.opts.fail).always(c.opts.always),E.fx.timer(E.extend(u,{elem:o,anim:c,queue:c.opts.queue})),c}E.Animation=E.extend(xt,{tweeners:{\"*\":[function(e,t){var n=this.createTween(e,t);return se(n.elem,e,te.exec(t),n),n}]},tweener:function(e,t){for(var n,r=0,i=(e=y(e)?(t=e,[\"*\"]):e.match(L)).length;r<i;r++)n=e[r],xt.tweeners[n]=xt.tweeners[n]||[],xt.tweeners[n].unshift(t)},prefilters:[function(e,t,n){var r,i,o,a,s,u,c,l,f=\"width\"in t||\"height\"in t,d=this,p={},h=e.style,v=e.nodeType&&ae(e),g=X.get(e,\"fxshow\");for(r in n.queue||(null==(a=E._queueHooks(e,\"fx\")).unqueued&&(a.unqueued=0,s=a.empty.fire,a.empty.fire=function(){a.unqueued||s()}),a.unqueued++,d.always(function(){d.always(function(){a.unqueued--,E.queue(e,\"fx\").length||a.empty.fire()})})),t)if(i=t[r],vt.test(i)){if(delete t[r],o=o||\"toggle\"===i,i===(v?\"hide\":\"show\")){if(\"show\"!==i||!g||void 0===g[r])continue;v=!0}p[r]=g&&g[r]||E.style(e,r)}if((u=!E.isEmptyObject(t))||!E.isEmptyObject(p))for(r in f&&1===e.nodeType&&(n.overflow=[h.overflow,h.overflowX,h.overflowY],null==(c=g&&g.display)&&(c=X.get(e,\"display\")),\"none\"===(l=E.css(e,\"display\"))&&(c?l=c:(ce([e],!0),c=e.style.display||c,l=E.css(e,\"display\"),ce([e]))),(\"inline\"===l||\"inline-block\"===l&&null!=c)&&\"none\"===E.css(e,\"float\")&&(u||(d.done(function(){h.display=c}),null==c&&(l=h.display,c=\"none\"===l?\"\":l)),h.display=\"inline-block\")),n.overflow&&(h.overflow=\"hidden\",d.always(function(){h.overflow=n.overflow[0],h.overflowX=n.overflow[1],h.overflowY=n.overflow[2]})),u=!1,p)u||(g?\"hidden\"in g&&(v=g.hidden):g=X.access(e,\"fxshow\",{display:c}),o&&(g.hidden=!v),v&&ce([e],!0),d.done(function(){for(r in v||ce([e]),X.remove(e,\"fxshow\"),p)E.style(e,r,p[r])})),u=wt(v?g[r]:0,r,d),r in g||(g[r]=u.start,v&&(u.end=u.start,u.start=0))}],prefilter:function(e,t){t?xt.prefilters.unshift(e):xt.prefilters.push(e)}}),E.speed=function(e,t,n){var r=e&&\"object\"===_typeof(e)?E.extend({},e):{complete:n||!n&&t||y(e)&&e,duration:e,easing:n&&t||t&&!y(t)&&t};return E.fx.off?r.duration=0:\"number\"!=typeof r.duration&&(r.duration in E.fx.speeds?r.duration=E.fx.speeds[r.duration]:r.duration=E.fx.speeds._default),null!=r.queue&&!0!==r.queue||(r.queue=\"fx\"),r.old=r.complete,r.complete=function(){y(r.old)&&r.old.call(this),r.queue&&E.dequeue(this,r.queue)},r},E.fn.extend({fadeTo:function(e,t,n,r){return this.filter(ae).css(\"opacity\",0).show().end().animate({opacity:t},e,n,r)},animate:function(t,e,n,r){function i(){var e=xt(this,E.extend({},t),a);(o||X.get(this,\"finish\"))&&e.stop(!0)}var o=E.isEmptyObject(t),a=E.speed(e,n,r);return i.finish=i,o||!1===a.queue?this.each(i):this.queue(a.queue,i)},stop:function(i,e,o){function a(e){var t=e.stop;delete e.stop,t(o)}return\"string\"!=typeof i&&(o=e,e=i,i=void 0),e&&this.queue(i||\"fx\",[]),this.each(function(){var e=!0,t=null!=i&&i+\"queueHooks\",n=E.timers,r=X.get(this);if(t)r[t]&&r[t].stop&&a(r[t]);else for(t in r)r[t]&&r[t].stop&&gt.test(t)&&a(r[t]);for(t=n.length;t--;)n[t].elem!==this||null!=i&&n[t].queue!==i||(n[t].anim.stop(o),e=!1,n.splice(t,1));!e&&o||E.dequeue(this,i)})},finish:function(a){return!1!==a&&(a=a||\"fx\"),this.each(function(){var e,t=X.get(this),n=t[a+\"queue\"],r=t[a+\"queueHooks\"],i=E.timers,o=n?n.length:0;for(t.finish=!0,E.queue(this,a,[]),r&&r.stop&&r.stop.call(this,!0),e=i.length;e--;)i[e].elem===this&&i[e].queue===a&&(i[e].anim.stop(!0),i.splice(e,1));for(e=0;e<o;e++)n[e]&&n[e].finish&&n[e].finish.call(this);delete t.finish})}}),E.each([\"toggle\",\"show\",\"hide\"],function(e,r){var i=E.fn[r];E.fn[r]=function(e,t,n){return null==e||\"boolean\"==typeof e?i.apply(this,arguments):this.animate(yt(r,!0),e,t,n)}}),E.each({slideDown:yt(\"show\"),slideUp:yt(\"hide\"),slideToggle:yt(\"toggle\"),fadeIn:{opacity:\"show\"},fadeOut:{opacity:\"hide\"},fadeToggle:{opacity:\"toggle\"}},function(e,r){E.fn[e]=function(e,t,n){return this.animate(r,e,t,n)}}),E.timers=[],E.fx.tick=function(){var e,t=0,n=E.timers;for(ft=Date.now();t<n.length;t++)(e=n[t])()||n[t]!==e||n.splice(t--,1);n.length||E.fx.stop(),ft=void 0},E.fx.timer=function(e){E.timers.push(e),E.fx.start()},E.fx.interval=13,E.fx.start=function(){dt||(dt=!0,mt())},E.fx.stop=function(){dt=null},E.fx.speeds={slow:600,fast:200,_default:400},E.fn.delay=function(r,e){return r=E.fx&&E.fx.speeds[r]||r,e=e||\"fx\",this.queue(e,function(e,t){var n=T.setTimeout(e,r);t.stop=function(){T.clearTimeout(n)}})},pt=k.createElement(\"input\"),ht=k.createElement(\"select\").appendChild(k.createElement(\"option\")),pt.type=\"checkbox\",b.checkOn=\"\"!==pt.value,b.optSelected=ht.selected,(pt=k.createElement(\"input\")).value=\"t\",pt.type=\"radio\",b.radioValue=\"t\"===pt.value;var Ct,Tt=E.expr.attrHandle;E.fn.extend({attr:function(e,t){return $(this,E.attr,e,t,1<arguments.length)},removeAttr:function(e){return this.each(function(){E.removeAttr(this,e)})}}),E.extend({attr:function(e,t,n){var r,i,o=e.nodeType;if(3!==o&&8!==o&&2!==o)return void 0===e.getAttribute?E.prop(e,t,n):(1===o&&E.isXMLDoc(e)||(i=E.attrHooks[t.toLowerCase()]||(E.expr.match.bool.test(t)?Ct:void 0)),void 0!==n?null===n?void E.removeAttr(e,t):i&&\"set\"in i&&void 0!==(r=i.set(e,n,t))?r:(e.setAttribute(t,n+\"\"),n):i&&\"get\"in i&&null!==(r=i.get(e,t))?r:null==(r=E.find.attr(e,t))?void 0:r)},attrHooks:{type:{set:function(e,t){if(!b.radioValue&&\"radio\"===t&&N(e,\"input\")){var n=e.value;return e.setAttribute(\"type\",t),n&&(e.value=n),t}}}},removeAttr:function(e,t){var n,r=0,i=t&&t.match(L);if(i&&1===e.nodeType)for(;n=i[r++];)e.removeAttribute(n)}}),Ct={set:function(e,t,n){return!1===t?E.removeAttr(e,n):e.setAttribute(n,n),n}},E.each(E.expr.match.bool.source.match(/\\w+/g),function(e,t){var a=Tt[t]||E.find.attr;Tt[t]=function(e,t,n){var r,i,o=t.toLowerCase();return n||(i=Tt[o],Tt[o]=r,r=null!=a(e,t,n)?o:null,Tt[o]=i),r}});var kt=/^(?:input|select|textarea|button)$/i,Et=/^(?:a|area)$/i;function St(e){return(e.match(L)||[]).join(\" \")}function Nt(e){return e.getAttribute&&e.getAttribute(\"class\")||\"\"}function _t(e){return Array.isArray(e)?e:\"string\"==typeof e&&e.match(L)||[]}E.fn.extend({prop:function(e,t){return $(this,E.prop,e,t,1<arguments.length)},removeProp:function(e){return this.each(function(){delete this[E.propFix[e]||e]})}}),E.extend({prop:function(e,t,n){var r,i,o=e.nodeType;if(3!==o&&8!==o&&2!==o)return 1===o&&E.isXMLDoc(e)||(t=E.propFix[t]||t,i=E.propHooks[t]),void 0!==n?i&&\"set\"in i&&void 0!==(r=i.set(e,n,t))?r:e[t]=n:i&&\"get\"in i&&null!==(r=i.get(e,t))?r:e[t]},propHooks:{tabIndex:{get:function(e){var t=E.find.attr(e,\"tabindex\");return t?parseInt(t,10):kt.test(e.nodeName)||Et.test(e.nodeName)&&e.href?0:-1}}},propFix:{for:\"htmlFor\",class:\"className\"}}),b.optSelected||(E.propHooks.selected={get:function(e){var t=e.parentNode;return t&&t.parentNode&&t.parentNode.selectedIndex,null},set:function(e){var t=e.parentNode;t&&(t.selectedIndex,t.parentNode&&t.parentNode.selectedIndex)}}),E.each([\"tabIndex\",\"readOnly\",\"maxLength\",\"cellSpacing\",\"cellPadding\",\"rowSpan\",\"colSpan\",\"useMap\",\"frameBorder\",\"contentEditable\"],function(){E.propFix[this.toLowerCase()]=this}),E.fn.extend({addClass:function(t){var e,n,r,i,o,a,s,u=0;if(y(t))return this.each(function(e){E(this).addClass(t.call(this,e,Nt(this)))});if((e=_t(t)).length)for(;n=this[u++];)if(i=Nt(n),r=1===n.nodeType&&\" \"+St(i)+\" \"){for(a=0;o=e[a++];)r.indexOf(\" \"+o+\" \")<0&&(r+=o+\" \");i!==(s=St(r))&&n.setAttribute(\"class\",s)}return this},removeClass:function(t){var e,n,r,i,o,a,s,u=0;if(y(t))return this.each(function(e){E(this).removeClass(t.call(this,e,Nt(this)))});if(!arguments.length)return this.attr(\"class\",\"\");if((e=_t(t)).length)for(;n=this[u++];)if(i=Nt(n),r=1===n.nodeType&&\" \"+St(i)+\" \"){for(a=0;o=e[a++];)for(;-1<r.indexOf(\" \"+o+\" \");)r=r.replace(\" \"+o+\" \",\" \");i!==(s=St(r))&&n.setAttribute(\"class\",s)}return this},toggleClass:function(i,t){var o=_typeof(i),a=\"string\"===o||Array.isArray(i);return\"boolean\"==typeof t&&a?t?this.addClass(i):this.removeClass(i):y(i)?this.each(function(e){E(this).toggleClass(i.call(this,e,Nt(this),t),t)}):this.each(function(){var e,t,n,r;if(a)for(t=0,n=E(this),r=_t(i);e=r[t++];)n.hasClass(e)?n.removeClass(e):n.addClass(e);else void 0!==i&&\"boolean\"!==o||((e=Nt(this))&&X.set(this,\"__className__\",e),this.setAttribute&&this.setAttribute(\"class\",e||!1===i?\"\":X.get(this,\"__className__\")||\"\"))})},hasClass:function(e){var t,n,r=0;for(t=\" \"+e+\" \";n=this[r++];)if(1===n.nodeType&&-1<(\" \"+St(Nt(n))+\" \").indexOf(t))return!0;return!1}});var At=/\\r/g;E.fn.extend({val:function(n){var r,e,i,t=this[0];return arguments.length?(i=y(n),this.each(function(e){var t;1===this.nodeType&&(null==(t=i?n.call(this,e,E(this).val()):n)?t=\"\":\"number\"==typeof t?t+=\"\":Array.isArray(t)&&(t=E.map(t,function(e){return null==e?\"\":e+\"\"})),(r=E.valHooks[this.type]||E.valHooks[this.nodeName.toLowerCase()])&&\"set\"in r&&void 0!==r.set(this,t,\"value\")||(this.value=t))})):t?(r=E.valHooks[t.type]||E.valHooks[t.nodeName.toLowerCase()])&&\"get\"in r&&void 0!==(e=r.get(t,\"value\"))?e:\"string\"==typeof(e=t.value)?e.replace(At,\"\"):null==e?\"\":e:void 0}}),E.extend({valHooks:{option:{get:function(e){var t=E.find.attr(e,\"value\");return null!=t?t:St(E.text(e))}},select:{get:function(e){var t,n,r,i=e.options,o=e.selectedIndex,a=\"select-one\"===e.type,s=a?null:[],u=a?o+1:i.length;for(r=o<0?u:a?o:0;r<u;r++)if(((n=i[r]).selected||r===o)&&!n.disabled&&(!n.parentNode.disabled||!N(n.parentNode,\"optgroup\"))){if(t=E(n).val(),a)return t;s.push(t)}return s},set:function(e,t){for(var n,r,i=e.options,o=E.makeArray(t),a=i.length;a--;)((r=i[a]).selected=-1<E.inArray(E.valHooks.option.get(r),o))&&(n=!0);return n||(e.selectedIndex=-1),o}}}}),E.each([\"radio\",\"checkbox\"],function(){E.valHooks[this]={set:function(e,t){if(Array.isArray(t))return e.checked=-1<E.inArray(E(e).val(),t)}},b.checkOn||(E.valHooks[this].get=function(e){return null===e.getAttribute(\"value\")?\"on\":e.value})}),b.focusin=\"onfocusin\"in T;function Dt(e){e.stopPropagation()}var Ot=/^(?:focusinfocus|focusoutblur)$/;E.extend(E.event,{trigger:function(e,t,n,r){var i,o,a,s,u,c,l,f,d=[n||k],p=m.call(e,\"type\")?e.type:e,h=m.call(e,\"namespace\")?e.namespace.split(\".\"):[];if(o=f=a=n=n||k,3!==n.nodeType&&8!==n.nodeType&&!Ot.test(p+E.event.triggered)&&(-1<p.indexOf(\".\")&&(p=(h=p.split(\".\")).shift(),h.sort()),u=p.indexOf(\":\")<0&&\"on\"+p,(e=e[E.expando]?e:new E.Event(p,\"object\"===_typeof(e)&&e)).isTrigger=r?2:3,e.namespace=h.join(\".\"),e.rnamespace=e.namespace?new RegExp(\"(^|\\\\.)\"+h.join(\"\\\\.(?:.*\\\\.|)\")+\"(\\\\.|$)\"):null,e.result=void 0,e.target||(e.target=n),t=null==t?[e]:E.makeArray(t,[e]),l=E.event.special[p]||{},r||!l.trigger||!1!==l.trigger.apply(n,t))){if(!r&&!l.noBubble&&!v(n)){for(s=l.delegateType||p,Ot.test(s+p)||(o=o.parentNode);o;o=o.parentNode)d.push(o),a=o;a===(n.ownerDocument||k)&&d.push(a.defaultView||a.parentWindow||T)}for(i=0;(o=d[i++])&&!e.isPropagationStopped();)f=o,e.type=1<i?s:l.bindType||p,(c=(X.get(o,\"events\")||Object.create(null))[e.type]&&X.get(o,\"handle\"))&&c.apply(o,t),(c=u&&o[u])&&c.apply&&z(o)&&(e.result=c.apply(o,t),!1===e.result&&e.preventDefault());return e.type=p,r||e.isDefaultPrevented()||l._default&&!1!==l._default.apply(d.pop(),t)||!z(n)||u&&y(n[p])&&!v(n)&&((a=n[u])&&(n[u]=null),E.event.triggered=p,e.isPropagationStopped()&&f.addEventListener(p,Dt),n[p](),e.isPropagationStopped()&&f.removeEventListener(p,Dt),E.event.triggered=void 0,a&&(n[u]=a)),e.result}},simulate:function(e,t,n){var r=E.extend(new E.Event,n,{type:e,isSimulated:!0});E.event.trigger(r,null,t)}}),E.fn.extend({trigger:function(e,t){return this.each(function(){E.event.trigger(e,t,this)})},triggerHandler:function(e,t){var n=this[0];if(n)return E.event.trigger(e,t,n,!0)}}),b.focusin||E.each({focus:\"focusin\",blur:\"focusout\"},function(n,r){function i(e){E.event.simulate(r,e.target,E.event.fix(e))}E.event.special[r]={setup:function(){var e=this.ownerDocument||this.document||this,t=X.access(e,r);t||e.addEventListener(n,i,!0),X.access(e,r,(t||0)+1)},teardown:function(){var e=this.ownerDocument||this.document||this,t=X.access(e,r)-1;t?X.access(e,r,t):(e.removeEventListener(n,i,!0),X.remove(e,r))}}});var jt=T.location,qt={guid:Date.now()},Mt=/\\?/;E.parseXML=function(e){var t;if(!e||\"string\"!=typeof e)return null;try{t=(new T.DOMParser).parseFromString(e,\"text/xml\")}catch(e){t=void 0}return t&&!t.getElementsByTagName(\"parsererror\").length||E.error(\"Invalid XML: \"+e),t};var Lt=/\\[\\]$/,Pt=/\\r?\\n/g,Rt=/^(?:submit|button|image|reset|file)$/i,Bt=/^(?:input|select|textarea|keygen)/i;function It(n,e,r,i){var t;if(Array.isArray(e))E.each(e,function(e,t){r||Lt.test(n)?i(n,t):It(n+\"[\"+(\"object\"===_typeof(t)&&null!=t?e:\"\")+\"]\",t,r,i)});else if(r||\"object\"!==x(e))i(n,e);else for(t in e)It(n+\"[\"+t+\"]\",e[t],r,i)}E.param=function(e,t){function n(e,t){var n=y(t)?t():t;i[i.length]=encodeURIComponent(e)+\"=\"+encodeURIComponent(null==n?\"\":n)}var r,i=[];if(null==e)return\"\";if(Array.isArray(e)||e.jquery&&!E.isPlainObject(e))E.each(e,function(){n(this.name,this.value)});else for(r in e)It(r,e[r],t,n);return i.join(\"&\")},E.fn.extend({serialize:function(){return E.param(this.serializeArray())},serializeArray:function(){return this.map(function(){var e=E.prop(this,\"elements\");return e?E.makeArray(e):this}).filter(function(){var e=this.type;return this.name&&!E(this).is(\":disabled\")&&Bt.test(this.nodeName)&&!Rt.test(e)&&(this.checked||!de.test(e))}).map(function(e,t){var n=E(this).val();return null==n?null:Array.isArray(n)?E.map(n,function(e){return{name:t.name,value:e.replace(Pt,\"\\r\\n\")}}):{name:t.name,value:n.replace(Pt,\"\\r\\n\")}}).get()}});var Ht=/%20/g,Ft=/#.*$/,$t=/([?&])_=[^&]*/,Wt=/^(.*?):[ \\t]*([^\\r\\n]*)$/gm,Vt=/^(?:GET|HEAD)$/,Ut=/^\\/\\//,Jt={},zt={},Gt=\"*/\".concat(\"*\"),Xt=k.createElement(\"a\");function Yt(o){return function(e,t){\"string\"!=typeof e&&(t=e,e=\"*\");var n,r=0,i=e.toLowerCase().match(L)||[];if(y(t))for(;n=i[r++];)\"+\"===n[0]?(n=n.slice(1)||\"*\",(o[n]=o[n]||[]).unshift(t)):(o[n]=o[n]||[]).push(t)}}function Kt(t,i,o,a){var s={},u=t===zt;function c(e){var r;return s[e]=!0,E.each(t[e]||[],function(e,t){var n=t(i,o,a);return\"string\"!=typeof n||u||s[n]?u?!(r=n):void 0:(i.dataTypes.unshift(n),c(n),!1)}),r}return c(i.dataTypes[0])||!s[\"*\"]&&c(\"*\")}function Qt(e,t){var n,r,i=E.ajaxSettings.flatOptions||{};for(n in t)void 0!==t[n]&&((i[n]?e:r=r||{})[n]=t[n]);return r&&E.extend(!0,e,r),e}Xt.href=jt.href,E.extend({active:0,lastModified:{},etag:{},ajaxSettings:{url:jt.href,type:\"GET\",isLocal:/^(?:about|app|app-storage|.+-extension|file|res|widget):$/.test(jt.protocol),global:!0,processData:!0,async:!0,contentType:\"application/x-www-form-urlencoded; charset=UTF-8\",accepts:{\"*\":Gt,text:\"text/plain\",html:\"text/html\",xml:\"application/xml, text/xml\",json:\"application/json, text/javascript\"},contents:{xml:/\\bxml\\b/,html:/\\bhtml/,json:/\\bjson\\b/},responseFields:{xml:\"responseXML\",text:\"responseText\",json:\"responseJSON\"},converters:{\"* text\":String,\"text html\":!0,\"text json\":JSON.parse,\"text xml\":E.parseXML},flatOptions:{url:!0,context:!0}},ajaxSetup:function(e,t){return t?Qt(Qt(e,E.ajaxSettings),t):Qt(E.ajaxSettings,e)},ajaxPrefilter:Yt(Jt),ajaxTransport:Yt(zt),ajax:function(e,t){\"object\"===_typeof(e)&&(t=e,e=void 0),t=t||{};var l,f,d,n,p,r,h,v,i,o,g=E.ajaxSetup({},t),m=g.context||g,b=g.context&&(m.nodeType||m.jquery)?E(m):E.event,y=E.Deferred(),w=E.Callbacks(\"once memory\"),x=g.statusCode||{},a={},s={},u=\"canceled\",C={readyState:0,getResponseHeader:function(e){var t;if(h){if(!n)for(n={};t=Wt.exec(d);)n[t[1].toLowerCase()+\" \"]=(n[t[1].toLowerCase()+\" \"]||[]).concat(t[2]);t=n[e.toLowerCase()+\" \"]}return null==t?null:t.join(\", \")},getAllResponseHeaders:function(){return h?d:null},setRequestHeader:function(e,t){return null==h&&(e=s[e.toLowerCase()]=s[e.toLowerCase()]||e,a[e]=t),this},overrideMimeType:function(e){return null==h&&(g.mimeType=e),this},statusCode:function(e){var t;if(e)if(h)C.always(e[C.status]);else for(t in e)x[t]=[x[t],e[t]];return this},abort:function(e){var t=e||u;return l&&l.abort(t),c(0,t),this}};if(y.promise(C),g.url=((e||g.url||jt.href)+\"\").replace(Ut,jt.protocol+\"//\"),g.type=t.method||t.type||g.method||g.type,g.dataTypes=(g.dataType||\"*\").toLowerCase().match(L)||[\"\"],null==g.crossDomain){r=k.createElement(\"a\");try{r.href=g.url,r.href=r.href,g.crossDomain=Xt.protocol+\"//\"+Xt.host!=r.protocol+\"//\"+r.host}catch(e){g.crossDomain=!0}}if(g.data&&g.processData&&\"string\"!=typeof g.data&&(g.data=E.param(g.data,g.traditional)),Kt(Jt,g,t,C),h)return C;for(i in(v=E.event&&g.global)&&0==E.active++&&E.event.trigger(\"ajaxStart\"),g.type=g.type.toUpperCase(),g.hasContent=!Vt.test(g.type),f=g.url.replace(Ft,\"\"),g.hasContent?g.data&&g.processData&&0===(g.contentType||\"\").indexOf(\"application/x-www-form-urlencoded\")&&(g.data=g.data.replace(Ht,\"+\")):(o=g.url.slice(f.length),g.data&&(g.processData||\"string\"==typeof g.data)&&(f+=(Mt.test(f)?\"&\":\"?\")+g.data,delete g.data),!1===g.cache&&(f=f.replace($t,\"$1\"),o=(Mt.test(f)?\"&\":\"?\")+\"_=\"+qt.guid+++o),g.url=f+o),g.ifModified&&(E.lastModified[f]&&C.setRequestHeader(\"If-Modified-Since\",E.lastModified[f]),E.etag[f]&&C.setRequestHeader(\"If-None-Match\",E.etag[f])),(g.data&&g.hasContent&&!1!==g.contentType||t.contentType)&&C.setRequestHeader(\"Content-Type\",g.contentType),C.setRequestHeader(\"Accept\",g.dataTypes[0]&&g.accepts[g.dataTypes[0]]?g.accepts[g.dataTypes[0]]+(\"*\"!==g.dataTypes[0]?\", \"+Gt+\"; q=0.01\":\"\"):g.accepts[\"*\"]),g.headers)C.setRequestHeader(i,g.headers[i]);if(g.beforeSend&&(!1===g.beforeSend.call(m,C,g)||h))return C.abort();if(u=\"abort\",w.add(g.complete),C.done(g.success),C.fail(g.error),l=Kt(zt,g,t,C)){if(C.readyState=1,v&&b.trigger(\"ajaxSend\",[C,g]),h)return C;g.async&&0<g.timeout&&(p=T.setTimeout(function(){C.abort(\"timeout\")},g.timeout));try{h=!1,l.send(a,c)}catch(e){if(h)throw e;c(-1,e)}}else c(-1,\"No Transport\");function c(e,t,n,r){var i,o,a,s,u,c=t;h||(h=!0,p&&T.clearTimeout(p),l=void 0,d=r||\"\",C.readyState=0<e?4:0,i=200<=e&&e<300||304===e,n&&(s=function(e,t,n){for(var r,i,o,a,s=e.contents,u=e.dataTypes;\"*\"===u[0];)u.shift(),void 0===r&&(r=e.mimeType||t.getResponseHeader(\"Content-Type\"));if(r)for(i in s)if(s[i]&&s[i].test(r)){u.unshift(i);break}if(u[0]in n)o=u[0];else{for(i in n){if(!u[0]||e.converters[i+\" \"+u[0]]){o=i;break}a=a||i}o=o||a}if(o)return o!==u[0]&&u.unshift(o),n[o]}(g,C,n)),!i&&-1<E.inArray(\"script\",g.dataTypes)&&(g.converters[\"text script\"]=function(){}),s=function(e,t,n,r){var i,o,a,s,u,c={},l=e.dataTypes.slice();if(l[1])for(a in e.converters)c[a.toLowerCase()]=e.converters[a];for(o=l.shift();o;)if(e.responseFields[o]&&(n[e.responseFields[o]]=t),!u&&r&&e.dataFilter&&(t=e.dataFilter(t,e.dataType)),u=o,o=l.shift())if(\"*\"===o)o=u;else if(\"*\"!==u&&u!==o){if(!(a=c[u+\" \"+o]||c[\"* \"+o]))for(i in c)if((s=i.split(\" \"))[1]===o&&(a=c[u+\" \"+s[0]]||c[\"* \"+s[0]])){!0===a?a=c[i]:!0!==c[i]&&(o=s[0],l.unshift(s[1]));break}if(!0!==a)if(a&&e.throws)t=a(t);else try{t=a(t)}catch(e){return{state:\"parsererror\",error:a?e:\"No conversion from \"+u+\" to \"+o}}}return{state:\"success\",data:t}}(g,s,C,i),i?(g.ifModified&&((u=C.getResponseHeader(\"Last-Modified\"))&&(E.lastModified[f]=u),(u=C.getResponseHeader(\"etag\"))&&(E.etag[f]=u)),204===e||\"HEAD\"===g.type?c=\"nocontent\":304===e?c=\"notmodified\":(c=s.state,o=s.data,i=!(a=s.error))):(a=c,!e&&c||(c=\"error\",e<0&&(e=0))),C.status=e,C.statusText=(t||c)+\"\",i?y.resolveWith(m,[o,c,C]):y.rejectWith(m,[C,c,a]),C.statusCode(x),x=void 0,v&&b.trigger(i?\"ajaxSuccess\":\"ajaxError\",[C,g,i?o:a]),w.fireWith(m,[C,c]),v&&(b.trigger(\"ajaxComplete\",[C,g]),--E.active||E.event.trigger(\"ajaxStop\")))}return C},getJSON:function(e,t,n){return E.get(e,t,n,\"json\")},getScript:function(e,t){return E.get(e,void 0,t,\"script\")}}),E.each([\"get\",\"post\"],function(e,i){E[i]=function(e,t,n,r){return y(t)&&(r=r||n,n=t,t=void 0),E.ajax(E.extend({url:e,type:i,dataType:r,data:t,success:n},E.isPlainObject(e)&&e))}}),E.ajaxPrefilter(function(e){var t;for(t in e.headers)\"content-type\"===t.toLowerCase()&&(e.contentType=e.headers[t]||\"\")}),E._evalUrl=function(e,t,n){return E.ajax({url:e,type:\"GET\",dataType:\"script\",cache:!0,async:!1,global:!1,converters:{\"text script\":function(){}},dataFilter:function(e){E.globalEval(e,t,n)}})},E.fn.extend({wrapAll:function(e){var t;return this[0]&&(y(e)&&(e=e.call(this[0])),t=E(e,this[0].ownerDocument).eq(0).clone(!0),this[0].parentNode&&t.insertBefore(this[0]),t.map(function(){for(var e=this;e.firstElementChild;)e=e.firstElementChild;return e}).append(this)),this},wrapInner:function(n){return y(n)?this.each(function(e){E(this).wrapInner(n.call(this,e))}):this.each(function(){var e=E(this),t=e.contents();t.length?t.wrapAll(n):e.append(n)})},wrap:function(t){var n=y(t);return this.each(function(e){E(this).wrapAll(n?t.call(this,e):t)})},unwrap:function(e){return this.parent(e).not(\"body\").each(function(){E(this).replaceWith(this.childNodes)}),this}}),E.expr.pseudos.hidden=function(e){return!E.expr.pseudos.visible(e)},E.expr.pseudos.visible=function(e){return!!(e.offsetWidth||e.offsetHeight||e.getClientRects().length)},E.ajaxSettings.xhr=function(){try{return new T.XMLHttpRequest}catch(e){}};var Zt={0:200,1223:204},en=E.ajaxSettings.xhr();b.cors=!!en&&\"withCredentials\"in en,b.ajax=en=!!en,E.ajaxTransport(function(i){var o,a;if(b.cors||en&&!i.crossDomain)return{send:function(e,t){var n,r=i.xhr();if(r.open(i.type,i.url,i.async,i.username,i.password),i.xhrFields)for(n in i.xhrFields)r[n]=i.xhrFields[n];for(n in i.mimeType&&r.overrideMimeType&&r.overrideMimeType(i.mimeType),i.crossDomain||e[\"X-Requested-With\"]||(e[\"X-Requested-With\"]=\"XMLHttpRequest\"),e)r.setRequestHeader(n,e[n]);o=function(e){return function(){o&&(o=a=r.onload=r.onerror=r.onabort=r.ontimeout=r.onreadystatechange=null,\"abort\"===e?r.abort():\"error\"===e?\"number\"!=typeof r.status?t(0,\"error\"):t(r.status,r.statusText):t(Zt[r.status]||r.status,r.statusText,\"text\"!==(r.responseType||\"text\")||\"string\"!=typeof r.responseText?{binary:r.response}:{text:r.responseText},r.getAllResponseHeaders()))}},r.onload=o(),a=r.onerror=r.ontimeout=o(\"error\"),void 0!==r.onabort?r.onabort=a:r.onreadystatechange=function(){4===r.readyState&&T.setTimeout(function(){o&&a()})},o=o(\"abort\");try{r.send(i.hasContent&&i.data||null)}catch(e){if(o)throw e}},abort:function(){o&&o()}}}),E.ajaxPrefilter(function(e){e.crossDomain&&(e.contents.script=!1)}),E.ajaxSetup({accepts:{script:\"text/javascript, application/javascript, application/ecmascript, application/x-ecmascript\"},contents:{script:/\\b(?:java|ecma)script\\b/},converters:{\"text script\":function(e){return E.globalEval(e),e}}}),E.ajaxPrefilter(\"script\",function(e){void 0===e.cache&&(e.cache=!1),e.crossDomain&&(e.type=\"GET\")}),E.ajaxTransport(\"script\",function(n){var r,i;if(n.crossDomain||n.scriptAttrs)return{send:function(e,t){r=E(\"<script>\").attr(n.scriptAttrs||{}).prop({charset:n.scriptCharset,src:n.url}).on(\"load error\",i=function(e){r.remove(),i=null,e&&t(\"error\"===e.type?404:200,e.type)}),k.head.appendChild(r[0])},abort:function(){i&&i()}}});var tn,nn=[],rn=/(=)\\?(?=&|$)|\\?\\?/;E.ajaxSetup({jsonp:\"callback\",jsonpCallback:function(){var e=nn.pop()||E.expando+\"_\"+qt.guid++;return this[e]=!0,e}}),E.ajaxPrefilter(\"json jsonp\",function(e,t,n){var r,i,o,a=!1!==e.jsonp&&(rn.test(e.url)?\"url\":\"string\"==typeof e.data&&0===(e.contentType||\"\").indexOf(\"application/x-www-form-urlencoded\")&&rn.test(e.data)&&\"data\");if(a||\"jsonp\"===e.dataTypes[0])return r=e.jsonpCallback=y(e.jsonpCallback)?e.jsonpCallback():e.jsonpCallback,a?e[a]=e[a].replace(rn,\"$1\"+r):!1!==e.jsonp&&(e.url+=(Mt.test(e.url)?\"&\":\"?\")+e.jsonp+\"=\"+r),e.converters[\"script json\"]=function(){return o||E.error(r+\" was not called\"),o[0]},e.dataTypes[0]=\"json\",i=T[r],T[r]=function(){o=arguments},n.always(function(){void 0===i?E(T).removeProp(r):T[r]=i,e[r]&&(e.jsonpCallback=t.jsonpCallback,nn.push(r)),o&&y(i)&&i(o[0]),o=i=void 0}),\"script\"}),b.createHTMLDocument=((tn=k.implementation.createHTMLDocument(\"\").body).innerHTML=\"<form></form><form></form>\",2===tn.childNodes.length),E.parseHTML=function(e,t,n){return\"string\"!=typeof e?[]:(\"boolean\"==typeof t&&(n=t,t=!1),t||(b.createHTMLDocument?((r=(t=k.implementation.createHTMLDocument(\"\")).createElement(\"base\")).href=k.location.href,t.head.appendChild(r)):t=k),o=!n&&[],(i=_.exec(e))?[t.createElement(i[1])]:(i=ye([e],t,o),o&&o.length&&E(o).remove(),E.merge([],i.childNodes)));var r,i,o},E.fn.load=function(e,t,n){var r,i,o,a=this,s=e.indexOf(\" \");return-1<s&&(r=St(e.slice(s)),e=e.slice(0,s)),y(t)?(n=t,t=void 0):t&&\"object\"===_typeof(t)&&(i=\"POST\"),0<a.length&&E.ajax({url:e,type:i||\"GET\",dataType:\"html\",data:t}).done(function(e){o=arguments,a.html(r?E(\"<div>\").append(E.parseHTML(e)).find(r):e)}).always(n&&function(e,t){a.each(function(){n.apply(this,o||[e.responseText,t,e])})}),this},E.expr.pseudos.animated=function(t){return E.grep(E.timers,function(e){return t===e.elem}).length},E.offset={setOffset:function(e,t,n){var r,i,o,a,s,u,c=E.css(e,\"position\"),l=E(e),f={};\"static\"===c&&(e.style.position=\"relative\"),s=l.offset(),o=E.css(e,\"top\"),u=E.css(e,\"left\"),i=(\"absolute\"===c||\"fixed\"===c)&&-1<(o+u).indexOf(\"auto\")?(a=(r=l.position()).top,r.left):(a=parseFloat(o)||0,parseFloat(u)||0),y(t)&&(t=t.call(e,n,E.extend({},s))),null!=t.top&&(f.top=t.top-s.top+a),null!=t.left&&(f.left=t.left-s.left+i),\"using\"in t?t.using.call(e,f):(\"number\"==typeof f.top&&(f.top+=\"px\"),\"number\"==typeof f.left&&(f.left+=\"px\"),l.css(f))}},E.fn.extend({offset:function(t){if(arguments.length)return void 0===t?this:this.each(function(e){E.offset.setOffset(this,t,e)});var e,n,r=this[0];return r?r.getClientRects().length?(e=r.getBoundingClientRect(),n=r.ownerDocument.defaultView,{top:e.top+n.pageYOffset,left:e.left+n.pageXOffset}):{top:0,left:0}:void 0},position:function(){if(this[0]){var e,t,n,r=this[0],i={top:0,left:0};if(\"fixed\"===E.css(r,\"position\"))t=r.getBoundingClientRect();else{for(t=this.offset(),n=r.ownerDocument,e=r.offsetParent||n.documentElement;e&&(e===n.body||e===n.documentElement)&&\"static\"===E.css(e,\"position\");)e=e.parentNode;e&&e!==r&&1===e.nodeType&&((i=E(e).offset()).top+=E.css(e,\"borderTopWidth\",!0),i.left+=E.css(e,\"borderLeftWidth\",!0))}return{top:t.top-i.top-E.css(r,\"marginTop\",!0),left:t.left-i.left-E.css(r,\"marginLeft\",!0)}}},offsetParent:function(){return this.map(function(){for(var e=this.offsetParent;e&&\"static\"===E.css(e,\"position\");)e=e.offsetParent;return e||re})}}),E.each({scrollLeft:\"pageXOffset\",scrollTop:\"pageYOffset\"},function(t,i){var o=\"pageYOffset\"===i;E.fn[t]=function(e){return $(this,function(e,t,n){var r;if(v(e)?r=e:9===e.nodeType&&(r=e.defaultView),void 0===n)return r?r[i]:e[t];r?r.scrollTo(o?r.pageXOffset:n,o?n:r.pageYOffset):e[t]=n},t,e,arguments.length)}}),E.each([\"top\",\"left\"],function(e,n){E.cssHooks[n]=Qe(b.pixelPosition,function(e,t){if(t)return t=Ke(e,n),Je.test(t)?E(e).position()[n]+\"px\":t})}),E.each({Height:\"height\",Width:\"width\"},function(a,s){E.each({padding:\"inner\"+a,content:s,\"\":\"outer\"+a},function(r,o){E.fn[o]=function(e,t){var n=arguments.length&&(r||\"boolean\"!=typeof e),i=r||(!0===e||!0===t?\"margin\":\"border\");return $(this,function(e,t,n){var r;return v(e)?0===o.indexOf(\"outer\")?e[\"inner\"+a]:e.document.documentElement[\"client\"+a]:9===e.nodeType?(r=e.documentElement,Math.max(e.body[\"scroll\"+a],r[\"scroll\"+a],e.body[\"offset\"+a],r[\"offset\"+a],r[\"client\"+a])):void 0===n?E.css(e,t,i):E.style(e,t,n,i)},s,n?e:void 0,n)}})}),E.each([\"ajaxStart\",\"ajaxStop\",\"ajaxComplete\",\"ajaxError\",\"ajaxSuccess\",\"ajaxSend\"],function(e,t){E.fn[t]=function(e){return this.on(t,e)}}),E.fn.extend({bind:function(e,t,n){return this.on(e,null,t,n)},unbind:function(e,t){return this.off(e,null,t)},delegate:function(e,t,n,r){return this.on(t,e,n,r)},undelegate:function(e,t,n){return 1===arguments.length?this.off(e,\"**\"):this.off(t,e||\"**\",n)},hover:function(e,t){return this.mouseenter(e).mouseleave(t||e)}}),E.each(\"blur focus focusin focusout resize scroll click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave change select submit keydown keypress keyup contextmenu\".split(\" \"),function(e,n){E.fn[n]=function(e,t){return 0<arguments.length?this.on(n,null,e,t):this.trigger(n)}});var on=/^[\\s\\uFEFF\\xA0]+|[\\s\\uFEFF\\xA0]+$/g;E.proxy=function(e,t){var n,r,i;if(\"string\"==typeof t&&(n=e[t],t=e,e=n),y(e))return r=s.call(arguments,2),(i=function(){return e.apply(t||this,r.concat(s.call(arguments)))}).guid=e.guid=e.guid||E.guid++,i},E.holdReady=function(e){e?E.readyWait++:E.ready(!0)},E.isArray=Array.isArray,E.parseJSON=JSON.parse,E.nodeName=N,E.isFunction=y,E.isWindow=v,E.camelCase=J,E.type=x,E.now=Date.now,E.isNumeric=function(e){var t=E.type(e);return(\"number\"===t||\"string\"===t)&&!isNaN(e-parseFloat(e))},E.trim=function(e){return null==e?\"\":(e+\"\").replace(on,\"\")},\"function\"==typeof define&&define.amd&&define(\"jquery\",[],function(){return E});var an=T.jQuery,sn=T.$;return E.noConflict=function(e){return T.$===E&&(T.$=sn),e&&T.jQuery===E&&(T.jQuery=an),E},void 0===e&&(T.jQuery=T.$=E),E}),function(ye){var e,we=this||(0,eval)(\"this\"),xe=we.document,Ce=we.navigator,Te=we.jQuery,ke=we.JSON;Te||\"undefined\"==typeof jQuery||(Te=jQuery),e=function(e,r){function n(e,t){return(null===e||_typeof(e)in T)&&e===t}function o(e,t){var n;return function(){n=n||_.a.setTimeout(function(){n=ye,e()},t)}}function a(e,t){var n;return function(){clearTimeout(n),n=_.a.setTimeout(e,t)}}function c(e,t){t&&\"change\"!==t?\"beforeChange\"===t?this.oc(e):this.bb(e,t):this.pc(e)}function i(e,t){null!==t&&t.s&&t.s()}function s(e,t){var n=this.pd,r=n[M];r.qa||(this.Pb&&this.kb[t]?(n.tc(t,e,this.kb[t]),this.kb[t]=null,--this.Pb):r.F[t]||n.tc(t,e,r.G?{da:e}:n.Zc(e)),e.Ka&&e.fd())}var u,t,l,f,d,p,h,v,g,m,b,y,w,_=void 0!==e?e:{};function x(){if(b)for(var e,t=b,n=0;w<b;)if(e=m[w++]){if(t<w){if(5e3<=++n){w=b,_.a.Fc(Error(\"'Too much recursion' after processing \"+n+\" task groups.\"));break}t=b}try{e()}catch(e){_.a.Fc(e)}}}function C(){x(),w=b=m.length=0}_.b=function(e,t){for(var n=e.split(\".\"),r=_,i=0;i<n.length-1;i++)r=r[n[i]];r[n[n.length-1]]=t},_.J=function(e,t,n){e[t]=n},_.version=\"3.5.0\",_.b(\"version\",_.version),_.options={deferUpdates:!1,useOnlyNativeEvents:!1,foreachHidesDestroyed:!1},_.a=function(){function f(e,t){for(var n in e)o.call(e,n)&&t(n,e[n])}function e(e,t){if(t)for(var n in t)o.call(t,n)&&(e[n]=t[n]);return e}function t(e,t){return e.__proto__=t,e}function i(e,t,n,r){var i=e[t].match(p)||[];_.a.C(n.match(p),function(e){_.a.Oa(i,e,r)}),e[t]=i.join(\" \")}var o=Object.prototype.hasOwnProperty,n={__proto__:[]}instanceof Array,r=\"function\"==typeof Symbol,a={},s={};a[Ce&&/Firefox\\/2/i.test(Ce.userAgent)?\"KeyboardEvent\":\"UIEvents\"]=[\"keyup\",\"keydown\",\"keypress\"],a.MouseEvents=\"click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave\".split(\" \"),f(a,function(e,t){if(t.length)for(var n=0,r=t.length;n<r;n++)s[t[n]]=e});var u,c,l={propertychange:!0},d=xe&&function(){for(var e=3,t=xe.createElement(\"div\"),n=t.getElementsByTagName(\"i\");t.innerHTML=\"\\x3c!--[if gt IE \"+ ++e+\"]><i></i><![endif]--\\x3e\",n[0];);return 4<e?e:ye}(),p=/\\S+/g;return{Ic:[\"authenticity_token\",/^__RequestVerificationToken(_.*)?$/],C:function(e,t,n){for(var r=0,i=e.length;r<i;r++)t.call(n,e[r],r,e)},A:\"function\"==typeof Array.prototype.indexOf?function(e,t){return Array.prototype.indexOf.call(e,t)}:function(e,t){for(var n=0,r=e.length;n<r;n++)if(e[n]===t)return n;return-1},Lb:function(e,t,n){for(var r=0,i=e.length;r<i;r++)if(t.call(n,e[r],r,e))return e[r];return ye},hb:function(e,t){var n=_.a.A(e,t);0<n?e.splice(n,1):0===n&&e.shift()},vc:function(e){var t=[];return e&&_.a.C(e,function(e){_.a.A(t,e)<0&&t.push(e)}),t},Mb:function(e,t,n){var r=[];if(e)for(var i=0,o=e.length;i<o;i++)r.push(t.call(n,e[i],i));return r},fb:function(e,t,n){var r=[];if(e)for(var i=0,o=e.length;i<o;i++)t.call(n,e[i],i)&&r.push(e[i]);return r},gb:function(e,t){if(t instanceof Array)e.push.apply(e,t);else for(var n=0,r=t.length;n<r;n++)e.push(t[n]);return e},Oa:function(e,t,n){var r=_.a.A(_.a.$b(e),t);r<0?n&&e.push(t):n||e.splice(r,1)},Ba:n,extend:e,setPrototypeOf:t,zb:n?t:e,O:f,Ha:function(e,t,n){if(!e)return e;var r,i={};for(r in e)o.call(e,r)&&(i[r]=t.call(n,e[r],r,e));return i},Sb:function(e){for(;e.firstChild;)_.removeNode(e.firstChild)},Xb:function(e){for(var t=((e=_.a.la(e))[0]&&e[0].ownerDocument||xe).createElement(\"div\"),n=0,r=e.length;n<r;n++)t.appendChild(_.na(e[n]));return t},Ca:function(e,t){for(var n=0,r=e.length,i=[];n<r;n++){var o=e[n].cloneNode(!0);i.push(t?_.na(o):o)}return i},ua:function(e,t){if(_.a.Sb(e),t)for(var n=0,r=t.length;n<r;n++)e.appendChild(t[n])},Wc:function(e,t){var n=e.nodeType?[e]:e;if(0<n.length){for(var r=n[0],i=r.parentNode,o=0,a=t.length;o<a;o++)i.insertBefore(t[o],r);for(o=0,a=n.length;o<a;o++)_.removeNode(n[o])}},Ua:function(e,t){if(e.length){for(t=8===t.nodeType&&t.parentNode||t;e.length&&e[0].parentNode!==t;)e.splice(0,1);for(;1<e.length&&e[e.length-1].parentNode!==t;)e.length--;if(1<e.length){var n=e[0],r=e[e.length-1];for(e.length=0;n!==r;)e.push(n),n=n.nextSibling;e.push(r)}}return e},Yc:function(e,t){d<7?e.setAttribute(\"selected\",t):e.selected=t},Cb:function(e){return null===e||e===ye?\"\":e.trim?e.trim():e.toString().replace(/^[\\s\\xa0]+|[\\s\\xa0]+$/g,\"\")},Td:function(e,t){return e=e||\"\",!(t.length>e.length)&&e.substring(0,t.length)===t},ud:function(e,t){if(e===t)return!0;if(11===e.nodeType)return!1;if(t.contains)return t.contains(1!==e.nodeType?e.parentNode:e);if(t.compareDocumentPosition)return 16==(16&t.compareDocumentPosition(e));for(;e&&e!=t;)e=e.parentNode;return!!e},Rb:function(e){return _.a.ud(e,e.ownerDocument.documentElement)},jd:function(e){return!!_.a.Lb(e,_.a.Rb)},P:function(e){return e&&e.tagName&&e.tagName.toLowerCase()},zc:function(e){return _.onError?function(){try{return e.apply(this,arguments)}catch(e){throw _.onError&&_.onError(e),e}}:e},setTimeout:(c=function(e,t){return setTimeout(_.a.zc(e),t)},h.toString=function(){return c.toString()},h),Fc:function(e){setTimeout(function(){throw _.onError&&_.onError(e),e},0)},H:function(t,e,n){var r=_.a.zc(n);if(n=l[e],_.options.useOnlyNativeEvents||n||!Te)if(n||\"function\"!=typeof t.addEventListener){if(void 0===t.attachEvent)throw Error(\"Browser doesn't support addEventListener or attachEvent\");var i=function(e){r.call(t,e)},o=\"on\"+e;t.attachEvent(o,i),_.a.I.za(t,function(){t.detachEvent(o,i)})}else t.addEventListener(e,r,!1);else u=u||(\"function\"==typeof Te(t).on?\"on\":\"bind\"),Te(t)[u](e,r)},Fb:function(e,t){if(!e||!e.nodeType)throw Error(\"element must be a DOM node when calling triggerEvent\");var n;if(n=!(\"input\"!==_.a.P(e)||!e.type||\"click\"!=t.toLowerCase()||\"checkbox\"!=(n=e.type)&&\"radio\"!=n),_.options.useOnlyNativeEvents||!Te||n)if(\"function\"==typeof xe.createEvent){if(\"function\"!=typeof e.dispatchEvent)throw Error(\"The supplied element doesn't support dispatchEvent\");(n=xe.createEvent(s[t]||\"HTMLEvents\")).initEvent(t,!0,!0,we,0,0,0,0,0,!1,!1,!1,!1,0,e),e.dispatchEvent(n)}else if(n&&e.click)e.click();else{if(void 0===e.fireEvent)throw Error(\"Browser doesn't support triggering events\");e.fireEvent(\"on\"+t)}else Te(e).trigger(t)},c:function(e){return _.N(e)?e():e},$b:function(e){return _.N(e)?e.w():e},Eb:function(t,e,n){var r;e&&(\"object\"===_typeof(t.classList)?(r=t.classList[n?\"add\":\"remove\"],_.a.C(e.match(p),function(e){r.call(t.classList,e)})):\"string\"==typeof t.className.baseVal?i(t.className,\"baseVal\",e,n):i(t,\"className\",e,n))},Ab:function(e,t){var n=_.a.c(t);null!==n&&n!==ye||(n=\"\");var r=_.h.firstChild(e);!r||3!=r.nodeType||_.h.nextSibling(r)?_.h.ua(e,[e.ownerDocument.createTextNode(n)]):r.data=n,_.a.zd(e)},Xc:function(e,t){if(e.name=t,d<=7)try{var n=e.name.replace(/[&<>'\"]/g,function(e){return\"&#\"+e.charCodeAt(0)+\";\"});e.mergeAttributes(xe.createElement(\"<input name='\"+n+\"'/>\"),!1)}catch(e){}},zd:function(e){9<=d&&(e=1==e.nodeType?e:e.parentNode).style&&(e.style.zoom=e.style.zoom)},vd:function(e){if(d){var t=e.style.width;e.style.width=0,e.style.width=t}},Od:function(e,t){e=_.a.c(e),t=_.a.c(t);for(var n=[],r=e;r<=t;r++)n.push(r);return n},la:function(e){for(var t=[],n=0,r=e.length;n<r;n++)t.push(e[n]);return t},Da:function(e){return r?Symbol(e):e},Xd:6===d,Yd:7===d,W:d,Kc:function(e,t){for(var n=_.a.la(e.getElementsByTagName(\"input\")).concat(_.a.la(e.getElementsByTagName(\"textarea\"))),r=\"string\"==typeof t?function(e){return e.name===t}:function(e){return t.test(e.name)},i=[],o=n.length-1;0<=o;o--)r(n[o])&&i.push(n[o]);return i},Md:function(e){return\"string\"==typeof e&&(e=_.a.Cb(e))?ke&&ke.parse?ke.parse(e):new Function(\"return \"+e)():null},fc:function(e,t,n){if(!ke||!ke.stringify)throw Error(\"Cannot find JSON.stringify(). Some browsers (e.g., IE < 8) don't support it natively, but you can overcome this by adding a script reference to json2.js, downloadable from http://www.json.org/json2.js\");return ke.stringify(_.a.c(e),t,n)},Nd:function(e,t,n){var r=(n=n||{}).params||{},i=n.includeFields||this.Ic,o=e;if(\"object\"==_typeof(e)&&\"form\"===_.a.P(e)){o=e.action;for(var a=i.length-1;0<=a;a--)for(var s=_.a.Kc(e,i[a]),u=s.length-1;0<=u;u--)r[s[u].name]=s[u].value}t=_.a.c(t);var c=xe.createElement(\"form\");for(var l in c.style.display=\"none\",c.action=o,c.method=\"post\",t)(e=xe.createElement(\"input\")).type=\"hidden\",e.name=l,e.value=_.a.fc(_.a.c(t[l])),c.appendChild(e);f(r,function(e,t){var n=xe.createElement(\"input\");n.type=\"hidden\",n.name=e,n.value=t,c.appendChild(n)}),xe.body.appendChild(c),n.submitter?n.submitter(c):c.submit(),setTimeout(function(){c.parentNode.removeChild(c)},0)}};function h(e,t){return c.apply(this,arguments)}}(),_.b(\"utils\",_.a),_.b(\"utils.arrayForEach\",_.a.C),_.b(\"utils.arrayFirst\",_.a.Lb),_.b(\"utils.arrayFilter\",_.a.fb),_.b(\"utils.arrayGetDistinctValues\",_.a.vc),_.b(\"utils.arrayIndexOf\",_.a.A),_.b(\"utils.arrayMap\",_.a.Mb),_.b(\"utils.arrayPushAll\",_.a.gb),_.b(\"utils.arrayRemoveItem\",_.a.hb),_.b(\"utils.cloneNodes\",_.a.Ca),_.b(\"utils.createSymbolOrString\",_.a.Da),_.b(\"utils.extend\",_.a.extend),_.b(\"utils.fieldsIncludedWithJsonPost\",_.a.Ic),_.b(\"utils.getFormFields\",_.a.Kc),_.b(\"utils.objectMap\",_.a.Ha),_.b(\"utils.peekObservable\",_.a.$b),_.b(\"utils.postJson\",_.a.Nd),_.b(\"utils.parseJson\",_.a.Md),_.b(\"utils.registerEventHandler\",_.a.H),_.b(\"utils.stringifyJson\",_.a.fc),_.b(\"utils.range\",_.a.Od),_.b(\"utils.toggleDomNodeCssClass\",_.a.Eb),_.b(\"utils.triggerEvent\",_.a.Fb),_.b(\"utils.unwrapObservable\",_.a.c),_.b(\"utils.objectForEach\",_.a.O),_.b(\"utils.addOrRemoveItem\",_.a.Oa),_.b(\"utils.setTextContent\",_.a.Ab),_.b(\"unwrap\",_.a.c),Function.prototype.bind||(Function.prototype.bind=function(t){var n=this;if(1===arguments.length)return function(){return n.apply(t,arguments)};var r=Array.prototype.slice.call(arguments,1);return function(){var e=r.slice(0);return e.push.apply(e,arguments),n.apply(t,e)}}),_.a.g=new function(){var r,i=0,o=\"__ko__\"+(new Date).getTime(),a={};return{get:function(e,t){var n=r(e,!1);return n&&n[t]},set:function(e,t,n){(e=r(e,n!==ye))&&(e[t]=n)},Tb:function(e,t,n){return(e=r(e,!0))[t]||(e[t]=n)},clear:_.a.W?(r=function(e,t){var n=e[o];if(!n||\"null\"===n||!a[n]){if(!t)return ye;n=e[o]=\"ko\"+i++,a[n]={}}return a[n]},function(e){var t=e[o];return!(!t||(delete a[t],e[o]=null))}):(r=function(e,t){var n=e[o];return!n&&t&&(n=e[o]={}),n},function(e){return!!e[o]&&(delete e[o],!0)}),Z:function(){return i+++o}}},_.b(\"utils.domData\",_.a.g),_.b(\"utils.domData.clear\",_.a.g.clear),_.a.I=new function(){function r(e,t){var n=_.a.g.get(e,a);return n===ye&&t&&(n=[],_.a.g.set(e,a,n)),n}function o(e){if(t=r(e,!1))for(var t=t.slice(0),n=0;n<t.length;n++)t[n](e);_.a.g.clear(e),_.a.I.cleanExternalData(e),s[e.nodeType]&&i(e.childNodes,!0)}function i(e,t){for(var n,r=[],i=0;i<e.length;i++)if((!t||8===e[i].nodeType)&&(o(r[r.length]=n=e[i]),e[i]!==n))for(;i--&&-1==_.a.A(r,e[i]););}var a=_.a.g.Z(),t={1:!0,8:!0,9:!0},s={1:!0,9:!0};return{za:function(e,t){if(\"function\"!=typeof t)throw Error(\"Callback must be a function\");r(e,!0).push(t)},xb:function(e,t){var n=r(e,!1);n&&(_.a.hb(n,t),0==n.length&&_.a.g.set(e,a,ye))},na:function(e){return t[e.nodeType]&&(o(e),s[e.nodeType]&&i(e.getElementsByTagName(\"*\"))),e},removeNode:function(e){_.na(e),e.parentNode&&e.parentNode.removeChild(e)},cleanExternalData:function(e){Te&&\"function\"==typeof Te.cleanData&&Te.cleanData([e])}}},_.na=_.a.I.na,_.removeNode=_.a.I.removeNode,_.b(\"cleanNode\",_.na),_.b(\"removeNode\",_.removeNode),_.b(\"utils.domNodeDisposal\",_.a.I),_.b(\"utils.domNodeDisposal.addDisposeCallback\",_.a.I.za),_.b(\"utils.domNodeDisposal.removeDisposeCallback\",_.a.I.xb),u=[0,\"\",\"\"],d={thead:t=[1,\"<table>\",\"</table>\"],tbody:t,tfoot:t,tr:[2,\"<table><tbody>\",\"</tbody></table>\"],td:l=[3,\"<table><tbody><tr>\",\"</tr></tbody></table>\"],th:l,option:f=[1,\"<select multiple='multiple'>\",\"</select>\"],optgroup:f},p=_.a.W<=8,_.a.ta=function(e,t){var n;if(Te){if(Te.parseHTML)n=Te.parseHTML(e,t)||[];else if((n=Te.clean([e],t))&&n[0]){for(var r=n[0];r.parentNode&&11!==r.parentNode.nodeType;)r=r.parentNode;r.parentNode&&r.parentNode.removeChild(r)}}else{(n=t)||(n=xe),r=n.parentWindow||n.defaultView||we;var i,o=_.a.Cb(e).toLowerCase(),a=n.createElement(\"div\");for(o=(i=(o=o.match(/^(?:\\x3c!--.*?--\\x3e\\s*?)*?<([a-z]+)[\\s>]/))&&d[o[1]]||u)[0],i=\"ignored<div>\"+i[1]+e+i[2]+\"</div>\",\"function\"==typeof r.innerShiv?a.appendChild(r.innerShiv(i)):(p&&n.body.appendChild(a),a.innerHTML=i,p&&a.parentNode.removeChild(a));o--;)a=a.lastChild;n=_.a.la(a.lastChild.childNodes)}return n},_.a.Ld=function(e,t){var n=_.a.ta(e,t);return n.length&&n[0].parentElement||_.a.Xb(n)},_.a.dc=function(e,t){if(_.a.Sb(e),null!==(t=_.a.c(t))&&t!==ye)if(\"string\"!=typeof t&&(t=t.toString()),Te)Te(e).html(t);else for(var n=_.a.ta(t,e.ownerDocument),r=0;r<n.length;r++)e.appendChild(n[r])},_.b(\"utils.parseHtmlFragment\",_.a.ta),_.b(\"utils.setHtml\",_.a.dc),_.aa=(h={},{Wb:function(e){if(\"function\"!=typeof e)throw Error(\"You can only pass a function to ko.memoization.memoize()\");var t=(4294967296*(1+Math.random())|0).toString(16).substring(1)+(4294967296*(1+Math.random())|0).toString(16).substring(1);return h[t]=e,\"\\x3c!--[ko_memo:\"+t+\"]--\\x3e\"},ad:function(e,t){var n=h[e];if(n===ye)throw Error(\"Couldn't find any memo with ID \"+e+\". Perhaps it's already been unmemoized.\");try{return n.apply(null,t||[]),!0}finally{delete h[e]}},bd:function(e,t){var n=[];!function e(t,n){if(t)if(8==t.nodeType)null!=(r=_.aa.Tc(t.nodeValue))&&n.push({sd:t,Jd:r});else if(1==t.nodeType)for(var r=0,i=t.childNodes,o=i.length;r<o;r++)e(i[r],n)}(e,n);for(var r=0,i=n.length;r<i;r++){var o=n[r].sd,a=[o];t&&_.a.gb(a,t),_.aa.ad(n[r].Jd,a),o.nodeValue=\"\",o.parentNode&&o.parentNode.removeChild(o)}},Tc:function(e){return(e=e.match(/^\\[ko_memo\\:(.*?)\\]$/))?e[1]:null}}),_.b(\"memoization\",_.aa),_.b(\"memoization.memoize\",_.aa.Wb),_.b(\"memoization.unmemoize\",_.aa.ad),_.b(\"memoization.parseMemoText\",_.aa.Tc),_.b(\"memoization.unmemoizeDomNodeAndDescendants\",_.aa.bd),_.ma=(m=[],y=1,w=b=0,{scheduler:we.MutationObserver?(v=C,g=xe.createElement(\"div\"),new MutationObserver(v).observe(g,{attributes:!0}),function(){g.classList.toggle(\"foo\")}):xe&&\"onreadystatechange\"in xe.createElement(\"script\")?function(e){var t=xe.createElement(\"script\");t.onreadystatechange=function(){t.onreadystatechange=null,xe.documentElement.removeChild(t),t=null,e()},xe.documentElement.appendChild(t)}:function(e){setTimeout(e,0)},yb:function(e){return b||_.ma.scheduler(C),m[b++]=e,y++},cancel:function(e){w<=(e-=y-b)&&e<b&&(m[e]=null)},resetForTesting:function(){var e=b-w;return w=b=m.length=0,e},Rd:x}),_.b(\"tasks\",_.ma),_.b(\"tasks.schedule\",_.ma.yb),_.b(\"tasks.runEarly\",_.ma.Rd),_.Ta={throttle:function(t,n){t.throttleEvaluation=n;var r=null;return _.$({read:t,write:function(e){clearTimeout(r),r=_.a.setTimeout(function(){t(e)},n)}})},rateLimit:function(e,t){var n,r,i;\"number\"==typeof t?n=t:(n=t.timeout,r=t.method),e.Hb=!1,i=\"function\"==typeof r?r:\"notifyWhenChangesStop\"==r?a:o,e.tb(function(e){return i(e,n,t)})},deferred:function(r,e){if(!0!==e)throw Error(\"The 'deferred' extender only accepts the value 'true', because it is not supported to turn deferral off once enabled.\");r.Hb||(r.Hb=!0,r.tb(function(e){var t,n=!1;return function(){if(!n){_.ma.cancel(t),t=_.ma.yb(e);try{n=!0,r.notifySubscribers(ye,\"dirty\")}finally{n=!1}}}}))},notify:function(e,t){e.equalityComparer=\"always\"==t?null:n}};var T={undefined:1,boolean:1,number:1,string:1};_.b(\"extenders\",_.Ta),_.gc=function(e,t,n){this.da=e,this.kc=t,this.lc=n,this.Ib=!1,this.ab=this.Jb=null,_.J(this,\"dispose\",this.s),_.J(this,\"disposeWhenNodeIsRemoved\",this.l)},_.gc.prototype.s=function(){this.Ib||(this.ab&&_.a.I.xb(this.Jb,this.ab),this.Ib=!0,this.lc(),this.da=this.kc=this.lc=this.Jb=this.ab=null)},_.gc.prototype.l=function(e){this.Jb=e,_.a.I.za(e,this.ab=this.s.bind(this))},_.R=function(){_.a.zb(this,N),N.ob(this)};var k,E,S,N={ob:function(e){e.S={change:[]},e.rc=1},subscribe:function(e,t,n){var r=this;n=n||\"change\";var i=new _.gc(r,t?e.bind(t):e,function(){_.a.hb(r.S[n],i),r.cb&&r.cb(n)});return r.Qa&&r.Qa(n),r.S[n]||(r.S[n]=[]),r.S[n].push(i),i},notifySubscribers:function(e,t){if(\"change\"===(t=t||\"change\")&&this.Gb(),this.Wa(t)){var n=\"change\"===t&&this.dd||this.S[t].slice(0);try{_.v.wc();for(var r,i=0;r=n[i];++i)r.Ib||r.kc(e)}finally{_.v.end()}}},mb:function(){return this.rc},Cd:function(e){return this.mb()!==e},Gb:function(){++this.rc},tb:function(e){var n,t,r,i,o,a=this,s=_.N(a);a.bb||(a.bb=a.notifySubscribers,a.notifySubscribers=c);var u=e(function(){a.Ka=!1,s&&i===a&&(i=a.mc?a.mc():a());var e=t||o&&a.qb(r,i);o=t=n=!1,e&&a.bb(r=i)});a.pc=function(e,t){t&&a.Ka||(o=!t),a.dd=a.S.change.slice(0),a.Ka=n=!0,i=e,u()},a.oc=function(e){n||(r=e,a.bb(e,\"beforeChange\"))},a.qc=function(){o=!0},a.fd=function(){a.qb(r,a.w(!0))&&(t=!0)}},Wa:function(e){return this.S[e]&&this.S[e].length},Ad:function(e){if(e)return this.S[e]&&this.S[e].length||0;var n=0;return _.a.O(this.S,function(e,t){\"dirty\"!==e&&(n+=t.length)}),n},qb:function(e,t){return!this.equalityComparer||!this.equalityComparer(e,t)},toString:function(){return\"[object Object]\"},extend:function(e){var r=this;return e&&_.a.O(e,function(e,t){var n=_.Ta[e];\"function\"==typeof n&&(r=n(r,t)||r)}),r}};function A(e){E.push(k),k=e}function D(){k=E.pop()}_.J(N,\"init\",N.ob),_.J(N,\"subscribe\",N.subscribe),_.J(N,\"extend\",N.extend),_.J(N,\"getSubscriptionsCount\",N.Ad),_.a.Ba&&_.a.setPrototypeOf(N,Function.prototype),_.R.fn=N,_.Pc=function(e){return null!=e&&\"function\"==typeof e.subscribe&&\"function\"==typeof e.notifySubscribers},_.b(\"subscribable\",_.R),_.b(\"isSubscribable\",_.Pc),_.U=_.v=(E=[],S=0,{wc:A,end:D,ac:function(e){if(k){if(!_.Pc(e))throw Error(\"Only subscribable things can act as dependencies\");k.nd.call(k.od,e,e.ed||(e.ed=++S))}},K:function(e,t,n){try{return A(),e.apply(t,n||[])}finally{D()}},pa:function(){if(k)return k.o.pa()},Va:function(){if(k)return k.o.Va()},rb:function(){if(k)return k.rb},o:function(){if(k)return k.o}}),_.b(\"computedContext\",_.U),_.b(\"computedContext.getDependenciesCount\",_.U.pa),_.b(\"computedContext.getDependencies\",_.U.Va),_.b(\"computedContext.isInitial\",_.U.rb),_.b(\"computedContext.registerDependency\",_.U.ac),_.b(\"ignoreDependencies\",_.Wd=_.v.K);var O=_.a.Da(\"_latestValue\");_.sa=function(e){function t(){return 0<arguments.length?(t.qb(t[O],arguments[0])&&(t.xa(),t[O]=arguments[0],t.wa()),this):(_.v.ac(t),t[O])}return t[O]=e,_.a.Ba||_.a.extend(t,_.R.fn),_.R.fn.ob(t),_.a.zb(t,j),_.options.deferUpdates&&_.Ta.deferred(t,!0),t};var j={equalityComparer:n,w:function(){return this[O]},wa:function(){this.notifySubscribers(this[O],\"spectate\"),this.notifySubscribers(this[O])},xa:function(){this.notifySubscribers(this[O],\"beforeChange\")}};_.a.Ba&&_.a.setPrototypeOf(j,_.R.fn);var q=_.sa.Na=\"__ko_proto__\";j[q]=_.sa,_.N=function(e){if((e=\"function\"==typeof e&&e[q])&&e!==j[q]&&e!==_.o.fn[q])throw Error(\"Invalid object that looks like an observable; possibly from another Knockout instance\");return!!e},_.Ya=function(e){return\"function\"==typeof e&&(e[q]===j[q]||e[q]===_.o.fn[q]&&e.Mc)},_.b(\"observable\",_.sa),_.b(\"isObservable\",_.N),_.b(\"isWriteableObservable\",_.Ya),_.b(\"isWritableObservable\",_.Ya),_.b(\"observable.fn\",j),_.J(j,\"peek\",j.w),_.J(j,\"valueHasMutated\",j.wa),_.J(j,\"valueWillMutate\",j.xa),_.Ia=function(e){if(\"object\"!=_typeof(e=e||[])||!(\"length\"in e))throw Error(\"The argument passed when initializing an observable array must be an array, or null, or undefined.\");return e=_.sa(e),_.a.zb(e,_.Ia.fn),e.extend({trackArrayChanges:!0})},_.Ia.fn={remove:function(t){for(var e=this.w(),n=[],r=\"function\"!=typeof t||_.N(t)?function(e){return e===t}:t,i=0;i<e.length;i++){var o=e[i];if(r(o)){if(0===n.length&&this.xa(),e[i]!==o)throw Error(\"Array modified during remove; cannot remove item\");n.push(o),e.splice(i,1),i--}}return n.length&&this.wa(),n},removeAll:function(t){if(t!==ye)return t?this.remove(function(e){return 0<=_.a.A(t,e)}):[];var e=this.w(),n=e.slice(0);return this.xa(),e.splice(0,e.length),this.wa(),n},destroy:function(t){var e=this.w(),n=\"function\"!=typeof t||_.N(t)?function(e){return e===t}:t;this.xa();for(var r=e.length-1;0<=r;r--){var i=e[r];n(i)&&(i._destroy=!0)}this.wa()},destroyAll:function(t){return t===ye?this.destroy(function(){return!0}):t?this.destroy(function(e){return 0<=_.a.A(t,e)}):[]},indexOf:function(e){var t=this();return _.a.A(t,e)},replace:function(e,t){var n=this.indexOf(e);0<=n&&(this.xa(),this.w()[n]=t,this.wa())},sorted:function(e){var t=this().slice(0);return e?t.sort(e):t.sort()},reversed:function(){return this().slice(0).reverse()}},_.a.Ba&&_.a.setPrototypeOf(_.Ia.fn,_.sa.fn),_.a.C(\"pop push reverse shift sort splice unshift\".split(\" \"),function(n){_.Ia.fn[n]=function(){var e=this.w();this.xa(),this.yc(e,n,arguments);var t=e[n].apply(e,arguments);return this.wa(),t===e?this:t}}),_.a.C([\"slice\"],function(t){_.Ia.fn[t]=function(){var e=this();return e[t].apply(e,arguments)}}),_.Oc=function(e){return _.N(e)&&\"function\"==typeof e.remove&&\"function\"==typeof e.push},_.b(\"observableArray\",_.Ia),_.b(\"isObservableArray\",_.Oc),_.Ta.trackArrayChanges=function(n,e){if(n.Nb={},e&&\"object\"==_typeof(e)&&_.a.extend(n.Nb,e),n.Nb.sparse=!0,!n.yc){var t,r,i,f=!1,d=null,p=0,o=n.Qa,a=n.cb;n.Qa=function(e){o&&o.call(n,e),\"arrayChange\"===e&&function(){function e(){if(p){var e,t=[].concat(n.w()||[]);n.Wa(\"arrayChange\")&&((!d||1<p)&&(d=_.a.Ob(r,t,n.Nb)),e=d),r=t,d=null,p=0,e&&e.length&&n.notifySubscribers(e,\"arrayChange\")}}f?e():(f=!0,i=n.notifySubscribers,n.notifySubscribers=function(e,t){return t&&\"change\"!==t||++p,i.apply(this,arguments)},r=[].concat(n.w()||[]),d=null,t=n.subscribe(e))}()},n.cb=function(e){a&&a.call(n,e),\"arrayChange\"!==e||n.Wa(\"arrayChange\")||(i&&(n.notifySubscribers=i,i=ye),t&&t.s(),t=null,f=!1,r=ye)},n.yc=function(e,t,n){function r(e,t,n){return i[i.length]={status:e,value:t,index:n}}if(f&&!p){var i=[],o=e.length,a=n.length,s=0;switch(t){case\"push\":s=o;case\"unshift\":for(t=0;t<a;t++)r(\"added\",n[t],s+t);break;case\"pop\":s=o-1;case\"shift\":o&&r(\"deleted\",e[s],s);break;case\"splice\":t=Math.min(Math.max(0,n[0]<0?o+n[0]:n[0]),o),o=1===a?o:Math.min(t+(n[1]||0),o),a=t+a-2,s=Math.max(o,a);for(var u=[],c=[],l=2;t<s;++t,++l)t<o&&c.push(r(\"deleted\",e[t],t)),t<a&&u.push(r(\"added\",n[l],t));_.a.Jc(c,u);break;default:return}d=i}}}};var M=_.a.Da(\"_state\");_.o=_.$=function(e,t,n){function r(){if(0<arguments.length){if(\"function\"!=typeof i)throw Error(\"Cannot write a value to a ko.computed unless you specify a 'write' option. If you wish to read the current value, don't pass any parameters.\");return i.apply(o.lb,arguments),this}return o.qa||_.v.ac(r),(o.ka||o.G&&r.Xa())&&r.ha(),o.X}if(\"object\"===_typeof(e)?n=e:(n=n||{},e&&(n.read=e)),\"function\"!=typeof n.read)throw Error(\"Pass a function that returns the value of the ko.computed\");var i=n.write,o={X:ye,ra:!0,ka:!0,pb:!1,hc:!1,qa:!1,vb:!1,G:!1,Vc:n.read,lb:t||n.owner,l:n.disposeWhenNodeIsRemoved||n.l||null,Sa:n.disposeWhen||n.Sa,Qb:null,F:{},V:0,Hc:null};return r[M]=o,r.Mc=\"function\"==typeof i,_.a.Ba||_.a.extend(r,_.R.fn),_.R.fn.ob(r),_.a.zb(r,L),n.pure?(o.vb=!0,o.G=!0,_.a.extend(r,P)):n.deferEvaluation&&_.a.extend(r,R),_.options.deferUpdates&&_.Ta.deferred(r,!0),o.l&&(o.hc=!0,o.l.nodeType||(o.l=null)),o.G||n.deferEvaluation||r.ha(),o.l&&r.ja()&&_.a.I.za(o.l,o.Qb=function(){r.s()}),r};var L={equalityComparer:n,pa:function(){return this[M].V},Va:function(){var n=[];return _.a.O(this[M].F,function(e,t){n[t.La]=t.da}),n},Ub:function(t){if(!this[M].V)return!1;var e=this.Va();return-1!==_.a.A(e,t)||!!_.a.Lb(e,function(e){return e.Ub&&e.Ub(t)})},tc:function(e,t,n){if(this[M].vb&&t===this)throw Error(\"A 'pure' computed must not be called recursively\");(this[M].F[e]=n).La=this[M].V++,n.Ma=t.mb()},Xa:function(){var e,t,n=this[M].F;for(e in n)if(Object.prototype.hasOwnProperty.call(n,e)&&(t=n[e],this.Ja&&t.da.Ka||t.da.Cd(t.Ma)))return!0},Id:function(){this.Ja&&!this[M].pb&&this.Ja(!1)},ja:function(){var e=this[M];return e.ka||0<e.V},Qd:function(){this.Ka?this[M].ka&&(this[M].ra=!0):this.Gc()},Zc:function(e){if(e.Hb){var t=e.subscribe(this.Id,this,\"dirty\"),n=e.subscribe(this.Qd,this);return{da:e,s:function(){t.s(),n.s()}}}return e.subscribe(this.Gc,this)},Gc:function(){var e=this,t=e.throttleEvaluation;t&&0<=t?(clearTimeout(this[M].Hc),this[M].Hc=_.a.setTimeout(function(){e.ha(!0)},t)):e.Ja?e.Ja(!0):e.ha(!0)},ha:function(e){var t=this[M],n=t.Sa,r=!1;if(!t.pb&&!t.qa){if(t.l&&!_.a.Rb(t.l)||n&&n()){if(!t.hc)return void this.s()}else t.hc=!1;t.pb=!0;try{r=this.yd(e)}finally{t.pb=!1}return r}},yd:function(e){var t=this[M],n=!1,r=t.vb?ye:!t.V;n={pd:this,kb:t.F,Pb:t.V},_.v.wc({od:n,nd:s,o:this,rb:r}),t.F={},t.V=0;var i=this.xd(t,n);return(n=t.V?this.qb(t.X,i):(this.s(),!0))&&(t.G?this.Gb():this.notifySubscribers(t.X,\"beforeChange\"),t.X=i,this.notifySubscribers(t.X,\"spectate\"),!t.G&&e&&this.notifySubscribers(t.X),this.qc&&this.qc()),r&&this.notifySubscribers(t.X,\"awake\"),n},xd:function(e,t){try{var n=e.Vc;return e.lb?n.call(e.lb):n()}finally{_.v.end(),t.Pb&&!e.G&&_.a.O(t.kb,i),e.ra=e.ka=!1}},w:function(e){var t=this[M];return(t.ka&&(e||!t.V)||t.G&&this.Xa())&&this.ha(),t.X},tb:function(e){_.R.fn.tb.call(this,e),this.mc=function(){return this[M].G||(this[M].ra?this.ha():this[M].ka=!1),this[M].X},this.Ja=function(e){this.oc(this[M].X),this[M].ka=!0,e&&(this[M].ra=!0),this.pc(this,!e)}},s:function(){var e=this[M];!e.G&&e.F&&_.a.O(e.F,function(e,t){t.s&&t.s()}),e.l&&e.Qb&&_.a.I.xb(e.l,e.Qb),e.F=ye,e.V=0,e.qa=!0,e.ra=!1,e.ka=!1,e.G=!1,e.l=ye,e.Sa=ye,e.Vc=ye,this.Mc||(e.lb=ye)}},P={Qa:function(e){var i=this,o=i[M];if(!o.qa&&o.G&&\"change\"==e){if(o.G=!1,o.ra||i.Xa())o.F=null,o.V=0,i.ha()&&i.Gb();else{var n=[];_.a.O(o.F,function(e,t){n[t.La]=e}),_.a.C(n,function(e,t){var n=o.F[e],r=i.Zc(n.da);r.La=t,r.Ma=n.Ma,o.F[e]=r}),i.Xa()&&i.ha()&&i.Gb()}o.qa||i.notifySubscribers(o.X,\"awake\")}},cb:function(e){var n=this[M];n.qa||\"change\"!=e||this.Wa(\"change\")||(_.a.O(n.F,function(e,t){t.s&&(n.F[e]={da:t.da,La:t.La,Ma:t.Ma},t.s())}),n.G=!0,this.notifySubscribers(ye,\"asleep\"))},mb:function(){var e=this[M];return e.G&&(e.ra||this.Xa())&&this.ha(),_.R.fn.mb.call(this)}},R={Qa:function(e){\"change\"!=e&&\"beforeChange\"!=e||this.w()}};_.a.Ba&&_.a.setPrototypeOf(L,_.R.fn);var B,I,H,F,$,W,V,U,J,z,G,X,Y,K,Q,Z=_.sa.Na;function ee(r,i,o){if(o=o||new te,\"object\"!=_typeof(r=i(r))||null===r||r===ye||r instanceof RegExp||r instanceof Date||r instanceof String||r instanceof Number||r instanceof Boolean)return r;var a=r instanceof Array?[]:{};return o.save(r,a),function(e,t){if(e instanceof Array){for(var n=0;n<e.length;n++)t(n);\"function\"==typeof e.toJSON&&t(\"toJSON\")}else for(n in e)t(n)}(r,function(e){var t=i(r[e]);switch(_typeof(t)){case\"boolean\":case\"number\":case\"string\":case\"function\":a[e]=t;break;case\"object\":case\"undefined\":var n=o.get(t);a[e]=n!==ye?n:ee(t,i,o)}}),a}function te(){this.keys=[],this.values=[]}function ne(e){123===(e=_.a.Cb(e)).charCodeAt(0)&&(e=e.slice(1,-1));var t,n=[],r=(e+=\"\\n,\").match(H),i=[],o=0;if(1<r.length){for(var a,s=0;a=r[s];++s){var u=a.charCodeAt(0);if(44===u){if(o<=0){n.push(t&&i.length?{key:t,value:i.join(\"\")}:{unknown:t||i.join(\"\")}),t=o=0,i=[];continue}}else if(58===u){if(!o&&!t&&1===i.length){t=i.pop();continue}}else{if(47===u&&1<a.length&&(47===a.charCodeAt(1)||42===a.charCodeAt(1)))continue;47===u&&s&&1<a.length?(u=r[s-1].match(F))&&!$[u[0]]&&(r=(e=e.substr(e.indexOf(a)+1)).match(H),s=-1,a=\"/\"):40===u||123===u||91===u?++o:41===u||125===u||93===u?--o:t||i.length||34!==u&&39!==u||(a=a.slice(1,-1))}i.push(a)}if(0<o)throw Error(\"Unbalanced parentheses, braces, or brackets\")}return n}function re(e){return 8==e.nodeType&&U.test(V?e.text:e.nodeValue)}function ie(e){return 8==e.nodeType&&J.test(V?e.text:e.nodeValue)}function oe(e,t){for(var n=e,r=1,i=[];n=n.nextSibling;){if(ie(n)&&(_.a.g.set(n,G,!0),0==--r))return i;i.push(n),re(n)&&r++}if(!t)throw Error(\"Cannot find closing comment tag to match: \"+e.nodeValue);return null}function ae(e,t){var n=oe(e,t);return n?0<n.length?n[n.length-1].nextSibling:e.nextSibling:null}function se(r,e){var i,o=Object.prototype.hasOwnProperty.call(Y,r)?Y[r]:X;o?o.subscribe(e):((o=Y[r]=new _.R).subscribe(e),function(e,n){ue(\"getConfig\",[e],function(t){t?ue(\"loadComponent\",[e,t],function(e){n(e,t)}):n(null,null)})}(r,function(e,t){var n=!(!t||!t.synchronous);K[r]={definition:e,Fd:n},delete Y[r],i||n?o.notifySubscribers(e):_.ma.yb(function(){o.notifySubscribers(e)})}),i=!0)}function ue(t,n,r,i){var e=(i=i||_.i.loaders.slice(0)).shift();if(e){var o=e[t];if(o){var a=!1;if(o.apply(e,n.concat(function(e){a?r(null):null!==e?r(e):ue(t,n,r,i)}))!==X&&(a=!0,!e.suppressLoaderExceptions))throw Error(\"Component loaders must supply values by invoking the callback, not by returning values synchronously.\")}else ue(t,n,r,i)}else r(null)}L[Z]=_.o,_.Nc=function(e){return\"function\"==typeof e&&e[Z]===L[Z]},_.Ed=function(e){return _.Nc(e)&&e[M]&&e[M].vb},_.b(\"computed\",_.o),_.b(\"dependentObservable\",_.o),_.b(\"isComputed\",_.Nc),_.b(\"isPureComputed\",_.Ed),_.b(\"computed.fn\",L),_.J(L,\"peek\",L.w),_.J(L,\"dispose\",L.s),_.J(L,\"isActive\",L.ja),_.J(L,\"getDependenciesCount\",L.pa),_.J(L,\"getDependencies\",L.Va),_.wb=function(e,t){return\"function\"==typeof e?_.o(e,t,{pure:!0}):((e=_.a.extend({},e)).pure=!0,_.o(e,t))},_.b(\"pureComputed\",_.wb),_.$c=function(e){if(0==arguments.length)throw Error(\"When calling ko.toJS, pass the object you want to convert.\");return ee(e,function(e){for(var t=0;_.N(e)&&t<10;t++)e=e();return e})},_.toJSON=function(e,t,n){return e=_.$c(e),_.a.fc(e,t,n)},te.prototype={constructor:te,save:function(e,t){var n=_.a.A(this.keys,e);0<=n?this.values[n]=t:(this.keys.push(e),this.values.push(t))},get:function(e){return 0<=(e=_.a.A(this.keys,e))?this.values[e]:ye}},_.b(\"toJS\",_.$c),_.b(\"toJSON\",_.toJSON),_.Vd=function(r,e,i){function t(t){var e=_.wb(r,i).extend({Ga:\"always\"}),n=e.subscribe(function(e){e&&(n.s(),t(e))});return e.notifySubscribers(e.w()),n}return\"function\"!=typeof Promise||e?t(e.bind(i)):new Promise(t)},_.b(\"when\",_.Vd),_.u={L:function(e){switch(_.a.P(e)){case\"option\":return!0===e.__ko__hasDomDataOptionValue__?_.a.g.get(e,_.f.options.Yb):_.a.W<=7?e.getAttributeNode(\"value\")&&e.getAttributeNode(\"value\").specified?e.value:e.text:e.value;case\"select\":return 0<=e.selectedIndex?_.u.L(e.options[e.selectedIndex]):ye;default:return e.value}},ya:function(e,t,n){switch(_.a.P(e)){case\"option\":\"string\"==typeof t?(_.a.g.set(e,_.f.options.Yb,ye),\"__ko__hasDomDataOptionValue__\"in e&&delete e.__ko__hasDomDataOptionValue__,e.value=t):(_.a.g.set(e,_.f.options.Yb,t),e.__ko__hasDomDataOptionValue__=!0,e.value=\"number\"==typeof t?t:\"\");break;case\"select\":\"\"!==t&&null!==t||(t=ye);for(var r,i=-1,o=0,a=e.options.length;o<a;++o)if((r=_.u.L(e.options[o]))==t||\"\"===r&&t===ye){i=o;break}(n||0<=i||t===ye&&1<e.size)&&(e.selectedIndex=i,6===_.a.W&&_.a.setTimeout(function(){e.selectedIndex=i},0));break;default:null!==t&&t!==ye||(t=\"\"),e.value=t}}},_.b(\"selectExtensions\",_.u),_.b(\"selectExtensions.readValue\",_.u.L),_.b(\"selectExtensions.writeValue\",_.u.ya),_.m=(B=[\"true\",\"false\",\"null\",\"undefined\"],I=/^(?:[$_a-z][$\\w]*|(.+)(\\.\\s*[$_a-z][$\\w]*|\\[.+\\]))$/i,H=RegExp(\"\\\"(?:\\\\\\\\.|[^\\\"])*\\\"|'(?:\\\\\\\\.|[^'])*'|`(?:\\\\\\\\.|[^`])*`|/\\\\*(?:[^*]|\\\\*+[^*/])*\\\\*+/|//.*\\n|/(?:\\\\\\\\.|[^/])+/w*|[^\\\\s:,/][^,\\\"'`{}()/:[\\\\]]*[^\\\\s,\\\"'`{}()/:[\\\\]]|[^\\\\s]\",\"g\"),F=/[\\])\"'A-Za-z0-9_$]+$/,$={in:1,return:1,typeof:1},{Ra:[],va:W={},Zb:ne,ub:function(e,t){function i(e,t){var n;if(!u){var r=_.getBindingHandler(e);if(r&&r.preprocess&&!(t=r.preprocess(t,e,i)))return;(r=W[e])&&(n=t,r=n=!(0<=_.a.A(B,n))&&null!==(r=n.match(I))&&(r[1]?\"Object(\"+r[1]+\")\"+r[2]:n)),r&&a.push(\"'\"+(\"string\"==typeof W[e]?W[e]:e)+\"':function(_z){\"+n+\"=_z}\")}s&&(t=\"function(){return \"+t+\" }\"),o.push(\"'\"+e+\"':\"+t)}var o=[],a=[],s=(t=t||{}).valueAccessors,u=t.bindingParams,n=\"string\"==typeof e?ne(e):e;return _.a.C(n,function(e){i(e.key||e.unknown,e.value)}),a.length&&i(\"_ko_property_writers\",\"{\"+a.join(\",\")+\" }\"),o.join(\",\")},Hd:function(e,t){for(var n=0;n<e.length;n++)if(e[n].key==t)return!0;return!1},$a:function(e,t,n,r,i){e&&_.N(e)?!_.Ya(e)||i&&e.w()===r||e(r):(e=t.get(\"_ko_property_writers\"))&&e[n]&&e[n](r)}}),_.b(\"expressionRewriting\",_.m),_.b(\"expressionRewriting.bindingRewriteValidators\",_.m.Ra),_.b(\"expressionRewriting.parseObjectLiteral\",_.m.Zb),_.b(\"expressionRewriting.preProcessBindings\",_.m.ub),_.b(\"expressionRewriting._twoWayBindings\",_.m.va),_.b(\"jsonExpressionRewriting\",_.m),_.b(\"jsonExpressionRewriting.insertPropertyAccessorsIntoJson\",_.m.ub),V=xe&&\"\\x3c!--test--\\x3e\"===xe.createComment(\"test\").text,U=V?/^\\x3c!--\\s*ko(?:\\s+([\\s\\S]+))?\\s*--\\x3e$/:/^\\s*ko(?:\\s+([\\s\\S]+))?\\s*$/,J=V?/^\\x3c!--\\s*\\/ko\\s*--\\x3e$/:/^\\s*\\/ko\\s*$/,z={ul:!0,ol:!0},G=\"__ko_matchedEndComment__\",_.h={ea:{},childNodes:function(e){return re(e)?oe(e):e.childNodes},Ea:function(e){if(re(e))for(var t=0,n=(e=_.h.childNodes(e)).length;t<n;t++)_.removeNode(e[t]);else _.a.Sb(e)},ua:function(e,t){if(re(e)){_.h.Ea(e);for(var n=e.nextSibling,r=0,i=t.length;r<i;r++)n.parentNode.insertBefore(t[r],n)}else _.a.ua(e,t)},Uc:function(e,t){re(e)?e.parentNode.insertBefore(t,e.nextSibling):e.firstChild?e.insertBefore(t,e.firstChild):e.appendChild(t)},Vb:function(e,t,n){n?re(e)?e.parentNode.insertBefore(t,n.nextSibling):n.nextSibling?e.insertBefore(t,n.nextSibling):e.appendChild(t):_.h.Uc(e,t)},firstChild:function(e){if(re(e))return!e.nextSibling||ie(e.nextSibling)?null:e.nextSibling;if(e.firstChild&&ie(e.firstChild))throw Error(\"Found invalid end comment, as the first child of \"+e);return e.firstChild},nextSibling:function(e){if(re(e)&&(e=ae(e)),e.nextSibling&&ie(e.nextSibling)){var t=e.nextSibling;if(ie(t)&&!_.a.g.get(t,G))throw Error(\"Found end comment without a matching opening comment, as child of \"+e);return null}return e.nextSibling},Bd:re,Ud:function(e){return(e=(V?e.text:e.nodeValue).match(U))?e[1]:null},Rc:function(e){if(z[_.a.P(e)]){var t=e.firstChild;if(t)do{if(1===t.nodeType){var n,r=null;if(n=t.firstChild)do{if(r)r.push(n);else if(re(n)){var i=ae(n,!0);i?n=i:r=[n]}else ie(n)&&(r=[n])}while(n=n.nextSibling);if(n=r)for(r=t.nextSibling,i=0;i<n.length;i++)r?e.insertBefore(n[i],r):e.appendChild(n[i])}}while(t=t.nextSibling)}}},_.b(\"virtualElements\",_.h),_.b(\"virtualElements.allowedBindings\",_.h.ea),_.b(\"virtualElements.emptyNode\",_.h.Ea),_.b(\"virtualElements.insertAfter\",_.h.Vb),_.b(\"virtualElements.prepend\",_.h.Uc),_.b(\"virtualElements.setDomNodeChildren\",_.h.ua),_.ga=function(){this.md={}},_.a.extend(_.ga.prototype,{nodeHasBindings:function(e){switch(e.nodeType){case 1:return null!=e.getAttribute(\"data-bind\")||_.i.getComponentNameForNode(e);case 8:return _.h.Bd(e);default:return!1}},getBindings:function(e,t){var n=(n=this.getBindingsString(e,t))?this.parseBindingsString(n,t,e):null;return _.i.sc(n,e,t,!1)},getBindingAccessors:function(e,t){var n=(n=this.getBindingsString(e,t))?this.parseBindingsString(n,t,e,{valueAccessors:!0}):null;return _.i.sc(n,e,t,!0)},getBindingsString:function(e){switch(e.nodeType){case 1:return e.getAttribute(\"data-bind\");case 8:return _.h.Ud(e);default:return null}},parseBindingsString:function(t,e,n,r){try{var i,o=this.md,a=t+(r&&r.valueAccessors||\"\");if(!(i=o[a])){var s,u=\"with($context){with($data||{}){return{\"+_.m.ub(t,r)+\"}}}\";s=new Function(\"$context\",\"$element\",u),i=o[a]=s}return i(e,n)}catch(e){throw e.message=\"Unable to parse bindings.\\nBindings value: \"+t+\"\\nMessage: \"+e.message,e}}}),_.ga.instance=new _.ga,_.b(\"bindingProvider\",_.ga),function(){function r(e){var t=(e=_.a.g.get(e,b))&&e.M;t&&(e.M=null,t.Sc())}function i(e,t,n){this.node=e,this.xc=t,this.ib=[],this.T=!1,t.M||_.a.I.za(e,r),n&&n.M&&(n.M.ib.push(e),this.Kb=n)}function o(e){return function(){return e}}function p(e){return e()}function a(n){return _.a.Ha(_.v.K(n),function(e,t){return function(){return n()[t]}})}function h(e,t){return a(this.getBindings.bind(this,e,t))}function s(e,t){var n=_.h.firstChild(t);if(n){var r,i=_.ga.instance,o=i.preprocessNode;if(o){for(;r=n;)n=_.h.nextSibling(r),o.call(i,r);n=_.h.firstChild(t)}for(;r=n;)n=_.h.nextSibling(r),u(e,r)}_.j.Ga(t,_.j.T)}function u(e,t){var n=e,r=1===t.nodeType;r&&_.h.Rc(t),(r||_.ga.instance.nodeHasBindings(t))&&(n=c(t,null,e).bindingContextForDescendants),n&&!f[_.a.P(t)]&&s(n,t)}function c(i,e,t){var o,n=_.a.g.Tb(i,b,{}),r=n.gd;if(!e){if(r)throw Error(\"You cannot apply bindings multiple times to the same element.\");n.gd=!0}if(r||(n.context=t),e&&\"function\"!=typeof e)o=e;else{var a=_.ga.instance,s=a.getBindingAccessors||h,u=_.$(function(){return(o=e?e(t,i):s.call(a,i,t))&&(t[v]&&t[v](),t[g]&&t[g]()),o},null,{l:i});o&&u.ja()||(u=null)}var c,l=t;if(o){var f=function(){return _.a.Ha(u?u():o,p)},d=u?function(e){return function(){return p(u()[e])}}:function(e){return o[e]};f.get=function(e){return o[e]&&p(d(e))},f.has=function(e){return e in o},_.j.T in o&&_.j.subscribe(i,_.j.T,function(){var e=(0,o[_.j.T])();if(e){var t=_.h.childNodes(i);t.length&&e(t,_.Dc(t[0]))}}),_.j.oa in o&&(l=_.j.Bb(i,t),_.j.subscribe(i,_.j.oa,function(){var e=(0,o[_.j.oa])();e&&_.h.firstChild(i)&&e(i)})),n=function(r){var i=[],o={},a=[];return _.a.O(r,function t(e){if(!o[e]){var n=_.getBindingHandler(e);n&&(n.after&&(a.push(e),_.a.C(n.after,function(e){if(r[e]){if(-1!==_.a.A(a,e))throw Error(\"Cannot combine the following bindings, because they have a cyclic dependency: \"+a.join(\", \"));t(e)}}),a.length--),i.push({key:e,Lc:n})),o[e]=!0}}),i}(o),_.a.C(n,function(e){var t=e.Lc.init,n=e.Lc.update,r=e.key;if(8===i.nodeType&&!_.h.ea[r])throw Error(\"The binding '\"+r+\"' cannot be used with virtual elements\");try{\"function\"==typeof t&&_.v.K(function(){var e=t(i,d(r),f,l.$data,l);if(e&&e.controlsDescendantBindings){if(c!==ye)throw Error(\"Multiple bindings (\"+c+\" and \"+r+\") are trying to control descendant bindings of the same element. You cannot use these bindings together on the same element.\");c=r}}),\"function\"==typeof n&&_.$(function(){n(i,d(r),f,l.$data,l)},null,{l:i})}catch(e){throw e.message='Unable to process binding \"'+r+\": \"+o[r]+'\"\\nMessage: '+e.message,e}})}return{shouldBindDescendants:n=c===ye,bindingContextForDescendants:n&&l}}function l(e,t){return e&&e instanceof _.fa?e:new _.fa(e,ye,ye,t)}var v=_.a.Da(\"_subscribable\"),d=_.a.Da(\"_ancestorBindingInfo\"),g=_.a.Da(\"_dataDependency\");_.f={};var f={script:!0,textarea:!0,template:!0};_.getBindingHandler=function(e){return _.f[e]};var m={};_.fa=function(e,n,r,i,t){function o(){var e=l?c():c,t=_.a.c(e);return n?(_.a.extend(s,n),d in n&&(s[d]=n[d])):(s.$parents=[],s.$root=t,s.ko=_),s[v]=a,u?t=s.$data:(s.$rawData=e,s.$data=t),r&&(s[r]=t),i&&i(s,n,t),n&&n[v]&&!_.U.o().Ub(n[v])&&n[v](),f&&(s[g]=f),s.$data}var a,s=this,u=e===m,c=u?ye:e,l=\"function\"==typeof c&&!_.N(c),f=t&&t.dataDependency;t&&t.exportDependencies?o():((a=_.wb(o)).w(),a.ja()?a.equalityComparer=null:s[v]=ye)},_.fa.prototype.createChildContext=function(t,n,r,e){if(!e&&n&&\"object\"==_typeof(n)&&(n=(e=n).as,r=e.extend),n&&e&&e.noChildContext){var i=\"function\"==typeof t&&!_.N(t);return new _.fa(m,this,null,function(e){r&&r(e),e[n]=i?t():t},e)}return new _.fa(t,this,n,function(e,t){e.$parentContext=t,e.$parent=t.$data,e.$parents=(t.$parents||[]).slice(0),e.$parents.unshift(e.$parent),r&&r(e)},e)},_.fa.prototype.extend=function(t,e){return new _.fa(m,this,null,function(e){_.a.extend(e,\"function\"==typeof t?t(e):t)},e)};var b=_.a.g.Z();i.prototype.Sc=function(){this.Kb&&this.Kb.M&&this.Kb.M.rd(this.node)},i.prototype.rd=function(e){_.a.hb(this.ib,e),!this.ib.length&&this.T&&this.Bc()},i.prototype.Bc=function(){this.T=!0,this.xc.M&&!this.ib.length&&(this.xc.M=null,_.a.I.xb(this.node,r),_.j.Ga(this.node,_.j.oa),this.Sc())},_.j={T:\"childrenComplete\",oa:\"descendantsComplete\",subscribe:function(e,t,n,r){return(e=_.a.g.Tb(e,b,{})).Fa||(e.Fa=new _.R),e.Fa.subscribe(n,r,t)},Ga:function(e,t){var n=_.a.g.get(e,b);if(n&&(n.Fa&&n.Fa.notifySubscribers(e,t),t==_.j.T))if(n.M)n.M.Bc();else if(n.M===ye&&n.Fa&&n.Fa.Wa(_.j.oa))throw Error(\"descendantsComplete event not supported for bindings on this node\")},Bb:function(e,t){var n=_.a.g.Tb(e,b,{});return n.M||(n.M=new i(e,n,t[d])),t[d]==n?t:t.extend(function(e){e[d]=n})}},_.Sd=function(e){return(e=_.a.g.get(e,b))&&e.context},_.eb=function(e,t,n){return 1===e.nodeType&&_.h.Rc(e),c(e,t,l(n))},_.kd=function(e,t,n){return n=l(n),_.eb(e,function(e,t,n){return\"function\"==typeof e?a(e.bind(null,t,n)):_.a.Ha(e,o)}(t,n,e),n)},_.Pa=function(e,t){1!==t.nodeType&&8!==t.nodeType||s(l(e),t)},_.uc=function(e,t,n){if(!Te&&we.jQuery&&(Te=we.jQuery),arguments.length<2){if(!(t=xe.body))throw Error(\"ko.applyBindings: could not find document.body; has the document been loaded?\")}else if(!t||1!==t.nodeType&&8!==t.nodeType)throw Error(\"ko.applyBindings: first parameter should be your view model; second parameter should be a DOM node\");u(l(e,n),t)},_.Cc=function(e){return!e||1!==e.nodeType&&8!==e.nodeType?ye:_.Sd(e)},_.Dc=function(e){return(e=_.Cc(e))?e.$data:ye},_.b(\"bindingHandlers\",_.f),_.b(\"bindingEvent\",_.j),_.b(\"bindingEvent.subscribe\",_.j.subscribe),_.b(\"bindingEvent.startPossiblyAsyncContentBinding\",_.j.Bb),_.b(\"applyBindings\",_.uc),_.b(\"applyBindingsToDescendants\",_.Pa),_.b(\"applyBindingAccessorsToNode\",_.eb),_.b(\"applyBindingsToNode\",_.kd),_.b(\"contextFor\",_.Cc),_.b(\"dataFor\",_.Dc)}(),Y={},K={},_.i={get:function(e,t){var n=Object.prototype.hasOwnProperty.call(K,e)?K[e]:X;n?n.Fd?_.v.K(function(){t(n.definition)}):_.ma.yb(function(){t(n.definition)}):se(e,t)},Ac:function(e){delete K[e]},nc:ue},_.i.loaders=[],_.b(\"components\",_.i),_.b(\"components.get\",_.i.get),_.b(\"components.clearCachedDefinition\",_.i.Ac),function(){function i(e){switch(_.a.P(e)){case\"script\":return _.a.ta(e.text);case\"textarea\":return _.a.ta(e.value);case\"template\":if(o(e.content))return _.a.Ca(e.content.childNodes)}return _.a.Ca(e.childNodes)}function o(e){return we.DocumentFragment?e instanceof DocumentFragment:e&&11===e.nodeType}function u(e,t,n){\"string\"==typeof t.require?r||we.require?(r||we.require)([t.require],n):e(\"Uses require, but no AMD loader is present\"):n(t)}function a(t){return function(e){throw Error(\"Component '\"+t+\"': \"+e)}}var n={};_.i.register=function(e,t){if(!t)throw Error(\"Invalid configuration for \"+e);if(_.i.sb(e))throw Error(\"Component \"+e+\" is already registered\");n[e]=t},_.i.sb=function(e){return Object.prototype.hasOwnProperty.call(n,e)},_.i.unregister=function(e){delete n[e],_.i.Ac(e)},_.i.Ec={getConfig:function(e,t){t(_.i.sb(e)?n[e]:null)},loadComponent:function(t,e,n){var r=a(t);u(r,e,function(e){!function(t,e,n,r){function i(){0==--a&&r(o)}var o={},a=2,s=n.template;n=n.viewModel,s?u(e,s,function(e){_.i.nc(\"loadTemplate\",[t,e],function(e){o.template=e,i()})}):i(),n?u(e,n,function(e){_.i.nc(\"loadViewModel\",[t,e],function(e){o[c]=e,i()})}):i()}(t,r,e,n)})},loadTemplate:function(e,t,n){if(e=a(e),\"string\"==typeof t)n(_.a.ta(t));else if(t instanceof Array)n(t);else if(o(t))n(_.a.la(t.childNodes));else if(t.element)if(t=t.element,we.HTMLElement?t instanceof HTMLElement:t&&t.tagName&&1===t.nodeType)n(i(t));else if(\"string\"==typeof t){var r=xe.getElementById(t);r?n(i(r)):e(\"Cannot find element with ID \"+t)}else e(\"Unknown element type: \"+t);else e(\"Unknown template value: \"+t)},loadViewModel:function(e,t,n){!function e(t,n,r){if(\"function\"==typeof n)r(function(e){return new n(e)});else if(\"function\"==typeof n[c])r(n[c]);else if(\"instance\"in n){var i=n.instance;r(function(){return i})}else\"viewModel\"in n?e(t,n.viewModel,r):t(\"Unknown viewModel value: \"+n)}(a(e),t,n)}};var c=\"createViewModel\";_.b(\"components.register\",_.i.register),_.b(\"components.isRegistered\",_.i.sb),_.b(\"components.unregister\",_.i.unregister),_.b(\"components.defaultLoader\",_.i.Ec),_.i.loaders.push(_.i.Ec),_.i.cd=n}(),function(){_.i.getComponentNameForNode=function(e){var t=_.a.P(e);if(_.i.sb(t)&&(-1!=t.indexOf(\"-\")||\"[object HTMLUnknownElement]\"==\"\"+e||_.a.W<=8&&e.tagName===t))return t},_.i.sc=function(e,t,n,r){if(1===t.nodeType){var i=_.i.getComponentNameForNode(t);if(i){if((e=e||{}).component)throw Error('Cannot use the \"component\" binding on a custom element matching a component');var o={name:i,params:function(n,e){if(t=n.getAttribute(\"params\")){var t=a.parseBindingsString(t,e,n,{valueAccessors:!0,bindingParams:!0}),r=(t=_.a.Ha(t,function(e){return _.o(e,null,{l:n})}),_.a.Ha(t,function(t){var e=t.w();return t.ja()?_.o({read:function(){return _.a.c(t())},write:_.Ya(e)&&function(e){t()(e)},l:n}):e}));return Object.prototype.hasOwnProperty.call(r,\"$raw\")||(r.$raw=t),r}return{$raw:{}}}(t,n)};e.component=r?function(){return o}:o}}return e};var r,t,a=new _.ga;_.a.W<9&&(_.i.register=(t=_.i.register,function(e){return t.apply(this,arguments)}),xe.createDocumentFragment=(r=xe.createDocumentFragment,function(){var e,t=r(),n=_.i.cd;for(e in n);return t}))}(),Q=0,_.f.component={init:function(a,t,e,n,s){function u(){var e=c&&c.dispose;\"function\"==typeof e&&e.call(c),f&&f.s(),l=c=f=null}var c,l,f,d=_.a.la(_.h.childNodes(a));return _.h.Ea(a),_.a.I.za(a,u),_.o(function(){var n,r,e=_.a.c(t());if(\"string\"==typeof e?n=e:(n=_.a.c(e.name),r=_.a.c(e.params)),!n)throw Error(\"No component name specified\");var i=_.j.Bb(a,s),o=l=++Q;_.i.get(n,function(e){if(l===o){if(u(),!e)throw Error(\"Unknown component '\"+n+\"'\");!function(e,t,n){if(!(t=t.template))throw Error(\"Component '\"+e+\"' has no template\");e=_.a.Ca(t),_.h.ua(n,e)}(n,e,a);var t=function(e,t,n){var r=e.createViewModel;return r?r.call(e,t,n):t}(e,r,{element:a,templateNodes:d});e=i.createChildContext(t,{extend:function(e){e.$component=t,e.$componentTemplateNodes=d}}),t&&t.koDescendantsComplete&&(f=_.j.subscribe(a,_.j.oa,t.koDescendantsComplete,t)),c=t,_.Pa(e,a)}})},null,{l:a}),{controlsDescendantBindings:!0}}},_.h.ea.component=!0;var ce={class:\"className\",for:\"htmlFor\"};function le(e,p,h){_.f[e]={init:function(i,o,e,t,a){var s,u,c,l,f,d={};if(p){t=e.get(\"as\");var n=e.get(\"noChildContext\");d={as:t,noChildContext:n,exportDependencies:f=!(t&&n)}}return l=(c=\"render\"==e.get(\"completeOn\"))||e.has(_.j.oa),_.o(function(){var e,t=_.a.c(o()),n=!h!=!t,r=!u;!f&&n===s||(l&&(a=_.j.Bb(i,a)),n&&(p&&!f||(d.dataDependency=_.U.o()),e=p?a.createChildContext(\"function\"==typeof t?t:o,d):_.U.pa()?a.extend(null,d):a),r&&_.U.pa()&&(u=_.a.Ca(_.h.childNodes(i),!0)),n?(r||_.h.ua(i,_.a.Ca(u)),_.Pa(e,i)):(_.h.Ea(i),c||_.j.Ga(i,_.j.T)),s=n)},null,{l:i}),{controlsDescendantBindings:!0}}},_.m.Ra[e]=!1,_.h.ea[e]=!0}_.f.attr={update:function(i,e){var t=_.a.c(e())||{};_.a.O(t,function(e,t){t=_.a.c(t);var n=e.indexOf(\":\"),r=(n=\"lookupNamespaceURI\"in i&&0<n&&i.lookupNamespaceURI(e.substr(0,n)),!1===t||null===t||t===ye);r?n?i.removeAttributeNS(n,e):i.removeAttribute(e):t=t.toString(),_.a.W<=8&&e in ce?(e=ce[e],r?i.removeAttribute(e):i[e]=t):r||(n?i.setAttributeNS(n,e,t):i.setAttribute(e,t)),\"name\"===e&&_.a.Xc(i,r?\"\":t)})}},_.f.checked={after:[\"value\",\"attr\"],init:function(o,a,s){function e(){var e=o.checked,t=u();if(!_.U.rb()&&(e||!l&&!_.U.pa())){var n=_.v.K(a);if(f){var r=d?n.w():n,i=p;i!==(p=t)?e&&(_.a.Oa(r,t,!0),_.a.Oa(r,i,!1)):_.a.Oa(r,t,e),d&&_.Ya(n)&&n(r)}else c&&(t===ye?t=e:e||(t=ye)),_.m.$a(n,s,\"checked\",t,!0)}}var u=_.wb(function(){return s.has(\"checkedValue\")?_.a.c(s.get(\"checkedValue\")):n?s.has(\"value\")?_.a.c(s.get(\"value\")):o.value:void 0}),c=\"checkbox\"==o.type,l=\"radio\"==o.type;if(c||l){var t=a(),f=c&&_.a.c(t)instanceof Array,d=!(f&&t.push&&t.splice),n=l||f,p=f?u():ye;l&&!o.name&&_.f.uniqueName.init(o,function(){return!0}),_.o(e,null,{l:o}),_.a.H(o,\"click\",e),_.o(function(){var e=_.a.c(a()),t=u();f?(o.checked=0<=_.a.A(e,t),p=t):o.checked=c&&t===ye?!!e:u()===e},null,{l:o}),t=ye}}},_.m.va.checked=!0,_.f.checkedValue={update:function(e,t){e.value=_.a.c(t())}},_.f.class={update:function(e,t){var n=_.a.Cb(_.a.c(t()));_.a.Eb(e,e.__ko__cssValue,!1),e.__ko__cssValue=n,_.a.Eb(e,n,!0)}},_.f.css={update:function(n,e){var t=_.a.c(e());null!==t&&\"object\"==_typeof(t)?_.a.O(t,function(e,t){t=_.a.c(t),_.a.Eb(n,e,t)}):_.f.class.update(n,e)}},_.f.enable={update:function(e,t){var n=_.a.c(t());n&&e.disabled?e.removeAttribute(\"disabled\"):n||e.disabled||(e.disabled=!0)}},_.f.disable={update:function(e,t){_.f.enable.update(e,function(){return!_.a.c(t())})}},_.f.event={init:function(e,o,a,s,u){var t=o()||{};_.a.O(t,function(i){\"string\"==typeof i&&_.a.H(e,i,function(e){var t,n=o()[i];if(n){try{var r=_.a.la(arguments);s=u.$data,r.unshift(s),t=n.apply(s,r)}finally{!0!==t&&(e.preventDefault?e.preventDefault():e.returnValue=!1)}!1===a.get(i+\"Bubble\")&&(e.cancelBubble=!0,e.stopPropagation&&e.stopPropagation())}})})}},_.f.foreach={Qc:function(n){return function(){var e=n(),t=_.a.$b(e);return t&&\"number\"!=typeof t.length?(_.a.c(e),{foreach:t.data,as:t.as,noChildContext:t.noChildContext,includeDestroyed:t.includeDestroyed,afterAdd:t.afterAdd,beforeRemove:t.beforeRemove,afterRender:t.afterRender,beforeMove:t.beforeMove,afterMove:t.afterMove,templateEngine:_.ba.Na}):{foreach:e,templateEngine:_.ba.Na}}},init:function(e,t){return _.f.template.init(e,_.f.foreach.Qc(t))},update:function(e,t,n,r,i){return _.f.template.update(e,_.f.foreach.Qc(t),n,r,i)}},_.m.Ra.foreach=!1,_.h.ea.foreach=!0,_.f.hasfocus={init:function(r,i,o){function e(e){r.__ko_hasfocusUpdating=!0;var t=r.ownerDocument;if(\"activeElement\"in t){var n;try{n=t.activeElement}catch(e){n=t.body}e=n===r}t=i(),_.m.$a(t,o,\"hasfocus\",e,!0),r.__ko_hasfocusLastValue=e,r.__ko_hasfocusUpdating=!1}var t=e.bind(null,!0),n=e.bind(null,!1);_.a.H(r,\"focus\",t),_.a.H(r,\"focusin\",t),_.a.H(r,\"blur\",n),_.a.H(r,\"focusout\",n),r.__ko_hasfocusLastValue=!1},update:function(e,t){var n=!!_.a.c(t());e.__ko_hasfocusUpdating||e.__ko_hasfocusLastValue===n||(n?e.focus():e.blur(),!n&&e.__ko_hasfocusLastValue&&e.ownerDocument.body.focus(),_.v.K(_.a.Fb,null,[e,n?\"focusin\":\"focusout\"]))}},_.m.va.hasfocus=!0,_.f.hasFocus=_.f.hasfocus,_.m.va.hasFocus=\"hasfocus\",_.f.html={init:function(){return{controlsDescendantBindings:!0}},update:function(e,t){_.a.dc(e,t())}},le(\"if\"),le(\"ifnot\",!1,!0),le(\"with\",!0),_.f.let={init:function(e,t,n,r,i){return t=i.extend(t),_.Pa(t,e),{controlsDescendantBindings:!0}}},_.h.ea.let=!0;var fe,de,pe,he,ve={};function ge(e,t,n,r){e=_.m.Zb(e);for(var i=_.m.Ra,o=0;o<e.length;o++){var a=e[o].key;if(Object.prototype.hasOwnProperty.call(i,a)){var s=i[a];if(\"function\"==typeof s){if(a=s(e[o].value))throw Error(a)}else if(!s)throw Error(\"This template engine does not support the '\"+a+\"' binding within its templates\")}}return n=\"ko.__tr_ambtns(function($context,$element){return(function(){return{ \"+_.m.ub(e,{valueAccessors:!0})+\" } })()},'\"+n.toLowerCase()+\"')\",r.createJavaScriptEvaluatorBlock(n)+t}function me(e,t,n,r,i){var o,a,s,u,c,l=Math.min,f=Math.max,d=[],p=e.length,h=t.length,v=h-p||1,g=p+h+1;for(o=0;o<=p;o++)for(u=s,d.push(s=[]),c=l(h,o+v),a=f(0,o-1);a<=c;a++)s[a]=a?o?e[o-1]===t[a-1]?u[a-1]:l(u[a]||g,s[a-1]||g)+1:a+1:o+1;for(l=[],f=[],v=[],o=p,a=h;o||a;)h=d[o][a]-1,a&&h===d[o][a-1]?f.push(l[l.length]={status:n,value:t[--a],index:a}):o&&h===d[o-1][a]?v.push(l[l.length]={status:r,value:e[--o],index:o}):(--a,--o,i.sparse||l.push({status:\"retained\",value:t[a]}));return _.a.Jc(v,f,!i.dontLimitMoves&&10*p),l.reverse()}function be(t,n,r,i,o){var a=[],e=_.$(function(){var e=n(r,o,_.a.Ua(a,t))||[];0<a.length&&(_.a.Wc(a,e),i&&_.v.K(i,null,[r,e,o])),a.length=0,_.a.gb(a,e)},null,{l:t,Sa:function(){return!_.a.jd(a)}});return{Y:a,$:e.ja()?e:ye}}_.f.options={init:function(e){if(\"select\"!==_.a.P(e))throw Error(\"options binding applies only to SELECT elements\");for(;0<e.length;)e.remove(0);return{controlsDescendantBindings:!0}},update:function(r,e,i){function t(){return _.a.fb(r.options,function(e){return e.selected})}function o(e,t,n){var r=_typeof(t);return\"function\"==r?t(e):\"string\"==r?e[t]:n}function n(e,t){if(p&&c)_.u.ya(r,_.a.c(i.get(\"value\")),!0);else if(d.length){var n=0<=_.a.A(d,_.u.L(t[0]));_.a.Yc(t[0],n),p&&!n&&_.v.K(_.a.Fb,null,[r,\"change\"])}}var a=r.multiple,s=0!=r.length&&a?r.scrollTop:null,u=_.a.c(e()),c=i.get(\"valueAllowUnset\")&&i.has(\"value\"),l=i.get(\"optionsIncludeDestroyed\");e={};var f,d=[];c||(a?d=_.a.Mb(t(),_.u.L):0<=r.selectedIndex&&d.push(_.u.L(r.options[r.selectedIndex]))),u&&(void 0===u.length&&(u=[u]),f=_.a.fb(u,function(e){return l||e===ye||null===e||!_.a.c(e._destroy)}),!i.has(\"optionsCaption\")||null!==(u=_.a.c(i.get(\"optionsCaption\")))&&u!==ye&&f.unshift(ve));var p=!1;e.beforeRemove=function(e){r.removeChild(e)},u=n,i.has(\"optionsAfterRender\")&&\"function\"==typeof i.get(\"optionsAfterRender\")&&(u=function(e,t){n(0,t),_.v.K(i.get(\"optionsAfterRender\"),null,[t[0],e!==ve?e:ye])}),_.a.cc(r,f,function(e,t,n){return n.length&&(d=!c&&n[0].selected?[_.u.L(n[0])]:[],p=!0),t=r.ownerDocument.createElement(\"option\"),e===ve?(_.a.Ab(t,i.get(\"optionsCaption\")),_.u.ya(t,ye)):(n=o(e,i.get(\"optionsValue\"),e),_.u.ya(t,_.a.c(n)),e=o(e,i.get(\"optionsText\"),n),_.a.Ab(t,e)),[t]},e,u),_.v.K(function(){c?_.u.ya(r,_.a.c(i.get(\"value\")),!0):(a?d.length&&t().length<d.length:d.length&&0<=r.selectedIndex?_.u.L(r.options[r.selectedIndex])!==d[0]:d.length||0<=r.selectedIndex)&&_.a.Fb(r,\"change\")}),_.a.vd(r),s&&20<Math.abs(s-r.scrollTop)&&(r.scrollTop=s)}},_.f.options.Yb=_.a.g.Z(),_.f.selectedOptions={after:[\"options\",\"foreach\"],init:function(n,r,i){_.a.H(n,\"change\",function(){var e=r(),t=[];_.a.C(n.getElementsByTagName(\"option\"),function(e){e.selected&&t.push(_.u.L(e))}),_.m.$a(e,i,\"selectedOptions\",t)})},update:function(e,t){if(\"select\"!=_.a.P(e))throw Error(\"values binding applies only to SELECT elements\");var n=_.a.c(t()),r=e.scrollTop;n&&\"number\"==typeof n.length&&_.a.C(e.getElementsByTagName(\"option\"),function(e){var t=0<=_.a.A(n,_.u.L(e));e.selected!=t&&_.a.Yc(e,t)}),e.scrollTop=r}},_.m.va.selectedOptions=!0,_.f.style={update:function(r,e){var t=_.a.c(e()||{});_.a.O(t,function(e,t){if(null!==(t=_.a.c(t))&&t!==ye&&!1!==t||(t=\"\"),Te)Te(r).css(e,t);else if(/^--/.test(e))r.style.setProperty(e,t);else{e=e.replace(/-(\\w)/g,function(e,t){return t.toUpperCase()});var n=r.style[e];(r.style[e]=t)===n||r.style[e]!=n||isNaN(t)||(r.style[e]=t+\"px\")}})}},_.f.submit={init:function(r,i,e,t,o){if(\"function\"!=typeof i())throw Error(\"The value for a submit binding must be a function\");_.a.H(r,\"submit\",function(e){var t,n=i();try{t=n.call(o.$data,r)}finally{!0!==t&&(e.preventDefault?e.preventDefault():e.returnValue=!1)}})}},_.f.text={init:function(){return{controlsDescendantBindings:!0}},update:function(e,t){_.a.Ab(e,t())}},_.h.ea.text=!0,function(){if(we&&we.navigator){var f,d,p,h,v,e=function(e){if(e)return parseFloat(e[1])},t=we.navigator.userAgent;(f=we.opera&&we.opera.version&&parseInt(we.opera.version()))||(v=e(t.match(/Edge\\/([^ ]+)$/)))||e(t.match(/Chrome\\/([^ ]+)/))||(d=e(t.match(/Version\\/([^ ]+) Safari/)))||(p=e(t.match(/Firefox\\/([^ ]+)/)))||(h=_.a.W||e(t.match(/MSIE ([^ ]+)/)))||(h=e(t.match(/rv:([^ )]+)/)))}if(8<=h&&h<10)var r=_.a.g.Z(),i=_.a.g.Z(),o=function(e){var t=this.activeElement;(t=t&&_.a.g.get(t,i))&&t(e)},g=function(e,t){var n=e.ownerDocument;_.a.g.get(n,r)||(_.a.g.set(n,r,!0),_.a.H(n,\"selectionchange\",o)),_.a.g.set(e,i,t)};_.f.textInput={init:function(n,r,t){function e(e,t){_.a.H(n,e,t)}function i(){a||(s=n.value,a=_.a.setTimeout(o,4))}function o(){clearTimeout(a),s=a=ye;var e=n.value;u!==e&&(u=e,_.m.$a(r(),t,\"textInput\",e))}var a,s,u=n.value,c=9==_.a.W?i:o,l=!1;h&&e(\"keypress\",o),h<11&&e(\"propertychange\",function(e){l||\"value\"!==e.propertyName||c(e)}),8==h&&(e(\"keyup\",o),e(\"keydown\",o)),g&&(g(n,c),e(\"dragend\",i)),(!h||9<=h)&&e(\"input\",c),d<5&&\"textarea\"===_.a.P(n)?(e(\"keydown\",i),e(\"paste\",i),e(\"cut\",i)):f<11?e(\"keydown\",i):p<4?(e(\"DOMAutoComplete\",o),e(\"dragdrop\",o),e(\"drop\",o)):v&&\"number\"===n.type&&e(\"keydown\",i),e(\"change\",o),e(\"blur\",o),_.o(function e(){var t=_.a.c(r());null!==t&&t!==ye||(t=\"\"),s!==ye&&t===s?_.a.setTimeout(e,4):n.value!==t&&(l=!0,n.value=t,l=!1,u=n.value)},null,{l:n})}},_.m.va.textInput=!0,_.f.textinput={preprocess:function(e,t,n){n(\"textInput\",e)}}}(),_.f.uniqueName={init:function(e,t){if(t()){var n=\"ko_unique_\"+ ++_.f.uniqueName.qd;_.a.Xc(e,n)}}},_.f.uniqueName.qd=0,_.f.using={init:function(e,t,n,r,i){var o;return n.has(\"as\")&&(o={as:n.get(\"as\"),noChildContext:n.get(\"noChildContext\")}),t=i.createChildContext(t,o),_.Pa(t,e),{controlsDescendantBindings:!0}}},_.h.ea.using=!0,_.f.value={after:[\"options\",\"foreach\"],init:function(n,r,i){var o=_.a.P(n),e=\"input\"==o;if(!e||\"checkbox\"!=n.type&&\"radio\"!=n.type){var t=[\"change\"],a=i.get(\"valueUpdate\"),s=!1,u=null;a&&(\"string\"==typeof a&&(a=[a]),_.a.gb(t,a),t=_.a.vc(t));var c,l=function(){u=null,s=!1;var e=r(),t=_.u.L(n);_.m.$a(e,i,\"value\",t)};!_.a.W||!e||\"text\"!=n.type||\"off\"==n.autocomplete||n.form&&\"off\"==n.form.autocomplete||-1!=_.a.A(t,\"propertychange\")||(_.a.H(n,\"propertychange\",function(){s=!0}),_.a.H(n,\"focus\",function(){s=!1}),_.a.H(n,\"blur\",function(){s&&l()})),_.a.C(t,function(e){var t=l;_.a.Td(e,\"after\")&&(t=function(){u=_.u.L(n),_.a.setTimeout(l,0)},e=e.substring(5)),_.a.H(n,e,t)}),c=e&&\"file\"==n.type?function(){var e=_.a.c(r());null===e||e===ye||\"\"===e?n.value=\"\":_.v.K(l)}:function(){var e=_.a.c(r()),t=_.u.L(n);null!==u&&e===u?_.a.setTimeout(c,0):e===t&&t!==ye||(\"select\"===o?(t=i.get(\"valueAllowUnset\"),_.u.ya(n,e,t),t||e===_.u.L(n)||_.v.K(l)):_.u.ya(n,e))},_.o(c,null,{l:n})}else _.eb(n,{checkedValue:r})},update:function(){}},_.m.va.value=!0,_.f.visible={update:function(e,t){var n=_.a.c(t()),r=\"none\"!=e.style.display;n&&!r?e.style.display=\"\":!n&&r&&(e.style.display=\"none\")}},_.f.hidden={update:function(e,t){_.f.visible.update(e,function(){return!_.a.c(t())})}},_.f.click={init:function(e,t,n,r,i){return _.f.event.init.call(this,e,function(){var e={};return e.click=t(),e},n,r,i)}},_.ca=function(){},_.ca.prototype.renderTemplateSource=function(){throw Error(\"Override renderTemplateSource\")},_.ca.prototype.createJavaScriptEvaluatorBlock=function(){throw Error(\"Override createJavaScriptEvaluatorBlock\")},_.ca.prototype.makeTemplateSource=function(e,t){if(\"string\"==typeof e){var n=(t=t||xe).getElementById(e);if(!n)throw Error(\"Cannot find template with ID \"+e);return new _.B.D(n)}if(1==e.nodeType||8==e.nodeType)return new _.B.ia(e);throw Error(\"Unknown template type: \"+e)},_.ca.prototype.renderTemplate=function(e,t,n,r){return e=this.makeTemplateSource(e,r),this.renderTemplateSource(e,t,n,r)},_.ca.prototype.isTemplateRewritten=function(e,t){return!1===this.allowTemplateRewriting||this.makeTemplateSource(e,t).data(\"isRewritten\")},_.ca.prototype.rewriteTemplate=function(e,t,n){t=t((e=this.makeTemplateSource(e,n)).text()),e.text(t),e.data(\"isRewritten\",!0)},_.b(\"templateEngine\",_.ca),_.ic=(fe=/(<([a-z]+\\d*)(?:\\s+(?!data-bind\\s*=\\s*)[a-z0-9\\-]+(?:=(?:\\\"[^\\\"]*\\\"|\\'[^\\']*\\'|[^>]*))?)*\\s+)data-bind\\s*=\\s*([\"'])([\\s\\S]*?)\\3/gi,de=/\\x3c!--\\s*ko\\b\\s*([\\s\\S]*?)\\s*--\\x3e/g,{wd:function(e,t,n){t.isTemplateRewritten(e,n)||t.rewriteTemplate(e,function(e){return _.ic.Kd(e,t)},n)},Kd:function(e,o){return e.replace(fe,function(e,t,n,r,i){return ge(i,t,n,o)}).replace(de,function(e,t){return ge(t,\"\\x3c!-- ko --\\x3e\",\"#comment\",o)})},ld:function(r,i){return _.aa.Wb(function(e,t){var n=e.nextSibling;n&&n.nodeName.toLowerCase()===i&&_.eb(n,r,t)})}}),_.b(\"__tr_ambtns\",_.ic.ld),function(){_.B={},_.B.D=function(e){if(this.D=e){var t=_.a.P(e);this.Db=\"script\"===t?1:\"textarea\"===t?2:\"template\"==t&&e.content&&11===e.content.nodeType?3:4}},_.B.D.prototype.text=function(){var e=1===this.Db?\"text\":2===this.Db?\"value\":\"innerHTML\";if(0==arguments.length)return this.D[e];var t=arguments[0];\"innerHTML\"==e?_.a.dc(this.D,t):this.D[e]=t};var t=_.a.g.Z()+\"_\";_.B.D.prototype.data=function(e){if(1===arguments.length)return _.a.g.get(this.D,t+e);_.a.g.set(this.D,t+e,arguments[1])};var r=_.a.g.Z();_.B.D.prototype.nodes=function(){var e=this.D;if(0==arguments.length){var t=_.a.g.get(e,r)||{},n=t.jb||(3===this.Db?e.content:4===this.Db?e:ye);return n&&!t.hd||(t=this.text())&&(n=_.a.Ld(t,e.ownerDocument),this.text(\"\"),_.a.g.set(e,r,{jb:n,hd:!0})),n}_.a.g.set(e,r,{jb:arguments[0]})},_.B.ia=function(e){this.D=e},_.B.ia.prototype=new _.B.D,_.B.ia.prototype.constructor=_.B.ia,_.B.ia.prototype.text=function(){if(0==arguments.length){var e=_.a.g.get(this.D,r)||{};return e.jc===ye&&e.jb&&(e.jc=e.jb.innerHTML),e.jc}_.a.g.set(this.D,r,{jc:arguments[0]})},_.b(\"templateSources\",_.B),_.b(\"templateSources.domElement\",_.B.D),_.b(\"templateSources.anonymousTemplate\",_.B.ia)}(),function(){function r(e,t,n){var r;for(t=_.h.nextSibling(t);e&&(r=e)!==t;)n(r,e=_.h.nextSibling(r))}function d(e,t){if(e.length){var i=e[0],o=e[e.length-1],n=i.parentNode,a=_.ga.instance,s=a.preprocessNode;if(s){if(r(i,o,function(e,t){var n=e.previousSibling,r=s.call(a,e);r&&(e===i&&(i=r[0]||t),e===o&&(o=r[r.length-1]||n))}),e.length=0,!i)return;i===o?e.push(i):(e.push(i,o),_.a.Ua(e,n))}r(i,o,function(e){1!==e.nodeType&&8!==e.nodeType||_.uc(t,e)}),r(i,o,function(e){1!==e.nodeType&&8!==e.nodeType||_.aa.bd(e,[t])}),_.a.Ua(e,n)}}function u(e){return e.nodeType?e:0<e.length?e[0]:null}function p(e,t,n,r,i){i=i||{};var o=(e&&u(e)||n||{}).ownerDocument,a=i.templateEngine||c;if(_.ic.wd(n,a,o),\"number\"!=typeof(n=a.renderTemplate(n,r,i,o)).length||0<n.length&&\"number\"!=typeof n[0].nodeType)throw Error(\"Template engine must return an array of DOM nodes\");switch(o=!1,t){case\"replaceChildren\":_.h.ua(e,n),o=!0;break;case\"replaceNode\":_.a.Wc(e,n),o=!0;break;case\"ignoreTargetNode\":break;default:throw Error(\"Unknown renderMode: \"+t)}return o&&(d(n,r),i.afterRender&&_.v.K(i.afterRender,null,[n,r[i.as||\"$data\"]]),\"replaceChildren\"==t&&_.j.Ga(e,_.j.T)),n}function h(e,t,n){return _.N(e)?e():\"function\"==typeof e?e(t,n):e}var c;_.ec=function(e){if(e!=ye&&!(e instanceof _.ca))throw Error(\"templateEngine must inherit from ko.templateEngine\");c=e},_.bc=function(n,r,i,o,a){if(((i=i||{}).templateEngine||c)==ye)throw Error(\"Set a template engine before calling renderTemplate\");if(a=a||\"replaceChildren\",o){var s=u(o);return _.$(function(){var e=r&&r instanceof _.fa?r:new _.fa(r,null,null,null,{exportDependencies:!0}),t=h(n,e.$data,e);e=p(o,a,t,e,i),\"replaceNode\"==a&&(s=u(o=e))},null,{Sa:function(){return!s||!_.a.Rb(s)},l:s&&\"replaceNode\"==a?s.parentNode:s})}return _.aa.Wb(function(e){_.bc(n,r,i,e,\"replaceNode\")})},_.Pd=function(r,t,i,o,a){function n(e,t){_.v.K(_.a.cc,null,[o,e,u,i,s,t]),_.j.Ga(o,_.j.T)}function s(e,t){d(t,c),i.afterRender&&i.afterRender(t,e),c=null}function u(e,t){c=a.createChildContext(e,{as:l,noChildContext:i.noChildContext,extend:function(e){e.$index=t,l&&(e[l+\"Index\"]=t)}});var n=h(r,e,c);return p(o,\"ignoreTargetNode\",n,c,i)}var c,l=i.as,f=!1===i.includeDestroyed||_.options.foreachHidesDestroyed&&!i.includeDestroyed;if(f||i.beforeRemove||!_.Oc(t))return _.$(function(){var e=_.a.c(t)||[];void 0===e.length&&(e=[e]),f&&(e=_.a.fb(e,function(e){return e===ye||null===e||!_.a.c(e._destroy)})),n(e)},null,{l:o});n(t.w());var e=t.subscribe(function(e){n(t(),e)},null,\"arrayChange\");return e.l(o),e};var a=_.a.g.Z(),i=_.a.g.Z();_.f.template={init:function(e,t){var n=_.a.c(t());if(\"string\"==typeof n||n.name)_.h.Ea(e);else if(\"nodes\"in n){if(n=n.nodes||[],_.N(n))throw Error('The \"nodes\" option must be a plain, non-observable array.');var r=n[0]&&n[0].parentNode;r&&_.a.g.get(r,i)||(r=_.a.Xb(n),_.a.g.set(r,i,!0)),new _.B.ia(e).nodes(r)}else{if(!(0<(n=_.h.childNodes(e)).length))throw Error(\"Anonymous template defined, but no template content was provided\");r=_.a.Xb(n),new _.B.ia(e).nodes(r)}return{controlsDescendantBindings:!0}},update:function(e,t,n,r,i){var o=t();n=!0,r=null,\"string\"==typeof(t=_.a.c(o))?t={}:(o=t.name,\"if\"in t&&(n=_.a.c(t.if)),n&&\"ifnot\"in t&&(n=!_.a.c(t.ifnot))),\"foreach\"in t?r=_.Pd(o||e,n&&t.foreach||[],t,e,i):n?(n=i,\"data\"in t&&(n=i.createChildContext(t.data,{as:t.as,noChildContext:t.noChildContext,exportDependencies:!0})),r=_.bc(o||e,n,t,e)):_.h.Ea(e),i=r,(t=_.a.g.get(e,a))&&\"function\"==typeof t.s&&t.s(),_.a.g.set(e,a,!i||i.ja&&!i.ja()?ye:i)}},_.m.Ra.template=function(e){return 1==(e=_.m.Zb(e)).length&&e[0].unknown||_.m.Hd(e,\"name\")?null:\"This template engine does not support anonymous templates nested within its templates\"},_.h.ea.template=!0}(),_.b(\"setTemplateEngine\",_.ec),_.b(\"renderTemplate\",_.bc),_.a.Jc=function(e,t,n){var r,i,o,a,s;if(e.length&&t.length)for(r=i=0;(!n||r<n)&&(a=e[i]);++i){for(o=0;s=t[o];++o)if(a.value===s.value){a.moved=s.index,s.moved=a.index,t.splice(o,1),r=o=0;break}r+=o}},_.a.Ob=function(e,t,n){return n=\"boolean\"==typeof n?{dontLimitMoves:n}:n||{},(e=e||[]).length<(t=t||[]).length?me(e,t,\"added\",\"deleted\",n):me(t,e,\"deleted\",\"added\",n)},_.b(\"utils.compareArrays\",_.a.Ob),pe=_.a.g.Z(),he=_.a.g.Z(),_.a.cc=function(t,e,n,r,i,o){function a(e){c={Aa:e,nb:_.sa(m++)},v.push(c),h||C.push(c)}function s(e){c=p[e],m!==c.nb.w()&&x.push(c),c.nb(m++),_.a.Ua(c.Y,t),v.push(c)}function u(t,n){if(t)for(var r=0,e=n.length;r<e;r++)_.a.C(n[r].Y,function(e){t(e,r,n[r].Aa)})}void 0===(e=e||[]).length&&(e=[e]),r=r||{};var c,l,f,d,p=_.a.g.get(t,pe),h=!p,v=[],g=0,m=0,b=[],y=[],w=[],x=[],C=[],T=0;if(h)_.a.C(e,a);else{if(!o||p&&p._countWaitingForRemove){var k=_.a.Mb(p,function(e){return e.Aa});o=_.a.Ob(k,e,{dontLimitMoves:r.dontLimitMoves,sparse:!0})}var E,S,N;for(k=0;E=o[k];k++)switch(S=E.moved,N=E.index,E.status){case\"deleted\":for(;g<N;)s(g++);S===ye&&((c=p[g]).$&&(c.$.s(),c.$=ye),_.a.Ua(c.Y,t).length&&(r.beforeRemove&&(v.push(c),T++,c.Aa===he?c=null:w.push(c)),c&&b.push.apply(b,c.Y))),g++;break;case\"added\":for(;m<N;)s(g++);S!==ye?(y.push(v.length),s(S)):a(E.value)}for(;m<e.length;)s(g++);v._countWaitingForRemove=T}_.a.g.set(t,pe,v),u(r.beforeMove,x),_.a.C(b,r.beforeRemove?_.na:_.removeNode);try{d=t.ownerDocument.activeElement}catch(e){}if(y.length)for(;(k=y.shift())!=ye;){for(c=v[k],l=ye;k;)if((f=v[--k].Y)&&f.length){l=f[f.length-1];break}for(e=0;g=c.Y[e];l=g,e++)_.h.Vb(t,g,l)}for(k=0,y=_.h.firstChild(t);c=v[k];k++){for(c.Y||_.a.extend(c,be(t,n,c.Aa,i,c.nb)),e=0;g=c.Y[e];y=g.nextSibling,l=g,e++)g!==y&&_.h.Vb(t,g,l);!c.Dd&&i&&(i(c.Aa,c.Y,c.nb),c.Dd=!0,l=c.Y[c.Y.length-1])}for(d&&t.ownerDocument.activeElement!=d&&d.focus(),u(r.beforeRemove,w),k=0;k<w.length;++k)w[k].Aa=he;u(r.afterMove,x),u(r.afterAdd,C)},_.b(\"utils.setDomNodeChildrenFromArrayMapping\",_.a.cc),_.ba=function(){this.allowTemplateRewriting=!1},_.ba.prototype=new _.ca,_.ba.prototype.constructor=_.ba,_.ba.prototype.renderTemplateSource=function(e,t,n,r){return(t=_.a.W<9||!e.nodes?null:e.nodes())?_.a.la(t.cloneNode(!0).childNodes):(e=e.text(),_.a.ta(e,r))},_.ba.Na=new _.ba,_.ec(_.ba.Na),_.b(\"nativeTemplateEngine\",_.ba),function(){_.Za=function(){var o=this.Gd=function(){if(!Te||!Te.tmpl)return 0;try{if(0<=Te.tmpl.tag.tmpl.open.toString().indexOf(\"__\"))return 2}catch(e){}return 1}();this.renderTemplateSource=function(e,t,n,r){if(r=r||xe,n=n||{},o<2)throw Error(\"Your version of jQuery.tmpl is too old. Please upgrade to jQuery.tmpl 1.0.0pre or later.\");var i=e.data(\"precompiled\");return i||(i=e.text()||\"\",i=Te.template(null,\"{{ko_with $item.koBindingContext}}\"+i+\"{{/ko_with}}\"),e.data(\"precompiled\",i)),e=[t.$data],t=Te.extend({koBindingContext:t},n.templateOptions),(t=Te.tmpl(i,e,t)).appendTo(r.createElement(\"div\")),Te.fragments={},t},this.createJavaScriptEvaluatorBlock=function(e){return\"{{ko_code ((function() { return \"+e+\" })()) }}\"},this.addTemplate=function(e,t){xe.write(\"<script type='text/html' id='\"+e+\"'>\"+t+\"<\\/script>\")},0<o&&(Te.tmpl.tag.ko_code={open:\"__.push($1 || '');\"},Te.tmpl.tag.ko_with={open:\"with($1) {\",close:\"} \"})},_.Za.prototype=new _.ca,_.Za.prototype.constructor=_.Za;var e=new _.Za;0<e.Gd&&_.ec(e),_.b(\"jqueryTmplTemplateEngine\",_.Za)}()},\"function\"==typeof define&&define.amd?define([\"exports\",\"require\"],e):\"object\"===(\"undefined\"==typeof exports?\"undefined\":_typeof(exports))&&\"object\"===(\"undefined\"==typeof module?\"undefined\":_typeof(module))?e(module.exports||exports):e(we.ko={})}(),function(e){if(\"function\"==typeof require&&\"object\"===(\"undefined\"==typeof exports?\"undefined\":_typeof(exports))&&\"object\"===(\"undefined\"==typeof module?\"undefined\":_typeof(module)))e(require(\"knockout\"),exports);else if(\"function\"==typeof define&&define.amd)define([\"knockout\",\"exports\"],e);else{if(\"undefined\"==typeof ko)throw new Error(\"Knockout is required, please ensure it is loaded before loading this mapping plug-in\");e(ko,ko.mapping={})}}(function(B,I){B.mapping=I;var H,F,u=!0,$=\"__ko_mapping__\",c=B.dependentObservable,o=0,a=[\"create\",\"update\",\"key\",\"arrayChanged\"],W={},e={include:[\"_destroy\"],ignore:[],copy:[],observe:[]},s=e;function l(){for(var e,t,n,r=arguments,i=r.length,o={},a=[];i--;)for(e=(n=r[i]).length;e--;)o[t=n[e]]||(o[t]=1,a.push(t));return a}function f(e,t){var n;for(var r in t)if(t.hasOwnProperty(r)&&t[r])if(n=I.getType(e[r]),r&&e[r]&&\"array\"!==n&&\"string\"!==n)f(e[r],t[r]);else{var i=\"array\"===I.getType(e[r])&&\"array\"===I.getType(t[r]);e[r]=i?l(e[r],t[r]):t[r]}}function V(e,t){var n={};return f(n,e),f(n,t),n}function d(e,t){for(var n=V({},e),r=a.length-1;0<=r;r--){var i=a[r];n[i]&&(n[\"\"]instanceof Object||(n[\"\"]={}),n[\"\"][i]=n[i],delete n[i])}return t&&(n.ignore=p(t.ignore,n.ignore),n.include=p(t.include,n.include),n.copy=p(t.copy,n.copy),n.observe=p(t.observe,n.observe)),n.ignore=p(n.ignore,s.ignore),n.include=p(n.include,s.include),n.copy=p(n.copy,s.copy),n.observe=p(n.observe,s.observe),n.mappedProperties=n.mappedProperties||{},n.copiedProperties=n.copiedProperties||{},n}function p(e,t){return void 0===e?e=[]:\"array\"!==I.getType(e)&&(e=[e]),void 0===t?t=[]:\"array\"!==I.getType(t)&&(t=[t]),B.utils.arrayGetDistinctValues(e.concat(t))}function U(s,e){var t=B.dependentObservable;B.dependentObservable=function(e,t,n){n=n||{},e&&\"object\"===_typeof(e)&&(n=e);var r=n.deferEvaluation,i=n.pure,o=!1;n.deferEvaluation=!0;var a=c(e,t,n);return r||i||(a=function(t){var e=B.dependentObservable;B.dependentObservable=c;var n=B.isWriteableObservable(t);B.dependentObservable=e;var r=c({read:function(){return o||(B.utils.arrayRemoveItem(s,t),o=!0),t.apply(t,arguments)},write:n&&function(e){return t(e)},deferEvaluation:!0});return u&&(r._wrapper=!0),r.__DO=t,r}(a),s.push(a)),a},B.dependentObservable.fn=c.fn,B.computed=B.dependentObservable;var n=e();return B.dependentObservable=t,B.computed=B.dependentObservable,n}function J(e,t,n){for(var r=0,i=e.length;r<i;r++)if(!0!==n[r]&&e[r]===t)return r;return null}function h(e,t){var n;return t&&(n=t(e)),\"undefined\"===I.getType(n)&&(n=e),B.utils.unwrapObservable(n)}function z(e,t,n){for(var r=0,i=(e=B.utils.unwrapObservable(e)).length;r<i;r++){var o=e[r];if(h(o,n)===t)return o}throw new Error(\"When calling ko.update*, the key '\"+t+\"' was not found!\")}function G(e,t){return B.utils.arrayMap(B.utils.unwrapObservable(e),function(e){return t?h(e,t):e})}function X(e,t){if(\"array\"===I.getType(e))for(var n=0;n<e.length;n++)t(n);else for(var r in e)e.hasOwnProperty(r)&&t(r)}function Y(e){if(null===e)return!1;var t=I.getType(e);return\"object\"===t||\"array\"===t}function K(e){return(\"\"+e).replace(/~/g,\"~~\").replace(/\\[/g,\"~[\").replace(/]/g,\"~]\").replace(/\\./g,\"~.\")}function i(){var r=[],i=[];this.save=function(e,t){var n=B.utils.arrayIndexOf(r,e);0<=n?i[n]=t:(r.push(e),i.push(t))},this.get=function(e){var t=B.utils.arrayIndexOf(r,e);return 0<=t?i[t]:void 0}}function v(){function n(e){var t;try{t=e}catch(e){t=\"$$$\"}var n=r[t];return r.hasOwnProperty(t)||(n=new i,r[t]=n),n}var r={};this.save=function(e,t){n(e).save(e,t)},this.get=function(e){return n(e).get(e)}}I.isMapped=function(e){var t=B.utils.unwrapObservable(e);return t&&t[$]},I.fromJS=function(e){if(0===arguments.length)throw new Error(\"When calling ko.fromJS, pass the object you want to convert.\");try{var t,n;o||(H=[],F=new v),o++,2===arguments.length&&(arguments[1][$]?n=arguments[1]:t=arguments[1]),3===arguments.length&&(t=arguments[1],n=arguments[2]),n&&(t=V(t,n[$]));var r=function o(a,s,u,r,t,c,e){var n=\"array\"===I.getType(B.utils.unwrapObservable(s));c=c||\"\";if(I.isMapped(a)){var i=B.utils.unwrapObservable(a)[$];u=V(i,u)}var l={data:s,parent:e||t};var f=function(){return u[r]&&u[r].create instanceof Function};var d=function(e){return U(H,function(){return B.utils.unwrapObservable(t)instanceof Array?u[r].create({data:e||l.data,parent:l.parent,skip:W}):u[r].create({data:e||l.data,parent:l.parent})})};var p=function(){return u[r]&&u[r].update instanceof Function};var h=function(e,t){var n={data:t||l.data,parent:l.parent,target:B.utils.unwrapObservable(e)};return B.isWriteableObservable(e)&&(n.observable=e),u[r].update(n)};var v=F.get(s);if(v)return v;r=r||\"\";if(n){var g=[],m=!1,b=function(e){return e};u[r]&&u[r].key&&(b=u[r].key,m=!0),B.isObservable(a)||((a=B.observableArray([])).mappedRemove=function(t){var n=\"function\"==typeof t?t:function(e){return e===b(t)};return a.remove(function(e){return n(b(e))})},a.mappedRemoveAll=function(e){var t=G(e,b);return a.remove(function(e){return-1!==B.utils.arrayIndexOf(t,b(e))})},a.mappedDestroy=function(t){var n=\"function\"==typeof t?t:function(e){return e===b(t)};return a.destroy(function(e){return n(b(e))})},a.mappedDestroyAll=function(e){var t=G(e,b);return a.destroy(function(e){return-1!==B.utils.arrayIndexOf(t,b(e))})},a.mappedIndexOf=function(e){var t=G(a(),b),n=b(e);return B.utils.arrayIndexOf(t,n)},a.mappedGet=function(e){return a()[a.mappedIndexOf(e)]},a.mappedCreate=function(e){if(-1!==a.mappedIndexOf(e))throw new Error(\"There already is an object with the key that you specified.\");var t=f()?d(e):e;if(p()){var n=h(t,e);B.isWriteableObservable(t)?t(n):t=n}return a.push(t),t});var y=G(B.utils.unwrapObservable(a),b).sort(),w=G(s,b);m&&w.sort();var x,C,T,k=B.utils.compareArrays(y,w),E={},S=B.utils.unwrapObservable(s),N={},_=!0;for(x=0,C=S.length;x<C;x++){if(void 0===(T=b(S[x]))||T instanceof Object){_=!1;break}N[T]=S[x]}var A,D,O=[],j=0;for(x=0,C=k.length;x<C;x++){var q;T=k[x];var M=c+\"[\"+K(x)+\"]\";switch(T.status){case\"added\":A=_?N[T.value]:z(B.utils.unwrapObservable(s),T.value,b),q=o(void 0,A,u,r,a,M,t),f()||(q=B.utils.unwrapObservable(q)),D=J(B.utils.unwrapObservable(s),A,E),q===W?j++:O[D-j]=q,E[D]=!0;break;case\"retained\":A=_?N[T.value]:z(B.utils.unwrapObservable(s),T.value,b),q=z(a,T.value,b),o(q,A,u,r,a,M,t),D=J(B.utils.unwrapObservable(s),A,E),O[D]=q,E[D]=!0;break;case\"deleted\":q=z(a,T.value,b)}g.push({event:T.status,item:q})}a(O),u[r]&&u[r].arrayChanged&&B.utils.arrayForEach(g,function(e){u[r].arrayChanged(e.event,e.item)})}else if(Y(s)){if(!(a=B.utils.unwrapObservable(a))){if(f()){var L=d();return p()&&(L=h(L)),L}if(p())return h();a={}}if(p()&&(a=h(a)),F.save(s,a),p())return a;X(s,function(e){var t=c.length?c+\".\"+K(e):K(e);if(-1===B.utils.arrayIndexOf(u.ignore,t))if(-1===B.utils.arrayIndexOf(u.copy,t)){if(\"object\"!==_typeof(s[e])&&\"array\"!==I.getType(s[e])&&0<u.observe.length&&-1===B.utils.arrayIndexOf(u.observe,t))return a[e]=s[e],void(u.copiedProperties[t]=!0);var n=F.get(s[e]),r=o(a[e],s[e],u,e,a,t,a),i=n||r;if(0<u.observe.length&&-1===B.utils.arrayIndexOf(u.observe,t))return a[e]=B.utils.unwrapObservable(i),void(u.copiedProperties[t]=!0);B.isWriteableObservable(a[e])?(i=B.utils.unwrapObservable(i),a[e]()!==i&&a[e](i)):(i=void 0===a[e]?i:B.utils.unwrapObservable(i),a[e]=i),u.mappedProperties[t]=!0}else a[e]=s[e]})}else switch(I.getType(s)){case\"function\":a=p()?B.isWriteableObservable(s)?(s(h(s)),s):h(s):s;break;default:var P;if(B.isWriteableObservable(a))return P=p()?h(a):B.utils.unwrapObservable(s),a(P),P;var R=f()||p();if(a=f()?d():B.observable(B.utils.unwrapObservable(s)),p()&&a(h(a)),R)return a}return a}(n,e,t=d(t));if(n&&(r=n),!--o)for(;H.length;){var i=H.pop();i&&(i(),i.__DO.throttleEvaluation=i.throttleEvaluation)}return r[$]=V(r[$],t),r}catch(e){throw o=0,e}},I.fromJSON=function(e){var t=Array.prototype.slice.call(arguments,0);return t[0]=B.utils.parseJson(e),I.fromJS.apply(this,t)},I.toJS=function(e,t){if(s||I.resetDefaultOptions(),0===arguments.length)throw new Error(\"When calling ko.mapping.toJS, pass the object you want to convert.\");if(\"array\"!==I.getType(s.ignore))throw new Error(\"ko.mapping.defaultOptions().ignore should be an array.\");if(\"array\"!==I.getType(s.include))throw new Error(\"ko.mapping.defaultOptions().include should be an array.\");if(\"array\"!==I.getType(s.copy))throw new Error(\"ko.mapping.defaultOptions().copy should be an array.\");return t=d(t,e[$]),I.visitModel(e,function(e){return B.utils.unwrapObservable(e)},t)},I.toJSON=function(e,t,n,r){var i=I.toJS(e,t);return B.utils.stringifyJson(i,n,r)},I.defaultOptions=function(){if(!(0<arguments.length))return s;s=arguments[0]},I.resetDefaultOptions=function(){s={include:e.include.slice(0),ignore:e.ignore.slice(0),copy:e.copy.slice(0),observe:e.observe.slice(0)}},I.getType=function(e){if(e&&\"object\"===_typeof(e)){if(e.constructor===Date)return\"date\";if(e.constructor===Array)return\"array\"}return _typeof(e)},I.visitModel=function(e,s,u){var c;(u=u||{}).visitedObjects=u.visitedObjects||new v;var l=B.utils.unwrapObservable(e);if(!Y(l))return s(e,u.parentName);u=d(u,l[$]),s(e,u.parentName),c=\"array\"===I.getType(l)?[]:{},u.visitedObjects.save(e,c);var f=u.parentName;return X(l,function(e){var t=K(e);if(!u.ignore||-1===B.utils.arrayIndexOf(u.ignore,t)){var n=l[e];if(u.parentName=function(e,t,n){var r=e||\"\";return\"array\"===I.getType(t)?e&&(r+=\"[\"+K(n)+\"]\"):(e&&(r+=\".\"),r+=K(n)),r}(f,l,e),-1===B.utils.arrayIndexOf(u.copy,t)&&-1===B.utils.arrayIndexOf(u.include,t)){var r=l[$];if(r){var i=r.mappedProperties;if(i&&!i[t]){var o=r.copiedProperties;if(o&&!o[t]&&\"array\"!==I.getType(l))return}}}switch(I.getType(B.utils.unwrapObservable(n))){case\"object\":case\"array\":case\"undefined\":var a=u.visitedObjects.get(n);c[e]=\"undefined\"!==I.getType(a)?a:I.visitModel(n,s,u);break;default:c[e]=s(n,u.parentName)}}}),c}}),BaseViewModel.prototype.update=function(){var e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){},t=this;t.fetching(!0),$.get(t.remoteUrl(),function(e){ko.mapping.fromJS(e,t)},\"json\").always(function(){t.fetching(!1),e()})},ConfigViewModel.prototype=Object.create(BaseViewModel.prototype),(ConfigViewModel.prototype.constructor=ConfigViewModel).prototype.update=function(){var t=this,e=0<arguments.length&&void 0!==arguments[0]?arguments[0]:function(){};this.fetching(!0),$.get(this.remoteUrl(),function(e){ko.mapping.fromJS(e,t),t.mqtt_protocol_enable(e.hasOwnProperty(\"mqtt_protocol\")),t.mqtt_port_enable(e.hasOwnProperty(\"mqtt_port\")),t.mqtt_reject_unauthorized_enable(e.hasOwnProperty(\"mqtt_reject_unauthorized\")),e.hasOwnProperty(\"mqtt_protocol\")&&t.mqtt_protocol(e.mqtt_protocol)},\"json\").always(function(){t.fetching(!1),e()})},StatusViewModel.prototype=Object.create(BaseViewModel.prototype),StatusViewModel.prototype.constructor=StatusViewModel;\n"
-  "//# sourceMappingURL=lib.js.map\n";
+static const char CONTENT_LIB_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xb4, 0xbd, 0x8b, 0x76, 0xdb, 0x46, 
+  0xb2, 0x36, 0xfa, 0x2a, 0x22, 0xc6, 0x5b, 0x03, 0x98, 0x4d, 0x8a, 0xb4, 0x93, 0xec, 0x3d, 0xa0, 
+  0x10, 0x2e, 0xc7, 0x56, 0x12, 0x67, 0x72, 0xf1, 0xd8, 0xca, 0x6d, 0x28, 0xc6, 0x0b, 0x22, 0x9b, 
+  0x12, 0x62, 0x12, 0x60, 0x00, 0x50, 0xb2, 0x22, 0x72, 0xde, 0xec, 0x5f, 0xe7, 0x91, 0xce, 0x2b, 
+  0x9c, 0xfa, 0xaa, 0x2f, 0x68, 0x80, 0xa0, 0xec, 0x99, 0x7f, 0x1f, 0xcf, 0x44, 0xc4, 0xa5, 0xd1, 
+  0xd7, 0xea, 0xba, 0x77, 0x95, 0xb7, 0x29, 0xe4, 0x51, 0x51, 0xe6, 0xc9, 0xac, 0xf4, 0x46, 0x8b, 
+  0x4d, 0x3a, 0x2b, 0x93, 0x2c, 0x3d, 0x7a, 0x5b, 0xde, 0xad, 0x65, 0xb6, 0xf0, 0x65, 0x70, 0x9f, 
+  0xcb, 0x72, 0x93, 0xa7, 0xbe, 0x7e, 0x12, 0x79, 0xa6, 0x8c, 0x17, 0x45, 0xea, 0xd1, 0xd1, 0x9b, 
+  0xbb, 0xd5, 0x65, 0xb6, 0x3c, 0x3e, 0xf6, 0x0a, 0xbe, 0x68, 0xbe, 0xe8, 0x27, 0xa5, 0xcc, 0xe3, 
+  0x32, 0xcb, 0xc7, 0xe6, 0xd3, 0xaa, 0xda, 0x23, 0x5d, 0x52, 0xee, 0xc2, 0x96, 0x97, 0x92, 0xea, 
+  0x3c, 0xdc, 0x9c, 0xec, 0xcf, 0xb2, 0x94, 0x7a, 0xbe, 0x99, 0x51, 0xdd, 0x51, 0x14, 0xd9, 0xe7, 
+  0x1d, 0x73, 0xdd, 0x5f, 0xe7, 0x59, 0x99, 0xe1, 0xb3, 0xb1, 0xe9, 0x5b, 0x68, 0x1b, 0x0c, 0xa8, 
+  0xa1, 0x9d, 0x1d, 0xf0, 0x17, 0x71, 0x21, 0x7f, 0x4a, 0xe4, 0xed, 0x77, 0xd9, 0x5c, 0x2e, 0x7d, 
+  0x29, 0xca, 0xe0, 0xfe, 0x26, 0xce, 0x8f, 0xd2, 0xe8, 0xc9, 0x69, 0x9c, 0x5f, 0x6d, 0x56, 0x32, 
+  0x2d, 0x8b, 0xfe, 0x52, 0xa6, 0x57, 0xe5, 0xf5, 0xf1, 0xf1, 0x4d, 0x96, 0xcc, 0x8f, 0x06, 0xd4, 
+  0x8c, 0x7d, 0x35, 0x79, 0x32, 0x1d, 0xbb, 0x37, 0xe1, 0xfd, 0x6e, 0x54, 0x5e, 0x27, 0x45, 0x3f, 
+  0x97, 0xab, 0xac, 0x94, 0x3f, 0xe6, 0xcb, 0xa8, 0x14, 0xef, 0xb2, 0xfe, 0x2a, 0x5e, 0xaf, 0x93, 
+  0xf4, 0xaa, 0xbf, 0xc8, 0xb3, 0xd5, 0x37, 0x6f, 0xa8, 0x9d, 0x54, 0xa0, 0x58, 0xc0, 0x7f, 0xfb, 
+  0x0b, 0x59, 0xce, 0xae, 0xe9, 0x75, 0x44, 0x25, 0xb3, 0xcb, 0x42, 0xe6, 0x37, 0xf1, 0xe5, 0x52, 
+  0xfa, 0x9d, 0xa1, 0xd3, 0xd1, 0xe7, 0x59, 0xba, 0x48, 0xae, 0x9c, 0xae, 0xaa, 0x8e, 0x96, 0xf8, 
+  0x66, 0xbd, 0xc9, 0xe5, 0xf3, 0x6c, 0xb5, 0xde, 0x94, 0x72, 0xee, 0xdb, 0xf9, 0xac, 0xa6, 0xd3, 
+  0x0f, 0xba, 0xde, 0xc9, 0x8c, 0x2b, 0xf0, 0x76, 0xc1, 0xa8, 0x36, 0xe6, 0xfe, 0x2c, 0x5e, 0x2e, 
+  0x7d, 0x74, 0x43, 0xdc, 0x17, 0x45, 0x32, 0x0f, 0x3d, 0x4f, 0xac, 0xe3, 0xa2, 0xc0, 0x2f, 0x8d, 
+  0x21, 0x9d, 0xad, 0x8a, 0xb7, 0xe8, 0x91, 0xcc, 0x43, 0x6f, 0x1e, 0x97, 0x71, 0x3f, 0x5b, 0xcb, 
+  0x54, 0xde, 0x14, 0x58, 0x85, 0xd5, 0x89, 0x2e, 0x51, 0x15, 0x8d, 0xd7, 0xc9, 0x3b, 0x79, 0xe7, 
+  0x7e, 0x9c, 0x52, 0x2b, 0xee, 0xfd, 0x82, 0x06, 0x2a, 0xf3, 0x75, 0x9e, 0xa4, 0xa5, 0xfb, 0x58, 
+  0xa6, 0x18, 0xf3, 0x3c, 0x1c, 0x88, 0xd5, 0x1f, 0x65, 0xf9, 0x96, 0x57, 0x70, 0x96, 0x2d, 0x43, 
+  0x0f, 0xb7, 0x5e, 0xfd, 0xa1, 0x2e, 0x1c, 0x76, 0x86, 0xea, 0xb9, 0xe9, 0x9f, 0x29, 0x96, 0xe5, 
+  0x65, 0x38, 0xfc, 0x9f, 0xff, 0x79, 0x5a, 0xdd, 0x36, 0xbf, 0xc8, 0xe5, 0xef, 0x72, 0x56, 0xbe, 
+  0xdd, 0xa4, 0xf1, 0xa6, 0xbc, 0xce, 0xf2, 0xe4, 0x4f, 0x6a, 0xb9, 0x33, 0x38, 0xf8, 0xae, 0xf9, 
+  0x79, 0x99, 0xad, 0x93, 0x99, 0x6d, 0x8f, 0x76, 0x92, 0xd3, 0xb8, 0x9e, 0x3b, 0xd5, 0xb1, 0x6c, 
+  0x19, 0x57, 0xaf, 0xae, 0xf2, 0x64, 0xfe, 0x36, 0x91, 0xf6, 0xfe, 0x26, 0x5f, 0x55, 0x45, 0x1b, 
+  0xe3, 0x2f, 0x36, 0x6b, 0xf4, 0x9b, 0x9a, 0x36, 0x83, 0x2e, 0xc2, 0x89, 0x9a, 0x8b, 0xa9, 0xb8, 
+  0x2e, 0xcb, 0x75, 0x7b, 0x89, 0xa9, 0xc8, 0xae, 0x57, 0x4e, 0x5d, 0x74, 0xa7, 0x97, 0xe3, 0xf6, 
+  0xf6, 0x96, 0x3b, 0x9a, 0xc6, 0x2b, 0x69, 0xee, 0xd1, 0xd7, 0xdb, 0x2c, 0xe7, 0x35, 0xbf, 0xce, 
+  0x8a, 0x92, 0xdf, 0xd1, 0x18, 0x8b, 0x94, 0xea, 0x37, 0x95, 0x98, 0x7b, 0xb7, 0xc0, 0x22, 0xc9, 
+  0x57, 0xb7, 0x71, 0x4e, 0x15, 0xf5, 0x08, 0x5a, 0xec, 0x52, 0xd1, 0x8d, 0x2c, 0xd6, 0x8b, 0x65, 
+  0x5c, 0x5c, 0x53, 0xdb, 0xf3, 0x84, 0x56, 0xbe, 0xa4, 0x8b, 0xab, 0xc5, 0x2c, 0xe1, 0xdf, 0x3c, 
+  0xdb, 0xa4, 0x73, 0x5c, 0xe5, 0x72, 0x19, 0xdf, 0xe1, 0xe2, 0x86, 0xf6, 0x0d, 0x7e, 0x4b, 0xb9, 
+  0x5a, 0xe3, 0xb7, 0x20, 0x68, 0x94, 0xe1, 0x50, 0x64, 0x8b, 0x45, 0x21, 0x55, 0x81, 0xbc, 0x20, 
+  0x60, 0x0e, 0xbd, 0x41, 0x9f, 0xfe, 0xe7, 0x89, 0x32, 0x59, 0xc9, 0xb7, 0x7f, 0x66, 0x29, 0x77, 
+  0x63, 0x9e, 0xd0, 0xeb, 0xd2, 0xed, 0xa9, 0x7e, 0x12, 0x97, 0x65, 0x3c, 0x7b, 0xf7, 0xb6, 0x58, 
+  0x65, 0x59, 0x89, 0x8d, 0xf5, 0x76, 0x11, 0x03, 0x59, 0x84, 0xfd, 0x4f, 0x4c, 0x89, 0xb9, 0x9c, 
+  0xc5, 0x77, 0x2d, 0x05, 0x06, 0x9f, 0x9a, 0x12, 0xab, 0x24, 0x7d, 0x3b, 0xbb, 0xa6, 0xcd, 0x2d, 
+  0xdf, 0xa2, 0xd1, 0xf0, 0xb3, 0xc1, 0x40, 0xe8, 0xfb, 0x15, 0x83, 0xf4, 0x62, 0xb3, 0x5c, 0x7a, 
+  0x3b, 0xc2, 0x18, 0xd5, 0x26, 0x7d, 0x53, 0xc6, 0xe5, 0xa6, 0x68, 0xd9, 0xa4, 0xbc, 0xbf, 0xd2, 
+  0x8f, 0xde, 0xab, 0x05, 0xd7, 0x73, 0x68, 0xaf, 0x8a, 0x7b, 0xd5, 0x81, 0xb3, 0xd7, 0xaf, 0x69, 
+  0x1d, 0x93, 0x45, 0xf2, 0x76, 0xb6, 0x4c, 0x68, 0x22, 0xdf, 0xd2, 0x16, 0x4f, 0x09, 0x74, 0x79, 
+  0xe5, 0x65, 0x79, 0x5d, 0xbb, 0x4f, 0x65, 0xfd, 0x7d, 0x91, 0xd3, 0x6e, 0xc7, 0xc2, 0x27, 0xeb, 
+  0x78, 0x3e, 0xcf, 0xa5, 0x82, 0xda, 0x35, 0x4d, 0x9b, 0x2c, 0xb1, 0xe3, 0x53, 0xcc, 0xbe, 0xbd, 
+  0xdd, 0xcc, 0x66, 0x28, 0x31, 0xb0, 0xdb, 0xb5, 0xd6, 0x94, 0x7e, 0xb6, 0xa2, 0x22, 0xf1, 0x55, 
+  0xb5, 0x4b, 0xdc, 0x32, 0x00, 0xcb, 0xeb, 0x6c, 0xc3, 0x9b, 0x61, 0x91, 0x4b, 0xf9, 0xf6, 0x5a, 
+  0xc6, 0x6b, 0x7a, 0x4e, 0x48, 0x64, 0x65, 0x5a, 0x53, 0xd7, 0xb6, 0xa9, 0x9c, 0x70, 0x89, 0x53, 
+  0x07, 0x6d, 0xcf, 0x78, 0x85, 0x4f, 0x6e, 0xb2, 0x65, 0xa9, 0x9b, 0x59, 0x27, 0xcb, 0xcc, 0x80, 
+  0xcf, 0x50, 0xff, 0x3e, 0xd1, 0xbf, 0x4f, 0x31, 0x48, 0x9a, 0x47, 0x89, 0x1e, 0x2e, 0xe3, 0x75, 
+  0xc1, 0xfd, 0xb8, 0x25, 0xd0, 0x28, 0xe4, 0x4c, 0x5f, 0x71, 0x8f, 0x14, 0x80, 0xce, 0x08, 0x36, 
+  0x51, 0x55, 0x9a, 0x5d, 0xa5, 0x73, 0x73, 0x53, 0x94, 0x9b, 0xd9, 0x3b, 0x73, 0xa3, 0xe0, 0x82, 
+  0xa7, 0x9e, 0xb6, 0x04, 0xef, 0x6c, 0xc0, 0xb4, 0xda, 0xd3, 0x16, 0x36, 0x72, 0xd5, 0x62, 0x7c, 
+  0x13, 0x27, 0x4b, 0x80, 0xe5, 0xdb, 0xd9, 0x26, 0xcf, 0x31, 0x3e, 0xec, 0x23, 0x06, 0x37, 0xda, 
+  0xb1, 0xad, 0x6f, 0x35, 0xdc, 0x6d, 0xd6, 0x73, 0x55, 0x85, 0x81, 0x65, 0x82, 0x90, 0x1b, 0x1e, 
+  0x6d, 0x56, 0xc6, 0xe6, 0x2d, 0xdd, 0x31, 0x50, 0x76, 0xec, 0x56, 0xe9, 0x0c, 0x77, 0x22, 0x25, 
+  0x7a, 0xd2, 0x4f, 0x8a, 0x9f, 0x93, 0x2f, 0x93, 0xb3, 0x3c, 0x27, 0xe2, 0xf8, 0x41, 0x78, 0x63, 
+  0x18, 0x22, 0x1a, 0x5a, 0xf6, 0x31, 0x2e, 0x3f, 0xd8, 0x99, 0x1a, 0x16, 0xc9, 0x73, 0x86, 0xa9, 
+  0x8f, 0xa8, 0xe2, 0xcd, 0xf9, 0x33, 0xb7, 0x8a, 0xed, 0x16, 0x4f, 0xba, 0xcf, 0x5e, 0x1d, 0xa8, 
+  0xf7, 0x19, 0xaf, 0xef, 0xab, 0x2c, 0xf9, 0xa8, 0xca, 0xeb, 0xd5, 0x3c, 0x5c, 0x77, 0x2e, 0xe7, 
+  0x1f, 0x51, 0x23, 0x97, 0xdb, 0xfb, 0x1e, 0x9b, 0x19, 0x7b, 0xec, 0xa1, 0x0a, 0x8a, 0xdb, 0x84, 
+  0xe8, 0xb4, 0x6f, 0xbe, 0x0b, 0xee, 0x67, 0xb4, 0x39, 0xd1, 0xc3, 0xd0, 0x74, 0x96, 0x87, 0x76, 
+  0xc4, 0x63, 0x3b, 0xf2, 0x9f, 0xbd, 0x0a, 0xbc, 0x11, 0x17, 0xc1, 0x0c, 0x99, 0x32, 0x6a, 0x5a, 
+  0x8f, 0x7c, 0x7a, 0xe6, 0xbc, 0xee, 0x3a, 0xb5, 0xe8, 0x12, 0xdd, 0xa3, 0x7a, 0x75, 0xaa, 0x94, 
+  0xf9, 0x46, 0x8d, 0x22, 0x74, 0xc7, 0x74, 0x74, 0x46, 0xb0, 0x95, 0xd3, 0x3e, 0xf7, 0x76, 0xfa, 
+  0xf1, 0x8f, 0xe9, 0xbb, 0x34, 0xbb, 0x4d, 0x8f, 0x7c, 0xaf, 0x6b, 0x3a, 0xdd, 0xf5, 0x02, 0x6f, 
+  0xa7, 0xd9, 0x0e, 0xc9, 0xdb, 0xe3, 0xa1, 0x11, 0x03, 0x79, 0xc9, 0x91, 0x1d, 0x37, 0x97, 0x37, 
+  0x03, 0x3f, 0x1a, 0x84, 0x32, 0xf2, 0x08, 0xe3, 0xe5, 0x25, 0x21, 0x50, 0x6f, 0x74, 0x99, 0xcb, 
+  0xf8, 0x1d, 0x77, 0xee, 0x68, 0x88, 0x37, 0xdf, 0x67, 0x25, 0x98, 0x16, 0xb5, 0x7b, 0x6b, 0xaf, 
+  0x9f, 0xe0, 0xf5, 0xd9, 0x4f, 0x07, 0xde, 0x3e, 0xc5, 0xdb, 0xe7, 0xd8, 0x4c, 0xcd, 0x6a, 0x3f, 
+  0xc1, 0x9b, 0x9f, 0x30, 0x37, 0xaf, 0xe5, 0x1f, 0x1b, 0x9e, 0x00, 0xf7, 0xf5, 0xa7, 0x78, 0xfd, 
+  0x02, 0x44, 0xe7, 0xe8, 0xf9, 0xb5, 0x9c, 0xbd, 0x3b, 0xfa, 0x92, 0x36, 0x59, 0xa3, 0xcc, 0x67, 
+  0x28, 0xf3, 0xd5, 0x97, 0xcf, 0x5f, 0xd2, 0xcb, 0xcd, 0xb2, 0xac, 0xbd, 0xfb, 0x6f, 0xd5, 0xeb, 
+  0xa3, 0x33, 0x1a, 0xd1, 0xf5, 0xd1, 0x57, 0x4c, 0xac, 0x6a, 0x05, 0xfe, 0x47, 0x0d, 0x98, 0x50, 
+  0x02, 0x75, 0x80, 0x08, 0x58, 0xed, 0xe5, 0xdf, 0x6c, 0xcd, 0x6f, 0xe4, 0x72, 0x71, 0x74, 0x4e, 
+  0x93, 0xdb, 0xd6, 0x81, 0x21, 0xcf, 0xda, 0x0f, 0xb4, 0xb3, 0xa9, 0xc8, 0x6a, 0x0d, 0x06, 0x99, 
+  0xe6, 0xbe, 0x5e, 0x64, 0x68, 0x8b, 0x3c, 0x57, 0xd8, 0xa1, 0x3e, 0x7b, 0x9f, 0xf2, 0x3c, 0xfc, 
+  0x1c, 0x27, 0x7b, 0xf3, 0xfe, 0xe4, 0x53, 0x3d, 0x07, 0x05, 0x13, 0x44, 0xf3, 0x6e, 0x2e, 0x17, 
+  0x18, 0x2c, 0x5e, 0xbd, 0x4c, 0x6f, 0xe2, 0x65, 0x32, 0x37, 0x10, 0x02, 0x76, 0xb8, 0xa2, 0x5e, 
+  0xc0, 0x1b, 0x6f, 0x66, 0x71, 0xfa, 0x5a, 0x16, 0x54, 0xfc, 0x00, 0x15, 0x1b, 0xb5, 0x71, 0xb3, 
+  0xf7, 0x20, 0x83, 0x02, 0x00, 0x92, 0x33, 0xab, 0x0c, 0x98, 0x9a, 0x1d, 0x82, 0x27, 0xda, 0x78, 
+  0xa0, 0x3d, 0x7e, 0x30, 0x52, 0x9d, 0xe8, 0x7d, 0x3a, 0x38, 0x8d, 0xe4, 0xf8, 0xd3, 0xb0, 0xf7, 
+  0x19, 0x5f, 0x7c, 0x42, 0x17, 0xff, 0x8d, 0x8b, 0xa7, 0x61, 0xef, 0xbf, 0xf9, 0xc9, 0x93, 0xb0, 
+  0xf7, 0x3f, 0x7c, 0x41, 0x38, 0xbe, 0xad, 0xc3, 0xff, 0x0b, 0x04, 0x97, 0x6a, 0xc1, 0xbe, 0xc8, 
+  0xa3, 0x7b, 0xf0, 0x4b, 0x2d, 0x32, 0x09, 0xd5, 0xb4, 0x29, 0x93, 0x65, 0xd1, 0xdf, 0xa4, 0xb7, 
+  0x44, 0x99, 0x7e, 0xa8, 0xd8, 0x74, 0xd9, 0xbf, 0x04, 0xe3, 0x1c, 0xec, 0xc4, 0x8c, 0xa6, 0x9b, 
+  0x90, 0x73, 0xcb, 0xd7, 0xa9, 0xbc, 0x3d, 0x3c, 0xbd, 0x7d, 0xf0, 0xd5, 0xc1, 0x8e, 0x24, 0x07, 
+  0x12, 0x1b, 0xf0, 0xae, 0x88, 0xf6, 0x27, 0x99, 0x58, 0xbb, 0x9c, 0x11, 0x55, 0xb2, 0x24, 0xb1, 
+  0x4a, 0xce, 0x5f, 0x7f, 0xb8, 0xe4, 0x41, 0xa9, 0x82, 0x5e, 0x2a, 0x3a, 0x12, 0xed, 0xad, 0xcd, 
+  0xe0, 0xe3, 0xc4, 0x9e, 0x81, 0x2b, 0xf6, 0x0c, 0xa6, 0xa1, 0x53, 0x0f, 0x86, 0x61, 0x9a, 0xf6, 
+  0x3b, 0x83, 0x40, 0x3c, 0xea, 0x5f, 0xc9, 0xd2, 0xa7, 0x57, 0xc2, 0x96, 0x4a, 0x83, 0xfb, 0x64, 
+  0xe1, 0x0f, 0x4e, 0x53, 0xdd, 0x46, 0x70, 0x9f, 0x46, 0x69, 0xbf, 0x20, 0x76, 0xb6, 0x5a, 0x21, 
+  0x96, 0xc5, 0xcc, 0x22, 0xf5, 0x31, 0xc3, 0x8c, 0xb3, 0x71, 0x31, 0x96, 0x0c, 0x41, 0xa7, 0x0a, 
+  0x90, 0x08, 0x2a, 0x7a, 0xb4, 0x65, 0xf8, 0xcd, 0xa9, 0x2e, 0x40, 0x0f, 0x86, 0xb4, 0x9c, 0xfb, 
+  0x93, 0x43, 0x72, 0x97, 0x99, 0xe4, 0x60, 0xa4, 0x86, 0x9c, 0xea, 0x39, 0xad, 0x9a, 0x2e, 0x85, 
+  0x5d, 0x39, 0x06, 0x3c, 0xd5, 0x0e, 0x49, 0x98, 0xd4, 0x03, 0x94, 0x4e, 0xe7, 0x2f, 0xd3, 0xb9, 
+  0x7c, 0xef, 0xb7, 0xc9, 0xb5, 0xa6, 0xa7, 0xaa, 0x3f, 0x04, 0xad, 0xc1, 0x83, 0xe3, 0x6a, 0x8e, 
+  0x83, 0x58, 0xbe, 0xb6, 0x0d, 0xb6, 0xb7, 0xee, 0x04, 0x2e, 0xc2, 0xfb, 0xbd, 0x20, 0xf9, 0x38, 
+  0xe8, 0xc7, 0xcb, 0xdb, 0xf8, 0xae, 0x70, 0x61, 0xdb, 0x5d, 0x01, 0x5a, 0x6e, 0x26, 0x72, 0xbb, 
+  0xfa, 0xbe, 0xd9, 0x93, 0x27, 0x45, 0x49, 0x42, 0x69, 0xae, 0xe0, 0x20, 0x51, 0x5b, 0x3d, 0xe9, 
+  0x5f, 0x12, 0x5a, 0x39, 0x4b, 0xe7, 0x6b, 0xa6, 0xd6, 0x52, 0x24, 0x7d, 0x25, 0x45, 0x92, 0x50, 
+  0x9b, 0xf4, 0x15, 0x93, 0x1a, 0xa5, 0xb8, 0x24, 0xb0, 0x8e, 0x72, 0x7d, 0xf1, 0x23, 0x40, 0xab, 
+  0x1d, 0xee, 0xa8, 0x80, 0x5c, 0x32, 0xca, 0xff, 0x5e, 0x96, 0xad, 0xef, 0x79, 0x2b, 0xed, 0x6d, 
+  0x5b, 0x9a, 0xaf, 0x78, 0x1e, 0xee, 0x6d, 0xde, 0xce, 0x90, 0x26, 0xba, 0x56, 0xa7, 0x1f, 0x8c, 
+  0x3d, 0x2f, 0x6c, 0x3c, 0x52, 0x95, 0xd2, 0x1c, 0x88, 0xdb, 0x3c, 0x69, 0xec, 0xcf, 0x45, 0x96, 
+  0xfb, 0x0a, 0x63, 0x0c, 0x46, 0xe5, 0xa9, 0x1a, 0x80, 0x01, 0x10, 0xfa, 0x52, 0x81, 0xe7, 0xa8, 
+  0xec, 0x76, 0x8d, 0x5e, 0xa0, 0x59, 0x64, 0x52, 0x4e, 0x47, 0x04, 0xcb, 0x0a, 0x34, 0x74, 0x43, 
+  0x81, 0x5e, 0x5e, 0xde, 0x38, 0xf5, 0xce, 0xa4, 0xb4, 0x0e, 0xbb, 0x6a, 0x22, 0x22, 0xb7, 0x2f, 
+  0xf5, 0x92, 0x92, 0xfa, 0x8b, 0x27, 0xe5, 0x1b, 0xcc, 0x48, 0xad, 0xdc, 0xc2, 0x6f, 0x1b, 0xf9, 
+  0x76, 0x0b, 0x0d, 0x48, 0x73, 0xec, 0xba, 0x47, 0xed, 0x03, 0x6d, 0x00, 0x55, 0x63, 0xc0, 0x7a, 
+  0x58, 0xbe, 0x1d, 0xf4, 0x5e, 0x71, 0x1a, 0xbc, 0x6d, 0xe1, 0xc1, 0x31, 0xa3, 0xf5, 0x8f, 0x9d, 
+  0xe2, 0xd1, 0x5e, 0xbb, 0xf9, 0xbf, 0xdd, 0x5e, 0xfd, 0x01, 0x14, 0x29, 0x3b, 0xde, 0xed, 0x59, 
+  0x94, 0x12, 0xa3, 0x27, 0xe2, 0xa8, 0x33, 0x1c, 0x31, 0x04, 0xe7, 0x25, 0x50, 0xb2, 0x8b, 0x07, 
+  0xeb, 0x40, 0x8c, 0x69, 0xf5, 0xa9, 0xf8, 0xa0, 0x01, 0xdc, 0x8c, 0xd9, 0x50, 0x17, 0x4d, 0x79, 
+  0x76, 0x7c, 0xec, 0xcf, 0x96, 0x32, 0xce, 0xcf, 0x89, 0x25, 0xcf, 0x36, 0xa5, 0x9f, 0x05, 0x42, 
+  0x35, 0x14, 0xe8, 0xaf, 0x34, 0xba, 0x75, 0xb7, 0x28, 0x0d, 0x32, 0xa6, 0xef, 0xb2, 0x88, 0x56, 
+  0xd8, 0x7c, 0xe7, 0xf4, 0x48, 0x3c, 0x95, 0x4f, 0x83, 0x40, 0x78, 0x1e, 0xaf, 0xb3, 0x81, 0x2b, 
+  0xb3, 0x88, 0x32, 0x32, 0x3b, 0x51, 0xcf, 0x86, 0xf8, 0xdf, 0x81, 0x5f, 0x03, 0x2c, 0xa6, 0xc5, 
+  0x0a, 0xa2, 0x15, 0x2b, 0xb1, 0xdb, 0x35, 0x67, 0x81, 0x66, 0x36, 0x50, 0x80, 0x5a, 0x66, 0xeb, 
+  0xe6, 0x54, 0x62, 0x9a, 0xc5, 0xfe, 0x7c, 0x7e, 0x78, 0xda, 0x50, 0xa1, 0x92, 0xea, 0xeb, 0x55, 
+  0x12, 0xf0, 0xcb, 0xb1, 0x33, 0x4b, 0x7e, 0x10, 0x56, 0x2d, 0xfb, 0xfc, 0x19, 0x4d, 0xd1, 0x4c, 
+  0x2a, 0xe4, 0xd6, 0x8a, 0x60, 0xa8, 0xa0, 0x7a, 0x4b, 0xf8, 0xe5, 0xc3, 0xec, 0x41, 0xc7, 0x37, 
+  0x78, 0xce, 0x95, 0xab, 0x30, 0x88, 0xa4, 0x0f, 0xc9, 0x5b, 0xb3, 0xb0, 0x7a, 0x60, 0xb5, 0xb2, 
+  0xb4, 0x4f, 0x68, 0xde, 0x68, 0x8c, 0x9d, 0xda, 0x63, 0x23, 0x58, 0xa9, 0xf2, 0x4e, 0x6f, 0xa9, 
+  0x30, 0x23, 0x86, 0x7a, 0xb5, 0x1f, 0x1c, 0x43, 0xbf, 0xd8, 0x5c, 0x16, 0xb3, 0x3c, 0xb9, 0x94, 
+  0x7e, 0x1d, 0x97, 0x54, 0xf3, 0x07, 0x54, 0x12, 0x58, 0x84, 0xdd, 0x6f, 0xd5, 0x18, 0x1c, 0xa8, 
+  0x46, 0x1e, 0x1f, 0xef, 0x0d, 0x94, 0xd7, 0xbc, 0xb6, 0x40, 0x7e, 0xbd, 0x4b, 0x34, 0x12, 0xb4, 
+  0x16, 0xdf, 0x48, 0xda, 0x7c, 0xb7, 0x59, 0xfe, 0xee, 0xcb, 0xc3, 0x9c, 0x48, 0xad, 0xdc, 0x1b, 
+  0x25, 0xfb, 0x7f, 0xa8, 0x98, 0x0b, 0x62, 0x7a, 0x83, 0xd4, 0x36, 0xc3, 0x38, 0x5e, 0x92, 0xe0, 
+  0xec, 0x7b, 0xaf, 0x08, 0xb8, 0xa0, 0xe4, 0x66, 0x4c, 0x40, 0x2c, 0x18, 0x7f, 0xec, 0x05, 0xa1, 
+  0xdf, 0xda, 0x39, 0xde, 0xd1, 0x6d, 0xdd, 0xe1, 0x0e, 0x3c, 0xea, 0xaf, 0xb3, 0x02, 0x3b, 0xd4, 
+  0xa5, 0x88, 0x8a, 0x75, 0xa4, 0x0f, 0x4c, 0xdd, 0x5a, 0x85, 0xda, 0xdc, 0x9c, 0xac, 0x13, 0xb4, 
+  0x0f, 0x71, 0x07, 0x58, 0xad, 0xe3, 0x9c, 0x07, 0xd6, 0x46, 0xcf, 0x80, 0x0b, 0x2b, 0xea, 0x49, 
+  0x73, 0x61, 0x0e, 0x0e, 0x60, 0x00, 0x36, 0x64, 0x41, 0xd2, 0x88, 0x0b, 0xe1, 0x7a, 0x96, 0x94, 
+  0x90, 0x72, 0x54, 0x66, 0x47, 0xf8, 0x92, 0x79, 0x83, 0x23, 0xad, 0x2b, 0xc6, 0x57, 0xfb, 0xcc, 
+  0xc5, 0x81, 0xd9, 0xb3, 0x98, 0x00, 0xfb, 0xe6, 0x87, 0xc5, 0xc2, 0x91, 0xf3, 0x1f, 0x5c, 0xff, 
+  0xfd, 0xe2, 0x0f, 0x81, 0xc1, 0x7e, 0xe9, 0x3a, 0xee, 0x3e, 0xdc, 0xb8, 0x9e, 0x9e, 0x83, 0xcd, 
+  0x7d, 0x60, 0x99, 0xe3, 0x75, 0xb6, 0x58, 0x78, 0x90, 0x74, 0xdc, 0xfd, 0x01, 0x4b, 0x44, 0xb6, 
+  0x94, 0xfd, 0x65, 0x76, 0x45, 0xb7, 0x84, 0xae, 0x15, 0x05, 0xd6, 0xdb, 0xdd, 0x68, 0xd6, 0x08, 
+  0x24, 0x1d, 0x2c, 0xef, 0xf4, 0xf7, 0x96, 0x58, 0xc9, 0xec, 0x96, 0xbe, 0x9e, 0xc5, 0x78, 0x12, 
+  0x79, 0x27, 0x27, 0x5e, 0xb7, 0xed, 0xfb, 0x87, 0x3b, 0x4e, 0xcb, 0xcb, 0xf4, 0x22, 0xfc, 0x50, 
+  0xa9, 0x8f, 0x00, 0x02, 0x26, 0xaa, 0x34, 0xd4, 0x9a, 0xf6, 0xe1, 0x20, 0x24, 0x3c, 0x34, 0xdd, 
+  0xc3, 0x3a, 0xd3, 0xf9, 0x4a, 0x2b, 0x9b, 0x2b, 0x96, 0xb3, 0xb4, 0x02, 0x21, 0x98, 0x4d, 0xc2, 
+  0x64, 0xd7, 0xd9, 0x6d, 0xcb, 0xa2, 0xcb, 0x3e, 0xc9, 0xac, 0x1b, 0x59, 0x93, 0x29, 0x0f, 0x30, 
+  0x84, 0x47, 0xaa, 0x12, 0x3f, 0x80, 0x95, 0x28, 0x29, 0x5e, 0x6c, 0x56, 0xab, 0x3b, 0xc5, 0x12, 
+  0x96, 0xed, 0xec, 0x1f, 0xb3, 0x59, 0x3b, 0xb4, 0xa1, 0x4b, 0x1f, 0x92, 0x5c, 0x55, 0xfd, 0x13, 
+  0xef, 0xed, 0xdb, 0xb7, 0x2f, 0x7e, 0xfc, 0xee, 0xbb, 0x5f, 0xdf, 0xbe, 0x7a, 0xf6, 0xe6, 0xcd, 
+  0xcf, 0x3f, 0xbc, 0x7e, 0x41, 0x0f, 0x3c, 0xe1, 0x35, 0x1e, 0x7a, 0xd3, 0x7e, 0x92, 0xce, 0x96, 
+  0x9b, 0xb9, 0x2c, 0xfc, 0x92, 0x11, 0x7b, 0xd3, 0x90, 0x03, 0xf5, 0xc2, 0xda, 0x99, 0x0a, 0x21, 
+  0x0d, 0x81, 0xe6, 0xc9, 0x48, 0x1f, 0x92, 0xde, 0x88, 0x4e, 0x1f, 0xdc, 0x21, 0x69, 0xcb, 0x64, 
+  0x49, 0x3c, 0x7e, 0xcb, 0x82, 0x7f, 0x43, 0xe6, 0xd3, 0x44, 0x6e, 0xb0, 0x43, 0x81, 0x79, 0x96, 
+  0x1e, 0x7e, 0x09, 0xb8, 0x89, 0x3e, 0x88, 0x3c, 0x2c, 0xde, 0xc0, 0x27, 0x0a, 0x5e, 0x0e, 0xd5, 
+  0xc8, 0xdd, 0x6c, 0xa3, 0x3a, 0x24, 0x0b, 0x9a, 0xf1, 0x69, 0x52, 0x93, 0x32, 0xc2, 0xd9, 0x97, 
+  0x55, 0x75, 0x25, 0x7e, 0x30, 0x72, 0x86, 0x47, 0xa3, 0x25, 0x9a, 0x9b, 0xd6, 0x45, 0xd0, 0x5a, 
+  0x8d, 0xb4, 0xc9, 0xe3, 0xdf, 0xe3, 0xf7, 0x7e, 0xe9, 0x9a, 0xc5, 0xc4, 0xfd, 0x4a, 0x96, 0xd7, 
+  0xd9, 0x3c, 0xf4, 0x5e, 0xfd, 0xf0, 0xe6, 0xdc, 0x13, 0x10, 0xc9, 0xc3, 0x6f, 0xde, 0xfc, 0xf0, 
+  0x3d, 0x74, 0x1a, 0x54, 0x4d, 0xb2, 0xb8, 0xc3, 0x3c, 0x52, 0xe9, 0x92, 0x70, 0xf3, 0xf9, 0xdd, 
+  0x5a, 0x86, 0x1e, 0x09, 0x69, 0xcb, 0x44, 0xed, 0xdc, 0x13, 0x16, 0xc5, 0x68, 0x93, 0x60, 0x12, 
+  0x0f, 0x8c, 0x85, 0xfb, 0xc1, 0xb3, 0xec, 0xdb, 0x9d, 0xa8, 0x67, 0xb6, 0x6d, 0x73, 0xa5, 0x75, 
+  0x19, 0xce, 0x4e, 0xa8, 0xaf, 0xf0, 0x2c, 0x0f, 0xbe, 0xb1, 0xa0, 0x8e, 0xbe, 0xc1, 0x59, 0x6f, 
+  0xc9, 0xda, 0x3e, 0x7c, 0x51, 0x5f, 0xe1, 0x5a, 0x69, 0x7e, 0x55, 0x95, 0xac, 0x2f, 0x77, 0xad, 
+  0x24, 0xbf, 0xaa, 0x4a, 0x36, 0x57, 0xb9, 0x56, 0x56, 0xbf, 0xd4, 0xa5, 0x77, 0x9d, 0xba, 0x10, 
+  0xec, 0x65, 0x97, 0xb0, 0xb4, 0x81, 0x82, 0xfb, 0xde, 0x86, 0x24, 0x6a, 0x92, 0xac, 0x59, 0x35, 
+  0xab, 0x6d, 0xb5, 0xab, 0x6c, 0xbe, 0x59, 0xca, 0xb1, 0xf3, 0x2a, 0x34, 0xf6, 0x69, 0xf5, 0x0a, 
+  0xec, 0x95, 0x53, 0x49, 0xfd, 0x65, 0x5f, 0xbe, 0x87, 0x7d, 0xac, 0x08, 0xc6, 0xf5, 0x7b, 0x92, 
+  0xcc, 0xe7, 0xd9, 0x8c, 0x55, 0x17, 0x63, 0xda, 0xfe, 0x82, 0xd6, 0x25, 0x6c, 0x4a, 0x57, 0x55, 
+  0x91, 0xa0, 0xbc, 0xce, 0xb3, 0x5b, 0xd6, 0xdf, 0x28, 0xd6, 0xcf, 0xfb, 0xfd, 0x1f, 0x1b, 0x99, 
+  0xdf, 0x1d, 0xe5, 0x4a, 0x05, 0x59, 0x1c, 0xc5, 0x47, 0x0a, 0x8b, 0xd3, 0x4f, 0x79, 0x4d, 0x77, 
+  0xe6, 0x4b, 0xcf, 0xe8, 0xb7, 0x8e, 0x18, 0xc9, 0x84, 0xfc, 0xd7, 0x1d, 0x67, 0xc7, 0x8c, 0x53, 
+  0x7d, 0x3f, 0x56, 0x3f, 0xa1, 0xd2, 0xb6, 0x54, 0x54, 0xe6, 0x1c, 0xa8, 0xc1, 0x62, 0x8f, 0x1b, 
+  0x77, 0x82, 0x99, 0x8f, 0x96, 0x4a, 0x2f, 0x21, 0xfb, 0xea, 0xfb, 0x9d, 0x12, 0xf2, 0xa0, 0x04, 
+  0x8a, 0x7e, 0xe0, 0xa9, 0x81, 0xfa, 0xe5, 0x95, 0x31, 0x88, 0xff, 0xb0, 0x10, 0x05, 0xb4, 0x28, 
+  0x04, 0xb8, 0x52, 0x90, 0x1c, 0xdf, 0x5f, 0x2c, 0xe3, 0xb2, 0xd5, 0x40, 0xcf, 0x6f, 0x94, 0xc5, 
+  0x09, 0xdd, 0x6f, 0x2d, 0x42, 0xdb, 0x81, 0xe0, 0xbf, 0x8f, 0x8d, 0x70, 0x07, 0xbd, 0x13, 0x64, 
+  0xd6, 0x0d, 0x55, 0xba, 0xde, 0x14, 0xd7, 0x22, 0xa1, 0x8b, 0x04, 0x7a, 0x12, 0x6a, 0x33, 0x8d, 
+  0x88, 0x70, 0x12, 0x73, 0xdf, 0x2f, 0xb3, 0x37, 0xbc, 0x9f, 0xc4, 0x8a, 0x6e, 0xae, 0xe3, 0xe2, 
+  0x87, 0xdb, 0x94, 0xfa, 0xb6, 0x26, 0x64, 0x72, 0x47, 0x52, 0xd9, 0xaa, 0x7a, 0x3f, 0x8b, 0x62, 
+  0xd5, 0xb8, 0x1a, 0x44, 0x20, 0x2e, 0x51, 0xc5, 0x5d, 0x0b, 0xa0, 0xb5, 0xb8, 0x0a, 0xc0, 0x81, 
+  0x20, 0xdd, 0xac, 0x2e, 0x65, 0x5e, 0xcd, 0xb2, 0xec, 0xc3, 0x12, 0x8d, 0x9d, 0xbb, 0x13, 0xef, 
+  0xa2, 0x73, 0xbb, 0xc2, 0x62, 0x19, 0xdd, 0xa3, 0x08, 0x0c, 0x4c, 0x45, 0x3e, 0xc3, 0x4f, 0x4a, 
+  0xc3, 0x92, 0xea, 0xe2, 0x3b, 0x86, 0x1d, 0xba, 0xde, 0x55, 0x4e, 0x12, 0xb7, 0x4a, 0x59, 0xa2, 
+  0xd0, 0x50, 0x2e, 0x12, 0x1a, 0x18, 0xc9, 0xaa, 0xe9, 0x76, 0xfb, 0x2e, 0xe8, 0x2b, 0x15, 0xe0, 
+  0xd9, 0x52, 0xa2, 0x6a, 0xdf, 0x03, 0x72, 0x5b, 0x03, 0x14, 0x08, 0xaa, 0xb2, 0x7e, 0x29, 0xdf, 
+  0x43, 0x8b, 0x52, 0xb2, 0x1c, 0x97, 0x1f, 0x25, 0xe9, 0xd1, 0x32, 0xf0, 0x69, 0x9a, 0x26, 0xf9, 
+  0x74, 0xbb, 0xe5, 0x75, 0x7a, 0x56, 0xd2, 0xe8, 0x2f, 0x09, 0x6b, 0x1f, 0x1f, 0xd7, 0xef, 0xfd, 
+  0x1c, 0xc0, 0x9e, 0x41, 0x1f, 0xe0, 0x3c, 0x13, 0x09, 0x70, 0xdf, 0x35, 0xd1, 0x42, 0xac, 0x81, 
+  0x4c, 0xe7, 0xcf, 0xaf, 0x93, 0xe5, 0x9c, 0x04, 0x29, 0x62, 0x32, 0xa1, 0x38, 0xfe, 0x9e, 0x46, 
+  0xcc, 0xae, 0x08, 0x37, 0xd2, 0xbc, 0xa9, 0x08, 0xd1, 0xfb, 0x06, 0x28, 0x11, 0x0c, 0x8d, 0x65, 
+  0x97, 0x68, 0x65, 0xcb, 0x96, 0x92, 0x30, 0xbd, 0xb4, 0xcc, 0xf3, 0x38, 0x9d, 0x64, 0x06, 0x46, 
+  0x68, 0x0c, 0xe6, 0xcb, 0xb0, 0xfa, 0x8e, 0xe1, 0x71, 0x11, 0x79, 0x4f, 0xfb, 0x9f, 0xc2, 0x7e, 
+  0x7b, 0x66, 0x17, 0xf0, 0x48, 0xfa, 0x3c, 0x89, 0x8e, 0x86, 0x54, 0xf6, 0x17, 0x29, 0x81, 0x4c, 
+  0x52, 0xf2, 0x1b, 0x67, 0xc6, 0xe7, 0x95, 0x62, 0xb7, 0xd3, 0xc1, 0xe2, 0x2a, 0xb9, 0xd6, 0x4b, 
+  0xd8, 0x57, 0x44, 0x6a, 0x31, 0x97, 0xa0, 0x0c, 0x63, 0xd2, 0xdb, 0xae, 0x73, 0xc7, 0xa4, 0xa0, 
+  0x73, 0xa3, 0x28, 0x82, 0x17, 0xe7, 0x79, 0x7c, 0x87, 0x31, 0xd1, 0x42, 0x0d, 0xa0, 0x4a, 0xa4, 
+  0xee, 0x6a, 0x18, 0xb1, 0xe3, 0x29, 0x8f, 0x8f, 0x07, 0xa7, 0xf4, 0xa7, 0xec, 0x0d, 0xb1, 0x3a, 
+  0xd4, 0xfb, 0x33, 0xea, 0x52, 0x74, 0x56, 0x39, 0x94, 0x44, 0xf7, 0xbf, 0xff, 0x81, 0xfd, 0x1f, 
+  0x2e, 0x84, 0xe3, 0x85, 0x12, 0x9e, 0x09, 0xd5, 0x05, 0xd8, 0x1e, 0xb3, 0x67, 0x68, 0xa9, 0x85, 
+  0x39, 0x29, 0x2a, 0x5f, 0x0b, 0xda, 0x27, 0xb4, 0xba, 0xad, 0x9a, 0x62, 0xbd, 0x12, 0x6e, 0xe1, 
+  0x50, 0x9e, 0x0e, 0xc6, 0xb8, 0x9a, 0xc8, 0x2e, 0x5b, 0x6e, 0x54, 0x63, 0xd3, 0x50, 0x3d, 0x9b, 
+  0xee, 0x04, 0x36, 0xdc, 0x1b, 0xd8, 0xbc, 0x6b, 0x55, 0xaa, 0x19, 0x3b, 0xeb, 0xaf, 0x64, 0x7e, 
+  0x25, 0xb9, 0x2a, 0xd7, 0x75, 0x86, 0xb8, 0x4a, 0x59, 0xe1, 0x28, 0x1a, 0xa2, 0xbc, 0x51, 0x7b, 
+  0x4d, 0x29, 0xcf, 0xcb, 0x9d, 0x90, 0xf1, 0xec, 0xba, 0xad, 0x8f, 0x67, 0x7d, 0xbc, 0x51, 0x4e, 
+  0x23, 0xd8, 0xf2, 0xab, 0x78, 0x1d, 0xba, 0xba, 0x5d, 0x53, 0x27, 0x1a, 0xb4, 0x3d, 0xf3, 0xcf, 
+  0xa0, 0xd6, 0x54, 0x1f, 0xb5, 0x2a, 0x43, 0x53, 0x0d, 0x48, 0x02, 0xcc, 0x10, 0xd3, 0x38, 0xc6, 
+  0x52, 0x2d, 0x13, 0xd9, 0xa8, 0xb8, 0xd0, 0x08, 0x88, 0xab, 0xb6, 0x6a, 0x69, 0x54, 0xb0, 0x48, 
+  0xf2, 0xa2, 0x3c, 0x54, 0x81, 0xfc, 0xc3, 0x07, 0xe3, 0xbc, 0x8c, 0x1f, 0x2c, 0xd2, 0x23, 0x16, 
+  0x44, 0x48, 0x12, 0xf1, 0x3e, 0xdc, 0x8f, 0xb3, 0xfe, 0x55, 0x2e, 0x1f, 0x18, 0xa1, 0x5f, 0x76, 
+  0x87, 0xc1, 0x7f, 0x3d, 0xe1, 0xa1, 0x65, 0xf3, 0xf9, 0xff, 0x7d, 0x85, 0x47, 0xa5, 0xae, 0x4d, 
+  0xfe, 0xd1, 0xb2, 0xee, 0x0e, 0xa4, 0xd0, 0xce, 0xe8, 0xca, 0xae, 0xcf, 0x60, 0x14, 0x0e, 0xaa, 
+  0x45, 0xaf, 0x37, 0x37, 0x38, 0x8d, 0xd2, 0xe3, 0xe3, 0xf4, 0xb4, 0x1c, 0x4f, 0x18, 0xb0, 0xd2, 
+  0xe9, 0x34, 0x9c, 0x4c, 0x51, 0x7d, 0x7a, 0xb8, 0xb3, 0x16, 0x6a, 0x08, 0x83, 0xed, 0x01, 0x98, 
+  0x02, 0xcc, 0x70, 0x23, 0xa0, 0x02, 0x0f, 0x4b, 0xd6, 0x84, 0x8b, 0x62, 0xcd, 0xcb, 0x4a, 0x77, 
+  0x7c, 0xb1, 0x13, 0x04, 0x4e, 0xef, 0x89, 0xab, 0x9a, 0x47, 0xd8, 0x6c, 0xe6, 0xba, 0xc9, 0xed, 
+  0x29, 0xf5, 0x34, 0x90, 0x2d, 0xd1, 0x09, 0xd7, 0xf6, 0xb0, 0xdd, 0x12, 0x5d, 0x28, 0xa2, 0x21, 
+  0x11, 0x9e, 0xa6, 0xe9, 0x82, 0x88, 0x48, 0x67, 0x38, 0x02, 0xb2, 0xf5, 0x2e, 0x33, 0x12, 0xd3, 
+  0x62, 0x07, 0x75, 0x41, 0xf9, 0x46, 0x34, 0xa6, 0x56, 0x59, 0xa1, 0x2b, 0xeb, 0x76, 0x49, 0x94, 
+  0xdb, 0x47, 0x82, 0x31, 0x21, 0xc1, 0x3b, 0xfe, 0xeb, 0xc7, 0x44, 0x8c, 0x02, 0x6a, 0x35, 0x8a, 
+  0x36, 0x54, 0x4f, 0xac, 0x76, 0x4c, 0xd1, 0xeb, 0x05, 0xa3, 0xe2, 0x74, 0x33, 0x42, 0x05, 0x84, 
+  0xf0, 0x15, 0x7d, 0xf6, 0x65, 0xad, 0x05, 0xa5, 0xc4, 0x2b, 0x15, 0x7a, 0xc9, 0x23, 0x39, 0x29, 
+  0xa7, 0x24, 0x3e, 0x28, 0x1f, 0x1e, 0x12, 0x25, 0x48, 0x7e, 0x24, 0xfc, 0x13, 0xd3, 0x4f, 0x8e, 
+  0x0e, 0x1e, 0x1f, 0xe3, 0xe7, 0x8c, 0xa4, 0x93, 0x57, 0xcb, 0x38, 0x49, 0xd5, 0x4c, 0x13, 0x2d, 
+  0xa0, 0x2e, 0x24, 0x11, 0xe3, 0x19, 0x7a, 0xc5, 0xbf, 0x20, 0x10, 0xc1, 0x98, 0xe8, 0x50, 0x8c, 
+  0x1a, 0xb3, 0x28, 0x21, 0xd4, 0x57, 0x2f, 0x90, 0x06, 0xe3, 0xc9, 0x34, 0x4c, 0xb6, 0xdb, 0x66, 
+  0x75, 0xf4, 0x22, 0x0d, 0x69, 0xdc, 0x09, 0xd4, 0x75, 0xf8, 0x3c, 0x32, 0x2b, 0xe2, 0xcf, 0x68, 
+  0xba, 0xa9, 0xe2, 0xd0, 0x9a, 0x80, 0xd0, 0x1d, 0x2e, 0x42, 0x4f, 0x0d, 0x18, 0xc5, 0xd5, 0x12, 
+  0xfa, 0xf7, 0xc4, 0x65, 0xc5, 0xc4, 0x87, 0x84, 0x9a, 0x4f, 0xf2, 0xba, 0xfe, 0xa2, 0xfb, 0x5d, 
+  0x5c, 0x5e, 0xf7, 0x73, 0x3c, 0x5e, 0x91, 0x30, 0x44, 0x04, 0x69, 0xbd, 0x8c, 0x67, 0xd2, 0x3f, 
+  0xb9, 0x78, 0x71, 0x72, 0x45, 0x32, 0x33, 0x49, 0xb7, 0xc5, 0x6b, 0xa2, 0x61, 0x77, 0x20, 0xb9, 
+  0x12, 0x5c, 0x56, 0x5d, 0x46, 0x6b, 0x70, 0x60, 0xc0, 0x38, 0x69, 0x96, 0xad, 0x6b, 0x46, 0x27, 
+  0x51, 0x1b, 0xd2, 0xfe, 0x6e, 0x10, 0xa9, 0x21, 0x0b, 0xc4, 0xdd, 0x11, 0xe6, 0x9f, 0xa8, 0xe5, 
+  0x3d, 0x52, 0xe5, 0xa7, 0x98, 0x77, 0x4b, 0xc8, 0x58, 0x69, 0xe7, 0x97, 0x11, 0x9a, 0x6a, 0xa5, 
+  0x7b, 0x34, 0xcb, 0x2b, 0xe3, 0x8b, 0xe3, 0x39, 0x00, 0xef, 0x05, 0x20, 0xdb, 0xce, 0x03, 0xba, 
+  0xd7, 0x5c, 0x4c, 0x1a, 0x10, 0xac, 0xcc, 0xa0, 0x1f, 0x29, 0xce, 0x56, 0xeb, 0xf2, 0xee, 0x50, 
+  0x3f, 0x47, 0x2e, 0x74, 0x68, 0x23, 0xc7, 0xa8, 0x92, 0x9b, 0xae, 0x96, 0xd9, 0x65, 0xbc, 0x3c, 
+  0x23, 0xde, 0x3e, 0x74, 0x11, 0x02, 0xe8, 0x28, 0xb8, 0x92, 0x7b, 0xc5, 0xb9, 0x80, 0x82, 0xf5, 
+  0xf9, 0x12, 0x3e, 0x21, 0x7b, 0x78, 0xdc, 0x3a, 0x39, 0x12, 0x8b, 0x38, 0x00, 0x67, 0x02, 0xf2, 
+  0xca, 0x60, 0x99, 0x46, 0x86, 0x96, 0x8e, 0xf2, 0x53, 0xc2, 0x05, 0x9d, 0x21, 0xe0, 0x51, 0xcf, 
+  0x0b, 0x71, 0x29, 0xb4, 0x01, 0xf1, 0x43, 0x2b, 0x4f, 0x10, 0x3e, 0x92, 0xcb, 0x42, 0x1e, 0x59, 
+  0x56, 0x46, 0x06, 0xc6, 0x2e, 0xd1, 0xf2, 0x41, 0xa0, 0x2c, 0xd1, 0xd6, 0xea, 0x4c, 0x24, 0xe3, 
+  0x9d, 0x6c, 0xd0, 0x49, 0xc7, 0xf9, 0x92, 0x90, 0xc9, 0x64, 0x3a, 0x6a, 0xb2, 0xb9, 0xd4, 0x4f, 
+  0x0d, 0xb1, 0xd4, 0xdd, 0xb1, 0x21, 0x6b, 0xa9, 0xf0, 0x94, 0x88, 0xe6, 0xb2, 0x25, 0x44, 0x14, 
+  0x43, 0x19, 0x84, 0x1b, 0x3d, 0xf9, 0x44, 0x50, 0x48, 0x82, 0xa2, 0xc9, 0x4f, 0xf7, 0xdb, 0x74, 
+  0x79, 0x10, 0xa6, 0xbd, 0x25, 0xac, 0x87, 0x89, 0x59, 0x5f, 0xc9, 0x33, 0xc8, 0x4d, 0x35, 0xba, 
+  0x6a, 0x94, 0xf1, 0x84, 0x5b, 0x4b, 0x83, 0x70, 0x68, 0x42, 0x69, 0x1b, 0xb9, 0x93, 0xc8, 0x53, 
+  0x25, 0x27, 0x49, 0xb7, 0x3b, 0x65, 0x46, 0xcf, 0xce, 0x81, 0x2e, 0x13, 0x25, 0x82, 0xa6, 0x03, 
+  0x78, 0x7e, 0xaf, 0x57, 0xa6, 0x81, 0x1c, 0xdc, 0x7c, 0x42, 0x35, 0x67, 0xb6, 0x66, 0x58, 0x30, 
+  0xd2, 0x51, 0x72, 0x9a, 0x8d, 0xa8, 0xe2, 0xa0, 0x43, 0x33, 0x32, 0x49, 0xa8, 0x4c, 0xd0, 0x89, 
+  0x08, 0xaf, 0xe5, 0x8c, 0xd3, 0xf9, 0x91, 0xdd, 0xa3, 0x79, 0x83, 0x4a, 0xef, 0x71, 0xb0, 0x03, 
+  0xaa, 0x72, 0x32, 0xad, 0x41, 0x43, 0x5e, 0x0d, 0x24, 0x3b, 0xcd, 0x47, 0x19, 0xb5, 0xa4, 0x51, 
+  0x1a, 0xf1, 0xac, 0x54, 0x7d, 0x46, 0x78, 0x86, 0x2a, 0x61, 0x20, 0xe7, 0x16, 0x13, 0x07, 0x26, 
+  0x32, 0x05, 0x13, 0x1f, 0xfc, 0x40, 0xf7, 0xef, 0x8a, 0xf0, 0x2a, 0x4d, 0xc3, 0x26, 0x99, 0xc3, 
+  0xb9, 0x4a, 0xb9, 0x36, 0x86, 0x97, 0x84, 0x63, 0x1f, 0x70, 0x04, 0xf6, 0x41, 0x2f, 0x26, 0x0d, 
+  0x67, 0x63, 0xcc, 0x72, 0xf3, 0x51, 0x20, 0x34, 0xc7, 0xe2, 0x7d, 0xa1, 0xc8, 0xc0, 0xd1, 0xf7, 
+  0xcc, 0xf8, 0x1d, 0x29, 0x59, 0xe3, 0xe8, 0x4b, 0xc3, 0x67, 0x32, 0x74, 0x1c, 0xbd, 0x20, 0x0e, 
+  0xfe, 0xe8, 0xb5, 0xbc, 0x3a, 0x7b, 0xbf, 0xd6, 0xf8, 0x41, 0x61, 0x1e, 0xdd, 0xb0, 0xc7, 0x84, 
+  0x8b, 0x98, 0xfb, 0x23, 0x2f, 0x68, 0x90, 0xe5, 0x74, 0x62, 0x11, 0x8b, 0xd7, 0x2d, 0xbb, 0xde, 
+  0xd4, 0xa3, 0xee, 0x90, 0x4c, 0xf3, 0x6d, 0x76, 0x2b, 0xf3, 0xe7, 0x71, 0xc1, 0x92, 0x3f, 0x1b, 
+  0xa2, 0xd6, 0x91, 0xcb, 0x30, 0x59, 0x46, 0x77, 0xe1, 0xee, 0x02, 0x6f, 0xf0, 0xde, 0xeb, 0x4a, 
+  0x25, 0xab, 0xf9, 0xc3, 0xa0, 0xf7, 0xd9, 0xa7, 0x9f, 0x3e, 0xfd, 0xcc, 0xd2, 0x6e, 0x22, 0x01, 
+  0x29, 0xd1, 0x73, 0x35, 0x04, 0xb6, 0x14, 0xc3, 0x69, 0xe6, 0x39, 0xbc, 0x7c, 0xb8, 0x60, 0x37, 
+  0x0d, 0xc2, 0xb6, 0x97, 0xe9, 0xe7, 0x9f, 0x0f, 0x07, 0xdb, 0x4f, 0x3f, 0x7d, 0xf2, 0xb7, 0xcf, 
+  0xc4, 0x70, 0xf0, 0xe4, 0xe9, 0x71, 0xba, 0xfd, 0xf4, 0xb3, 0xa7, 0x4f, 0x06, 0x81, 0x23, 0x1a, 
+  0x24, 0x84, 0x52, 0x9f, 0xfb, 0x8a, 0x77, 0x97, 0x62, 0x2d, 0x6e, 0x41, 0x75, 0xc5, 0xb5, 0x98, 
+  0x8b, 0x1b, 0xf1, 0x5e, 0x6c, 0xc4, 0x4c, 0x3c, 0x17, 0xe7, 0xa2, 0x10, 0xef, 0xc4, 0x95, 0x58, 
+  0x8a, 0x95, 0xb8, 0x24, 0xbe, 0xde, 0x2b, 0x92, 0x3f, 0xff, 0x5c, 0x4a, 0xaf, 0x3b, 0x7c, 0x0c, 
+  0x5c, 0x8d, 0x49, 0x24, 0x71, 0x2d, 0xad, 0xe4, 0xac, 0x37, 0x04, 0x63, 0xd8, 0x1f, 0xdf, 0x47, 
+  0xd0, 0xd9, 0x88, 0xb7, 0xea, 0xe7, 0x99, 0xfa, 0x79, 0xa1, 0x7e, 0x7e, 0x88, 0xda, 0xed, 0xe4, 
+  0x11, 0x93, 0x45, 0x22, 0xd8, 0xd0, 0xa2, 0x10, 0x1e, 0xfc, 0x9d, 0xe8, 0x6f, 0x53, 0x7c, 0x64, 
+  0xa1, 0xf7, 0x0f, 0x48, 0x9f, 0xd9, 0x5a, 0x7c, 0x67, 0xa4, 0xd0, 0x6f, 0xcd, 0xc5, 0x2b, 0x2b, 
+  0xf6, 0xbe, 0x8e, 0x0e, 0x6d, 0x64, 0x74, 0xd0, 0xc2, 0x7c, 0x4a, 0x30, 0x9f, 0x2a, 0x4a, 0x2e, 
+  0x89, 0x17, 0x42, 0x17, 0x8c, 0xd1, 0xd1, 0x10, 0x93, 0xde, 0x70, 0x27, 0xbe, 0x88, 0xbc, 0x19, 
+  0xdc, 0x8d, 0xe4, 0x7c, 0x6b, 0x6c, 0x8e, 0xdb, 0xb8, 0xb8, 0x4b, 0x67, 0xdb, 0x78, 0x53, 0x66, 
+  0x0b, 0x1a, 0x7d, 0xc1, 0x57, 0x44, 0xf3, 0xee, 0xb6, 0xd0, 0x1f, 0xe5, 0xd9, 0xb2, 0xd8, 0xce, 
+  0xe5, 0x42, 0xe6, 0xdb, 0xb9, 0xf6, 0xd4, 0xd9, 0x5e, 0x27, 0xf3, 0xb9, 0x4c, 0xb7, 0x49, 0x41, 
+  0x9b, 0x74, 0xbb, 0x24, 0xe2, 0xb6, 0x5d, 0x6d, 0x96, 0x65, 0xb2, 0x5e, 0xca, 0x2d, 0xfc, 0xad, 
+  0xb7, 0x50, 0x77, 0x66, 0xe9, 0xf2, 0x6e, 0xab, 0xd5, 0x0e, 0xd4, 0xd6, 0x8c, 0x5e, 0xcc, 0x3d, 
+  0xf1, 0x32, 0xf2, 0x26, 0x17, 0x17, 0xef, 0x9f, 0x0c, 0x2e, 0x2e, 0xca, 0x8b, 0x8b, 0xfc, 0xe2, 
+  0x22, 0xbd, 0xb8, 0x58, 0x4c, 0x3d, 0xf1, 0x75, 0xe4, 0xf9, 0xe3, 0xf0, 0x82, 0xfe, 0xd1, 0xeb, 
+  0x79, 0xdc, 0x5b, 0x3c, 0xeb, 0x7d, 0x39, 0xbd, 0x1f, 0x8a, 0xcf, 0x76, 0x5e, 0xf7, 0x65, 0xd7, 
+  0x1b, 0x6f, 0xf9, 0xd5, 0x6f, 0xd5, 0x27, 0x5b, 0x2a, 0x77, 0xdb, 0xa3, 0x9f, 0xdf, 0x2e, 0x06, 
+  0x3d, 0xaa, 0xf1, 0xbf, 0x17, 0xd3, 0xa0, 0xeb, 0x89, 0x2f, 0x23, 0x8f, 0xca, 0xf1, 0x37, 0x8f, 
+  0x7d, 0xaf, 0xfb, 0x75, 0xd7, 0x0b, 0xa8, 0x5e, 0x7d, 0x3f, 0x79, 0xfc, 0xdb, 0xa3, 0x6d, 0xe7, 
+  0x5f, 0xd3, 0x71, 0x14, 0xe8, 0x27, 0xe3, 0xf0, 0xaf, 0xbe, 0x6e, 0xb7, 0x8f, 0xaa, 0xe8, 0xdf, 
+  0x5f, 0xa7, 0xc1, 0xe3, 0xe0, 0xaf, 0xdb, 0x0b, 0xaf, 0xf9, 0xe2, 0xc2, 0xc3, 0x9b, 0x0b, 0x6f, 
+  0xab, 0xeb, 0x0d, 0xb6, 0xba, 0x96, 0x8b, 0x0b, 0x1a, 0xc0, 0xa3, 0xc8, 0x0b, 0xab, 0x06, 0x2f, 
+  0x2e, 0x7c, 0xdf, 0xff, 0xf7, 0xab, 0x0e, 0xb6, 0xcd, 0x37, 0x7e, 0x40, 0xe3, 0x9c, 0x4e, 0xb7, 
+  0x5e, 0xf7, 0x4b, 0xaa, 0xf9, 0x71, 0xb0, 0xed, 0x53, 0xb9, 0x0b, 0x34, 0x2d, 0x7e, 0x8e, 0x00, 
+  0xb8, 0x6a, 0xe3, 0xfb, 0xd4, 0x0f, 0x1a, 0xbd, 0x77, 0x45, 0x7b, 0xfc, 0x27, 0xf7, 0xb9, 0xf7, 
+  0x1b, 0xf7, 0xb1, 0xcb, 0x15, 0xff, 0xa6, 0x2b, 0x9d, 0x06, 0xa6, 0x15, 0xaa, 0x51, 0xbd, 0x7f, 
+  0xa4, 0x3f, 0xfe, 0xb1, 0xe5, 0xe3, 0xc7, 0x42, 0xfd, 0xd0, 0xeb, 0x6f, 0xda, 0x5e, 0xfb, 0x93, 
+  0xcf, 0xbb, 0xff, 0x42, 0x17, 0x5f, 0xc2, 0x5d, 0xcf, 0x14, 0xfd, 0xb3, 0xd1, 0xbd, 0xed, 0xe7, 
+  0xf4, 0xf0, 0x2b, 0xf7, 0xe1, 0xa3, 0x40, 0xfc, 0xd2, 0xac, 0x8f, 0xe6, 0xef, 0x11, 0x95, 0xfb, 
+  0x35, 0xba, 0x7f, 0xf9, 0x22, 0xac, 0xbd, 0xfb, 0x8b, 0x9e, 0x5d, 0x7a, 0xfb, 0xfc, 0xdb, 0x67, 
+  0x6f, 0xde, 0xd4, 0xdf, 0xd2, 0x58, 0xaa, 0xf7, 0xe7, 0xcf, 0xbe, 0xaa, 0xbf, 0x55, 0xaf, 0xb6, 
+  0x93, 0xc7, 0x53, 0xbc, 0x7e, 0x76, 0x7e, 0xfe, 0x3a, 0x6c, 0xb4, 0xfb, 0x65, 0x20, 0x5e, 0xbd, 
+  0x39, 0xfb, 0xf1, 0xc5, 0x0f, 0xcd, 0x17, 0xd4, 0xc9, 0xe7, 0x5f, 0xbf, 0xfc, 0xb6, 0xd1, 0x99, 
+  0xd0, 0x67, 0xf0, 0x66, 0x81, 0x6d, 0x0b, 0x91, 0x6c, 0x9b, 0x96, 0xd7, 0xf8, 0xaf, 0x87, 0x9b, 
+  0xa0, 0xe7, 0xcf, 0xa0, 0xbf, 0xd8, 0x66, 0x8b, 0x1e, 0x88, 0x80, 0x86, 0x08, 0x3d, 0x5b, 0x90, 
+  0xce, 0xb6, 0x24, 0x50, 0xd1, 0x92, 0x4c, 0xba, 0x04, 0xc1, 0x81, 0x4f, 0x10, 0xff, 0x38, 0x48, 
+  0xb7, 0x15, 0x50, 0xea, 0x17, 0xfa, 0x9e, 0x5e, 0x77, 0x69, 0xc5, 0x2d, 0xb4, 0xf1, 0xea, 0x7b, 
+  0x09, 0x8d, 0x04, 0x62, 0x42, 0x63, 0xa4, 0x00, 0xf6, 0x2f, 0x68, 0x1a, 0x1e, 0xe9, 0x22, 0xa9, 
+  0x94, 0xf3, 0xe2, 0x39, 0xf4, 0xc0, 0xef, 0xcb, 0xb0, 0x65, 0xf1, 0xd4, 0xda, 0x85, 0x55, 0xaf, 
+  0xe4, 0x1f, 0xdb, 0x2b, 0x1a, 0x93, 0x1a, 0x51, 0x35, 0xc0, 0xfa, 0x18, 0xe8, 0x86, 0x36, 0xdd, 
+  0x3c, 0x18, 0x73, 0xd7, 0x9d, 0x8e, 0xf9, 0xe3, 0x68, 0xf2, 0x1b, 0xf5, 0xfd, 0x91, 0xee, 0xe2, 
+  0x4e, 0xfc, 0x3d, 0x3a, 0xf9, 0xfa, 0xfc, 0xbb, 0x6f, 0x1f, 0x9d, 0x24, 0xe2, 0x1f, 0xd1, 0x09, 
+  0x3a, 0x98, 0xa4, 0xeb, 0x4d, 0xa9, 0xb1, 0xcf, 0x16, 0xfd, 0x8a, 0x09, 0x5f, 0x6c, 0x2f, 0x37, 
+  0x65, 0x99, 0xa5, 0x01, 0xca, 0xfd, 0x93, 0xca, 0x5d, 0x5f, 0xcc, 0x71, 0x29, 0x25, 0x5d, 0x4f, 
+  0x7e, 0xbb, 0x9f, 0x76, 0x2f, 0xee, 0x2f, 0x8a, 0xc7, 0x17, 0x93, 0x34, 0x86, 0x7f, 0xf1, 0xd1, 
+  0xc5, 0xed, 0x89, 0x28, 0xa5, 0xaa, 0xef, 0x2f, 0xfe, 0x04, 0xa8, 0x80, 0xe6, 0xc8, 0xbf, 0xb8, 
+  0xa5, 0xbf, 0x04, 0x0a, 0xfa, 0x01, 0xd5, 0x46, 0x13, 0x10, 0x9d, 0x4c, 0x68, 0x8c, 0x27, 0x22, 
+  0x97, 0x35, 0x68, 0xfb, 0x00, 0xb2, 0xf1, 0x5d, 0x6c, 0x13, 0xe8, 0xed, 0x91, 0x50, 0x65, 0x54, 
+  0x39, 0x61, 0x9c, 0xf7, 0xc3, 0x05, 0x23, 0x9d, 0xed, 0x6f, 0xbd, 0x31, 0x4d, 0x04, 0xfd, 0x3c, 
+  0xd2, 0xb8, 0x48, 0xbf, 0xe9, 0x5d, 0x6c, 0xbe, 0xa4, 0x7f, 0xe8, 0x08, 0x89, 0x0d, 0x99, 0x6c, 
+  0x27, 0x15, 0xe5, 0xd8, 0xbb, 0x18, 0x40, 0x6a, 0x93, 0x63, 0xef, 0xff, 0xfd, 0x7f, 0xfe, 0x8f, 
+  0x17, 0x1a, 0x02, 0x3a, 0x10, 0x24, 0xca, 0x77, 0xa9, 0x93, 0xa0, 0xa9, 0x33, 0x4d, 0x0d, 0x9f, 
+  0x11, 0x5b, 0xa2, 0xf1, 0x3d, 0xbd, 0xb5, 0xda, 0x47, 0x7f, 0xf8, 0x19, 0x15, 0x3d, 0xf2, 0x42, 
+  0x55, 0x7c, 0x27, 0x62, 0x19, 0xdd, 0xca, 0x16, 0x7f, 0xaf, 0xce, 0x80, 0x55, 0xaf, 0x06, 0x8f, 
+  0xe3, 0xdc, 0x52, 0x22, 0x97, 0xf3, 0x42, 0xb2, 0xe0, 0xa8, 0x54, 0x8e, 0xdf, 0xc7, 0x2b, 0xd9, 
+  0xe0, 0x01, 0xc4, 0xfd, 0x3c, 0xc9, 0x43, 0xaf, 0x52, 0xd2, 0x79, 0x34, 0xab, 0x04, 0x4e, 0xde, 
+  0x52, 0x5e, 0x91, 0x14, 0x05, 0xc7, 0xff, 0x32, 0xbf, 0xbb, 0xff, 0xd6, 0x28, 0x36, 0xa2, 0x57, 
+  0x8a, 0x1d, 0xbd, 0xeb, 0xf3, 0x36, 0xc0, 0x17, 0x45, 0x20, 0xea, 0x77, 0xe5, 0xc4, 0xbd, 0x37, 
+  0x2a, 0xa2, 0x4a, 0xe9, 0x39, 0x8b, 0xe1, 0xc4, 0x4b, 0x3d, 0xff, 0x36, 0xba, 0xe7, 0x6a, 0x43, 
+  0xc3, 0xb5, 0x8e, 0xeb, 0x13, 0xf9, 0x9d, 0x6e, 0x55, 0x0a, 0xdd, 0x6a, 0x19, 0xd4, 0xf4, 0xbf, 
+  0x75, 0x92, 0x29, 0x1d, 0xd6, 0x77, 0x44, 0x74, 0x52, 0xf3, 0xb9, 0xf4, 0x33, 0x22, 0x6e, 0xd0, 
+  0x30, 0xb9, 0xa0, 0x94, 0x8e, 0x2d, 0xb0, 0x90, 0x8a, 0xb3, 0xb6, 0xfe, 0x66, 0xcc, 0x5f, 0x14, 
+  0xcc, 0x59, 0x2c, 0xc5, 0x82, 0x75, 0xda, 0xfd, 0xec, 0x36, 0x95, 0xf9, 0x0b, 0xc3, 0x3d, 0xcc, 
+  0xa1, 0x9d, 0xb4, 0xa3, 0x09, 0xff, 0x06, 0x4e, 0x95, 0x95, 0xae, 0x44, 0xf4, 0x8d, 0x00, 0x60, 
+  0x75, 0xbd, 0xc4, 0x1c, 0x75, 0xe8, 0x3f, 0x48, 0x2f, 0xb4, 0x26, 0x7f, 0x53, 0x3f, 0x43, 0xbe, 
+  0xad, 0x48, 0x38, 0xc4, 0x15, 0x88, 0xb3, 0xcf, 0x61, 0xd8, 0x91, 0x11, 0x49, 0x85, 0xe7, 0xe2, 
+  0x5d, 0xc0, 0x06, 0x80, 0xa1, 0xfe, 0xd2, 0xdf, 0x44, 0x25, 0x0c, 0x07, 0x72, 0x86, 0x49, 0x00, 
+  0x27, 0x90, 0x44, 0x9b, 0xc9, 0x70, 0xca, 0x85, 0xfe, 0x16, 0xa1, 0x3a, 0xb6, 0x17, 0xf8, 0x31, 
+  0xcd, 0xc3, 0x95, 0x2c, 0xb5, 0xde, 0xf7, 0x8b, 0xbb, 0x97, 0x73, 0xe2, 0x6d, 0x83, 0x5a, 0x5b, 
+  0x71, 0x9f, 0xfd, 0x02, 0x13, 0xfb, 0x50, 0xb1, 0xc0, 0x31, 0x04, 0x13, 0xe6, 0x9a, 0xa9, 0xcc, 
+  0x82, 0x95, 0x09, 0x8b, 0x96, 0xaa, 0x8e, 0x8f, 0x2f, 0x69, 0xe6, 0x63, 0x66, 0x9d, 0x1f, 0xae, 
+  0x07, 0x1d, 0xda, 0x4c, 0x9e, 0x4c, 0xcd, 0x7b, 0x03, 0x44, 0x24, 0x04, 0x39, 0xf5, 0x16, 0x5f, 
+  0xdc, 0x9d, 0xc7, 0x57, 0x00, 0x4d, 0x8c, 0x4c, 0x70, 0x0f, 0x79, 0x70, 0x4f, 0xa7, 0xd4, 0xc6, 
+  0xba, 0x5e, 0xf2, 0x39, 0xe1, 0xab, 0x02, 0x65, 0xb1, 0x2c, 0xed, 0x6f, 0x3e, 0xd8, 0x9a, 0x2d, 
+  0x89, 0xd1, 0x50, 0x57, 0xa9, 0xbd, 0x75, 0xff, 0x8f, 0x82, 0xc4, 0x95, 0xce, 0x8b, 0x49, 0x89, 
+  0xcd, 0x36, 0x85, 0xd8, 0x7d, 0x45, 0x2b, 0x77, 0xd5, 0x2f, 0x65, 0x51, 0xa2, 0x5f, 0xf4, 0x84, 
+  0x57, 0xa2, 0xd2, 0x2c, 0x77, 0x0e, 0xef, 0x2a, 0xb5, 0x74, 0x38, 0x70, 0x47, 0x00, 0x24, 0x20, 
+  0x88, 0x62, 0x05, 0xff, 0x34, 0x95, 0x6d, 0xb7, 0xdf, 0xd8, 0x7a, 0x15, 0x00, 0xfb, 0x0b, 0x42, 
+  0x5f, 0xe6, 0xd9, 0xf1, 0xf1, 0x0a, 0xae, 0xbc, 0xd5, 0x96, 0x84, 0x3f, 0x1d, 0x84, 0x76, 0x89, 
+  0xe9, 0x60, 0x6e, 0x8b, 0x38, 0x6e, 0xbf, 0x50, 0x0b, 0x5d, 0xe9, 0xe0, 0xbd, 0x64, 0x4e, 0x9c, 
+  0xcb, 0xb8, 0x88, 0x0a, 0xab, 0xd7, 0x48, 0x24, 0x61, 0xa7, 0x00, 0x88, 0xa7, 0x59, 0x50, 0x14, 
+  0xd1, 0x59, 0x00, 0x2f, 0x27, 0xe2, 0x64, 0xaf, 0xd1, 0x11, 0x2b, 0x5f, 0xf5, 0x7a, 0xa3, 0x60, 
+  0x46, 0x02, 0x52, 0xe4, 0x17, 0x63, 0xef, 0x2f, 0x5e, 0xb7, 0x08, 0xbd, 0x90, 0x1b, 0xf5, 0x18, 
+  0x11, 0x75, 0xef, 0xa4, 0x8f, 0xd7, 0xc1, 0x68, 0x19, 0xcd, 0xfa, 0xbf, 0x67, 0x49, 0xea, 0x13, 
+  0x02, 0x0d, 0x76, 0xc0, 0x12, 0x7b, 0x33, 0xbf, 0xe8, 0xb3, 0x8a, 0xfa, 0x0d, 0xd3, 0x83, 0x2c, 
+  0x7f, 0x46, 0x5b, 0x78, 0xc9, 0x73, 0x6e, 0x51, 0xc0, 0x0b, 0xda, 0x7e, 0xf0, 0x07, 0x58, 0x24, 
+  0x29, 0x6d, 0xf0, 0xbb, 0x7b, 0x28, 0xb2, 0xce, 0xb0, 0xb8, 0xca, 0x56, 0xd0, 0x18, 0x1d, 0xed, 
+  0x5c, 0xe3, 0x6c, 0xe7, 0x97, 0x76, 0x94, 0x3f, 0x09, 0xef, 0xd1, 0x90, 0x30, 0xb8, 0xda, 0xc6, 
+  0xd5, 0xde, 0x06, 0x1f, 0x7f, 0x6f, 0xc4, 0x56, 0x23, 0xad, 0x1c, 0x50, 0xfa, 0x6b, 0x49, 0x95, 
+  0x97, 0x3f, 0xf8, 0xfc, 0x96, 0xd0, 0x0d, 0xb1, 0xd2, 0xdf, 0x6a, 0xb7, 0xe3, 0x39, 0xf5, 0x9f, 
+  0x04, 0x31, 0x39, 0xc9, 0xfb, 0xc5, 0x75, 0xb2, 0x28, 0xfd, 0x60, 0x2a, 0xa4, 0x06, 0x95, 0x28, 
+  0x75, 0xb0, 0xc9, 0x4c, 0xba, 0x67, 0x47, 0x27, 0x67, 0x53, 0xb8, 0xeb, 0xc9, 0xea, 0xfd, 0x52, 
+  0x56, 0x4a, 0xd1, 0xf3, 0xa6, 0x85, 0xc6, 0xe2, 0x6b, 0x85, 0x72, 0x35, 0x5a, 0xef, 0x60, 0x5b, 
+  0x54, 0xf3, 0x65, 0x34, 0x31, 0x76, 0xc2, 0x4a, 0x07, 0x50, 0xa0, 0x6c, 0x39, 0x60, 0x6e, 0x81, 
+  0x53, 0x3c, 0x7b, 0xb4, 0x39, 0xbd, 0x5d, 0xc8, 0x7d, 0x14, 0xaa, 0x05, 0xca, 0xad, 0x07, 0x0f, 
+  0xf4, 0xd4, 0x6a, 0x0f, 0x00, 0x14, 0xb7, 0xfd, 0x98, 0x56, 0xe3, 0xeb, 0x38, 0x9d, 0x2f, 0x09, 
+  0xbb, 0x4e, 0xf2, 0x29, 0xa1, 0xd7, 0xaa, 0xb2, 0xb9, 0xac, 0xa9, 0x4d, 0x68, 0x09, 0x51, 0x01, 
+  0xe1, 0x3a, 0x4b, 0x7d, 0x80, 0x2d, 0xd5, 0x7d, 0xe9, 0xdc, 0x53, 0x93, 0xd9, 0x26, 0x9f, 0x49, 
+  0xf6, 0x63, 0xee, 0x95, 0xee, 0x1d, 0x30, 0x41, 0x6e, 0xb6, 0x73, 0xce, 0x68, 0x96, 0xb5, 0x01, 
+  0x23, 0xb8, 0x68, 0x83, 0x4a, 0xbd, 0x49, 0x2e, 0x97, 0x84, 0x6d, 0x47, 0xac, 0xe2, 0x74, 0xa4, 
+  0xa2, 0xde, 0xd0, 0xea, 0x36, 0x94, 0x2b, 0xb3, 0xed, 0xe5, 0x1a, 0xb3, 0x79, 0xdf, 0x00, 0x05, 
+  0xc7, 0x80, 0xc7, 0xfc, 0xcb, 0x43, 0x04, 0x13, 0x1d, 0x66, 0xeb, 0x0b, 0xb5, 0xe6, 0x4c, 0xe5, 
+  0xb5, 0x74, 0xac, 0x0d, 0xfb, 0x0a, 0xf0, 0x43, 0xb5, 0xe9, 0x6e, 0xfa, 0x55, 0xbb, 0xb0, 0x05, 
+  0x29, 0x76, 0x89, 0xef, 0xdc, 0xf6, 0x5c, 0x40, 0xbb, 0xf9, 0xc0, 0x38, 0x68, 0x9a, 0x56, 0x6c, 
+  0x93, 0x1a, 0xcb, 0x1a, 0x7c, 0x74, 0x86, 0x35, 0x2e, 0x61, 0xec, 0x2d, 0xe3, 0x4b, 0xb9, 0x54, 
+  0x25, 0x9d, 0x6b, 0xe7, 0x9b, 0x5a, 0x05, 0xf6, 0x43, 0xf4, 0x2d, 0xdc, 0xbb, 0x4d, 0x8a, 0x17, 
+  0xce, 0x03, 0xc2, 0x5a, 0xce, 0x13, 0x42, 0x97, 0x1d, 0xe8, 0x93, 0xb1, 0x03, 0xda, 0xbe, 0x76, 
+  0x5a, 0xc7, 0x98, 0xdd, 0x77, 0xce, 0xb8, 0xaf, 0x24, 0x91, 0x17, 0x33, 0xee, 0x99, 0xc3, 0x07, 
+  0x65, 0xf6, 0x69, 0x16, 0x75, 0x33, 0xe1, 0xbe, 0xaa, 0xc3, 0x38, 0x41, 0x65, 0xcc, 0x06, 0x62, 
+  0xc3, 0x2d, 0x64, 0xc4, 0xfa, 0x45, 0xb9, 0x81, 0xf4, 0x04, 0x90, 0x4e, 0xe0, 0x1d, 0xe5, 0x93, 
+  0x64, 0x0a, 0x3a, 0xc0, 0x02, 0x77, 0xc7, 0x2f, 0xf1, 0x83, 0x6b, 0x76, 0xa1, 0x71, 0x90, 0xcc, 
+  0x4a, 0xd6, 0x8f, 0x8b, 0x5b, 0xfd, 0x74, 0x3b, 0x8d, 0xa3, 0xb1, 0xb1, 0x0b, 0xb2, 0x84, 0x52, 
+  0x6a, 0x1d, 0x15, 0x70, 0x3c, 0x61, 0x15, 0x13, 0x6c, 0xca, 0x31, 0xee, 0x93, 0xe2, 0x97, 0xef, 
+  0xbe, 0x8d, 0x5a, 0x61, 0x88, 0xbe, 0x2f, 0xd6, 0x84, 0xf1, 0x7e, 0x7c, 0xfd, 0x52, 0xa4, 0x91, 
+  0xdf, 0x60, 0x4c, 0x40, 0x25, 0xac, 0x8e, 0x43, 0x37, 0x6c, 0x14, 0xb6, 0x7f, 0xd7, 0xc4, 0x65, 
+  0xbb, 0x85, 0x5d, 0xc5, 0x42, 0x23, 0x01, 0x1b, 0x18, 0x78, 0xf0, 0xf2, 0xcf, 0xb9, 0x2f, 0xb2, 
+  0x34, 0xb5, 0x45, 0x2d, 0x8a, 0x6b, 0xe8, 0x24, 0xc6, 0xfb, 0xad, 0x86, 0x77, 0x56, 0xb7, 0xd7, 
+  0x89, 0xce, 0x89, 0xcb, 0xa1, 0x45, 0xcb, 0x9d, 0x2d, 0x9e, 0x37, 0x7b, 0x45, 0xd3, 0x5a, 0x44, 
+  0xfe, 0x79, 0x94, 0xef, 0xf5, 0x57, 0xbc, 0x8b, 0x3a, 0xb1, 0x7f, 0x4e, 0x1c, 0x25, 0xd7, 0x44, 
+  0xbb, 0xfa, 0xbc, 0xaf, 0x0f, 0x0d, 0xc1, 0x45, 0x29, 0x40, 0xe7, 0xcb, 0x6c, 0x4d, 0xd3, 0x9b, 
+  0xb2, 0x6f, 0x4d, 0x3c, 0x9f, 0x9f, 0xe1, 0xe4, 0xee, 0xb7, 0x49, 0x51, 0x4a, 0xea, 0xd5, 0x78, 
+  0xff, 0x11, 0x1c, 0x1d, 0x96, 0x59, 0x4c, 0x24, 0x2f, 0x11, 0x9d, 0x61, 0x10, 0xa6, 0x7d, 0x3e, 
+  0x93, 0x7b, 0xcd, 0x85, 0x50, 0x9f, 0x73, 0xeb, 0x7b, 0x59, 0x6a, 0x4b, 0x13, 0xa1, 0xd2, 0xe4, 
+  0x36, 0x5a, 0xb6, 0x71, 0xdc, 0x47, 0x45, 0xcd, 0xd4, 0x4d, 0x93, 0xef, 0xde, 0xee, 0xa1, 0xf7, 
+  0x79, 0x72, 0x43, 0xe4, 0x59, 0x38, 0xf0, 0xd1, 0xa4, 0x8d, 0xb4, 0x3d, 0xf7, 0x1f, 0xfa, 0x9a, 
+  0xfa, 0x1e, 0x19, 0xf2, 0x70, 0xc4, 0x15, 0x69, 0x78, 0xdd, 0xa1, 0x8f, 0xb1, 0x21, 0x92, 0xc5, 
+  0x81, 0x8e, 0x92, 0x94, 0x61, 0x78, 0x9e, 0x88, 0x24, 0x37, 0xd1, 0x69, 0x72, 0x0e, 0xf6, 0x35, 
+  0xdc, 0xeb, 0xc4, 0xba, 0x15, 0x72, 0x0f, 0xd6, 0xdd, 0x36, 0xea, 0xe7, 0xd9, 0x4a, 0x8d, 0x1a, 
+  0x43, 0xee, 0x1c, 0x60, 0xf7, 0xa0, 0x4b, 0x70, 0xc7, 0xd1, 0xce, 0xa5, 0x45, 0x52, 0x73, 0x46, 
+  0xe7, 0x87, 0x18, 0x3e, 0xf5, 0x29, 0xf8, 0xd3, 0x8f, 0x5d, 0x28, 0xe2, 0x5b, 0xcf, 0x44, 0xa7, 
+  0x51, 0xa1, 0xda, 0x10, 0x6d, 0x4f, 0xfd, 0xb3, 0x66, 0x3f, 0xd1, 0xd8, 0xd8, 0xbf, 0xd5, 0xe7, 
+  0x10, 0xfa, 0x2f, 0x5f, 0xb4, 0x6e, 0x58, 0xc3, 0xa0, 0xe4, 0x52, 0x2c, 0x82, 0xd1, 0x41, 0x6c, 
+  0x7d, 0xd4, 0xc6, 0xc8, 0x29, 0xc4, 0x27, 0x6e, 0xf9, 0x90, 0x4f, 0xbd, 0x01, 0xe0, 0x33, 0xa2, 
+  0x78, 0x16, 0x92, 0xca, 0x06, 0x97, 0x7e, 0x7c, 0xfc, 0xce, 0xd2, 0xe1, 0x26, 0x03, 0x5f, 0xd9, 
+  0xd9, 0xd3, 0x31, 0x61, 0xb3, 0x70, 0x32, 0xdd, 0xed, 0x82, 0xf0, 0xc1, 0x91, 0xa4, 0x1f, 0x33, 
+  0x12, 0x35, 0xe4, 0x3a, 0xf2, 0xb3, 0x23, 0x52, 0xb4, 0x67, 0xff, 0x99, 0x1a, 0xa9, 0xd5, 0x23, 
+  0x83, 0x7d, 0x51, 0x3e, 0x83, 0x4c, 0xec, 0xfe, 0x2f, 0xc7, 0xae, 0x4c, 0xb4, 0xad, 0x33, 0x00, 
+  0x17, 0x18, 0xae, 0x86, 0xf0, 0x4b, 0x76, 0xa0, 0x57, 0x8c, 0x6a, 0x4c, 0x6f, 0x8c, 0x50, 0x41, 
+  0x7c, 0x2f, 0x9b, 0xc5, 0x92, 0x5a, 0xb5, 0x06, 0x4a, 0x64, 0xc0, 0xa2, 0x67, 0x16, 0x25, 0x5a, 
+  0xea, 0xfc, 0xcf, 0x5a, 0xd0, 0x2c, 0x2e, 0xaf, 0x8c, 0x99, 0x83, 0xf3, 0x67, 0x5f, 0x45, 0xed, 
+  0xdb, 0x72, 0xdc, 0xaa, 0x7b, 0x68, 0x9d, 0x1f, 0xe7, 0xa3, 0xf6, 0xc7, 0x34, 0x82, 0x90, 0x45, 
+  0x21, 0x7a, 0xbf, 0x87, 0x87, 0xa4, 0xb1, 0xbd, 0xee, 0x0e, 0x18, 0xf0, 0xac, 0x69, 0xe8, 0x60, 
+  0xe5, 0x98, 0x78, 0xda, 0xf4, 0x9d, 0x6a, 0xb8, 0x47, 0xd9, 0x48, 0x73, 0x74, 0x19, 0x1b, 0xa6, 
+  0x46, 0xc1, 0x90, 0x8f, 0x7f, 0xb8, 0xc4, 0x83, 0x19, 0xf3, 0xd4, 0xb5, 0x1f, 0xe9, 0x49, 0x61, 
+  0x5d, 0x61, 0x74, 0x58, 0x42, 0xfc, 0x38, 0xa8, 0xa9, 0x7f, 0xf3, 0x2e, 0xb0, 0x6e, 0x28, 0x07, 
+  0x84, 0x46, 0x18, 0x7d, 0x97, 0x18, 0xec, 0x15, 0xfe, 0x28, 0xd1, 0xd1, 0xc1, 0x51, 0xcd, 0x79, 
+  0x63, 0xd1, 0xb1, 0x81, 0x96, 0x94, 0x7d, 0x75, 0x1f, 0x2b, 0xa5, 0x44, 0xae, 0x40, 0x8f, 0x23, 
+  0xef, 0x34, 0x3e, 0x22, 0x1c, 0xf5, 0x57, 0xaf, 0x7b, 0xd6, 0xf5, 0xfe, 0xfa, 0xf9, 0xe9, 0x49, 
+  0xfc, 0xf9, 0xa9, 0x3e, 0x3c, 0x60, 0x1f, 0xf7, 0xa0, 0xc1, 0xfa, 0xeb, 0xd1, 0xaa, 0x20, 0x31, 
+  0x20, 0xbb, 0x9d, 0xc5, 0x6b, 0x1c, 0xdf, 0x8d, 0xfe, 0x4a, 0xa5, 0xb3, 0xb5, 0x56, 0x6d, 0x28, 
+  0x1b, 0x00, 0x3f, 0x3b, 0x51, 0x0f, 0xe9, 0x42, 0x3d, 0xfe, 0xdc, 0x13, 0x6d, 0xb4, 0x66, 0x52, 
+  0xaf, 0xee, 0x37, 0xfa, 0x76, 0x6a, 0x91, 0xf4, 0xf1, 0xf1, 0x95, 0x5a, 0x0c, 0x0f, 0xda, 0xf6, 
+  0x69, 0x54, 0x29, 0xda, 0xa1, 0xf8, 0xbe, 0x60, 0xfd, 0x6c, 0x6b, 0xa5, 0xa6, 0x27, 0x55, 0x55, 
+  0xdb, 0xad, 0xa9, 0xaa, 0x52, 0xe9, 0x8f, 0x43, 0xde, 0x0c, 0x5b, 0xa5, 0xe4, 0x3c, 0x54, 0x57, 
+  0x32, 0xff, 0x57, 0xa4, 0xc6, 0xdf, 0x56, 0x1b, 0xbd, 0x0b, 0x84, 0xdf, 0x22, 0x5c, 0x29, 0x06, 
+  0x9b, 0xc4, 0xdc, 0xba, 0x24, 0x0c, 0x96, 0xca, 0x63, 0xc3, 0x7f, 0x9d, 0x8e, 0x95, 0x07, 0x5a, 
+  0x47, 0xf9, 0xda, 0x9c, 0xb4, 0x0c, 0x84, 0xeb, 0xe4, 0xab, 0x8f, 0x9e, 0xa1, 0x50, 0xdb, 0x6d, 
+  0x5a, 0xaa, 0xad, 0x5e, 0xb5, 0x7e, 0x19, 0xff, 0x85, 0x27, 0xa3, 0xfb, 0xb8, 0xe5, 0xd3, 0xfe, 
+  0x5f, 0xfa, 0x5d, 0xa8, 0x47, 0x0f, 0x7c, 0x7a, 0x71, 0x71, 0xb1, 0xa0, 0x57, 0x76, 0x4d, 0x1d, 
+  0x9b, 0x0d, 0xb8, 0x80, 0x06, 0xcc, 0xca, 0x06, 0x78, 0x5e, 0xe7, 0x72, 0x41, 0x33, 0x71, 0x64, 
+  0x19, 0xf5, 0xbf, 0x9a, 0xab, 0x3a, 0xbc, 0xb6, 0xbe, 0x57, 0xc0, 0x78, 0xe2, 0x40, 0xe3, 0xe8, 
+  0x80, 0x50, 0xac, 0xd7, 0x6d, 0x54, 0x36, 0x16, 0x0e, 0x32, 0x11, 0x2d, 0x9c, 0xb2, 0x56, 0xb5, 
+  0x2c, 0x5f, 0xfb, 0x3a, 0xbf, 0xf0, 0x1e, 0x5a, 0xd7, 0x79, 0x1b, 0xa8, 0x57, 0xab, 0x59, 0x99, 
+  0x98, 0xa8, 0x96, 0x27, 0xad, 0x1c, 0x1c, 0x2d, 0x97, 0x0e, 0x01, 0xd3, 0x52, 0x93, 0x7d, 0x25, 
+  0xbc, 0xd0, 0xcc, 0x05, 0xd5, 0xb4, 0x87, 0x06, 0xec, 0x8c, 0x75, 0x06, 0x87, 0x9b, 0xa9, 0x2a, 
+  0xf8, 0xd8, 0x76, 0xda, 0xaa, 0x79, 0x2c, 0xc2, 0xf7, 0x0e, 0x08, 0x88, 0xfe, 0xe3, 0x10, 0x6b, 
+  0x1f, 0x00, 0xad, 0xad, 0xa0, 0x72, 0x90, 0x85, 0x29, 0x6f, 0x51, 0xdc, 0x2a, 0x2a, 0xcc, 0xbb, 
+  0xed, 0xb6, 0xe8, 0xdf, 0xca, 0xcb, 0x77, 0x49, 0xf9, 0x5d, 0xbd, 0x30, 0x5e, 0xac, 0xb2, 0x3f, 
+  0x5b, 0x9e, 0x66, 0x6d, 0x25, 0x8b, 0xc6, 0x43, 0xe0, 0xcc, 0x06, 0xf8, 0xad, 0x31, 0x2d, 0xf6, 
+  0x1c, 0x12, 0x97, 0x37, 0x9e, 0x2f, 0x52, 0xb0, 0x51, 0xaa, 0xba, 0x9b, 0x14, 0x1d, 0xec, 0x51, 
+  0x1e, 0xda, 0x52, 0x0f, 0xad, 0x13, 0x79, 0xe2, 0x11, 0xc0, 0xfa, 0x2a, 0xba, 0xb2, 0x33, 0xe6, 
+  0x98, 0x0c, 0xae, 0xb4, 0x2a, 0x6b, 0x0b, 0x86, 0x75, 0x19, 0x2d, 0xdb, 0xca, 0x2c, 0xdd, 0x32, 
+  0xa5, 0x9d, 0x90, 0x82, 0xcf, 0x37, 0x90, 0x8c, 0x6c, 0x44, 0xa2, 0x57, 0x59, 0x91, 0xa0, 0xdf, 
+  0xf0, 0x14, 0x86, 0x7c, 0xe4, 0x94, 0x4b, 0xcb, 0x38, 0x49, 0x8b, 0x60, 0xdc, 0xe6, 0x6a, 0xf2, 
+  0xb7, 0x9a, 0xa6, 0x64, 0x2c, 0x9b, 0xb2, 0x51, 0x08, 0x8d, 0x4a, 0x59, 0xd7, 0xf1, 0x8c, 0x1c, 
+  0xb3, 0x34, 0xcd, 0x65, 0xc7, 0xef, 0xe4, 0x4a, 0xd9, 0x5c, 0xc9, 0x5f, 0x78, 0x9a, 0xda, 0xa6, 
+  0xc7, 0xd5, 0xa5, 0x9f, 0x43, 0x33, 0x78, 0xa0, 0xef, 0xc7, 0xc7, 0xc3, 0xcf, 0x8e, 0x0f, 0xbe, 
+  0x65, 0x17, 0xaf, 0x26, 0x1f, 0x40, 0x04, 0x56, 0xf9, 0x13, 0x8f, 0xca, 0xa8, 0xd6, 0x47, 0xf0, 
+  0x41, 0xa5, 0xc3, 0xe3, 0x74, 0x06, 0x23, 0xab, 0xc6, 0x12, 0x3f, 0x44, 0xe5, 0x78, 0xaf, 0x1e, 
+  0xe9, 0x9a, 0xb8, 0x61, 0x6a, 0x17, 0x83, 0x91, 0x9a, 0xa4, 0xce, 0xc1, 0x3e, 0xf5, 0x3a, 0xe5, 
+  0xa1, 0x57, 0x96, 0xe5, 0xdd, 0x6e, 0xfd, 0x21, 0x84, 0xca, 0x36, 0xd1, 0x39, 0x8a, 0xfc, 0xb2, 
+  0xf9, 0xb4, 0x0c, 0xc6, 0x87, 0xe7, 0xa0, 0x0c, 0xc2, 0x61, 0x40, 0xb3, 0xbb, 0x66, 0x67, 0xc2, 
+  0x17, 0x12, 0x52, 0x24, 0x0c, 0x2f, 0x07, 0xbb, 0xa1, 0x34, 0x1f, 0xe9, 0x98, 0x46, 0x77, 0x0e, 
+  0xe5, 0x48, 0xad, 0xb1, 0x28, 0xba, 0x83, 0x66, 0xfd, 0x4e, 0xc8, 0x00, 0x5e, 0x3f, 0x25, 0x97, 
+  0x29, 0x0f, 0x94, 0xa1, 0x7e, 0x0d, 0xc3, 0xcd, 0xf8, 0xb5, 0xbf, 0xa1, 0xe2, 0x3d, 0xfc, 0x50, 
+  0x67, 0x06, 0xe1, 0x27, 0xc7, 0x29, 0xc7, 0x1b, 0x68, 0x5b, 0x9a, 0x83, 0x53, 0x6a, 0x3d, 0x85, 
+  0xaa, 0x15, 0x63, 0x1e, 0xce, 0xb9, 0x8d, 0xa3, 0x89, 0x9c, 0x8a, 0x22, 0xd2, 0x27, 0x74, 0x3b, 
+  0x09, 0x8d, 0x3a, 0x0b, 0x2a, 0xd0, 0x3b, 0x37, 0x3d, 0xa6, 0x5e, 0x25, 0xb8, 0xce, 0xda, 0xba, 
+  0x37, 0x62, 0xa3, 0x45, 0x14, 0xd9, 0x2f, 0xb5, 0xca, 0x70, 0xa4, 0xfd, 0xbd, 0x58, 0xad, 0xe7, 
+  0x82, 0x4d, 0xdc, 0xdf, 0xa4, 0x4a, 0xdf, 0x9a, 0x9a, 0x42, 0xe5, 0x5e, 0xa1, 0xa2, 0x59, 0x68, 
+  0x14, 0x4f, 0x72, 0xb8, 0x48, 0x14, 0x70, 0x71, 0x0a, 0x88, 0x11, 0xb7, 0x8c, 0xe3, 0x98, 0x1a, 
+  0xc4, 0x4b, 0x81, 0x57, 0x41, 0xa8, 0xca, 0xdd, 0xa1, 0xbf, 0x85, 0xbe, 0xe4, 0xa8, 0x1e, 0xe2, 
+  0x7c, 0x27, 0x0a, 0x69, 0x70, 0x5c, 0xbb, 0x6d, 0xaf, 0x40, 0xd7, 0xf9, 0x00, 0x37, 0xff, 0x29, 
+  0x03, 0xf7, 0x13, 0x8b, 0x32, 0xf7, 0x16, 0x81, 0x0d, 0x3c, 0x7b, 0xa8, 0x95, 0xb8, 0xce, 0x86, 
+  0xed, 0x61, 0x49, 0x13, 0xbc, 0x74, 0x6d, 0x0f, 0x0d, 0x6b, 0x44, 0x00, 0x05, 0xb1, 0xda, 0x10, 
+  0x16, 0xed, 0x95, 0xcc, 0x5e, 0x13, 0x88, 0xb7, 0xa0, 0x4a, 0x40, 0x9b, 0xc1, 0x26, 0xda, 0xfc, 
+  0x54, 0x3d, 0xb0, 0x98, 0xc2, 0xda, 0x71, 0xf6, 0xd5, 0xf3, 0xfa, 0xcd, 0xe0, 0x94, 0xed, 0x65, 
+  0xe7, 0x6a, 0xd4, 0x04, 0x14, 0x56, 0x2e, 0x16, 0x1c, 0x86, 0x4f, 0x21, 0x96, 0xd6, 0x29, 0x6b, 
+  0xdb, 0x72, 0xac, 0xe3, 0xe1, 0x39, 0xb9, 0xe4, 0xa2, 0x5c, 0x0b, 0xb4, 0x19, 0x8d, 0x1a, 0x1e, 
+  0xfc, 0x56, 0x23, 0x86, 0x9a, 0x76, 0xba, 0xe1, 0xe9, 0x34, 0x55, 0xaa, 0xe8, 0xdf, 0xd5, 0x54, 
+  0xb9, 0x25, 0x45, 0xa3, 0x64, 0x30, 0x56, 0x0e, 0x69, 0x9d, 0x77, 0x46, 0xda, 0x19, 0x35, 0x25, 
+  0xaa, 0x7c, 0x9c, 0x87, 0xae, 0xce, 0x85, 0x16, 0xe6, 0xdd, 0xb8, 0x21, 0xc1, 0x13, 0xb8, 0xb3, 
+  0xcf, 0xda, 0x9e, 0xe0, 0xc7, 0xab, 0x99, 0xf7, 0x8b, 0xb5, 0x9c, 0x25, 0x8b, 0x44, 0xce, 0xc7, 
+  0xb9, 0x92, 0x00, 0x43, 0x56, 0xcd, 0x63, 0xf8, 0xb2, 0x20, 0xde, 0xbb, 0xed, 0x6c, 0x94, 0x8f, 
+  0x13, 0x11, 0x41, 0xc3, 0xb4, 0xa3, 0x3e, 0xe1, 0x08, 0x5b, 0x0f, 0x39, 0xaa, 0x7a, 0x6f, 0xee, 
+  0x68, 0x69, 0xde, 0x1f, 0x71, 0x49, 0x71, 0xb4, 0x49, 0x73, 0x39, 0xcb, 0xae, 0x52, 0x04, 0x14, 
+  0x3c, 0x92, 0xef, 0xd7, 0x38, 0xd9, 0x89, 0xd0, 0x76, 0x47, 0x5e, 0x57, 0x57, 0xb9, 0x49, 0x13, 
+  0xe2, 0x16, 0xde, 0x40, 0x2f, 0xd9, 0xa2, 0x07, 0x54, 0x67, 0x7a, 0x80, 0x35, 0x78, 0x53, 0x13, 
+  0x36, 0x21, 0x98, 0x93, 0x25, 0xc1, 0xdb, 0x8b, 0x8d, 0x3a, 0x88, 0x26, 0x0b, 0xb1, 0x89, 0x34, 
+  0x66, 0x7c, 0x53, 0x82, 0x05, 0x61, 0x4d, 0xbf, 0x32, 0x7f, 0x83, 0x17, 0xe1, 0x48, 0x24, 0x3f, 
+  0x04, 0x62, 0xa6, 0x54, 0xb3, 0x44, 0x32, 0xa4, 0x16, 0x00, 0x99, 0x52, 0x4c, 0x12, 0xec, 0x03, 
+  0x58, 0x20, 0xb4, 0x77, 0x9e, 0xde, 0xdb, 0x6c, 0x88, 0x90, 0xda, 0x5f, 0xdb, 0x87, 0x11, 0x42, 
+  0x0c, 0x2d, 0x74, 0x6e, 0x54, 0x48, 0x05, 0x89, 0xf3, 0x3d, 0x05, 0x4f, 0xfe, 0x39, 0x8e, 0xb9, 
+  0xb4, 0x0d, 0xc0, 0xf3, 0x2c, 0xda, 0x33, 0xd0, 0xcf, 0xe8, 0x49, 0xd9, 0x5c, 0x61, 0xd4, 0xdc, 
+  0x6e, 0xff, 0xa6, 0x7e, 0x86, 0x7c, 0xcb, 0x2f, 0xf6, 0xdd, 0x3b, 0xf9, 0x20, 0xcd, 0x73, 0x75, 
+  0x14, 0xcf, 0x22, 0x44, 0xf7, 0x21, 0x77, 0x5b, 0x52, 0x33, 0xec, 0x6e, 0xc1, 0x3c, 0xde, 0x48, 
+  0x8e, 0xf0, 0xc0, 0x31, 0x60, 0x04, 0x69, 0x37, 0xca, 0x20, 0x58, 0x1a, 0xeb, 0xeb, 0x53, 0xd5, 
+  0xf4, 0x27, 0xae, 0x75, 0x55, 0xf5, 0xf4, 0x27, 0x40, 0xcb, 0xce, 0xfa, 0x36, 0xf2, 0xbc, 0x29, 
+  0x65, 0x03, 0xd7, 0x51, 0x56, 0xea, 0x9d, 0x9d, 0xf0, 0x6f, 0x95, 0x4e, 0x57, 0x61, 0x99, 0x22, 
+  0xba, 0x77, 0x8c, 0x5a, 0xe1, 0xa7, 0x03, 0x1d, 0x24, 0xe8, 0x55, 0x21, 0x37, 0xf3, 0x2c, 0x9c, 
+  0x49, 0xc1, 0x68, 0x29, 0xfc, 0x55, 0x54, 0xdb, 0x03, 0xbe, 0xd8, 0x10, 0xb5, 0xf1, 0x8b, 0x48, 
+  0x89, 0x1c, 0xff, 0xed, 0xde, 0xfb, 0xdc, 0x0b, 0xf7, 0xdd, 0x06, 0xd4, 0x09, 0x07, 0xb8, 0x06, 
+  0xc3, 0x5d, 0x61, 0xef, 0x3d, 0x3d, 0xee, 0xda, 0xc7, 0xb9, 0xbc, 0x49, 0xb2, 0x4d, 0xa1, 0x87, 
+  0x5f, 0xfb, 0xf6, 0x5f, 0x87, 0x0a, 0xed, 0x76, 0x82, 0x1e, 0x7d, 0xc9, 0x6a, 0xaa, 0xf0, 0x9e, 
+  0x1d, 0x7d, 0xda, 0x54, 0x69, 0x93, 0x21, 0xf4, 0xf4, 0xc3, 0x69, 0x5d, 0x65, 0x25, 0xe4, 0xe4, 
+  0xe9, 0x94, 0xc8, 0x3e, 0xfd, 0x25, 0xe4, 0x31, 0xf9, 0x84, 0xff, 0x7e, 0x8a, 0x73, 0x42, 0xce, 
+  0x96, 0x52, 0x25, 0x21, 0x43, 0x32, 0x08, 0x3e, 0x51, 0xea, 0x7f, 0xfa, 0x0e, 0x66, 0x4f, 0x5c, 
+  0xb0, 0x71, 0x50, 0x54, 0x6e, 0x1c, 0x9f, 0x40, 0x6f, 0xce, 0x1e, 0x44, 0x0f, 0xf6, 0xa4, 0x86, 
+  0x61, 0x84, 0x97, 0x96, 0xd7, 0xaa, 0x01, 0x7a, 0x65, 0x6a, 0x7a, 0x1a, 0x8c, 0x75, 0xe7, 0xcc, 
+  0x7e, 0xa6, 0xdb, 0xc1, 0x14, 0xfd, 0xfe, 0x64, 0x1a, 0x75, 0x7d, 0xfc, 0x8c, 0xd1, 0x63, 0x5c, 
+  0x7e, 0x46, 0xc5, 0x86, 0x41, 0xf8, 0xe4, 0xb1, 0xef, 0xc1, 0xb5, 0x47, 0x55, 0xf6, 0x94, 0x0f, 
+  0x3d, 0xcd, 0xe7, 0xe6, 0x2e, 0xc0, 0xb7, 0x9f, 0xaa, 0x6f, 0xff, 0x7b, 0x4a, 0xdd, 0xff, 0x9f, 
+  0xbd, 0x02, 0x21, 0x7e, 0x8e, 0x8f, 0x9b, 0x2d, 0xee, 0x8c, 0xbb, 0x54, 0xdb, 0xc6, 0xe9, 0xa0, 
+  0x79, 0xda, 0xcb, 0x34, 0x3b, 0x06, 0xd2, 0x7e, 0xed, 0xf3, 0x1c, 0x28, 0xe2, 0xc4, 0x75, 0x8c, 
+  0xb1, 0x0f, 0x43, 0x1e, 0xd0, 0x18, 0x25, 0xa3, 0xfa, 0x8c, 0x87, 0x84, 0x8b, 0xbf, 0x52, 0xc5, 
+  0x53, 0x10, 0xb7, 0x32, 0xba, 0xf6, 0x53, 0x90, 0x19, 0x75, 0x93, 0x9a, 0xb3, 0x7a, 0x3e, 0xc9, 
+  0xcb, 0xc2, 0xd8, 0x20, 0x7b, 0x65, 0xd0, 0xb3, 0x41, 0x9a, 0x78, 0x61, 0x06, 0xa8, 0x77, 0x50, 
+  0xcd, 0x21, 0x64, 0x76, 0x34, 0x96, 0x3a, 0x4f, 0xdc, 0xd5, 0x7a, 0x1a, 0x20, 0x54, 0xd1, 0x42, 
+  0x03, 0x10, 0x1c, 0xc9, 0x3e, 0xa8, 0xb3, 0x6d, 0xb5, 0xd6, 0x91, 0xb4, 0xc1, 0x4e, 0x3d, 0x6d, 
+  0xc7, 0x89, 0x5b, 0x01, 0xc1, 0x9a, 0x5b, 0x80, 0x03, 0xdb, 0x0d, 0x81, 0x5a, 0xdb, 0xab, 0xbc, 
+  0xdf, 0xf6, 0xbb, 0xf5, 0xfd, 0x44, 0x32, 0x6f, 0xe0, 0xba, 0xdc, 0x96, 0x35, 0x8f, 0x27, 0xff, 
+  0x37, 0xeb, 0xa4, 0x47, 0x45, 0x95, 0x2f, 0x17, 0x3c, 0xb5, 0x30, 0xa7, 0xdf, 0x13, 0x49, 0x6b, 
+  0x3d, 0x34, 0xc9, 0x4b, 0xd0, 0x82, 0xd4, 0x66, 0xae, 0x97, 0x85, 0xbd, 0xd9, 0x6e, 0x0f, 0xa8, 
+  0x77, 0x9b, 0xaa, 0x5d, 0x6d, 0x4f, 0xf0, 0x02, 0xde, 0x5e, 0x3b, 0xda, 0x24, 0xf5, 0xdd, 0xca, 
+  0xaa, 0xd9, 0x07, 0xac, 0xa5, 0x9a, 0x09, 0x00, 0x87, 0x15, 0x8c, 0x1a, 0x0e, 0xf1, 0x10, 0xe4, 
+  0x20, 0xeb, 0x84, 0x10, 0x74, 0xfc, 0xb2, 0x0b, 0x4c, 0xee, 0xa9, 0x47, 0x63, 0x50, 0x8e, 0x24, 
+  0x34, 0x25, 0xc6, 0x65, 0x87, 0x6f, 0x7f, 0xd3, 0xb7, 0xc9, 0xf1, 0x31, 0x1f, 0xb6, 0xb3, 0xd0, 
+  0x95, 0x04, 0x21, 0x54, 0x34, 0xe6, 0x65, 0x6f, 0x78, 0x5a, 0x7f, 0xf7, 0xa8, 0x7a, 0xa7, 0xfd, 
+  0x75, 0xfd, 0x5e, 0x62, 0x20, 0x50, 0x35, 0xf5, 0x2f, 0x5d, 0x84, 0xbe, 0x85, 0x13, 0x76, 0xb7, 
+  0xf2, 0x49, 0xf8, 0x19, 0x58, 0x90, 0x1d, 0x26, 0x82, 0x5a, 0xa5, 0x5b, 0xf5, 0x05, 0x03, 0x3a, 
+  0xe3, 0xf8, 0xd2, 0xc2, 0xa7, 0xa9, 0xbb, 0x3b, 0xe4, 0xda, 0xbb, 0x5e, 0xcf, 0x63, 0x88, 0x6d, 
+  0x60, 0x98, 0x6b, 0x01, 0x06, 0xe5, 0x46, 0x5c, 0xa9, 0xe9, 0x5a, 0x45, 0x8c, 0x50, 0x68, 0xac, 
+  0xd7, 0x0e, 0xa4, 0x93, 0xe4, 0xe9, 0xc1, 0xb5, 0xcf, 0x7d, 0xde, 0xfb, 0x24, 0x10, 0x77, 0x91, 
+  0xa7, 0x1d, 0x17, 0x19, 0x86, 0xcd, 0xec, 0x82, 0xc4, 0xdd, 0xa8, 0xf9, 0xb9, 0x6a, 0x39, 0x82, 
+  0xdb, 0xe9, 0xb8, 0xd2, 0xc1, 0xee, 0xb0, 0xef, 0xbe, 0x71, 0x9d, 0x8a, 0x56, 0x9d, 0xe8, 0x72, 
+  0xec, 0x39, 0x24, 0xce, 0x6b, 0xc1, 0xfa, 0xcb, 0xba, 0xd0, 0xb1, 0x80, 0x74, 0x73, 0x68, 0x83, 
+  0x88, 0x79, 0xd4, 0xc1, 0x31, 0x90, 0x3b, 0xb1, 0xe6, 0x88, 0x49, 0x0b, 0x7f, 0xc9, 0x24, 0x79, 
+  0xa5, 0xf9, 0x87, 0xd9, 0x48, 0x5d, 0xc4, 0x34, 0xa8, 0x38, 0x8a, 0x27, 0x33, 0xa5, 0x7e, 0xbf, 
+  0x1b, 0xc7, 0x87, 0x77, 0xdc, 0x22, 0xc4, 0xb8, 0xe3, 0x26, 0xff, 0x4b, 0xd5, 0x6f, 0xa2, 0x19, 
+  0x4d, 0x54, 0xba, 0xe4, 0x53, 0x9a, 0xd7, 0xd4, 0xec, 0x06, 0xc7, 0x78, 0x9d, 0xd1, 0xec, 0xec, 
+  0x8e, 0x87, 0x8f, 0x53, 0x34, 0xb9, 0x1c, 0x2f, 0x1d, 0x0a, 0x1f, 0x2e, 0xfb, 0x98, 0x7c, 0xbe, 
+  0x9e, 0x8a, 0xcb, 0xe3, 0xe3, 0xb9, 0xea, 0xdc, 0x3a, 0x82, 0xdd, 0x33, 0xc7, 0x21, 0x04, 0x3f, 
+  0x8b, 0xa8, 0xaf, 0xcb, 0x60, 0x72, 0x36, 0xc5, 0x21, 0x2e, 0xb8, 0x8a, 0xdc, 0xef, 0x82, 0x60, 
+  0x12, 0x6b, 0xd6, 0xeb, 0xe5, 0x0b, 0x3c, 0xcf, 0xdc, 0x7b, 0x55, 0xe0, 0x7a, 0x0a, 0x47, 0xb3, 
+  0x00, 0xd8, 0x2f, 0x8a, 0xde, 0x10, 0x33, 0x09, 0x27, 0x30, 0xfc, 0x3c, 0x99, 0xc2, 0x7e, 0x7c, 
+  0x7c, 0xbc, 0x74, 0x7c, 0xef, 0x26, 0xc5, 0x94, 0x66, 0xa3, 0xdb, 0xa5, 0xc7, 0x31, 0xfd, 0x9f, 
+  0x66, 0x85, 0x2a, 0x5d, 0x47, 0x45, 0x34, 0xa0, 0xbd, 0xb9, 0x81, 0x7b, 0x3a, 0x61, 0xb5, 0x40, 
+  0xb3, 0x3c, 0xb1, 0xa3, 0x75, 0xef, 0x76, 0xd7, 0x54, 0x9e, 0x65, 0xf6, 0xfb, 0x84, 0xda, 0x8c, 
+  0x26, 0x6f, 0x68, 0x65, 0xd7, 0x53, 0x13, 0x7c, 0xc9, 0x30, 0x2a, 0xf0, 0x6b, 0x42, 0x7d, 0xee, 
+  0xa0, 0xe4, 0xff, 0xd2, 0xa0, 0x04, 0x3b, 0x2b, 0xac, 0x95, 0x4a, 0xc1, 0xff, 0xd0, 0x30, 0x40, 
+  0x13, 0x1e, 0x58, 0xee, 0x0e, 0x2f, 0x77, 0xa7, 0xb6, 0xdc, 0xc4, 0xb9, 0xd3, 0x38, 0xa9, 0x2a, 
+  0x8c, 0x42, 0x75, 0x3f, 0xfe, 0x0f, 0xba, 0x8e, 0xb9, 0x59, 0x53, 0x77, 0x63, 0xb6, 0x6b, 0xd0, 
+  0x7c, 0x1a, 0xaf, 0x8e, 0x75, 0x2f, 0xba, 0x02, 0x9c, 0xdd, 0x90, 0x4c, 0xf6, 0x5f, 0x37, 0x51, 
+  0x34, 0xc0, 0x99, 0xde, 0x68, 0x7d, 0x72, 0xb3, 0xdb, 0xb5, 0xd0, 0x58, 0x91, 0x19, 0x2a, 0x1b, 
+  0x93, 0x30, 0xb3, 0x66, 0xae, 0x0c, 0x47, 0x6a, 0xb7, 0xdb, 0x5b, 0x28, 0x33, 0x15, 0xe3, 0x43, 
+  0x0f, 0x1a, 0xa2, 0x8d, 0xc3, 0x31, 0x78, 0x24, 0x09, 0x9b, 0x50, 0xdc, 0x47, 0xaa, 0x02, 0xc5, 
+  0xd2, 0xdb, 0xe3, 0x71, 0x34, 0xac, 0x71, 0xec, 0x67, 0x41, 0x38, 0x3c, 0x8d, 0x8d, 0xcb, 0x25, 
+  0x21, 0xa2, 0x89, 0x24, 0x9c, 0x42, 0x88, 0x34, 0x9b, 0x0a, 0xb7, 0xad, 0xc6, 0xb1, 0x06, 0xbf, 
+  0xe9, 0xe5, 0x36, 0xfe, 0x80, 0x97, 0x85, 0x3c, 0xe4, 0x5b, 0xf1, 0x9a, 0x5e, 0xc1, 0xbf, 0x22, 
+  0xb0, 0x9e, 0x15, 0x7c, 0xb7, 0x0b, 0xda, 0xc8, 0x27, 0xea, 0x01, 0x29, 0xa7, 0xb7, 0x31, 0x78, 
+  0x40, 0x35, 0x31, 0xe1, 0x7d, 0x9a, 0x95, 0xe1, 0x6c, 0xdf, 0xae, 0xa2, 0xed, 0x50, 0x13, 0xe8, 
+  0x2b, 0xe6, 0xbe, 0x6c, 0x3a, 0x89, 0xd9, 0xb9, 0x28, 0x30, 0x17, 0x8d, 0x01, 0x28, 0x37, 0x50, 
+  0x33, 0x08, 0x58, 0x0f, 0x0b, 0x23, 0xe6, 0xe7, 0x62, 0x82, 0x25, 0xae, 0xce, 0x64, 0xc4, 0x18, 
+  0x0c, 0x01, 0x0d, 0x81, 0xc4, 0x54, 0xf1, 0x23, 0xb1, 0x1a, 0x0d, 0xfd, 0x24, 0x41, 0x7d, 0x2c, 
+  0xb5, 0xa3, 0x5d, 0x39, 0x33, 0x2e, 0xa2, 0xf0, 0x73, 0xad, 0x40, 0x20, 0x5a, 0x28, 0xf8, 0x21, 
+  0xdf, 0x76, 0x12, 0x05, 0xcf, 0x30, 0xfe, 0xd1, 0xfc, 0xd7, 0x86, 0xf8, 0x90, 0xcb, 0x8f, 0x91, 
+  0xcd, 0xa5, 0x15, 0xc9, 0x77, 0x2a, 0x48, 0x08, 0x24, 0xf2, 0x03, 0xb5, 0x40, 0x4f, 0x57, 0x67, 
+  0x7e, 0xf7, 0xeb, 0x05, 0x69, 0xab, 0x49, 0x34, 0xdb, 0x2d, 0x44, 0x95, 0x8a, 0xaa, 0x95, 0xdc, 
+  0xd5, 0x65, 0x9c, 0x5e, 0xd5, 0x5a, 0xa9, 0x06, 0xfc, 0x8b, 0x66, 0xf5, 0x98, 0x1b, 0x38, 0x04, 
+  0xae, 0xfc, 0x3d, 0x01, 0x6b, 0x1a, 0x08, 0x68, 0x78, 0x1e, 0xe0, 0xc2, 0xc4, 0xbe, 0x25, 0x6d, 
+  0x9e, 0xb1, 0xf2, 0x31, 0x82, 0x1c, 0xce, 0x15, 0x35, 0xf9, 0x91, 0xf7, 0xab, 0x65, 0x88, 0x17, 
+  0x68, 0xbf, 0xf9, 0x4e, 0x3d, 0x0f, 0xcc, 0xc1, 0xe8, 0xe6, 0x29, 0xa9, 0xc0, 0x39, 0xa7, 0x6f, 
+  0xc7, 0x9c, 0x32, 0x71, 0xde, 0xdd, 0x12, 0xa2, 0x95, 0x3e, 0x8b, 0x77, 0x8e, 0xb7, 0x66, 0xd3, 
+  0xe7, 0x2d, 0xa8, 0xb4, 0x9d, 0x88, 0x77, 0x8c, 0xd8, 0xdc, 0x2d, 0xc7, 0x2d, 0xe1, 0x6c, 0xa7, 
+  0x83, 0x2f, 0xc1, 0x2e, 0x6c, 0xae, 0xb1, 0x07, 0xaf, 0x6b, 0x16, 0x72, 0x73, 0x08, 0x8b, 0xdb, 
+  0x48, 0xe6, 0x24, 0x98, 0x65, 0x59, 0xeb, 0xf9, 0x7d, 0x68, 0xfc, 0x0a, 0x62, 0x78, 0x71, 0xee, 
+  0xe7, 0xd0, 0xfb, 0xf3, 0xbe, 0x0a, 0xea, 0x5d, 0x39, 0xe6, 0x74, 0xce, 0xd1, 0xe4, 0x97, 0x7c, 
+  0x58, 0x68, 0x5b, 0x5d, 0x33, 0x82, 0xed, 0x74, 0x7c, 0xe5, 0x8d, 0x86, 0x59, 0x84, 0x01, 0x68, 
+  0xbb, 0xfd, 0x17, 0x3d, 0x88, 0x2f, 0xd9, 0x5d, 0x8f, 0x8f, 0x67, 0xab, 0xf8, 0xf7, 0x37, 0x2a, 
+  0x04, 0x90, 0xb1, 0x3e, 0xf0, 0x3d, 0x89, 0xfd, 0xda, 0x94, 0x15, 0xfe, 0xdb, 0x0e, 0x72, 0x8e, 
+  0x7f, 0x1c, 0x7a, 0x01, 0xaf, 0x79, 0x75, 0xce, 0x89, 0x24, 0x9a, 0xb5, 0x3e, 0x92, 0x67, 0x5e, 
+  0x19, 0x63, 0x23, 0xf4, 0x18, 0xea, 0xaa, 0x9d, 0x29, 0x77, 0xdd, 0xe2, 0x6a, 0x3e, 0x6e, 0xe6, 
+  0x33, 0x1e, 0x94, 0xd0, 0x7e, 0xf5, 0x55, 0xad, 0xc8, 0x0f, 0x70, 0xb7, 0x17, 0xb9, 0xf3, 0x83, 
+  0x22, 0x3e, 0x54, 0xb0, 0x16, 0x24, 0x4e, 0x3f, 0x6b, 0x3b, 0x52, 0xab, 0xfa, 0xd0, 0xd2, 0xdb, 
+  0x8e, 0xa5, 0x07, 0x7d, 0x6e, 0x9d, 0x6d, 0xd0, 0x88, 0xb5, 0x21, 0xf3, 0xb6, 0xb1, 0xfd, 0x53, 
+  0x8b, 0x62, 0x76, 0x4e, 0x71, 0xd8, 0x17, 0x13, 0xd8, 0x56, 0xf8, 0x1f, 0x2d, 0x85, 0x95, 0x03, 
+  0xe2, 0xff, 0xe5, 0x32, 0x39, 0x6e, 0x8c, 0x06, 0x68, 0x5c, 0xcf, 0xc6, 0x9d, 0xe0, 0x63, 0x2b, 
+  0xfb, 0x9b, 0xf9, 0xe3, 0x3d, 0x31, 0x3d, 0xd4, 0x50, 0xd5, 0x0f, 0x87, 0x30, 0x96, 0x12, 0xfc, 
+  0x72, 0xcf, 0x35, 0x9a, 0x39, 0x5e, 0x3e, 0x42, 0x6d, 0xbe, 0x69, 0x6e, 0x73, 0x13, 0xa2, 0xe1, 
+  0x4a, 0xb6, 0x04, 0xdb, 0x1a, 0x4c, 0x19, 0xc5, 0x35, 0x5e, 0x3b, 0xda, 0xcd, 0x49, 0xd9, 0x1b, 
+  0xa2, 0x8c, 0xfc, 0xa3, 0x59, 0xa2, 0xc2, 0xfc, 0x13, 0x1c, 0x92, 0x4c, 0xbb, 0x65, 0x98, 0x72, 
+  0x49, 0x04, 0x72, 0xb8, 0x3a, 0x48, 0x40, 0xa3, 0xc1, 0x28, 0x3d, 0x2d, 0x47, 0x69, 0x37, 0x7a, 
+  0x12, 0xc8, 0xa6, 0x0b, 0x84, 0xa4, 0xef, 0x11, 0xb6, 0xe1, 0x81, 0xcf, 0x87, 0x1f, 0xf8, 0x7c, 
+  0x59, 0xb6, 0x75, 0xb4, 0x3a, 0xe7, 0x6b, 0xfa, 0x5a, 0x9e, 0xa6, 0x63, 0xea, 0xf1, 0x88, 0x18, 
+  0x97, 0x5e, 0x2f, 0x1f, 0x99, 0xca, 0xf2, 0x5a, 0x65, 0x57, 0x1f, 0x59, 0x59, 0x3a, 0xea, 0x76, 
+  0x73, 0xea, 0x56, 0x6b, 0x2d, 0x84, 0x1c, 0x2d, 0x94, 0x93, 0x44, 0x13, 0x39, 0x30, 0xff, 0x87, 
+  0xb8, 0xcf, 0xe3, 0x79, 0x92, 0xe1, 0x54, 0x3e, 0xef, 0xfc, 0xcb, 0xec, 0x3d, 0xae, 0x49, 0x96, 
+  0xe7, 0xe0, 0x38, 0x36, 0x7b, 0x08, 0x82, 0xa3, 0xae, 0x38, 0x23, 0xc3, 0x60, 0x17, 0xb8, 0x4c, 
+  0x54, 0xb4, 0x66, 0xff, 0x13, 0xe3, 0x79, 0x79, 0x5f, 0x6c, 0x2e, 0x57, 0x09, 0x34, 0x4e, 0x22, 
+  0x97, 0x9c, 0xb3, 0xa0, 0x59, 0xfe, 0x5a, 0x95, 0x37, 0x5e, 0x9e, 0x97, 0x70, 0x25, 0xaf, 0x9c, 
+  0x3e, 0xef, 0x64, 0x23, 0x62, 0xaf, 0xa8, 0x1d, 0x3f, 0xf1, 0xbc, 0x11, 0xcd, 0x1b, 0xc7, 0x3a, 
+  0xcd, 0xbb, 0x1c, 0x58, 0x41, 0x69, 0x79, 0x2b, 0x17, 0x96, 0x2a, 0x82, 0x8f, 0xf4, 0x0b, 0x61, 
+  0x8d, 0x80, 0x1b, 0xf6, 0xcd, 0xcd, 0x49, 0x80, 0x52, 0xc8, 0x83, 0x44, 0xa4, 0x19, 0x71, 0xb8, 
+  0x24, 0x1a, 0x61, 0x43, 0x39, 0xda, 0x34, 0x02, 0xe0, 0x25, 0x89, 0x44, 0x8e, 0x75, 0x43, 0xa3, 
+  0x9f, 0x71, 0xdb, 0x2a, 0x00, 0x19, 0x4d, 0x36, 0x53, 0xcb, 0xe9, 0x4b, 0xc7, 0x38, 0xb8, 0x30, 
+  0xfa, 0xc5, 0x42, 0x7f, 0x51, 0x51, 0xab, 0x87, 0xe4, 0x3c, 0x30, 0xbd, 0xf3, 0xa9, 0xf2, 0xc9, 
+  0xde, 0x6b, 0xa3, 0xa5, 0x91, 0xe3, 0x63, 0x53, 0xbf, 0x35, 0x02, 0x3a, 0x5a, 0xcc, 0x07, 0xfb, 
+  0xc7, 0x66, 0x23, 0xe2, 0xcd, 0xa5, 0xe2, 0xcd, 0xa5, 0xe5, 0xcd, 0x65, 0x83, 0x37, 0x97, 0x75, 
+  0xde, 0x5c, 0xcc, 0x8e, 0x8f, 0x67, 0x0f, 0x20, 0x90, 0x40, 0xb5, 0x4a, 0xb4, 0x6c, 0x64, 0x4e, 
+  0xab, 0x90, 0x18, 0x93, 0x4c, 0x96, 0x4a, 0x9e, 0x72, 0x65, 0x91, 0xc8, 0x39, 0xae, 0x13, 0x43, 
+  0xc7, 0x04, 0x71, 0x4b, 0x1d, 0x54, 0xa1, 0xe2, 0x51, 0x1c, 0xe0, 0xd9, 0xfe, 0x00, 0x2b, 0xba, 
+  0x5f, 0x85, 0x3a, 0xc2, 0xa9, 0x13, 0x83, 0x7b, 0x87, 0xa7, 0x49, 0xdb, 0xc1, 0xa7, 0xfa, 0xe6, 
+  0x49, 0x6a, 0x4e, 0xf8, 0x6c, 0x7e, 0x9b, 0xe4, 0xd3, 0x46, 0x5b, 0x0e, 0x19, 0x09, 0x13, 0xa0, 
+  0xab, 0x2a, 0xc8, 0x9f, 0xf4, 0x6d, 0xc4, 0x92, 0xaa, 0x5a, 0x5e, 0x41, 0xb0, 0xc8, 0x03, 0xb1, 
+  0xa9, 0x20, 0x77, 0x16, 0xa9, 0x43, 0xf2, 0xa5, 0x8d, 0x1d, 0xc2, 0xd3, 0x5e, 0x30, 0x83, 0x0b, 
+  0xe9, 0x3b, 0xf5, 0x33, 0xae, 0x07, 0x22, 0x92, 0xda, 0xc2, 0x19, 0x4f, 0xb3, 0x3a, 0xd8, 0xec, 
+  0x17, 0x81, 0x1b, 0x8a, 0xc3, 0x76, 0xe1, 0x5c, 0xfa, 0x6b, 0x71, 0x0d, 0x95, 0x85, 0x58, 0x55, 
+  0xf1, 0xcc, 0x8f, 0xae, 0xa8, 0xc2, 0x2b, 0x5a, 0x4c, 0xaa, 0xfb, 0x2a, 0xa2, 0x32, 0x57, 0x41, 
+  0x20, 0x56, 0xf4, 0x6c, 0xa5, 0x9e, 0xad, 0xf0, 0x6c, 0xc5, 0xf1, 0x12, 0x5a, 0xd9, 0x74, 0xe7, 
+  0xb4, 0x16, 0x86, 0xb2, 0xc1, 0x9f, 0x59, 0x64, 0xe3, 0x1f, 0x2c, 0x71, 0x8c, 0xea, 0xf0, 0xac, 
+  0x0e, 0x38, 0x28, 0x98, 0x0d, 0x8e, 0x90, 0x70, 0x70, 0x04, 0xb6, 0xea, 0x21, 0x34, 0x82, 0xab, 
+  0x78, 0xda, 0xf9, 0xd7, 0x44, 0x36, 0x1e, 0x43, 0x13, 0x69, 0x6d, 0xf3, 0xf0, 0x9c, 0x4c, 0x59, 
+  0x22, 0x58, 0x44, 0x1d, 0x92, 0x20, 0x11, 0x09, 0xea, 0x7a, 0xbc, 0x0c, 0x69, 0xb2, 0x97, 0x90, 
+  0x93, 0xb9, 0x87, 0xb4, 0x3f, 0x6f, 0xc6, 0x2b, 0x40, 0xec, 0x78, 0x1d, 0xd2, 0x36, 0xbe, 0xe2, 
+  0xa8, 0x27, 0x44, 0xf2, 0x00, 0x38, 0x37, 0xc7, 0xc7, 0x37, 0xfe, 0x42, 0xcc, 0x55, 0xc9, 0xab, 
+  0x40, 0x79, 0x15, 0xd2, 0xf7, 0x73, 0xb1, 0xa1, 0x7b, 0x3f, 0xa1, 0xda, 0xd5, 0xbb, 0xac, 0x82, 
+  0x00, 0x3e, 0x9b, 0x43, 0x92, 0x70, 0x82, 0xf3, 0x37, 0x88, 0x42, 0x31, 0xd9, 0xd0, 0x15, 0xc4, 
+  0x8e, 0x85, 0xbe, 0x8a, 0x03, 0xb6, 0x02, 0xaa, 0xe0, 0x71, 0xd4, 0xf6, 0xda, 0x55, 0x92, 0xb0, 
+  0x54, 0x94, 0x45, 0xf3, 0x66, 0x75, 0x73, 0x55, 0x5d, 0xa2, 0x16, 0x71, 0x81, 0xb3, 0x3f, 0x71, 
+  0x30, 0x5a, 0x31, 0x35, 0xa5, 0x41, 0x40, 0x9e, 0xe2, 0x73, 0x35, 0x88, 0xa5, 0x70, 0xf0, 0x6b, 
+  0xc8, 0x09, 0x49, 0xb4, 0x1a, 0xbf, 0xe6, 0xc3, 0x61, 0x61, 0xa1, 0xbb, 0x08, 0x4b, 0x0e, 0x8b, 
+  0x45, 0x09, 0x77, 0x4e, 0x6b, 0x0e, 0xe6, 0x3c, 0x52, 0x50, 0xe1, 0xf1, 0xdc, 0x18, 0x73, 0x66, 
+  0xc2, 0x54, 0x1d, 0x84, 0x73, 0x82, 0x84, 0xb1, 0xee, 0x40, 0x49, 0x93, 0x94, 0x07, 0xa1, 0x3d, 
+  0x81, 0x28, 0xe6, 0x35, 0xff, 0xfb, 0x77, 0x35, 0x54, 0x9c, 0x08, 0xed, 0xa6, 0x6e, 0xbd, 0xfb, 
+  0x89, 0x8e, 0x18, 0xcb, 0xc5, 0x84, 0xd5, 0xc5, 0x60, 0x05, 0xa0, 0x2a, 0xc9, 0x20, 0x58, 0xdb, 
+  0x57, 0xd0, 0xae, 0x12, 0x20, 0xc1, 0x70, 0x8d, 0x2d, 0x71, 0xdb, 0xee, 0xeb, 0x0c, 0xbd, 0xdc, 
+  0x8e, 0x20, 0x8e, 0x99, 0xd9, 0xf6, 0x42, 0x34, 0x0f, 0xaf, 0x69, 0xf5, 0xc0, 0x46, 0xa9, 0x72, 
+  0xcb, 0x68, 0xd2, 0x8a, 0x47, 0xa3, 0x0e, 0xc2, 0x4e, 0x93, 0x68, 0x01, 0x3d, 0xe5, 0x7b, 0x6c, 
+  0x29, 0xb8, 0x95, 0x06, 0x15, 0x90, 0x6d, 0x74, 0xf1, 0x70, 0x66, 0x36, 0xbb, 0x81, 0xc9, 0x44, 
+  0x89, 0x8a, 0xf9, 0x6e, 0x4a, 0x1b, 0x35, 0x37, 0x41, 0x7e, 0xca, 0xfa, 0x50, 0x0b, 0x3d, 0xd4, 
+  0x80, 0x3a, 0x40, 0x3d, 0x25, 0xc4, 0xb3, 0x24, 0xe9, 0x23, 0x98, 0x56, 0xc8, 0x0e, 0x1f, 0x28, 
+  0x75, 0xb8, 0x53, 0xdc, 0x9c, 0xdd, 0x62, 0x4b, 0x1a, 0x9e, 0x6a, 0x63, 0x75, 0x00, 0xad, 0x8e, 
+  0x9a, 0xe8, 0x14, 0xaa, 0x18, 0x04, 0x25, 0xa0, 0xcd, 0x5a, 0x6b, 0x32, 0xd5, 0x75, 0x70, 0xb0, 
+  0x02, 0xd3, 0x59, 0xda, 0xc5, 0xc3, 0xd3, 0xe2, 0xf8, 0x58, 0x75, 0x80, 0x2f, 0x41, 0x3e, 0xad, 
+  0xb2, 0xb2, 0xc0, 0x71, 0x57, 0x15, 0xbe, 0xcf, 0xbf, 0x57, 0xc6, 0x50, 0x5a, 0x0c, 0x36, 0x52, 
+  0x14, 0xbd, 0x27, 0xaa, 0xc6, 0x31, 0xed, 0xbf, 0xd0, 0xf3, 0x76, 0x4e, 0xc8, 0x1e, 0x73, 0xe8, 
+  0xab, 0x14, 0x05, 0xe2, 0xc3, 0xbc, 0xab, 0xaa, 0x2c, 0x30, 0x55, 0x82, 0xbb, 0x87, 0xa7, 0x91, 
+  0x79, 0x6e, 0x9f, 0x32, 0xf5, 0x0e, 0x76, 0xda, 0x35, 0xa8, 0xb4, 0xf6, 0x43, 0xee, 0xa1, 0xb9, 
+  0xb9, 0x94, 0x4e, 0xa8, 0x35, 0x33, 0x4f, 0x45, 0xc5, 0x95, 0xd4, 0x34, 0x25, 0xac, 0x8a, 0xbf, 
+  0x94, 0xe2, 0x1a, 0xba, 0xeb, 0x32, 0x7b, 0x27, 0x61, 0x5a, 0x8d, 0x5a, 0xdd, 0x64, 0x6b, 0x6a, 
+  0xd2, 0xb7, 0x46, 0xaf, 0x0f, 0x2b, 0xaa, 0xf5, 0x3c, 0x1d, 0x0f, 0xc2, 0x99, 0xb5, 0x95, 0x8e, 
+  0xb4, 0x56, 0xd3, 0x60, 0xb9, 0xdb, 0xbe, 0xb5, 0x82, 0x8d, 0x62, 0xad, 0xf4, 0xe4, 0x08, 0x27, 
+  0xc0, 0xcf, 0x44, 0xbf, 0x7e, 0x54, 0x87, 0x44, 0x63, 0x30, 0xbb, 0x3e, 0xc7, 0x48, 0x8a, 0x62, 
+  0x5d, 0x19, 0x68, 0x9a, 0xd9, 0x62, 0xdb, 0x6d, 0x0c, 0xd7, 0x33, 0x65, 0x5d, 0xa5, 0x9a, 0x31, 
+  0x37, 0x08, 0xba, 0x44, 0x35, 0x7c, 0x63, 0x6b, 0xe0, 0x03, 0x18, 0xf6, 0xcc, 0x9b, 0xd0, 0x08, 
+  0x42, 0x2f, 0x52, 0x2a, 0x38, 0x56, 0x21, 0x57, 0xea, 0x2c, 0xca, 0x11, 0x3b, 0x0f, 0x56, 0x8d, 
+  0x5a, 0x9b, 0x8d, 0xf2, 0x65, 0x46, 0xbf, 0x03, 0xf4, 0xf3, 0x57, 0x42, 0x10, 0x4e, 0x57, 0x81, 
+  0xbe, 0xd4, 0x00, 0x70, 0x05, 0xff, 0x22, 0x44, 0x15, 0xf9, 0x50, 0xe3, 0x99, 0xd0, 0xd0, 0x19, 
+  0xe6, 0x07, 0x1a, 0x65, 0x7f, 0x95, 0x54, 0x05, 0xfd, 0xd9, 0xd9, 0x09, 0x36, 0xca, 0xaf, 0x30, 
+  0x1e, 0x57, 0xd6, 0xaf, 0x20, 0x7c, 0x4b, 0x2b, 0x55, 0x04, 0x76, 0xea, 0x77, 0x84, 0xfc, 0x54, 
+  0x76, 0xc1, 0x35, 0x31, 0x9a, 0xd1, 0x03, 0x5e, 0xcf, 0x8c, 0x57, 0x9f, 0x39, 0x8b, 0xd9, 0xc9, 
+  0xcc, 0x56, 0x81, 0x46, 0x61, 0xbb, 0xbd, 0x66, 0x95, 0x89, 0x09, 0xe7, 0xc1, 0x98, 0x33, 0x8b, 
+  0x08, 0x3a, 0x4b, 0x3e, 0x51, 0x04, 0x55, 0x54, 0x6e, 0xe8, 0x69, 0x98, 0x98, 0xab, 0x11, 0x95, 
+  0x79, 0xe6, 0xda, 0x6e, 0x88, 0x7e, 0x3a, 0x11, 0x5a, 0x6a, 0x84, 0x5d, 0x13, 0x75, 0xc0, 0x15, 
+  0xd1, 0xb6, 0x59, 0xe4, 0x0d, 0x58, 0xbf, 0x7e, 0x7c, 0x4c, 0x5d, 0x5b, 0xa0, 0x7f, 0xf3, 0xe8, 
+  0xbd, 0x58, 0x83, 0x26, 0xde, 0x1d, 0x1f, 0x57, 0x4e, 0xe5, 0x70, 0xc7, 0x86, 0xfe, 0xe9, 0x3a, 
+  0x7a, 0xd3, 0x8d, 0x94, 0xf4, 0x34, 0x27, 0x14, 0x58, 0x0b, 0x93, 0xb5, 0xdd, 0xf6, 0x87, 0xe2, 
+  0x26, 0x5a, 0x9b, 0xee, 0x33, 0x29, 0x21, 0xd0, 0x78, 0x1f, 0x69, 0x27, 0xa5, 0xed, 0x36, 0x09, 
+  0x46, 0xb3, 0x0e, 0x9b, 0x10, 0x74, 0x94, 0x9d, 0x2c, 0x5a, 0x4f, 0x66, 0x53, 0x7a, 0xaa, 0xb3, 
+  0x37, 0x50, 0xa3, 0x99, 0x51, 0xd0, 0x0f, 0x04, 0x74, 0x48, 0x4d, 0xcf, 0x26, 0xaa, 0xc8, 0x7f, 
+  0x0e, 0x76, 0x82, 0xc0, 0xf0, 0x5d, 0x30, 0x2a, 0xa2, 0xab, 0x49, 0x6c, 0x9c, 0xe8, 0x0b, 0x62, 
+  0x3b, 0x4a, 0x1c, 0x8a, 0xa6, 0x2d, 0x7c, 0x6f, 0x27, 0x4a, 0xeb, 0xa2, 0xd1, 0x95, 0x37, 0xd1, 
+  0x75, 0xb0, 0xbb, 0x84, 0x16, 0x37, 0x8b, 0x3a, 0x05, 0xda, 0x3a, 0x3e, 0xde, 0xf4, 0x7a, 0x42, 
+  0x42, 0x1d, 0xae, 0x8b, 0x07, 0xac, 0xaa, 0xef, 0x46, 0x33, 0x28, 0xe4, 0xd1, 0xdb, 0x8d, 0xed, 
+  0x10, 0xb5, 0xb6, 0xd2, 0xad, 0x15, 0x44, 0xc0, 0x17, 0x8a, 0x0f, 0xb6, 0x74, 0x74, 0x70, 0xba, 
+  0x51, 0x4a, 0xe8, 0x19, 0x16, 0x6e, 0xc9, 0xea, 0xe7, 0x85, 0x52, 0x42, 0xe3, 0x27, 0xfa, 0x43, 
+  0xf9, 0x95, 0x20, 0x0e, 0xd9, 0x02, 0x84, 0x6d, 0x11, 0xec, 0x0c, 0xb5, 0xca, 0xa1, 0x54, 0x43, 
+  0x00, 0x34, 0x09, 0xdd, 0xef, 0xc2, 0x7a, 0x15, 0x0e, 0x4f, 0x37, 0xdd, 0x95, 0xbd, 0xab, 0x39, 
+  0x5c, 0x50, 0x3d, 0x06, 0x50, 0xf5, 0xd0, 0xc4, 0x7b, 0xe2, 0x3e, 0xc5, 0x92, 0x63, 0xe0, 0x5c, 
+  0x46, 0x83, 0x53, 0xf3, 0xa1, 0xb8, 0xa3, 0x9b, 0x2b, 0xcb, 0xc4, 0x68, 0xbc, 0x35, 0xe6, 0x43, 
+  0xa8, 0xa1, 0xdc, 0xf9, 0xa0, 0xda, 0xec, 0xf1, 0x6c, 0x3c, 0x38, 0x4d, 0xbd, 0xd9, 0x8e, 0xd6, 
+  0xd3, 0xba, 0x06, 0x44, 0x0f, 0xf2, 0x56, 0x8c, 0xa7, 0xda, 0x03, 0x9b, 0x4a, 0x82, 0x30, 0x9c, 
+  0x5b, 0x27, 0xe0, 0x8e, 0x66, 0xb6, 0x19, 0x38, 0xe7, 0xb8, 0x47, 0xe2, 0xc1, 0xd0, 0x2f, 0x6d, 
+  0x76, 0x1d, 0x7a, 0xf1, 0xe4, 0x94, 0x56, 0x69, 0x09, 0xfe, 0x7a, 0xe9, 0x98, 0x6f, 0x83, 0xca, 
+  0x91, 0xd5, 0x7b, 0xf9, 0x82, 0x23, 0xf1, 0x12, 0x8d, 0x86, 0x35, 0x59, 0x0b, 0xf7, 0x7f, 0x6b, 
+  0x1c, 0x1c, 0x7d, 0x07, 0x38, 0xb6, 0xc4, 0x27, 0x63, 0x43, 0x3b, 0xd3, 0x3b, 0x75, 0x0e, 0xbe, 
+  0x8c, 0x7c, 0x7b, 0x7e, 0x84, 0x98, 0x55, 0x8d, 0x27, 0x5c, 0x64, 0xa5, 0x34, 0x9e, 0x38, 0x8e, 
+  0xad, 0x4c, 0x0f, 0xce, 0x21, 0xf9, 0x19, 0xdb, 0xe7, 0x5c, 0x1f, 0x38, 0x3e, 0x97, 0xaf, 0xfb, 
+  0x9a, 0x19, 0xa4, 0xa4, 0x43, 0x47, 0xeb, 0xb1, 0xed, 0x14, 0x8f, 0xf5, 0x6b, 0xdf, 0x8d, 0xcb, 
+  0xa1, 0xb5, 0x2b, 0x01, 0xe1, 0xf4, 0xcc, 0xd1, 0x83, 0x33, 0x5e, 0xce, 0x10, 0x29, 0xcb, 0xa5, 
+  0xa0, 0x05, 0x21, 0x30, 0x35, 0x06, 0x25, 0x46, 0x6d, 0x22, 0x35, 0x04, 0xcd, 0x81, 0x13, 0x6e, 
+  0x7c, 0x68, 0x24, 0xe6, 0x04, 0x79, 0x66, 0xb8, 0x1c, 0x75, 0x92, 0xbc, 0xac, 0x9f, 0x24, 0x2f, 
+  0xf5, 0xe9, 0xf4, 0xcc, 0xf0, 0x5d, 0x89, 0x18, 0x06, 0xa2, 0x43, 0x4b, 0x98, 0xdb, 0x05, 0x20, 
+  0x02, 0x99, 0x55, 0x31, 0x03, 0xaa, 0xe3, 0xdc, 0x39, 0x8e, 0xe7, 0x6b, 0x0b, 0x90, 0xd6, 0x97, 
+  0x12, 0x5f, 0x3b, 0x27, 0xb8, 0x59, 0x06, 0x01, 0xc1, 0x3a, 0xfc, 0xa6, 0x08, 0x80, 0x10, 0xf0, 
+  0xc0, 0x74, 0xe6, 0x50, 0x27, 0x10, 0x03, 0xcd, 0x75, 0x0f, 0x8a, 0xce, 0xcc, 0xd1, 0x63, 0x2f, 
+  0x30, 0xce, 0x41, 0xda, 0xdd, 0x96, 0xcf, 0x42, 0x9d, 0x89, 0x7d, 0x17, 0xa3, 0xa8, 0xd3, 0x99, 
+  0x89, 0xe7, 0x7e, 0x20, 0xea, 0x1e, 0x98, 0x07, 0x0e, 0x81, 0x0d, 0x1f, 0x70, 0x67, 0x7d, 0xe0, 
+  0x2c, 0x76, 0x8b, 0x2b, 0xbc, 0x95, 0xb8, 0xdb, 0x3c, 0xe2, 0xff, 0xa2, 0xdc, 0xdf, 0x3d, 0xe1, 
+  0xfd, 0x45, 0xa9, 0xa6, 0x2a, 0xad, 0x60, 0x43, 0x27, 0x85, 0xf2, 0x20, 0x96, 0x84, 0x4c, 0xb4, 
+  0x86, 0x6a, 0xcb, 0x3a, 0xd5, 0x6b, 0x99, 0x5c, 0x5d, 0x97, 0xdb, 0xdb, 0x64, 0x5e, 0x5e, 0x7b, 
+  0xa2, 0xc9, 0x3b, 0x2a, 0x7a, 0xd6, 0x7e, 0x70, 0xac, 0x14, 0x9e, 0x31, 0xed, 0x36, 0xd4, 0x5b, 
+  0x84, 0xd3, 0x9f, 0x04, 0x8d, 0xc3, 0x82, 0x7b, 0x3e, 0xd6, 0xad, 0xe3, 0x62, 0x3d, 0xdc, 0x09, 
+  0x1f, 0x17, 0x71, 0x46, 0x52, 0xf7, 0xae, 0xe7, 0x6d, 0xa0, 0x8e, 0x51, 0x78, 0x1f, 0x18, 0xb4, 
+  0x2a, 0x6a, 0x47, 0xad, 0xbf, 0x6c, 0x1d, 0x24, 0x21, 0x82, 0x0f, 0x2a, 0x01, 0xab, 0x89, 0x30, 
+  0xa7, 0x44, 0xd9, 0x3f, 0xea, 0xd0, 0x92, 0xe9, 0x90, 0xb6, 0x8d, 0x3e, 0x55, 0x4e, 0xf2, 0xba, 
+  0x5b, 0x5f, 0x88, 0x56, 0x8e, 0x7d, 0xe4, 0xce, 0xbd, 0xd2, 0x0b, 0x4f, 0xca, 0xe9, 0xb8, 0x31, 
+  0xd5, 0xff, 0x91, 0xe7, 0x1f, 0xf1, 0x62, 0x84, 0xb0, 0xcf, 0x83, 0xd1, 0x19, 0x6f, 0xf8, 0x68, 
+  0xcd, 0x71, 0x2c, 0xd7, 0x39, 0x51, 0x5d, 0xeb, 0xbf, 0xa5, 0x1f, 0x4d, 0x88, 0x13, 0x56, 0x71, 
+  0x31, 0xd7, 0xb9, 0x65, 0x46, 0xcf, 0x5c, 0x8f, 0x3d, 0x73, 0x43, 0x1f, 0x57, 0x4f, 0xa9, 0x08, 
+  0x07, 0x7d, 0x5e, 0x1b, 0xbf, 0x38, 0x71, 0xa6, 0x8e, 0x1a, 0xd3, 0x66, 0xa0, 0x87, 0x7c, 0x49, 
+  0x8f, 0xac, 0x0f, 0xe7, 0xda, 0x5e, 0xa2, 0x5d, 0x76, 0x4a, 0xb4, 0x7e, 0xad, 0x6b, 0xfd, 0xa0, 
+  0xd2, 0x8f, 0x5d, 0x1f, 0x88, 0x14, 0x68, 0x3d, 0x46, 0xd2, 0x11, 0x38, 0x71, 0x64, 0x4d, 0x52, 
+  0x51, 0x50, 0x1c, 0xbf, 0xbb, 0x7d, 0xad, 0x0f, 0x03, 0x00, 0x11, 0xbf, 0x33, 0x3e, 0x15, 0x55, 
+  0x80, 0x73, 0xd7, 0x51, 0x1b, 0x75, 0x3c, 0x41, 0x4b, 0x21, 0x1d, 0x4d, 0xda, 0xf3, 0xa6, 0x0a, 
+  0x74, 0x32, 0x6d, 0x51, 0xc3, 0x37, 0xc3, 0x11, 0x48, 0x15, 0xe6, 0x34, 0x35, 0x15, 0x57, 0x62, 
+  0x3f, 0x2a, 0x79, 0x63, 0xe6, 0x99, 0x91, 0x6e, 0x0d, 0xb1, 0x57, 0x63, 0xff, 0xbe, 0x91, 0x48, 
+  0xed, 0xe3, 0xbc, 0x7d, 0x1a, 0x71, 0x78, 0xd0, 0xda, 0xdb, 0xe8, 0xe4, 0xb7, 0x53, 0x7f, 0x12, 
+  0xf7, 0xfe, 0x9c, 0x4e, 0x7e, 0xbb, 0x38, 0xb9, 0x18, 0x7c, 0x1e, 0x72, 0x38, 0xb5, 0xf2, 0x22, 
+  0xbf, 0x48, 0x2f, 0x16, 0xd3, 0xc7, 0xc1, 0xa4, 0x7e, 0x7f, 0x71, 0x32, 0xfe, 0xdc, 0x1f, 0x87, 
+  0xa7, 0x54, 0x76, 0xf8, 0xf9, 0x16, 0xf1, 0x95, 0xaa, 0x5e, 0x3d, 0xf3, 0x75, 0x54, 0x1b, 0xdd, 
+  0x2f, 0x8e, 0xba, 0xaa, 0xc3, 0xf8, 0xca, 0xd6, 0x18, 0xbe, 0x9d, 0x4e, 0x2d, 0xee, 0x31, 0x5c, 
+  0x5d, 0x77, 0x38, 0x2e, 0x6d, 0x05, 0xd2, 0x96, 0xaf, 0x6b, 0xa2, 0x71, 0xaa, 0x3f, 0xd9, 0x0b, 
+  0x82, 0x93, 0x3e, 0xf4, 0x69, 0x0f, 0x5a, 0x30, 0x1b, 0x1c, 0x53, 0x57, 0x71, 0x66, 0x32, 0xe1, 
+  0xd1, 0x33, 0xe8, 0x1e, 0xcc, 0x7d, 0xd4, 0x2e, 0x4a, 0x97, 0x44, 0xf2, 0xec, 0xca, 0x41, 0xeb, 
+  0x10, 0x79, 0x61, 0x9a, 0x11, 0x1e, 0x87, 0x33, 0x14, 0x0e, 0x5d, 0xa9, 0xa8, 0x13, 0x96, 0xfb, 
+  0xaa, 0x1d, 0x50, 0x1f, 0xab, 0x3d, 0xd7, 0xf4, 0xca, 0x26, 0x7a, 0x46, 0x64, 0x7b, 0x92, 0xe3, 
+  0x8c, 0x6c, 0x58, 0x2f, 0x42, 0x8d, 0x9b, 0x80, 0xc8, 0x6d, 0x73, 0x51, 0x87, 0x31, 0x0e, 0x8b, 
+  0xec, 0xc4, 0x13, 0xf6, 0xef, 0xd9, 0xa3, 0xb2, 0xfd, 0x78, 0xbd, 0x1b, 0x29, 0xd9, 0xa4, 0xbe, 
+  0xab, 0xfc, 0x4e, 0xab, 0x08, 0xf2, 0xc1, 0x81, 0x30, 0xcd, 0xd8, 0x30, 0xcd, 0x1c, 0x82, 0x6a, 
+  0x4f, 0xa8, 0xb4, 0x5c, 0x39, 0x2b, 0xa5, 0xa9, 0xca, 0x6a, 0xa7, 0xfb, 0x09, 0xc2, 0xf4, 0x72, 
+  0x74, 0xef, 0x4a, 0x73, 0x19, 0x58, 0x87, 0xfb, 0x7a, 0x03, 0x50, 0x79, 0xb9, 0x35, 0xa9, 0x79, 
+  0xa1, 0xf9, 0xe0, 0x4a, 0x2a, 0xad, 0xd9, 0xf0, 0x34, 0x1f, 0xbb, 0x38, 0x89, 0x80, 0x2f, 0x4c, 
+  0xad, 0xf3, 0x5d, 0x9b, 0x33, 0x5a, 0xbd, 0x9d, 0x67, 0x3a, 0xa4, 0x37, 0x73, 0x90, 0x9d, 0x21, 
+  0xa7, 0x99, 0x68, 0xb7, 0x72, 0x3e, 0xf8, 0xe1, 0x80, 0xf3, 0x00, 0xb5, 0x59, 0x3f, 0x3b, 0x1d, 
+  0x5d, 0x72, 0xdf, 0xfd, 0xed, 0xf8, 0xf8, 0x8d, 0xe5, 0xda, 0xce, 0x98, 0x95, 0x36, 0xbd, 0xa8, 
+  0x2c, 0xeb, 0xec, 0x74, 0xfe, 0x42, 0xfc, 0xa0, 0xa2, 0x94, 0x5d, 0x14, 0x8f, 0xfd, 0xd3, 0xc9, 
+  0xc5, 0xed, 0xc5, 0xcf, 0xd3, 0xee, 0xe7, 0xc1, 0xe4, 0xb7, 0xcf, 0xa7, 0x8f, 0xb7, 0x7f, 0x71, 
+  0x02, 0x95, 0x8d, 0x38, 0x3e, 0x28, 0xc7, 0x93, 0x8f, 0x0e, 0xe8, 0xd4, 0x99, 0xb6, 0xd4, 0x96, 
+  0xd5, 0xf2, 0xd0, 0x2f, 0xc4, 0xe1, 0xf5, 0x77, 0xce, 0x0b, 0xf1, 0x70, 0x94, 0x6f, 0x81, 0x03, 
+  0x45, 0xd1, 0x50, 0x2d, 0x6d, 0x08, 0xa3, 0xe1, 0xb8, 0x42, 0xc7, 0x7d, 0xc4, 0x71, 0xbc, 0x1b, 
+  0xeb, 0x5f, 0x1e, 0xa5, 0x7f, 0x86, 0x7d, 0x67, 0xc3, 0xe1, 0xfa, 0xaa, 0x1e, 0x25, 0x41, 0x13, 
+  0x4d, 0xf3, 0x4e, 0x95, 0x52, 0x66, 0x40, 0x72, 0xba, 0xf7, 0xb9, 0xba, 0xae, 0x22, 0x96, 0xd1, 
+  0xc3, 0xa7, 0xa7, 0x56, 0xed, 0x36, 0x9e, 0x28, 0xfd, 0x11, 0x7b, 0x38, 0x4c, 0xc3, 0x1f, 0x94, 
+  0xa0, 0xcf, 0x31, 0x8c, 0x3b, 0xd0, 0xa7, 0x1f, 0x1f, 0x1b, 0x6f, 0x69, 0xf0, 0x8a, 0x65, 0x5f, 
+  0x45, 0xb2, 0x1f, 0x73, 0x7c, 0x8a, 0x40, 0x83, 0x54, 0x10, 0xee, 0x45, 0xf1, 0x2e, 0xed, 0x3b, 
+  0x0e, 0x0d, 0x63, 0xc2, 0x5f, 0x11, 0xa7, 0x7e, 0x44, 0x80, 0x5c, 0xc6, 0xe9, 0x0c, 0x93, 0x73, 
+  0x36, 0x06, 0x3a, 0x08, 0x41, 0xe0, 0xaa, 0x70, 0xf3, 0x74, 0x43, 0x9c, 0x5f, 0x21, 0xc1, 0xd5, 
+  0xf0, 0x97, 0x42, 0x87, 0x26, 0xd6, 0xb3, 0xb7, 0x7f, 0xf4, 0x27, 0x7c, 0xc7, 0xf0, 0x23, 0xde, 
+  0x2a, 0x60, 0xd0, 0x7e, 0x56, 0xcd, 0x88, 0xd5, 0x65, 0x50, 0xa5, 0x50, 0x28, 0x03, 0x15, 0xf9, 
+  0x1d, 0xa7, 0x4b, 0xc6, 0xfa, 0xc2, 0x2f, 0xf9, 0xac, 0x09, 0x0f, 0x85, 0x9d, 0x1a, 0x73, 0x56, 
+  0x30, 0xd7, 0x02, 0x9f, 0x1b, 0x5e, 0x3a, 0x89, 0xde, 0x35, 0x0f, 0xab, 0xc3, 0xce, 0xa0, 0xdc, 
+  0x62, 0xf5, 0xe2, 0x26, 0xf5, 0xc5, 0x55, 0xf9, 0x93, 0x61, 0x39, 0xb3, 0xba, 0x2a, 0x80, 0x9a, 
+  0x78, 0x11, 0x9d, 0xf9, 0xef, 0x14, 0x94, 0xfe, 0xae, 0x60, 0x54, 0xf1, 0xdf, 0xc5, 0x16, 0x5e, 
+  0x78, 0x74, 0xfb, 0x63, 0x5a, 0x26, 0xcb, 0x2d, 0x9f, 0x4f, 0x3e, 0x11, 0x7f, 0x44, 0xf7, 0xec, 
+  0x33, 0x46, 0x25, 0xd8, 0xc4, 0xa6, 0x1c, 0x3d, 0x0a, 0xce, 0x3b, 0x01, 0x23, 0x2d, 0x4c, 0x6c, 
+  0xf4, 0x59, 0x3d, 0xf7, 0xc4, 0x77, 0x15, 0xbd, 0x75, 0x68, 0xfb, 0xb0, 0x41, 0xdb, 0x2b, 0x03, 
+  0x5f, 0x0d, 0x05, 0xc2, 0xb3, 0xa5, 0x25, 0x3f, 0x80, 0x81, 0x39, 0x91, 0x3a, 0xca, 0x79, 0x67, 
+  0x9f, 0xb7, 0xa3, 0x36, 0x9d, 0x2f, 0x76, 0x24, 0x4f, 0xd3, 0x91, 0xdc, 0x43, 0x6f, 0x2a, 0x85, 
+  0x00, 0xce, 0xaa, 0x38, 0xe8, 0x6d, 0x27, 0x66, 0xcb, 0xac, 0x90, 0x6e, 0xbc, 0xfd, 0x7a, 0x30, 
+  0x6a, 0x8d, 0x7d, 0x2b, 0x35, 0xf2, 0x04, 0x3a, 0xe3, 0xfd, 0x8d, 0xa8, 0x98, 0x14, 0xde, 0x23, 
+  0x16, 0x6b, 0x28, 0x65, 0x81, 0x31, 0x2a, 0x54, 0x78, 0x14, 0x07, 0x92, 0xe0, 0xdc, 0x01, 0x96, 
+  0xa3, 0x71, 0x8e, 0x89, 0x23, 0x18, 0x55, 0xee, 0x01, 0xc3, 0x21, 0x04, 0x44, 0xb8, 0x95, 0xc6, 
+  0xca, 0xe7, 0x04, 0xf8, 0xb3, 0x79, 0x32, 0xfe, 0x00, 0xd9, 0xe2, 0x10, 0xd3, 0xc1, 0x7d, 0x66, 
+  0xad, 0xbe, 0x75, 0xdd, 0x57, 0x1d, 0x5d, 0x0e, 0x4f, 0x8d, 0x54, 0x5a, 0x47, 0xd7, 0x59, 0x10, 
+  0x66, 0xec, 0x35, 0x40, 0x6d, 0xb7, 0xba, 0x4f, 0x8c, 0x5b, 0x42, 0x5d, 0x6b, 0x32, 0x8e, 0x09, 
+  0x11, 0x1a, 0x5e, 0x03, 0x1b, 0xbe, 0x9a, 0xb1, 0xb2, 0xd9, 0xe8, 0xc0, 0x22, 0xa1, 0xde, 0xe1, 
+  0x8c, 0x50, 0xf4, 0x85, 0x1b, 0x77, 0x48, 0x2f, 0x38, 0xc9, 0x11, 0x7e, 0xc0, 0xc1, 0xfd, 0x71, 
+  0x62, 0xd5, 0xa0, 0x60, 0x04, 0x75, 0x12, 0xb1, 0x9b, 0xb9, 0xa0, 0x16, 0x79, 0xb1, 0x99, 0xbc, 
+  0xc0, 0x19, 0x59, 0x2d, 0x07, 0x05, 0xd2, 0x01, 0x07, 0x82, 0xc1, 0x2e, 0xc0, 0x89, 0x46, 0x54, 
+  0xf9, 0x45, 0x33, 0x77, 0x85, 0x5b, 0x29, 0xbd, 0xf7, 0x4d, 0x5e, 0x8c, 0x46, 0xd6, 0x81, 0xb0, 
+  0x71, 0x6f, 0x80, 0x15, 0xaa, 0xe6, 0x9d, 0x8d, 0xfb, 0x7c, 0xdf, 0xe2, 0xe4, 0x61, 0x7c, 0x2b, 
+  0xf6, 0x8f, 0x75, 0x9a, 0xc3, 0x5a, 0x2e, 0xa2, 0xd2, 0x47, 0x85, 0xf4, 0x7e, 0x6e, 0xeb, 0x29, 
+  0x98, 0x71, 0xd7, 0x58, 0x1c, 0xd8, 0xd2, 0xbc, 0xeb, 0x0f, 0x39, 0xa6, 0x35, 0x3f, 0xe3, 0x70, 
+  0xe3, 0x69, 0xd3, 0x49, 0x43, 0x17, 0xc6, 0xee, 0xaf, 0x79, 0xc4, 0x06, 0x3b, 0x85, 0x23, 0x0e, 
+  0x95, 0x6d, 0x7a, 0xff, 0xea, 0xba, 0x69, 0x51, 0x0f, 0x0e, 0xa1, 0xa5, 0xfa, 0x87, 0x8a, 0x1f, 
+  0x68, 0xe1, 0xc3, 0x63, 0x76, 0xdb, 0xe1, 0x41, 0xa3, 0xa6, 0x8f, 0x98, 0xaa, 0xa6, 0x3f, 0x33, 
+  0x3e, 0x2d, 0xd4, 0x4d, 0xeb, 0xba, 0x3c, 0xf7, 0x6b, 0x61, 0xfd, 0x90, 0xe1, 0x21, 0x70, 0x24, 
+  0x65, 0xb6, 0x19, 0x59, 0x3c, 0xdc, 0xfa, 0xbd, 0x2b, 0x58, 0xa3, 0xb0, 0x41, 0xd4, 0x07, 0x44, 
+  0xdd, 0x4e, 0xa4, 0x0e, 0xe5, 0x51, 0x99, 0x17, 0xf6, 0xf4, 0x1f, 0x41, 0x64, 0xf3, 0xa1, 0x3a, 
+  0xe5, 0x5a, 0x7b, 0x14, 0xfa, 0x10, 0x6b, 0xbc, 0x52, 0xae, 0xd6, 0xcb, 0xb8, 0x94, 0x1e, 0xdb, 
+  0xf2, 0xaa, 0xea, 0xa0, 0xe4, 0xb3, 0xf4, 0x95, 0xa3, 0x69, 0x39, 0x01, 0x40, 0xf9, 0x98, 0x85, 
+  0xe9, 0x11, 0x6b, 0xa7, 0x39, 0x3c, 0x7a, 0x3e, 0x6d, 0x53, 0xa1, 0x47, 0x4e, 0x32, 0x96, 0xa4, 
+  0x4a, 0x03, 0xe3, 0xf1, 0xfc, 0x7b, 0x7c, 0x92, 0x59, 0xbb, 0xaf, 0x7f, 0xaa, 0x8e, 0x87, 0x00, 
+  0xb9, 0x10, 0x07, 0xd2, 0x44, 0x3f, 0x25, 0x1b, 0x2b, 0xac, 0xdc, 0xc0, 0xf6, 0x32, 0x31, 0x3c, 
+  0x75, 0x90, 0x38, 0x15, 0xf8, 0x83, 0xf3, 0x1b, 0x35, 0x18, 0x53, 0xf1, 0xbb, 0xa6, 0xf0, 0x1c, 
+  0x90, 0x85, 0x16, 0x55, 0xe6, 0xac, 0x5a, 0x10, 0x0d, 0x34, 0x82, 0x84, 0xc9, 0x8a, 0xa4, 0x7e, 
+  0x1b, 0x9d, 0x90, 0x80, 0xe6, 0x8a, 0x62, 0xdd, 0x93, 0xab, 0x8a, 0x32, 0xbe, 0x72, 0x11, 0x65, 
+  0x25, 0xa0, 0xbe, 0xae, 0x4e, 0xe6, 0x39, 0x4f, 0xbf, 0x68, 0x68, 0x5d, 0x39, 0xf6, 0x1f, 0x61, 
+  0xf7, 0x3b, 0x9f, 0xcf, 0xe4, 0xe6, 0xd9, 0x2a, 0x29, 0x88, 0x73, 0x4b, 0x4c, 0x4a, 0x08, 0x95, 
+  0xd7, 0xad, 0x34, 0x59, 0xdb, 0x88, 0x6f, 0x33, 0x65, 0xcb, 0x6b, 0x99, 0x56, 0x05, 0x95, 0xe9, 
+  0xd0, 0x64, 0xc4, 0xd2, 0xa9, 0xbc, 0x88, 0x0a, 0x1a, 0x5b, 0x50, 0xe0, 0x04, 0x15, 0x4c, 0xf7, 
+  0x4a, 0xd1, 0x50, 0xcf, 0xfa, 0xcf, 0xa9, 0xa2, 0x4b, 0x1a, 0xb9, 0x73, 0xa0, 0x13, 0xf2, 0x64, 
+  0xb4, 0x37, 0xf7, 0xf9, 0x78, 0x3f, 0x66, 0xd0, 0xfd, 0x6e, 0x54, 0xcf, 0xd1, 0xa3, 0x8f, 0xc7, 
+  0xfa, 0xdf, 0xb2, 0xc2, 0x75, 0x2f, 0x5c, 0x7d, 0x89, 0x58, 0x89, 0x48, 0xb1, 0xb7, 0xc3, 0xb9, 
+  0xf4, 0x2a, 0x8b, 0xc7, 0x8e, 0x66, 0xa6, 0x9a, 0x5a, 0x43, 0xf2, 0x33, 0x98, 0x6f, 0xf3, 0x3e, 
+  0x12, 0x4b, 0x90, 0x3c, 0x92, 0xd0, 0xa7, 0x23, 0xb3, 0xcc, 0xa3, 0x4d, 0xd4, 0x1b, 0x06, 0xca, 
+  0x27, 0xaf, 0x30, 0x9a, 0xda, 0x51, 0xb7, 0xbb, 0xb1, 0x2e, 0xcf, 0xa3, 0x80, 0x3d, 0xcb, 0xe3, 
+  0xc9, 0xc6, 0x58, 0x3b, 0x41, 0x8f, 0x84, 0xd4, 0x9e, 0xf4, 0x9c, 0xc6, 0xf7, 0x87, 0xf4, 0xcb, 
+  0x78, 0x59, 0x48, 0x0e, 0xbc, 0x6a, 0xbe, 0x13, 0x32, 0x22, 0x21, 0x60, 0x94, 0x13, 0xd8, 0xaf, 
+  0xb2, 0xfc, 0x0e, 0x96, 0xfd, 0x88, 0x73, 0x81, 0xc2, 0x70, 0x96, 0xb1, 0x4a, 0x57, 0xc2, 0xc4, 
+  0x8f, 0x43, 0x2f, 0x4a, 0x83, 0x8e, 0x55, 0xb0, 0xae, 0x16, 0x6c, 0xbe, 0xeb, 0x0d, 0xc5, 0x2c, 
+  0xba, 0x8f, 0x5b, 0x73, 0xee, 0x20, 0x11, 0x0c, 0x62, 0xf4, 0x25, 0xb5, 0x56, 0xe9, 0x8b, 0xc2, 
+  0x68, 0x27, 0x2a, 0xe7, 0xd7, 0x23, 0x9e, 0x6a, 0x33, 0xb5, 0x8d, 0xd9, 0x24, 0x36, 0x34, 0x18, 
+  0xe7, 0x1a, 0xca, 0x8f, 0x8f, 0x67, 0xf0, 0xe2, 0xe4, 0xb8, 0xa3, 0xb1, 0x31, 0x79, 0xaa, 0xc4, 
+  0x1c, 0x56, 0xe1, 0x6e, 0xd9, 0x9a, 0xe8, 0x3d, 0x07, 0x20, 0x85, 0x93, 0x30, 0x31, 0x49, 0x7e, 
+  0x95, 0xc2, 0x48, 0xe8, 0x8e, 0xa5, 0x66, 0x63, 0xe0, 0x40, 0x20, 0xc2, 0x4b, 0xb6, 0x8c, 0x43, 
+  0xf7, 0xca, 0x7e, 0x2c, 0x0e, 0x38, 0xa9, 0x8d, 0xe0, 0x33, 0x80, 0x3d, 0xab, 0x93, 0x61, 0xd0, 
+  0xa6, 0x8d, 0xd9, 0xcc, 0x1d, 0xc4, 0xf6, 0x84, 0x27, 0x94, 0xd3, 0xe9, 0x29, 0x72, 0xdb, 0x6c, 
+  0x7a, 0xbd, 0x9d, 0x69, 0xba, 0xc9, 0x3e, 0x5a, 0xae, 0x84, 0x6a, 0xac, 0xaa, 0x63, 0x47, 0x84, 
+  0x81, 0x5d, 0xf6, 0x3d, 0xd7, 0xcd, 0x6a, 0xe2, 0x91, 0xab, 0x62, 0x32, 0xd5, 0x95, 0x6b, 0x75, 
+  0x60, 0x4b, 0xb9, 0x2c, 0x2a, 0x14, 0x1f, 0x28, 0x71, 0xec, 0xa8, 0x56, 0xba, 0x2d, 0x27, 0x7c, 
+  0xbc, 0x13, 0xcb, 0xcc, 0x65, 0x26, 0x9a, 0x15, 0x11, 0x09, 0x48, 0x38, 0x85, 0x0f, 0xea, 0x33, 
+  0x63, 0xc3, 0x27, 0xad, 0xd5, 0x75, 0x32, 0xf6, 0x51, 0x94, 0x3f, 0x27, 0xe5, 0x75, 0x3b, 0xdf, 
+  0x93, 0xf1, 0xb1, 0xb0, 0x89, 0x14, 0xca, 0xe8, 0x38, 0x99, 0x6a, 0x5b, 0xe6, 0xd8, 0x78, 0x0d, 
+  0xd3, 0xba, 0x4f, 0x0d, 0x34, 0x95, 0x04, 0xb8, 0x24, 0x6e, 0x55, 0xeb, 0x89, 0xba, 0x5b, 0xfa, 
+  0x3a, 0xeb, 0x9b, 0x46, 0x9b, 0x69, 0xad, 0x9c, 0xef, 0x5a, 0xfb, 0x5b, 0xee, 0x2c, 0x0e, 0x98, 
+  0xb9, 0x89, 0x79, 0x5e, 0x20, 0xe3, 0x40, 0xde, 0xe2, 0x07, 0x4c, 0x5c, 0xf6, 0xc4, 0x23, 0x39, 
+  0x3f, 0x59, 0xdc, 0x79, 0xa0, 0xaf, 0xd9, 0x15, 0x4e, 0x26, 0x7b, 0xc2, 0x41, 0x45, 0xbe, 0xa7, 
+  0x36, 0x9f, 0x17, 0x1c, 0x78, 0xfa, 0x64, 0x2a, 0x26, 0x1e, 0x7d, 0x96, 0x2d, 0x6f, 0xa0, 0x92, 
+  0x06, 0xb6, 0x6c, 0x54, 0x00, 0xa4, 0x71, 0xd4, 0x5e, 0x4b, 0xfd, 0xd5, 0x40, 0x98, 0x8a, 0xe6, 
+  0x9e, 0xaa, 0x95, 0x03, 0xff, 0x0a, 0x0f, 0xa8, 0xf7, 0x3f, 0xad, 0x74, 0x28, 0x74, 0x3d, 0xa8, 
+  0x14, 0x2a, 0x52, 0x0f, 0xc1, 0x5f, 0x98, 0x7f, 0x88, 0xa3, 0x7b, 0xe4, 0xdb, 0x6d, 0x5b, 0x04, 
+  0x78, 0x9d, 0x70, 0x06, 0xcb, 0xd6, 0x64, 0x6e, 0x4c, 0x12, 0xaa, 0x75, 0x51, 0xa4, 0x61, 0x6f, 
+  0x9d, 0x18, 0xdd, 0xb7, 0x9e, 0xb0, 0x60, 0xd2, 0xa1, 0x5d, 0x3e, 0xc0, 0xfe, 0x24, 0xeb, 0x5a, 
+  0x1f, 0x18, 0x97, 0x55, 0xa9, 0xa3, 0x2a, 0xbc, 0x6e, 0x16, 0xd2, 0x77, 0xe9, 0x83, 0xde, 0xfd, 
+  0x99, 0x68, 0x23, 0xf6, 0x77, 0xd0, 0x36, 0x4d, 0x3e, 0x99, 0xb2, 0xbf, 0x91, 0xba, 0x1a, 0x15, 
+  0xf4, 0x3b, 0x9c, 0x4e, 0xfd, 0xfd, 0xac, 0xaa, 0x1c, 0x9d, 0xb1, 0x2d, 0xa1, 0xda, 0x88, 0x89, 
+  0x9e, 0x43, 0x1e, 0xed, 0x25, 0xcb, 0x0a, 0x0a, 0x6e, 0x7c, 0xa8, 0xf8, 0x00, 0x4b, 0x9a, 0x66, 
+  0xe6, 0x7d, 0xbd, 0x9a, 0x7a, 0x82, 0x70, 0xcf, 0x09, 0x1d, 0xc3, 0x7c, 0x02, 0x8d, 0x41, 0xd7, 
+  0x03, 0x90, 0x7b, 0x53, 0xd5, 0x58, 0xca, 0x99, 0x7b, 0xaa, 0x26, 0x77, 0x9c, 0x6a, 0x5c, 0x85, 
+  0xd0, 0x0d, 0xaa, 0xd6, 0x76, 0x02, 0x73, 0x57, 0xcd, 0x96, 0x43, 0xca, 0x37, 0x24, 0x92, 0x56, 
+  0x91, 0x81, 0x7d, 0x6d, 0x4f, 0xdd, 0x3f, 0xc2, 0x51, 0x33, 0xe9, 0xdb, 0x1c, 0x63, 0x4a, 0xed, 
+  0x92, 0x9c, 0x6e, 0x94, 0xb9, 0x0e, 0xb9, 0xbb, 0x1c, 0x3b, 0x1c, 0x54, 0xc8, 0x59, 0xd5, 0x0b, 
+  0x27, 0x37, 0x28, 0x84, 0x04, 0x7d, 0xe8, 0xff, 0xfc, 0x5a, 0xf9, 0xe3, 0x23, 0x12, 0xd8, 0xa2, 
+  0xc7, 0x83, 0xdf, 0xb0, 0x11, 0x37, 0xc0, 0xb1, 0x71, 0x64, 0x22, 0xfc, 0xf8, 0xf4, 0x8a, 0x2a, 
+  0x10, 0x2d, 0x55, 0x28, 0x98, 0xb8, 0x14, 0x63, 0x93, 0x5a, 0x49, 0xcc, 0xfc, 0x0d, 0x8d, 0xec, 
+  0x15, 0x8d, 0x4c, 0x5f, 0xbe, 0xa6, 0xcb, 0x20, 0xf4, 0x37, 0xdd, 0xae, 0x78, 0xb8, 0x90, 0x7d, 
+  0x9a, 0xe9, 0x85, 0xc2, 0xfc, 0x07, 0xf8, 0x16, 0x47, 0xa9, 0x5e, 0x31, 0x43, 0xa7, 0x59, 0x92, 
+  0x1c, 0x11, 0x48, 0x02, 0xe1, 0x17, 0xf0, 0x1c, 0xd0, 0xcb, 0xc8, 0xa5, 0xd5, 0x6c, 0xec, 0x76, 
+  0x55, 0xc6, 0x62, 0x1c, 0x3d, 0xb2, 0x94, 0xa7, 0x8c, 0x8a, 0x71, 0x0d, 0x96, 0x99, 0xbb, 0xf2, 
+  0x1d, 0xde, 0xa7, 0x82, 0x62, 0xc2, 0x4f, 0x33, 0xc9, 0xa7, 0x09, 0xbe, 0xce, 0xb2, 0x77, 0x90, 
+  0xaf, 0xdb, 0xdf, 0x00, 0x9e, 0x91, 0x18, 0x7b, 0xf6, 0xee, 0x3c, 0x8f, 0x67, 0xc4, 0x8e, 0x6e, 
+  0x4e, 0xa3, 0xa4, 0xcb, 0x12, 0x3b, 0x75, 0xfb, 0x75, 0x4b, 0xb7, 0x33, 0x0d, 0x69, 0x8c, 0x44, 
+  0x75, 0x87, 0x47, 0xc9, 0xb8, 0x84, 0xb1, 0xc8, 0x69, 0x85, 0xa4, 0x51, 0xe6, 0x34, 0x55, 0xf3, 
+  0xbe, 0xdb, 0x48, 0x74, 0xa0, 0x18, 0xb0, 0xf7, 0x79, 0xdf, 0x49, 0xe9, 0x8d, 0x08, 0xf9, 0xbb, 
+  0x07, 0x36, 0x28, 0x8d, 0x18, 0xf6, 0xe1, 0xc9, 0xd3, 0x29, 0xcb, 0xb2, 0x33, 0x7f, 0x40, 0x4c, 
+  0x0a, 0x52, 0xb6, 0x8d, 0xf3, 0xf0, 0x95, 0x90, 0xb5, 0x85, 0x10, 0x30, 0xaa, 0x37, 0x4b, 0xd2, 
+  0xe2, 0x97, 0xe1, 0x2b, 0x7e, 0xf9, 0x64, 0xef, 0x25, 0xe7, 0x6f, 0x7b, 0x0d, 0x9b, 0xa9, 0xbb, 
+  0x43, 0xf4, 0xe5, 0x03, 0x52, 0xca, 0xd8, 0x12, 0x07, 0xa6, 0xd9, 0x38, 0xe7, 0x55, 0xec, 0x73, 
+  0x90, 0xed, 0x28, 0xa5, 0xc4, 0xc9, 0x47, 0x98, 0x00, 0x3e, 0x9d, 0x8e, 0x62, 0x85, 0x4a, 0x22, 
+  0x8e, 0x02, 0x2b, 0x72, 0xc6, 0x1f, 0xf3, 0x5a, 0xf6, 0xec, 0x24, 0xca, 0x77, 0xd4, 0xf5, 0xa7, 
+  0x3d, 0x39, 0xa5, 0xef, 0x4c, 0xac, 0x2d, 0xf3, 0xe4, 0xa9, 0xfb, 0x64, 0xc0, 0x25, 0x40, 0x8e, 
+  0x85, 0x99, 0x32, 0xdc, 0x20, 0x01, 0x32, 0x2a, 0x2d, 0xf1, 0x00, 0xb4, 0x2f, 0x10, 0x05, 0xe3, 
+  0x8f, 0x69, 0xd4, 0x82, 0x9b, 0xf7, 0x31, 0x0b, 0x4e, 0xe5, 0x68, 0x45, 0x6c, 0xd8, 0x4e, 0x50, 
+  0xeb, 0x1f, 0xd1, 0x60, 0x0c, 0x01, 0x86, 0x8f, 0x93, 0x9d, 0x58, 0xc5, 0x93, 0x49, 0xb5, 0xc3, 
+  0x0a, 0x6c, 0x27, 0xfa, 0xf4, 0xf6, 0xba, 0x21, 0x3a, 0x5a, 0xd4, 0x52, 0x1e, 0x38, 0x3d, 0x06, 
+  0xc5, 0xbd, 0xda, 0x37, 0x19, 0xae, 0x86, 0xa7, 0xcd, 0xd4, 0x85, 0x26, 0xff, 0x67, 0xd5, 0xcd, 
+  0x50, 0x8a, 0x5e, 0x2f, 0x05, 0x37, 0xe9, 0xec, 0x44, 0xe0, 0x37, 0xbb, 0x0f, 0xf7, 0xd2, 0x1f, 
+  0xe6, 0x51, 0x2a, 0x74, 0x9a, 0x40, 0x9f, 0x7d, 0x5a, 0xf7, 0x2a, 0x25, 0xea, 0xe7, 0xc0, 0xab, 
+  0xf2, 0x20, 0x39, 0x8d, 0xb0, 0xab, 0x20, 0x21, 0xc5, 0x5a, 0xec, 0x81, 0xdc, 0x62, 0x5a, 0x15, 
+  0xb1, 0xde, 0x56, 0xa2, 0x43, 0x42, 0x9c, 0x25, 0xa3, 0x7c, 0x92, 0x95, 0xe9, 0xa8, 0xcf, 0x59, 
+  0x12, 0x33, 0x92, 0xf9, 0x8e, 0x8f, 0xf1, 0x57, 0x49, 0x48, 0xd6, 0x66, 0xac, 0xc9, 0x9e, 0x1b, 
+  0x59, 0xe4, 0x0b, 0x2e, 0x2d, 0xd0, 0x8c, 0xad, 0xbd, 0xf2, 0x68, 0x76, 0x60, 0x5a, 0x0b, 0x82, 
+  0x2f, 0xa1, 0x5b, 0x45, 0x0e, 0xbc, 0xed, 0x4b, 0x12, 0x8b, 0xf3, 0x94, 0x2e, 0x5e, 0xc7, 0xe9, 
+  0x95, 0xdc, 0xbe, 0xc6, 0x40, 0x24, 0x11, 0xfe, 0xad, 0x8a, 0xbc, 0xb2, 0x65, 0x67, 0xf6, 0x1f, 
+  0x5f, 0xbf, 0x0c, 0x18, 0x37, 0x3f, 0x3a, 0x19, 0x1d, 0xc2, 0x2e, 0x0d, 0x19, 0xf9, 0x9c, 0x15, 
+  0xe0, 0x19, 0xe2, 0xa7, 0xd8, 0xcb, 0xfe, 0x6d, 0x9c, 0x13, 0x6d, 0xa4, 0x47, 0x2f, 0xed, 0xe1, 
+  0x1d, 0x1c, 0xdc, 0x69, 0x16, 0x31, 0x19, 0xa2, 0x6d, 0x4b, 0x47, 0xb6, 0x25, 0x3e, 0x17, 0x4a, 
+  0x72, 0x4c, 0x51, 0xc4, 0x57, 0x12, 0x31, 0x12, 0x80, 0x50, 0x38, 0x02, 0xcf, 0x99, 0xb2, 0x08, 
+  0x9c, 0x99, 0x92, 0xb5, 0xf0, 0x29, 0x35, 0x54, 0xe3, 0x62, 0x55, 0x2d, 0xd5, 0x06, 0x3b, 0x9e, 
+  0x96, 0xaf, 0xeb, 0x4b, 0x69, 0x61, 0xf0, 0x4b, 0x2a, 0xfa, 0x4e, 0x87, 0xa5, 0x6f, 0xc4, 0x68, 
+  0x7e, 0xf1, 0xc3, 0x77, 0xfa, 0x7c, 0xe1, 0xb7, 0x59, 0x3c, 0x47, 0xf0, 0xba, 0x2f, 0x81, 0xd9, 
+  0x5a, 0xcb, 0xaa, 0xf8, 0xcc, 0x5f, 0x06, 0xa6, 0xaf, 0xbe, 0x4a, 0x8e, 0xab, 0x6e, 0xda, 0xf2, 
+  0x7f, 0x7f, 0xad, 0x56, 0x9a, 0x08, 0xbf, 0x42, 0xfb, 0x6e, 0x91, 0xe6, 0x78, 0x61, 0x5c, 0x36, 
+  0x1b, 0xb1, 0x62, 0x59, 0x6d, 0x5a, 0xc8, 0xa1, 0xe0, 0xe2, 0x3f, 0xc7, 0x49, 0x19, 0xea, 0xeb, 
+  0xda, 0x7e, 0xf3, 0x95, 0x5f, 0xc0, 0xb8, 0xd7, 0xd3, 0x15, 0x73, 0x49, 0x58, 0x0d, 0xb8, 0x02, 
+  0x78, 0x35, 0xda, 0x1b, 0xa4, 0x10, 0xeb, 0x70, 0x5a, 0x87, 0xc1, 0x69, 0xad, 0xfc, 0x76, 0xfb, 
+  0x75, 0x6d, 0x6b, 0xbd, 0x13, 0xf0, 0xbd, 0x55, 0x5a, 0x44, 0x2e, 0xc4, 0xe3, 0x89, 0xd4, 0xb0, 
+  0x90, 0xf7, 0x71, 0xb5, 0x46, 0x82, 0x02, 0x80, 0xfe, 0x3b, 0x55, 0xe0, 0x0d, 0xe0, 0x9f, 0x28, 
+  0x39, 0xa6, 0x4a, 0x4b, 0x76, 0xee, 0x1b, 0x92, 0xe5, 0xde, 0x35, 0xc3, 0xcb, 0xd1, 0xfd, 0x9b, 
+  0x59, 0x9e, 0x2d, 0x97, 0xe3, 0xda, 0x2a, 0xeb, 0x16, 0x89, 0x52, 0xbd, 0x6b, 0x09, 0xad, 0x7d, 
+  0x60, 0xd9, 0xf6, 0x0b, 0x9a, 0x35, 0x73, 0xa0, 0xe1, 0x91, 0x5f, 0x4b, 0xa5, 0xaa, 0xf0, 0x79, 
+  0xeb, 0x89, 0x04, 0xb8, 0x0f, 0xc0, 0x0c, 0x5a, 0xb1, 0x2b, 0x50, 0x88, 0xb3, 0x8c, 0x5f, 0xc0, 
+  0xf0, 0x02, 0xf9, 0x9f, 0x04, 0x47, 0x55, 0x21, 0xb1, 0x6e, 0x93, 0x02, 0xb6, 0x3f, 0xae, 0x74, 
+  0x64, 0x4e, 0xaa, 0xd7, 0xf2, 0x86, 0xf2, 0x07, 0x77, 0x2a, 0x7b, 0x69, 0xcc, 0x99, 0xdc, 0x94, 
+  0xc7, 0x57, 0x3c, 0xf6, 0x2d, 0xcb, 0x02, 0x67, 0x27, 0x6a, 0x9b, 0x06, 0x3e, 0x8b, 0x4a, 0x71, 
+  0x40, 0x11, 0x38, 0x73, 0x54, 0xde, 0x29, 0x47, 0x4e, 0xd4, 0x06, 0x21, 0x7b, 0x82, 0x02, 0x21, 
+  0x51, 0x0a, 0xb8, 0xf2, 0xc7, 0x44, 0x61, 0x73, 0x93, 0x8f, 0x92, 0x9e, 0x10, 0x73, 0xa2, 0x5f, 
+  0x39, 0xa7, 0x26, 0x12, 0xe2, 0x56, 0x66, 0x96, 0xb7, 0x0a, 0xc2, 0xcd, 0x58, 0x85, 0x54, 0x81, 
+  0x2e, 0x27, 0x63, 0xe4, 0xfa, 0x33, 0xa1, 0x9c, 0xde, 0xaa, 0xe8, 0x9d, 0x88, 0x9f, 0xa2, 0x93, 
+  0x9e, 0xf2, 0x16, 0x08, 0x5c, 0xed, 0xd3, 0x8f, 0x75, 0x55, 0x78, 0xbf, 0xcc, 0x7e, 0x5c, 0xaf, 
+  0xad, 0x9f, 0x81, 0x2d, 0xf6, 0x4d, 0xcd, 0xe3, 0xc7, 0x09, 0x5b, 0x41, 0x75, 0x7b, 0xae, 0x9b, 
+  0xf5, 0x8f, 0xce, 0x47, 0x7f, 0x1e, 0xb4, 0x72, 0xab, 0x70, 0x49, 0xee, 0x7d, 0xa7, 0xeb, 0xd8, 
+  0xc0, 0x6d, 0x0d, 0x5f, 0x31, 0xb6, 0x40, 0x42, 0x63, 0x95, 0x9d, 0x55, 0x39, 0x58, 0xe0, 0xaa, 
+  0xfb, 0x55, 0x7f, 0x93, 0xcc, 0xbb, 0xdd, 0x1d, 0xff, 0x46, 0x43, 0xf1, 0x95, 0x9b, 0xeb, 0x9a, 
+  0x43, 0x17, 0xb5, 0x69, 0xcd, 0x27, 0x6e, 0x6d, 0x8d, 0x00, 0x29, 0x5a, 0x11, 0xaf, 0x7c, 0xbb, 
+  0x58, 0xbe, 0x09, 0xc4, 0x9f, 0x2a, 0x09, 0xb7, 0x1b, 0x68, 0xb1, 0x5e, 0x45, 0x54, 0x86, 0xfa, 
+  0xbb, 0xb9, 0x5c, 0x24, 0xa9, 0xac, 0x8e, 0xbf, 0x0b, 0xb7, 0x9c, 0xd0, 0x9e, 0xc8, 0x25, 0xb4, 
+  0xb0, 0x8b, 0xe4, 0x6a, 0x93, 0xb3, 0xd2, 0x80, 0x6d, 0xe7, 0x01, 0x52, 0x56, 0x17, 0xb2, 0x3c, 
+  0x74, 0x80, 0x4a, 0x99, 0x96, 0x78, 0x48, 0x26, 0x2a, 0xf2, 0x9e, 0x3a, 0x33, 0x48, 0x26, 0xdf, 
+  0x10, 0xc9, 0x26, 0xf2, 0xdf, 0xc8, 0x6e, 0xaa, 0xde, 0xe4, 0x41, 0x3d, 0x89, 0x67, 0xd2, 0x4c, 
+  0xe3, 0xbd, 0x17, 0x0c, 0x9a, 0x4f, 0x5b, 0xd4, 0x1a, 0x0e, 0x1b, 0x23, 0x47, 0x58, 0x9f, 0xda, 
+  0x03, 0xd5, 0x03, 0x12, 0x3d, 0x67, 0x33, 0xa2, 0x14, 0x87, 0x94, 0xe1, 0x55, 0xf5, 0xdb, 0xed, 
+  0x01, 0xcd, 0xac, 0x2d, 0x92, 0x8e, 0xad, 0xdd, 0x05, 0x3d, 0x0c, 0x95, 0x19, 0xa6, 0x50, 0xb7, 
+  0x54, 0x67, 0x15, 0x1e, 0x3f, 0x25, 0x4e, 0x12, 0xf4, 0xa8, 0xa9, 0x65, 0xaa, 0x99, 0xe9, 0x9a, 
+  0xab, 0x5f, 0xdb, 0xe7, 0x8d, 0x90, 0xcf, 0xc1, 0x3d, 0x3b, 0x63, 0xd7, 0x33, 0x11, 0x83, 0x9b, 
+  0x65, 0xfd, 0xf3, 0x37, 0xe8, 0x4b, 0x84, 0xf1, 0x06, 0x09, 0x42, 0x05, 0x12, 0x2f, 0x14, 0x96, 
+  0x35, 0x8d, 0x65, 0xe0, 0xfa, 0x3f, 0x2b, 0x1f, 0x6e, 0x9d, 0x17, 0x06, 0xe2, 0x63, 0x3a, 0x9d, 
+  0xee, 0xaa, 0xb6, 0x08, 0xbf, 0x02, 0xcb, 0x3b, 0xf9, 0x75, 0x15, 0xae, 0x79, 0x00, 0xea, 0x34, 
+  0x47, 0x68, 0x53, 0xcd, 0xd4, 0xde, 0x42, 0xa3, 0x7e, 0x1d, 0x17, 0x2f, 0xe2, 0x32, 0xfe, 0xf8, 
+  0x3d, 0xf0, 0x60, 0x77, 0x70, 0x6a, 0x9f, 0x69, 0xb5, 0x4a, 0xd3, 0xf7, 0x95, 0xf8, 0x55, 0xff, 
+  0xfe, 0x5d, 0xbb, 0x34, 0xdc, 0x2b, 0x7f, 0x86, 0xc7, 0x17, 0xbb, 0xed, 0xc5, 0xc4, 0x5c, 0x4f, 
+  0x91, 0x75, 0xed, 0x1f, 0xd1, 0xc9, 0xe4, 0x59, 0xef, 0x9f, 0x53, 0x17, 0xe9, 0xfc, 0x73, 0xcf, 
+  0x51, 0xae, 0x5a, 0xf2, 0xbd, 0xf3, 0xf0, 0xb0, 0xdd, 0x47, 0xde, 0x9c, 0x06, 0xd3, 0x73, 0x43, 
+  0xe6, 0xfc, 0x43, 0x78, 0xbd, 0x47, 0xc7, 0x5e, 0xf3, 0xb8, 0x7f, 0x13, 0x9e, 0x38, 0x35, 0x70, 
+  0xcd, 0x81, 0x0f, 0x5e, 0xce, 0x2c, 0xd8, 0xa5, 0x2d, 0xc4, 0xdf, 0x2b, 0xf3, 0x8d, 0x0a, 0x76, 
+  0x03, 0xc1, 0x16, 0x3a, 0x5d, 0x4f, 0xd1, 0x5c, 0xdf, 0x03, 0x42, 0x50, 0xa1, 0x9c, 0x38, 0x5e, 
+  0x15, 0x5c, 0x98, 0xe0, 0x2f, 0xe4, 0x8d, 0xbb, 0x32, 0xfc, 0xbb, 0x75, 0x01, 0xf9, 0xe6, 0xcd, 
+  0x0f, 0xdf, 0x2b, 0xdf, 0x01, 0xde, 0x32, 0xc1, 0x0e, 0x86, 0x00, 0x2b, 0x3e, 0xee, 0x7e, 0x75, 
+  0xa0, 0x57, 0x1d, 0x6e, 0x32, 0xd2, 0x5f, 0xe5, 0x4a, 0x76, 0xe6, 0xda, 0xbd, 0xf7, 0x16, 0xd1, 
+  0x86, 0xd1, 0xd2, 0x2f, 0x59, 0x06, 0xff, 0xc5, 0xb9, 0xdb, 0x89, 0x79, 0xfd, 0x9b, 0xda, 0xf6, 
+  0xfb, 0xb5, 0xaf, 0xb6, 0xa7, 0xe9, 0x83, 0xde, 0x31, 0x2f, 0x9a, 0x9f, 0x04, 0xf7, 0xbf, 0x6a, 
+  0x76, 0x4a, 0xc7, 0x5a, 0x7c, 0xfb, 0x50, 0xad, 0xbf, 0x34, 0x6b, 0x7d, 0x7b, 0xb0, 0xda, 0x5f, 
+  0x6a, 0xd5, 0x32, 0x93, 0xe2, 0x58, 0xfa, 0xeb, 0x8d, 0xc0, 0x38, 0xad, 0xdd, 0x9d, 0x74, 0x78, 
+  0x7e, 0x65, 0xf8, 0xc5, 0x79, 0x2c, 0x62, 0xd2, 0x1d, 0xef, 0xd4, 0xda, 0x5e, 0x36, 0x4e, 0x97, 
+  0x2d, 0x0a, 0x8b, 0x54, 0xb9, 0x5a, 0x28, 0x09, 0xd1, 0x61, 0x49, 0xd5, 0xba, 0x28, 0x55, 0x0e, 
+  0xa2, 0x71, 0x3c, 0x6a, 0x26, 0xaf, 0x37, 0xe7, 0xcd, 0xe1, 0x0b, 0xed, 0x60, 0x28, 0xeb, 0x5a, 
+  0x63, 0x1b, 0x27, 0xbc, 0xf0, 0x2b, 0x63, 0x2c, 0xce, 0x18, 0x4c, 0xd2, 0xaf, 0xfb, 0xe6, 0x9f, 
+  0x8d, 0xa7, 0xa3, 0x0f, 0x76, 0x06, 0x2a, 0x36, 0x98, 0x26, 0x95, 0x83, 0xcc, 0xbe, 0xbc, 0xa5, 
+  0xde, 0x10, 0x4f, 0x82, 0x9e, 0xd5, 0xcd, 0x57, 0x89, 0xe9, 0x88, 0x72, 0x68, 0xcb, 0x1c, 0x67, 
+  0x80, 0xce, 0x2f, 0xba, 0x8b, 0x9e, 0x86, 0x1b, 0x6c, 0x8f, 0xc2, 0x33, 0x09, 0xc6, 0x4a, 0x6b, 
+  0x4e, 0x18, 0x95, 0xc0, 0x5c, 0x48, 0x9c, 0xae, 0xe2, 0x3d, 0xd1, 0x56, 0xc4, 0x8d, 0x92, 0x20, 
+  0xaa, 0xc8, 0x6b, 0x6a, 0x77, 0x2a, 0xaf, 0x73, 0xa2, 0x36, 0x5a, 0x7f, 0xfc, 0x29, 0x91, 0xb6, 
+  0x7f, 0xaa, 0x33, 0xa0, 0x9c, 0x4b, 0x7b, 0xf4, 0x0b, 0x0f, 0xac, 0xd9, 0xaa, 0x1b, 0x32, 0x34, 
+  0x39, 0x00, 0x90, 0x75, 0xbb, 0xfa, 0xfe, 0x84, 0x69, 0x98, 0x52, 0x7e, 0x03, 0xc1, 0xce, 0xd8, 
+  0xd0, 0x35, 0x54, 0xfd, 0xb1, 0x91, 0x1b, 0x19, 0x1e, 0xf4, 0xd2, 0xad, 0x1c, 0xa9, 0x22, 0xf8, 
+  0x14, 0x79, 0x8b, 0xf7, 0x88, 0xc5, 0xc5, 0x1f, 0x21, 0xf0, 0xe3, 0x2f, 0x96, 0x00, 0x09, 0x78, 
+  0x0b, 0x22, 0x94, 0xd8, 0x5e, 0x82, 0x7a, 0x94, 0x72, 0xb6, 0x80, 0xeb, 0x18, 0x45, 0xeb, 0x1d, 
+  0xda, 0xb4, 0x04, 0x81, 0xc8, 0x41, 0x1d, 0x68, 0x8f, 0xca, 0xfd, 0x4e, 0x11, 0x5a, 0x8a, 0x74, 
+  0xfb, 0x23, 0x63, 0xed, 0xe4, 0x52, 0xaa, 0xf1, 0x2a, 0xc3, 0x16, 0x34, 0x8b, 0xf6, 0xa8, 0x13, 
+  0x98, 0xa2, 0xb7, 0x5c, 0x0c, 0x02, 0x61, 0xa1, 0x62, 0xbb, 0xc2, 0x17, 0xda, 0x28, 0xc4, 0x71, 
+  0x0c, 0x91, 0xc1, 0xa1, 0xfa, 0x86, 0xc4, 0x57, 0x3e, 0x68, 0xe2, 0xa3, 0xad, 0x48, 0xfb, 0xb4, 
+  0x9a, 0xc8, 0xb8, 0xee, 0xb7, 0x81, 0xd0, 0x24, 0x26, 0x63, 0x3b, 0x97, 0xb0, 0xf6, 0x42, 0x67, 
+  0xf6, 0xcf, 0xfa, 0x7a, 0x30, 0x1a, 0x53, 0x64, 0x48, 0xe2, 0x42, 0x7c, 0x33, 0x6f, 0x51, 0x36, 
+  0xa2, 0xb0, 0x4a, 0x02, 0xba, 0x1d, 0xa7, 0x9f, 0xed, 0xf9, 0xd3, 0xf5, 0xb4, 0x73, 0x09, 0x6f, 
+  0x64, 0xb1, 0x8b, 0x5a, 0x80, 0x94, 0x31, 0x9d, 0x9d, 0xe6, 0x54, 0xdc, 0x2b, 0x13, 0xcd, 0x61, 
+  0xfd, 0x79, 0x53, 0x9f, 0xe3, 0x20, 0x9f, 0x49, 0x69, 0x97, 0x38, 0x9d, 0xaa, 0x2c, 0x4d, 0x4d, 
+  0x64, 0xd4, 0x58, 0x21, 0x0b, 0x34, 0x32, 0x7a, 0x62, 0xec, 0xce, 0x7b, 0x09, 0x1c, 0x59, 0x9f, 
+  0x57, 0x8a, 0x32, 0xc2, 0xcc, 0x0a, 0x89, 0x79, 0x6e, 0x6e, 0xd9, 0x53, 0x28, 0xb0, 0xd4, 0x84, 
+  0x19, 0x7c, 0x56, 0x9a, 0xf8, 0xb1, 0x96, 0xe9, 0x09, 0x5b, 0x01, 0x5d, 0xb5, 0xee, 0x7e, 0xad, 
+  0x0e, 0x1f, 0xd5, 0x21, 0x40, 0x3d, 0x47, 0x0a, 0x72, 0xb3, 0xb8, 0xee, 0x92, 0x76, 0x8c, 0x5b, 
+  0x5e, 0xb5, 0x6e, 0xfa, 0x03, 0x20, 0x9a, 0x7d, 0xb8, 0x7c, 0x78, 0xeb, 0x35, 0x2a, 0x51, 0xd8, 
+  0x6a, 0xb6, 0x94, 0x71, 0xfe, 0x8f, 0x07, 0xeb, 0xd1, 0x00, 0xa3, 0xa0, 0x1d, 0x67, 0xa3, 0xdb, 
+  0x14, 0x7f, 0x6c, 0xff, 0x73, 0x8d, 0xb9, 0xbd, 0x5e, 0xd2, 0x50, 0xe9, 0xfa, 0xb1, 0x40, 0x48, 
+  0xa5, 0x9d, 0xe1, 0x95, 0x87, 0xbc, 0x1f, 0x2a, 0x75, 0x02, 0x91, 0x0a, 0xee, 0x58, 0xe1, 0x3a, 
+  0x68, 0x31, 0x53, 0xd6, 0xe6, 0x9d, 0x05, 0x87, 0x01, 0x21, 0x35, 0x45, 0xd6, 0xc9, 0x35, 0x79, 
+  0x3b, 0x16, 0x7c, 0x08, 0xcf, 0xe0, 0x82, 0x18, 0x82, 0x98, 0xac, 0xc1, 0xaa, 0xf2, 0xd7, 0x67, 
+  0x78, 0xc4, 0x5e, 0xeb, 0x76, 0x85, 0xbe, 0x53, 0x4e, 0x40, 0x95, 0xcc, 0x96, 0x62, 0xcb, 0x5a, 
+  0xdd, 0x50, 0x69, 0x95, 0x43, 0x92, 0xb3, 0xd3, 0xf6, 0xa6, 0x63, 0xb0, 0x53, 0xf3, 0xc7, 0x17, 
+  0xfd, 0x6d, 0x70, 0x31, 0xef, 0xd2, 0xcd, 0x44, 0x9e, 0x4d, 0xf9, 0x05, 0xdd, 0x6e, 0x83, 0x13, 
+  0x9d, 0xf2, 0x0e, 0x39, 0x6f, 0x9b, 0xf9, 0x7e, 0x39, 0x59, 0x70, 0x10, 0x6d, 0x03, 0x78, 0x32, 
+  0xc3, 0x95, 0x99, 0xe5, 0xbd, 0xff, 0x9a, 0x3e, 0x76, 0x72, 0x00, 0x47, 0x13, 0xef, 0x3c, 0x5b, 
+  0xd3, 0xed, 0x6b, 0x1c, 0x1b, 0xa1, 0xdf, 0x2f, 0xb2, 0xb2, 0xcc, 0x56, 0x74, 0xf1, 0xad, 0x5c, 
+  0x94, 0xde, 0x14, 0xb9, 0x71, 0xf7, 0x84, 0x7d, 0x64, 0xbb, 0x6d, 0x59, 0x48, 0xc7, 0x6d, 0xae, 
+  0x99, 0xf5, 0x14, 0x6c, 0x48, 0x06, 0x41, 0x2c, 0x5b, 0xad, 0xb3, 0x42, 0xce, 0xd9, 0x19, 0x30, 
+  0x67, 0x4e, 0xec, 0x75, 0x96, 0xe9, 0x38, 0x3a, 0xfe, 0x7f, 0x50, 0xad, 0x8e, 0xc8, 0x64, 0x2a, 
+  0xf1, 0x33, 0x95, 0xeb, 0xb2, 0x5e, 0x4e, 0x4f, 0x69, 0xdc, 0x9e, 0x6a, 0xd7, 0x4b, 0x61, 0xe5, 
+  0x03, 0x31, 0x93, 0x91, 0x4a, 0x83, 0x56, 0x94, 0x77, 0x4b, 0x4e, 0x22, 0xc7, 0xb9, 0xce, 0xb7, 
+  0xfa, 0x54, 0x4a, 0xed, 0xe9, 0xf1, 0x71, 0x22, 0x59, 0x16, 0xb4, 0x5f, 0x53, 0x37, 0x19, 0x0d, 
+  0x79, 0xba, 0x84, 0x17, 0x38, 0xee, 0x8e, 0x85, 0x6c, 0x39, 0x1e, 0x17, 0x3d, 0x19, 0x10, 0x1c, 
+  0xe6, 0xfb, 0xa1, 0x40, 0x8f, 0x48, 0xd2, 0xdf, 0xe4, 0xbe, 0x1b, 0x88, 0xdd, 0x9d, 0x0d, 0x4d, 
+  0x54, 0xe0, 0x28, 0x20, 0x36, 0x51, 0xe1, 0xe3, 0x34, 0x39, 0xac, 0x5d, 0x1c, 0xc5, 0xd5, 0xe7, 
+  0x02, 0xdf, 0x6f, 0x56, 0x97, 0x32, 0xc7, 0xf9, 0x12, 0x0f, 0xb1, 0x13, 0x39, 0x97, 0x41, 0xed, 
+  0xe4, 0x42, 0xa3, 0x18, 0x0d, 0x92, 0x0a, 0x11, 0x2a, 0x98, 0x1d, 0x1f, 0x77, 0x37, 0x34, 0x2c, 
+  0x93, 0x2e, 0xd6, 0x36, 0xa7, 0x0e, 0xc3, 0x2e, 0x8f, 0x8f, 0x97, 0xd4, 0x0c, 0x0a, 0x2a, 0xd6, 
+  0x60, 0x73, 0x12, 0x3d, 0xa1, 0xe6, 0x67, 0xdb, 0x2d, 0x9e, 0x53, 0x23, 0xdd, 0xcd, 0x76, 0x3b, 
+  0x54, 0xf1, 0xcd, 0xce, 0xd4, 0x94, 0x71, 0x67, 0x97, 0xdd, 0x59, 0x20, 0xfc, 0x61, 0x2f, 0x0b, 
+  0x1e, 0xd3, 0x5f, 0x1f, 0xb1, 0xd1, 0x82, 0x13, 0x2a, 0xda, 0x27, 0xa6, 0xe0, 0x14, 0xb1, 0xed, 
+  0x70, 0x92, 0x92, 0x3a, 0x79, 0x12, 0x65, 0xa3, 0xe5, 0x63, 0xaa, 0x73, 0xef, 0x63, 0x7d, 0x22, 
+  0x70, 0xe7, 0x38, 0xea, 0x53, 0x6b, 0xcb, 0xed, 0x16, 0x2d, 0xc2, 0xe3, 0x32, 0x9d, 0x0c, 0xa7, 
+  0xe3, 0x65, 0xd7, 0xc7, 0x6f, 0x77, 0x18, 0x3c, 0x4e, 0x27, 0x4f, 0xa6, 0x61, 0x37, 0x65, 0x05, 
+  0x3f, 0x38, 0x11, 0x78, 0x34, 0x94, 0xd1, 0x4c, 0xc0, 0x45, 0x23, 0xce, 0xcb, 0x68, 0x89, 0x2d, 
+  0x99, 0xce, 0x11, 0x6f, 0x4d, 0x24, 0x8c, 0x30, 0x36, 0x12, 0x66, 0x83, 0x5a, 0x3e, 0xce, 0x46, 
+  0x5c, 0xba, 0xda, 0xf9, 0xeb, 0x09, 0xc6, 0x3b, 0x40, 0x96, 0x56, 0x83, 0x47, 0x96, 0xa7, 0x8b, 
+  0xd1, 0x12, 0x81, 0x2f, 0x20, 0x5c, 0x2e, 0xa7, 0x1a, 0x92, 0xcc, 0x41, 0x68, 0x17, 0x7e, 0x44, 
+  0x39, 0xf6, 0x2d, 0xe8, 0x60, 0x2c, 0x33, 0x84, 0x02, 0x51, 0xe8, 0x24, 0x77, 0x60, 0x68, 0xbb, 
+  0x65, 0x86, 0x0e, 0x6f, 0x71, 0x22, 0xbb, 0x5e, 0x49, 0xc4, 0x09, 0xd2, 0x18, 0x3c, 0xf3, 0x26, 
+  0x78, 0xc6, 0x92, 0x5d, 0x92, 0x54, 0xbd, 0x70, 0x08, 0x89, 0x32, 0x63, 0x57, 0x8a, 0x11, 0x6d, 
+  0x31, 0x0f, 0x1a, 0x7b, 0xa9, 0x88, 0x12, 0x7b, 0xe0, 0x44, 0xd0, 0x07, 0x1b, 0x0e, 0xdd, 0x81, 
+  0xd0, 0x28, 0xc4, 0xfd, 0x5d, 0x66, 0xf3, 0xbb, 0x5a, 0xa6, 0x91, 0xb8, 0x71, 0xe6, 0xad, 0xa0, 
+  0x8e, 0x6c, 0xf4, 0x1e, 0xc8, 0x9c, 0xfe, 0x03, 0xb7, 0xb5, 0xe7, 0x14, 0xcd, 0x10, 0xcc, 0x58, 
+  0x4f, 0xc0, 0x86, 0x7d, 0x56, 0xbc, 0x4b, 0x58, 0x48, 0xe8, 0x1b, 0x6e, 0x3a, 0xda, 0xc0, 0xa9, 
+  0x32, 0x54, 0x65, 0x3a, 0xce, 0x24, 0xa9, 0x27, 0x42, 0x31, 0x8f, 0xce, 0x5c, 0x29, 0x55, 0x18, 
+  0x16, 0x8b, 0x56, 0xc5, 0x2e, 0x85, 0xb2, 0x11, 0xe1, 0x43, 0x8e, 0x27, 0xb1, 0x9c, 0x36, 0xa6, 
+  0x10, 0x6f, 0x0e, 0xf9, 0x19, 0x17, 0xd7, 0xd9, 0x6d, 0x9b, 0x4f, 0x83, 0x26, 0x6e, 0xe0, 0x53, 
+  0xc5, 0x75, 0x32, 0x97, 0x87, 0xcb, 0xc0, 0xc2, 0x9b, 0x5d, 0x5d, 0x2d, 0xdb, 0x08, 0x9f, 0x87, 
+  0x24, 0xed, 0x32, 0x76, 0xed, 0xa4, 0x63, 0xed, 0x17, 0x8a, 0x86, 0x7d, 0xed, 0xf7, 0x8d, 0x06, 
+  0xcc, 0x75, 0x93, 0xda, 0xc6, 0xba, 0x95, 0xf1, 0x99, 0xfa, 0x35, 0x1f, 0x9a, 0x5b, 0xf5, 0xed, 
+  0xce, 0x12, 0x95, 0x25, 0x31, 0x6a, 0x92, 0x68, 0xba, 0x92, 0xd2, 0x4d, 0x30, 0xa4, 0x2d, 0x87, 
+  0x47, 0xe2, 0x04, 0xeb, 0x6b, 0x7a, 0x55, 0x3f, 0x44, 0xd4, 0x38, 0x43, 0x44, 0x65, 0xae, 0xf1, 
+  0xf9, 0xa3, 0xed, 0x6f, 0xab, 0x6c, 0xbe, 0x59, 0xca, 0x47, 0xdb, 0x8b, 0x13, 0xaa, 0xeb, 0xf7, 
+  0xf8, 0x26, 0xde, 0xca, 0xd9, 0x2a, 0x0e, 0x8a, 0x59, 0x9e, 0xac, 0xcb, 0x93, 0x64, 0xb4, 0x04, 
+  0xe5, 0x50, 0x50, 0x62, 0x80, 0xec, 0xcb, 0x3c, 0xbe, 0x62, 0x70, 0xa9, 0x67, 0x3b, 0x7c, 0x77, 
+  0x20, 0xdb, 0xa1, 0xbf, 0xa8, 0xaa, 0xf8, 0x50, 0x2e, 0x26, 0x9d, 0xd2, 0x87, 0x87, 0x42, 0x20, 
+  0xb4, 0x68, 0x66, 0x2d, 0x36, 0x89, 0x90, 0x84, 0x57, 0xa5, 0x44, 0xda, 0x2b, 0xa4, 0x13, 0xfd, 
+  0x94, 0x40, 0x97, 0xf5, 0x9c, 0x40, 0x0b, 0xa4, 0x19, 0x50, 0x81, 0xe3, 0x9e, 0x2f, 0x09, 0xfe, 
+  0xa2, 0x25, 0x62, 0x1b, 0xd3, 0x05, 0x53, 0x1d, 0x82, 0x84, 0xc6, 0x9d, 0x8d, 0xe0, 0x6a, 0x82, 
+  0xcd, 0xa1, 0x42, 0xf7, 0x64, 0xa4, 0x49, 0x6f, 0xff, 0xf9, 0xfb, 0xd3, 0x13, 0x7b, 0xed, 0x51, 
+  0x1b, 0x69, 0xc6, 0x0d, 0x3c, 0x57, 0x9f, 0x45, 0x9d, 0xce, 0x5e, 0x4b, 0x55, 0xdd, 0xee, 0xb1, 
+  0xc5, 0x66, 0x03, 0x36, 0x65, 0x97, 0xbe, 0x40, 0xdd, 0xea, 0x52, 0xd5, 0x69, 0x6b, 0x61, 0xc8, 
+  0xb8, 0x21, 0xd4, 0x57, 0x22, 0x28, 0x5c, 0x38, 0x19, 0x0a, 0xea, 0x1d, 0xd4, 0x91, 0x38, 0x86, 
+  0x4a, 0x9d, 0x53, 0x97, 0x53, 0x31, 0xcb, 0x96, 0xe1, 0xe4, 0x89, 0x7d, 0x79, 0x4a, 0xf7, 0x57, 
+  0x79, 0xb6, 0x59, 0xab, 0x62, 0xf6, 0xce, 0xf9, 0xa2, 0xcc, 0x6b, 0x1f, 0x94, 0xc0, 0x22, 0xba, 
+  0x52, 0xbe, 0x74, 0x8b, 0x52, 0xc3, 0x4f, 0x9b, 0x45, 0x4f, 0xcb, 0x5c, 0x17, 0xcf, 0x3f, 0x6f, 
+  0xf9, 0xe6, 0xad, 0x1e, 0x7e, 0x38, 0x19, 0x20, 0xfe, 0xa8, 0xe7, 0x4d, 0x1d, 0xe4, 0x7d, 0xe5, 
+  0x66, 0x14, 0xb6, 0xcc, 0x56, 0xf4, 0x81, 0x04, 0xab, 0xe3, 0x43, 0xb9, 0xc5, 0x39, 0x88, 0x4f, 
+  0x10, 0x3e, 0x90, 0x7f, 0x73, 0xdc, 0x92, 0x22, 0xc9, 0x7c, 0x46, 0x94, 0xa2, 0xa1, 0xe7, 0x54, 
+  0xc7, 0xfe, 0xc6, 0xd6, 0x09, 0x56, 0xb2, 0x92, 0x3e, 0xad, 0x67, 0x86, 0x6d, 0xc4, 0x74, 0x73, 
+  0x22, 0xd3, 0x20, 0x7e, 0x0a, 0xc7, 0x49, 0x51, 0x58, 0x10, 0xc1, 0x53, 0x84, 0x77, 0xb5, 0xcc, 
+  0x2e, 0xe3, 0x25, 0x0c, 0x8a, 0x1e, 0x9f, 0xa2, 0x56, 0xd4, 0xa4, 0x6c, 0xbe, 0x0b, 0x88, 0x3b, 
+  0x96, 0x7d, 0x9e, 0xcd, 0x08, 0x17, 0x0b, 0xe2, 0x9d, 0x70, 0x61, 0x56, 0x90, 0xaf, 0x63, 0x05, 
+  0x29, 0x37, 0xec, 0xb6, 0x11, 0xcf, 0x05, 0x5f, 0xf0, 0xed, 0xdc, 0xc2, 0x11, 0xd1, 0x06, 0x7a, 
+  0x40, 0xd7, 0xf6, 0x33, 0x0d, 0x5f, 0x0c, 0x42, 0x3a, 0x83, 0xd7, 0x8a, 0x16, 0x28, 0x59, 0x13, 
+  0x2e, 0xf8, 0xab, 0xb9, 0xfa, 0xab, 0x5a, 0x53, 0x93, 0xbb, 0x6b, 0xaa, 0x50, 0xd3, 0x25, 0x30, 
+  0xcf, 0xf6, 0xf8, 0x2f, 0xe3, 0x8b, 0xdb, 0xee, 0xe8, 0x64, 0x54, 0x0b, 0x96, 0xd6, 0x1a, 0x81, 
+  0x4a, 0x11, 0x61, 0xb1, 0x44, 0x78, 0xb3, 0x83, 0x68, 0x46, 0x05, 0x20, 0x5a, 0xd3, 0xdc, 0x5d, 
+  0x57, 0x73, 0xb7, 0x3e, 0xa5, 0xff, 0xd4, 0x49, 0x0f, 0x8e, 0x50, 0xb5, 0x06, 0x99, 0x1b, 0x70, 
+  0x6e, 0x99, 0xa6, 0x9d, 0x88, 0x64, 0x57, 0xb3, 0x44, 0x73, 0x91, 0x39, 0x21, 0x9c, 0xb2, 0x69, 
+  0x98, 0x55, 0xe6, 0xa1, 0x4b, 0x73, 0x78, 0x3e, 0x30, 0x51, 0x21, 0xe2, 0xed, 0x76, 0x51, 0x4f, 
+  0x2a, 0x76, 0x00, 0xc7, 0x15, 0x91, 0xbf, 0xd6, 0xbc, 0x56, 0x06, 0x4d, 0xb1, 0x02, 0xe4, 0x60, 
+  0x3f, 0xf2, 0xff, 0x26, 0xc2, 0x19, 0x7f, 0xe2, 0x02, 0x68, 0x9e, 0x0d, 0xe4, 0x8b, 0xd8, 0xd9, 
+  0xf2, 0x1b, 0xf0, 0x3d, 0x67, 0xfd, 0xeb, 0x72, 0xb5, 0x7c, 0x95, 0x4b, 0xed, 0xc9, 0x9c, 0x05, 
+  0xdd, 0x0d, 0x38, 0xa0, 0x25, 0xbd, 0x1e, 0x4c, 0x47, 0x4b, 0x56, 0xdf, 0x40, 0x9d, 0x63, 0x77, 
+  0x7f, 0x35, 0xbe, 0xd8, 0x75, 0xc3, 0x16, 0x34, 0x88, 0x85, 0xeb, 0x30, 0xee, 0x46, 0x71, 0x25, 
+  0xc6, 0x43, 0x87, 0x62, 0xd2, 0xde, 0x80, 0x7a, 0x70, 0x38, 0x19, 0xac, 0xd8, 0x70, 0x4d, 0x89, 
+  0x17, 0x8d, 0xaf, 0xb0, 0x14, 0xa3, 0x2c, 0x9a, 0x4f, 0xd6, 0x26, 0x3a, 0x47, 0xce, 0xc1, 0x9f, 
+  0x2a, 0xb7, 0xcb, 0x0c, 0x0e, 0x2e, 0x89, 0x8d, 0x27, 0xe5, 0x4c, 0xf2, 0x2c, 0x4a, 0x50, 0x31, 
+  0xb1, 0x2f, 0x08, 0x17, 0x58, 0x9b, 0x5c, 0xf0, 0x12, 0x8a, 0xee, 0x78, 0x6c, 0x8c, 0x5b, 0x21, 
+  0xd1, 0xb3, 0x50, 0xf9, 0xbe, 0x97, 0xdc, 0x62, 0x3c, 0x59, 0x72, 0x8b, 0xd7, 0x66, 0xa5, 0x4c, 
+  0x50, 0x49, 0x2f, 0xb0, 0xe7, 0x77, 0xb3, 0x2a, 0x37, 0x29, 0xb3, 0x83, 0xb7, 0x20, 0x74, 0xef, 
+  0xe4, 0xdd, 0x89, 0x78, 0xaf, 0x29, 0xe6, 0x2a, 0xdb, 0x14, 0x72, 0xbb, 0xce, 0x12, 0xd8, 0xeb, 
+  0xb7, 0x33, 0x75, 0x96, 0x97, 0x96, 0x73, 0xb3, 0x9d, 0x13, 0xc8, 0xd1, 0x9f, 0x6c, 0x1d, 0x6c, 
+  0x67, 0xcb, 0x64, 0xf6, 0xee, 0x44, 0x3c, 0xe7, 0x6f, 0x26, 0xbf, 0xf5, 0x89, 0x6a, 0x42, 0x86, 
+  0xeb, 0xfb, 0xfd, 0x6e, 0x40, 0x02, 0xdb, 0xc8, 0x8d, 0x6c, 0xe6, 0x04, 0xff, 0x77, 0x63, 0x52, 
+  0xb9, 0x99, 0xda, 0xcd, 0xe3, 0x33, 0x59, 0x3f, 0x29, 0x8c, 0x10, 0xe4, 0x75, 0xcf, 0x24, 0xfd, 
+  0xe6, 0x5d, 0x3d, 0x2a, 0xab, 0xa3, 0x6d, 0xde, 0xe1, 0xf0, 0xb0, 0xef, 0x71, 0x4c, 0x57, 0x95, 
+  0x20, 0xbc, 0xaa, 0xfe, 0x8d, 0x74, 0x0d, 0xaa, 0x0a, 0x6f, 0xd2, 0x1e, 0x6b, 0x58, 0x4e, 0x8d, 
+  0xde, 0xb4, 0xd4, 0x80, 0x0e, 0x03, 0xea, 0xfe, 0x81, 0x5d, 0xd6, 0xfb, 0xe5, 0xc4, 0xba, 0x8a, 
+  0xd4, 0xca, 0xce, 0x65, 0xc0, 0x2d, 0x14, 0xdc, 0x42, 0x09, 0x81, 0x39, 0x73, 0xd8, 0x2e, 0xf8, 
+  0x6b, 0xb0, 0xa9, 0x36, 0x57, 0x41, 0x60, 0xa2, 0x28, 0x19, 0x43, 0x43, 0x05, 0x25, 0x97, 0xa9, 
+  0x22, 0xd4, 0x2f, 0xa0, 0xa6, 0x6a, 0x5a, 0x89, 0x52, 0x94, 0xce, 0xa9, 0xb4, 0x29, 0xab, 0x6f, 
+  0x9d, 0x1e, 0xe8, 0x88, 0xe0, 0x49, 0x90, 0x44, 0xef, 0xa4, 0x05, 0xaa, 0x4e, 0x95, 0x21, 0xc5, 
+  0x0d, 0x67, 0xaf, 0xfc, 0xb1, 0x13, 0x41, 0xd5, 0xb4, 0x49, 0xa4, 0xc4, 0xbf, 0x64, 0x0b, 0x28, 
+  0x0a, 0x45, 0xdc, 0xee, 0x62, 0xb8, 0x0b, 0xfa, 0x57, 0xb0, 0x43, 0xc6, 0xfc, 0xc3, 0x01, 0xef, 
+  0xf8, 0xfe, 0x8c, 0x7f, 0x08, 0xf7, 0x20, 0xb5, 0xc4, 0xbe, 0xee, 0x04, 0x61, 0x3d, 0x4b, 0xe5, 
+  0x1f, 0xa4, 0x74, 0x39, 0x09, 0x4d, 0x56, 0x5a, 0x8b, 0x58, 0xf6, 0x3d, 0x66, 0x91, 0x57, 0x28, 
+  0x1b, 0xfb, 0x1a, 0xfb, 0xab, 0xdc, 0xd4, 0xc2, 0xfd, 0x1e, 0xcf, 0xee, 0x6d, 0xca, 0x6f, 0x78, 
+  0x1e, 0x5c, 0x73, 0x4e, 0x96, 0xfc, 0xc0, 0xd1, 0x61, 0x4d, 0x2b, 0xf8, 0x1c, 0x05, 0x4b, 0x7a, 
+  0x08, 0x78, 0x91, 0x14, 0xe7, 0x79, 0x72, 0x75, 0x25, 0x73, 0x7d, 0xc4, 0x2a, 0x51, 0x27, 0x26, 
+  0x4d, 0xa8, 0x8f, 0xc0, 0x37, 0x2d, 0x72, 0x5c, 0x82, 0x78, 0x49, 0x05, 0xd4, 0xb1, 0x14, 0x28, 
+  0x09, 0xaf, 0x80, 0x0f, 0xd4, 0x29, 0x79, 0xd6, 0x15, 0xc2, 0x12, 0x1a, 0x5f, 0xc5, 0x6a, 0xac, 
+  0x76, 0xfe, 0xf3, 0x16, 0x5f, 0x9e, 0x5f, 0x2a, 0x7d, 0x37, 0x82, 0xd0, 0x88, 0x12, 0xa9, 0x69, 
+  0x54, 0xcf, 0x84, 0xee, 0x07, 0x74, 0x96, 0x50, 0xa1, 0xa7, 0xf5, 0x8e, 0x23, 0x38, 0xc8, 0xb8, 
+  0xf6, 0x39, 0xe7, 0xec, 0x46, 0x76, 0xf4, 0xdc, 0x31, 0x04, 0x1c, 0xa9, 0x1e, 0xbd, 0x5c, 0xad, 
+  0xe4, 0x3c, 0x41, 0x12, 0x1b, 0xb7, 0x6b, 0x42, 0xf2, 0x31, 0x2c, 0x9c, 0x66, 0x51, 0x48, 0xd6, 
+  0x87, 0xcf, 0xd6, 0x4d, 0x95, 0x39, 0xa7, 0x8a, 0x74, 0xe2, 0xd7, 0x9a, 0xd2, 0x26, 0x5d, 0x33, 
+  0x27, 0xa5, 0x9a, 0x3a, 0xdf, 0xaa, 0x9d, 0x11, 0xeb, 0x8a, 0xd6, 0x88, 0x5d, 0x1b, 0x2a, 0xe3, 
+  0x74, 0x20, 0x72, 0x1b, 0x94, 0x59, 0x1d, 0x5f, 0xdc, 0x71, 0xda, 0x91, 0x83, 0xfd, 0x03, 0x33, 
+  0xef, 0xa8, 0x07, 0x8d, 0x32, 0x34, 0xe1, 0xe3, 0xa5, 0x75, 0x00, 0x38, 0x97, 0xf0, 0x6d, 0xe1, 
+  0x67, 0xd1, 0xbd, 0xe2, 0x00, 0x90, 0x8b, 0xa7, 0x76, 0x7e, 0xa0, 0x14, 0xb2, 0x25, 0x0a, 0x94, 
+  0x22, 0xac, 0x62, 0x2e, 0x74, 0xe8, 0x45, 0x33, 0xcd, 0x0c, 0x1a, 0x7f, 0x9a, 0x73, 0xab, 0x88, 
+  0x2f, 0xcd, 0x40, 0xc5, 0x12, 0x2e, 0xd1, 0xd2, 0x34, 0x30, 0x4f, 0x48, 0x1e, 0xcf, 0x6c, 0xf0, 
+  0x09, 0xd6, 0x2d, 0x1f, 0x3a, 0x27, 0x8f, 0xae, 0xd3, 0x04, 0xeb, 0x7d, 0x92, 0x36, 0xf6, 0x09, 
+  0x24, 0xd1, 0x2b, 0x35, 0x84, 0x02, 0xc2, 0x68, 0x75, 0xd7, 0x66, 0x9f, 0x67, 0xaa, 0x75, 0xa5, 
+  0xfb, 0xa0, 0xdc, 0x33, 0xcc, 0x5d, 0xdb, 0x3e, 0xb6, 0xdc, 0xdc, 0x59, 0x35, 0x77, 0x7a, 0xd9, 
+  0xe4, 0xbc, 0x63, 0x22, 0x03, 0x8f, 0xcd, 0x2b, 0x88, 0x8c, 0x1c, 0xc9, 0xc1, 0xc4, 0x12, 0x74, 
+  0x9c, 0xda, 0x74, 0x72, 0x63, 0xa8, 0x62, 0x7c, 0x19, 0xf9, 0x8a, 0xb2, 0xb8, 0x16, 0x60, 0x10, 
+  0x75, 0xc3, 0x80, 0x70, 0x24, 0x28, 0x62, 0x98, 0x90, 0xd0, 0xe1, 0xb9, 0x26, 0xfe, 0x12, 0x11, 
+  0xaf, 0x54, 0x30, 0xa1, 0xe1, 0x94, 0xb8, 0x15, 0xbf, 0x20, 0xb2, 0xad, 0x6a, 0xd1, 0xa1, 0x6d, 
+  0xfa, 0x26, 0xb6, 0x4d, 0x20, 0xd6, 0x34, 0xe1, 0x8b, 0xa8, 0xb9, 0xfb, 0xd6, 0xbc, 0xfb, 0x88, 
+  0xc4, 0xfa, 0xc9, 0x78, 0x51, 0xdb, 0x83, 0xe1, 0xa2, 0x7f, 0x49, 0x93, 0xaf, 0xf3, 0x16, 0xac, 
+  0xc5, 0xc1, 0x6f, 0x97, 0x51, 0x65, 0x25, 0xe1, 0x18, 0x69, 0x6b, 0x91, 0xd1, 0x84, 0x70, 0x1d, 
+  0x37, 0xca, 0x90, 0x98, 0x5b, 0x4c, 0x92, 0x0a, 0x2c, 0x52, 0xa8, 0x96, 0x4c, 0x98, 0xc5, 0x0e, 
+  0x13, 0xe1, 0x46, 0xba, 0x08, 0x79, 0xe9, 0x0f, 0x84, 0xc1, 0x50, 0xb4, 0x18, 0xeb, 0x6f, 0x31, 
+  0xd5, 0xb5, 0x8e, 0xdb, 0xd3, 0xf7, 0xd8, 0x74, 0x20, 0xfc, 0x39, 0x71, 0x2e, 0xcc, 0xa1, 0xf9, 
+  0xfa, 0x12, 0xf1, 0xe6, 0xec, 0xe8, 0x9e, 0x67, 0x9b, 0x14, 0x11, 0x74, 0x17, 0xd8, 0x89, 0x1b, 
+  0x9a, 0x97, 0x0e, 0x4e, 0x3c, 0xea, 0x3b, 0x7d, 0x78, 0x94, 0xa0, 0xfb, 0x5a, 0xc4, 0xc0, 0x0d, 
+  0x7b, 0xae, 0x45, 0x38, 0xc7, 0xb2, 0xe7, 0x6e, 0xb4, 0xa6, 0xc2, 0x24, 0x1c, 0xe2, 0x05, 0xe6, 
+  0x19, 0xbf, 0xa6, 0xa6, 0x25, 0x72, 0x82, 0xea, 0xf1, 0x1b, 0x90, 0xad, 0x3f, 0x88, 0xd4, 0x74, 
+  0x40, 0xa7, 0x54, 0x45, 0xa7, 0x9c, 0xd7, 0xfb, 0xdb, 0xed, 0x8a, 0x01, 0x55, 0x15, 0x6a, 0xee, 
+  0x69, 0x59, 0xa1, 0x6e, 0xb5, 0x49, 0x31, 0x48, 0x56, 0x2e, 0xb4, 0xb8, 0x2f, 0x7c, 0xdc, 0x66, 
+  0xad, 0xcc, 0xbf, 0xc7, 0xc7, 0x1a, 0x43, 0xf0, 0xd6, 0xbd, 0x62, 0x45, 0x8b, 0xdd, 0x50, 0x8a, 
+  0x88, 0xcf, 0x60, 0x8a, 0x64, 0x59, 0xe5, 0x03, 0x20, 0x4b, 0x15, 0x34, 0xa0, 0xb6, 0xfc, 0xb7, 
+  0xa0, 0x56, 0x35, 0x77, 0x10, 0xf8, 0x78, 0x79, 0x23, 0x3f, 0x7f, 0x18, 0x78, 0x39, 0xd9, 0x07, 
+  0xb1, 0xcd, 0x05, 0xa7, 0xd8, 0x6a, 0x64, 0x31, 0xba, 0xb8, 0xe8, 0x07, 0x5e, 0xd7, 0xc0, 0x10, 
+  0xdd, 0x11, 0xe7, 0xd5, 0x7f, 0x7c, 0x01, 0xed, 0x39, 0x6c, 0x78, 0x3e, 0xae, 0x90, 0xd7, 0x08, 
+  0x16, 0xe3, 0x46, 0x30, 0xd2, 0x25, 0xc7, 0x22, 0x15, 0x38, 0xa6, 0x74, 0xd3, 0x41, 0xd0, 0x31, 
+  0x03, 0xf8, 0xc4, 0xc7, 0x80, 0x45, 0xc4, 0xaa, 0xf2, 0x73, 0xb5, 0xec, 0x05, 0x81, 0x5a, 0xa1, 
+  0xe0, 0x77, 0xd9, 0xb7, 0xe0, 0x4b, 0x1d, 0x24, 0x98, 0xca, 0xb9, 0x5c, 0x61, 0x13, 0x34, 0xfa, 
+  0xde, 0x63, 0xce, 0x5b, 0x9e, 0x73, 0x62, 0x46, 0x8b, 0x15, 0x91, 0x3b, 0xc4, 0x40, 0x48, 0x86, 
+  0xa3, 0x4a, 0xee, 0x37, 0x0d, 0x90, 0xe9, 0xf5, 0x08, 0x20, 0x15, 0x38, 0x1c, 0x1f, 0x9b, 0x2b, 
+  0x63, 0x7c, 0x23, 0xc4, 0x37, 0x8a, 0xa9, 0x3f, 0xf3, 0x8a, 0x32, 0x81, 0xf1, 0x8e, 0xf3, 0x79, 
+  0x76, 0x9b, 0xda, 0x2d, 0x61, 0x1e, 0x98, 0xaf, 0xae, 0x85, 0x83, 0x29, 0xcf, 0x5c, 0x67, 0x49, 
+  0x7a, 0xb9, 0xae, 0x5e, 0x1a, 0x93, 0x1f, 0x6f, 0xc3, 0x2a, 0xec, 0xf2, 0x1a, 0xee, 0x44, 0x9b, 
+  0xc0, 0xac, 0xa5, 0x35, 0xa4, 0xad, 0xbb, 0x00, 0x0a, 0x06, 0x53, 0x98, 0xa1, 0x9b, 0xae, 0x23, 
+  0x1b, 0x86, 0x48, 0x5b, 0xda, 0x53, 0x8d, 0x1c, 0x29, 0x80, 0xf4, 0xe0, 0xaa, 0x62, 0xd0, 0x6c, 
+  0x3b, 0xa7, 0x62, 0x34, 0xb0, 0x6c, 0xed, 0x50, 0x22, 0x43, 0xd3, 0xa0, 0xa6, 0x34, 0x91, 0xaa, 
+  0x5b, 0x8b, 0xe4, 0x3d, 0xd8, 0x34, 0x02, 0x71, 0x87, 0x51, 0xf0, 0x4c, 0x6b, 0xdb, 0x6d, 0x1b, 
+  0x11, 0x99, 0x6c, 0x54, 0x1c, 0x35, 0x06, 0xb4, 0xe5, 0x1e, 0xb4, 0xda, 0xb7, 0xd0, 0x15, 0x83, 
+  0x07, 0x46, 0x64, 0x85, 0x0d, 0x71, 0x29, 0xc3, 0x51, 0xb9, 0x67, 0x8f, 0xe7, 0x38, 0x27, 0x05, 
+  0x7c, 0xa3, 0xed, 0x1b, 0x9d, 0x07, 0x75, 0x53, 0x01, 0x39, 0x27, 0x75, 0x50, 0x76, 0x29, 0x82, 
+  0x0f, 0xe2, 0x3e, 0x5e, 0xe8, 0x29, 0x20, 0x78, 0x19, 0x32, 0x2c, 0x39, 0xcf, 0x9c, 0x13, 0xf1, 
+  0x1b, 0x2b, 0x6e, 0x9a, 0x3e, 0x6a, 0x4c, 0x54, 0xb8, 0x85, 0xc4, 0x4c, 0x45, 0x5d, 0x21, 0x5e, 
+  0x36, 0x9e, 0x50, 0x77, 0x70, 0x7a, 0xa6, 0xb3, 0x41, 0x24, 0x8a, 0x8a, 0xad, 0x78, 0x43, 0xec, 
+  0xc6, 0x9a, 0xdd, 0x6d, 0x99, 0xb0, 0x6f, 0x60, 0x7f, 0x80, 0xd6, 0x56, 0x77, 0x2d, 0xe9, 0x53, 
+  0x57, 0x57, 0x02, 0x71, 0xe5, 0x7d, 0x44, 0x14, 0x36, 0xcd, 0x4c, 0x52, 0xa7, 0xba, 0x36, 0x76, 
+  0xc5, 0xa9, 0x77, 0xd3, 0xcf, 0xed, 0x36, 0xd1, 0x30, 0x99, 0xf5, 0xdd, 0x27, 0x6e, 0x01, 0x23, 
+  0xa4, 0xb9, 0x1b, 0x8b, 0x7a, 0xa5, 0xda, 0xa5, 0x35, 0x8b, 0x32, 0x41, 0xf3, 0x47, 0x18, 0x8e, 
+  0xea, 0xc0, 0x4f, 0xe5, 0xf9, 0x85, 0x5c, 0x42, 0x7b, 0x7c, 0x69, 0x66, 0x37, 0xb3, 0x66, 0x50, 
+  0x55, 0x45, 0xb0, 0x1d, 0xea, 0xa1, 0x04, 0x9a, 0xa8, 0xeb, 0x91, 0x16, 0x9c, 0xb0, 0x02, 0x92, 
+  0x00, 0xb5, 0x9a, 0xcb, 0x82, 0xd8, 0xc0, 0x88, 0xd5, 0xe9, 0x9b, 0x7d, 0xe6, 0x70, 0xb3, 0xcf, 
+  0xde, 0x56, 0xe6, 0x3d, 0x5a, 0xba, 0xac, 0x28, 0xcd, 0xda, 0x71, 0x40, 0x49, 0xe7, 0xbe, 0xb6, 
+  0x96, 0xc2, 0xb4, 0xc4, 0xee, 0x5a, 0x6a, 0x82, 0xc3, 0x07, 0xa3, 0xc0, 0xaa, 0x43, 0xa1, 0x65, 
+  0x1d, 0x53, 0x70, 0xf8, 0x77, 0x95, 0x27, 0x84, 0xc1, 0x0c, 0x27, 0x38, 0x1d, 0x4f, 0x0f, 0xa4, 
+  0x57, 0x23, 0xf9, 0xd4, 0x4d, 0x7c, 0x30, 0x44, 0xe8, 0x15, 0x95, 0x5c, 0x41, 0xbb, 0x9f, 0x22, 
+  0xc0, 0x25, 0x47, 0x91, 0x99, 0x45, 0xb3, 0xda, 0x99, 0x73, 0x66, 0x50, 0x75, 0xc4, 0x2d, 0xb7, 
+  0x5a, 0x53, 0x6b, 0xa7, 0x4a, 0xd7, 0xd0, 0xc1, 0x6a, 0xcc, 0x6c, 0x3e, 0xf2, 0xc0, 0x1c, 0xbd, 
+  0xe5, 0x23, 0x90, 0x84, 0xed, 0x55, 0x92, 0x82, 0x0d, 0x6b, 0xb1, 0x2c, 0x37, 0x1b, 0x4f, 0x12, 
+  0xac, 0x20, 0x07, 0x36, 0xb5, 0xc8, 0xd0, 0x24, 0xb6, 0x8d, 0x11, 0x06, 0x3a, 0xaf, 0x31, 0x10, 
+  0x7c, 0x64, 0xd3, 0x57, 0x61, 0x4d, 0xb4, 0xff, 0x89, 0x3f, 0x0b, 0x74, 0xc0, 0x25, 0xfd, 0x5c, 
+  0xa7, 0x9b, 0x9d, 0x59, 0x62, 0x46, 0xd8, 0x9f, 0x33, 0x84, 0x66, 0x36, 0x8f, 0x40, 0x56, 0x05, 
+  0xd3, 0xd4, 0x81, 0x62, 0x01, 0x05, 0xe1, 0xac, 0x5a, 0x87, 0x6c, 0x67, 0x7d, 0x52, 0x66, 0x6a, 
+  0xa7, 0x6e, 0x4e, 0xcb, 0x0f, 0x7e, 0x65, 0x4e, 0x4e, 0x6e, 0xc0, 0xd4, 0x17, 0xcc, 0x79, 0x03, 
+  0x4e, 0x6a, 0xdc, 0x77, 0x70, 0xdf, 0xee, 0x30, 0xba, 0x27, 0x29, 0x10, 0xed, 0xbf, 0x97, 0x29, 
+  0xe1, 0x10, 0xe3, 0x2b, 0xda, 0xf4, 0x1d, 0x65, 0x1f, 0x4e, 0x8e, 0xd4, 0xe3, 0x1e, 0x59, 0xd1, 
+  0x6e, 0x40, 0xd8, 0x00, 0x49, 0x0a, 0x15, 0xa0, 0x9b, 0x6c, 0xb4, 0xed, 0x5d, 0xcd, 0xea, 0xf8, 
+  0xe0, 0xe7, 0xfb, 0x6f, 0x08, 0xb7, 0x35, 0x7d, 0x57, 0x0f, 0x8d, 0x4f, 0x4b, 0xb8, 0x1f, 0x18, 
+  0xd2, 0x6d, 0x9e, 0x94, 0xe6, 0x5a, 0xc9, 0x57, 0x2a, 0xd9, 0x03, 0x0e, 0x8e, 0xb6, 0xc7, 0x16, 
+  0x99, 0x58, 0x9f, 0xe0, 0xe9, 0x58, 0x86, 0x9c, 0xc5, 0xb6, 0xaf, 0xa9, 0x1a, 0x22, 0x2c, 0x28, 
+  0x8c, 0x10, 0xde, 0xc3, 0xa5, 0x1c, 0x69, 0xa0, 0xbe, 0xd8, 0x5c, 0x6a, 0xcf, 0x5b, 0xc1, 0x20, 
+  0x1c, 0xde, 0x33, 0xeb, 0xd8, 0xe2, 0x28, 0x89, 0x0e, 0x23, 0xdc, 0xbf, 0xcd, 0x3f, 0xad, 0x13, 
+  0x2a, 0x9b, 0x68, 0x99, 0x44, 0x45, 0x50, 0x01, 0x74, 0xbb, 0xa5, 0x30, 0x66, 0x0a, 0xba, 0xe3, 
+  0xc8, 0x8a, 0x6a, 0x7b, 0x40, 0x22, 0x13, 0xc8, 0x5b, 0xae, 0xa5, 0x8c, 0xff, 0x7f, 0x5a, 0xa1, 
+  0x26, 0x06, 0xbb, 0x4a, 0x3b, 0xde, 0x16, 0x2c, 0x44, 0xe3, 0x87, 0x7f, 0xb3, 0x11, 0x4d, 0x42, 
+  0x6d, 0x3b, 0xdb, 0x2d, 0xbf, 0x8f, 0x99, 0x6c, 0x5f, 0x4a, 0xda, 0xdf, 0x72, 0x93, 0xaa, 0x89, 
+  0x75, 0xb1, 0x5c, 0xbd, 0x07, 0x95, 0x06, 0x5d, 0x61, 0x3b, 0xe8, 0x07, 0x6a, 0x30, 0xc4, 0xfe, 
+  0xd5, 0xb5, 0x27, 0x7d, 0xd5, 0x4f, 0x36, 0x73, 0xd8, 0xef, 0xa8, 0xcd, 0x9d, 0x3a, 0x70, 0x62, 
+  0xf9, 0x96, 0xbd, 0xf0, 0x58, 0xb2, 0xed, 0x08, 0x08, 0x1a, 0x6c, 0x3b, 0x19, 0xa2, 0x3c, 0x15, 
+  0x35, 0xb0, 0xec, 0x67, 0xdf, 0xee, 0x30, 0xc4, 0xd6, 0x42, 0x45, 0xa9, 0xa2, 0x55, 0xe4, 0x57, 
+  0x17, 0xd6, 0xe0, 0x75, 0xc5, 0xba, 0x8f, 0xd2, 0x86, 0xd7, 0xaa, 0x0f, 0xca, 0x44, 0xda, 0x62, 
+  0x0f, 0x75, 0x55, 0x4c, 0x3d, 0x48, 0x0a, 0x4d, 0x5b, 0x5e, 0x29, 0x4a, 0x23, 0xe7, 0x91, 0x0d, 
+  0x50, 0x69, 0x1f, 0x99, 0x74, 0x9a, 0x8c, 0xc6, 0x9b, 0x2f, 0x35, 0xe9, 0x92, 0xee, 0xbc, 0x8d, 
+  0xcf, 0x65, 0xf8, 0xce, 0x34, 0xa9, 0xa8, 0xba, 0x01, 0x83, 0xe3, 0xe3, 0xa7, 0x8a, 0x1a, 0xf0, 
+  0x9d, 0xe3, 0x64, 0x6c, 0x9e, 0x54, 0x14, 0x20, 0x34, 0xcf, 0x54, 0x45, 0x75, 0x2e, 0x41, 0xd6, 
+  0xef, 0x55, 0x11, 0x0e, 0x4f, 0x2b, 0xe7, 0xb6, 0x48, 0xed, 0x5e, 0x9b, 0x35, 0xd5, 0x14, 0x20, 
+  0x30, 0x87, 0x95, 0x3e, 0x8d, 0xcf, 0x92, 0x7a, 0x9f, 0xac, 0xe4, 0x9b, 0x32, 0x5e, 0xad, 0x23, 
+  0x35, 0xa3, 0xe6, 0x76, 0xbb, 0x25, 0x21, 0x07, 0x5e, 0x0d, 0xb7, 0xbe, 0xd6, 0x0c, 0x55, 0x7b, 
+  0x1f, 0xf1, 0x20, 0xf6, 0xb5, 0x2d, 0xf0, 0x40, 0xb1, 0x11, 0xc1, 0x42, 0xfd, 0x5a, 0xec, 0xcf, 
+  0x38, 0xa6, 0xaa, 0x8d, 0x41, 0x52, 0xcf, 0x1f, 0xe0, 0x74, 0x54, 0x81, 0x37, 0xc9, 0x6a, 0xc3, 
+  0xc3, 0x84, 0xe2, 0xad, 0xce, 0x30, 0x84, 0x7b, 0xee, 0x5b, 0xfb, 0xa0, 0x31, 0x3a, 0x04, 0x07, 
+  0xe7, 0x92, 0x23, 0x29, 0xe8, 0xd7, 0xb6, 0x15, 0x4e, 0x41, 0xd5, 0x60, 0x4b, 0x08, 0xd5, 0xd5, 
+  0xb9, 0x92, 0x7f, 0xa7, 0xe1, 0xfd, 0x71, 0x3d, 0xd4, 0xf4, 0x1e, 0xfb, 0xa3, 0xda, 0x6e, 0x9b, 
+  0xa5, 0x7f, 0xa7, 0x13, 0x0f, 0xcc, 0xf2, 0x87, 0x7a, 0x73, 0x40, 0xb3, 0xa7, 0x6c, 0xeb, 0x7b, 
+  0xbd, 0xdd, 0xd9, 0xf0, 0x4a, 0xf1, 0xb2, 0xfc, 0xbb, 0xbc, 0x03, 0xad, 0xb9, 0x64, 0xb2, 0xc0, 
+  0x41, 0xcc, 0x66, 0xd8, 0xee, 0x4b, 0x4b, 0xa0, 0xae, 0x71, 0x44, 0x6f, 0x7e, 0x9e, 0x6d, 0x38, 
+  0x72, 0x3c, 0x9e, 0x94, 0xf9, 0x52, 0x7f, 0x35, 0x97, 0x65, 0x9c, 0x2c, 0x71, 0xc5, 0x8b, 0xf1, 
+  0x8a, 0xc4, 0x70, 0xfe, 0x68, 0x45, 0xcf, 0x75, 0x11, 0x6a, 0x57, 0xfe, 0x62, 0x2e, 0x7e, 0xc5, 
+  0x05, 0x7b, 0x59, 0xea, 0xb7, 0x37, 0x89, 0xbc, 0xd5, 0xad, 0xe4, 0x8a, 0x1c, 0xce, 0x4d, 0xab, 
+  0xf9, 0x73, 0x7d, 0xfd, 0x4e, 0x15, 0xa5, 0x1f, 0xf3, 0x44, 0x67, 0xdc, 0xb2, 0x57, 0xaa, 0x5b, 
+  0xcb, 0x84, 0xba, 0xf0, 0x4b, 0x75, 0xc9, 0x8d, 0x65, 0x8b, 0x05, 0xd1, 0xb7, 0x5f, 0xaa, 0x4b, 
+  0x7e, 0xaa, 0x2d, 0x1a, 0x2f, 0xe7, 0xce, 0x0d, 0x8b, 0xde, 0xe8, 0x1e, 0xc9, 0x46, 0x32, 0xfd, 
+  0xa5, 0xba, 0xe4, 0x2f, 0x14, 0x16, 0x70, 0x66, 0xa1, 0xcc, 0xb4, 0xbd, 0x41, 0xdd, 0xd8, 0xe7, 
+  0xb7, 0xd7, 0x49, 0x9b, 0x28, 0x67, 0x39, 0xce, 0x51, 0x23, 0xb8, 0x2e, 0x97, 0x3f, 0x3e, 0xbe, 
+  0x35, 0x11, 0xa0, 0x15, 0x49, 0x1a, 0xdb, 0x80, 0x44, 0x7a, 0x22, 0xc6, 0xd5, 0x25, 0xe1, 0x24, 
+  0x3b, 0x17, 0xf6, 0x7b, 0xf7, 0xf8, 0xc2, 0xfb, 0x46, 0x5d, 0xc3, 0xe3, 0x12, 0x11, 0x8d, 0xe9, 
+  0xef, 0xd3, 0xf0, 0x13, 0xfa, 0xfb, 0x24, 0x1c, 0x84, 0xfa, 0x43, 0x05, 0x0b, 0x46, 0x89, 0x0a, 
+  0x30, 0xa9, 0x62, 0x6f, 0xa9, 0x54, 0x78, 0xca, 0x7a, 0x92, 0xa4, 0x9e, 0xb8, 0x5c, 0x6e, 0x72, 
+  0x7d, 0x9b, 0x11, 0x7d, 0xdc, 0x35, 0xce, 0x17, 0x37, 0x65, 0x10, 0x39, 0x8d, 0x9a, 0xac, 0x85, 
+  0x65, 0x5a, 0xbe, 0x37, 0xee, 0x92, 0xe2, 0xec, 0x10, 0x83, 0xb0, 0x5f, 0x56, 0x91, 0xf9, 0x9a, 
+  0xa6, 0xa4, 0x74, 0x63, 0x85, 0xb1, 0xb1, 0x0a, 0x78, 0x83, 0x7a, 0xc9, 0xd7, 0x44, 0xf1, 0x72, 
+  0x4f, 0xf0, 0xe5, 0x52, 0xc6, 0x37, 0xd2, 0x3c, 0xa6, 0xce, 0x9b, 0x45, 0xd7, 0xc5, 0xf5, 0x9d, 
+  0xfa, 0x40, 0xdf, 0xe8, 0x4f, 0xcc, 0xab, 0xe6, 0x88, 0x93, 0xf6, 0x11, 0xd7, 0xba, 0x97, 0x08, 
+  0xa3, 0xc8, 0xa1, 0x4b, 0xc5, 0x24, 0xb7, 0xa6, 0x09, 0x6f, 0x50, 0x09, 0xb6, 0x7b, 0x5b, 0xd1, 
+  0xcf, 0x8d, 0xd4, 0x9a, 0x46, 0x91, 0x66, 0x98, 0x9a, 0x21, 0xfb, 0xd2, 0x40, 0x9d, 0x98, 0x61, 
+  0xa4, 0x9f, 0x5b, 0xf1, 0x8f, 0x04, 0xe1, 0xdc, 0xaa, 0xeb, 0x5a, 0x2d, 0x37, 0x42, 0x7f, 0x03, 
+  0x5b, 0xc3, 0x6e, 0xcf, 0x05, 0xb8, 0x96, 0xd7, 0xce, 0x38, 0xf4, 0xe9, 0x0e, 0xbd, 0xb1, 0x8b, 
+  0xa8, 0x9e, 0xef, 0x44, 0x96, 0xca, 0x8f, 0x2e, 0x2e, 0x86, 0xf8, 0x60, 0xb1, 0x08, 0x1f, 0x08, 
+  0xf1, 0x29, 0xf7, 0x11, 0x3d, 0x9e, 0xd8, 0xa9, 0x31, 0x8c, 0x48, 0x6d, 0xbe, 0x10, 0xa0, 0xae, 
+  0xa1, 0x6a, 0x50, 0xd6, 0xab, 0xbc, 0x92, 0xae, 0xc7, 0xd5, 0x0c, 0x75, 0xbd, 0xbe, 0xd7, 0x75, 
+  0x5e, 0x85, 0xce, 0xe4, 0xe5, 0x56, 0x24, 0x13, 0x76, 0x16, 0x15, 0x56, 0x75, 0xcd, 0x84, 0x1d, 
+  0x37, 0x1e, 0x84, 0x4d, 0x31, 0xa5, 0xb6, 0x62, 0x15, 0x1c, 0xa2, 0x72, 0x91, 0xe6, 0x54, 0x1d, 
+  0x70, 0x91, 0x36, 0xa6, 0x42, 0x66, 0x5e, 0xd4, 0xf2, 0xbe, 0xd3, 0xc1, 0x00, 0x0f, 0xda, 0xca, 
+  0x6a, 0x8e, 0xfe, 0x34, 0x8f, 0xf0, 0x5a, 0x56, 0x39, 0x26, 0xa0, 0x9e, 0x92, 0x81, 0x22, 0x2f, 
+  0x34, 0x5a, 0xe4, 0xf6, 0x41, 0x3a, 0xa1, 0x7a, 0xec, 0x4c, 0xed, 0x17, 0xf5, 0x16, 0xce, 0x07, 
+  0xca, 0x80, 0xbc, 0x3d, 0x65, 0xff, 0xb0, 0xed, 0xe9, 0x32, 0x49, 0xdf, 0x9d, 0x24, 0xe2, 0x19, 
+  0xbd, 0xd2, 0x2e, 0x3c, 0x08, 0xd4, 0x3a, 0x0e, 0x27, 0xbf, 0x45, 0xd3, 0x6d, 0x44, 0xd7, 0xc6, 
+  0xb3, 0xa7, 0x0f, 0xa7, 0xa8, 0x17, 0xb0, 0xf6, 0xd2, 0xc3, 0xd3, 0x0e, 0x6c, 0xbd, 0x93, 0xe7, 
+  0x2f, 0x9e, 0x9d, 0x3f, 0xbb, 0x98, 0x6c, 0x7b, 0xbd, 0x60, 0x8b, 0x07, 0xd3, 0x8b, 0x29, 0xae, 
+  0x3f, 0xa7, 0x12, 0x8f, 0xdc, 0x93, 0x4f, 0x3f, 0xd4, 0x8d, 0xba, 0x2a, 0x6a, 0x1a, 0x48, 0x0d, 
+  0xf3, 0xf4, 0xfe, 0x7e, 0xf8, 0xbe, 0xd2, 0x0d, 0xf9, 0xe6, 0x95, 0x39, 0xca, 0x71, 0xdc, 0x5e, 
+  0x13, 0xfa, 0xcd, 0xf7, 0xd8, 0xb3, 0xc3, 0x43, 0x4e, 0x02, 0x92, 0x23, 0x2a, 0xc3, 0xe1, 0xef, 
+  0xb2, 0x76, 0x66, 0x93, 0x81, 0xdc, 0x57, 0x68, 0xf5, 0x50, 0xc2, 0xc3, 0xae, 0x77, 0x82, 0x83, 
+  0xde, 0xcc, 0x9a, 0x3a, 0x35, 0xfd, 0x21, 0x1b, 0x07, 0xa4, 0x4e, 0x94, 0xf7, 0x6c, 0x65, 0x52, 
+  0xb7, 0xe9, 0x79, 0x3e, 0x45, 0x70, 0x15, 0x87, 0xc3, 0xb5, 0x27, 0x41, 0x42, 0xc3, 0x83, 0xef, 
+  0xb5, 0xea, 0xb6, 0xf4, 0x9d, 0x6c, 0xd5, 0x7b, 0x8c, 0xb4, 0x06, 0xa2, 0xac, 0xc7, 0xfc, 0xae, 
+  0xab, 0xbd, 0xfd, 0xc2, 0xd8, 0xc6, 0x02, 0xab, 0xee, 0xb6, 0x80, 0x61, 0x35, 0x90, 0xe5, 0x9e, 
+  0x06, 0x52, 0x14, 0x3a, 0xe8, 0x26, 0xfc, 0x6d, 0x60, 0x6b, 0x6c, 0xba, 0xdc, 0xd4, 0xcc, 0xb4, 
+  0xd4, 0x25, 0x94, 0x81, 0xbe, 0x62, 0xf4, 0x6b, 0xbd, 0xfd, 0x2c, 0xaa, 0x0e, 0x57, 0xa9, 0x00, 
+  0x05, 0x55, 0x54, 0xb2, 0x2c, 0x10, 0xfa, 0x54, 0x8f, 0xe0, 0xbc, 0x56, 0x76, 0xc4, 0xdf, 0x4a, 
+  0xdf, 0x9a, 0xe0, 0xf3, 0xe8, 0x0a, 0xca, 0x09, 0x1d, 0xd2, 0xa5, 0xd2, 0xf5, 0xb3, 0xcf, 0xa9, 
+  0x3d, 0xfb, 0x31, 0x8f, 0x16, 0x3d, 0x62, 0x32, 0x23, 0x36, 0x2f, 0x5e, 0x47, 0x77, 0xfe, 0x9a, 
+  0x35, 0xfd, 0xd7, 0xdb, 0xed, 0xf0, 0x74, 0xd1, 0x72, 0xa0, 0x12, 0x36, 0x12, 0xd7, 0x93, 0xed, 
+  0xf8, 0xf8, 0x99, 0xa6, 0x8f, 0xeb, 0x4a, 0x92, 0x69, 0xec, 0x37, 0x27, 0xcd, 0xac, 0xfc, 0x03, 
+  0xa6, 0x04, 0xa8, 0x98, 0x39, 0xc9, 0xdd, 0xda, 0x0d, 0xd0, 0x29, 0x4a, 0xf6, 0x3e, 0x81, 0xfe, 
+  0x4b, 0x7c, 0x2b, 0x7d, 0x7d, 0x4a, 0x0b, 0x3b, 0x92, 0x3a, 0xb4, 0x60, 0x77, 0x7a, 0x5f, 0x46, 
+  0x77, 0x12, 0xc9, 0x8b, 0x11, 0xaf, 0xb3, 0xee, 0x80, 0x4a, 0xac, 0x72, 0x8a, 0xc3, 0x22, 0x2e, 
+  0x84, 0x2b, 0x31, 0xa6, 0x72, 0x4b, 0xa9, 0x14, 0xdc, 0xc4, 0x39, 0x06, 0x9c, 0x0a, 0xc6, 0x78, 
+  0x22, 0x44, 0xac, 0x06, 0xc5, 0x69, 0x4c, 0x76, 0xfd, 0xaa, 0xfc, 0x41, 0x7e, 0x77, 0x92, 0xe7, 
+  0x18, 0xaf, 0xd0, 0x0d, 0x89, 0x1b, 0x00, 0xfc, 0x39, 0xdb, 0x43, 0xce, 0x94, 0x83, 0x9d, 0xbf, 
+  0xc1, 0xb9, 0x6f, 0x9c, 0xe7, 0x2e, 0x20, 0x89, 0x28, 0xb7, 0x98, 0x58, 0x5c, 0xe1, 0x85, 0xad, 
+  0x0e, 0x86, 0x1d, 0x1d, 0x70, 0x7c, 0xb2, 0x9c, 0xd2, 0x82, 0x2c, 0x79, 0x74, 0x0a, 0x68, 0x66, 
+  0x51, 0x3c, 0xa9, 0x22, 0xaf, 0x35, 0x07, 0xa8, 0x7a, 0x17, 0x8b, 0x3f, 0x24, 0xbc, 0xb1, 0xe1, 
+  0xa2, 0x5a, 0xe8, 0xce, 0xc4, 0xa8, 0xca, 0xb8, 0xa6, 0x6c, 0x5c, 0xd7, 0x94, 0x8e, 0x3d, 0xe0, 
+  0xb2, 0xa9, 0x3b, 0x71, 0xa1, 0x87, 0x96, 0xe4, 0xcd, 0xc4, 0x46, 0x29, 0x27, 0x8b, 0x7c, 0x46, 
+  0x4b, 0xae, 0x3c, 0x33, 0x81, 0x88, 0xdd, 0xca, 0x1a, 0x39, 0x1d, 0xce, 0xfa, 0x6f, 0x25, 0xd5, 
+  0xf4, 0x63, 0xbe, 0x64, 0xdd, 0x6b, 0x9a, 0x7d, 0xc7, 0x5f, 0xa1, 0x5e, 0xf3, 0x42, 0x55, 0x28, 
+  0xee, 0x53, 0x1c, 0xa2, 0x09, 0x51, 0x06, 0x31, 0x29, 0xb6, 0x9b, 0x06, 0xb6, 0xe0, 0xc7, 0x30, 
+  0xd7, 0xcd, 0x82, 0xf0, 0x16, 0x2d, 0x56, 0x2e, 0x3f, 0xf6, 0x78, 0xe6, 0x0b, 0xc9, 0x09, 0x1e, 
+  0xa0, 0x8c, 0xb6, 0x8a, 0x34, 0xc7, 0xdb, 0xed, 0x95, 0xdc, 0x4b, 0x01, 0x80, 0x83, 0xce, 0x63, 
+  0x27, 0x22, 0x23, 0x8e, 0x4f, 0x8a, 0x0c, 0x4a, 0x43, 0x95, 0x24, 0x28, 0x57, 0x89, 0xec, 0x46, 
+  0x19, 0x9c, 0x7c, 0x09, 0xd8, 0x3b, 0x6e, 0x54, 0x76, 0x66, 0x08, 0xe0, 0x5c, 0xcb, 0xdb, 0xf1, 
+  0x8a, 0x4f, 0x79, 0x12, 0xcd, 0x72, 0xb3, 0xf6, 0x22, 0x25, 0x61, 0xa2, 0x9c, 0xa4, 0x57, 0x92, 
+  0x8b, 0x38, 0x8b, 0x5c, 0x2b, 0x5b, 0x73, 0x5b, 0xce, 0x83, 0x9a, 0xb7, 0xb0, 0x3d, 0x9a, 0xe9, 
+  0x7a, 0x5d, 0xb5, 0xea, 0xa5, 0x38, 0x68, 0x70, 0x2a, 0x1f, 0x4a, 0x8b, 0x69, 0x37, 0x78, 0xc3, 
+  0xe3, 0x93, 0xb6, 0x7b, 0x62, 0xce, 0x7a, 0x77, 0xfc, 0xa6, 0x8b, 0xa8, 0x1a, 0xbb, 0xeb, 0xdc, 
+  0x3f, 0xac, 0x3f, 0xc0, 0x64, 0x98, 0x64, 0x0d, 0x20, 0xc9, 0x81, 0xb2, 0x19, 0x5c, 0x71, 0x4a, 
+  0x35, 0x15, 0xad, 0x98, 0x90, 0xd5, 0x95, 0x74, 0xb3, 0x4c, 0xd9, 0xa4, 0x86, 0x11, 0xc7, 0x34, 
+  0x01, 0x88, 0xe6, 0xc6, 0x89, 0x51, 0x54, 0x99, 0x35, 0x08, 0xe2, 0x37, 0x87, 0x92, 0x6b, 0x1c, 
+  0x1f, 0x1b, 0xbd, 0x52, 0xa1, 0x19, 0xef, 0x8d, 0x21, 0x99, 0x70, 0xfa, 0xd0, 0xd9, 0x9c, 0x75, 
+  0x5d, 0xea, 0xe8, 0x81, 0x67, 0x3c, 0x61, 0xf9, 0x9e, 0x55, 0xfe, 0xae, 0x8b, 0x2b, 0x7d, 0xe6, 
+  0xde, 0xaa, 0x33, 0x8e, 0x1c, 0xfc, 0x38, 0xb0, 0x61, 0x1d, 0x79, 0x18, 0x82, 0x1d, 0xf0, 0xdc, 
+  0x01, 0x66, 0xcd, 0x81, 0x11, 0x69, 0xe1, 0x91, 0xc5, 0x1c, 0x4f, 0x9b, 0xad, 0x5a, 0x4c, 0x6d, 
+  0x96, 0x76, 0x79, 0x07, 0xa7, 0x7a, 0x92, 0x1c, 0xb8, 0xb0, 0xf8, 0x07, 0x1e, 0x66, 0xa2, 0x43, 
+  0x38, 0xad, 0x8e, 0x6c, 0x90, 0x68, 0x49, 0x58, 0xc0, 0xdb, 0xcb, 0xf3, 0xec, 0x58, 0xb1, 0x9a, 
+  0x66, 0x25, 0x06, 0xed, 0xca, 0x8a, 0x41, 0x4c, 0xb0, 0x85, 0x6e, 0x76, 0xb9, 0x48, 0x03, 0x1d, 
+  0xad, 0x3c, 0x9d, 0xfc, 0x52, 0x9d, 0xec, 0xe6, 0x47, 0x86, 0xbc, 0x55, 0x87, 0xfc, 0xcd, 0x13, 
+  0x9c, 0xb3, 0x1c, 0x37, 0x58, 0x25, 0xf0, 0xa0, 0x61, 0xdd, 0xdc, 0xc7, 0x2e, 0x59, 0xc6, 0xdc, 
+  0x37, 0x72, 0x1b, 0xd0, 0x3c, 0xd9, 0x2e, 0x9d, 0xfc, 0xea, 0x1c, 0xf4, 0xf7, 0xdd, 0x5b, 0xc3, 
+  0xb6, 0xed, 0x33, 0xcb, 0x73, 0x4e, 0xa9, 0xd3, 0xb6, 0x19, 0x5e, 0x59, 0x8e, 0xad, 0xdd, 0xcc, 
+  0xbd, 0x5f, 0x30, 0x68, 0xc9, 0xf8, 0xac, 0xcb, 0xb4, 0x9c, 0xcd, 0x6d, 0xc6, 0x16, 0x80, 0x0f, 
+  0x07, 0x3e, 0x57, 0x6e, 0xf1, 0xda, 0x97, 0x9e, 0x73, 0x61, 0x07, 0x7b, 0x9c, 0xe5, 0x50, 0xdb, 
+  0x3e, 0x9a, 0xfb, 0xa9, 0xf1, 0xec, 0x6f, 0xcd, 0x47, 0x88, 0x19, 0xc1, 0xca, 0x2a, 0xc7, 0xe1, 
+  0xb1, 0x76, 0x58, 0x77, 0xcf, 0x4c, 0xb9, 0x13, 0xca, 0x87, 0xb1, 0x45, 0xc8, 0xfb, 0x56, 0x36, 
+  0xe4, 0x92, 0xda, 0xf0, 0xfe, 0xf3, 0x2e, 0xfe, 0x60, 0xe7, 0xb3, 0xe6, 0x3f, 0xa9, 0xfa, 0x49, 
+  0x92, 0xc5, 0x7f, 0xd4, 0x1d, 0xc3, 0x8d, 0xd5, 0x9b, 0x1a, 0xb6, 0x3c, 0xfb, 0x5b, 0xf3, 0x91, 
+  0xe1, 0x2b, 0xaa, 0x7e, 0x8d, 0xca, 0x3e, 0x51, 0x34, 0x99, 0x97, 0x5f, 0xb0, 0x3e, 0x99, 0xc3, 
+  0xa5, 0xb9, 0x61, 0x8b, 0xd1, 0x51, 0xa5, 0x6a, 0xfe, 0xb7, 0xfb, 0xa9, 0x22, 0xf2, 0x3a, 0x24, 
+  0xa0, 0xf1, 0x60, 0xaf, 0x61, 0xe5, 0x8d, 0x45, 0xcb, 0xb4, 0x28, 0x5b, 0x45, 0xf1, 0xff, 0xfd, 
+  0xe6, 0x6a, 0xd9, 0x66, 0xd0, 0xf4, 0x5e, 0xd0, 0x51, 0x1b, 0xb2, 0x9e, 0x6d, 0xba, 0x9a, 0x16, 
+  0x2a, 0x35, 0x1a, 0x62, 0xe8, 0xb3, 0xbd, 0xb9, 0x99, 0xa6, 0xc6, 0x6f, 0x10, 0x43, 0xc9, 0x49, 
+  0x31, 0x20, 0xe9, 0xd6, 0x9c, 0x73, 0xeb, 0xa2, 0x51, 0x0b, 0xb9, 0x72, 0x9c, 0x4f, 0xb5, 0x3e, 
+  0x06, 0x69, 0xdc, 0x4a, 0x1d, 0x65, 0xa7, 0x1c, 0x23, 0x9e, 0x09, 0x8f, 0x02, 0x7c, 0x4e, 0xeb, 
+  0xd1, 0x35, 0x66, 0xb3, 0x0c, 0xb3, 0xc8, 0x03, 0x04, 0xe1, 0xfc, 0xc8, 0x5d, 0x5d, 0x19, 0x48, 
+  0x58, 0xb6, 0x51, 0x36, 0xc4, 0x7a, 0xda, 0x93, 0x5a, 0xec, 0x08, 0xa9, 0x62, 0x47, 0x38, 0x52, 
+  0x82, 0x0d, 0x6b, 0x63, 0xbd, 0xa6, 0x5b, 0xc3, 0xa7, 0x40, 0xb5, 0xf8, 0xd6, 0x49, 0x41, 0xd6, 
+  0xb9, 0x91, 0x13, 0xeb, 0xa5, 0x2d, 0x1f, 0xf2, 0xd2, 0x26, 0x8c, 0x8c, 0xf3, 0xb8, 0x75, 0x1f, 
+  0x6c, 0x00, 0x75, 0x7e, 0xa7, 0x72, 0x1d, 0x18, 0x21, 0x82, 0x4d, 0xcb, 0x7a, 0x30, 0xa9, 0x36, 
+  0x4a, 0x1f, 0x5e, 0xb0, 0x52, 0x2d, 0x98, 0xd3, 0xef, 0x08, 0x95, 0x46, 0x03, 0xd7, 0xb9, 0xb7, 
+  0xd4, 0x10, 0x66, 0x10, 0x9b, 0xda, 0xe0, 0x6c, 0xf5, 0x3a, 0x8c, 0x81, 0x34, 0x7f, 0x56, 0x8f, 
+  0x0a, 0x6b, 0x8e, 0x5f, 0x4f, 0x6c, 0x34, 0x90, 0x87, 0x21, 0xbd, 0x5a, 0x18, 0x37, 0x0a, 0xbd, 
+  0x13, 0x99, 0x57, 0x69, 0x64, 0x4e, 0x07, 0x2d, 0x23, 0xe3, 0xcc, 0x31, 0x2a, 0x9d, 0x86, 0xee, 
+  0x8b, 0x46, 0x49, 0x3a, 0xa9, 0xcc, 0x4e, 0xa4, 0xb5, 0x08, 0xf8, 0x6a, 0x54, 0xe7, 0x59, 0xe8, 
+  0xa9, 0x2b, 0xcf, 0xa0, 0x2d, 0x3c, 0xd2, 0x97, 0x9e, 0x70, 0xb7, 0x56, 0xe8, 0x29, 0x7c, 0x61, 
+  0x9e, 0x3e, 0xe3, 0xdd, 0xec, 0xf1, 0xa6, 0xf6, 0xcc, 0x04, 0x20, 0x34, 0xbc, 0xe7, 0x4c, 0x46, 
+  0x5d, 0xb9, 0x15, 0xeb, 0x20, 0xe4, 0x72, 0x1a, 0x1d, 0x20, 0xe9, 0x30, 0x6b, 0xe7, 0x11, 0x47, 
+  0x72, 0x4a, 0x6c, 0x2e, 0xbc, 0xde, 0x90, 0xa9, 0x7a, 0x76, 0x1a, 0x25, 0x4c, 0xc8, 0xcb, 0x28, 
+  0x83, 0x07, 0xb2, 0x73, 0xa0, 0x5b, 0x6d, 0x08, 0xb0, 0x78, 0x67, 0x24, 0x4f, 0x11, 0x41, 0x9f, 
+  0xc4, 0x53, 0xc4, 0xd6, 0xdd, 0xd8, 0x68, 0x9d, 0xa5, 0x4a, 0x33, 0x50, 0xdb, 0x9b, 0x7b, 0x61, 
+  0xc5, 0xab, 0x28, 0xe1, 0x72, 0x8f, 0xad, 0x8c, 0xb4, 0x9b, 0x4a, 0xa2, 0xc2, 0xff, 0x20, 0x6d, 
+  0xa0, 0x39, 0xcc, 0x8a, 0x0c, 0x82, 0xd5, 0x65, 0x84, 0x34, 0xcb, 0x55, 0x51, 0x84, 0x17, 0xd0, 
+  0x81, 0xa4, 0x68, 0xab, 0x3a, 0xc5, 0x50, 0x43, 0x95, 0x8b, 0x1e, 0xed, 0x7c, 0x21, 0xc5, 0x4b, 
+  0x29, 0xbe, 0x96, 0xe2, 0x4b, 0x29, 0x1e, 0x49, 0xf1, 0xb3, 0x14, 0x3f, 0x49, 0xf1, 0xa3, 0x14, 
+  0xdf, 0x34, 0xcf, 0x24, 0x9b, 0x73, 0xc8, 0xe3, 0xce, 0xfa, 0x7d, 0xa0, 0x0e, 0x23, 0x77, 0xcd, 
+  0x59, 0xe4, 0x3f, 0xeb, 0x2e, 0x9a, 0x46, 0x4b, 0x5c, 0x13, 0xa1, 0x2c, 0xfb, 0x97, 0xc8, 0x5b, 
+  0x27, 0xcb, 0x41, 0xd9, 0xcf, 0xd6, 0x30, 0xe1, 0x71, 0xd8, 0xa6, 0xf3, 0x40, 0xcd, 0xd9, 0xf3, 
+  0x6c, 0x45, 0x8c, 0xa5, 0x9c, 0xbf, 0x51, 0xc7, 0x48, 0x09, 0x90, 0xbe, 0xaa, 0x75, 0x27, 0x95, 
+  0xda, 0x4b, 0x6c, 0x8b, 0xc4, 0x73, 0xd4, 0x83, 0x6a, 0x16, 0x7f, 0x91, 0xca, 0xf2, 0xfd, 0x23, 
+  0xf5, 0xe3, 0x27, 0x73, 0xf0, 0x77, 0x56, 0x14, 0x38, 0xde, 0x10, 0x79, 0x6b, 0x9d, 0xf7, 0x2f, 
+  0x8c, 0x2f, 0x39, 0x26, 0xaa, 0x1c, 0x2d, 0xe5, 0xa2, 0x0c, 0x7b, 0x43, 0xfc, 0x5b, 0xbf, 0x1f, 
+  0x71, 0xea, 0xbd, 0xf0, 0xb3, 0x01, 0x5d, 0xae, 0x68, 0xbf, 0x24, 0x69, 0xaf, 0xcc, 0xd6, 0x21, 
+  0xde, 0xac, 0xe3, 0x39, 0xe2, 0xa9, 0x85, 0x83, 0xd1, 0x65, 0x96, 0xcf, 0x09, 0x08, 0x07, 0x1e, 
+  0x4d, 0xd3, 0xc1, 0xfa, 0x4d, 0x66, 0xc7, 0x91, 0x3e, 0xab, 0x18, 0xf2, 0xf9, 0x48, 0xfa, 0xf6, 
+  0x7d, 0xaf, 0x48, 0xfe, 0x44, 0x45, 0xaa, 0x9a, 0x1e, 0x3d, 0x19, 0x41, 0x57, 0xbb, 0x58, 0x66, 
+  0xb7, 0x61, 0xc1, 0x61, 0xd8, 0x74, 0xd3, 0x61, 0xbc, 0x29, 0x33, 0xd3, 0x9a, 0xdb, 0x05, 0xb7, 
+  0xa3, 0xff, 0x35, 0xe2, 0x0e, 0xfe, 0x17, 0x36, 0x43, 0x8d, 0x2d, 0xf8, 0xa9, 0xc1, 0x26, 0xd0, 
+  0x7c, 0x28, 0x6d, 0x44, 0x74, 0xbe, 0x3f, 0xc3, 0x78, 0xf9, 0x85, 0x8c, 0x3c, 0xaa, 0x47, 0x79, 
+  0x81, 0x64, 0x6b, 0x82, 0x84, 0x68, 0xf8, 0x84, 0x40, 0xfe, 0x57, 0xc9, 0x01, 0xdc, 0xd1, 0x23, 
+  0x1c, 0x2b, 0x0f, 0xaa, 0x51, 0xe7, 0x38, 0x76, 0x1e, 0x79, 0xd4, 0x09, 0x8f, 0xa0, 0x27, 0x7a, 
+  0xfa, 0x99, 0x29, 0xcd, 0x2f, 0x02, 0x82, 0x2b, 0xe7, 0x19, 0x77, 0xd8, 0xf9, 0xd8, 0xcc, 0x54, 
+  0xe4, 0x99, 0xa5, 0xf0, 0x08, 0x0a, 0x6d, 0x93, 0x54, 0x4e, 0xd9, 0x38, 0x7e, 0xc6, 0x77, 0x27, 
+  0x4f, 0x03, 0x8c, 0xcf, 0x95, 0xe5, 0x68, 0x7c, 0x54, 0x99, 0x8a, 0xca, 0x5b, 0xc9, 0xa2, 0xbf, 
+  0xba, 0x8a, 0x32, 0x95, 0xcb, 0x36, 0xdb, 0x10, 0x22, 0xe5, 0x28, 0x3e, 0x5f, 0x2e, 0xb3, 0x98, 
+  0xb3, 0xb4, 0x54, 0xe5, 0xff, 0x2e, 0x5b, 0x45, 0x39, 0xb3, 0xc9, 0x34, 0x9c, 0xaa, 0x6c, 0x4c, 
+  0x7f, 0xb2, 0x90, 0x05, 0x7f, 0x19, 0x96, 0xce, 0x63, 0x78, 0x8b, 0xca, 0xd2, 0xf8, 0x44, 0xb0, 
+  0x54, 0xc3, 0xa1, 0xd6, 0x11, 0xd1, 0x9e, 0x7e, 0x58, 0xea, 0x63, 0x37, 0x66, 0xe7, 0x38, 0x34, 
+  0x4e, 0x32, 0x5c, 0xf6, 0xd7, 0xc9, 0x7b, 0xb9, 0xfc, 0x22, 0x7b, 0xcf, 0x93, 0x5f, 0xf8, 0x54, 
+  0xe7, 0x37, 0x9a, 0x62, 0xc5, 0x74, 0xfd, 0x95, 0xb1, 0xe8, 0xab, 0x18, 0x2c, 0x85, 0x9a, 0x3a, 
+  0x42, 0x4d, 0x44, 0x9b, 0x93, 0x94, 0xe7, 0x83, 0xc3, 0x68, 0xae, 0xe2, 0xf7, 0xea, 0xa6, 0x7a, 
+  0xee, 0x3c, 0x35, 0xdf, 0x45, 0xb1, 0x40, 0x4f, 0x6f, 0x75, 0x49, 0xf5, 0x2c, 0x77, 0xbf, 0x49, 
+  0x84, 0xf3, 0x15, 0x02, 0x7e, 0x58, 0x49, 0x26, 0x1e, 0xc7, 0x5d, 0xcf, 0x0b, 0xe3, 0x6a, 0xbe, 
+  0xfe, 0x51, 0xd3, 0x79, 0xde, 0xd7, 0x02, 0x8f, 0x29, 0x4b, 0x7b, 0x95, 0x9a, 0xd1, 0x26, 0x5a, 
+  0x41, 0x6e, 0xf3, 0xf6, 0x60, 0xce, 0xda, 0x3b, 0xd1, 0x14, 0x24, 0x31, 0xe4, 0xa7, 0x96, 0x53, 
+  0xa3, 0x7c, 0xda, 0x4a, 0x10, 0x48, 0x1c, 0x78, 0x55, 0x1d, 0xd5, 0xb6, 0xd0, 0x85, 0x00, 0x22, 
+  0x57, 0xbc, 0xf4, 0xcf, 0x97, 0xc9, 0x3a, 0xf2, 0x74, 0xf2, 0x0a, 0xec, 0x36, 0xde, 0xb6, 0xf5, 
+  0x43, 0x99, 0xed, 0xdf, 0xe0, 0xd0, 0x25, 0x47, 0xbf, 0x60, 0x81, 0x9d, 0xd7, 0xaa, 0x5e, 0x11, 
+  0x41, 0xea, 0x81, 0x06, 0xab, 0x78, 0x35, 0x97, 0xe2, 0x9e, 0x8a, 0xbe, 0xe1, 0x2d, 0xff, 0x5a, 
+  0x2e, 0x93, 0x03, 0xf1, 0xe5, 0x81, 0xb5, 0x68, 0xbf, 0x20, 0x02, 0xb7, 0x0b, 0x1a, 0x87, 0x4a, 
+  0x7e, 0x69, 0x4a, 0x9a, 0x3c, 0xa6, 0x87, 0x0a, 0x7e, 0x21, 0xc1, 0x26, 0xa8, 0x66, 0xbf, 0xb3, 
+  0x7b, 0xf8, 0x50, 0xe9, 0x9f, 0xa9, 0xb4, 0x42, 0x41, 0xaa, 0xcf, 0x07, 0x7b, 0xfa, 0xb5, 0x53, 
+  0xed, 0x79, 0xfe, 0x22, 0xa1, 0xc5, 0x28, 0x12, 0xd8, 0x2e, 0x9b, 0x26, 0x62, 0x65, 0x1f, 0xa9, 
+  0xdb, 0x09, 0x1f, 0x49, 0x56, 0x01, 0xee, 0xad, 0xa5, 0xd6, 0x9d, 0x13, 0x4f, 0xba, 0xff, 0x2a, 
+  0x47, 0xc0, 0x8b, 0x43, 0x90, 0xf1, 0xef, 0x62, 0x79, 0x8f, 0xa3, 0x38, 0xe3, 0x0b, 0x95, 0x70, 
+  0x95, 0xf0, 0x1e, 0x1e, 0xa6, 0x8d, 0x87, 0x7f, 0xc3, 0xc3, 0x06, 0x56, 0x6d, 0x20, 0xd5, 0xb2, 
+  0x7e, 0x9b, 0x42, 0x63, 0xd1, 0x82, 0x5e, 0x09, 0x17, 0x3e, 0x22, 0x5c, 0x78, 0xca, 0x58, 0xe8, 
+  0x25, 0x75, 0x3c, 0xd7, 0x8d, 0xec, 0x61, 0x35, 0x24, 0x7a, 0x78, 0x24, 0x71, 0x4a, 0x84, 0x91, 
+  0xf5, 0x3f, 0x11, 0xe3, 0xe3, 0x67, 0x79, 0xf9, 0x2e, 0x41, 0x78, 0x8f, 0xef, 0xb2, 0x3f, 0x3d, 
+  0x44, 0x69, 0xf4, 0x88, 0xf2, 0x97, 0x07, 0x26, 0x43, 0x8d, 0x41, 0x94, 0x65, 0x2d, 0x1a, 0x02, 
+  0x3b, 0x50, 0x99, 0x54, 0x5b, 0x98, 0x27, 0x60, 0xad, 0x62, 0x02, 0x8f, 0xca, 0x12, 0x09, 0xb2, 
+  0xdc, 0xe0, 0x89, 0x92, 0x8d, 0x2f, 0x2c, 0x10, 0x94, 0x07, 0x99, 0x26, 0x0e, 0x3b, 0x53, 0x0f, 
+  0x30, 0xd9, 0x95, 0xd5, 0x59, 0x98, 0x34, 0xfa, 0xa7, 0xac, 0xe5, 0x3c, 0x57, 0x71, 0xcc, 0xff, 
+  0x89, 0xb3, 0xae, 0xdd, 0x32, 0xe0, 0x06, 0xac, 0x1f, 0xdb, 0x8e, 0xf1, 0xa4, 0xd4, 0x71, 0x5f, 
+  0x4a, 0x9c, 0xbc, 0x43, 0x94, 0x80, 0x2d, 0xc3, 0x03, 0xb1, 0x1b, 0xbd, 0xd9, 0x44, 0xc6, 0xd3, 
+  0xa0, 0xdf, 0x0d, 0x4e, 0x44, 0x82, 0xd7, 0xbd, 0xde, 0x89, 0xc8, 0x68, 0x80, 0x76, 0x99, 0x1d, 
+  0x12, 0x72, 0x93, 0x14, 0xc9, 0x65, 0xb2, 0x4c, 0x48, 0xf0, 0xf2, 0xae, 0x93, 0xf9, 0x5c, 0xa6, 
+  0x9e, 0x30, 0x24, 0x58, 0xc7, 0x28, 0x20, 0x99, 0x90, 0x3e, 0x26, 0xc4, 0x43, 0x3c, 0xe4, 0x9b, 
+  0x75, 0x3c, 0x03, 0x49, 0x45, 0xd2, 0xf4, 0x05, 0x6d, 0xed, 0x9f, 0x79, 0x59, 0x42, 0xef, 0x93, 
+  0xc1, 0xc0, 0x73, 0x43, 0x80, 0x94, 0x8d, 0xac, 0x93, 0xc6, 0x85, 0xde, 0xb2, 0x76, 0xf9, 0x98, 
+  0xa9, 0x0d, 0xe1, 0x51, 0x9f, 0xc4, 0x9a, 0xc9, 0x93, 0x69, 0xcf, 0x27, 0x92, 0x31, 0x08, 0x82, 
+  0x2e, 0xf1, 0x86, 0x4f, 0x75, 0x8c, 0x8e, 0x20, 0x2c, 0x2b, 0x54, 0xba, 0x29, 0x5b, 0x0e, 0xed, 
+  0x45, 0x9e, 0x4a, 0xfe, 0xcb, 0x21, 0x1b, 0x87, 0x21, 0x62, 0x8c, 0x20, 0x2a, 0xea, 0x40, 0xa5, 
+  0x04, 0x84, 0x87, 0xec, 0xd8, 0x53, 0x1c, 0x81, 0x17, 0x1a, 0x5c, 0xe4, 0x59, 0xd5, 0xff, 0x40, 
+  0x45, 0x28, 0x8c, 0x4f, 0x3f, 0x19, 0xc5, 0xdd, 0xe8, 0x49, 0xe0, 0x29, 0xb2, 0x6d, 0xc2, 0x54, 
+  0x6c, 0xba, 0x36, 0xd0, 0x49, 0xda, 0x4d, 0x25, 0xb1, 0xab, 0xd0, 0x99, 0x23, 0x84, 0x46, 0x3e, 
+  0xf6, 0x6d, 0x6d, 0xa6, 0x70, 0xaf, 0x8a, 0x8a, 0xa2, 0x19, 0x0f, 0xaf, 0xfe, 0x91, 0xa9, 0xbd, 
+  0xb3, 0xff, 0x81, 0xee, 0xa2, 0x2a, 0x8f, 0x70, 0xd6, 0x9c, 0xd0, 0x58, 0x7d, 0xc7, 0x01, 0xe2, 
+  0x1f, 0xae, 0xbb, 0x7a, 0xca, 0xe1, 0x20, 0xdd, 0xe2, 0x0f, 0xd4, 0x1c, 0x16, 0x1f, 0x57, 0xce, 
+  0xac, 0x19, 0xe2, 0x5a, 0x0d, 0x4e, 0xf9, 0xb8, 0x20, 0xb5, 0xe0, 0x2c, 0x1f, 0x5f, 0xce, 0x64, 
+  0x82, 0x70, 0xad, 0x9e, 0xe2, 0x42, 0xbc, 0x6e, 0xb9, 0x0f, 0xf0, 0xa5, 0x05, 0xf8, 0x69, 0x2f, 
+  0xeb, 0x6d, 0x7a, 0x45, 0x0f, 0x11, 0x51, 0xb0, 0xea, 0x62, 0x53, 0xad, 0xf3, 0xac, 0x01, 0x3b, 
+  0xcc, 0x46, 0x40, 0x6d, 0x4b, 0x8c, 0xc0, 0x1e, 0x69, 0x40, 0xe0, 0xea, 0x14, 0x91, 0x69, 0x2a, 
+  0xee, 0xb0, 0x16, 0x9f, 0xc6, 0x7e, 0xe0, 0xc1, 0xe4, 0xc2, 0xf1, 0xb4, 0x13, 0xa2, 0xef, 0x9a, 
+  0x8d, 0xc9, 0x71, 0x24, 0xf9, 0xe3, 0x7a, 0x0c, 0x80, 0xaa, 0x98, 0x8e, 0x46, 0x72, 0xe9, 0x78, 
+  0x44, 0x80, 0x08, 0xee, 0xd3, 0x33, 0x09, 0x0a, 0xdb, 0xfb, 0x7a, 0x7c, 0x9c, 0x6c, 0xb7, 0xf4, 
+  0xaa, 0x8d, 0x14, 0xf8, 0x81, 0x3a, 0x28, 0xcf, 0xb8, 0x9b, 0xc0, 0x9f, 0xab, 0x83, 0x97, 0x30, 
+  0x7d, 0xe1, 0x70, 0x63, 0x60, 0x78, 0xbc, 0x24, 0x5d, 0x26, 0x07, 0x02, 0xf1, 0xa8, 0x61, 0x72, 
+  0x0e, 0x02, 0xa0, 0x55, 0x76, 0x86, 0x79, 0x2d, 0x67, 0x65, 0xe1, 0x07, 0x6e, 0x74, 0xbc, 0x8f, 
+  0x9e, 0x2f, 0x44, 0xaf, 0x51, 0xd6, 0x65, 0x95, 0xb5, 0x07, 0x71, 0x52, 0xf8, 0xe4, 0x59, 0xad, 
+  0x4f, 0x58, 0xc3, 0xae, 0xd9, 0xa0, 0x84, 0x13, 0x93, 0xb6, 0x5d, 0x27, 0x10, 0x0d, 0x2f, 0x0e, 
+  0xba, 0xd8, 0xd9, 0xd5, 0x72, 0x2f, 0x4b, 0xf7, 0xa4, 0x8f, 0xe3, 0x5d, 0xb8, 0x74, 0x5c, 0xd9, 
+  0x38, 0x21, 0xa8, 0x53, 0xce, 0x31, 0x46, 0x50, 0xc7, 0x55, 0x4c, 0xb5, 0xfb, 0x0c, 0xb8, 0x89, 
+  0xf0, 0xd8, 0xfd, 0x7e, 0x78, 0x57, 0xd6, 0x9d, 0x6b, 0x41, 0x9f, 0xd7, 0xde, 0xd3, 0x85, 0xad, 
+  0x1e, 0x88, 0x03, 0xcb, 0xa4, 0x63, 0x6f, 0xe8, 0x85, 0x29, 0x3b, 0x5b, 0xda, 0x88, 0x41, 0xe1, 
+  0x7d, 0x9c, 0x26, 0x2b, 0xf6, 0x9f, 0x7a, 0x49, 0x18, 0x90, 0x2f, 0xd8, 0xf9, 0x5c, 0xf9, 0x2c, 
+  0x2d, 0x37, 0xab, 0xea, 0x76, 0x91, 0x2c, 0x97, 0x3f, 0xe8, 0x6e, 0xe0, 0x76, 0x29, 0xdf, 0x7f, 
+  0x95, 0x67, 0xb7, 0xe6, 0xfa, 0xcd, 0x75, 0x9e, 0xa4, 0xef, 0xf8, 0xae, 0xc2, 0x9d, 0xf0, 0x65, 
+  0xce, 0x93, 0xf9, 0x33, 0x22, 0x4e, 0xe6, 0xfa, 0x39, 0xd7, 0x5a, 0xbf, 0x3b, 0x4b, 0xe7, 0xf5, 
+  0x07, 0x6f, 0x10, 0xd8, 0xc7, 0x3c, 0x7a, 0xad, 0x1a, 0xd1, 0x97, 0x4e, 0x59, 0xba, 0xb3, 0x05, 
+  0x01, 0x34, 0x5f, 0xdb, 0x46, 0xb3, 0xaa, 0x9f, 0x4a, 0x64, 0xe2, 0x8b, 0xf5, 0x75, 0xac, 0x5c, 
+  0xaa, 0x08, 0xaf, 0x66, 0xb7, 0x7c, 0xf5, 0xe7, 0x4b, 0xce, 0x6d, 0x88, 0xab, 0x2c, 0x5b, 0x29, 
+  0xef, 0x61, 0x4d, 0x11, 0x71, 0xc2, 0x92, 0x09, 0x68, 0x8b, 0xeb, 0x87, 0xf2, 0xe1, 0x78, 0xda, 
+  0x30, 0xd7, 0xfc, 0x4f, 0xe3, 0x5e, 0xf3, 0x22, 0x4e, 0xa4, 0x28, 0xda, 0x92, 0xdf, 0xb0, 0x5a, 
+  0x20, 0x4a, 0x4a, 0xc3, 0xd8, 0xb3, 0x9f, 0xbf, 0x92, 0x30, 0xe0, 0xe6, 0xcf, 0xb2, 0xaf, 0x0e, 
+  0xc4, 0x13, 0x2b, 0xe0, 0x65, 0x18, 0xe0, 0xe0, 0x4e, 0xce, 0x6d, 0xe1, 0x84, 0xa2, 0xa8, 0x36, 
+  0x2b, 0x6d, 0x20, 0x82, 0x10, 0xda, 0x44, 0xb8, 0xac, 0xac, 0x10, 0x09, 0x0e, 0x30, 0xf3, 0xf1, 
+  0x52, 0xb5, 0x85, 0xc6, 0x49, 0x38, 0xc3, 0xf1, 0x95, 0x4a, 0x63, 0x06, 0xcb, 0x51, 0x15, 0x4c, 
+  0x33, 0xe0, 0x8d, 0x64, 0x28, 0x1b, 0xdf, 0x27, 0x9c, 0xb0, 0x95, 0x08, 0x8f, 0x0e, 0x81, 0x95, 
+  0x00, 0xdf, 0x78, 0x29, 0x83, 0x91, 0xa7, 0x82, 0x64, 0x77, 0x38, 0x7a, 0x95, 0xa2, 0x00, 0xe6, 
+  0x0d, 0x4e, 0x87, 0x6c, 0xb7, 0x18, 0x55, 0xda, 0xc5, 0x91, 0xef, 0x64, 0x3f, 0xb8, 0x55, 0x51, 
+  0x05, 0xb7, 0x0a, 0xf6, 0xd9, 0x6c, 0x98, 0x3c, 0x81, 0xf9, 0x69, 0x1b, 0xb2, 0x0f, 0x85, 0x8d, 
+  0x4d, 0x59, 0x71, 0xd9, 0xc0, 0x29, 0x3e, 0xc6, 0x13, 0xd1, 0xc0, 0xaf, 0x65, 0x9e, 0x60, 0x43, 
+  0x62, 0x2a, 0x8a, 0xc6, 0x54, 0x44, 0x6c, 0x90, 0x89, 0xf5, 0x61, 0x6b, 0x4e, 0xc1, 0x01, 0xdb, 
+  0xd4, 0x78, 0x86, 0x27, 0x95, 0x43, 0x3b, 0x22, 0x78, 0x70, 0x75, 0x29, 0x27, 0xb1, 0x9b, 0xed, 
+  0x05, 0x3d, 0xae, 0x45, 0xff, 0xd2, 0x6b, 0x6a, 0x43, 0x30, 0xdb, 0x85, 0x75, 0x57, 0xd2, 0x7f, 
+  0x78, 0x29, 0x83, 0xda, 0xba, 0xb9, 0xcb, 0x35, 0xe0, 0x0c, 0x76, 0xb6, 0xfb, 0x2a, 0xe0, 0xa3, 
+  0x45, 0xf1, 0x1c, 0x7a, 0x29, 0x5f, 0xc5, 0x4b, 0x1d, 0x0c, 0x12, 0x19, 0x70, 0x8f, 0xe2, 0x52, 
+  0x55, 0x01, 0x27, 0x7e, 0x1d, 0x55, 0x8a, 0x66, 0x2f, 0x1d, 0xd3, 0x0a, 0x3b, 0x88, 0x2d, 0x81, 
+  0xdb, 0x99, 0x7a, 0x95, 0x14, 0x5f, 0x02, 0x07, 0x21, 0x28, 0xc3, 0x98, 0x16, 0x6b, 0x10, 0x12, 
+  0xfd, 0x4c, 0x1c, 0x5d, 0xdd, 0xc4, 0x53, 0x1c, 0x2a, 0x31, 0x9c, 0x8a, 0x23, 0xa9, 0xe5, 0x6d, 
+  0xdb, 0x40, 0xa7, 0x66, 0xc7, 0xb2, 0x99, 0x46, 0x7b, 0x38, 0x0a, 0xf4, 0x8e, 0xb1, 0x94, 0xa1, 
+  0xb5, 0x7a, 0x8a, 0xf6, 0x23, 0xad, 0x99, 0x30, 0x70, 0xed, 0xb8, 0x9d, 0x5f, 0x7d, 0x81, 0x15, 
+  0x27, 0x98, 0xad, 0x8a, 0x50, 0x09, 0xee, 0xd6, 0x98, 0xa9, 0xeb, 0x06, 0xab, 0xc7, 0xea, 0xb3, 
+  0xac, 0x14, 0x2d, 0xf1, 0x9c, 0x4c, 0x19, 0xe8, 0xac, 0x1f, 0x0a, 0xce, 0xad, 0x48, 0x73, 0x16, 
+  0x11, 0x49, 0xab, 0x89, 0x41, 0xa0, 0x65, 0x15, 0x8f, 0x89, 0x69, 0xb7, 0xea, 0x0b, 0x04, 0xe4, 
+  0xca, 0xfe, 0x1d, 0x9a, 0x9d, 0x80, 0x46, 0x13, 0x4f, 0xa3, 0xfb, 0x44, 0xb0, 0x44, 0x33, 0x6f, 
+  0x23, 0x06, 0xc7, 0x1c, 0x6a, 0xd3, 0x2f, 0x7a, 0x51, 0x2b, 0x13, 0xb2, 0xd9, 0x27, 0xe9, 0x1b, 
+  0x87, 0x09, 0x71, 0x97, 0x9a, 0x56, 0x25, 0xe8, 0xe9, 0x56, 0x0c, 0xf1, 0x52, 0xed, 0x33, 0x97, 
+  0x02, 0x37, 0x09, 0xdf, 0x65, 0x64, 0x31, 0x00, 0x15, 0x46, 0xce, 0x65, 0x58, 0xd9, 0x9f, 0x5f, 
+  0x69, 0x0f, 0x69, 0x95, 0xe1, 0xe8, 0x65, 0x86, 0xb5, 0x41, 0x1d, 0x25, 0x71, 0x4b, 0xa5, 0x28, 
+  0x8c, 0xfd, 0xd0, 0x40, 0x84, 0xa3, 0x2e, 0x8a, 0xfe, 0x21, 0xfd, 0x8a, 0x41, 0xa8, 0x44, 0x50, 
+  0xd1, 0x42, 0xd0, 0x34, 0xaf, 0xe1, 0x8c, 0x42, 0xd1, 0xb6, 0xaa, 0xb6, 0x0a, 0x5a, 0x5a, 0x41, 
+  0x02, 0x52, 0x5e, 0x8f, 0xe1, 0xe0, 0xbe, 0xfa, 0x26, 0x1c, 0xec, 0x5a, 0x60, 0xe2, 0xe1, 0x4a, 
+  0x76, 0x81, 0x26, 0xeb, 0x8e, 0x47, 0xa6, 0xd2, 0xc9, 0x21, 0x0c, 0x8a, 0x56, 0xc3, 0x41, 0x41, 
+  0xa0, 0x28, 0x8d, 0x66, 0x2f, 0x9d, 0x76, 0x98, 0xa3, 0x77, 0xb6, 0x48, 0xd2, 0xcd, 0x68, 0x93, 
+  0x28, 0xb3, 0x6b, 0xbb, 0x65, 0x99, 0xf8, 0x7c, 0x15, 0xeb, 0x20, 0x6a, 0xc9, 0xaf, 0x2b, 0xcd, 
+  0x89, 0xdc, 0x23, 0x04, 0x24, 0x22, 0x79, 0xad, 0x24, 0x16, 0x1f, 0xd6, 0xa2, 0x94, 0x6a, 0x4e, 
+  0x91, 0x80, 0x19, 0xf5, 0xab, 0x60, 0x80, 0xf4, 0xb7, 0xf7, 0x84, 0x7f, 0x07, 0xd3, 0x2a, 0x10, 
+  0xf5, 0xce, 0x65, 0xd7, 0x13, 0x13, 0x43, 0xb0, 0xea, 0x1c, 0xb0, 0x61, 0x54, 0xc0, 0xac, 0x53, 
+  0xb7, 0x03, 0x37, 0x11, 0xe1, 0x61, 0x1b, 0xcf, 0xbe, 0xea, 0x9a, 0xf6, 0x06, 0x0b, 0x2e, 0xcd, 
+  0xc0, 0xeb, 0x6a, 0xd4, 0x15, 0x27, 0x6c, 0x13, 0x3e, 0xc7, 0xa7, 0x09, 0x09, 0x2e, 0xdd, 0x20, 
+  0x9b, 0x94, 0xc4, 0xb5, 0x4f, 0x2d, 0xac, 0x95, 0x2c, 0x19, 0x80, 0x8a, 0x99, 0x01, 0x65, 0xbb, 
+  0x66, 0x18, 0x80, 0x74, 0xec, 0x46, 0x1d, 0x4c, 0x61, 0x26, 0x37, 0xd1, 0x0f, 0x77, 0xec, 0xa7, 
+  0xb9, 0x1f, 0x6f, 0x99, 0x6d, 0x13, 0x38, 0x70, 0x78, 0x7e, 0x2b, 0x65, 0x1a, 0x2d, 0xcb, 0xe0, 
+  0xd0, 0x61, 0x83, 0x25, 0xd1, 0x3e, 0xc2, 0x96, 0x2d, 0x87, 0xb9, 0xb1, 0xce, 0xca, 0x72, 0x43, 
+  0x62, 0xb8, 0x39, 0x16, 0x42, 0xb5, 0xac, 0xa3, 0xd4, 0x38, 0x3f, 0x16, 0xb4, 0x98, 0x51, 0x02, 
+  0xec, 0xaf, 0xae, 0xab, 0x08, 0x40, 0xca, 0xc1, 0x91, 0xe3, 0x2e, 0x15, 0x51, 0x69, 0x5c, 0xdc, 
+  0x11, 0xdf, 0x50, 0x1b, 0x5a, 0x6f, 0x23, 0x73, 0x54, 0xc3, 0x78, 0xc0, 0x23, 0xe8, 0x61, 0xae, 
+  0x2e, 0x39, 0x24, 0x62, 0xd6, 0x20, 0xac, 0x69, 0x45, 0x58, 0x89, 0x8a, 0x6d, 0xf2, 0x7d, 0xa7, 
+  0x7d, 0xc5, 0x87, 0xae, 0x35, 0x55, 0x32, 0xdd, 0xb5, 0xa0, 0x22, 0x35, 0xce, 0x55, 0xd1, 0xb4, 
+  0xb4, 0xd1, 0xdd, 0xfd, 0xc6, 0x76, 0xbf, 0x7a, 0x4f, 0x50, 0xbb, 0x49, 0x5b, 0xbd, 0x81, 0x3f, 
+  0xd0, 0x98, 0x3b, 0x01, 0xfd, 0xf9, 0x46, 0x31, 0xa3, 0x3a, 0xbd, 0x72, 0x46, 0x53, 0x12, 0x99, 
+  0x39, 0x9b, 0x38, 0x73, 0x39, 0x35, 0xf6, 0xd6, 0xe6, 0x87, 0x8f, 0xa5, 0x18, 0x88, 0x61, 0xfb, 
+  0x3b, 0xed, 0x38, 0xa0, 0x6a, 0x35, 0xf6, 0x5a, 0x9a, 0x5f, 0xdf, 0xcc, 0x6a, 0xaf, 0x9a, 0xfd, 
+  0xe0, 0x71, 0xd9, 0xad, 0xee, 0xea, 0xf5, 0x15, 0xa5, 0x5c, 0x6b, 0x5b, 0x9d, 0xfb, 0xa8, 0xf2, 
+  0xa4, 0x53, 0x67, 0x50, 0x4d, 0xfd, 0x26, 0xa9, 0x39, 0x0e, 0xa1, 0xd3, 0x0e, 0x1b, 0xa7, 0x36, 
+  0xe8, 0xc8, 0xa1, 0x49, 0xb5, 0xef, 0x85, 0x76, 0x72, 0x65, 0x59, 0xc1, 0x01, 0x4c, 0x57, 0x8e, 
+  0x10, 0xbe, 0x5b, 0x49, 0x74, 0x6f, 0xcf, 0x8d, 0x35, 0xe8, 0xb1, 0x89, 0x78, 0x6e, 0xa2, 0xe4, 
+  0x30, 0xd3, 0x8a, 0x8e, 0x3a, 0xf6, 0x7d, 0xe3, 0xa5, 0x8f, 0xc7, 0x13, 0xa9, 0xd6, 0xc9, 0x04, 
+  0xf4, 0xd1, 0x85, 0x15, 0x21, 0xd0, 0xef, 0xc6, 0xf5, 0xa2, 0x48, 0xa2, 0xa0, 0xb7, 0x9c, 0x9a, 
+  0x02, 0xf5, 0x1c, 0x9e, 0x63, 0x4c, 0x3d, 0x21, 0xfe, 0x75, 0x38, 0x11, 0x05, 0x10, 0x72, 0xf3, 
+  0x98, 0x21, 0xe1, 0x9c, 0xf7, 0x3c, 0x91, 0xb6, 0xf6, 0xbd, 0x27, 0x88, 0xc1, 0xdf, 0xda, 0xf1, 
+  0x8e, 0x83, 0xca, 0x1e, 0xea, 0x37, 0x94, 0x60, 0xfc, 0x3a, 0x68, 0xf6, 0x9d, 0x39, 0xf8, 0xdb, 
+  0xd0, 0x22, 0x90, 0xda, 0x00, 0xf8, 0x5d, 0x57, 0xf2, 0x76, 0x63, 0x42, 0xa7, 0x79, 0x83, 0x73, 
+  0xda, 0xe3, 0xb5, 0x25, 0x54, 0x8f, 0x99, 0xe8, 0xdd, 0x37, 0xc7, 0xd7, 0xe8, 0x34, 0xf6, 0x18, 
+  0x3f, 0xa8, 0x39, 0xb5, 0xb5, 0x75, 0xca, 0x9c, 0x70, 0x61, 0x24, 0x72, 0x0f, 0x89, 0x27, 0x3e, 
+  0xe4, 0xa2, 0x56, 0xdc, 0x82, 0x2a, 0xed, 0xbf, 0xeb, 0x7f, 0xda, 0x53, 0xcc, 0x44, 0x46, 0x6b, 
+  0xf3, 0x98, 0x2f, 0x5f, 0xbd, 0x0c, 0x4e, 0x9e, 0x38, 0xc7, 0x0c, 0x3d, 0xfe, 0xd6, 0x43, 0x53, 
+  0x8b, 0xf7, 0xd1, 0x9e, 0xa4, 0x2a, 0xec, 0x62, 0x40, 0xab, 0x08, 0x50, 0x22, 0x02, 0x3e, 0x2f, 
+  0xc5, 0xba, 0x14, 0xd7, 0xa5, 0xb8, 0x29, 0x55, 0x80, 0x2d, 0x15, 0x2c, 0x73, 0x8b, 0x30, 0x96, 
+  0x5b, 0x04, 0xaf, 0x44, 0xc6, 0x88, 0x2b, 0x7a, 0x57, 0x45, 0x56, 0x7e, 0xe4, 0x04, 0xd0, 0x5a, 
+  0x11, 0xad, 0xbd, 0x9f, 0x83, 0x6d, 0x65, 0x97, 0xf1, 0x77, 0x7d, 0xa5, 0xad, 0x43, 0x26, 0xab, 
+  0x1c, 0x51, 0xa8, 0x8b, 0xf2, 0x99, 0x11, 0x53, 0xbf, 0xcc, 0x11, 0xdd, 0xef, 0xc0, 0x73, 0x7f, 
+  0x55, 0x06, 0x61, 0x2d, 0x6f, 0xd1, 0x4a, 0xf7, 0x97, 0xcf, 0x3a, 0xdc, 0xc4, 0x1c, 0xa1, 0x83, 
+  0x6e, 0xcb, 0x64, 0x86, 0xa4, 0x79, 0x95, 0xa4, 0x7e, 0x59, 0x56, 0xec, 0xc0, 0xa1, 0xf4, 0x56, 
+  0x0b, 0xe3, 0xd9, 0x4e, 0x94, 0x82, 0xae, 0xab, 0x23, 0x6b, 0x55, 0x35, 0x77, 0x65, 0x3d, 0x33, 
+  0x09, 0x3c, 0xd6, 0xee, 0x15, 0xf3, 0x1c, 0x4a, 0x65, 0xbe, 0x2d, 0x95, 0x32, 0x6f, 0x94, 0x13, 
+  0xd5, 0xce, 0xbb, 0xd1, 0x93, 0x1e, 0x32, 0xb9, 0x18, 0x7a, 0xdc, 0x85, 0x75, 0x49, 0xc2, 0x93, 
+  0x6d, 0x1a, 0xd1, 0xd3, 0x4a, 0x1f, 0x46, 0x10, 0xe0, 0xd8, 0x49, 0xfd, 0xa4, 0xaf, 0x25, 0x5c, 
+  0xe2, 0x3e, 0x95, 0x15, 0x07, 0xc4, 0xb3, 0xea, 0xc7, 0x6d, 0xd9, 0xe6, 0x86, 0xe9, 0x23, 0x50, 
+  0x0b, 0xc8, 0x1b, 0x4e, 0xfc, 0x97, 0x53, 0x95, 0xce, 0x84, 0x48, 0xdb, 0x8c, 0xb8, 0x2b, 0xf7, 
+  0x95, 0xf7, 0xd8, 0x43, 0xba, 0xc2, 0x08, 0x11, 0x66, 0x13, 0x1b, 0x5b, 0xe3, 0x34, 0x36, 0x4e, 
+  0x6c, 0xca, 0x63, 0x53, 0x3b, 0xcf, 0xc2, 0x1d, 0xdf, 0x2a, 0x1d, 0xf3, 0xaa, 0x0b, 0xef, 0x91, 
+  0x10, 0xc0, 0x99, 0x8c, 0x58, 0x4f, 0xc7, 0x7b, 0x00, 0x94, 0xf6, 0xa8, 0xb0, 0xc9, 0x0e, 0x8a, 
+  0x5a, 0x6c, 0xef, 0xbe, 0x4a, 0x72, 0xea, 0xce, 0xbd, 0x09, 0x5d, 0xc1, 0xbb, 0x62, 0x07, 0x01, 
+  0xba, 0x6e, 0x6a, 0x8a, 0xed, 0xf9, 0x84, 0x91, 0x75, 0xac, 0x89, 0x16, 0xe5, 0x76, 0x8b, 0x85, 
+  0x25, 0x4e, 0xd5, 0xd1, 0xe8, 0xcd, 0x14, 0x2a, 0xc7, 0x02, 0x77, 0x67, 0x96, 0x26, 0xf4, 0x90, 
+  0xba, 0x29, 0x1a, 0xf6, 0xfc, 0xf2, 0xa4, 0x7a, 0xc8, 0xea, 0x3b, 0xd5, 0xed, 0x99, 0x9a, 0x9e, 
+  0xa2, 0xe9, 0x7e, 0x68, 0x9e, 0x23, 0xb1, 0x1c, 0x11, 0x3e, 0x92, 0x95, 0x47, 0x36, 0x21, 0x6b, 
+  0x95, 0x45, 0x91, 0xa6, 0x62, 0x32, 0xc3, 0xa9, 0x86, 0x29, 0xf2, 0x18, 0x0f, 0x49, 0x0c, 0x26, 
+  0xd4, 0xe7, 0x13, 0x1f, 0xb0, 0x5f, 0x68, 0x28, 0x06, 0x54, 0xa8, 0xa8, 0xc5, 0x42, 0xcf, 0xf8, 
+  0xd4, 0x3b, 0x7c, 0x47, 0x88, 0x8e, 0x47, 0x85, 0x8d, 0x32, 0xae, 0xce, 0xa9, 0x67, 0x88, 0xb0, 
+  0xbe, 0x2e, 0x6a, 0xd9, 0xb2, 0x21, 0xba, 0xac, 0x4b, 0xe7, 0x19, 0x09, 0x92, 0xf7, 0xda, 0x43, 
+  0xf1, 0x8c, 0x11, 0x08, 0xd4, 0x1b, 0x0a, 0x95, 0x84, 0x7b, 0xcc, 0xc8, 0x0e, 0x27, 0x36, 0xcd, 
+  0x59, 0x3e, 0x2d, 0x17, 0x27, 0xb2, 0x80, 0xdf, 0xae, 0x7e, 0xf8, 0x83, 0xa2, 0x77, 0x21, 0x31, 
+  0xfc, 0x66, 0x32, 0x43, 0x3b, 0xdd, 0x66, 0xfa, 0xc2, 0xd2, 0xce, 0xa4, 0x50, 0xb3, 0x84, 0x00, 
+  0x9a, 0x3a, 0xc2, 0x20, 0xee, 0xc3, 0xf6, 0x4c, 0xf0, 0xfc, 0x8e, 0x06, 0x3d, 0x03, 0x59, 0x55, 
+  0x07, 0x6b, 0xd4, 0x65, 0xbf, 0x36, 0x02, 0x36, 0x59, 0xe8, 0x17, 0x6a, 0x00, 0x76, 0xee, 0xed, 
+  0x6a, 0xe9, 0xf4, 0x0c, 0x22, 0x55, 0x47, 0x19, 0x5b, 0xce, 0xaf, 0x81, 0xd5, 0x96, 0xe3, 0xc6, 
+  0xf2, 0x86, 0xcc, 0xab, 0xc6, 0xee, 0xf9, 0xf8, 0x91, 0x72, 0xb6, 0xed, 0x0c, 0x88, 0xdf, 0x4e, 
+  0x99, 0xdf, 0xb6, 0x4b, 0x5f, 0xaa, 0xa5, 0x1f, 0x56, 0x0e, 0xc5, 0x63, 0xff, 0xe3, 0x17, 0x56, 
+  0xc8, 0x69, 0x10, 0x84, 0x85, 0x9b, 0x1c, 0xd4, 0x3c, 0x36, 0x64, 0x5f, 0x2c, 0x11, 0xbe, 0x01, 
+  0x8b, 0xcc, 0xbd, 0xe8, 0x3c, 0x10, 0x4c, 0x82, 0x0b, 0xa4, 0x4a, 0xab, 0x49, 0x43, 0x48, 0x90, 
+  0x1e, 0x2a, 0xfa, 0x86, 0xa6, 0x60, 0x2a, 0x10, 0x22, 0x33, 0x9d, 0x8a, 0x3a, 0x07, 0x9e, 0x29, 
+  0x55, 0x0f, 0x72, 0x7c, 0xea, 0x02, 0x11, 0xd2, 0x5c, 0xd2, 0x8c, 0xe9, 0x24, 0x69, 0xc0, 0x46, 
+  0x51, 0x26, 0x6c, 0x46, 0xa2, 0x74, 0xda, 0xd4, 0x66, 0xe4, 0xac, 0xbe, 0x50, 0xf2, 0x0c, 0x6b, 
+  0x30, 0x02, 0xdb, 0x07, 0x84, 0x9c, 0x56, 0x2f, 0x10, 0xda, 0xd1, 0xd6, 0x91, 0x23, 0x68, 0xa0, 
+  0xea, 0x24, 0x8c, 0x4c, 0xaa, 0x51, 0xea, 0x1a, 0xc2, 0x45, 0x44, 0x89, 0xf6, 0xe2, 0x45, 0x5e, 
+  0xab, 0x28, 0xd9, 0xf9, 0xcb, 0xd6, 0xc5, 0x0f, 0xec, 0x0e, 0x64, 0x6b, 0x48, 0x0d, 0xab, 0x60, 
+  0x2f, 0x32, 0x72, 0x9a, 0xd1, 0x8c, 0x98, 0xcf, 0x2d, 0x8e, 0xba, 0xf3, 0x53, 0x3e, 0x3b, 0x1a, 
+  0xb0, 0xe0, 0xe3, 0xe6, 0x57, 0x98, 0x29, 0x5a, 0xaf, 0x9b, 0xe3, 0x17, 0x01, 0x17, 0x8d, 0xd4, 
+  0x17, 0x1c, 0xbe, 0x88, 0x93, 0x7d, 0xa4, 0x55, 0x4e, 0x52, 0xb8, 0xc8, 0x2d, 0xc5, 0x6d, 0x89, 
+  0xe8, 0x2c, 0x77, 0xbe, 0xe9, 0x2a, 0xb3, 0x8e, 0x88, 0xd8, 0x51, 0xdd, 0xaa, 0x2e, 0x65, 0x28, 
+  0x37, 0xab, 0xb2, 0x13, 0xeb, 0x12, 0xe6, 0x5e, 0x27, 0x29, 0xd6, 0x4f, 0x71, 0x6d, 0xba, 0x63, 
+  0xd2, 0xfb, 0xe9, 0xb4, 0xc5, 0xfa, 0x29, 0xae, 0x2d, 0xbe, 0xd4, 0xcf, 0xd4, 0x9d, 0xa5, 0x74, 
+  0x2b, 0x37, 0x76, 0xdd, 0x46, 0x18, 0x9c, 0x01, 0xc5, 0x6f, 0x38, 0x13, 0x2a, 0x2b, 0x84, 0x3b, 
+  0x64, 0xa4, 0xaf, 0x9b, 0xed, 0xce, 0xfa, 0x96, 0xb4, 0x56, 0x07, 0x5e, 0xde, 0x97, 0xe2, 0xde, 
+  0x50, 0x89, 0xf0, 0x9e, 0xc8, 0x44, 0x38, 0x69, 0xcd, 0xf6, 0xc1, 0x72, 0x4a, 0xb5, 0xcd, 0xd5, 
+  0x21, 0x7a, 0x83, 0x16, 0x25, 0xcd, 0xbf, 0xe2, 0xa9, 0x44, 0xa5, 0x71, 0x10, 0xbc, 0x47, 0xa7, 
+  0x3b, 0xa1, 0xab, 0x0f, 0x0f, 0x24, 0x8b, 0x37, 0x6e, 0xee, 0x32, 0xe2, 0xf8, 0x18, 0x9c, 0xd7, 
+  0x41, 0xd1, 0xab, 0x50, 0xda, 0x90, 0x57, 0x7b, 0xce, 0xef, 0x70, 0xc2, 0x26, 0x98, 0x73, 0x69, 
+  0x1c, 0x01, 0x5a, 0xfd, 0x96, 0x83, 0x04, 0xd5, 0x1f, 0xd9, 0xcc, 0x29, 0xa5, 0x72, 0xaa, 0xd5, 
+  0xe0, 0x55, 0x1f, 0xf4, 0x01, 0xd7, 0x7f, 0xb1, 0x30, 0xe6, 0xbb, 0x84, 0x4d, 0xa9, 0x46, 0x85, 
+  0x86, 0x3b, 0x31, 0x57, 0x91, 0x47, 0xc0, 0x41, 0x71, 0x3c, 0x5b, 0x65, 0xa7, 0xbd, 0xa9, 0x29, 
+  0x8f, 0x63, 0x16, 0x88, 0xaf, 0x6c, 0x5c, 0x40, 0x6f, 0xf1, 0x1e, 0xdc, 0x94, 0xa7, 0x4e, 0xc5, 
+  0xb1, 0x7b, 0x78, 0xaa, 0x16, 0x0c, 0xba, 0x55, 0xe6, 0x70, 0x79, 0x5b, 0xd6, 0x53, 0xc6, 0x70, 
+  0xce, 0x9b, 0x80, 0x06, 0xc2, 0x4f, 0x71, 0x4a, 0x26, 0xb6, 0x37, 0x11, 0x2c, 0x8a, 0xb1, 0x93, 
+  0xc9, 0x45, 0xb8, 0x37, 0x2e, 0x81, 0xad, 0xbe, 0x21, 0x8a, 0x85, 0x38, 0xe4, 0xa2, 0x7a, 0xd2, 
+  0xed, 0x8a, 0x79, 0x1b, 0xc1, 0x6e, 0x79, 0x56, 0x7d, 0xd4, 0xeb, 0x89, 0x2a, 0x05, 0x0e, 0xf7, 
+  0x51, 0x2f, 0x19, 0xd2, 0xc9, 0xd6, 0x52, 0xcb, 0xe8, 0x6c, 0x8a, 0x06, 0x95, 0x4d, 0x89, 0xc3, 
+  0x34, 0xc1, 0xe6, 0x98, 0xf0, 0x1b, 0xaf, 0x11, 0xc6, 0x29, 0x90, 0x80, 0x3d, 0xc5, 0x7a, 0xb2, 
+  0x66, 0x8e, 0x20, 0x85, 0x66, 0xe5, 0x66, 0x0c, 0xeb, 0xaf, 0x24, 0x49, 0x58, 0x4d, 0x20, 0x7f, 
+  0xa7, 0xae, 0xa1, 0xff, 0x20, 0xa1, 0xe1, 0xca, 0x89, 0xc2, 0x70, 0x05, 0x7c, 0x06, 0xbb, 0x4e, 
+  0x92, 0x6e, 0xe4, 0xe8, 0x06, 0xe1, 0x07, 0xd6, 0xc0, 0x44, 0x57, 0xc7, 0xc7, 0x78, 0x05, 0xd1, 
+  0xdd, 0xa8, 0x16, 0xf2, 0x00, 0xf1, 0x4e, 0xfd, 0x4d, 0xd4, 0x92, 0x57, 0x2d, 0x60, 0x59, 0xa4, 
+  0xfe, 0x74, 0x1d, 0x54, 0xae, 0xfd, 0x8b, 0x66, 0x3e, 0x34, 0xe8, 0xd6, 0xfb, 0xc6, 0xf9, 0x2b, 
+  0x9a, 0x5c, 0xdb, 0x6b, 0x51, 0x5d, 0xfe, 0xe2, 0x5c, 0xff, 0x3a, 0x15, 0x7a, 0xd5, 0x67, 0xdc, 
+  0x37, 0x13, 0x08, 0x9f, 0x73, 0x05, 0x54, 0x50, 0x53, 0xa9, 0x56, 0xab, 0x28, 0xfd, 0xfe, 0xb2, 
+  0x25, 0xc9, 0x05, 0x7f, 0x37, 0x26, 0x42, 0x13, 0xfa, 0x33, 0x15, 0xc7, 0x9a, 0x13, 0x62, 0x36, 
+  0xf3, 0x65, 0x10, 0xc5, 0x15, 0x6d, 0x9f, 0x0b, 0xf5, 0x11, 0x8e, 0x55, 0xf9, 0x8e, 0x0d, 0x6f, 
+  0x49, 0x0b, 0xa2, 0xee, 0x7a, 0xca, 0xe0, 0x8e, 0x67, 0x4a, 0x22, 0xeb, 0x44, 0xb3, 0xd6, 0xb4, 
+  0x1b, 0x0b, 0x68, 0xfb, 0x58, 0xdb, 0xb8, 0xe1, 0xc0, 0x6a, 0x8c, 0x10, 0x1d, 0x28, 0xba, 0xae, 
+  0x42, 0xfe, 0xef, 0x02, 0x3d, 0x07, 0x33, 0x4e, 0x22, 0x61, 0xdf, 0x50, 0xb7, 0x6d, 0xbd, 0x4b, 
+  0xe8, 0x40, 0x10, 0x51, 0xb2, 0xfa, 0xae, 0xde, 0x23, 0xa0, 0x73, 0x3b, 0xab, 0x54, 0x4f, 0x35, 
+  0xc5, 0x51, 0xe5, 0x35, 0xd0, 0x02, 0xcd, 0x4e, 0xb9, 0xea, 0x7b, 0x3e, 0xbb, 0x57, 0xad, 0x97, 
+  0xfb, 0x66, 0xe8, 0xbe, 0xf9, 0xd5, 0x7d, 0xf3, 0x64, 0xba, 0xe3, 0xac, 0x0b, 0x88, 0x31, 0x11, 
+  0x60, 0xd0, 0x57, 0x63, 0xd3, 0x32, 0x41, 0x0a, 0x42, 0xfd, 0xdd, 0x20, 0xfc, 0x25, 0x3f, 0x09, 
+  0xc2, 0x2b, 0x37, 0x25, 0x95, 0xc1, 0x0a, 0xe2, 0xde, 0x38, 0x36, 0x60, 0x52, 0xa0, 0x36, 0x36, 
+  0x1f, 0x44, 0x9d, 0x9b, 0x40, 0xdc, 0x10, 0x29, 0xaa, 0x16, 0x75, 0x7f, 0x4e, 0x2d, 0x58, 0xde, 
+  0xd0, 0xfa, 0xaa, 0x85, 0x14, 0x6e, 0x70, 0x37, 0x83, 0x7b, 0xa8, 0x7f, 0x0e, 0xf8, 0x0b, 0x6c, 
+  0x8c, 0x40, 0xf5, 0x9d, 0x24, 0x8e, 0x9b, 0x31, 0x36, 0x48, 0x38, 0xa0, 0x17, 0x73, 0x62, 0x9b, 
+  0x51, 0xdd, 0x15, 0x06, 0x83, 0xdd, 0xb3, 0xd1, 0xfa, 0x93, 0x1b, 0x3e, 0xdd, 0x06, 0xc5, 0x95, 
+  0x79, 0xa2, 0x7f, 0xa3, 0x01, 0x89, 0x63, 0xd3, 0x0a, 0xcb, 0x36, 0x13, 0x68, 0x8d, 0xeb, 0x72, 
+  0x83, 0xc1, 0xcc, 0x32, 0x08, 0xeb, 0x2f, 0x98, 0xe1, 0x93, 0xda, 0xd3, 0x98, 0x38, 0x06, 0x42, 
+  0x73, 0xad, 0xd8, 0x1a, 0x4e, 0xe5, 0xad, 0x89, 0xef, 0xc7, 0x75, 0x36, 0x3a, 0xbc, 0x37, 0x84, 
+  0x37, 0x24, 0x71, 0xa0, 0x43, 0x32, 0x69, 0x89, 0x74, 0xd2, 0x30, 0x19, 0xcb, 0x8a, 0xd1, 0x95, 
+  0x86, 0x95, 0x56, 0xef, 0x91, 0x6a, 0xf1, 0x8e, 0x7d, 0xf6, 0x4a, 0x27, 0x7b, 0x39, 0x51, 0xe3, 
+  0x6c, 0xb1, 0x18, 0xe7, 0x96, 0x29, 0x8e, 0x06, 0x61, 0x65, 0x26, 0xd3, 0xfa, 0xdd, 0xea, 0x2d, 
+  0xa7, 0x3a, 0x31, 0x37, 0x98, 0x4c, 0x25, 0x78, 0x63, 0x48, 0x85, 0x5b, 0x89, 0xf3, 0x78, 0x52, 
+  0x3d, 0x9e, 0x86, 0xed, 0x45, 0x2c, 0x8f, 0x6f, 0x4c, 0x76, 0xb9, 0xc2, 0xc3, 0xd4, 0x63, 0x4e, 
+  0x97, 0x69, 0x49, 0x8a, 0xbe, 0xe2, 0x7c, 0x57, 0x38, 0x46, 0x97, 0x2d, 0xe7, 0xf4, 0xd6, 0x4c, 
+  0x86, 0xa8, 0x2e, 0x5d, 0x42, 0x71, 0xe7, 0x73, 0x41, 0xce, 0x99, 0x94, 0x2d, 0xe7, 0x95, 0x26, 
+  0x0c, 0x35, 0xe8, 0x76, 0x1a, 0x99, 0xa5, 0xf4, 0x73, 0xe8, 0x0d, 0x77, 0x75, 0x75, 0xf3, 0x22, 
+  0x26, 0xcc, 0x98, 0x1d, 0x3e, 0x78, 0xcf, 0x6c, 0x86, 0x76, 0xcd, 0x8f, 0x71, 0x72, 0xba, 0x40, 
+  0x9a, 0x30, 0x6d, 0xfb, 0x16, 0x03, 0x93, 0x44, 0x03, 0xd0, 0x06, 0x99, 0x92, 0xd9, 0x19, 0x92, 
+  0x99, 0x8c, 0x6d, 0xb8, 0xdc, 0xa9, 0x88, 0xb9, 0x38, 0x17, 0xa2, 0xde, 0xed, 0x05, 0xd3, 0x75, 
+  0xb2, 0x54, 0x25, 0x56, 0x67, 0xaa, 0x4f, 0x1f, 0x09, 0x17, 0x4e, 0x68, 0x36, 0xe3, 0x60, 0x04, 
+  0xe3, 0x8f, 0x1b, 0x9d, 0x70, 0x91, 0xa4, 0x49, 0x71, 0xed, 0x29, 0x8f, 0x05, 0x30, 0x90, 0x70, 
+  0x30, 0x64, 0xcf, 0x26, 0xe4, 0xb2, 0x6a, 0x52, 0x0c, 0xb6, 0xf6, 0xf2, 0x22, 0x69, 0xdb, 0xa4, 
+  0xb5, 0x28, 0xf6, 0x55, 0x45, 0x44, 0xcf, 0x32, 0x04, 0x12, 0xe4, 0xd4, 0xe6, 0x3c, 0x69, 0x4e, 
+  0xce, 0xc3, 0x44, 0x2b, 0x35, 0xd5, 0xcc, 0xea, 0xf7, 0xf0, 0x26, 0x68, 0xc8, 0x3d, 0x09, 0x8d, 
+  0x2c, 0x73, 0xc6, 0x15, 0xbb, 0x3e, 0xda, 0x28, 0x6a, 0xfc, 0x30, 0xd5, 0x9d, 0x40, 0x2c, 0xfc, 
+  0xdd, 0x81, 0xa4, 0x68, 0x09, 0x1f, 0x8e, 0x46, 0x62, 0x2d, 0x50, 0x5a, 0x9b, 0x5c, 0x4b, 0xab, 
+  0x44, 0x55, 0x4f, 0x92, 0x2a, 0x13, 0x98, 0x78, 0x20, 0xf5, 0x19, 0x62, 0x8d, 0xe8, 0xb3, 0x28, 
+  0x30, 0x12, 0xd7, 0x52, 0x70, 0x09, 0x00, 0x30, 0xf3, 0xb1, 0x45, 0x2d, 0xc0, 0xb5, 0x3e, 0x36, 
+  0x98, 0x73, 0x12, 0x43, 0xfc, 0xe5, 0x1e, 0x13, 0xe7, 0xe4, 0xe7, 0x7c, 0x82, 0xc6, 0x46, 0xb8, 
+  0x64, 0xab, 0x68, 0xbe, 0x5f, 0xf0, 0xaa, 0xac, 0x9c, 0x6b, 0xcd, 0x47, 0x4a, 0x45, 0x93, 0xd6, 
+  0xd2, 0x24, 0xc2, 0x89, 0x97, 0x59, 0xd6, 0x8e, 0x89, 0x52, 0x61, 0x7b, 0xca, 0xaf, 0xb8, 0xaf, 
+  0x8a, 0x95, 0xf0, 0xf9, 0x01, 0xe0, 0x49, 0x2d, 0x78, 0x86, 0x64, 0x63, 0x38, 0x10, 0x6d, 0xe2, 
+  0x83, 0x96, 0x62, 0x18, 0x04, 0xa3, 0x0e, 0x4d, 0x52, 0x06, 0x56, 0xa2, 0xb6, 0x15, 0x92, 0x40, 
+  0xc5, 0x43, 0xc3, 0x62, 0x57, 0x2b, 0x16, 0x57, 0x41, 0xe4, 0xe1, 0x86, 0xcb, 0xae, 0x2a, 0xb1, 
+  0xce, 0x66, 0xf8, 0xc0, 0x94, 0xd2, 0x7c, 0x3a, 0x53, 0x45, 0x73, 0x58, 0x4e, 0x62, 0x93, 0x19, 
+  0x0f, 0x47, 0x1c, 0xaa, 0x5b, 0x35, 0xcb, 0x53, 0x3e, 0xca, 0xa8, 0xa7, 0x39, 0x43, 0xe2, 0xdd, 
+  0x4a, 0x16, 0xe6, 0x49, 0x31, 0x50, 0x48, 0x4b, 0x55, 0x4b, 0x54, 0x17, 0xf3, 0xda, 0x22, 0x5a, 
+  0xaa, 0x9e, 0x56, 0xf5, 0xeb, 0x9c, 0x27, 0xef, 0x70, 0xca, 0x35, 0xab, 0x49, 0x92, 0xec, 0x04, 
+  0x48, 0x34, 0x46, 0xd9, 0x49, 0xd4, 0x9c, 0xc2, 0x33, 0x40, 0xea, 0xa9, 0x8c, 0xd4, 0x30, 0xf9, 
+  0x41, 0x35, 0x95, 0xa8, 0x25, 0x31, 0xd3, 0x28, 0x79, 0x1a, 0xd1, 0x2f, 0x19, 0x0d, 0x46, 0xf2, 
+  0x34, 0x1b, 0x49, 0xb6, 0x80, 0x49, 0xa8, 0x7b, 0xf1, 0x9d, 0xea, 0x6c, 0xed, 0xc6, 0xc1, 0x46, 
+  0xd6, 0xd9, 0x58, 0xbf, 0xda, 0x05, 0x35, 0x73, 0xb7, 0x66, 0x21, 0x85, 0x62, 0x12, 0x85, 0x62, 
+  0x1f, 0x6b, 0x46, 0x6f, 0xe3, 0x00, 0x10, 0xf1, 0x71, 0x92, 0x7c, 0x3a, 0xd2, 0xbf, 0xd1, 0x81, 
+  0x44, 0xaa, 0x5a, 0x05, 0x4d, 0xcb, 0xd6, 0x92, 0x2c, 0x28, 0x69, 0xf7, 0x88, 0x56, 0x1b, 0xda, 
+  0xe0, 0xad, 0x3b, 0xe4, 0x48, 0xe2, 0x99, 0x54, 0xa9, 0x58, 0x1d, 0x73, 0x64, 0xb1, 0xa4, 0xfe, 
+  0xbd, 0xc8, 0x6e, 0xd3, 0x90, 0x0a, 0x69, 0x26, 0x57, 0xf0, 0xc3, 0x1f, 0xd7, 0xfc, 0x88, 0xfb, 
+  0xaf, 0x1f, 0x9d, 0xab, 0x34, 0x46, 0x78, 0xac, 0x87, 0x19, 0x08, 0x60, 0xda, 0x97, 0x69, 0xe5, 
+  0x65, 0xa4, 0xea, 0xd8, 0xf1, 0xf3, 0x1f, 0x36, 0xa5, 0xf3, 0x82, 0x6b, 0x52, 0x2f, 0x74, 0x45, 
+  0xd5, 0x3b, 0x5d, 0xdd, 0x6e, 0xd7, 0x98, 0xa8, 0xfd, 0x13, 0x37, 0xb5, 0xa9, 0xa9, 0x8d, 0x32, 
+  0xaf, 0x0d, 0x4f, 0x41, 0x23, 0x8e, 0xe4, 0x58, 0xad, 0x6d, 0xd4, 0x02, 0xe7, 0x03, 0x07, 0x43, 
+  0xa8, 0x6c, 0x15, 0xae, 0x76, 0x16, 0xfa, 0x1a, 0x37, 0x88, 0x2b, 0x41, 0x0c, 0x7b, 0xe5, 0xfb, 
+  0xda, 0x3d, 0xbf, 0xc3, 0xeb, 0x52, 0x6d, 0x50, 0x92, 0x4d, 0x86, 0xc1, 0x28, 0xb5, 0x02, 0x89, 
+  0xd6, 0x77, 0x13, 0x04, 0xb2, 0xda, 0x57, 0xab, 0x80, 0x1d, 0xe9, 0x3a, 0xaa, 0x1b, 0x2f, 0x54, 
+  0x3f, 0x0c, 0x23, 0x62, 0xd4, 0xe5, 0x71, 0xce, 0xb1, 0xbc, 0x6a, 0xca, 0xe8, 0x68, 0xf8, 0xd4, 
+  0x79, 0xed, 0x8e, 0x6c, 0x0e, 0xe7, 0xdb, 0x79, 0x89, 0xbd, 0x06, 0xdd, 0xb8, 0xf9, 0x90, 0x75, 
+  0x11, 0xb5, 0x62, 0xea, 0xcc, 0x83, 0x70, 0x08, 0x7c, 0x44, 0xe0, 0x90, 0xdd, 0x86, 0x9f, 0x0d, 
+  0x06, 0xb4, 0x4a, 0x45, 0x19, 0x3e, 0xa1, 0x0b, 0xab, 0xdb, 0xff, 0x64, 0x30, 0xd0, 0x44, 0x96, 
+  0x36, 0x00, 0x71, 0xc2, 0xb6, 0xae, 0x5c, 0x54, 0xe6, 0x83, 0x9c, 0xf9, 0x05, 0x0e, 0xf4, 0x5e, 
+  0x31, 0x16, 0x30, 0x22, 0x57, 0x79, 0x13, 0x85, 0x9b, 0xeb, 0x51, 0xb4, 0xe9, 0x00, 0x6a, 0x4a, 
+  0x74, 0x80, 0xc1, 0xa8, 0xdc, 0xeb, 0xfe, 0xb9, 0xf2, 0xf5, 0x31, 0xa5, 0x52, 0x75, 0x28, 0x74, 
+  0x5d, 0x1e, 0xcc, 0x15, 0x25, 0xae, 0x5b, 0xde, 0xa9, 0x50, 0x36, 0xde, 0x07, 0x32, 0x51, 0x29, 
+  0x03, 0x1d, 0x98, 0xfd, 0xb5, 0x8a, 0x8e, 0x18, 0x79, 0x26, 0x6d, 0x96, 0x67, 0x12, 0x42, 0xfd, 
+  0x90, 0x46, 0xec, 0x6b, 0x44, 0x25, 0x38, 0x44, 0xa5, 0x4a, 0x90, 0xa3, 0x22, 0xdc, 0x13, 0x1f, 
+  0x79, 0x5d, 0xea, 0xb0, 0x39, 0x72, 0x2e, 0xfc, 0x07, 0x7a, 0x19, 0xa8, 0xaf, 0x23, 0x0f, 0xe1, 
+  0x98, 0x4c, 0x63, 0x2a, 0x9f, 0x15, 0xd5, 0xc8, 0x17, 0x3f, 0x99, 0x02, 0x51, 0xd5, 0x1a, 0xdb, 
+  0x52, 0x9e, 0x97, 0xe2, 0x9c, 0x2d, 0x9d, 0x88, 0xb3, 0x8e, 0x34, 0xc8, 0x5f, 0xf3, 0x61, 0xee, 
+  0x51, 0x8d, 0x31, 0xc2, 0xf3, 0x07, 0x0d, 0xf1, 0x67, 0xfc, 0xe9, 0x41, 0x4b, 0xb7, 0xa8, 0x22, 
+  0xb6, 0xfc, 0x1b, 0xf9, 0x40, 0xab, 0x8f, 0x0e, 0xa5, 0xe3, 0xdd, 0xeb, 0x57, 0xdd, 0x09, 0xa0, 
+  0x92, 0x75, 0x41, 0xb8, 0xe1, 0x3c, 0x97, 0x29, 0x9f, 0x39, 0xfa, 0x79, 0x82, 0x9f, 0x60, 0xef, 
+  0xb8, 0x77, 0x2d, 0x40, 0x05, 0x71, 0xe6, 0xd0, 0x81, 0x1a, 0x9b, 0xbe, 0xaf, 0xf3, 0x7b, 0xd4, 
+  0x62, 0x22, 0xc0, 0x3f, 0x33, 0x52, 0xc3, 0xd7, 0x76, 0xe6, 0xc6, 0xb9, 0x4e, 0x36, 0x91, 0x3b, 
+  0x51, 0xec, 0x81, 0x8e, 0x0d, 0x17, 0x30, 0x7e, 0x6e, 0xf2, 0x37, 0x07, 0xf5, 0x14, 0xf4, 0x8c, 
+  0xbc, 0xe9, 0x82, 0x9f, 0xd5, 0x66, 0x82, 0xd3, 0xd7, 0x27, 0x95, 0xab, 0x59, 0xe2, 0x7a, 0xdd, 
+  0xe5, 0x44, 0xf3, 0x8c, 0xab, 0x59, 0x19, 0x04, 0xe3, 0x3c, 0xf4, 0x1b, 0x89, 0xca, 0x68, 0x20, 
+  0x5d, 0x84, 0xd3, 0x48, 0x55, 0x25, 0x57, 0xb6, 0x12, 0x1d, 0xcf, 0x87, 0xab, 0x30, 0x59, 0x8a, 
+  0x51, 0x81, 0x16, 0xf9, 0x79, 0x8b, 0x22, 0x0b, 0x43, 0x6c, 0x3a, 0x11, 0x8c, 0x75, 0xea, 0x78, 
+  0xe6, 0x67, 0xcd, 0xf0, 0x43, 0x15, 0xfc, 0xff, 0xbe, 0x68, 0xf3, 0x1a, 0xed, 0xb8, 0xc0, 0x48, 
+  0xad, 0x2b, 0x10, 0x55, 0x89, 0x65, 0xd9, 0x5b, 0xd7, 0xc0, 0xb3, 0xde, 0xd2, 0x52, 0xc3, 0x69, 
+  0x95, 0x7b, 0xa3, 0x25, 0x71, 0x9b, 0x4e, 0xa6, 0xac, 0xcb, 0x46, 0xa9, 0x8a, 0xbe, 0x75, 0x00, 
+  0xe4, 0x9a, 0xa6, 0x32, 0x3e, 0x02, 0x68, 0xb4, 0x78, 0x00, 0x92, 0x64, 0x2f, 0x6b, 0xbc, 0x3a, 
+  0x7c, 0x1b, 0x25, 0x93, 0x9c, 0xd3, 0x00, 0xed, 0x47, 0x1f, 0x52, 0xb4, 0xe3, 0xf9, 0x9e, 0xdd, 
+  0xd5, 0xa5, 0x39, 0xcc, 0x43, 0x23, 0x28, 0x49, 0x6d, 0x25, 0x53, 0xe8, 0x10, 0x6b, 0x63, 0x4a, 
+  0x95, 0x5a, 0xd2, 0xc6, 0x15, 0xdc, 0x87, 0x1c, 0x95, 0xb4, 0x55, 0xf7, 0xf9, 0xe4, 0xe2, 0xb6, 
+  0x7b, 0x72, 0x15, 0xb4, 0xe0, 0xc3, 0x38, 0x3a, 0x2f, 0xb5, 0xd7, 0x9f, 0x5d, 0xb6, 0x11, 0x3f, 
+  0x8a, 0x0e, 0xef, 0x97, 0x06, 0xe8, 0x5a, 0xff, 0x1d, 0x86, 0x71, 0xfa, 0x38, 0x9b, 0x0a, 0xfe, 
+  0xab, 0x12, 0xe4, 0x30, 0xc0, 0xc4, 0xba, 0x96, 0x71, 0xc6, 0x90, 0xa2, 0xdf, 0x27, 0xc4, 0x9e, 
+  0x99, 0x08, 0x59, 0xef, 0xb4, 0x81, 0x96, 0xd7, 0x76, 0xab, 0xf0, 0xd9, 0xd6, 0x44, 0xeb, 0xd8, 
+  0xea, 0xe0, 0xd1, 0xc8, 0x20, 0x78, 0xa6, 0x0b, 0xc6, 0x5b, 0xbc, 0xc1, 0xa3, 0xca, 0x5e, 0xfb, 
+  0xa6, 0xac, 0xd0, 0x85, 0x2f, 0xdd, 0x54, 0x03, 0xd3, 0x40, 0x1f, 0xc6, 0x3c, 0xf2, 0xdc, 0x5c, 
+  0x37, 0x65, 0x2d, 0x64, 0x95, 0xbb, 0xa9, 0xb5, 0x87, 0x89, 0x9b, 0xe0, 0x6f, 0x19, 0x17, 0x1c, 
+  0xd2, 0xdd, 0x73, 0x3c, 0xa9, 0xdf, 0xba, 0x35, 0xd4, 0x2d, 0x18, 0x24, 0xb2, 0xcb, 0xb0, 0xed, 
+  0xe8, 0xf7, 0xff, 0xc7, 0xdb, 0x9b, 0xb0, 0xb7, 0x6d, 0x64, 0xe9, 0xc2, 0x7f, 0x85, 0xc4, 0xf5, 
+  0x67, 0x03, 0x66, 0x89, 0x92, 0x92, 0xcc, 0x4c, 0x37, 0x28, 0x34, 0x1f, 0x47, 0x5e, 0x13, 0x6f, 
+  0xb1, 0xe5, 0x38, 0x69, 0x9a, 0xed, 0x01, 0x49, 0x48, 0x82, 0x45, 0x01, 0x0a, 0x08, 0x5a, 0x96, 
+  0x25, 0xfe, 0xf7, 0x7b, 0xde, 0x73, 0xaa, 0x0a, 0x85, 0x85, 0xb2, 0x67, 0xb9, 0xdf, 0x4c, 0xc7, 
+  0x22, 0x80, 0xaa, 0x42, 0xa1, 0x96, 0x53, 0x67, 0x7d, 0x4f, 0xbd, 0x63, 0xf5, 0x8c, 0x90, 0x17, 
+  0x35, 0xf4, 0xe6, 0x4e, 0x12, 0x2a, 0x06, 0xff, 0xdb, 0x49, 0x68, 0x1d, 0x04, 0xfa, 0x1b, 0x24, 
+  0xd4, 0x09, 0x70, 0x9b, 0x48, 0xf3, 0x8f, 0xd3, 0x2f, 0x6c, 0xc4, 0x4a, 0xa6, 0x4d, 0x52, 0xda, 
+  0xea, 0xdf, 0x7f, 0x93, 0x94, 0x6e, 0xa1, 0x91, 0x38, 0x62, 0x4c, 0x07, 0xb0, 0x2c, 0x4b, 0x66, 
+  0xfe, 0x1d, 0xef, 0x9c, 0x69, 0x8d, 0x00, 0x7e, 0x3f, 0x81, 0x4b, 0xd8, 0x6d, 0xf6, 0x3b, 0x89, 
+  0x59, 0xc2, 0x28, 0xd3, 0xf6, 0xad, 0x44, 0xac, 0xe2, 0x99, 0xf8, 0x63, 0x77, 0xbb, 0xac, 0x34, 
+  0x88, 0x1e, 0x82, 0xc4, 0xd8, 0x1b, 0xd8, 0x01, 0x3c, 0x18, 0xdb, 0xb0, 0x2a, 0x9a, 0xb7, 0xbd, 
+  0x20, 0x3c, 0x2b, 0x0d, 0x64, 0xa4, 0x01, 0xb7, 0x41, 0x8e, 0x84, 0xf6, 0x4d, 0x86, 0xdf, 0x2b, 
+  0x92, 0xe3, 0xf1, 0x5e, 0xb8, 0xb3, 0x0f, 0x7a, 0xa5, 0x47, 0x27, 0x84, 0x6a, 0x8c, 0xd8, 0xde, 
+  0xf2, 0x7c, 0xf9, 0x38, 0x2f, 0x3c, 0xc5, 0x8b, 0x33, 0x94, 0x35, 0x8a, 0x8a, 0x1e, 0xa6, 0xad, 
+  0xc6, 0x26, 0xf0, 0x01, 0xe3, 0x38, 0x82, 0x18, 0xee, 0x61, 0xcb, 0x27, 0x25, 0x6e, 0xa4, 0xbd, 
+  0x1b, 0x09, 0x5d, 0x03, 0x9c, 0x70, 0xd1, 0x26, 0x4c, 0x8b, 0x3c, 0x52, 0x4a, 0xf8, 0xbf, 0xd5, 
+  0xb7, 0xdb, 0x86, 0xdb, 0x40, 0xd9, 0xa8, 0xfc, 0xbd, 0x6f, 0x69, 0x48, 0x47, 0x7a, 0x96, 0x90, 
+  0xa5, 0x33, 0x89, 0x17, 0xaf, 0xb2, 0xe5, 0x15, 0x42, 0xd1, 0xe2, 0x2f, 0xcf, 0x79, 0x73, 0x20, 
+  0x33, 0x67, 0xb2, 0x5c, 0xea, 0x68, 0x2a, 0x7d, 0xf5, 0x5a, 0x7b, 0x32, 0x50, 0x95, 0xfc, 0x92, 
+  0x1e, 0x65, 0xb8, 0x9f, 0x2f, 0xf5, 0xaf, 0xf5, 0x2a, 0x79, 0x11, 0x23, 0x79, 0xf5, 0x31, 0xbc, 
+  0x38, 0x7e, 0xd6, 0x0e, 0xaa, 0x26, 0xba, 0xe2, 0xd1, 0x42, 0xa0, 0xc3, 0x5d, 0x09, 0x0c, 0x0c, 
+  0x89, 0x5d, 0xc0, 0x8c, 0xd6, 0x52, 0x3b, 0xe5, 0x59, 0xa4, 0x6c, 0xba, 0x2f, 0x52, 0x17, 0x0e, 
+  0x79, 0xfa, 0x2a, 0x35, 0x8f, 0x91, 0x21, 0x6a, 0x19, 0x81, 0xc5, 0x51, 0x91, 0x9d, 0x13, 0xb7, 
+  0x6f, 0x67, 0xb0, 0xfa, 0x3a, 0x39, 0xab, 0x69, 0xd7, 0x2f, 0x6b, 0x18, 0x6a, 0x2f, 0xb5, 0xe8, 
+  0x1d, 0x68, 0xdc, 0x34, 0x92, 0x3b, 0x3e, 0xb2, 0x65, 0xc0, 0x10, 0x11, 0x7d, 0x94, 0x31, 0x3d, 
+  0x58, 0x9b, 0x34, 0x7a, 0x69, 0xf4, 0xb2, 0x94, 0xd8, 0x41, 0x06, 0x4f, 0x74, 0xcc, 0x03, 0x44, 
+  0x52, 0x07, 0x6f, 0x61, 0xf7, 0x00, 0x8c, 0xbe, 0xc9, 0x17, 0x81, 0x94, 0x78, 0x09, 0x49, 0xf2, 
+  0xa8, 0x5d, 0x54, 0xbe, 0xf1, 0x54, 0x34, 0xe7, 0x62, 0x0c, 0xd5, 0x50, 0x0c, 0x22, 0xb9, 0x1a, 
+  0xa5, 0xd8, 0x86, 0xab, 0x88, 0x9a, 0xe1, 0x38, 0x9a, 0xac, 0x99, 0x5b, 0x95, 0x49, 0x2f, 0x7c, 
+  0x78, 0x6b, 0x00, 0x22, 0x3a, 0x28, 0xf1, 0xff, 0xc5, 0xd8, 0x39, 0x4d, 0x7f, 0x63, 0xf8, 0xfa, 
+  0x2d, 0x22, 0x5c, 0x93, 0x1f, 0x41, 0x12, 0x4c, 0xff, 0x81, 0x80, 0xf2, 0xff, 0xc7, 0x80, 0x73, 
+  0x7b, 0x3b, 0xfb, 0x07, 0x5d, 0x03, 0x4f, 0xd3, 0x11, 0x15, 0x16, 0x35, 0xcd, 0xde, 0x57, 0xff, 
+  0x83, 0x69, 0x10, 0xf9, 0xba, 0x31, 0x0d, 0xa9, 0x61, 0x31, 0xaa, 0xf0, 0x8d, 0x14, 0xaa, 0x44, 
+  0x27, 0xb2, 0x23, 0xbf, 0xb9, 0xa9, 0x9f, 0x98, 0xa9, 0x0d, 0x0c, 0x6a, 0x29, 0x23, 0x88, 0x4a, 
+  0xc4, 0xe3, 0x52, 0xf4, 0x8a, 0x76, 0x5d, 0x1b, 0xdd, 0xa2, 0x3b, 0x59, 0x74, 0x0f, 0x0d, 0x8d, 
+  0x6f, 0x9f, 0x5e, 0xa7, 0xcb, 0x7e, 0xda, 0x39, 0xbd, 0x8c, 0x0d, 0x4e, 0x53, 0x1c, 0xde, 0xa6, 
+  0xc9, 0xe2, 0xb8, 0x61, 0x76, 0xc8, 0x10, 0xf5, 0x1c, 0x0b, 0xfc, 0x46, 0xaf, 0x8c, 0x49, 0x86, 
+  0xcf, 0x00, 0x5c, 0x9e, 0x79, 0x5a, 0x90, 0xcd, 0x6c, 0x25, 0xef, 0x04, 0xe0, 0x70, 0xad, 0xdb, 
+  0x49, 0x10, 0x66, 0xd5, 0x87, 0x25, 0x5a, 0x49, 0x68, 0x4f, 0xb4, 0x94, 0x3d, 0xf7, 0x65, 0x4c, 
+  0x24, 0x72, 0x05, 0xab, 0xc8, 0x2e, 0x45, 0x20, 0xe7, 0xdb, 0x44, 0x71, 0xde, 0xc7, 0x8f, 0xf6, 
+  0x18, 0xf8, 0xf8, 0xd1, 0x53, 0x06, 0xe1, 0x74, 0x55, 0xe3, 0x6e, 0x5a, 0xb7, 0xec, 0xf4, 0x26, 
+  0x5a, 0x97, 0x9b, 0xc2, 0x40, 0xe5, 0xaa, 0x8d, 0xeb, 0xed, 0x32, 0x23, 0x14, 0x08, 0xc4, 0x8e, 
+  0xfe, 0xac, 0x2d, 0xa9, 0xff, 0xb4, 0x9e, 0x2e, 0xc2, 0x62, 0x4b, 0xb0, 0xd8, 0xcc, 0x5a, 0x2f, 
+  0xcc, 0x5a, 0x6f, 0xae, 0x70, 0x5a, 0xbb, 0xbe, 0x5e, 0xe5, 0xbc, 0x09, 0x64, 0xa5, 0xdb, 0xd5, 
+  0x6c, 0x37, 0x71, 0xdf, 0xc4, 0x24, 0xf4, 0xf7, 0x0d, 0x1f, 0xf9, 0x80, 0xd8, 0xc3, 0x0f, 0xc5, 
+  0xee, 0x49, 0x5d, 0x32, 0x25, 0xa6, 0xbf, 0xea, 0x9c, 0xe5, 0x58, 0x90, 0xc2, 0xce, 0xe2, 0xfd, 
+  0xd8, 0xe8, 0x86, 0xc6, 0x76, 0x46, 0xe2, 0xc7, 0x2b, 0x6c, 0xc4, 0xee, 0x15, 0x25, 0x3e, 0xab, 
+  0x2d, 0x28, 0x2a, 0x58, 0x4d, 0x45, 0x24, 0x2a, 0x69, 0x20, 0xb3, 0xda, 0x12, 0x33, 0x8b, 0x90, 
+  0x3a, 0xe5, 0x07, 0x34, 0xef, 0xb4, 0x58, 0x23, 0xf8, 0x43, 0x6b, 0x93, 0x4b, 0xb5, 0xe6, 0xc7, 
+  0xe5, 0x00, 0x0f, 0x9a, 0xae, 0xe9, 0x8c, 0x73, 0x29, 0x0e, 0x1e, 0x65, 0x17, 0x2a, 0x99, 0xd6, 
+  0xe9, 0x61, 0xfa, 0x68, 0xb8, 0x3d, 0xd8, 0xc1, 0x58, 0x30, 0xa3, 0xf7, 0x39, 0x3e, 0xce, 0x3a, 
+  0xc7, 0x50, 0xf3, 0x76, 0x37, 0xd6, 0x1e, 0x7b, 0xd2, 0x68, 0x4e, 0xab, 0x70, 0x38, 0xad, 0xa2, 
+  0x5a, 0x76, 0xa5, 0xf2, 0x58, 0xb4, 0xe2, 0xa0, 0x27, 0x6e, 0x4a, 0x24, 0xad, 0x12, 0x6b, 0x84, 
+  0xb6, 0xd1, 0xb8, 0xd1, 0x87, 0xae, 0x0e, 0xdc, 0xf6, 0xf6, 0x93, 0xf6, 0xdb, 0x7d, 0x20, 0x2f, 
+  0xeb, 0x8c, 0x11, 0xfa, 0xdd, 0x5d, 0x3c, 0x37, 0xd0, 0xab, 0xa4, 0x33, 0x00, 0x8b, 0x35, 0xa4, 
+  0xef, 0x41, 0x09, 0x7a, 0x1c, 0xba, 0x83, 0x65, 0x92, 0xec, 0xd5, 0x38, 0x5e, 0xd3, 0x3b, 0x28, 
+  0x14, 0xd9, 0xa6, 0xf6, 0x7d, 0x3c, 0xa0, 0xee, 0x8f, 0x8b, 0x2a, 0xd0, 0x67, 0xc7, 0xe2, 0xb7, 
+  0x88, 0x2f, 0x62, 0xac, 0xb8, 0x84, 0xa3, 0xb8, 0x84, 0xa1, 0xd9, 0xd2, 0xaa, 0x86, 0xf2, 0x33, 
+  0x89, 0x8f, 0x57, 0xcc, 0x62, 0xd7, 0x79, 0x25, 0x90, 0x54, 0xbe, 0xb1, 0xa3, 0x0d, 0xcb, 0x1a, 
+  0x4f, 0x77, 0x15, 0xc5, 0xac, 0x20, 0x08, 0x39, 0x87, 0x4f, 0x3c, 0xce, 0x07, 0xfb, 0xa1, 0x55, 
+  0x75, 0x4b, 0x6c, 0x43, 0x7e, 0xb0, 0x37, 0x5e, 0x87, 0xf4, 0x88, 0xdd, 0x3e, 0xd7, 0xc6, 0x6b, 
+  0xc9, 0xf7, 0x59, 0x8e, 0xb5, 0x09, 0x72, 0xc0, 0x3b, 0x16, 0x9c, 0xbd, 0xf8, 0xee, 0xdd, 0x7e, 
+  0x66, 0x13, 0xee, 0xc0, 0x2b, 0x36, 0x73, 0x59, 0x33, 0xf3, 0x80, 0xe8, 0xc7, 0x4b, 0xdf, 0x7d, 
+  0x82, 0xc8, 0x4f, 0xc9, 0xe1, 0x0c, 0x78, 0x53, 0x41, 0x19, 0x7c, 0x44, 0x5b, 0x4a, 0x76, 0x80, 
+  0xaa, 0xdc, 0xd9, 0x46, 0x5a, 0x3d, 0x59, 0xda, 0x13, 0x66, 0xd5, 0x0e, 0x86, 0xaa, 0x79, 0xdd, 
+  0x34, 0x06, 0x07, 0xbb, 0xe2, 0x2c, 0x31, 0x1b, 0xc5, 0x75, 0x13, 0x8d, 0xa1, 0xdc, 0xf7, 0xd9, 
+  0x45, 0x34, 0x76, 0xbe, 0x2c, 0xaa, 0xe5, 0x06, 0xae, 0xd6, 0xa2, 0x6e, 0x93, 0x57, 0x17, 0x22, 
+  0x98, 0xd9, 0x0d, 0x21, 0x43, 0xd2, 0x3c, 0x57, 0xdc, 0x6d, 0xcc, 0x05, 0x35, 0x46, 0x45, 0x37, 
+  0x9b, 0x1a, 0x57, 0xaa, 0x15, 0x6c, 0x95, 0x56, 0xaf, 0xc1, 0x2d, 0xd6, 0xb6, 0xdf, 0x34, 0xea, 
+  0x56, 0x89, 0xb4, 0xa2, 0x53, 0xac, 0xcc, 0x6a, 0x00, 0x2f, 0xeb, 0xdf, 0x01, 0x0c, 0x08, 0x19, 
+  0xdc, 0x92, 0x53, 0xa7, 0x18, 0x3d, 0x22, 0x0b, 0x01, 0xf5, 0x37, 0x32, 0xf8, 0xc9, 0x56, 0x2a, 
+  0xd2, 0x42, 0x6e, 0xd6, 0xeb, 0x7a, 0xec, 0xe5, 0x19, 0xed, 0x18, 0x9d, 0xb6, 0x34, 0x60, 0x61, 
+  0x43, 0x03, 0xd7, 0x47, 0xf4, 0xc8, 0x60, 0xd8, 0xd3, 0x86, 0x3d, 0xaa, 0xc4, 0xf3, 0x87, 0xa5, 
+  0xb8, 0x99, 0xb7, 0x33, 0x24, 0x60, 0x36, 0x5f, 0x69, 0xc1, 0x5e, 0xd7, 0xe5, 0x3f, 0x37, 0x06, 
+  0xfd, 0x1e, 0x58, 0xf8, 0x24, 0xeb, 0x8f, 0xec, 0xbe, 0xd4, 0xa0, 0x93, 0xea, 0xba, 0x9d, 0xe9, 
+  0xa6, 0x23, 0x12, 0xb2, 0xca, 0x61, 0x18, 0x4d, 0x68, 0x10, 0xce, 0x90, 0xb2, 0xfb, 0xdc, 0xe4, 
+  0xa9, 0xd3, 0xb8, 0xd0, 0x1a, 0x48, 0x3a, 0x4c, 0xd4, 0xa9, 0xf3, 0xcc, 0xe2, 0x94, 0x73, 0x81, 
+  0x2a, 0x7f, 0x58, 0x95, 0x7d, 0x90, 0x36, 0x18, 0x78, 0x80, 0x3c, 0x3a, 0x8e, 0xe2, 0x88, 0x41, 
+  0x78, 0xce, 0x14, 0x24, 0xdf, 0xac, 0x11, 0x81, 0xeb, 0x5e, 0xf7, 0x5f, 0x69, 0x51, 0xef, 0x62, 
+  0xd0, 0xca, 0x0b, 0x8a, 0x95, 0x46, 0xb3, 0x79, 0x51, 0x31, 0x6f, 0x43, 0xf6, 0x3a, 0xb9, 0x88, 
+  0xfc, 0xd3, 0xe8, 0xc2, 0x79, 0x31, 0x0c, 0xc9, 0xf0, 0x35, 0x80, 0x0b, 0x89, 0x64, 0x40, 0x84, 
+  0xc3, 0x83, 0x53, 0x2f, 0x14, 0x3e, 0x1b, 0x53, 0x35, 0xb8, 0x50, 0x44, 0x06, 0x6f, 0xc9, 0x5d, 
+  0x74, 0xa1, 0x3a, 0xbd, 0x0e, 0x48, 0xfe, 0xa4, 0xf7, 0xd8, 0x3c, 0xbd, 0x51, 0x31, 0xfe, 0x21, 
+  0xfc, 0x51, 0x39, 0x03, 0x11, 0x39, 0xf9, 0x34, 0xe9, 0x7e, 0x95, 0x61, 0x2d, 0x72, 0x0a, 0x8d, 
+  0xff, 0x9b, 0x59, 0x14, 0x45, 0x59, 0x64, 0x12, 0xf2, 0x68, 0x13, 0x87, 0x32, 0x29, 0x62, 0x04, 
+  0x7f, 0x5f, 0xf2, 0xbe, 0xe0, 0x7c, 0xb6, 0x30, 0x81, 0x93, 0x64, 0x1a, 0xd6, 0x28, 0x81, 0x62, 
+  0xc7, 0x91, 0xe5, 0xb6, 0xbc, 0x90, 0x92, 0x36, 0x51, 0x4f, 0x80, 0x4d, 0x89, 0xa7, 0xaf, 0x2b, 
+  0xa0, 0x34, 0x4d, 0xbb, 0x00, 0xc9, 0x40, 0xc5, 0x4d, 0x66, 0x27, 0xa0, 0xf7, 0x31, 0x78, 0xaa, 
+  0x80, 0x44, 0x2f, 0x6b, 0xa9, 0x25, 0x91, 0x0b, 0xd5, 0x4c, 0xf5, 0x6a, 0x70, 0x81, 0xa3, 0x31, 
+  0x8f, 0x72, 0x87, 0x34, 0x06, 0xa3, 0x7c, 0xd4, 0xb8, 0xb3, 0x30, 0xc9, 0xc2, 0x91, 0x43, 0x72, 
+  0x14, 0x73, 0x6c, 0x70, 0x1d, 0xa5, 0x8c, 0x56, 0x18, 0xc0, 0x6f, 0xa5, 0x5c, 0xec, 0x62, 0x96, 
+  0xc1, 0x4d, 0x4d, 0x9a, 0x7a, 0x4f, 0xab, 0x20, 0xa7, 0xeb, 0xa3, 0x60, 0xc3, 0x88, 0x6b, 0x92, 
+  0x59, 0x6f, 0x31, 0x49, 0x75, 0x42, 0xbd, 0x64, 0x7b, 0x7e, 0xbe, 0x28, 0x37, 0x39, 0x0a, 0xf6, 
+  0x0f, 0xd2, 0xf1, 0x2a, 0x5c, 0xda, 0xf4, 0x98, 0xf8, 0x1c, 0xdf, 0xa6, 0x3a, 0xcc, 0xbf, 0x99, 
+  0xe7, 0x50, 0x9a, 0x99, 0x9a, 0xc4, 0x4e, 0xb9, 0xc1, 0x42, 0x67, 0xd7, 0x83, 0xb9, 0x1e, 0xd9, 
+  0x1c, 0xac, 0x36, 0x70, 0x7e, 0xef, 0xde, 0xcd, 0x11, 0x10, 0x6a, 0x9f, 0xdc, 0xbd, 0xfb, 0x55, 
+  0xdc, 0x80, 0xed, 0x02, 0xa8, 0x55, 0xb1, 0x29, 0x88, 0x4c, 0x92, 0xa7, 0x66, 0x86, 0x9a, 0xca, 
+  0xed, 0x59, 0xbe, 0xe6, 0x02, 0x13, 0x9d, 0x74, 0xa4, 0xbd, 0x81, 0xc5, 0x6d, 0x69, 0x1d, 0x50, 
+  0x74, 0xee, 0xc0, 0xea, 0x86, 0x7e, 0x29, 0x8d, 0x37, 0xdb, 0xda, 0x10, 0x40, 0xdd, 0x07, 0x5e, 
+  0xee, 0xcd, 0x0d, 0x75, 0x99, 0x56, 0x06, 0xd2, 0x56, 0xea, 0x55, 0x40, 0x9d, 0x05, 0xe6, 0x96, 
+  0x7c, 0x86, 0x8f, 0xbf, 0xbc, 0x28, 0xab, 0xfc, 0xab, 0x76, 0x97, 0x47, 0x08, 0xda, 0xe9, 0x9e, 
+  0x02, 0xe4, 0xdf, 0xec, 0xc8, 0x19, 0xfb, 0x10, 0x2a, 0x6c, 0x7a, 0x17, 0x67, 0x90, 0xde, 0x5e, 
+  0xb3, 0x2b, 0xf3, 0x94, 0x54, 0x6e, 0xf7, 0x41, 0x6f, 0xa8, 0xd8, 0xf4, 0x35, 0x66, 0xd0, 0x4e, 
+  0x9b, 0x24, 0x70, 0xa5, 0xd3, 0xde, 0x74, 0x2b, 0xfc, 0x2a, 0xf7, 0x5b, 0x87, 0x8e, 0x10, 0xe5, 
+  0xbd, 0xd6, 0x54, 0xb4, 0x96, 0xa5, 0x68, 0x6f, 0x83, 0x4c, 0x9d, 0xf5, 0xc4, 0xd5, 0x85, 0xc0, 
+  0x46, 0x96, 0x41, 0x0b, 0xd8, 0xb7, 0x8b, 0xa6, 0x7f, 0xcb, 0x0c, 0x54, 0x6f, 0x1b, 0x1d, 0xb5, 
+  0xf0, 0xaa, 0xfa, 0xe6, 0xd3, 0x56, 0x82, 0xf2, 0xba, 0x6b, 0x30, 0x84, 0x00, 0xc6, 0x7a, 0xb6, 
+  0x9e, 0x51, 0xed, 0x36, 0x33, 0x06, 0x14, 0x76, 0x8f, 0x3b, 0x89, 0x99, 0xfc, 0xaf, 0xe5, 0x6f, 
+  0x69, 0xba, 0xf0, 0x24, 0x4e, 0x6e, 0x13, 0x3d, 0x66, 0xb0, 0x7c, 0x9a, 0x54, 0x58, 0xf5, 0x5c, 
+  0xa3, 0x36, 0xe5, 0xb6, 0x25, 0x63, 0x45, 0x57, 0xe6, 0x17, 0x37, 0xfb, 0x51, 0x9d, 0x78, 0xf0, 
+  0xbd, 0x45, 0xed, 0x92, 0x9d, 0x32, 0xac, 0xf3, 0x1e, 0x8c, 0xa2, 0xd8, 0x29, 0xad, 0x45, 0x98, 
+  0x21, 0xe1, 0xf9, 0x1e, 0x5c, 0xf0, 0xaa, 0xb2, 0x0a, 0x89, 0x7d, 0xf7, 0x82, 0xc1, 0x3e, 0x23, 
+  0x28, 0x4b, 0x06, 0xd8, 0xff, 0xb5, 0x7e, 0xec, 0xec, 0x8f, 0x90, 0x6f, 0xdd, 0x79, 0x5b, 0x19, 
+  0x84, 0x7e, 0x77, 0x7a, 0xb5, 0xaa, 0x73, 0xd6, 0x3f, 0xb0, 0x08, 0x38, 0x18, 0x8e, 0x05, 0xc3, 
+  0x4f, 0x65, 0x74, 0x34, 0x5c, 0xe6, 0x73, 0x09, 0xfb, 0xf8, 0x0b, 0x09, 0xcb, 0x91, 0x5c, 0xda, 
+  0x89, 0x96, 0x52, 0x2f, 0x20, 0x3b, 0x8e, 0xc1, 0x64, 0xb0, 0xb6, 0xf6, 0x8f, 0x17, 0xcf, 0xdb, 
+  0x88, 0x91, 0xac, 0xf2, 0x81, 0xb5, 0xb9, 0xe9, 0x74, 0x64, 0xc1, 0x5f, 0xb1, 0xa8, 0x19, 0x8f, 
+  0xb5, 0x8c, 0x78, 0x67, 0x1c, 0x0d, 0x1f, 0xbe, 0x7a, 0xf1, 0x1a, 0x0d, 0x16, 0x81, 0x34, 0xfc, 
+  0xb8, 0xc8, 0xcf, 0xdf, 0x72, 0x75, 0xe6, 0x3e, 0x68, 0xd5, 0xef, 0x7e, 0x39, 0x5f, 0x7a, 0x41, 
+  0x05, 0xb6, 0x6a, 0xcd, 0xf9, 0x95, 0xe6, 0xb5, 0xcf, 0xb1, 0xac, 0xda, 0xa6, 0xbb, 0xfa, 0xf9, 
+  0xea, 0x28, 0x3e, 0x81, 0xa4, 0xe4, 0x7b, 0xdc, 0x64, 0x91, 0x14, 0x45, 0x5e, 0x38, 0xee, 0xca, 
+  0xb4, 0x46, 0x70, 0xc7, 0xf7, 0x9e, 0x65, 0xc4, 0xa3, 0x51, 0x5b, 0xf4, 0x35, 0x21, 0x04, 0x70, 
+  0x18, 0xbe, 0x78, 0x40, 0x9e, 0xe3, 0x6b, 0x27, 0x1f, 0xa6, 0x77, 0x76, 0xd5, 0x6b, 0x16, 0x9a, 
+  0xc7, 0x1f, 0xb2, 0xdd, 0x13, 0xf5, 0x46, 0xb3, 0x61, 0xab, 0xf5, 0xec, 0x3c, 0x2d, 0xb5, 0xe5, 
+  0xe5, 0x26, 0x3d, 0x8f, 0x4f, 0x92, 0x1b, 0xa2, 0x0c, 0x74, 0xec, 0x1e, 0xa7, 0xcb, 0x84, 0x4d, 
+  0x31, 0x3f, 0xdf, 0x6a, 0xb3, 0x39, 0x4b, 0xae, 0x4e, 0x92, 0x2c, 0x70, 0xed, 0x33, 0xcf, 0x00, 
+  0x05, 0x9e, 0x54, 0xf9, 0xa5, 0xcb, 0x76, 0xe4, 0x35, 0xad, 0x6f, 0xbd, 0x9f, 0x9a, 0xf6, 0x7b, 
+  0x22, 0xde, 0xcf, 0xf5, 0x51, 0x4a, 0x22, 0x73, 0xca, 0x27, 0x72, 0x88, 0x16, 0x07, 0xde, 0xc4, 
+  0x1b, 0xf8, 0x1d, 0xec, 0x0b, 0x44, 0x65, 0x23, 0x78, 0x91, 0x58, 0x08, 0xd6, 0x62, 0xea, 0xa9, 
+  0x52, 0xd0, 0x6c, 0xb4, 0x8a, 0x05, 0x61, 0x63, 0x34, 0x9b, 0x55, 0x6a, 0x19, 0xde, 0x62, 0x68, 
+  0x3d, 0x69, 0x7a, 0x6a, 0x25, 0x81, 0x7d, 0x5b, 0xc9, 0x2d, 0xc1, 0x4e, 0x60, 0xa0, 0x71, 0x68, 
+  0x16, 0xe2, 0xf3, 0x46, 0x52, 0xbf, 0x0a, 0xda, 0xcc, 0x25, 0x35, 0xe0, 0xdf, 0xc7, 0x74, 0x3c, 
+  0x85, 0xf4, 0xf5, 0x13, 0x23, 0x9f, 0x4c, 0xa3, 0x24, 0x43, 0x2e, 0xae, 0x77, 0x6f, 0x9e, 0x01, 
+  0x96, 0x8d, 0x44, 0x39, 0x86, 0x43, 0x1b, 0x78, 0x11, 0x4d, 0x59, 0xfb, 0x89, 0x70, 0x3a, 0x19, 
+  0xa4, 0xd6, 0x4c, 0x63, 0x92, 0x91, 0x24, 0x24, 0x8c, 0xa8, 0x96, 0x68, 0x03, 0x83, 0xb1, 0xd3, 
+  0x35, 0xc6, 0xd8, 0xdd, 0x9f, 0xfe, 0x5a, 0x27, 0x05, 0x1d, 0xb2, 0xec, 0x0e, 0xfe, 0x7a, 0x19, 
+  0xa7, 0x99, 0x76, 0xf9, 0xeb, 0x9c, 0x82, 0xe0, 0x5a, 0x63, 0x25, 0x82, 0xa9, 0x53, 0x95, 0x7c, 
+  0x6f, 0x07, 0xd2, 0xba, 0xea, 0xf2, 0x30, 0x11, 0xf5, 0x82, 0xe7, 0x3b, 0x4e, 0x8b, 0xca, 0x5d, 
+  0x50, 0xd8, 0xbd, 0xbb, 0x5e, 0xd0, 0x70, 0xa8, 0xa4, 0xe5, 0x4b, 0x64, 0xac, 0x1b, 0xca, 0x4f, 
+  0x8f, 0xac, 0xaf, 0xf5, 0x55, 0xba, 0xa0, 0x7c, 0x47, 0xc0, 0x50, 0x19, 0xee, 0xad, 0x8e, 0x06, 
+  0xba, 0xf0, 0xa2, 0x85, 0x26, 0x69, 0xb3, 0xbd, 0xce, 0xd8, 0xac, 0x37, 0x96, 0xe7, 0x04, 0x4b, 
+  0xb9, 0x3c, 0x64, 0x22, 0x9a, 0xc0, 0x4d, 0x60, 0x3c, 0x3b, 0xbb, 0x49, 0x1c, 0x56, 0x5e, 0x2d, 
+  0x70, 0x1c, 0xc3, 0x85, 0x31, 0xd6, 0x3a, 0x9f, 0x74, 0x45, 0x6c, 0xb9, 0x11, 0x94, 0xc1, 0xd6, 
+  0xff, 0x6c, 0x7c, 0xfd, 0x5c, 0xe5, 0x0b, 0xd8, 0x89, 0x37, 0x65, 0x85, 0x0f, 0x2d, 0x4f, 0xe7, 
+  0x26, 0x1d, 0x43, 0x7f, 0x61, 0xb1, 0xa3, 0x69, 0xf8, 0xeb, 0x1f, 0xe7, 0x06, 0xac, 0xb9, 0x7a, 
+  0xa6, 0x3a, 0xbc, 0xa1, 0xf8, 0x0e, 0x34, 0x34, 0x4b, 0x59, 0x30, 0x16, 0xad, 0x52, 0xd6, 0xa1, 
+  0x55, 0xba, 0xc6, 0x87, 0x84, 0xa5, 0x4c, 0xbf, 0x4e, 0x94, 0x6a, 0x75, 0x29, 0xaf, 0x4b, 0xe5, 
+  0x7d, 0x28, 0x3e, 0x64, 0xc8, 0xd3, 0x19, 0x84, 0x1d, 0x45, 0xb3, 0xee, 0xa2, 0x02, 0x3d, 0x6c, 
+  0x28, 0xf4, 0x53, 0x22, 0x27, 0xff, 0xdf, 0x0f, 0x7b, 0x44, 0x83, 0x1e, 0xd3, 0xaf, 0xff, 0x33, 
+  0xbc, 0x4f, 0x94, 0xe9, 0x0e, 0xfd, 0xf2, 0x27, 0xe3, 0xbb, 0xd3, 0xe0, 0x63, 0x34, 0xf9, 0xd7, 
+  0xdd, 0xe9, 0xfd, 0x5d, 0xf5, 0x9e, 0xa9, 0xce, 0xf0, 0xfe, 0x98, 0x24, 0xaf, 0xde, 0x87, 0x72, 
+  0x7a, 0xdf, 0x9f, 0xfc, 0x0b, 0x2d, 0x4e, 0xef, 0x13, 0x51, 0x3a, 0x39, 0x57, 0xbf, 0x6b, 0xaa, 
+  0xf4, 0xe4, 0xd1, 0xd1, 0xcd, 0xd3, 0x47, 0x0f, 0x1e, 0x22, 0xc4, 0xf7, 0x1d, 0xee, 0x7d, 0xd8, 
+  0xfd, 0xb0, 0xbb, 0xab, 0x7e, 0x01, 0xea, 0xa0, 0xfa, 0xca, 0xff, 0x3e, 0x29, 0x23, 0xef, 0xfe, 
+  0xae, 0x67, 0x62, 0x4d, 0xbd, 0xfb, 0x24, 0xc3, 0xfc, 0xd1, 0xe1, 0x40, 0x13, 0xbb, 0xe0, 0xbd, 
+  0x7f, 0xc2, 0xf5, 0xd4, 0xac, 0xae, 0xfa, 0xb8, 0xb7, 0x0f, 0x05, 0xd6, 0xd5, 0xc1, 0x13, 0x15, 
+  0x6d, 0x8f, 0x5c, 0x9f, 0x82, 0x86, 0x8e, 0xab, 0x66, 0x13, 0xb6, 0xb6, 0x8a, 0x86, 0x57, 0x81, 
+  0x37, 0x60, 0xd0, 0x1c, 0x62, 0x54, 0xc6, 0x08, 0xc8, 0xb5, 0xa8, 0x2a, 0x44, 0xc0, 0xee, 0x7b, 
+  0xca, 0xcf, 0x4d, 0xc0, 0x9a, 0x18, 0xbc, 0xab, 0x28, 0x21, 0x3a, 0x33, 0x1b, 0xcf, 0x8c, 0x9a, 
+  0xc5, 0x41, 0x99, 0x2d, 0x39, 0xd9, 0x50, 0x0e, 0x2c, 0x6a, 0xf4, 0x73, 0x85, 0x01, 0x5a, 0x47, 
+  0x25, 0xbd, 0xf0, 0x6b, 0x59, 0x7d, 0xfd, 0xdc, 0x9c, 0x84, 0x16, 0x30, 0x13, 0x10, 0x8d, 0xe2, 
+  0x7c, 0xc9, 0x34, 0xa3, 0x9c, 0xe8, 0xc4, 0xe6, 0x9d, 0x6c, 0x96, 0x2f, 0x6f, 0x18, 0x6d, 0xf1, 
+  0xdc, 0xcd, 0x18, 0x92, 0x09, 0x31, 0x4e, 0xe3, 0xf5, 0xb8, 0xef, 0x17, 0x24, 0xd7, 0x69, 0xa5, 
+  0x5c, 0xe8, 0xa7, 0x9c, 0x88, 0x1b, 0x62, 0x48, 0xe5, 0x66, 0x4f, 0x62, 0x1f, 0x60, 0xa0, 0x38, 
+  0x02, 0x15, 0xce, 0x04, 0x26, 0xcc, 0xd2, 0x2d, 0x8c, 0xa8, 0x41, 0xda, 0x33, 0x12, 0x3e, 0x4c, 
+  0xc2, 0x05, 0x4f, 0xb3, 0x83, 0x16, 0x5b, 0x36, 0xa2, 0x15, 0xe1, 0xa6, 0xf3, 0x29, 0xfe, 0xf2, 
+  0x36, 0x29, 0x4b, 0xea, 0xdb, 0x6a, 0x78, 0x4c, 0xec, 0x98, 0x0e, 0x2b, 0xb5, 0x29, 0xd9, 0x33, 
+  0xc1, 0xba, 0xae, 0x92, 0x00, 0x52, 0x8f, 0xc1, 0xfb, 0xa7, 0xe8, 0x79, 0x12, 0x92, 0x9c, 0xcc, 
+  0x88, 0xeb, 0x18, 0x73, 0x4e, 0x35, 0x6d, 0x11, 0x18, 0x9d, 0x0c, 0xa4, 0x48, 0xe2, 0x08, 0xb4, 
+  0xb7, 0x64, 0xf3, 0x47, 0xc9, 0x36, 0xde, 0xe8, 0x93, 0xfc, 0x75, 0x3d, 0x97, 0xe6, 0xc0, 0x67, 
+  0x0e, 0xf7, 0xd4, 0x32, 0x5e, 0x95, 0x2f, 0xf2, 0x45, 0x7a, 0x9c, 0x12, 0x37, 0x8d, 0x00, 0x80, 
+  0x32, 0xe6, 0x48, 0x59, 0xb7, 0xa7, 0xe1, 0xf5, 0xba, 0x58, 0x86, 0xa6, 0x11, 0xe6, 0xc2, 0x3d, 
+  0xda, 0x04, 0x1e, 0x71, 0xe2, 0xcf, 0x89, 0xef, 0x59, 0x86, 0xe2, 0x37, 0x31, 0x23, 0x66, 0xf4, 
+  0x86, 0x44, 0x1a, 0xfc, 0xb7, 0xb3, 0x2a, 0xf3, 0x02, 0x27, 0xfb, 0x70, 0xb0, 0xc3, 0xef, 0x04, 
+  0x2c, 0x1e, 0x1f, 0xf0, 0x38, 0xeb, 0x6f, 0x2e, 0xd3, 0x05, 0x27, 0x51, 0xbd, 0xb3, 0x2b, 0xf4, 
+  0xe6, 0x93, 0x0e, 0xba, 0x9f, 0xe7, 0x24, 0xd2, 0x48, 0xb2, 0x20, 0x4e, 0xe8, 0x58, 0xe4, 0xe0, 
+  0xcf, 0x38, 0x23, 0x09, 0x5d, 0xc6, 0xab, 0xab, 0x6c, 0xae, 0x73, 0x2d, 0xc3, 0x4e, 0xca, 0xf9, 
+  0xf8, 0x80, 0xa6, 0x4e, 0xab, 0x95, 0xb9, 0xaf, 0xdd, 0x2f, 0x3b, 0x97, 0x97, 0x97, 0x3b, 0x34, 
+  0x90, 0xe7, 0x3b, 0xd4, 0x65, 0x39, 0xdf, 0x16, 0xa3, 0x1e, 0x12, 0x2e, 0x02, 0xe2, 0xe5, 0xdd, 
+  0xd1, 0xe3, 0x9d, 0xbf, 0x79, 0x0a, 0x5c, 0x1f, 0x62, 0x85, 0x39, 0xa0, 0xef, 0x49, 0x29, 0xf9, 
+  0x39, 0x84, 0x5d, 0xba, 0xc0, 0x71, 0xe5, 0x09, 0xb6, 0xbf, 0xdc, 0xc1, 0x4f, 0x4f, 0x7d, 0xc1, 
+  0x75, 0xed, 0x4d, 0xe7, 0x4b, 0xd5, 0xb3, 0x1c, 0x96, 0xfa, 0xb4, 0x62, 0x24, 0x4e, 0xa7, 0x00, 
+  0xee, 0xe8, 0x12, 0x9f, 0xe2, 0xcf, 0xb1, 0xce, 0xb3, 0xb2, 0x31, 0x7d, 0xa7, 0xb7, 0xa3, 0xcd, 
+  0xdd, 0x0f, 0x33, 0xfa, 0xf3, 0x61, 0xb6, 0x2b, 0xaf, 0xa4, 0x4b, 0xfc, 0xdd, 0x95, 0xf6, 0xe8, 
+  0x0a, 0x7f, 0xe9, 0x29, 0x4c, 0x92, 0x2b, 0x3a, 0xa2, 0x89, 0xc5, 0x4b, 0x93, 0xe5, 0x42, 0x57, 
+  0xf6, 0xcc, 0x4d, 0x62, 0xc1, 0x3c, 0xfd, 0x15, 0xe6, 0x16, 0xb0, 0x60, 0x4d, 0xb7, 0xcc, 0xbd, 
+  0x5f, 0xde, 0xbe, 0x7a, 0x29, 0x3d, 0xf8, 0x9c, 0x14, 0xa5, 0x0e, 0x69, 0xe4, 0x2e, 0x7a, 0xa1, 
+  0xb0, 0x8d, 0xc2, 0x34, 0xf6, 0xf8, 0x9b, 0x31, 0xd0, 0x72, 0x89, 0x56, 0xbc, 0x10, 0xb5, 0x85, 
+  0xcd, 0xd4, 0xb7, 0xf1, 0xe1, 0x61, 0xc5, 0xd2, 0x92, 0x18, 0x52, 0x2d, 0x68, 0x59, 0x32, 0x66, 
+  0xaa, 0xbe, 0x00, 0xa3, 0x6e, 0x63, 0x17, 0xd5, 0x7a, 0x8b, 0x27, 0x4a, 0x39, 0xa6, 0x3d, 0xc3, 
+  0xdb, 0xa6, 0xbe, 0x53, 0x20, 0x1a, 0x87, 0xbf, 0x41, 0xbd, 0xed, 0xde, 0xe5, 0xd4, 0x2a, 0xb8, 
+  0x51, 0x65, 0x2f, 0x22, 0x0a, 0xfa, 0x0b, 0xb4, 0xb3, 0x74, 0xf3, 0xa8, 0x88, 0x33, 0xfa, 0xea, 
+  0xa2, 0xc4, 0xcd, 0xaf, 0xfa, 0x66, 0xe3, 0xb5, 0x5b, 0x14, 0x53, 0x9a, 0xb0, 0x1a, 0xf7, 0xfe, 
+  0x32, 0x2a, 0x79, 0x7b, 0x62, 0x1f, 0xb3, 0xa6, 0x8f, 0x64, 0x35, 0x92, 0xf8, 0xd5, 0xa9, 0xfa, 
+  0xcc, 0x64, 0xed, 0xa4, 0xda, 0xd7, 0xeb, 0x0b, 0x1d, 0x1b, 0x71, 0x1e, 0x9d, 0x0c, 0xf5, 0x97, 
+  0xdf, 0xdc, 0x9c, 0xa8, 0x59, 0x75, 0x49, 0xcd, 0xbb, 0xf0, 0x1d, 0xe7, 0x9a, 0x5b, 0xa2, 0x13, 
+  0xd2, 0x3f, 0x07, 0x6c, 0x8f, 0x28, 0x1f, 0xaf, 0x6a, 0xf0, 0x00, 0xea, 0x92, 0x2e, 0x0f, 0xe3, 
+  0xe5, 0x12, 0x08, 0x70, 0x08, 0xf9, 0xc8, 0xe6, 0x49, 0xef, 0x9c, 0x64, 0x91, 0x02, 0x71, 0x68, 
+  0x5f, 0xa8, 0xf1, 0x55, 0x19, 0x97, 0xeb, 0xd5, 0x21, 0x67, 0xba, 0x67, 0xe8, 0x21, 0x40, 0xf9, 
+  0x09, 0x9d, 0xf5, 0x24, 0x0b, 0x2c, 0x31, 0x05, 0xea, 0x30, 0xba, 0x86, 0xff, 0xc2, 0xd5, 0xdb, 
+  0x12, 0xb2, 0x37, 0x67, 0x5d, 0x7f, 0xa3, 0x97, 0xc6, 0x53, 0xba, 0xdf, 0x95, 0xd5, 0x9b, 0x13, 
+  0xb2, 0x19, 0x80, 0x4c, 0xc9, 0x2e, 0x47, 0x43, 0x51, 0x46, 0xef, 0x4b, 0x09, 0x64, 0x5d, 0x04, 
+  0x1c, 0x2d, 0xd0, 0x4a, 0x27, 0x01, 0xbb, 0xda, 0x34, 0xf2, 0xb7, 0x3e, 0xaa, 0x41, 0x31, 0x94, 
+  0x93, 0x1f, 0x90, 0xff, 0x83, 0xce, 0x9f, 0xa4, 0xa3, 0xe8, 0xa6, 0xc6, 0x60, 0x94, 0xc2, 0x60, 
+  0x94, 0x9a, 0xe7, 0x53, 0x70, 0xbb, 0xc2, 0x87, 0x3c, 0x58, 0x2e, 0xeb, 0xdf, 0xd2, 0x05, 0x1f, 
+  0x7d, 0x3a, 0x5e, 0x84, 0xd6, 0x7f, 0xe4, 0x8d, 0x00, 0x6a, 0xb4, 0xbe, 0xdc, 0x59, 0x90, 0xf2, 
+  0x4a, 0x49, 0xda, 0xb6, 0x6a, 0x76, 0x6e, 0xda, 0x71, 0x8b, 0xd8, 0x5f, 0x15, 0xe3, 0xd8, 0xd2, 
+  0x09, 0xa0, 0x37, 0x0a, 0x31, 0x6f, 0x45, 0xba, 0x48, 0x5e, 0xa4, 0xe7, 0x92, 0x4a, 0x74, 0xab, 
+  0x46, 0xfc, 0x94, 0x63, 0xd8, 0xce, 0x75, 0xb9, 0x28, 0x31, 0x2d, 0x54, 0x73, 0xdb, 0x3d, 0x3d, 
+  0x1c, 0xf6, 0x7e, 0x1a, 0x1c, 0x9a, 0x88, 0xbd, 0x64, 0x72, 0xa8, 0xd7, 0xc3, 0xb4, 0x2d, 0x68, 
+  0xc0, 0xfb, 0x29, 0x9a, 0xe0, 0x5f, 0x16, 0x32, 0xa6, 0xf5, 0xc4, 0x29, 0x44, 0xc2, 0x8b, 0x4e, 
+  0xbf, 0x1a, 0x3a, 0x3d, 0x4d, 0xc9, 0xe5, 0xdd, 0xbb, 0xcb, 0x21, 0x17, 0x64, 0x28, 0x47, 0x60, 
+  0xa0, 0x99, 0xb0, 0x7d, 0xe6, 0x2e, 0x2c, 0x56, 0xc3, 0x21, 0x51, 0xf2, 0x21, 0x51, 0x81, 0xc8, 
+  0xf7, 0xa9, 0x3e, 0xff, 0xbc, 0xb9, 0xd1, 0x87, 0x48, 0x00, 0x27, 0x50, 0xcb, 0xba, 0xbd, 0x2b, 
+  0x95, 0x73, 0x00, 0x0c, 0xbc, 0xdd, 0x5d, 0x0f, 0x75, 0x59, 0xb7, 0x56, 0x0e, 0xcf, 0x93, 0xf2, 
+  0x34, 0x27, 0xe6, 0xb4, 0xd4, 0x09, 0xe1, 0x4e, 0xec, 0x1d, 0x29, 0x42, 0x25, 0xed, 0x91, 0x1c, 
+  0xf9, 0xd5, 0x05, 0xf3, 0x2e, 0xc1, 0x76, 0x66, 0xc8, 0xf3, 0x4c, 0x40, 0x29, 0x6d, 0xce, 0x22, 
+  0xa7, 0x63, 0x26, 0x3f, 0x27, 0xe2, 0x8f, 0xec, 0x85, 0x9d, 0x7c, 0x1a, 0x24, 0xef, 0x42, 0xce, 
+  0x53, 0xfe, 0x18, 0xa5, 0x2f, 0xe4, 0x8f, 0xaa, 0x35, 0x12, 0xfd, 0xd1, 0xf8, 0x9e, 0x01, 0x8e, 
+  0xe2, 0x7c, 0x55, 0x22, 0xfc, 0xac, 0xfe, 0xa0, 0xe0, 0xfb, 0x95, 0x84, 0x5e, 0x6f, 0x07, 0x64, 
+  0x93, 0x46, 0x55, 0xbe, 0x0a, 0x41, 0xaf, 0xce, 0x91, 0x58, 0xa5, 0x48, 0xb4, 0x6c, 0x8e, 0x29, 
+  0xa7, 0x2b, 0x44, 0x46, 0xc8, 0x91, 0x4b, 0x8c, 0x29, 0xac, 0x46, 0x98, 0xdc, 0x18, 0x11, 0xa2, 
+  0xbf, 0x82, 0x5e, 0xaa, 0x13, 0x92, 0xa6, 0x68, 0xb2, 0xac, 0x7f, 0xc9, 0xa1, 0x4d, 0xa5, 0xe1, 
+  0x7f, 0x36, 0x9a, 0x6d, 0xbc, 0x5a, 0xce, 0x65, 0x22, 0x90, 0x7b, 0x08, 0x5e, 0x15, 0x0e, 0x62, 
+  0x30, 0x60, 0xc6, 0xa3, 0xa6, 0xce, 0xf2, 0x98, 0x1a, 0xc2, 0xc3, 0xbf, 0x9a, 0x46, 0xf9, 0x53, 
+  0x47, 0xef, 0xa3, 0x67, 0x30, 0xf0, 0xeb, 0x2c, 0x3e, 0xfd, 0xdf, 0xb5, 0x5c, 0x22, 0x45, 0x91, 
+  0x3a, 0x8e, 0x87, 0xd9, 0xae, 0x92, 0xc7, 0x6c, 0x57, 0xad, 0x55, 0x1a, 0x6f, 0x19, 0x17, 0xc6, 
+  0xbd, 0xd4, 0x24, 0x57, 0xd8, 0x04, 0xc9, 0x23, 0x68, 0x0d, 0x18, 0xdf, 0xe4, 0x19, 0xd8, 0x30, 
+  0xa2, 0x07, 0x51, 0xfe, 0xd8, 0x7e, 0x3c, 0xa5, 0x7e, 0x0c, 0x3c, 0x66, 0x7d, 0x75, 0x0f, 0x85, 
+  0x5b, 0x3e, 0x36, 0x5e, 0x37, 0xca, 0x99, 0x05, 0xa7, 0x5b, 0x95, 0x6a, 0x27, 0xaa, 0x4f, 0x17, 
+  0x5e, 0x75, 0x3c, 0x88, 0xfc, 0x17, 0x7a, 0x00, 0x8e, 0x83, 0x31, 0xc9, 0xb2, 0xa1, 0x37, 0xf6, 
+  0x82, 0x81, 0x9e, 0x38, 0xed, 0x49, 0xa9, 0xcb, 0x8b, 0x86, 0x9a, 0xbe, 0x8f, 0xd8, 0x62, 0x08, 
+  0x02, 0xc7, 0xd1, 0xb1, 0xed, 0xdd, 0x1d, 0xea, 0xdd, 0x9d, 0x7d, 0xe0, 0xf3, 0x76, 0x37, 0xe8, 
+  0x7d, 0x24, 0xc1, 0xff, 0xaf, 0x72, 0x08, 0x1d, 0xd5, 0x60, 0x30, 0xc8, 0xcd, 0x26, 0x3d, 0x96, 
+  0x9f, 0xe9, 0xb1, 0x61, 0x06, 0x19, 0x2c, 0xc2, 0xe5, 0x0e, 0x27, 0xc7, 0xc4, 0x89, 0x1e, 0x0e, 
+  0x9b, 0x94, 0xd3, 0xf7, 0x9e, 0x1d, 0xef, 0x98, 0x32, 0x3b, 0x6f, 0x53, 0x64, 0x54, 0x54, 0xad, 
+  0x9a, 0xac, 0x24, 0x26, 0xd6, 0xf2, 0xb6, 0x46, 0x5e, 0xe6, 0x59, 0x02, 0xb0, 0xa6, 0xf9, 0xa9, 
+  0x57, 0x95, 0x86, 0x8f, 0x41, 0x35, 0xcb, 0xd5, 0xd4, 0x6b, 0x65, 0x7a, 0x63, 0x92, 0x4b, 0xf7, 
+  0x32, 0xe8, 0x7e, 0x93, 0x6e, 0x60, 0xe7, 0x88, 0xdd, 0xb7, 0x6b, 0x0d, 0x04, 0xaa, 0xab, 0xc2, 
+  0x03, 0x66, 0x17, 0x3d, 0x97, 0xce, 0x10, 0xeb, 0x8f, 0xee, 0x68, 0x46, 0x72, 0x52, 0x7f, 0x32, 
+  0x1d, 0x6f, 0x7d, 0x32, 0x80, 0x8c, 0xc0, 0xdd, 0x76, 0x6f, 0x8f, 0x71, 0x8c, 0x0d, 0x9e, 0x94, 
+  0x03, 0x6f, 0xd4, 0xfb, 0x2b, 0xda, 0x1b, 0xee, 0xed, 0x7b, 0x50, 0x2a, 0x85, 0x55, 0x33, 0x02, 
+  0x50, 0x44, 0xdf, 0x2f, 0x47, 0x5b, 0xd0, 0xd1, 0xcd, 0xb4, 0x7a, 0xcc, 0xc9, 0x82, 0x99, 0x6a, 
+  0x48, 0xfe, 0xa0, 0xb7, 0xc4, 0xf2, 0x1b, 0xa8, 0x29, 0xf7, 0x9e, 0xd8, 0x22, 0xcf, 0xd5, 0xa1, 
+  0x3a, 0x21, 0x82, 0x78, 0x6a, 0x8d, 0xbf, 0x87, 0x9a, 0xbe, 0x73, 0x23, 0x6b, 0xe4, 0x28, 0xa1, 
+  0x2b, 0x4f, 0x5d, 0x72, 0xe2, 0xd8, 0x93, 0x0a, 0x98, 0x83, 0x46, 0x8b, 0xe3, 0xaa, 0x89, 0xff, 
+  0x58, 0xb3, 0x22, 0x15, 0x77, 0x18, 0xac, 0xe3, 0x44, 0x94, 0x84, 0x30, 0x8d, 0xfd, 0x0a, 0xf6, 
+  0x4b, 0xd3, 0x18, 0x66, 0x24, 0x0e, 0x87, 0x15, 0x13, 0x12, 0xed, 0x23, 0x40, 0x7a, 0xd6, 0x20, 
+  0x1d, 0x9c, 0x08, 0x69, 0x42, 0xbd, 0x9a, 0xd6, 0xa8, 0x12, 0x0d, 0x07, 0x04, 0x00, 0xe0, 0x96, 
+  0x9f, 0x70, 0xd0, 0x11, 0xc9, 0x1b, 0x6c, 0xbe, 0xdc, 0x86, 0x5f, 0x65, 0xbe, 0xc3, 0xd3, 0x85, 
+  0x99, 0x55, 0x30, 0x35, 0x03, 0xa1, 0xe8, 0xa7, 0x08, 0x56, 0xa4, 0x2d, 0x0c, 0xa9, 0x28, 0x56, 
+  0x73, 0x47, 0x55, 0xca, 0xa7, 0x6a, 0x79, 0x5a, 0xe4, 0x97, 0xbd, 0x64, 0x34, 0xf7, 0x77, 0xf6, 
+  0xc1, 0x70, 0x6e, 0xf8, 0x40, 0xe5, 0x2b, 0xef, 0x65, 0xde, 0xb3, 0x5c, 0xa6, 0x2b, 0xc7, 0xcf, 
+  0xb7, 0x5a, 0x8a, 0xa3, 0x72, 0x74, 0x7a, 0x73, 0xe3, 0x73, 0x48, 0xe1, 0x05, 0xc0, 0xbe, 0x6a, 
+  0xe1, 0x40, 0x17, 0x18, 0x2e, 0x6d, 0x39, 0x59, 0x40, 0xd0, 0xf3, 0x88, 0x65, 0x73, 0x07, 0x6b, 
+  0xef, 0x20, 0x19, 0xff, 0x14, 0x42, 0xc6, 0xff, 0x61, 0x6f, 0xef, 0x80, 0x73, 0x98, 0x1d, 0xfc, 
+  0xb8, 0xb7, 0x77, 0x73, 0xf3, 0xe3, 0xde, 0x4f, 0x30, 0x59, 0x71, 0x20, 0xc2, 0xaa, 0xe5, 0x60, 
+  0xef, 0x20, 0x62, 0xd9, 0x04, 0x2f, 0x46, 0x0a, 0x21, 0x06, 0x31, 0xa9, 0xd6, 0xe2, 0x88, 0xd6, 
+  0x19, 0x35, 0x04, 0xa0, 0xd5, 0x51, 0xb0, 0xb6, 0x56, 0x60, 0x1b, 0x9e, 0x52, 0x30, 0x6c, 0x6a, 
+  0x62, 0x99, 0x14, 0x6c, 0xb8, 0x16, 0x13, 0xd9, 0xd8, 0x61, 0x01, 0xaf, 0xa2, 0xa2, 0xca, 0x60, 
+  0xbc, 0x02, 0xbf, 0x82, 0x35, 0x7a, 0xf7, 0x2e, 0x27, 0x29, 0x66, 0x12, 0x55, 0xd0, 0xda, 0x58, 
+  0x5b, 0xe9, 0x3b, 0x0d, 0x46, 0x33, 0xfa, 0xee, 0x33, 0x1c, 0x7d, 0xe8, 0x0c, 0xa0, 0x3f, 0x82, 
+  0x5c, 0xfa, 0x85, 0x09, 0xb8, 0xb6, 0x8d, 0x09, 0xd0, 0x6e, 0x7f, 0x2d, 0x39, 0xa3, 0x87, 0x95, 
+  0x68, 0x33, 0x49, 0xc1, 0x3c, 0x32, 0x66, 0xec, 0x34, 0xb8, 0xce, 0xa3, 0x54, 0xb7, 0xc8, 0xa1, 
+  0xa4, 0xe9, 0x86, 0x91, 0x33, 0x62, 0xb4, 0x6f, 0x3d, 0xc7, 0xf3, 0xbe, 0x7c, 0xf9, 0xdd, 0xbb, 
+  0x55, 0x47, 0x72, 0x58, 0xc6, 0xf2, 0xe9, 0xc6, 0x3f, 0xa1, 0x4d, 0x02, 0x1c, 0x9c, 0x7e, 0xca, 
+  0x4e, 0x64, 0x95, 0x47, 0x84, 0x49, 0xa0, 0xe9, 0x52, 0x07, 0x39, 0x3b, 0x9c, 0xbe, 0x88, 0xbc, 
+  0xa4, 0x4b, 0x4e, 0xdd, 0x88, 0xb0, 0x0d, 0x00, 0x71, 0xbf, 0xe9, 0x61, 0x00, 0x4e, 0x7e, 0xe9, 
+  0x4e, 0x94, 0x3e, 0x72, 0x78, 0x68, 0x97, 0xc4, 0x61, 0x4b, 0x62, 0x54, 0x66, 0xf1, 0x9c, 0xf7, 
+  0x06, 0xf3, 0x49, 0xdc, 0xe4, 0x59, 0x6b, 0x63, 0x14, 0x4b, 0xd6, 0xac, 0x3c, 0x5a, 0x9a, 0xb9, 
+  0x1e, 0xe5, 0xec, 0x37, 0xc7, 0xb6, 0x3a, 0x47, 0xde, 0x9c, 0xe8, 0xe4, 0x99, 0x1d, 0xf7, 0x99, 
+  0xd7, 0xed, 0xaf, 0xef, 0xde, 0x2d, 0x60, 0x2a, 0x45, 0x0f, 0x1f, 0xb3, 0x30, 0x26, 0x72, 0x94, 
+  0x73, 0x03, 0x31, 0xe6, 0xf6, 0x0b, 0xd8, 0xa3, 0x20, 0x57, 0xce, 0x9b, 0xf1, 0x5a, 0x59, 0x7e, 
+  0x39, 0xa6, 0xda, 0x2a, 0xd1, 0x85, 0x60, 0x52, 0xfb, 0x6b, 0x76, 0xf3, 0xe7, 0xe9, 0xf6, 0xe3, 
+  0x68, 0x3e, 0x59, 0xf3, 0x04, 0xe7, 0x80, 0xc4, 0x22, 0xfa, 0xc8, 0x3f, 0x9d, 0x3c, 0xd9, 0x73, 
+  0x76, 0x38, 0x5a, 0x45, 0xa9, 0x03, 0x1e, 0x8b, 0xac, 0x77, 0x12, 0x1e, 0xe0, 0x34, 0xc0, 0x74, 
+  0xd9, 0xb6, 0xc1, 0x57, 0xb4, 0x16, 0x19, 0x29, 0x3a, 0x1e, 0xa3, 0x58, 0x3a, 0x0d, 0x19, 0x29, 
+  0x60, 0xce, 0x4b, 0x16, 0x10, 0xfa, 0xc0, 0xbc, 0x58, 0xda, 0x35, 0xb2, 0xc2, 0xf8, 0x3b, 0x0b, 
+  0x96, 0x0b, 0xc7, 0x78, 0x7d, 0x8c, 0x11, 0x61, 0x0a, 0xb2, 0x0a, 0xca, 0x28, 0x06, 0x66, 0xb6, 
+  0x00, 0x3d, 0xb1, 0x0d, 0x07, 0xd7, 0x15, 0xb5, 0xd1, 0xca, 0xd0, 0x15, 0x8b, 0x66, 0x35, 0xd3, 
+  0x8b, 0xe2, 0x3f, 0x61, 0x0c, 0x4b, 0x03, 0x91, 0x1c, 0x99, 0x3e, 0xa8, 0x53, 0x7a, 0xc7, 0xc4, 
+  0x69, 0x63, 0x8d, 0xd3, 0x77, 0x94, 0x39, 0x06, 0x60, 0xb3, 0xd9, 0xd4, 0xdb, 0xd1, 0x74, 0xd9, 
+  0x53, 0x18, 0xf7, 0xb0, 0xdc, 0x60, 0x21, 0xaf, 0x68, 0x29, 0xa7, 0x81, 0x4a, 0xc7, 0x7e, 0xe3, 
+  0xb8, 0x27, 0x52, 0x7f, 0xd8, 0xb5, 0x9d, 0x9f, 0xd3, 0x51, 0x6e, 0x4f, 0x78, 0xc1, 0x4d, 0x69, 
+  0x9d, 0xef, 0xd1, 0x9a, 0xce, 0xe9, 0x2d, 0xf5, 0x71, 0x92, 0x9b, 0x6a, 0xfa, 0x54, 0x8f, 0x00, 
+  0xa0, 0xfc, 0x83, 0x50, 0x2d, 0xa2, 0x73, 0xd0, 0xa6, 0x7a, 0x7c, 0x38, 0x81, 0x31, 0x1a, 0x33, 
+  0x98, 0x89, 0xc9, 0x34, 0x10, 0x6a, 0xe2, 0x26, 0x77, 0xcb, 0x73, 0xd3, 0x8f, 0xd0, 0x07, 0x30, 
+  0x1c, 0x7f, 0x27, 0x27, 0x84, 0x62, 0x3e, 0x29, 0x8d, 0xb0, 0x36, 0x56, 0xfa, 0xf4, 0x01, 0x8f, 
+  0x46, 0x33, 0xa8, 0x10, 0x7c, 0x8e, 0x9c, 0xbc, 0xd4, 0x82, 0x19, 0x52, 0x76, 0x13, 0x4f, 0x80, 
+  0xc1, 0xc1, 0x67, 0x3e, 0x8b, 0x4b, 0x44, 0x40, 0xcd, 0x4f, 0xce, 0xa4, 0x03, 0xfb, 0xe3, 0x1c, 
+  0x92, 0x0a, 0x8d, 0xd5, 0x55, 0x0d, 0xc5, 0xec, 0x5c, 0x4d, 0x72, 0x35, 0x57, 0x87, 0xd3, 0x20, 
+  0xbc, 0x72, 0x61, 0xcc, 0xce, 0x71, 0x6a, 0xcd, 0x55, 0x3c, 0xad, 0x1a, 0x85, 0xdc, 0xe6, 0x7f, 
+  0x81, 0x94, 0xae, 0x29, 0x7b, 0xed, 0xbc, 0x4b, 0xc7, 0x72, 0xe2, 0xe9, 0x69, 0x0a, 0xf9, 0xea, 
+  0x91, 0xf4, 0x11, 0x07, 0x20, 0xbd, 0x39, 0x0f, 0xd1, 0xdc, 0x25, 0xc3, 0x03, 0x39, 0x2f, 0x99, 
+  0x32, 0xc6, 0x89, 0xdf, 0x38, 0x3a, 0x0f, 0xf5, 0xd1, 0x6c, 0x8f, 0xcf, 0x9d, 0x1d, 0xc3, 0xa9, 
+  0xb3, 0xe5, 0xae, 0x8b, 0x4f, 0xcf, 0xd9, 0x79, 0xce, 0x48, 0xd9, 0x87, 0x2c, 0x4d, 0x43, 0xd7, 
+  0xb3, 0x25, 0x94, 0xac, 0xf7, 0xc8, 0x84, 0xb4, 0x10, 0xa9, 0xf2, 0x58, 0x35, 0x24, 0x12, 0xf8, 
+  0x5b, 0x26, 0x6f, 0xdd, 0x82, 0xb4, 0xa9, 0xa3, 0xc7, 0xa0, 0xac, 0xf2, 0x0e, 0xd7, 0x5c, 0xda, 
+  0xe0, 0x8a, 0xa9, 0x90, 0xc0, 0xa8, 0xac, 0x07, 0x9f, 0xa7, 0xc1, 0xf5, 0x23, 0x24, 0xf0, 0xdb, 
+  0x8a, 0x8c, 0x71, 0x65, 0xf2, 0x85, 0xd1, 0xa9, 0x99, 0x21, 0xf4, 0x5f, 0x95, 0x56, 0x7f, 0x23, 
+  0xda, 0x99, 0x0a, 0x11, 0x8c, 0x35, 0x53, 0x89, 0xa8, 0x31, 0x53, 0x65, 0x08, 0x52, 0x58, 0xe8, 
+  0x3d, 0xa2, 0xf4, 0x9e, 0x09, 0x33, 0x18, 0x93, 0x9a, 0x06, 0x2c, 0x76, 0x5b, 0x92, 0x3e, 0xd7, 
+  0x54, 0x4f, 0x1d, 0xae, 0xbb, 0x95, 0xd4, 0x6d, 0xd9, 0x36, 0x9b, 0x40, 0x8b, 0x1d, 0xc3, 0x38, 
+  0xc3, 0x67, 0x8d, 0x3c, 0xb3, 0x4b, 0x8a, 0xc3, 0x8f, 0x46, 0xb6, 0x2a, 0x07, 0x2d, 0x11, 0x4f, 
+  0xc8, 0x6f, 0x36, 0x59, 0xce, 0xa3, 0xad, 0x33, 0xc4, 0x5f, 0xec, 0x7e, 0xa8, 0xe8, 0x6b, 0xed, 
+  0xc7, 0xda, 0x53, 0x8b, 0x45, 0x08, 0x47, 0xb7, 0xba, 0x6f, 0xb5, 0xaf, 0xfb, 0x75, 0x3d, 0xa1, 
+  0x7b, 0x82, 0xb9, 0x9a, 0x95, 0xcd, 0x46, 0x55, 0x24, 0xbe, 0x81, 0x6a, 0x5b, 0x65, 0x7d, 0xf7, 
+  0x6d, 0x90, 0x7b, 0xc3, 0x42, 0x77, 0x59, 0xc4, 0x17, 0xc8, 0x60, 0xb9, 0x15, 0xad, 0x57, 0xfb, 
+  0x4f, 0xd0, 0xc8, 0x08, 0x06, 0x0d, 0x9c, 0xcd, 0x2a, 0xa7, 0x67, 0xa8, 0xe0, 0xa1, 0xa1, 0x7b, 
+  0xa4, 0x51, 0x91, 0x81, 0x10, 0x5f, 0x73, 0x06, 0x08, 0x86, 0xc9, 0x5f, 0xfe, 0x5e, 0xe0, 0xa4, 
+  0xab, 0x34, 0xc5, 0xea, 0x81, 0x40, 0xb5, 0x8c, 0xb6, 0xa6, 0x65, 0x55, 0x36, 0xed, 0x7b, 0x15, 
+  0xd4, 0x26, 0x23, 0x24, 0x26, 0x92, 0xe0, 0x57, 0xab, 0x09, 0x38, 0x10, 0x7b, 0x14, 0xa0, 0x83, 
+  0xed, 0xdb, 0x16, 0xa9, 0xd6, 0xa6, 0x37, 0x35, 0x09, 0x44, 0x59, 0xf3, 0x82, 0x71, 0x78, 0x96, 
+  0xd5, 0x70, 0xe0, 0x32, 0x67, 0x75, 0x67, 0xdf, 0x8a, 0x3b, 0xb0, 0xf5, 0xfd, 0x9a, 0x4b, 0x78, 
+  0x70, 0x7b, 0xa0, 0x81, 0x8d, 0x29, 0x28, 0x1d, 0x96, 0x10, 0x00, 0x02, 0xc6, 0x45, 0xbd, 0x1c, 
+  0xea, 0x09, 0xf2, 0x39, 0x56, 0x54, 0xf7, 0x5c, 0x72, 0x09, 0xe0, 0x49, 0x2b, 0x3a, 0x46, 0xac, 
+  0xd0, 0xa3, 0xef, 0x0a, 0x85, 0xb1, 0x4d, 0x8f, 0x6b, 0x81, 0x30, 0xd4, 0x61, 0x6e, 0x7f, 0x9d, 
+  0xd5, 0xdf, 0xd0, 0x08, 0x36, 0x94, 0xf9, 0x83, 0x3f, 0x2a, 0x9d, 0x0a, 0xbe, 0x37, 0xcb, 0x17, 
+  0x57, 0x5e, 0x3b, 0x27, 0x76, 0x15, 0x76, 0x63, 0x13, 0xa4, 0x1a, 0x9b, 0x27, 0xcd, 0x0a, 0x66, 
+  0x1f, 0x9e, 0x3c, 0x16, 0x76, 0x52, 0xc7, 0xbb, 0x5e, 0xac, 0x92, 0xf5, 0x22, 0x5f, 0x19, 0x40, 
+  0xa9, 0x76, 0x17, 0xfa, 0x8d, 0x82, 0x9c, 0x78, 0x4b, 0x27, 0xeb, 0xec, 0x7e, 0xd4, 0xd5, 0x48, 
+  0xdf, 0xaf, 0xe5, 0x79, 0x04, 0x03, 0x2b, 0x97, 0x92, 0xd7, 0xe5, 0x96, 0xd4, 0x10, 0xfc, 0x9a, 
+  0x9a, 0x31, 0xe9, 0xcb, 0x69, 0xe1, 0xf2, 0x95, 0xac, 0xac, 0xaa, 0xd2, 0xef, 0x1c, 0x0d, 0xff, 
+  0x78, 0xf1, 0xfc, 0x69, 0x59, 0x5e, 0x68, 0x99, 0xd1, 0xcd, 0xbe, 0x2b, 0xb9, 0xd6, 0xca, 0xe8, 
+  0x7a, 0x8f, 0xa1, 0x13, 0xf6, 0x7f, 0xf8, 0xe1, 0x47, 0xfa, 0xf1, 0xd3, 0x46, 0x25, 0x59, 0xd4, 
+  0x7e, 0x09, 0xad, 0x8e, 0x19, 0x2d, 0x95, 0x62, 0x15, 0xf5, 0xfb, 0x00, 0x2c, 0xf6, 0x2e, 0x69, 
+  0x48, 0x0f, 0x8b, 0x84, 0xc6, 0xa9, 0x4c, 0xe3, 0xe5, 0x0a, 0x9e, 0xb9, 0x49, 0xa6, 0x66, 0x5c, 
+  0x31, 0x02, 0x1a, 0x17, 0x15, 0xd3, 0x9d, 0xb5, 0xd2, 0x52, 0x35, 0x43, 0xda, 0x5f, 0x03, 0x38, 
+  0x9e, 0xc4, 0x30, 0x49, 0xcb, 0xf4, 0xdd, 0xd4, 0x70, 0x3f, 0xad, 0x69, 0xe5, 0x0c, 0x5f, 0x53, 
+  0x4b, 0xf3, 0x5d, 0x8b, 0xa7, 0x4e, 0x75, 0xf7, 0x20, 0x6d, 0x70, 0x5a, 0x55, 0x3f, 0x15, 0xfd, 
+  0x60, 0xca, 0xda, 0xba, 0x54, 0xa4, 0x47, 0x5c, 0xd1, 0x56, 0x67, 0x13, 0x72, 0x4a, 0x8b, 0x68, 
+  0xb5, 0xba, 0xcc, 0x8b, 0x05, 0x80, 0x56, 0xa8, 0xb6, 0x30, 0xb5, 0x15, 0x9a, 0xa7, 0x7b, 0xb3, 
+  0x60, 0xa8, 0xce, 0xea, 0x06, 0x5d, 0x8e, 0x9c, 0x82, 0x46, 0x24, 0x62, 0x20, 0xa8, 0x86, 0xce, 
+  0xb7, 0xeb, 0x9e, 0x5f, 0x55, 0xc1, 0xcb, 0x9d, 0x4f, 0xa5, 0xcf, 0x9f, 0x78, 0x7f, 0xec, 0xe8, 
+  0x99, 0x4a, 0x16, 0x3b, 0x9c, 0xd5, 0x77, 0xca, 0xb8, 0xa1, 0x1d, 0xf7, 0x23, 0xaf, 0x3e, 0xb5, 
+  0xf0, 0x96, 0x0d, 0x8a, 0xb6, 0x7e, 0x20, 0x53, 0x0c, 0x65, 0x3a, 0xca, 0xbb, 0x7c, 0xb2, 0x9d, 
+  0x95, 0x93, 0x33, 0x8f, 0x1b, 0x47, 0xd4, 0xe5, 0x6c, 0x99, 0xc7, 0x0b, 0xfe, 0xc1, 0x6c, 0x13, 
+  0xff, 0x62, 0x89, 0x9a, 0x7f, 0x69, 0x39, 0x9a, 0x7f, 0xb3, 0x90, 0xca, 0xbc, 0xd8, 0xfc, 0x34, 
+  0xce, 0x4e, 0x24, 0x33, 0xa9, 0xd2, 0x8a, 0x03, 0xe6, 0xde, 0x0a, 0xa3, 0x53, 0x08, 0x35, 0x0f, 
+  0xc6, 0x77, 0x3b, 0xd0, 0xc0, 0x84, 0x6d, 0x1a, 0x23, 0xb9, 0x86, 0x2e, 0x49, 0x04, 0xc1, 0x37, 
+  0xf7, 0x55, 0xe1, 0x70, 0x68, 0x78, 0xf0, 0xcf, 0x72, 0x62, 0x6e, 0x01, 0xb1, 0xa3, 0xab, 0x98, 
+  0x98, 0xab, 0x24, 0xb9, 0x87, 0x95, 0x5f, 0xb4, 0x52, 0x90, 0x9f, 0x04, 0x1d, 0x5e, 0x57, 0x4e, 
+  0x49, 0x2a, 0x32, 0xbe, 0x9e, 0xa5, 0x59, 0x5c, 0x5c, 0x85, 0xd5, 0xed, 0x4d, 0x78, 0xcd, 0x86, 
+  0xad, 0x7a, 0xc1, 0x8d, 0xe2, 0xc0, 0x91, 0xb6, 0x35, 0xc2, 0x0f, 0x38, 0x28, 0xc3, 0x8e, 0x6a, 
+  0x8e, 0xf8, 0x84, 0xc6, 0xd8, 0x9a, 0x11, 0xcd, 0x7d, 0xf3, 0xe5, 0xca, 0x09, 0x88, 0xd1, 0x63, 
+  0x3f, 0xae, 0x66, 0x21, 0x0e, 0x3b, 0xc7, 0xde, 0x99, 0x4c, 0x70, 0xce, 0x85, 0xa3, 0x42, 0x80, 
+  0xce, 0xa1, 0x5b, 0x57, 0x92, 0x03, 0x11, 0x8a, 0xe9, 0x6e, 0x8e, 0xf7, 0xcb, 0xcc, 0x19, 0xa5, 
+  0x37, 0x6b, 0x47, 0xd2, 0x9a, 0xf6, 0x4d, 0xec, 0xe0, 0x02, 0x0c, 0x55, 0x57, 0x9a, 0xe4, 0x46, 
+  0x69, 0xb2, 0x69, 0x19, 0x14, 0xf8, 0x35, 0xb9, 0x6f, 0x32, 0xa6, 0x6c, 0xe7, 0xa0, 0x12, 0x77, 
+  0x43, 0xb8, 0x5c, 0x11, 0x03, 0xcd, 0x13, 0x0f, 0x12, 0x89, 0x61, 0xbe, 0x66, 0x79, 0xb3, 0x66, 
+  0x5d, 0x29, 0xa2, 0xed, 0xb7, 0x95, 0xf1, 0x55, 0xf5, 0x6a, 0xf6, 0xd9, 0x2d, 0xf7, 0x93, 0xf9, 
+  0x79, 0xe7, 0xfd, 0x2f, 0x3b, 0xd5, 0x93, 0x9a, 0x19, 0x57, 0xbf, 0x6d, 0xf7, 0xc3, 0xcc, 0x1f, 
+  0x87, 0x68, 0xf5, 0x06, 0x05, 0x03, 0xb9, 0xcd, 0xb6, 0xdb, 0xef, 0x60, 0xa4, 0x12, 0x97, 0x55, 
+  0x76, 0xd8, 0x26, 0x58, 0xf1, 0xbb, 0x06, 0xcb, 0x32, 0x70, 0x35, 0xc6, 0xa9, 0x82, 0x11, 0x31, 
+  0xaa, 0x61, 0xfd, 0x0b, 0xc3, 0xa5, 0xda, 0x83, 0x2a, 0x48, 0x2d, 0x60, 0x0d, 0xab, 0xc1, 0xac, 
+  0x88, 0x74, 0xfb, 0x1d, 0x55, 0x48, 0x3e, 0xfb, 0x83, 0xd5, 0xa9, 0x56, 0xa6, 0xa7, 0x06, 0x31, 
+  0x1d, 0xab, 0x5b, 0xe8, 0x35, 0x92, 0x8d, 0x7b, 0x07, 0x52, 0xf6, 0x1f, 0x40, 0xb1, 0x41, 0x60, 
+  0x53, 0xad, 0xb2, 0x24, 0x95, 0x67, 0x1f, 0xaa, 0x6b, 0x6d, 0xba, 0x0f, 0x4d, 0x81, 0x43, 0xb9, 
+  0x56, 0xab, 0x62, 0x4e, 0xf7, 0x88, 0xb0, 0x53, 0x49, 0x6a, 0xd9, 0xc3, 0xa6, 0xea, 0x69, 0xe9, 
+  0x2e, 0xad, 0x93, 0x38, 0xe3, 0xb6, 0x89, 0x6c, 0x2b, 0xe2, 0xf7, 0x4f, 0x1c, 0x9f, 0xef, 0x90, 
+  0x21, 0x91, 0x3a, 0x7f, 0xda, 0xfb, 0x89, 0x0f, 0x40, 0xb9, 0xc4, 0x80, 0x9c, 0x31, 0xf7, 0x5d, 
+  0x83, 0xd9, 0x41, 0x5e, 0x99, 0xa0, 0x63, 0x5d, 0x03, 0xc3, 0xcd, 0xaf, 0x7c, 0x42, 0x4b, 0x12, 
+  0x42, 0x24, 0xb3, 0x7a, 0x16, 0xed, 0xfa, 0x51, 0xf0, 0x61, 0xec, 0x8f, 0xa3, 0xbb, 0x37, 0x77, 
+  0x82, 0x9b, 0x0f, 0x63, 0x71, 0x04, 0x75, 0xd6, 0x2d, 0x64, 0xa8, 0x8b, 0xd0, 0x9b, 0x6b, 0x03, 
+  0xaf, 0x58, 0xed, 0x2f, 0x8c, 0xbd, 0xb7, 0xed, 0xf2, 0x9a, 0x65, 0xe2, 0x30, 0xce, 0x12, 0x9d, 
+  0x04, 0x5d, 0x0c, 0xbc, 0x8f, 0x8e, 0x56, 0xbf, 0xc6, 0x3b, 0x8b, 0x0f, 0x4d, 0xd2, 0xb9, 0x88, 
+  0xf0, 0x22, 0xb6, 0xee, 0x5f, 0x78, 0xea, 0x16, 0x88, 0xdf, 0xa8, 0x2f, 0xa9, 0x27, 0xb8, 0x24, 
+  0xc4, 0xac, 0xcc, 0xc0, 0x09, 0xd0, 0xf8, 0x07, 0x63, 0x8f, 0xfe, 0xf5, 0x3a, 0x00, 0x29, 0xb4, 
+  0xd6, 0x9e, 0x8d, 0x31, 0xc9, 0xff, 0xd4, 0x18, 0x53, 0xbd, 0x53, 0x9b, 0x4c, 0x3c, 0xfc, 0x95, 
+  0xb8, 0x67, 0x98, 0x56, 0xe4, 0x2b, 0x78, 0x36, 0x6b, 0x0e, 0x3a, 0x16, 0xe2, 0x49, 0x77, 0xdf, 
+  0x0c, 0x2b, 0xe0, 0x94, 0xeb, 0x77, 0x10, 0x86, 0x53, 0xbb, 0xe1, 0x83, 0xe5, 0xad, 0xdd, 0x51, 
+  0xf1, 0x18, 0x19, 0x35, 0x11, 0x0f, 0x3d, 0xb5, 0x16, 0x97, 0x22, 0x63, 0x8b, 0xcb, 0xa0, 0x08, 
+  0xc2, 0xc6, 0x38, 0xf1, 0xf8, 0x38, 0x86, 0x1d, 0x33, 0x5e, 0xc6, 0x16, 0xa3, 0x4b, 0xb2, 0x2f, 
+  0x66, 0xc1, 0xfb, 0xd3, 0x51, 0x19, 0xca, 0x72, 0x17, 0xdf, 0x8b, 0x9a, 0xca, 0xd0, 0xa8, 0x2b, 
+  0x2b, 0x57, 0xdc, 0x62, 0xe0, 0xf5, 0x2e, 0xe3, 0x55, 0x8f, 0x18, 0xe1, 0x1e, 0x56, 0x11, 0x46, 
+  0x4c, 0x01, 0xd4, 0x7c, 0xa3, 0xea, 0xa3, 0x11, 0x89, 0xbc, 0x4e, 0xfb, 0xe0, 0x08, 0x4e, 0x94, 
+  0x47, 0x35, 0xfc, 0x36, 0x68, 0x49, 0x6d, 0x8c, 0xea, 0x46, 0x65, 0x1d, 0x08, 0xb0, 0x55, 0x56, 
+  0xb6, 0xf1, 0x23, 0xff, 0xc8, 0x04, 0xb3, 0x23, 0x60, 0xc0, 0xa7, 0xaf, 0xe7, 0xe6, 0x52, 0xf6, 
+  0xcf, 0xe4, 0x8f, 0xaf, 0x8f, 0x77, 0xd9, 0x18, 0x4a, 0xac, 0x62, 0xf8, 0x8a, 0x21, 0xa7, 0x5b, 
+  0x8e, 0x70, 0x87, 0x14, 0x39, 0xf7, 0x7c, 0xc1, 0x62, 0xcf, 0xa3, 0xb4, 0x4a, 0x3d, 0x61, 0xe8, 
+  0x10, 0x3b, 0xc7, 0x8b, 0x61, 0xf6, 0xe9, 0x11, 0x63, 0x7b, 0x70, 0x5f, 0x23, 0xdf, 0x2f, 0x91, 
+  0x1d, 0x39, 0x85, 0xea, 0x03, 0x37, 0x78, 0x25, 0x75, 0x14, 0xf4, 0xb1, 0xea, 0x20, 0x27, 0x60, 
+  0xed, 0xd1, 0xb1, 0x8b, 0x67, 0x91, 0x77, 0x80, 0xc5, 0xf6, 0x8f, 0x83, 0x5d, 0xf9, 0xe3, 0x5e, 
+  0x78, 0x0a, 0xe9, 0xd8, 0xcb, 0xcc, 0x91, 0x15, 0xac, 0x89, 0x4f, 0xbb, 0xbd, 0x70, 0x13, 0xdd, 
+  0x52, 0x78, 0xdb, 0x65, 0x6f, 0x3c, 0x99, 0x86, 0x7e, 0x67, 0x04, 0xba, 0x2f, 0x1a, 0x0b, 0x10, 
+  0x69, 0x04, 0x1f, 0x75, 0x7d, 0xe5, 0x18, 0x21, 0x86, 0x7e, 0xf9, 0xbd, 0xdf, 0x19, 0x34, 0x2d, 
+  0xd8, 0xb3, 0x78, 0x05, 0x5d, 0xbc, 0x98, 0xac, 0xcf, 0xac, 0xbf, 0xba, 0x76, 0xe9, 0xea, 0x20, 
+  0x74, 0x08, 0xad, 0x8d, 0xce, 0x38, 0x21, 0x1c, 0x1d, 0x16, 0x44, 0xca, 0xfc, 0x34, 0xfa, 0x28, 
+  0x4e, 0x1f, 0x24, 0x56, 0x8e, 0x27, 0x65, 0xe3, 0x0d, 0x48, 0x97, 0x18, 0xd0, 0x07, 0xa6, 0xd1, 
+  0x95, 0x00, 0xef, 0x96, 0x2a, 0xe7, 0x99, 0xcd, 0x6d, 0x3a, 0xbb, 0x47, 0xc4, 0x1b, 0x54, 0xc4, 
+  0xf8, 0xd1, 0xf0, 0x3c, 0x29, 0x4e, 0xa8, 0xec, 0x14, 0xfc, 0x6f, 0x25, 0x8e, 0xe9, 0xec, 0xcf, 
+  0x4c, 0x7b, 0xb4, 0xb6, 0x80, 0x39, 0xa6, 0xdb, 0x08, 0x14, 0x4b, 0x8e, 0xb0, 0x6b, 0x38, 0xb8, 
+  0x04, 0x46, 0x0a, 0xdd, 0xd9, 0x3f, 0x90, 0x74, 0x6f, 0x00, 0xf1, 0xd1, 0x8a, 0x73, 0x08, 0xde, 
+  0x90, 0xd3, 0xe5, 0x6a, 0x4f, 0xe1, 0x9a, 0xdd, 0xa7, 0xfd, 0x9a, 0xee, 0x28, 0x2c, 0x3b, 0x31, 
+  0x73, 0x4b, 0x49, 0x21, 0xe0, 0xbd, 0x7e, 0xf5, 0x96, 0x4e, 0x4e, 0xb5, 0x77, 0x10, 0x57, 0x9f, 
+  0xd8, 0x56, 0xbd, 0x00, 0x10, 0xb4, 0xa1, 0x7d, 0x11, 0x9f, 0x32, 0xad, 0x93, 0x0d, 0x1a, 0xe0, 
+  0xc4, 0x49, 0x6d, 0x23, 0xaa, 0x78, 0x88, 0xd2, 0x7e, 0x31, 0xc6, 0xa9, 0xb9, 0x48, 0x3f, 0xff, 
+  0xc3, 0x02, 0xbf, 0xf9, 0xce, 0x22, 0xc4, 0x9c, 0x70, 0x9c, 0x30, 0x36, 0x22, 0x0e, 0x2f, 0xb3, 
+  0x7b, 0x69, 0xee, 0xea, 0xc7, 0x6f, 0xdc, 0x92, 0x91, 0x33, 0x17, 0x8d, 0x91, 0xc8, 0x8a, 0xa3, 
+  0xe5, 0x67, 0xf6, 0xb9, 0x44, 0x66, 0x86, 0x8d, 0x15, 0x93, 0x9b, 0x02, 0xae, 0x46, 0x32, 0x74, 
+  0x26, 0xa8, 0xa6, 0xf7, 0x23, 0x32, 0xe9, 0x5b, 0x98, 0xcd, 0x2e, 0x61, 0x3e, 0x32, 0x99, 0x8a, 
+  0x36, 0x46, 0xba, 0xc5, 0x2b, 0x44, 0x10, 0xe6, 0xf0, 0x93, 0x57, 0xfc, 0x33, 0xfc, 0x26, 0x06, 
+  0xbd, 0x93, 0x56, 0x59, 0xe7, 0x27, 0xf4, 0x38, 0x36, 0xcf, 0x67, 0x67, 0x82, 0xeb, 0x0d, 0x92, 
+  0x7f, 0xd2, 0xa2, 0x9f, 0x63, 0x2a, 0xe7, 0x55, 0x6e, 0x3f, 0x9b, 0xcd, 0x30, 0xf2, 0x8a, 0x64, 
+  0x19, 0x43, 0x57, 0x0a, 0xe8, 0xc8, 0x68, 0xa9, 0xfb, 0xe0, 0x07, 0x1c, 0xff, 0xab, 0x9b, 0x66, 
+  0x75, 0xa9, 0x5a, 0x57, 0x37, 0x96, 0x9c, 0x99, 0x0f, 0x10, 0xfd, 0xb5, 0x24, 0x89, 0x73, 0xe0, 
+  0x06, 0xa6, 0x5f, 0x88, 0x14, 0xe3, 0x22, 0x10, 0xe8, 0x81, 0x7c, 0xb0, 0x76, 0xcf, 0x3d, 0x64, 
+  0x85, 0xa2, 0x25, 0x17, 0x03, 0x28, 0x68, 0x69, 0xbb, 0x41, 0x92, 0xc2, 0x10, 0x40, 0xb4, 0x05, 
+  0x27, 0xe3, 0x63, 0x15, 0xb6, 0x93, 0x14, 0x30, 0x47, 0x7a, 0x5e, 0xe5, 0xdc, 0x58, 0x4b, 0xce, 
+  0x65, 0x1b, 0xbf, 0x5f, 0x9a, 0x08, 0xd3, 0xac, 0x06, 0xd8, 0x8b, 0x7d, 0xa5, 0x01, 0x90, 0xa1, 
+  0x74, 0xc4, 0xf1, 0x74, 0x8c, 0xbf, 0x72, 0xb5, 0x03, 0x3c, 0x99, 0x8b, 0x41, 0x5c, 0x15, 0xc1, 
+  0xbb, 0xb9, 0x0c, 0x7e, 0xe8, 0xeb, 0x9d, 0x15, 0xff, 0x19, 0x20, 0x47, 0x35, 0x22, 0x91, 0x4e, 
+  0x18, 0xdc, 0x7f, 0x5c, 0x0e, 0xf9, 0xc2, 0xbc, 0xf7, 0x98, 0xba, 0xdc, 0x82, 0x1c, 0x38, 0x76, 
+  0xdf, 0x39, 0x88, 0x38, 0x45, 0x9b, 0xea, 0x28, 0x55, 0x7b, 0xad, 0x29, 0xb7, 0xe4, 0xb1, 0x3e, 
+  0x0e, 0x24, 0x1d, 0x94, 0xa3, 0x3d, 0xcc, 0x1b, 0x2b, 0x43, 0x62, 0x9a, 0xb7, 0xe1, 0xa6, 0xd8, 
+  0xd3, 0x4b, 0xe0, 0x3e, 0xc2, 0x2d, 0xda, 0x29, 0x3d, 0xed, 0x43, 0xbb, 0xf2, 0x0c, 0x0c, 0x01, 
+  0x87, 0x24, 0x58, 0x08, 0x98, 0x26, 0xbc, 0x43, 0x31, 0x2e, 0xb6, 0x69, 0x6b, 0xc6, 0x06, 0x4f, 
+  0xa0, 0x2b, 0xe5, 0xa2, 0xca, 0x20, 0xdb, 0xb9, 0x3a, 0x4b, 0x37, 0xee, 0x52, 0x5d, 0x03, 0xcc, 
+  0x38, 0xe1, 0x51, 0x43, 0xe4, 0xfb, 0x49, 0xf2, 0xa7, 0x74, 0x4a, 0x61, 0x80, 0xc2, 0x44, 0xc6, 
+  0x49, 0x9e, 0xfc, 0x21, 0x4f, 0xe0, 0x28, 0x8f, 0x4a, 0x7b, 0x52, 0x64, 0x6f, 0x63, 0xd0, 0x07, 
+  0x94, 0x4d, 0x19, 0x5f, 0x4f, 0x25, 0x64, 0xd4, 0x9d, 0x2e, 0xf8, 0x88, 0xf9, 0x3a, 0xa4, 0x73, 
+  0xaa, 0x35, 0x06, 0x7e, 0xab, 0x5a, 0xd8, 0xb2, 0x0b, 0x0a, 0x77, 0xc7, 0x05, 0xe5, 0xf6, 0x6f, 
+  0xad, 0x8c, 0xb7, 0x3a, 0xc9, 0x9f, 0xdd, 0x61, 0xad, 0x41, 0x50, 0x18, 0x32, 0x79, 0xfc, 0x9a, 
+  0x35, 0x7d, 0x10, 0x30, 0x4c, 0x4c, 0x97, 0x3e, 0x73, 0x46, 0x2c, 0xe1, 0x30, 0xc4, 0x07, 0x8e, 
+  0xf5, 0x9b, 0x1b, 0xf9, 0xdd, 0x28, 0xc5, 0x08, 0x13, 0x76, 0xe3, 0x77, 0xd0, 0x08, 0x51, 0xd9, 
+  0x3a, 0xc8, 0x51, 0x30, 0xac, 0x4b, 0x32, 0x98, 0x56, 0xc6, 0x02, 0x80, 0x2d, 0x42, 0xe7, 0x68, 
+  0x3a, 0x1e, 0xc8, 0x7a, 0x6e, 0x64, 0x5e, 0x3f, 0xca, 0x2f, 0x6c, 0xce, 0x75, 0x68, 0x77, 0x64, 
+  0x31, 0x37, 0x0a, 0x21, 0x57, 0x5a, 0x55, 0xca, 0x18, 0x60, 0x78, 0xb4, 0x65, 0x4f, 0xa6, 0xfc, 
+  0xaf, 0x1d, 0x62, 0xc9, 0x98, 0x45, 0x4d, 0x4b, 0xab, 0x3c, 0x1f, 0x7a, 0x5f, 0xca, 0x1b, 0x9a, 
+  0x45, 0x39, 0x67, 0xa8, 0x84, 0x15, 0x92, 0x54, 0xef, 0x0c, 0xe5, 0x77, 0x06, 0xb3, 0xd4, 0x95, 
+  0xdd, 0xb5, 0xc9, 0xc0, 0x10, 0x7d, 0xcf, 0xa0, 0xd6, 0xea, 0x18, 0x15, 0xf8, 0xcd, 0x4d, 0x91, 
+  0x6c, 0xea, 0x78, 0xbe, 0x36, 0x79, 0x1c, 0x4c, 0x9f, 0x76, 0x25, 0x7b, 0xca, 0x26, 0x9b, 0x93, 
+  0xfb, 0x7a, 0xed, 0xbb, 0x11, 0x8f, 0xa5, 0x09, 0xf9, 0xca, 0xa3, 0x5a, 0x11, 0x30, 0xa9, 0x82, 
+  0x51, 0x5c, 0x83, 0x1c, 0xfc, 0xae, 0x0c, 0x9e, 0x58, 0xe3, 0x9f, 0x01, 0xa5, 0x43, 0x52, 0x43, 
+  0xf8, 0xf7, 0xe6, 0x12, 0x80, 0x28, 0xe1, 0xec, 0xd0, 0xa0, 0x23, 0x2b, 0x35, 0xd1, 0x02, 0x98, 
+  0x8d, 0xe1, 0x61, 0x39, 0x02, 0x5d, 0x30, 0x9f, 0xe1, 0xe7, 0x74, 0xe1, 0x7c, 0x60, 0x98, 0xa9, 
+  0x7c, 0x9c, 0x85, 0x85, 0xbb, 0xb1, 0x03, 0x0d, 0x29, 0xb7, 0x01, 0xc5, 0x51, 0x9d, 0x59, 0x3b, 
+  0x1d, 0xd8, 0x66, 0x60, 0x88, 0xf1, 0x09, 0x54, 0xb3, 0x97, 0x65, 0xb5, 0xf4, 0xab, 0xd9, 0x54, 
+  0xf2, 0xd0, 0x5e, 0xd0, 0xae, 0x5d, 0xbe, 0x36, 0xa9, 0x7b, 0xb7, 0xa6, 0xa0, 0xa5, 0x13, 0x99, 
+  0x33, 0xcf, 0x66, 0x81, 0xfa, 0x25, 0xb1, 0x48, 0xa1, 0xbc, 0xea, 0xab, 0x23, 0x8a, 0x1a, 0xe5, 
+  0x1c, 0xb1, 0xe0, 0x5f, 0x9c, 0x89, 0xd4, 0x09, 0xc9, 0x6d, 0xfa, 0x64, 0x5e, 0xdf, 0xa1, 0xce, 
+  0x0b, 0xe3, 0xcc, 0x1a, 0x9d, 0xd8, 0x1c, 0x99, 0xca, 0x95, 0x6c, 0x4a, 0x59, 0xe6, 0xca, 0xbd, 
+  0x41, 0x6c, 0x94, 0x2b, 0xe1, 0x4a, 0x01, 0xbe, 0x26, 0xa7, 0x23, 0x15, 0xb7, 0x9d, 0xfa, 0x85, 
+  0x64, 0x98, 0x3d, 0x86, 0x73, 0x46, 0xd4, 0x15, 0x0f, 0xd2, 0x1c, 0x37, 0xcc, 0x9b, 0x83, 0x45, 
+  0xed, 0x04, 0x57, 0x12, 0x85, 0xa3, 0x27, 0x3e, 0x1b, 0xfc, 0x81, 0x50, 0x24, 0x07, 0x84, 0xc9, 
+  0x4f, 0x17, 0x9a, 0xec, 0xc1, 0xd6, 0xa6, 0x71, 0xeb, 0xc2, 0x31, 0x27, 0x0d, 0x16, 0x0f, 0x1a, 
+  0xca, 0xab, 0xd3, 0x5e, 0xbe, 0x82, 0x84, 0xcc, 0x89, 0xfd, 0x4e, 0x5a, 0x21, 0x96, 0x58, 0x35, 
+  0xa9, 0xd6, 0xc4, 0x9b, 0x33, 0xe1, 0xe4, 0x62, 0xf5, 0x35, 0x38, 0x96, 0x25, 0x58, 0x2f, 0xaf, 
+  0x6c, 0xc2, 0xb7, 0x84, 0x89, 0x21, 0x0b, 0x90, 0xb4, 0xe8, 0x50, 0x5f, 0x15, 0xb5, 0x2b, 0x53, 
+  0xc0, 0xe4, 0x55, 0x96, 0x02, 0xf5, 0xab, 0xea, 0xe5, 0x81, 0x09, 0x94, 0x89, 0x24, 0xcd, 0xac, 
+  0xce, 0x2b, 0x8b, 0xc4, 0xcd, 0xb5, 0x9c, 0xb3, 0x02, 0xbd, 0xaf, 0xb2, 0xb1, 0x41, 0xbb, 0xd1, 
+  0xf6, 0x3e, 0x67, 0xb9, 0x56, 0x7e, 0xa1, 0xaa, 0xb2, 0x3d, 0xab, 0x86, 0xe1, 0xda, 0x35, 0x81, 
+  0xd7, 0x8c, 0xe3, 0xaa, 0x72, 0x0e, 0x6b, 0xc6, 0x00, 0xdd, 0xb2, 0xcf, 0x85, 0x74, 0x71, 0x82, 
+  0x83, 0x76, 0x38, 0x38, 0xe0, 0x07, 0xc2, 0xdb, 0x50, 0xba, 0x65, 0x37, 0x71, 0x30, 0x39, 0x3e, 
+  0x47, 0xad, 0xb3, 0x56, 0x95, 0x46, 0x85, 0xe3, 0x63, 0x5b, 0x83, 0xca, 0x1b, 0xc8, 0x86, 0x6f, 
+  0xe4, 0x74, 0x70, 0x12, 0x30, 0xe0, 0x1d, 0x5b, 0x6a, 0xd9, 0x3a, 0x9c, 0x10, 0xa1, 0x89, 0x26, 
+  0xe5, 0xbc, 0xde, 0xbb, 0x7f, 0xdf, 0xd3, 0x66, 0x3f, 0xdc, 0x28, 0x15, 0xfb, 0x42, 0xdf, 0xf7, 
+  0xf8, 0x13, 0x4e, 0x61, 0x89, 0xb8, 0xe5, 0x0b, 0xce, 0xf3, 0xf5, 0x2a, 0x01, 0x7a, 0x41, 0x81, 
+  0x1d, 0xcf, 0x57, 0xb4, 0x65, 0x48, 0x62, 0x83, 0x3d, 0xca, 0x25, 0x3f, 0x1e, 0xc2, 0xd0, 0x7b, 
+  0x1c, 0x85, 0xde, 0xd3, 0xa1, 0xe9, 0x3d, 0x13, 0x93, 0xde, 0x23, 0x01, 0x22, 0xfd, 0x9a, 0xf4, 
+  0x64, 0xd5, 0xf5, 0x68, 0x35, 0xcd, 0xcf, 0x7a, 0x8b, 0xd9, 0x52, 0x7e, 0x70, 0xa3, 0x08, 0xe7, 
+  0x96, 0x5f, 0xeb, 0x0b, 0xf9, 0x0b, 0xb9, 0x50, 0x7e, 0xa1, 0x8b, 0xfa, 0x17, 0xb5, 0x55, 0xf5, 
+  0xa8, 0x57, 0x75, 0xa7, 0x27, 0xca, 0xee, 0x9e, 0x04, 0x07, 0xf7, 0x24, 0xa8, 0xb8, 0x77, 0x96, 
+  0x5c, 0x71, 0xbb, 0xf4, 0xf7, 0x02, 0xd9, 0xc5, 0xf0, 0x83, 0x9a, 0xd7, 0xb1, 0x17, 0x34, 0x5e, 
+  0x6b, 0xcf, 0xf1, 0x07, 0x6a, 0x91, 0x4c, 0x5a, 0x45, 0x59, 0x93, 0x9e, 0xe8, 0xb1, 0xd9, 0x3b, 
+  0xd8, 0x32, 0xe2, 0x08, 0xba, 0x17, 0xad, 0x22, 0xa2, 0x54, 0x24, 0x56, 0x53, 0x3b, 0x58, 0x64, 
+  0x36, 0x02, 0x91, 0x84, 0x8b, 0xdd, 0x7f, 0x4d, 0x3e, 0xac, 0x3e, 0xac, 0x1f, 0x3f, 0x7a, 0xfc, 
+  0xf8, 0xc3, 0x97, 0x07, 0x7b, 0xd3, 0xc1, 0x4d, 0xe3, 0xfa, 0x0e, 0x63, 0x8b, 0x5d, 0x14, 0xf9, 
+  0x97, 0xab, 0x68, 0x4b, 0xbe, 0x3b, 0x66, 0xbe, 0x9a, 0x7a, 0x36, 0xd1, 0x1f, 0x70, 0xc8, 0xb0, 
+  0x04, 0xae, 0x64, 0x90, 0x06, 0x9c, 0x14, 0x95, 0xd1, 0x4a, 0x58, 0xf3, 0x4a, 0xa6, 0xfc, 0x21, 
+  0x80, 0x34, 0xdf, 0x95, 0x17, 0x5c, 0x4b, 0x82, 0x3a, 0x68, 0xbe, 0x30, 0x11, 0x1a, 0xcd, 0x16, 
+  0x18, 0xa4, 0x90, 0xb5, 0x8d, 0xc0, 0xf1, 0xa9, 0xfe, 0x40, 0x27, 0x25, 0x3a, 0x48, 0x95, 0x82, 
+  0x57, 0x3f, 0xcd, 0x97, 0x8b, 0x37, 0xb0, 0x3e, 0xd4, 0xb6, 0x66, 0xc2, 0x40, 0xc4, 0x74, 0xf7, 
+  0x7d, 0x9c, 0x96, 0x83, 0x41, 0xa8, 0xaf, 0x38, 0x59, 0x08, 0xfb, 0x5c, 0xb0, 0x6b, 0x5d, 0x54, 
+  0x0b, 0x22, 0x35, 0x1a, 0x17, 0x78, 0xa6, 0x44, 0x4e, 0x28, 0xd2, 0x23, 0x1b, 0xdb, 0x1a, 0xbd, 
+  0xe4, 0xba, 0x8f, 0xf5, 0x8b, 0xa2, 0x2b, 0xbe, 0x14, 0xb8, 0x92, 0xe8, 0x33, 0x12, 0xb4, 0x53, 
+  0xa1, 0x25, 0x1c, 0x2d, 0xa2, 0x5f, 0x00, 0xb5, 0x0f, 0xdd, 0xf7, 0x17, 0xae, 0x7f, 0x69, 0xc1, 
+  0xf3, 0xb9, 0xca, 0x4b, 0xfa, 0xc6, 0x22, 0x9d, 0x47, 0x5d, 0x50, 0x5c, 0xa8, 0x05, 0x14, 0x3d, 
+  0x0d, 0x05, 0x5c, 0x49, 0x30, 0x08, 0x12, 0x72, 0x20, 0x08, 0xc1, 0x75, 0xf6, 0xa9, 0xa9, 0xf8, 
+  0xa5, 0x9f, 0xb8, 0x99, 0xe9, 0x13, 0x81, 0xb6, 0xa7, 0x72, 0xe7, 0xd1, 0xed, 0x08, 0x6b, 0x7e, 
+  0x52, 0x8b, 0x91, 0xa0, 0x13, 0x1b, 0xee, 0x1f, 0xca, 0x33, 0xb5, 0xaa, 0x05, 0x40, 0xcc, 0x48, 
+  0x9a, 0x11, 0x67, 0x22, 0x7f, 0x87, 0xf1, 0xf9, 0xc2, 0xfc, 0xf6, 0x3d, 0x89, 0x2e, 0x42, 0x36, 
+  0x92, 0x8e, 0x34, 0xf0, 0x8f, 0xf4, 0xea, 0x8c, 0x81, 0x5e, 0xff, 0xe9, 0x37, 0x94, 0x54, 0x2b, 
+  0xfc, 0xbe, 0x53, 0xe5, 0xf0, 0xc9, 0xf2, 0xc3, 0x3c, 0x3b, 0xa6, 0x6d, 0xdb, 0x89, 0xe5, 0x44, 
+  0x45, 0xc1, 0xfe, 0xd1, 0x0a, 0xc4, 0xaf, 0x55, 0xc6, 0xc9, 0x50, 0x4c, 0x5b, 0xf6, 0x89, 0xbe, 
+  0x8c, 0xe9, 0xf1, 0xa3, 0x4d, 0xc5, 0x2e, 0x25, 0xee, 0x43, 0xd4, 0x7f, 0x84, 0xe7, 0xce, 0xae, 
+  0xbc, 0x4a, 0x8c, 0x4c, 0x72, 0x99, 0xe8, 0x3c, 0x24, 0xfe, 0x9e, 0x82, 0xf3, 0x4b, 0xe0, 0x7b, 
+  0xb8, 0x46, 0xf4, 0x53, 0x12, 0x5d, 0x56, 0x87, 0xa1, 0x3a, 0xe4, 0xcb, 0x2c, 0xfe, 0x9c, 0x12, 
+  0x01, 0xcd, 0x0b, 0x75, 0xc4, 0xd7, 0xfa, 0xdb, 0xce, 0xf8, 0x02, 0x8b, 0x67, 0x74, 0x04, 0x92, 
+  0x08, 0x4a, 0x8b, 0x61, 0x5a, 0x54, 0x63, 0x29, 0x25, 0xe9, 0x3d, 0x54, 0x51, 0x7e, 0x43, 0x51, 
+  0x54, 0x4f, 0xef, 0xd0, 0x8c, 0xbe, 0xd7, 0x6b, 0xc1, 0xe0, 0x5a, 0xdd, 0xdc, 0x54, 0xc1, 0x64, 
+  0x80, 0xa9, 0x82, 0xcf, 0x10, 0x56, 0x44, 0x15, 0x19, 0x9a, 0x3b, 0xdb, 0x7a, 0xd4, 0xb6, 0xc0, 
+  0x32, 0xd4, 0xd3, 0xc7, 0x61, 0xbc, 0xc5, 0x52, 0x47, 0x2b, 0x9b, 0x76, 0x39, 0x60, 0x25, 0x6a, 
+  0x61, 0xb6, 0xf1, 0xed, 0x8d, 0x36, 0x12, 0x0f, 0x90, 0xc0, 0xd5, 0x78, 0x43, 0x52, 0x6f, 0x6e, 
+  0xae, 0xd3, 0x50, 0x11, 0x9f, 0x2f, 0x94, 0x56, 0xf2, 0x57, 0x7b, 0xe2, 0x3d, 0x7e, 0x28, 0xb7, 
+  0xac, 0x2c, 0x3d, 0x64, 0x9c, 0x65, 0xa1, 0x7e, 0xb3, 0x99, 0x5f, 0x91, 0xc2, 0x0b, 0xdc, 0xdf, 
+  0xb8, 0x88, 0x24, 0x68, 0x55, 0xe3, 0x23, 0x33, 0xec, 0xef, 0x8a, 0xff, 0x71, 0x73, 0x0a, 0xaf, 
+  0x5a, 0xa9, 0x15, 0x2f, 0x16, 0x00, 0xfc, 0x9e, 0xbc, 0x20, 0x6e, 0x7a, 0xf8, 0x57, 0x6c, 0x60, 
+  0x00, 0x5f, 0xcf, 0x34, 0xda, 0xe4, 0xd9, 0x8c, 0x88, 0xdf, 0xd8, 0xcf, 0x86, 0xe5, 0x9c, 0xcf, 
+  0xd1, 0xea, 0x66, 0xe0, 0xfc, 0x16, 0xdb, 0xcf, 0xce, 0x8e, 0xae, 0x1b, 0x10, 0xdb, 0xfd, 0x98, 
+  0xdd, 0xaa, 0x6c, 0xbd, 0x62, 0xf8, 0x64, 0x7c, 0xbd, 0x88, 0xc3, 0x64, 0x13, 0x66, 0xc3, 0x7f, 
+  0xb2, 0x9e, 0x93, 0x98, 0xa5, 0x5f, 0xd9, 0x8d, 0xf3, 0x78, 0x01, 0x54, 0x00, 0xf4, 0x69, 0x4d, 
+  0x67, 0xb1, 0xc4, 0x01, 0x5e, 0x70, 0x0c, 0xe0, 0x89, 0x3a, 0x57, 0x33, 0x75, 0xa5, 0x2e, 0xd5, 
+  0xc7, 0xc8, 0x9a, 0x6b, 0x13, 0x62, 0x83, 0x10, 0xd2, 0x6b, 0x93, 0x03, 0x8b, 0xa8, 0x3d, 0x0b, 
+  0xac, 0x50, 0x45, 0xc4, 0x7a, 0x46, 0xb3, 0xb0, 0x37, 0xba, 0x3c, 0x98, 0x89, 0xcf, 0x6d, 0x74, 
+  0x3e, 0xb9, 0x04, 0x88, 0x12, 0x33, 0xe3, 0x07, 0x97, 0xfc, 0xf7, 0xdf, 0x92, 0x1f, 0x0f, 0xa2, 
+  0xc1, 0x80, 0x4e, 0xa7, 0x4b, 0x2a, 0x8e, 0x29, 0x7b, 0x3c, 0xf7, 0x1f, 0x09, 0x00, 0xc7, 0xbd, 
+  0xa3, 0x3c, 0xef, 0x9d, 0xaf, 0xe7, 0xa7, 0x74, 0xda, 0xce, 0xd7, 0xec, 0x12, 0x7a, 0xaf, 0x17, 
+  0x1f, 0xe3, 0x9c, 0xd4, 0x61, 0x27, 0x44, 0x8c, 0x7a, 0xde, 0x20, 0x83, 0x7f, 0x68, 0xbc, 0x3a, 
+  0xeb, 0x31, 0x52, 0xde, 0x0a, 0x00, 0x5f, 0xda, 0x5b, 0x95, 0xba, 0xb0, 0x81, 0x85, 0x17, 0xab, 
+  0xc9, 0x9a, 0x70, 0xf5, 0x4b, 0x70, 0xd6, 0x57, 0x73, 0x72, 0x48, 0xfd, 0xff, 0xc2, 0x91, 0x88, 
+  0xb3, 0xe8, 0x5c, 0x1f, 0x80, 0xd1, 0xde, 0xe6, 0xe3, 0x70, 0x16, 0x6d, 0x81, 0xd0, 0x8b, 0x5c, 
+  0x28, 0x33, 0x80, 0x96, 0x2a, 0x40, 0x45, 0xa5, 0x36, 0x35, 0xc9, 0xce, 0xfe, 0x28, 0x1d, 0x0c, 
+  0x00, 0x1a, 0x3b, 0xc9, 0x48, 0x58, 0xa2, 0xa9, 0xa5, 0xbf, 0xd5, 0x43, 0xf8, 0x15, 0x6f, 0xe8, 
+  0x83, 0x7f, 0x69, 0xe9, 0x7d, 0x8d, 0x78, 0xf4, 0x71, 0xa8, 0xfd, 0x60, 0x23, 0xef, 0xc7, 0xe1, 
+  0xbf, 0x0d, 0xf7, 0x3c, 0xba, 0x33, 0xf3, 0x3d, 0x7d, 0xd3, 0xab, 0x9e, 0x07, 0xf4, 0x53, 0x23, 
+  0xf9, 0x45, 0xd7, 0x0b, 0x44, 0x55, 0xbe, 0xbb, 0x58, 0x10, 0xc1, 0x5f, 0xc1, 0xc9, 0x8d, 0xf8, 
+  0x09, 0xe0, 0x39, 0xbf, 0x64, 0xbd, 0x1f, 0xe3, 0xbe, 0xf0, 0x6d, 0x2c, 0x72, 0x62, 0x72, 0x9e, 
+  0xa6, 0x8b, 0x64, 0xf5, 0x90, 0x44, 0xa0, 0x22, 0xbf, 0x02, 0xda, 0xd0, 0x3e, 0x5e, 0x1b, 0xbb, 
+  0x27, 0xa7, 0x1d, 0xa1, 0xe3, 0xc6, 0xf7, 0x4b, 0xbc, 0x5d, 0x6e, 0xb5, 0x71, 0xc8, 0x8d, 0x66, 
+  0x9c, 0x30, 0xaa, 0x71, 0x4d, 0x1c, 0xf1, 0xab, 0x56, 0xb5, 0x34, 0x55, 0x4b, 0xae, 0x2a, 0x39, 
+  0x63, 0x6b, 0x21, 0xdf, 0x49, 0xd5, 0x4a, 0x59, 0x63, 0x55, 0x92, 0xe1, 0xc7, 0x8f, 0x1c, 0x63, 
+  0xf6, 0xf1, 0x63, 0x44, 0xcb, 0xba, 0xb1, 0xfb, 0x1c, 0x07, 0x73, 0x66, 0x1a, 0x74, 0x48, 0xdc, 
+  0x85, 0xe0, 0x03, 0x60, 0xf2, 0x0f, 0x69, 0x27, 0x99, 0x9b, 0x35, 0x8d, 0x2d, 0x1e, 0xbe, 0x8a, 
+  0x39, 0xa3, 0x56, 0x01, 0xc6, 0x9e, 0x67, 0x22, 0x75, 0xf0, 0xef, 0x45, 0x0e, 0xd7, 0x88, 0x5d, 
+  0x55, 0x16, 0xf5, 0xd3, 0x78, 0xf5, 0xea, 0x32, 0xd3, 0x69, 0x95, 0xaf, 0x68, 0xd1, 0x5f, 0xdb, 
+  0x0e, 0x86, 0x93, 0xe9, 0x26, 0xcd, 0x56, 0x25, 0x62, 0x54, 0x89, 0xfc, 0xca, 0x51, 0x5f, 0x44, 
+  0x1d, 0xa7, 0xdc, 0xdb, 0xab, 0xf3, 0x59, 0xbe, 0xac, 0x42, 0x5b, 0x47, 0xf1, 0xe4, 0x90, 0x4e, 
+  0x90, 0xdd, 0xc7, 0x69, 0x41, 0x24, 0xe9, 0xcb, 0x87, 0xdd, 0x1f, 0x76, 0x53, 0x91, 0x56, 0x0f, 
+  0x13, 0x76, 0xf1, 0x79, 0x70, 0x02, 0xe5, 0xcf, 0xd8, 0xfb, 0x35, 0xb9, 0x9a, 0xe5, 0x71, 0x21, 
+  0x88, 0x43, 0x24, 0xd0, 0xbd, 0x7b, 0x26, 0xd3, 0xec, 0x4d, 0xa3, 0x89, 0xc7, 0xfc, 0x21, 0x89, 
+  0x16, 0x9a, 0x71, 0x94, 0x5f, 0xcc, 0x3a, 0x92, 0x90, 0x11, 0x0f, 0x5f, 0x80, 0xdf, 0x94, 0xe2, 
+  0x91, 0xf7, 0xff, 0x80, 0x8b, 0xad, 0x73, 0xa3, 0x24, 0x16, 0xb7, 0xa5, 0x72, 0x17, 0xcb, 0x59, 
+  0x36, 0xd6, 0x1e, 0xd4, 0x73, 0x06, 0x7e, 0x32, 0x3b, 0x28, 0x46, 0x19, 0xed, 0xa3, 0xd5, 0x04, 
+  0x8b, 0x63, 0x1a, 0x25, 0xfa, 0x4c, 0x67, 0x5c, 0xc2, 0x88, 0x61, 0xf5, 0x31, 0xe8, 0x42, 0xc3, 
+  0x11, 0x85, 0xad, 0x16, 0xd1, 0x97, 0xc4, 0x31, 0x0a, 0xb8, 0x7a, 0x9e, 0x1f, 0x89, 0x28, 0x7d, 
+  0x49, 0x9a, 0xa6, 0xa3, 0x45, 0xfa, 0xd9, 0xe3, 0x7c, 0x5a, 0x5b, 0x70, 0x82, 0x52, 0xf8, 0x89, 
+  0xb8, 0x26, 0xb5, 0x0f, 0x5f, 0x7e, 0x9c, 0xf7, 0x77, 0x76, 0x26, 0xe9, 0x71, 0xef, 0xa4, 0xec, 
+  0x3d, 0x7b, 0x44, 0x34, 0xa8, 0x37, 0x00, 0x42, 0xef, 0xf4, 0x1f, 0x07, 0xe9, 0x3f, 0x0e, 0x76, 
+  0xe9, 0xbf, 0xfe, 0x84, 0x04, 0xb0, 0xf4, 0x78, 0xba, 0xb3, 0x43, 0x85, 0x49, 0xea, 0xcb, 0x38, 
+  0xe4, 0xc4, 0x2c, 0xed, 0x9f, 0x0e, 0x40, 0x3f, 0xaf, 0x92, 0x0d, 0x51, 0x9c, 0x8b, 0x68, 0xf7, 
+  0xc3, 0xdb, 0x01, 0xf1, 0xc6, 0x5a, 0x3f, 0xf6, 0x6c, 0x1e, 0x4e, 0xa0, 0x3a, 0x3f, 0x85, 0xc3, 
+  0x19, 0xf2, 0x30, 0x7d, 0x2c, 0xf3, 0x33, 0xa4, 0xac, 0xdc, 0xfd, 0xd7, 0xc7, 0x8f, 0xda, 0xe5, 
+  0xe9, 0x77, 0xe2, 0xdf, 0x8e, 0xb5, 0x49, 0xf9, 0x08, 0x4f, 0xfd, 0x8f, 0xc3, 0xfb, 0xc1, 0xf8, 
+  0xce, 0xee, 0x54, 0x1d, 0x86, 0x5b, 0xc3, 0x63, 0x34, 0x7a, 0x46, 0x23, 0x95, 0x6e, 0x69, 0xd2, 
+  0xbe, 0x33, 0xee, 0x4c, 0xc1, 0x51, 0xe7, 0x0f, 0xc2, 0x8e, 0x05, 0x2a, 0xec, 0x6a, 0xb5, 0xea, 
+  0xb5, 0xe4, 0x3f, 0xee, 0x14, 0x27, 0xb6, 0x14, 0x36, 0xd4, 0x82, 0x8e, 0xe2, 0x6d, 0xd0, 0xa4, 
+  0x3c, 0xfd, 0x49, 0x73, 0xfa, 0x71, 0x7e, 0x80, 0x42, 0x80, 0xf3, 0x34, 0xbc, 0xa4, 0xb5, 0x7f, 
+  0x6d, 0xd4, 0xf3, 0xd9, 0x7f, 0xf5, 0xb3, 0x79, 0xe9, 0x35, 0xbf, 0xdc, 0xa2, 0x83, 0x22, 0x01, 
+  0x98, 0x71, 0x4e, 0x4d, 0x48, 0xa6, 0x9c, 0x75, 0x62, 0x9f, 0x81, 0x5e, 0x3c, 0x90, 0x5c, 0xc8, 
+  0x7b, 0x07, 0xd9, 0x38, 0x31, 0x19, 0xa7, 0x32, 0xb5, 0x1f, 0x84, 0xac, 0x4f, 0xe0, 0x3c, 0x81, 
+  0x12, 0xff, 0x41, 0x8c, 0xe1, 0xbc, 0x23, 0xf4, 0x78, 0x62, 0x5f, 0x44, 0x8b, 0x56, 0xa8, 0x53, 
+  0xd2, 0x22, 0x4a, 0x0f, 0x58, 0xbc, 0x87, 0x4f, 0x7f, 0x69, 0xf3, 0x61, 0x02, 0x8e, 0x4a, 0xbd, 
+  0x98, 0x6d, 0x81, 0x98, 0x13, 0x28, 0x94, 0xc4, 0xee, 0x2a, 0x3a, 0x9b, 0x18, 0x02, 0x57, 0x8f, 
+  0x42, 0x7a, 0x90, 0xcb, 0xe9, 0xa4, 0xf1, 0x4c, 0xaa, 0x91, 0x48, 0xa7, 0x2a, 0xad, 0x00, 0x00, 
+  0x8b, 0x8d, 0x3a, 0xfe, 0x1f, 0xbe, 0xa2, 0xd9, 0x36, 0x9c, 0x05, 0xe5, 0x1b, 0x38, 0x8c, 0xaf, 
+  0x7a, 0xd1, 0xc9, 0xac, 0x0d, 0xdf, 0x0a, 0xff, 0xf2, 0x3a, 0xf1, 0x0c, 0x12, 0xae, 0xad, 0x05, 
+  0x39, 0x1e, 0x7b, 0x1b, 0x03, 0x7e, 0x0b, 0xf9, 0x48, 0xf4, 0x87, 0xd6, 0x0f, 0x18, 0xf5, 0x2a, 
+  0xde, 0xf2, 0x71, 0x32, 0xea, 0xf8, 0xf7, 0xce, 0x0c, 0xf6, 0x35, 0xf8, 0xfc, 0x1e, 0xec, 0x8d, 
+  0x79, 0x42, 0x35, 0x04, 0x0c, 0xd2, 0x87, 0xda, 0x29, 0x2f, 0x14, 0x60, 0xdc, 0x7e, 0x8e, 0x43, 
+  0xfa, 0x4e, 0x56, 0xbe, 0x84, 0x09, 0x62, 0xf0, 0x5f, 0x9b, 0x0d, 0xf0, 0xea, 0x38, 0x2c, 0xd5, 
+  0xd7, 0x59, 0x98, 0x8d, 0x4b, 0x7a, 0xf2, 0x2a, 0x3c, 0x56, 0x4f, 0xdb, 0xaf, 0x66, 0x84, 0x34, 
+  0xbb, 0x06, 0x8d, 0x95, 0x38, 0xd2, 0xd0, 0x29, 0x45, 0xe3, 0xc4, 0x2d, 0xd8, 0x4a, 0x0b, 0x9f, 
+  0x84, 0x8e, 0x85, 0x6c, 0xb1, 0xa3, 0x36, 0xea, 0xed, 0xac, 0xb6, 0xec, 0x18, 0x19, 0x47, 0x7b, 
+  0x70, 0x6b, 0x8f, 0xee, 0x8f, 0xda, 0x68, 0x0d, 0xe3, 0x80, 0xef, 0x3e, 0xa2, 0x4f, 0xfa, 0xa3, 
+  0x5d, 0x5b, 0x16, 0x2e, 0xa3, 0xf1, 0xd3, 0xf8, 0x2c, 0x91, 0x70, 0x32, 0x60, 0x17, 0xf6, 0xa4, 
+  0xe5, 0x9e, 0x7e, 0x73, 0xf3, 0x25, 0x09, 0xb6, 0xd1, 0xdb, 0xce, 0x8d, 0x5e, 0xd6, 0xac, 0xf4, 
+  0x1f, 0x49, 0xd4, 0xe1, 0x8d, 0x5f, 0x7d, 0x11, 0xad, 0xfa, 0xc3, 0xf8, 0xbb, 0x88, 0x87, 0x00, 
+  0x7b, 0x99, 0x86, 0xb5, 0x12, 0x1d, 0x8d, 0x89, 0xb7, 0x3c, 0x7f, 0x2d, 0x70, 0x89, 0x53, 0x3d, 
+  0xa3, 0x63, 0x7e, 0x5b, 0x1e, 0x84, 0x36, 0x41, 0x26, 0x86, 0x6f, 0x1d, 0xb7, 0x97, 0x25, 0xbe, 
+  0xfb, 0xad, 0x5e, 0x17, 0xdf, 0x5c, 0x78, 0xee, 0xf7, 0xf0, 0xfa, 0xdb, 0xa8, 0xf7, 0xf3, 0x4e, 
+  0x7a, 0xe2, 0xa8, 0x40, 0x81, 0xc4, 0xca, 0xa9, 0x60, 0xf6, 0x2c, 0x43, 0xe9, 0x92, 0xb4, 0x4c, 
+  0x4c, 0x57, 0x85, 0x8b, 0x15, 0x9d, 0x53, 0x07, 0xe2, 0xaa, 0x03, 0xf9, 0x41, 0x3c, 0xca, 0x41, 
+  0xe8, 0x1a, 0xbe, 0xff, 0xc8, 0x32, 0x54, 0x04, 0x3a, 0x2e, 0x0e, 0x35, 0xb2, 0x66, 0x8d, 0xda, 
+  0x72, 0x80, 0x06, 0x1a, 0x76, 0xc9, 0x77, 0x1d, 0xc3, 0x90, 0xd4, 0x7a, 0x56, 0x46, 0x7f, 0xe3, 
+  0x88, 0x8f, 0xca, 0x94, 0xe0, 0xe6, 0x1f, 0xb9, 0xb9, 0x29, 0x47, 0x89, 0x55, 0x56, 0x27, 0xf5, 
+  0x08, 0x05, 0xc8, 0x4a, 0x48, 0xfd, 0xa4, 0x37, 0xd3, 0x1e, 0xf2, 0xf5, 0xf1, 0x3a, 0xdd, 0x3f, 
+  0x70, 0xeb, 0x24, 0x15, 0xf7, 0xdc, 0x51, 0x59, 0x3f, 0xdb, 0xc1, 0xa8, 0x55, 0xf5, 0xec, 0xd8, 
+  0x62, 0xc4, 0x68, 0x6d, 0xb8, 0x8d, 0x48, 0xba, 0x49, 0xcb, 0xed, 0x8f, 0x32, 0x18, 0xc5, 0x46, 
+  0x86, 0x56, 0xb0, 0x10, 0x99, 0x0d, 0x33, 0xda, 0xcf, 0x6f, 0xd3, 0xd9, 0x92, 0x64, 0x8d, 0x51, 
+  0x62, 0x5c, 0x7a, 0x4c, 0x1c, 0x1a, 0x68, 0xc8, 0x9f, 0xcd, 0xc9, 0x5c, 0x1c, 0xfc, 0xc7, 0xb8, 
+  0x99, 0x4b, 0xcb, 0xc0, 0x5d, 0x23, 0x9f, 0x56, 0x58, 0xa1, 0x5f, 0x43, 0x06, 0x38, 0x9c, 0x85, 
+  0xb7, 0xa0, 0x48, 0x8b, 0xd1, 0xef, 0x4a, 0x70, 0xd6, 0x59, 0xaf, 0x32, 0x96, 0x3f, 0xec, 0xbd, 
+  0x55, 0xe6, 0x1a, 0x0e, 0xb1, 0x52, 0xa4, 0x88, 0x1e, 0xee, 0x4b, 0x6c, 0x34, 0x70, 0xfc, 0xeb, 
+  0xce, 0xee, 0x89, 0xa8, 0x57, 0x8e, 0xb6, 0x28, 0x77, 0x25, 0x11, 0xa0, 0xa7, 0xfa, 0x96, 0x21, 
+  0xfb, 0x87, 0x1d, 0x41, 0x3e, 0xc4, 0xd6, 0x33, 0x51, 0xfe, 0x00, 0x0f, 0xc3, 0x3c, 0x60, 0xa9, 
+  0x5f, 0xad, 0x17, 0x1d, 0x2b, 0xc3, 0x39, 0xa8, 0xfb, 0x9c, 0x41, 0x64, 0xbf, 0x91, 0xf6, 0xcb, 
+  0xa4, 0x1f, 0x18, 0xc9, 0x41, 0x9c, 0x67, 0x65, 0x4c, 0xeb, 0xd4, 0x9a, 0x68, 0xec, 0x1d, 0x5f, 
+  0x5c, 0xce, 0xec, 0xc6, 0x70, 0x0d, 0x99, 0x61, 0x12, 0x98, 0xea, 0xe7, 0xb8, 0x6b, 0xa8, 0x8e, 
+  0xb1, 0x01, 0xd9, 0x9c, 0x49, 0xff, 0x1e, 0x45, 0xfe, 0xfe, 0xbf, 0xdf, 0xdd, 0x5a, 0x10, 0x14, 
+  0x4c, 0x16, 0x9c, 0x98, 0x46, 0xcb, 0x96, 0xc9, 0xd4, 0x44, 0x34, 0xd0, 0x7c, 0xbf, 0xe9, 0x9c, 
+  0x2f, 0x90, 0x84, 0x35, 0x12, 0xfd, 0x26, 0x4d, 0x63, 0x77, 0xc3, 0x5a, 0xbb, 0x51, 0x9f, 0x16, 
+  0x61, 0x57, 0xb0, 0x04, 0x5a, 0x78, 0x0e, 0xdd, 0x02, 0x7e, 0xbc, 0x99, 0x51, 0xc1, 0xd7, 0x5d, 
+  0x2f, 0xe2, 0x3c, 0x58, 0xa5, 0xf0, 0xa6, 0xce, 0xcf, 0x7a, 0xa0, 0xd5, 0x46, 0x7d, 0x9d, 0x77, 
+  0xf7, 0x32, 0xcf, 0x58, 0xba, 0x1e, 0x77, 0xc7, 0x52, 0x24, 0xdd, 0x89, 0x4b, 0x1d, 0x7c, 0x4d, 
+  0x76, 0x7d, 0xb6, 0xcd, 0x80, 0x65, 0xd1, 0x3f, 0xb5, 0x2f, 0x6f, 0x98, 0x30, 0xf8, 0x8c, 0xd6, 
+  0xba, 0x20, 0x88, 0xb1, 0x73, 0xbd, 0x39, 0x8a, 0x19, 0x7c, 0xee, 0xd7, 0xb9, 0x10, 0x53, 0x62, 
+  0xb5, 0xec, 0x9a, 0xee, 0xd0, 0xdf, 0xce, 0x9d, 0x05, 0x4f, 0x45, 0x03, 0xf5, 0xb8, 0xfe, 0x95, 
+  0xdd, 0x0a, 0xa5, 0x6f, 0xf5, 0x59, 0x41, 0x2d, 0xfb, 0xb4, 0x91, 0x2b, 0xda, 0x65, 0x04, 0xbe, 
+  0x02, 0x2a, 0x8d, 0x3d, 0x82, 0xa3, 0x25, 0x3c, 0xbf, 0xac, 0xb8, 0x3d, 0xec, 0x90, 0xae, 0x6f, 
+  0x6e, 0x90, 0x56, 0xfc, 0x88, 0x51, 0x6b, 0x32, 0x38, 0xc9, 0x18, 0x46, 0xda, 0xda, 0xe4, 0xca, 
+  0x16, 0x3e, 0x2c, 0xef, 0x99, 0xca, 0x7d, 0x03, 0x2e, 0xc3, 0x24, 0x9c, 0x73, 0x11, 0xed, 0x6c, 
+  0xae, 0x55, 0x22, 0x3f, 0x23, 0xd6, 0x96, 0x24, 0xac, 0x45, 0x9e, 0xac, 0xb2, 0x7b, 0x30, 0x0b, 
+  0x5c, 0xc0, 0x95, 0xb9, 0xd7, 0x6c, 0xb0, 0x97, 0x17, 0x3d, 0xa7, 0x11, 0x8d, 0xa0, 0xd7, 0xf4, 
+  0x1b, 0xd6, 0xf2, 0x77, 0xc2, 0x4e, 0xf1, 0x0c, 0x76, 0x9e, 0x8c, 0x6a, 0x2f, 0xf7, 0x73, 0x44, 
+  0xd2, 0x62, 0x08, 0x9e, 0x0d, 0xbf, 0xc6, 0x6e, 0xd2, 0x0c, 0x1a, 0xd5, 0xe1, 0x22, 0xa9, 0x17, 
+  0xdc, 0x04, 0x82, 0x1e, 0xd0, 0xfe, 0x3e, 0x06, 0xa0, 0xed, 0xef, 0x6b, 0x56, 0x6d, 0x1d, 0xad, 
+  0x6f, 0x6e, 0xfc, 0x0e, 0x09, 0xe3, 0x88, 0x8e, 0x27, 0x78, 0x3b, 0x0b, 0x46, 0xbe, 0x07, 0x53, 
+  0x14, 0x31, 0x0a, 0x7c, 0x77, 0xb2, 0x9e, 0x32, 0xcb, 0xb3, 0x51, 0x8f, 0x3b, 0xd8, 0x44, 0xe0, 
+  0xca, 0xf6, 0x1d, 0xe2, 0x52, 0x1b, 0x33, 0x0d, 0x50, 0xd9, 0x3b, 0x5f, 0xaf, 0xca, 0xde, 0x2c, 
+  0xe9, 0xc5, 0xbd, 0x87, 0xaf, 0x5e, 0xf4, 0x50, 0xb6, 0x77, 0x49, 0x42, 0x16, 0x7b, 0x94, 0x42, 
+  0x91, 0xa4, 0xad, 0x1a, 0xee, 0x80, 0x65, 0x32, 0xe9, 0x7d, 0x93, 0x09, 0x94, 0x48, 0x11, 0x06, 
+  0xe3, 0x35, 0x03, 0x81, 0xf6, 0x13, 0x0d, 0xd8, 0x23, 0x82, 0xb3, 0xd7, 0x6f, 0x46, 0x3b, 0xe2, 
+  0x89, 0xc9, 0x5d, 0xd0, 0x8f, 0x60, 0xc3, 0x10, 0xcf, 0x6b, 0x9b, 0x99, 0xb1, 0x1f, 0xb9, 0xba, 
+  0x9b, 0xee, 0xc5, 0xd4, 0x87, 0x26, 0x37, 0xe3, 0xe0, 0xf1, 0xf6, 0x80, 0x55, 0xb2, 0x2c, 0x2f, 
+  0x95, 0xeb, 0x5a, 0xa9, 0xbe, 0xe3, 0xa8, 0x9c, 0xae, 0x2e, 0xb0, 0x83, 0x3b, 0x56, 0xd4, 0xd1, 
+  0x69, 0xc2, 0xab, 0x68, 0x99, 0x26, 0x8b, 0x9e, 0x19, 0xaa, 0xe6, 0xf2, 0xaa, 0xd5, 0xa7, 0xb1, 
+  0xa1, 0x6f, 0xa9, 0xbf, 0xda, 0xd7, 0x01, 0x9c, 0x90, 0x8f, 0xb5, 0xf6, 0x01, 0xe8, 0xf7, 0x59, 
+  0x5a, 0xca, 0xe3, 0x52, 0xf5, 0xf7, 0xf0, 0xbf, 0xcb, 0x44, 0xed, 0xd9, 0xff, 0xef, 0xef, 0x57, 
+  0xff, 0xdb, 0x43, 0xb6, 0x9d, 0x46, 0x47, 0x61, 0x5f, 0x32, 0x51, 0xf2, 0xcc, 0x78, 0xf3, 0x38, 
+  0x07, 0xfa, 0xaf, 0xf1, 0xb6, 0x71, 0x77, 0x0e, 0xf3, 0xae, 0xc9, 0x7f, 0x61, 0xdf, 0xe8, 0x39, 
+  0xc7, 0xf4, 0x1b, 0x44, 0xf6, 0x91, 0xd3, 0x88, 0xcf, 0x9b, 0xa2, 0xd4, 0xdd, 0x38, 0x82, 0x65, 
+  0xc4, 0x1a, 0xbf, 0x40, 0xac, 0xb6, 0xd0, 0xd8, 0x97, 0x9c, 0xc2, 0x10, 0x07, 0xf4, 0x46, 0xdd, 
+  0x99, 0xdd, 0x56, 0x66, 0x78, 0x29, 0xa5, 0x1e, 0xcd, 0xba, 0xc9, 0x0f, 0x7b, 0x00, 0x75, 0x79, 
+  0x68, 0x0e, 0x39, 0xa3, 0x10, 0xf6, 0x57, 0x00, 0x73, 0xb9, 0x73, 0x3d, 0xa1, 0xed, 0x43, 0xfb, 
+  0xcf, 0x03, 0x2c, 0x1e, 0xb8, 0x38, 0x6f, 0xaa, 0xb4, 0x58, 0xd9, 0xad, 0xf4, 0x32, 0x64, 0xa0, 
+  0x6a, 0x81, 0x1d, 0xc1, 0x82, 0xb6, 0xc3, 0xbb, 0x2e, 0xc2, 0xa7, 0x0d, 0xdc, 0x6d, 0x7f, 0x8f, 
+  0x97, 0xe3, 0xd4, 0x77, 0xee, 0x2a, 0x4f, 0xdf, 0xf6, 0xf8, 0x13, 0xc2, 0x14, 0xf9, 0x65, 0xaa, 
+  0xcc, 0x7a, 0x7c, 0x13, 0xda, 0x85, 0xed, 0xd2, 0xf4, 0x1c, 0xc1, 0x95, 0x5a, 0x7b, 0x4e, 0x53, 
+  0x0e, 0x86, 0xec, 0x2a, 0x41, 0x12, 0xf6, 0xc8, 0xd3, 0x5b, 0x12, 0x14, 0xf9, 0xd4, 0x11, 0x51, 
+  0x60, 0xac, 0xea, 0x17, 0x37, 0x37, 0x3f, 0x02, 0x79, 0xaa, 0xc2, 0x9d, 0x43, 0x21, 0x87, 0x73, 
+  0x23, 0x96, 0x6d, 0x8c, 0x5b, 0x6b, 0x58, 0x11, 0x26, 0xcd, 0x23, 0x5a, 0x16, 0x32, 0x7c, 0x41, 
+  0x85, 0xe5, 0x0d, 0xa6, 0x50, 0x9e, 0x33, 0x36, 0x52, 0xc6, 0x83, 0xf7, 0x75, 0xc1, 0x91, 0x8f, 
+  0x7f, 0xcc, 0xbb, 0x78, 0x60, 0x84, 0xda, 0x45, 0xa5, 0x5a, 0x1c, 0x44, 0xff, 0x11, 0xe0, 0x28, 
+  0xb5, 0xbc, 0x3c, 0xc6, 0xc9, 0x72, 0x65, 0x93, 0xbb, 0x07, 0xff, 0xb8, 0xe7, 0x4d, 0x89, 0x0f, 
+  0x6b, 0x2f, 0x07, 0xef, 0xee, 0xff, 0x21, 0xd2, 0x3b, 0x44, 0x28, 0x08, 0xc2, 0xe9, 0x1f, 0x94, 
+  0xfe, 0x5e, 0x30, 0xf0, 0x46, 0x1e, 0x10, 0x82, 0xc5, 0x89, 0xd8, 0x72, 0x92, 0x2b, 0xbf, 0xad, 
+  0xbf, 0x3a, 0x60, 0xe2, 0xd4, 0xe3, 0x7e, 0xdc, 0x63, 0x75, 0xf8, 0xbd, 0xdd, 0x7f, 0x78, 0x82, 
+  0xed, 0xe9, 0xc4, 0x41, 0xaa, 0xaf, 0x75, 0xbe, 0xe3, 0xef, 0x07, 0xd1, 0x82, 0xfd, 0xcb, 0xf6, 
+  0xeb, 0x0c, 0x56, 0xe8, 0x32, 0x3e, 0x81, 0xb8, 0x40, 0x38, 0xde, 0xa4, 0x5f, 0xf3, 0xfc, 0x3c, 
+  0x72, 0x2f, 0xa0, 0xd9, 0xa8, 0xb7, 0x4c, 0xc3, 0xb2, 0xa8, 0x52, 0x16, 0x4a, 0x49, 0x76, 0x91, 
+  0x19, 0xd5, 0xae, 0x22, 0xc4, 0xa2, 0xb8, 0xd7, 0x80, 0xce, 0x7f, 0xd5, 0xe4, 0x26, 0x13, 0xbd, 
+  0x30, 0xc0, 0x1f, 0x54, 0x6b, 0xa4, 0x92, 0xba, 0x26, 0xcc, 0xd6, 0x93, 0x74, 0x4e, 0x5c, 0x1b, 
+  0x14, 0x3b, 0xd6, 0xed, 0xde, 0x02, 0xf7, 0x6e, 0xd4, 0x32, 0xde, 0x22, 0xc4, 0x52, 0xe5, 0xad, 
+  0x72, 0xa8, 0x56, 0x52, 0x38, 0x0a, 0x03, 0x62, 0x76, 0x1f, 0xc6, 0x5d, 0xdb, 0xb9, 0x18, 0x8b, 
+  0xf6, 0x16, 0x36, 0x22, 0xda, 0xcd, 0x7f, 0x2c, 0x42, 0xe2, 0x38, 0xa3, 0x85, 0xfa, 0x73, 0x11, 
+  0xfe, 0x07, 0xff, 0x78, 0x1f, 0x2e, 0xd4, 0xaf, 0xf3, 0xad, 0x52, 0xab, 0x91, 0xa3, 0xb7, 0x29, 
+  0x20, 0x4d, 0x1a, 0x6a, 0x6d, 0xad, 0xfe, 0x46, 0x71, 0x03, 0x24, 0x0e, 0xd8, 0x03, 0xe8, 0x9a, 
+  0x5b, 0xfb, 0x78, 0xdc, 0xc5, 0x56, 0xca, 0x3a, 0x06, 0x47, 0xdf, 0x19, 0x92, 0x6c, 0x13, 0x6c, 
+  0x02, 0x65, 0x79, 0xc3, 0xa2, 0x35, 0x31, 0x0d, 0x8e, 0xb1, 0x63, 0xef, 0x20, 0xca, 0x47, 0xf9, 
+  0xce, 0x4e, 0x50, 0x88, 0xcc, 0x88, 0x10, 0x3a, 0x91, 0xa3, 0x70, 0xe5, 0xe8, 0x23, 0x5e, 0x74, 
+  0xb1, 0xbf, 0x5d, 0xe9, 0x5e, 0xb5, 0x82, 0xe1, 0x70, 0xc6, 0x0e, 0xf9, 0x67, 0x74, 0xe7, 0x2c, 
+  0x11, 0xab, 0xf8, 0xd8, 0xfc, 0xe0, 0xf4, 0x6f, 0xc9, 0x65, 0xcf, 0x18, 0xc5, 0x7d, 0x4f, 0xbf, 
+  0x07, 0x78, 0xed, 0x7e, 0xa0, 0xc1, 0x10, 0x8f, 0xe7, 0x9d, 0xaa, 0x96, 0x33, 0x70, 0x0d, 0x67, 
+  0x58, 0x82, 0x78, 0x75, 0x7a, 0x7c, 0x55, 0x3f, 0x33, 0x0e, 0xe3, 0x0c, 0x01, 0x27, 0x70, 0x3a, 
+  0xef, 0xb1, 0x41, 0xde, 0x96, 0x23, 0x69, 0xab, 0xf7, 0x36, 0x3f, 0x4f, 0x7a, 0x33, 0x39, 0x56, 
+  0x56, 0x3d, 0xcc, 0xc5, 0x50, 0x41, 0x15, 0x7c, 0xd0, 0xfb, 0x5b, 0x40, 0xc7, 0x8c, 0x7b, 0xc8, 
+  0xa4, 0xd8, 0x9b, 0x38, 0xd3, 0x97, 0x57, 0xaa, 0x47, 0x9b, 0xb8, 0x77, 0x95, 0xaf, 0x89, 0xeb, 
+  0xc8, 0x7a, 0x50, 0xa0, 0xcf, 0xd1, 0x0e, 0xd8, 0xed, 0xde, 0xec, 0xaa, 0x27, 0x8e, 0x62, 0xc4, 
+  0xa1, 0xe8, 0xe0, 0x98, 0x02, 0xc6, 0x9c, 0x04, 0x68, 0x98, 0x65, 0xce, 0x91, 0x32, 0x3f, 0x0c, 
+  0x3f, 0xad, 0x54, 0x0f, 0x4a, 0x79, 0x84, 0x0c, 0x00, 0x0b, 0x5b, 0x40, 0x52, 0x4e, 0xcb, 0xf2, 
+  0x22, 0xdc, 0xdd, 0xbd, 0xbc, 0xbc, 0xe4, 0x28, 0x94, 0x61, 0x5e, 0x9c, 0xec, 0x9a, 0xf2, 0x95, 
+  0x6b, 0x97, 0xfb, 0xad, 0x7e, 0xb5, 0xab, 0xd8, 0x6d, 0xe6, 0xe5, 0x62, 0x8b, 0x26, 0xcc, 0x67, 
+  0x73, 0x2d, 0x07, 0xac, 0x01, 0x6a, 0x8f, 0x83, 0xd7, 0x10, 0x68, 0x46, 0xa7, 0xfb, 0x7c, 0xb9, 
+  0x5e, 0x68, 0xa0, 0x1c, 0x9d, 0x94, 0xe0, 0xd9, 0x1c, 0x2a, 0x40, 0x76, 0xe3, 0xb0, 0x87, 0x96, 
+  0x0b, 0x3d, 0xea, 0x21, 0xf0, 0x84, 0x0f, 0x32, 0xcd, 0x46, 0x21, 0x16, 0x20, 0x61, 0x04, 0x8f, 
+  0x3c, 0xb3, 0x9b, 0xba, 0xca, 0x3e, 0x25, 0xeb, 0x2a, 0x46, 0x12, 0x2a, 0xab, 0x68, 0x59, 0x71, 
+  0xe5, 0x5f, 0x61, 0xc0, 0xe5, 0x94, 0x54, 0x6a, 0x1d, 0xad, 0x6a, 0xc5, 0xd7, 0xa3, 0x35, 0x96, 
+  0xe1, 0x64, 0x45, 0x4c, 0x23, 0xaf, 0x57, 0x20, 0x59, 0xd2, 0x4f, 0x49, 0xb9, 0xe4, 0x10, 0x11, 
+  0xb4, 0x36, 0xef, 0x30, 0x08, 0x70, 0x27, 0x2b, 0x1a, 0xb3, 0x64, 0xbc, 0x1d, 0x4d, 0xa9, 0xc0, 
+  0xa1, 0x2c, 0xe3, 0x2b, 0x60, 0xb5, 0x64, 0x74, 0xa4, 0xcd, 0x75, 0xdf, 0xa3, 0x9c, 0x7e, 0x0a, 
+  0x6e, 0x63, 0x24, 0x00, 0x1f, 0xb4, 0xc3, 0x69, 0x01, 0xb7, 0x1b, 0xb7, 0x9b, 0x59, 0x82, 0x13, 
+  0x25, 0x04, 0xdf, 0xd3, 0x99, 0x81, 0x22, 0x24, 0xed, 0x91, 0xf4, 0x6f, 0xe8, 0xe5, 0xf1, 0x5c, 
+  0x4f, 0x53, 0x39, 0x59, 0x02, 0x08, 0x62, 0x5e, 0x53, 0x26, 0xd1, 0xc9, 0x77, 0xec, 0x17, 0x9d, 
+  0x70, 0xd1, 0x5b, 0x5f, 0x3b, 0xca, 0x1a, 0xef, 0xcd, 0xe4, 0xbd, 0x74, 0x34, 0x9b, 0xb4, 0x73, 
+  0x8d, 0xb7, 0x00, 0x0c, 0x41, 0x7d, 0x11, 0x9f, 0xba, 0xda, 0x83, 0x79, 0x40, 0x75, 0xc4, 0x2f, 
+  0xa9, 0x4c, 0x8a, 0xb1, 0xf3, 0x9b, 0x1e, 0x85, 0x73, 0x7d, 0xe9, 0x07, 0xaa, 0x5b, 0x2a, 0x9b, 
+  0xbb, 0x19, 0xd0, 0x74, 0x46, 0x47, 0xdd, 0x2e, 0x4b, 0x64, 0x8e, 0x71, 0xf9, 0xb4, 0x26, 0x3a, 
+  0xce, 0xb7, 0xc8, 0xa8, 0x30, 0xa6, 0xb0, 0x85, 0x74, 0x5d, 0xa6, 0xcb, 0x15, 0xec, 0xa3, 0xb1, 
+  0x7b, 0x63, 0x18, 0x43, 0x7d, 0xfc, 0x38, 0x2f, 0x1e, 0xc5, 0x00, 0xe0, 0x63, 0xca, 0xd2, 0xf1, 
+  0x1c, 0x8c, 0x85, 0x3c, 0x7d, 0x3e, 0xeb, 0x7a, 0x8c, 0xc0, 0x42, 0x79, 0x7e, 0xdc, 0xf1, 0xfc, 
+  0x49, 0x52, 0x3e, 0x24, 0x0e, 0x8a, 0xb6, 0x46, 0xc9, 0x49, 0xd8, 0xa5, 0x1b, 0xc3, 0xcf, 0xf3, 
+  0x76, 0xd1, 0x67, 0x62, 0x11, 0x91, 0x02, 0x0f, 0xda, 0xcf, 0x39, 0x7f, 0x2e, 0x9e, 0xbd, 0xe8, 
+  0x78, 0xcf, 0x6b, 0x22, 0xac, 0x0f, 0x96, 0x4b, 0x29, 0x70, 0xd2, 0x51, 0xe0, 0x0d, 0x0f, 0xe8, 
+  0xb3, 0x32, 0x39, 0x97, 0x32, 0xa7, 0xf5, 0x32, 0x56, 0x01, 0xaa, 0x3b, 0x78, 0x58, 0x1f, 0x2a, 
+  0x59, 0x3b, 0x72, 0xa6, 0xbd, 0x2a, 0x44, 0xe2, 0x96, 0x82, 0x0f, 0xeb, 0x05, 0x45, 0xd7, 0x2d, 
+  0x8f, 0xe4, 0x77, 0xed, 0xf1, 0x31, 0xd3, 0x86, 0x67, 0x42, 0x28, 0x16, 0x88, 0xe7, 0xff, 0x85, 
+  0x88, 0xd2, 0xeb, 0xdc, 0x0c, 0xf1, 0xb3, 0xfa, 0xb8, 0xd0, 0x71, 0x46, 0xf3, 0x73, 0x2e, 0x14, 
+  0x45, 0x4a, 0xfc, 0x5a, 0x2f, 0x21, 0x44, 0xc5, 0x0e, 0xcd, 0xd3, 0x7a, 0x6f, 0x2e, 0x92, 0xe4, 
+  0xec, 0xd5, 0x8c, 0x08, 0xf2, 0x67, 0xce, 0x2e, 0xac, 0x44, 0x7d, 0x5f, 0x2f, 0x42, 0xef, 0xfe, 
+  0x65, 0x25, 0xe6, 0xf3, 0x78, 0xf8, 0xb2, 0xde, 0x5d, 0x71, 0xc0, 0xb2, 0x4f, 0x5f, 0xd4, 0x9f, 
+  0x16, 0xc9, 0x09, 0xc4, 0x59, 0x11, 0x10, 0x75, 0x4a, 0x1c, 0xdd, 0x8d, 0x5a, 0x39, 0x4b, 0x62, 
+  0xab, 0x96, 0x8e, 0xeb, 0x5f, 0x51, 0xb0, 0x73, 0x09, 0x3f, 0x79, 0x55, 0x7f, 0x87, 0xa4, 0x57, 
+  0x7d, 0x98, 0x9f, 0x63, 0x6e, 0x0e, 0x57, 0x92, 0x1d, 0x54, 0x4a, 0x3e, 0xaa, 0x7f, 0x48, 0x4d, 
+  0x5a, 0x15, 0xc7, 0x89, 0x7a, 0x01, 0x81, 0x17, 0x69, 0x0e, 0x47, 0xd7, 0x70, 0xd6, 0xf6, 0xc4, 
+  0xab, 0xfa, 0x5a, 0x5a, 0x2c, 0x5e, 0x15, 0xcd, 0xb5, 0xf4, 0xaa, 0x3e, 0xea, 0xd8, 0xde, 0x34, 
+  0xf7, 0x3a, 0x72, 0x5e, 0xaf, 0x67, 0xdb, 0x17, 0xee, 0x85, 0x7d, 0xb7, 0x39, 0xa7, 0x1d, 0xcb, 
+  0x20, 0xa4, 0x7c, 0xe2, 0xf0, 0xb7, 0x3c, 0x89, 0xda, 0x00, 0x2c, 0x8c, 0x4c, 0xa3, 0x73, 0x9f, 
+  0x6e, 0x0b, 0x85, 0x69, 0xab, 0x8e, 0x6c, 0x10, 0x98, 0x4b, 0x32, 0xb4, 0x44, 0xd1, 0x34, 0x56, 
+  0x72, 0xd4, 0x5c, 0xd3, 0xa7, 0x70, 0x3f, 0xe8, 0xf0, 0x3a, 0x12, 0xb3, 0x72, 0x61, 0xe2, 0xec, 
+  0x9c, 0xc4, 0x59, 0x35, 0x23, 0x55, 0xf5, 0x4a, 0x55, 0xf5, 0x43, 0x9c, 0x4d, 0x79, 0x03, 0x47, 
+  0xe0, 0x61, 0x1a, 0xcd, 0xc2, 0xf2, 0x03, 0x83, 0x9a, 0xf7, 0xf1, 0xe3, 0x59, 0xfe, 0xf1, 0xa3, 
+  0x37, 0xe0, 0x9c, 0x38, 0x70, 0xe4, 0xe3, 0xec, 0x0f, 0xa0, 0xa8, 0x0c, 0xb1, 0x70, 0xbd, 0x31, 
+  0x96, 0xe3, 0x93, 0x56, 0x02, 0x44, 0x19, 0x30, 0xa8, 0x5f, 0xfa, 0x55, 0xf7, 0x21, 0x57, 0x71, 
+  0x9e, 0xf6, 0xae, 0xa0, 0x33, 0x44, 0xf2, 0xc0, 0x9b, 0x83, 0x05, 0xaf, 0x40, 0x1c, 0x33, 0xe0, 
+  0x8e, 0x02, 0xd5, 0xf1, 0x6c, 0x8b, 0xbf, 0xae, 0xae, 0x83, 0x20, 0x0f, 0xd6, 0x02, 0x54, 0x55, 
+  0xd8, 0x29, 0x2b, 0xc4, 0x27, 0xbe, 0x87, 0x94, 0xda, 0x69, 0xf3, 0x20, 0xee, 0x90, 0x53, 0x03, 
+  0x41, 0x57, 0x06, 0x76, 0x8d, 0x13, 0x35, 0x10, 0x63, 0x16, 0x83, 0xf3, 0x66, 0x3e, 0xcd, 0x5a, 
+  0x7c, 0xaf, 0x92, 0x91, 0x54, 0x88, 0xbc, 0xb3, 0xdc, 0x1b, 0xa4, 0x83, 0x81, 0x42, 0x29, 0x1a, 
+  0x02, 0xa3, 0x8e, 0xc7, 0xe5, 0x46, 0x75, 0x00, 0x3c, 0xe3, 0x2d, 0x5a, 0xd1, 0x4a, 0x0d, 0x52, 
+  0x1f, 0x35, 0xe2, 0x6c, 0x2c, 0x48, 0xd1, 0xb9, 0x4e, 0x37, 0x06, 0x38, 0xa1, 0xdb, 0x3a, 0xaa, 
+  0x9b, 0xa0, 0x21, 0x34, 0x5e, 0xa9, 0x39, 0x5e, 0x4f, 0xd3, 0xba, 0x51, 0x5d, 0x3a, 0xdd, 0x44, 
+  0x80, 0x05, 0xf5, 0xcb, 0x70, 0xc5, 0xf1, 0x2a, 0x81, 0xfa, 0x67, 0x47, 0x8c, 0x4a, 0x0a, 0xbc, 
+  0x5a, 0xc4, 0xb2, 0x38, 0x9b, 0x6b, 0x91, 0x9f, 0x03, 0x5b, 0x57, 0x13, 0xfa, 0xa0, 0xe3, 0x91, 
+  0x60, 0x6c, 0xea, 0x02, 0x72, 0xa1, 0x55, 0x76, 0xcd, 0x55, 0x65, 0xcf, 0xd3, 0xa2, 0x29, 0x76, 
+  0x9f, 0x68, 0xf8, 0xb2, 0xb8, 0x5a, 0x24, 0x6c, 0x74, 0x30, 0x9f, 0x39, 0x99, 0xea, 0xe6, 0x57, 
+  0x52, 0x8c, 0xa1, 0x22, 0xb3, 0x9a, 0xc3, 0x9f, 0xce, 0x4e, 0xaa, 0xd7, 0x5a, 0x50, 0x89, 0x58, 
+  0xa5, 0xdd, 0x1c, 0xec, 0x0d, 0x96, 0x1d, 0x54, 0x26, 0x32, 0x88, 0x59, 0x34, 0x61, 0x60, 0x64, 
+  0x9c, 0xde, 0x83, 0x27, 0x15, 0x95, 0x23, 0x2e, 0xb3, 0x47, 0x74, 0xac, 0x14, 0x59, 0xbc, 0xc4, 
+  0xb7, 0xe2, 0x11, 0x40, 0xc9, 0x8d, 0xb0, 0x3a, 0x45, 0x44, 0x75, 0xe2, 0x04, 0xd7, 0xf2, 0xe8, 
+  0x36, 0xbd, 0xf1, 0x9c, 0xac, 0xa7, 0xf8, 0x12, 0x71, 0xd3, 0xaa, 0xec, 0xd4, 0x3a, 0x77, 0x2b, 
+  0x56, 0x05, 0x0c, 0x58, 0x30, 0x4b, 0x57, 0x9a, 0x44, 0x80, 0xc5, 0xf8, 0xc5, 0xa4, 0xb0, 0xd9, 
+  0x86, 0x32, 0x2e, 0x10, 0xb0, 0x35, 0x1b, 0x4a, 0x0a, 0x9d, 0x6a, 0x24, 0xdd, 0xd9, 0x41, 0x08, 
+  0x64, 0xa4, 0x0d, 0xc7, 0x85, 0x12, 0xeb, 0x76, 0x30, 0xda, 0x08, 0x43, 0x2b, 0xdf, 0xf7, 0x4f, 
+  0x64, 0xc1, 0x8b, 0xae, 0xf7, 0x01, 0x48, 0xf6, 0x37, 0xfc, 0xf3, 0x77, 0xf6, 0x58, 0x59, 0xe9, 
+  0x5b, 0x7c, 0x65, 0x76, 0xf3, 0xd7, 0x0e, 0x83, 0x5b, 0x97, 0x32, 0xb9, 0x29, 0xb4, 0x48, 0xf8, 
+  0xb9, 0xa3, 0xed, 0xb4, 0x75, 0x68, 0x72, 0x65, 0x9b, 0xda, 0x24, 0x26, 0xea, 0xcb, 0xec, 0x56, 
+  0x8a, 0x01, 0x14, 0x0d, 0xe1, 0x1e, 0x38, 0x69, 0x94, 0xda, 0x8b, 0xac, 0xc4, 0x27, 0xce, 0x0a, 
+  0xd5, 0x8a, 0xb8, 0x62, 0xcf, 0xdf, 0xac, 0x53, 0x3c, 0x2e, 0xeb, 0x53, 0xe6, 0xe7, 0x5b, 0xe6, 
+  0xb1, 0x5b, 0x9c, 0xbd, 0xcf, 0x72, 0x6c, 0x62, 0xb2, 0xd6, 0xbf, 0x6c, 0x02, 0xc5, 0x8b, 0x8d, 
+  0x18, 0xda, 0x43, 0x17, 0xf2, 0x2c, 0xd9, 0xc6, 0x5e, 0x26, 0x9a, 0x2e, 0xd5, 0x16, 0x56, 0xad, 
+  0xc1, 0x23, 0x04, 0x7f, 0x75, 0x69, 0xa7, 0x65, 0x41, 0x0a, 0x04, 0xb7, 0x7b, 0x85, 0x70, 0xf0, 
+  0x40, 0x36, 0x6e, 0x26, 0x53, 0xfd, 0x8c, 0x7e, 0x28, 0xd7, 0x8e, 0xaa, 0xef, 0x56, 0x37, 0x64, 
+  0x27, 0x73, 0x13, 0xb8, 0xf4, 0xb8, 0xae, 0xde, 0xdf, 0x55, 0x29, 0xaf, 0xd6, 0x48, 0x73, 0xfb, 
+  0xe3, 0x1e, 0xb1, 0x9b, 0xc4, 0xd3, 0xc4, 0x9a, 0x15, 0x7c, 0x76, 0x5b, 0x11, 0x9c, 0xe6, 0xf2, 
+  0x3b, 0x39, 0xb4, 0x58, 0x1c, 0x46, 0xb9, 0x7f, 0x6b, 0x45, 0xe9, 0xc2, 0x96, 0xba, 0x5f, 0x66, 
+  0x10, 0xc1, 0x26, 0x7b, 0xca, 0xf3, 0x14, 0x30, 0xe7, 0x17, 0xd1, 0x75, 0x89, 0x70, 0xfb, 0xb0, 
+  0x8c, 0x26, 0xfb, 0xca, 0x3b, 0x28, 0xc1, 0x7d, 0xfc, 0x83, 0x9e, 0x1d, 0xec, 0xea, 0x9f, 0x53, 
+  0x55, 0x42, 0x9a, 0x08, 0x4b, 0x55, 0x1e, 0xe7, 0x79, 0x89, 0xbf, 0x45, 0x38, 0xf9, 0xc1, 0x96, 
+  0x3d, 0xe0, 0xc7, 0xba, 0x0a, 0xff, 0x74, 0xab, 0x2e, 0xc2, 0x65, 0x34, 0xf9, 0xb1, 0x59, 0xf8, 
+  0xa0, 0x2c, 0x74, 0x85, 0xe2, 0x1f, 0x5d, 0xb5, 0x4e, 0xc3, 0xa5, 0xd2, 0x79, 0xa8, 0x8f, 0xa5, 
+  0x5f, 0x3a, 0xb2, 0xe2, 0x7c, 0xbd, 0x2c, 0xd3, 0x8b, 0x65, 0x12, 0xdd, 0x33, 0xbf, 0xee, 0x49, 
+  0x43, 0xf2, 0x1c, 0x95, 0x4d, 0x12, 0xe6, 0xf0, 0x78, 0xa3, 0x2e, 0x78, 0x26, 0xdf, 0x1f, 0x44, 
+  0x7f, 0xe3, 0xcf, 0x2f, 0xe3, 0xae, 0xc3, 0x02, 0x07, 0xda, 0x91, 0x90, 0xc4, 0xa3, 0xa4, 0x0a, 
+  0x62, 0x0f, 0xb2, 0xc8, 0xbd, 0xe4, 0x0a, 0xec, 0x95, 0x68, 0xb4, 0xdc, 0x3e, 0x17, 0xe0, 0x45, 
+  0x21, 0x10, 0x03, 0x38, 0x81, 0x33, 0x8e, 0x5d, 0xad, 0xdb, 0xfe, 0x47, 0x45, 0x6d, 0xb1, 0xef, 
+  0xef, 0x33, 0x82, 0x92, 0xb3, 0xe2, 0xcd, 0xce, 0x1a, 0xc1, 0x01, 0xb5, 0x66, 0xc8, 0xac, 0x55, 
+  0x2c, 0xb6, 0xed, 0x92, 0x42, 0x43, 0x41, 0x5f, 0x03, 0x30, 0x20, 0x60, 0x0d, 0xec, 0x97, 0x04, 
+  0xda, 0xa4, 0xac, 0x91, 0x26, 0x35, 0xab, 0x67, 0x51, 0xbd, 0x14, 0xb7, 0x95, 0x94, 0x18, 0x17, 
+  0xab, 0xbb, 0xa9, 0x5b, 0x45, 0xd8, 0xe3, 0xa0, 0xcb, 0x23, 0x44, 0xbb, 0x24, 0xf8, 0x69, 0xc4, 
+  0xa9, 0x5e, 0x45, 0x59, 0xcd, 0x99, 0x77, 0xb4, 0xbf, 0xdd, 0xf0, 0xfe, 0x58, 0xdc, 0xe9, 0x3e, 
+  0xac, 0xee, 0x8f, 0x83, 0xfb, 0xe3, 0x03, 0x7f, 0x12, 0xef, 0x7c, 0x9d, 0x0e, 0x82, 0xc9, 0x87, 
+  0xd5, 0x3f, 0xa6, 0xbb, 0x18, 0xab, 0xc5, 0x24, 0x9f, 0xec, 0x03, 0xee, 0x76, 0x1d, 0x88, 0x87, 
+  0x84, 0x97, 0x9e, 0x64, 0x79, 0x91, 0x2c, 0x04, 0x59, 0x60, 0x00, 0x10, 0x87, 0x41, 0x42, 0x7f, 
+  0x7e, 0x98, 0x0e, 0x68, 0x8a, 0xf9, 0x66, 0x57, 0xc8, 0x41, 0x21, 0xee, 0x7e, 0x6f, 0x4f, 0xd3, 
+  0xcf, 0xe3, 0xb8, 0x8e, 0x1b, 0x51, 0x3d, 0xf1, 0x53, 0x00, 0xb0, 0x5e, 0xd0, 0x0c, 0xb5, 0x85, 
+  0x63, 0xda, 0x4f, 0xb1, 0xe3, 0x32, 0x98, 0x02, 0x0e, 0x3b, 0xde, 0x36, 0xd8, 0x71, 0x10, 0x40, 
+  0x73, 0x36, 0x0a, 0xe2, 0x28, 0x66, 0xe0, 0x59, 0xf1, 0xcb, 0xb1, 0x7a, 0x41, 0xe7, 0x66, 0x0d, 
+  0xd7, 0xaf, 0x52, 0x70, 0xb2, 0xbc, 0xba, 0x88, 0xb6, 0xa9, 0xd5, 0x4b, 0x71, 0x9e, 0xb7, 0x87, 
+  0xbb, 0xa5, 0xe1, 0x59, 0xe5, 0x87, 0xa1, 0x27, 0x43, 0x3c, 0xf3, 0xff, 0x98, 0x41, 0xee, 0xe7, 
+  0x66, 0x17, 0x4d, 0x0b, 0x6e, 0xcd, 0xff, 0x45, 0xeb, 0xea, 0xfd, 0x4a, 0xab, 0x02, 0x3f, 0x60, 
+  0xe1, 0x1e, 0x9d, 0x60, 0x9e, 0xbe, 0x1b, 0xcc, 0x53, 0xb2, 0xa1, 0xcc, 0xd8, 0x71, 0x61, 0xe0, 
+  0x0b, 0xc4, 0xb4, 0xc2, 0x40, 0x10, 0x6d, 0x87, 0x2e, 0xfd, 0x05, 0x65, 0xd3, 0xb4, 0x8e, 0xe5, 
+  0x88, 0xfc, 0xeb, 0xd6, 0x81, 0xa5, 0x68, 0xf9, 0xdb, 0x64, 0xc8, 0xc6, 0xbe, 0x69, 0xc9, 0x78, 
+  0x4f, 0xe9, 0x45, 0x8f, 0x8b, 0xf8, 0xe4, 0xdc, 0x0a, 0x2c, 0x65, 0x4b, 0xa6, 0x79, 0xca, 0x18, 
+  0x16, 0x32, 0x02, 0xcc, 0x90, 0xc4, 0x48, 0x23, 0x7d, 0xbd, 0x51, 0xd7, 0xef, 0x67, 0x4d, 0x6d, 
+  0x77, 0x97, 0xd1, 0xad, 0x7e, 0x2e, 0xff, 0x69, 0x54, 0x7e, 0xd9, 0xf2, 0xaa, 0x07, 0x54, 0x3e, 
+  0xe7, 0x60, 0x86, 0x72, 0xef, 0x8c, 0x16, 0x3c, 0xad, 0x88, 0xf4, 0xab, 0xa0, 0x96, 0xc8, 0x6f, 
+  0xda, 0x2d, 0xda, 0xea, 0x51, 0x46, 0xfe, 0x4f, 0x3f, 0xfc, 0xfd, 0xa7, 0xbf, 0xff, 0xfb, 0x7f, 
+  0xfc, 0xf0, 0xf7, 0x7f, 0xbf, 0xef, 0xef, 0x0f, 0x38, 0x1a, 0xb2, 0x00, 0x34, 0xd2, 0x39, 0x0d, 
+  0xe1, 0xcd, 0x5e, 0x50, 0x8d, 0xe8, 0xfe, 0xbf, 0x07, 0x8e, 0xbb, 0xc6, 0x7e, 0x30, 0xf8, 0xef, 
+  0x57, 0x35, 0x0b, 0xe6, 0x14, 0x0c, 0x7d, 0xa2, 0xac, 0xe3, 0x2b, 0x09, 0x24, 0xe8, 0x61, 0x28, 
+  0xf9, 0x1c, 0xb5, 0x8f, 0xeb, 0x46, 0xc5, 0x9d, 0xd0, 0x85, 0xd1, 0x29, 0x91, 0x32, 0x31, 0xa4, 
+  0xf2, 0xb2, 0xa8, 0xf3, 0x2b, 0xf9, 0x7a, 0xb9, 0x80, 0xb2, 0x94, 0xd5, 0xac, 0x71, 0x76, 0xc5, 
+  0x79, 0x7f, 0x7a, 0x00, 0x5d, 0xec, 0x3d, 0x7b, 0x08, 0x35, 0xee, 0xc0, 0x1b, 0xf6, 0x5e, 0x27, 
+  0xc5, 0x69, 0x7c, 0xb1, 0xea, 0xa5, 0xe5, 0x3d, 0x1a, 0xb8, 0x25, 0x47, 0x53, 0x11, 0x73, 0x93, 
+  0x64, 0xbd, 0x75, 0xa6, 0x87, 0x6a, 0x31, 0x34, 0x68, 0x6e, 0x75, 0x79, 0x4f, 0x42, 0x15, 0x39, 
+  0x1d, 0x0f, 0xb1, 0x3e, 0x1b, 0x7a, 0x0d, 0x1d, 0x5f, 0x57, 0xd7, 0x9a, 0x23, 0x47, 0xd7, 0x90, 
+  0xe6, 0xbd, 0xbb, 0xe3, 0x44, 0x99, 0xfb, 0x8e, 0x27, 0xbb, 0x51, 0x1c, 0x97, 0x58, 0xd9, 0x7f, 
+  0x73, 0x5d, 0x9d, 0x02, 0xd9, 0x06, 0x3e, 0xbb, 0x0b, 0xc4, 0xc3, 0x23, 0xda, 0x07, 0xfc, 0x8c, 
+  0x75, 0x40, 0x4c, 0xc3, 0x85, 0xe5, 0xba, 0x5e, 0xd1, 0xa9, 0xa8, 0x7e, 0x59, 0x84, 0x85, 0x93, 
+  0x45, 0x73, 0xbf, 0xd6, 0x52, 0xdd, 0x6d, 0xb5, 0x74, 0x79, 0xdb, 0xdc, 0xaa, 0x45, 0x69, 0xd1, 
+  0xe7, 0xb2, 0xda, 0xd9, 0x01, 0x10, 0x0a, 0x5c, 0x76, 0xc1, 0x1f, 0xd5, 0x6b, 0x67, 0x4d, 0xa7, 
+  0x57, 0xed, 0x03, 0x87, 0x5d, 0x31, 0x5c, 0x2d, 0x88, 0x12, 0x43, 0xa6, 0x29, 0x35, 0x2b, 0x37, 
+  0xf3, 0x63, 0xf0, 0x78, 0xfc, 0x05, 0xb1, 0x6c, 0x9d, 0xe1, 0x2f, 0x54, 0x28, 0x50, 0x79, 0xf5, 
+  0x31, 0x11, 0x1d, 0xf2, 0x79, 0xed, 0x08, 0xc9, 0xb7, 0x51, 0xb5, 0x1c, 0x6e, 0x63, 0x47, 0x5d, 
+  0x26, 0x52, 0xc6, 0xb8, 0x35, 0xf4, 0xfd, 0x83, 0x59, 0x4d, 0x1f, 0x42, 0xce, 0x4d, 0x88, 0xbc, 
+  0xaa, 0x01, 0xc2, 0x88, 0xf7, 0xa7, 0xa2, 0xbe, 0xdf, 0xe8, 0x9d, 0xe9, 0xec, 0x0f, 0xde, 0x97, 
+  0x71, 0xfb, 0xbe, 0xd9, 0x37, 0xf2, 0x7c, 0xf8, 0x7e, 0xd6, 0x51, 0xc4, 0xae, 0x18, 0xcf, 0x7c, 
+  0x6a, 0x47, 0x21, 0xa6, 0x12, 0x2f, 0xe8, 0x86, 0xa4, 0x19, 0xd3, 0xb3, 0x7a, 0x5b, 0x6b, 0x5a, 
+  0x67, 0xf3, 0x20, 0x5b, 0x3c, 0x4c, 0x56, 0x73, 0x22, 0x40, 0x31, 0xac, 0xc9, 0x52, 0x73, 0xc6, 
+  0xaf, 0x38, 0x27, 0x02, 0x72, 0x0e, 0x01, 0xe4, 0x2a, 0xda, 0xe7, 0x38, 0x93, 0x3d, 0x75, 0xbd, 
+  0x9a, 0x9f, 0x26, 0x8b, 0x35, 0x72, 0x2b, 0x5f, 0x26, 0xc3, 0x17, 0x6b, 0x81, 0x3c, 0x12, 0x9d, 
+  0x4d, 0x52, 0x8c, 0xfd, 0xcf, 0xd1, 0xa1, 0x3a, 0xd9, 0xee, 0xb1, 0x4e, 0xe2, 0x5d, 0xb3, 0x8e, 
+  0xff, 0x39, 0x18, 0xe6, 0xf2, 0xdb, 0x3f, 0x51, 0xd7, 0xb1, 0xb5, 0x1b, 0x72, 0x26, 0x69, 0xd7, 
+  0x7f, 0xe3, 0xa4, 0x32, 0xf8, 0x6a, 0xb5, 0x13, 0x14, 0xdf, 0x39, 0x90, 0xf2, 0x42, 0x38, 0xd0, 
+  0x7b, 0x6d, 0xe4, 0x45, 0xc0, 0xa1, 0xb4, 0x3b, 0x63, 0x90, 0xae, 0xc7, 0x6d, 0xb1, 0x7b, 0x7b, 
+  0xe1, 0x51, 0xf9, 0x0d, 0x64, 0xc7, 0x72, 0x2b, 0xea, 0xe6, 0x97, 0x56, 0x6c, 0x78, 0x6d, 0xd9, 
+  0x95, 0x26, 0xa1, 0xbd, 0xc4, 0x90, 0x75, 0x94, 0xae, 0x39, 0x64, 0x06, 0x9b, 0x6d, 0x1e, 0x44, 
+  0x09, 0xfb, 0x05, 0x5d, 0x75, 0xda, 0xef, 0x67, 0x38, 0x26, 0xcf, 0xe3, 0xa1, 0x9d, 0x3f, 0x64, 
+  0x83, 0x3a, 0x9f, 0xcc, 0x06, 0x03, 0xd0, 0xc9, 0xab, 0xc1, 0x80, 0x64, 0x0c, 0x4e, 0x4b, 0x56, 
+  0xab, 0x7c, 0x79, 0x10, 0xf9, 0xc9, 0x4e, 0x74, 0xb5, 0x33, 0x83, 0x4f, 0xdd, 0xc1, 0x0c, 0xb9, 
+  0xd2, 0x80, 0x5f, 0x27, 0x18, 0x93, 0x8a, 0x93, 0x04, 0x3f, 0xce, 0x8b, 0xa3, 0x04, 0x1a, 0xe4, 
+  0x93, 0x36, 0x30, 0xde, 0x6c, 0xe7, 0xd2, 0x50, 0xe4, 0x7a, 0x9c, 0x12, 0xa4, 0xa3, 0x37, 0x8b, 
+  0xf0, 0x8b, 0xd9, 0x2a, 0x88, 0x86, 0xe2, 0xc5, 0x77, 0x1e, 0xbb, 0x77, 0x6c, 0x77, 0xe5, 0xd1, 
+  0xf0, 0x6a, 0x56, 0x7b, 0x5a, 0xac, 0xb3, 0x47, 0x71, 0xb1, 0xbc, 0xd2, 0x4f, 0xdf, 0xf0, 0xaa, 
+  0x3d, 0x8a, 0x23, 0x76, 0xa0, 0x2a, 0xcb, 0x65, 0xe2, 0xfa, 0x28, 0x64, 0x98, 0x22, 0xf3, 0x00, 
+  0x58, 0x8e, 0x6b, 0x5e, 0x87, 0x51, 0xa6, 0x75, 0x6a, 0x9c, 0xcc, 0xd9, 0x7a, 0x3b, 0xdc, 0xf1, 
+  0x39, 0x33, 0x1b, 0x11, 0xbf, 0xcb, 0x22, 0x2d, 0xeb, 0xf2, 0x5b, 0x2d, 0x72, 0xaf, 0xe0, 0x50, 
+  0xaa, 0xad, 0xb1, 0x81, 0x25, 0x8b, 0x6f, 0x1a, 0x68, 0xbb, 0xa0, 0x85, 0xf1, 0x3c, 0x3d, 0x4f, 
+  0xcb, 0x70, 0x5b, 0x38, 0x71, 0x0b, 0x80, 0xa7, 0x1c, 0x13, 0x3b, 0x1b, 0x82, 0xa7, 0x35, 0x69, 
+  0x52, 0xd8, 0x67, 0x57, 0x0c, 0x37, 0x10, 0x21, 0x9f, 0xce, 0x90, 0x2f, 0x25, 0xed, 0x0a, 0xd0, 
+  0x29, 0xc6, 0x45, 0x08, 0x84, 0xfe, 0xf4, 0xf8, 0xea, 0xfd, 0x69, 0x92, 0x49, 0x88, 0xe0, 0x8a, 
+  0x63, 0xfc, 0x89, 0xf9, 0x1e, 0xc7, 0x61, 0x0e, 0x68, 0xc5, 0x99, 0xdf, 0xb1, 0x5c, 0x52, 0x86, 
+  0x2b, 0x12, 0xd8, 0xe7, 0x85, 0x4e, 0x7b, 0x17, 0x3a, 0x60, 0x0f, 0xc2, 0x45, 0x70, 0x62, 0x85, 
+  0xa4, 0xed, 0x9e, 0x73, 0xcf, 0x54, 0xb9, 0xd7, 0x13, 0x1d, 0x3b, 0xfc, 0xbb, 0xc0, 0x47, 0x68, 
+  0x40, 0xd0, 0x1e, 0x89, 0x5b, 0x3d, 0x36, 0xde, 0xf4, 0xee, 0x95, 0xc5, 0x3a, 0xb9, 0xa7, 0xe8, 
+  0x6c, 0x9c, 0xc7, 0x6b, 0x1c, 0x2f, 0x65, 0x2f, 0x15, 0xdc, 0x3c, 0x6d, 0x8c, 0x4c, 0x16, 0xe0, 
+  0x36, 0xb8, 0x53, 0xd2, 0x6a, 0xbc, 0xec, 0xe5, 0xc7, 0xc7, 0x3d, 0x4e, 0xb9, 0x97, 0x64, 0x9c, 
+  0x5d, 0x17, 0x27, 0x69, 0x41, 0x23, 0x41, 0x5c, 0x7f, 0xc1, 0x03, 0xb2, 0xa7, 0x8a, 0xe6, 0x87, 
+  0xf1, 0xfe, 0x56, 0x19, 0x0d, 0x56, 0x87, 0x56, 0x54, 0xb2, 0xe9, 0x5d, 0xf3, 0x2a, 0x92, 0x6d, 
+  0x20, 0xbb, 0x52, 0x2f, 0x3a, 0xe8, 0x7b, 0x70, 0x52, 0x67, 0xd2, 0xb2, 0x0c, 0xe9, 0x5b, 0x62, 
+  0x3b, 0x88, 0x36, 0xcc, 0x00, 0x25, 0x7b, 0x45, 0xac, 0xc6, 0x22, 0x2d, 0xca, 0x2b, 0xa4, 0x1b, 
+  0xd5, 0x07, 0x36, 0x5e, 0xb5, 0x01, 0xfe, 0x24, 0xe6, 0x9f, 0x6b, 0x34, 0xfd, 0x04, 0x86, 0xc9, 
+  0x5f, 0xeb, 0x78, 0x99, 0x96, 0x57, 0x87, 0xe2, 0xe4, 0x59, 0x44, 0x9e, 0x60, 0x84, 0x79, 0x36, 
+  0xab, 0x5e, 0xa6, 0xd1, 0xa0, 0x8f, 0xa2, 0x6b, 0x1b, 0x1b, 0x1b, 0xee, 0x2b, 0x8d, 0x9a, 0x41, 
+  0xbf, 0x64, 0xbd, 0xd0, 0x0f, 0x61, 0x81, 0xc2, 0xfd, 0xcd, 0x88, 0x37, 0x88, 0x19, 0x77, 0xde, 
+  0x54, 0x47, 0xbc, 0xa9, 0x4e, 0xe6, 0xad, 0xc8, 0x3d, 0xc9, 0xcb, 0x1e, 0x47, 0x26, 0x42, 0x73, 
+  0x0e, 0xac, 0x35, 0xfc, 0x5a, 0xce, 0xa3, 0x4c, 0x7e, 0x3d, 0xe3, 0xf5, 0xc5, 0x3f, 0xe3, 0x99, 
+  0x04, 0x7f, 0xfe, 0x32, 0x13, 0x72, 0xf5, 0x71, 0xf8, 0x8b, 0x4e, 0xa9, 0xbc, 0x10, 0x41, 0xdb, 
+  0x93, 0x72, 0xab, 0xa0, 0xfd, 0x08, 0x0b, 0x10, 0xc7, 0xcd, 0xb3, 0x95, 0x28, 0xe7, 0x17, 0xba, 
+  0xec, 0x92, 0x99, 0xdd, 0x93, 0xb9, 0xab, 0xcc, 0xae, 0x51, 0x55, 0xe9, 0x83, 0x89, 0x30, 0x8d, 
+  0x67, 0x72, 0xf6, 0x43, 0x88, 0xf7, 0x75, 0x67, 0x4c, 0xe7, 0x82, 0xaa, 0xc3, 0x7b, 0xe6, 0x2b, 
+  0x7c, 0x7d, 0x73, 0x21, 0x88, 0x74, 0xfc, 0x85, 0xfa, 0xfb, 0xcc, 0xa7, 0x98, 0x4f, 0xd3, 0x34, 
+  0xad, 0xd1, 0x99, 0x65, 0xcd, 0x03, 0xd1, 0xd4, 0x49, 0x2a, 0x17, 0xc3, 0xa4, 0x3e, 0x36, 0x2b, 
+  0x36, 0x02, 0x68, 0x28, 0x79, 0xb4, 0xf6, 0xc6, 0xfd, 0x1a, 0x76, 0xcd, 0x91, 0x8e, 0xab, 0x97, 
+  0x81, 0x7a, 0x49, 0x27, 0x9f, 0x14, 0x95, 0x59, 0x3e, 0x53, 0x8f, 0xd4, 0x5b, 0xf5, 0x32, 0xba, 
+  0xce, 0xeb, 0x34, 0x3c, 0x19, 0xbe, 0x8d, 0xae, 0x75, 0xc0, 0xd8, 0x84, 0x31, 0x24, 0x8b, 0x79, 
+  0xb4, 0xbf, 0x51, 0x2b, 0xb3, 0x04, 0xb7, 0x58, 0xc2, 0xd9, 0xf0, 0xc0, 0xd6, 0x70, 0x13, 0x32, 
+  0xac, 0xbd, 0x2a, 0x71, 0x10, 0xe3, 0x43, 0x69, 0x27, 0x97, 0xe3, 0x44, 0x77, 0x39, 0x08, 0x6b, 
+  0x49, 0xc0, 0xb5, 0x1a, 0xad, 0x18, 0xbe, 0x9d, 0x64, 0x08, 0x83, 0x01, 0xf6, 0xc0, 0x0c, 0x02, 
+  0xf8, 0x9c, 0x45, 0xad, 0x2a, 0x10, 0x66, 0xf8, 0x5b, 0x8c, 0xdb, 0xbf, 0xc5, 0x70, 0x40, 0x97, 
+  0xe2, 0xbc, 0x11, 0xf1, 0x23, 0x02, 0x17, 0x2b, 0x3f, 0x85, 0xa1, 0x44, 0x9e, 0x13, 0xb3, 0x1f, 
+  0x9c, 0x1d, 0xd4, 0xa1, 0x39, 0x9c, 0xdb, 0x88, 0x66, 0x9f, 0x13, 0x7e, 0x9a, 0x1b, 0x81, 0x8e, 
+  0x31, 0x7e, 0x32, 0x33, 0x93, 0xfb, 0x1e, 0x89, 0x5b, 0x0c, 0x0b, 0xec, 0xd4, 0x2b, 0x75, 0xc9, 
+  0xc5, 0x42, 0x1b, 0xfb, 0xdf, 0x22, 0xba, 0xd2, 0x5a, 0x3e, 0xb0, 0xa3, 0x3f, 0x0e, 0x3f, 0x0f, 
+  0x2f, 0x69, 0x95, 0x8c, 0x9c, 0x94, 0x4c, 0x10, 0xd1, 0x22, 0x44, 0xc0, 0x8e, 0x06, 0x83, 0x34, 
+  0x28, 0x78, 0xf5, 0x15, 0xb4, 0x72, 0x38, 0x6e, 0x5a, 0x6f, 0x6e, 0xd4, 0x03, 0x60, 0x09, 0x2b, 
+  0xd1, 0xce, 0x67, 0xdb, 0xf0, 0x9b, 0x8a, 0xf9, 0x46, 0x1d, 0x2e, 0xb6, 0x22, 0xe6, 0x9f, 0xd3, 
+  0x27, 0x80, 0x82, 0x6e, 0xd4, 0x93, 0x5a, 0x13, 0x83, 0x81, 0xad, 0x5d, 0xce, 0x5a, 0x21, 0x58, 
+  0x99, 0xe4, 0xb5, 0x77, 0x61, 0x16, 0xe1, 0x9d, 0x17, 0x07, 0x23, 0x62, 0xdc, 0xb0, 0x53, 0xf0, 
+  0x87, 0xe4, 0xf2, 0xd6, 0x20, 0xab, 0x8e, 0x7b, 0xd1, 0x5c, 0x47, 0x27, 0x46, 0x89, 0x7b, 0x6c, 
+  0xc5, 0xc3, 0x5f, 0x01, 0x32, 0xab, 0x56, 0x77, 0xef, 0xa6, 0xb0, 0x5a, 0x31, 0xbc, 0x62, 0x3c, 
+  0x3c, 0x9f, 0x8f, 0xf1, 0x8f, 0x1f, 0x84, 0xb1, 0xaf, 0x51, 0x21, 0x13, 0xcc, 0x0d, 0xb0, 0xaa, 
+  0x87, 0x7f, 0xd1, 0x62, 0xa1, 0x75, 0x32, 0xca, 0x23, 0x62, 0x67, 0x50, 0x39, 0xc1, 0xdd, 0x19, 
+  0xdd, 0x8d, 0xe0, 0x6a, 0x4b, 0xbd, 0xbb, 0x68, 0x4a, 0xe6, 0x25, 0x4a, 0xfc, 0x8a, 0xf8, 0xf1, 
+  0x3c, 0xea, 0x23, 0x25, 0x2c, 0xcd, 0x15, 0xbd, 0xe6, 0xed, 0x50, 0x26, 0xb1, 0x52, 0xc4, 0x73, 
+  0x7f, 0x98, 0xfc, 0xa6, 0xb4, 0xf9, 0xd6, 0xe0, 0x93, 0xe2, 0x61, 0x5e, 0x47, 0x84, 0xc8, 0xb0, 
+  0xea, 0xe8, 0x69, 0x2c, 0x01, 0xef, 0xf5, 0xc0, 0xf8, 0x80, 0x6b, 0xfc, 0x35, 0xaf, 0xa3, 0xab, 
+  0x42, 0x97, 0x1d, 0x0f, 0x8f, 0x17, 0x51, 0xed, 0xd3, 0xf9, 0x43, 0xe2, 0xe1, 0x25, 0x62, 0x6d, 
+  0x04, 0xc2, 0x8f, 0x21, 0xbb, 0xd4, 0xfb, 0x78, 0xeb, 0x4c, 0xbe, 0x9d, 0x40, 0x25, 0x6c, 0x7f, 
+  0x5a, 0xd8, 0xc4, 0x07, 0x2d, 0x3f, 0x33, 0x1b, 0x2e, 0x75, 0x4b, 0xbd, 0x9b, 0x9b, 0xbd, 0x91, 
+  0x8e, 0xd0, 0x19, 0x39, 0xde, 0xfa, 0xaf, 0x84, 0xe2, 0xbd, 0x6d, 0x38, 0x50, 0xe8, 0x93, 0xa7, 
+  0x2f, 0xf8, 0x0d, 0xd9, 0xc0, 0x46, 0xd4, 0x04, 0x62, 0xe6, 0xf9, 0x6b, 0xd6, 0x19, 0x41, 0xd1, 
+  0x17, 0xb4, 0xbd, 0xc6, 0x11, 0x74, 0x73, 0xd3, 0x7d, 0x5f, 0x42, 0x20, 0x95, 0x11, 0xbc, 0xdb, 
+  0x0b, 0xde, 0x9b, 0x88, 0x6d, 0xb6, 0x27, 0xc1, 0xc6, 0x53, 0x92, 0xae, 0x75, 0x5c, 0x59, 0x73, 
+  0xfd, 0x6a, 0xba, 0x54, 0x0f, 0x22, 0x7c, 0x55, 0x0b, 0x22, 0x74, 0x95, 0x41, 0x47, 0x48, 0xdf, 
+  0x3a, 0xea, 0x60, 0x6f, 0x32, 0x86, 0xfe, 0x02, 0x37, 0x02, 0x7d, 0x5f, 0x21, 0x69, 0xc1, 0x1d, 
+  0x27, 0x8c, 0x07, 0x02, 0x1e, 0xc8, 0x64, 0xe7, 0x2c, 0x50, 0x67, 0x91, 0x13, 0x78, 0xfd, 0x90, 
+  0xfa, 0x7d, 0x86, 0x64, 0x9c, 0x80, 0x6d, 0xde, 0xe0, 0xb4, 0x7a, 0xa9, 0x3c, 0x78, 0xff, 0x7a, 
+  0x4c, 0x94, 0xe5, 0x00, 0xa3, 0x5b, 0x96, 0xc2, 0xe2, 0xbe, 0xbd, 0xb0, 0x8f, 0x8d, 0x37, 0xc1, 
+  0x4b, 0xc7, 0x97, 0x80, 0x1f, 0x20, 0xfb, 0x8e, 0x94, 0x16, 0x57, 0xe9, 0xc3, 0x7c, 0x9d, 0x71, 
+  0xdb, 0x0f, 0x16, 0x62, 0x2b, 0xfa, 0x39, 0x96, 0xef, 0xae, 0x87, 0xdc, 0x51, 0xd5, 0xb6, 0x59, 
+  0x19, 0x15, 0xde, 0x0c, 0x8f, 0xb3, 0xe8, 0x25, 0xfd, 0x78, 0x3d, 0xdf, 0x86, 0x52, 0xd2, 0x8f, 
+  0xba, 0xad, 0x00, 0x49, 0xd5, 0xef, 0x2d, 0xcf, 0x5b, 0x44, 0x41, 0xeb, 0x9f, 0x4c, 0x3d, 0x63, 
+  0x8c, 0x7f, 0xa3, 0x99, 0xef, 0x74, 0xf5, 0xb6, 0xf1, 0xe4, 0x35, 0x4b, 0x9a, 0xef, 0x68, 0xb6, 
+  0x3e, 0x47, 0xfe, 0x23, 0x88, 0x8c, 0x6f, 0x21, 0x2c, 0x5e, 0xce, 0xc3, 0x07, 0x0a, 0x4b, 0xe0, 
+  0xa1, 0x8a, 0xe7, 0xcd, 0x8d, 0x70, 0x26, 0x6c, 0x17, 0x2a, 0xc3, 0xad, 0xaa, 0xc6, 0x44, 0xc2, 
+  0xab, 0xbc, 0xe7, 0xbe, 0x1e, 0xbb, 0x25, 0x3b, 0x59, 0xb1, 0x46, 0x2a, 0xa6, 0x45, 0x16, 0xaf, 
+  0x88, 0x1b, 0x84, 0x50, 0x94, 0x64, 0xf3, 0x34, 0x81, 0xc7, 0xd8, 0xd9, 0xd0, 0xa4, 0x4f, 0x3c, 
+  0x1b, 0xe6, 0x0b, 0x85, 0xb0, 0x96, 0x04, 0x66, 0x7a, 0xfc, 0x89, 0x06, 0x83, 0xb7, 0x8c, 0x55, 
+  0xf9, 0x6b, 0xeb, 0xa0, 0x74, 0x14, 0x30, 0x0f, 0x7c, 0xf0, 0xd3, 0xc6, 0xd8, 0x9d, 0xb1, 0x06, 
+  0xc6, 0x12, 0xfc, 0x87, 0x20, 0xf5, 0xea, 0x22, 0x6e, 0x20, 0x35, 0x9e, 0x99, 0xdd, 0x4c, 0x2f, 
+  0x25, 0x19, 0x1c, 0x74, 0xe9, 0xf7, 0x5b, 0xcb, 0xfc, 0xce, 0x65, 0x8a, 0xd9, 0xf6, 0x32, 0xc5, 
+  0x6c, 0xa3, 0xf2, 0x5b, 0x9a, 0xb0, 0xea, 0x05, 0x84, 0x06, 0x91, 0xa0, 0xbc, 0x38, 0x14, 0x2c, 
+  0x25, 0xcc, 0xc3, 0xbb, 0xee, 0x47, 0xb0, 0x53, 0x3d, 0x74, 0x86, 0x4b, 0xaf, 0x46, 0x2a, 0x4f, 
+  0x7d, 0xfe, 0xbe, 0x2a, 0x52, 0xfa, 0xf7, 0x6d, 0xa5, 0xd3, 0xd5, 0x33, 0xda, 0x3c, 0xa9, 0x58, 
+  0x75, 0xde, 0xd1, 0x37, 0x6c, 0x29, 0x67, 0x5c, 0x52, 0x6c, 0xd3, 0x57, 0x52, 0x21, 0x36, 0xaa, 
+  0x0a, 0xd1, 0x7e, 0x37, 0xdf, 0xfc, 0x7e, 0x81, 0xa5, 0x35, 0xfc, 0x55, 0x8e, 0x9c, 0x57, 0x91, 
+  0x38, 0xf6, 0xf8, 0xde, 0xc7, 0x25, 0x50, 0x23, 0xc4, 0x73, 0xc9, 0x83, 0x4d, 0x76, 0x15, 0xd7, 
+  0xb6, 0x87, 0x83, 0xc7, 0x70, 0x1b, 0x6e, 0x94, 0x5f, 0x82, 0xe6, 0x97, 0x93, 0x57, 0xd3, 0xca, 
+  0xf1, 0x01, 0x36, 0x0c, 0xd0, 0xfe, 0xe1, 0x97, 0x18, 0x7c, 0x06, 0x3d, 0x8b, 0xdc, 0x67, 0xaa, 
+  0x1c, 0x5e, 0xe2, 0x0c, 0x64, 0x0e, 0x24, 0x08, 0x7d, 0x74, 0x2f, 0x9e, 0xb3, 0xd4, 0x40, 0x45, 
+  0xad, 0xa6, 0x9b, 0xeb, 0x25, 0x7a, 0xc7, 0x8b, 0xa6, 0x5a, 0x43, 0x9d, 0x95, 0x7a, 0x57, 0x9b, 
+  0xdd, 0xcd, 0xac, 0xa0, 0xd0, 0x06, 0x70, 0x88, 0xea, 0x93, 0x1b, 0x68, 0xe1, 0x62, 0x64, 0x80, 
+  0x6e, 0x1c, 0xc5, 0x43, 0x23, 0x62, 0x71, 0xa4, 0x02, 0x42, 0xab, 0x79, 0x68, 0x3e, 0x45, 0xd7, 
+  0x4d, 0xca, 0x1d, 0x66, 0xea, 0x72, 0x0b, 0x7f, 0x42, 0x9d, 0xdb, 0xa8, 0xcb, 0xda, 0x7a, 0x65, 
+  0xe2, 0xdf, 0x16, 0x70, 0x74, 0x69, 0x22, 0x88, 0x17, 0x44, 0xdc, 0xa9, 0x1b, 0x9e, 0xe6, 0xbd, 
+  0xb6, 0x16, 0x85, 0x26, 0xe3, 0xbf, 0xd4, 0x72, 0xfd, 0xb8, 0xde, 0x6c, 0x46, 0xb7, 0x90, 0xc9, 
+  0x4f, 0x66, 0xf0, 0xf8, 0xa3, 0xff, 0x8a, 0x30, 0xf1, 0xc3, 0x97, 0xb1, 0x76, 0x3d, 0xd1, 0x48, 
+  0x16, 0xde, 0xe8, 0xd3, 0xe4, 0xaf, 0x29, 0x3f, 0xa3, 0xe2, 0x2f, 0xa3, 0x06, 0xfd, 0xf1, 0x93, 
+  0x2e, 0x99, 0x19, 0x86, 0x58, 0xaa, 0x15, 0x08, 0xe0, 0x28, 0x1a, 0x90, 0x5f, 0x34, 0x17, 0x00, 
+  0x23, 0xa3, 0x27, 0x35, 0x42, 0xf5, 0x2c, 0x23, 0x31, 0x36, 0x5d, 0xf4, 0xf4, 0xd9, 0x57, 0x9e, 
+  0xc6, 0x65, 0x6f, 0x09, 0x8c, 0xc7, 0xde, 0x32, 0x3d, 0x4b, 0x7a, 0xd0, 0x9f, 0x5b, 0x7f, 0xa6, 
+  0x51, 0x8f, 0x04, 0x21, 0xa4, 0x1e, 0xba, 0x12, 0x17, 0xd8, 0x98, 0x06, 0xe3, 0x94, 0x24, 0xe3, 
+  0x5f, 0xb3, 0x7c, 0x7e, 0x06, 0x40, 0x0a, 0x13, 0x39, 0x6e, 0xfd, 0x5f, 0x39, 0x7a, 0xef, 0xe3, 
+  0xf0, 0xcf, 0xb8, 0x83, 0xe6, 0x77, 0xf7, 0xdd, 0x47, 0xe7, 0x23, 0xe9, 0x38, 0xd2, 0xd6, 0xf0, 
+  0x85, 0xed, 0x3b, 0x8c, 0xcc, 0x2f, 0xe6, 0xc6, 0xbc, 0x90, 0xd7, 0x3c, 0xad, 0x56, 0xb1, 0xa5, 
+  0xee, 0x75, 0x17, 0xac, 0x97, 0xf6, 0xfe, 0x7b, 0x68, 0x42, 0x70, 0xbb, 0x5e, 0xe0, 0xcf, 0xb8, 
+  0x56, 0xe2, 0x96, 0x02, 0xd5, 0x1b, 0xa9, 0x3f, 0x9e, 0x2c, 0xf1, 0x5f, 0x68, 0x32, 0x3d, 0xf8, 
+  0xc1, 0xd1, 0xf5, 0xf0, 0xd2, 0xde, 0x61, 0xed, 0xc0, 0xd3, 0x78, 0xc5, 0xea, 0x42, 0x48, 0x8b, 
+  0xf4, 0x30, 0xae, 0x3f, 0x7d, 0x9f, 0x2e, 0x97, 0xf2, 0x18, 0x4f, 0xbf, 0xf0, 0xd3, 0x67, 0x71, 
+  0x73, 0x9a, 0x8d, 0x5b, 0x6f, 0xbf, 0x72, 0xeb, 0x45, 0xe4, 0x28, 0xd1, 0x76, 0x62, 0x75, 0x7c, 
+  0x4f, 0x28, 0x00, 0xe7, 0x48, 0x0a, 0xda, 0x8a, 0x0c, 0xb3, 0xe3, 0xd9, 0x00, 0x92, 0x2c, 0x24, 
+  0xfc, 0x2a, 0x15, 0x4a, 0x97, 0x7e, 0x65, 0xcf, 0x67, 0x77, 0x86, 0x7b, 0xec, 0xc9, 0x58, 0x79, 
+  0x32, 0x64, 0x72, 0x43, 0x21, 0xb8, 0x8d, 0x25, 0x66, 0xfc, 0xb0, 0x72, 0xfc, 0xb0, 0xf2, 0x73, 
+  0x4e, 0x78, 0x95, 0x1a, 0x3f, 0x92, 0xaf, 0x12, 0x53, 0xf9, 0x2c, 0x66, 0xf2, 0x90, 0x58, 0x70, 
+  0xc4, 0xb2, 0x88, 0xe7, 0x67, 0xec, 0xfa, 0xa5, 0x55, 0x39, 0xac, 0x22, 0xdd, 0x98, 0xa2, 0xd1, 
+  0xb5, 0x68, 0x15, 0x6b, 0xe8, 0xcb, 0x0d, 0xc8, 0xd8, 0x4b, 0x46, 0xf6, 0xe5, 0x08, 0x84, 0x2e, 
+  0xd7, 0x0c, 0x50, 0xa8, 0x97, 0x00, 0x17, 0xed, 0xf2, 0xb7, 0x17, 0x57, 0xfb, 0xb2, 0xcb, 0x1d, 
+  0xc5, 0x86, 0xaa, 0xa7, 0x6c, 0x37, 0x29, 0xfc, 0x5c, 0x32, 0x0b, 0x33, 0xa4, 0x84, 0xb5, 0xdd, 
+  0x71, 0x0f, 0x98, 0x9c, 0x6a, 0x5f, 0x94, 0xbc, 0x3e, 0xe2, 0x0f, 0x64, 0xf4, 0x74, 0x3e, 0xc9, 
+  0xde, 0x62, 0xcd, 0x61, 0x4e, 0xf2, 0x51, 0x23, 0x1c, 0xfd, 0x50, 0x0b, 0xc9, 0x65, 0x2f, 0x85, 
+  0x73, 0x1f, 0x9c, 0x83, 0x99, 0xbd, 0xcb, 0x31, 0x4c, 0x3a, 0x16, 0x3b, 0x55, 0xfb, 0x24, 0x63, 
+  0xee, 0xec, 0x58, 0x17, 0xab, 0x46, 0x07, 0x40, 0xb6, 0xc1, 0x16, 0x4b, 0x43, 0xb5, 0x54, 0x77, 
+  0x1a, 0xc2, 0x41, 0x8c, 0x81, 0x86, 0x4e, 0x0a, 0x9c, 0x96, 0x06, 0xc9, 0xef, 0x18, 0x97, 0xbd, 
+  0x83, 0xa8, 0x42, 0xbc, 0xd8, 0x04, 0x24, 0xa0, 0x8f, 0x5a, 0x03, 0x9e, 0xb4, 0xfc, 0xed, 0x9c, 
+  0xb1, 0xa8, 0x82, 0xc8, 0x6d, 0x00, 0xb3, 0xaa, 0xf5, 0x74, 0x21, 0x70, 0x47, 0xad, 0xd4, 0x6e, 
+  0xb5, 0x57, 0xfc, 0x77, 0xa7, 0x73, 0x64, 0x7b, 0xe2, 0xd8, 0x62, 0x92, 0x9a, 0x7b, 0x7a, 0x31, 
+  0x2a, 0x76, 0x76, 0x2a, 0x84, 0xa2, 0x62, 0x3a, 0xca, 0x38, 0x37, 0x84, 0x9f, 0x0e, 0x3f, 0xea, 
+  0xbe, 0xb1, 0x84, 0x64, 0x3b, 0x6d, 0xbb, 0xdc, 0x1c, 0x5d, 0x07, 0x61, 0xfe, 0x2a, 0x91, 0x81, 
+  0xd5, 0x25, 0xfd, 0xd6, 0x09, 0x85, 0xb5, 0x1d, 0x96, 0x5b, 0x0a, 0xdd, 0x36, 0xfc, 0x1b, 0xa5, 
+  0xb1, 0x5b, 0x3a, 0xc0, 0x4b, 0xd0, 0x9a, 0x1f, 0xb8, 0x42, 0x95, 0xae, 0xa8, 0x74, 0xdc, 0x53, 
+  0xa7, 0x59, 0x8d, 0xfb, 0x60, 0x70, 0x63, 0x13, 0x60, 0xa7, 0x20, 0xd6, 0xcb, 0xaf, 0xe6, 0xd0, 
+  0xcc, 0x03, 0x43, 0x42, 0x55, 0x93, 0x07, 0xfc, 0x55, 0x56, 0x61, 0x6e, 0xed, 0x49, 0xdb, 0x0f, 
+  0x73, 0x5c, 0x0e, 0x51, 0x87, 0xc1, 0xdb, 0xe4, 0x17, 0x77, 0x0e, 0xc8, 0x59, 0x6e, 0x3b, 0xb5, 
+  0x73, 0xdc, 0x69, 0x67, 0xa8, 0x8b, 0x32, 0xbb, 0x7a, 0xcb, 0x09, 0xaa, 0x69, 0x06, 0x13, 0x7e, 
+  0xcd, 0x85, 0x20, 0xe4, 0xce, 0x23, 0x81, 0xa8, 0x87, 0x2d, 0xd5, 0xd3, 0xed, 0xf4, 0x18, 0x0c, 
+  0xa6, 0x87, 0x8e, 0xf4, 0x64, 0x9d, 0xf6, 0x74, 0x9a, 0xdd, 0x6e, 0xdc, 0x4e, 0xd6, 0xa2, 0x72, 
+  0xd3, 0x35, 0xe0, 0xce, 0xe6, 0x82, 0x1d, 0x35, 0xc6, 0xee, 0x6a, 0xce, 0x0a, 0xe7, 0xca, 0xed, 
+  0x74, 0x64, 0xdc, 0x20, 0xb3, 0x69, 0x87, 0x53, 0x6a, 0x6d, 0x17, 0xf1, 0x36, 0xe1, 0xa4, 0x05, 
+  0x1a, 0x45, 0xde, 0x78, 0xa9, 0x1e, 0xfa, 0x13, 0x8f, 0xc7, 0xc5, 0x85, 0xa7, 0x2d, 0xab, 0x0e, 
+  0x96, 0x5b, 0x3a, 0x58, 0x2d, 0x10, 0x86, 0xe3, 0x6a, 0xbf, 0x5e, 0x5e, 0xf0, 0xaa, 0x53, 0x14, 
+  0x93, 0x40, 0xc9, 0x2d, 0x92, 0x96, 0x50, 0x91, 0x2d, 0x0f, 0x31, 0xec, 0xad, 0xa3, 0x99, 0x69, 
+  0xa2, 0xc7, 0x24, 0xbe, 0xe3, 0x7c, 0xb6, 0x4f, 0x5f, 0xcd, 0xc5, 0xf4, 0x31, 0x6c, 0x9d, 0x11, 
+  0x55, 0x1f, 0x33, 0xad, 0xb5, 0xcf, 0x86, 0x2f, 0x67, 0x70, 0x0b, 0x48, 0xdc, 0x54, 0x1a, 0x6e, 
+  0xcc, 0x8b, 0xc3, 0xa5, 0xa2, 0x2c, 0x02, 0x5d, 0xf1, 0x97, 0xe6, 0x1b, 0x46, 0x46, 0x28, 0x61, 
+  0xfa, 0x19, 0xcd, 0x98, 0xd1, 0xa9, 0x43, 0x17, 0x75, 0x0c, 0x7d, 0xcf, 0x42, 0xd4, 0xc2, 0x17, 
+  0xec, 0x05, 0x9c, 0x0d, 0x7f, 0x8b, 0xc5, 0x73, 0x66, 0x36, 0xc2, 0xef, 0xda, 0x58, 0x71, 0x12, 
+  0x12, 0x03, 0x01, 0x13, 0x28, 0x2f, 0xae, 0x3a, 0xec, 0x09, 0x0e, 0x65, 0x97, 0x17, 0x68, 0x22, 
+  0xc2, 0xd0, 0x85, 0xc5, 0xc5, 0xa7, 0x83, 0xcc, 0x44, 0x98, 0x65, 0x58, 0x55, 0x7c, 0xac, 0xd3, 
+  0xdb, 0xde, 0x93, 0x68, 0xe0, 0x36, 0x09, 0x5a, 0xe5, 0xf7, 0x49, 0x1a, 0xdc, 0x3f, 0xb8, 0xc0, 
+  0xef, 0x05, 0x93, 0x8c, 0x57, 0x50, 0xf3, 0x94, 0xfc, 0x69, 0x9c, 0x7c, 0x64, 0x01, 0x4b, 0x4e, 
+  0xe9, 0x7e, 0x05, 0x7b, 0xe5, 0x59, 0xcf, 0x93, 0x0e, 0xe6, 0x35, 0xa9, 0x77, 0x1d, 0x70, 0x8d, 
+  0x1c, 0x46, 0xeb, 0x1f, 0x8b, 0xaa, 0xaa, 0xa3, 0x8e, 0xea, 0xb8, 0xd7, 0x8d, 0x38, 0xd0, 0x40, 
+  0x7a, 0xbc, 0xb9, 0x19, 0x0c, 0x2e, 0x90, 0x34, 0xb1, 0x33, 0x96, 0x84, 0x3d, 0x45, 0xdb, 0x83, 
+  0x61, 0xbe, 0xa6, 0x8c, 0xb2, 0x4a, 0x0d, 0xc0, 0x98, 0xa7, 0x20, 0x2b, 0x98, 0x9c, 0xda, 0xbc, 
+  0xc4, 0xd0, 0xc7, 0x6d, 0x99, 0x97, 0x3e, 0x63, 0x7b, 0x74, 0x0c, 0x2e, 0x09, 0xd9, 0x29, 0x14, 
+  0x4f, 0x1d, 0xdf, 0x95, 0x2a, 0x24, 0x9f, 0xa1, 0xdd, 0xa9, 0x21, 0x25, 0x8d, 0xa1, 0x93, 0x97, 
+  0x4b, 0x81, 0x47, 0xe8, 0xc4, 0x55, 0xdb, 0x30, 0x51, 0xf7, 0xfc, 0x75, 0x90, 0x96, 0xd3, 0x49, 
+  0x6a, 0x3d, 0x5b, 0xaf, 0x25, 0xa3, 0x60, 0x98, 0x28, 0xe6, 0x07, 0xc1, 0x9a, 0x80, 0x46, 0xc3, 
+  0x68, 0x42, 0xcb, 0xe4, 0xf8, 0xee, 0xdd, 0xfe, 0x85, 0x39, 0xb5, 0x38, 0xf6, 0xcf, 0xc2, 0xec, 
+  0x54, 0x10, 0x32, 0x6a, 0x45, 0xcc, 0xcc, 0xea, 0x32, 0x85, 0x65, 0x9f, 0x46, 0x7e, 0x8e, 0x9c, 
+  0x3c, 0xd8, 0x87, 0x5e, 0xb8, 0x8a, 0xf2, 0x11, 0x5f, 0x1a, 0x72, 0x17, 0x0a, 0x64, 0xcc, 0xde, 
+  0xa8, 0x3c, 0x88, 0x47, 0x25, 0xa0, 0xa8, 0x7c, 0x84, 0x2d, 0x83, 0x37, 0x05, 0x29, 0x51, 0xab, 
+  0x41, 0xa9, 0x51, 0x1c, 0xa5, 0x1e, 0x51, 0x52, 0x6e, 0x85, 0xce, 0x50, 0xbe, 0xd6, 0xad, 0xd0, 
+  0xd2, 0xa7, 0x8a, 0xe2, 0xcd, 0x41, 0x55, 0x93, 0xc9, 0x8a, 0xaa, 0xd6, 0x2a, 0x0a, 0x99, 0xf5, 
+  0xc2, 0x32, 0x12, 0x04, 0xf1, 0x34, 0xf3, 0x2d, 0x94, 0xf8, 0x1e, 0xe3, 0xb2, 0x1d, 0xec, 0x8d, 
+  0xf3, 0x01, 0x7e, 0x84, 0x99, 0x24, 0x67, 0x42, 0x42, 0x14, 0x8e, 0x2e, 0x18, 0xe7, 0xa1, 0xad, 
+  0x54, 0x0e, 0xfc, 0x6c, 0xb2, 0x3f, 0xe5, 0x64, 0x24, 0x39, 0xbc, 0xd8, 0xca, 0x41, 0xbc, 0xf3, 
+  0x03, 0x7d, 0xb1, 0x6d, 0x2d, 0x87, 0xff, 0xb4, 0x39, 0xf5, 0xd7, 0x18, 0xa4, 0x39, 0xfe, 0x59, 
+  0x46, 0x3f, 0xd0, 0x47, 0xae, 0x46, 0x83, 0x41, 0xa9, 0x06, 0x83, 0x65, 0x50, 0x1e, 0x50, 0xa7, 
+  0xe7, 0x3a, 0x4a, 0xb5, 0xd6, 0xf7, 0x92, 0x3d, 0xfe, 0x14, 0x8d, 0xc8, 0xdd, 0xbb, 0x6b, 0x5b, 
+  0xc0, 0x8e, 0xca, 0x92, 0x1f, 0xb3, 0x20, 0xf7, 0xcb, 0xdc, 0x9f, 0xab, 0xb5, 0xf9, 0x4e, 0xed, 
+  0x81, 0x17, 0xca, 0xa4, 0x6e, 0x16, 0x51, 0x0a, 0x4b, 0x19, 0xd3, 0xfc, 0x17, 0x95, 0x70, 0xbf, 
+  0x12, 0x41, 0x93, 0xea, 0xc3, 0x37, 0xef, 0xce, 0x6d, 0x8b, 0x44, 0xb8, 0xcd, 0x96, 0x64, 0xbf, 
+  0xcd, 0xd7, 0x29, 0xed, 0x0c, 0x9c, 0x64, 0x4b, 0x6f, 0x2f, 0xd6, 0x96, 0xc9, 0x32, 0xa7, 0x9f, 
+  0x67, 0xf9, 0xd0, 0xa8, 0x30, 0xe8, 0xdc, 0x5b, 0x02, 0xc0, 0x1a, 0xb1, 0x90, 0x90, 0x82, 0x69, 
+  0xa9, 0x53, 0x81, 0x7b, 0x5c, 0xe9, 0x5e, 0x4f, 0x24, 0xf5, 0x61, 0xef, 0xd9, 0x31, 0x17, 0xb8, 
+  0x4c, 0xe9, 0x08, 0xa5, 0x16, 0x60, 0x43, 0x66, 0x6b, 0xe7, 0x7c, 0x5d, 0xc0, 0xe7, 0x44, 0xda, 
+  0x56, 0x3a, 0xde, 0x52, 0xdc, 0xaa, 0x32, 0xf8, 0x57, 0x15, 0xf1, 0x79, 0x82, 0x34, 0x63, 0x8e, 
+  0x50, 0x60, 0xb6, 0x7a, 0x3e, 0x5c, 0xce, 0xdc, 0x80, 0x0c, 0xce, 0xf9, 0x63, 0x72, 0x8e, 0x31, 
+  0xfa, 0xaa, 0x56, 0x3e, 0x14, 0x81, 0xa2, 0xc2, 0x67, 0x74, 0x23, 0x1f, 0x3e, 0x81, 0x49, 0xe6, 
+  0x0f, 0xf0, 0x20, 0xf8, 0x71, 0x8a, 0x23, 0x32, 0x1f, 0xfe, 0xb1, 0xa9, 0xc5, 0x39, 0x3a, 0x44, 
+  0x7f, 0x4c, 0x3c, 0x6a, 0x68, 0x02, 0x27, 0x15, 0xeb, 0x91, 0x19, 0x02, 0x3a, 0x02, 0xe2, 0x6a, 
+  0xc7, 0x00, 0xca, 0xd3, 0xfa, 0x28, 0xbe, 0x6e, 0x3a, 0x89, 0x41, 0x18, 0x96, 0x7e, 0xba, 0x16, 
+  0x5f, 0x30, 0xa6, 0x74, 0xe1, 0x8c, 0xac, 0x05, 0xfb, 0x20, 0xba, 0x85, 0xd1, 0xa4, 0xc5, 0x7c, 
+  0xfd, 0x47, 0x78, 0x95, 0xa8, 0x22, 0x86, 0x93, 0xf9, 0x19, 0xff, 0x7b, 0x31, 0x03, 0x0a, 0xe8, 
+  0x29, 0x67, 0xc4, 0xfe, 0x2b, 0xc6, 0xbf, 0x9f, 0xf9, 0xce, 0x13, 0xfc, 0xf3, 0x3b, 0x52, 0x0f, 
+  0xa2, 0x47, 0x6a, 0x39, 0x0b, 0x39, 0x31, 0x09, 0xfb, 0xdd, 0xa9, 0x25, 0xdd, 0xde, 0x66, 0x80, 
+  0x44, 0xa9, 0xa5, 0xa4, 0xcb, 0x54, 0x6f, 0xe3, 0x7a, 0x41, 0x3c, 0x7b, 0x1b, 0xab, 0xdf, 0x66, 
+  0xec, 0xd0, 0xa3, 0x1e, 0x87, 0x34, 0x28, 0xbf, 0x87, 0x7b, 0xea, 0xe9, 0x5c, 0x3c, 0x7c, 0xac, 
+  0xed, 0x6b, 0xf2, 0x62, 0x1a, 0xe5, 0xaa, 0x20, 0xa9, 0xba, 0x4b, 0x99, 0x90, 0x76, 0x29, 0x7e, 
+  0x8a, 0x0e, 0xc5, 0x4f, 0x61, 0x05, 0xbf, 0x42, 0x3d, 0xc7, 0x69, 0x7b, 0xb1, 0x2e, 0x92, 0x31, 
+  0x4d, 0xe6, 0x67, 0x36, 0x66, 0xd2, 0x74, 0xe2, 0x4f, 0xad, 0x91, 0xd7, 0x41, 0x10, 0x66, 0xa2, 
+  0x05, 0xaa, 0x9c, 0x19, 0x6a, 0x67, 0x77, 0xa1, 0xde, 0x7c, 0xaf, 0x0e, 0xa9, 0x60, 0x1d, 0x12, 
+  0x2d, 0x34, 0xf8, 0xba, 0x0f, 0x4f, 0xe7, 0xf2, 0xd2, 0xa5, 0x03, 0x4f, 0x80, 0x55, 0xa8, 0x23, 
+  0x4e, 0xd0, 0x1d, 0xed, 0x46, 0xeb, 0xbe, 0x1b, 0x46, 0x32, 0xbd, 0xce, 0x96, 0x58, 0x73, 0x9f, 
+  0x62, 0x3f, 0x30, 0xc6, 0xda, 0xaf, 0x31, 0xea, 0xd3, 0x93, 0xdf, 0x66, 0x35, 0x90, 0x1c, 0x86, 
+  0x19, 0x86, 0xda, 0x9e, 0x17, 0xc0, 0xf3, 0x4e, 0xe5, 0x55, 0x5d, 0xe7, 0xea, 0x6a, 0xaf, 0x5e, 
+  0x4c, 0x87, 0xbf, 0x37, 0xf5, 0xad, 0xd6, 0x0f, 0xae, 0x65, 0x37, 0x41, 0xf1, 0xc7, 0x0d, 0x1b, 
+  0x03, 0x11, 0xee, 0xe1, 0xf3, 0x18, 0x78, 0x74, 0x8b, 0x58, 0x8c, 0x25, 0xef, 0x66, 0x4d, 0x71, 
+  0xb0, 0x6f, 0xdf, 0x55, 0x41, 0x40, 0x39, 0xcc, 0x2c, 0x14, 0xba, 0x16, 0xd7, 0xb1, 0x1f, 0x39, 
+  0x10, 0x8b, 0x37, 0x37, 0x0e, 0x44, 0x52, 0x67, 0x00, 0xfb, 0xbb, 0x19, 0x18, 0x8c, 0x77, 0x50, 
+  0xfc, 0x41, 0x8e, 0x2f, 0x3b, 0xa3, 0xbe, 0xcd, 0xeb, 0x3f, 0x03, 0x5c, 0x19, 0x42, 0x1b, 0x14, 
+  0x8e, 0x75, 0xb9, 0xb9, 0x77, 0x0f, 0xeb, 0xe5, 0x5e, 0xcf, 0x92, 0x2a, 0xd6, 0x40, 0x80, 0xa4, 
+  0xcd, 0x12, 0x9d, 0x7f, 0xd0, 0x20, 0x12, 0x23, 0xa6, 0x1b, 0x78, 0x28, 0x76, 0x44, 0xd8, 0x9d, 
+  0x27, 0xa0, 0x51, 0x88, 0xec, 0x77, 0x0e, 0x06, 0xb4, 0x02, 0x5f, 0x00, 0x99, 0x0d, 0x06, 0xca, 
+  0x8d, 0xfa, 0xa3, 0x35, 0xc2, 0xdc, 0x3b, 0x5b, 0xe1, 0xb1, 0xc0, 0x92, 0x21, 0xe8, 0x98, 0x71, 
+  0x5f, 0xbe, 0x01, 0x37, 0x5b, 0x31, 0x18, 0x6c, 0x5b, 0xcb, 0xd8, 0x6f, 0x9c, 0x0d, 0xeb, 0x31, 
+  0xd8, 0x84, 0x85, 0x58, 0x04, 0xf9, 0xc7, 0xe1, 0xc2, 0x2f, 0xa9, 0x27, 0x41, 0x60, 0x91, 0xb9, 
+  0x36, 0xea, 0xd9, 0xa2, 0xa5, 0x55, 0x44, 0x45, 0x3b, 0x4d, 0x17, 0x06, 0x84, 0xfa, 0x97, 0xd8, 
+  0x07, 0xa0, 0x84, 0xfa, 0xd4, 0xee, 0xbe, 0xe9, 0x7a, 0x15, 0xfd, 0x06, 0xaa, 0xb9, 0x77, 0x90, 
+  0x60, 0x41, 0xfd, 0xd6, 0x7e, 0xc1, 0xaf, 0xf1, 0xd8, 0x34, 0x7f, 0x16, 0x6b, 0xc9, 0x0f, 0x17, 
+  0x45, 0x0c, 0xc1, 0x57, 0x80, 0xb5, 0x9f, 0xcc, 0x31, 0x56, 0xff, 0x6c, 0xd9, 0x39, 0xe0, 0xa2, 
+  0xe3, 0x60, 0x4b, 0x58, 0x26, 0x4c, 0x9c, 0x15, 0x16, 0xca, 0xb8, 0x49, 0xb0, 0xf7, 0x88, 0xe8, 
+  0x0a, 0xea, 0x65, 0x7e, 0x93, 0x32, 0x66, 0x95, 0x31, 0x1e, 0xb6, 0x5a, 0xd5, 0xfa, 0xc8, 0xbc, 
+  0x55, 0xc6, 0xbb, 0xa9, 0x02, 0x7a, 0x6b, 0xb6, 0xf3, 0x64, 0x2e, 0xed, 0x6c, 0xd4, 0x93, 0x79, 
+  0xf7, 0x88, 0x70, 0xd6, 0xf9, 0xb6, 0x8b, 0x14, 0x1c, 0x2e, 0x49, 0xe4, 0x2d, 0xc7, 0x7e, 0xcd, 
+  0xf3, 0xc9, 0x0c, 0xc2, 0xd3, 0xb9, 0x9c, 0x49, 0xf2, 0xfb, 0x16, 0x5f, 0x28, 0x2c, 0x04, 0x49, 
+  0x29, 0x40, 0x5c, 0x41, 0x98, 0xd0, 0x04, 0x8d, 0x13, 0x9e, 0xa5, 0x3d, 0x5c, 0x99, 0x67, 0xa7, 
+  0xf1, 0x16, 0x69, 0x99, 0xda, 0x67, 0xcc, 0x5b, 0x22, 0xcc, 0x45, 0x24, 0x38, 0x6c, 0xfd, 0x92, 
+  0xa7, 0x9b, 0xfe, 0xfc, 0x15, 0x1b, 0x70, 0x5e, 0xba, 0x14, 0x3c, 0x32, 0x5c, 0xd0, 0x26, 0x44, 
+  0xf4, 0xa0, 0x1f, 0xe8, 0xad, 0x4c, 0xb4, 0xad, 0x96, 0x7c, 0x4c, 0x7c, 0x36, 0x7c, 0x8b, 0x03, 
+  0x05, 0xd2, 0xb7, 0x3f, 0x42, 0xab, 0x34, 0xb1, 0xe2, 0x9d, 0x2b, 0xdb, 0xfc, 0x6a, 0xe1, 0x9a, 
+  0xff, 0xa5, 0xc0, 0xfe, 0xc6, 0x62, 0x81, 0x6e, 0xd4, 0xd5, 0xe2, 0xd6, 0x6e, 0x33, 0xbf, 0x5b, 
+  0xd2, 0x26, 0x1e, 0x5f, 0x25, 0x21, 0xf5, 0xe3, 0xf7, 0x51, 0x16, 0x5d, 0x5f, 0x2c, 0x78, 0xe9, 
+  0xa8, 0x33, 0x3a, 0xb4, 0x88, 0x36, 0xbd, 0xc6, 0x9f, 0xdf, 0x19, 0x47, 0x1b, 0x4e, 0x09, 0xd7, 
+  0xf9, 0x82, 0xc8, 0x5f, 0xb6, 0x08, 0x57, 0x2a, 0x97, 0x72, 0xc5, 0x0c, 0x7e, 0xb8, 0x8a, 0xca, 
+  0x42, 0x7e, 0xa3, 0xb2, 0xd1, 0x9e, 0x3e, 0x39, 0x45, 0x9c, 0x5e, 0xb0, 0x9b, 0x9b, 0x49, 0x85, 
+  0x80, 0xb1, 0xfa, 0x5d, 0xf4, 0x27, 0xb0, 0x6e, 0x0c, 0xff, 0x40, 0x86, 0x18, 0xdf, 0x7c, 0xb1, 
+  0x32, 0xc6, 0xed, 0xe1, 0x93, 0xb1, 0xf5, 0xa7, 0x08, 0xb7, 0x29, 0xe9, 0xa9, 0x72, 0x43, 0x41, 
+  0x4f, 0xaf, 0xff, 0x83, 0xf8, 0xfb, 0xdb, 0x2a, 0x38, 0xb6, 0x02, 0xfa, 0x62, 0xe2, 0x48, 0x12, 
+  0xbd, 0x33, 0x3b, 0xcb, 0x6b, 0x4d, 0xc0, 0x5f, 0x73, 0x5d, 0xe8, 0xaf, 0x39, 0xcc, 0x2b, 0xc5, 
+  0x6d, 0x55, 0x48, 0x40, 0xb9, 0x8c, 0xcf, 0xd0, 0x3e, 0x51, 0xee, 0x2f, 0x4d, 0x97, 0x68, 0x17, 
+  0xda, 0xe6, 0xf7, 0x79, 0xb5, 0xd5, 0x97, 0xb3, 0x71, 0xa6, 0x21, 0x49, 0xe9, 0x37, 0x9d, 0xa2, 
+  0x7e, 0x87, 0x5f, 0x07, 0x7d, 0x1e, 0xd0, 0xec, 0xfb, 0x09, 0xfa, 0xad, 0x0f, 0x91, 0xe1, 0xd9, 
+  0x0c, 0x7e, 0x30, 0x09, 0xb6, 0x3d, 0x28, 0x06, 0x3b, 0x78, 0xb9, 0xc6, 0x95, 0xe6, 0xbc, 0x9b, 
+  0x99, 0x28, 0x85, 0x6a, 0x00, 0xbd, 0x83, 0xa6, 0x24, 0x00, 0x71, 0x7b, 0xa2, 0xbf, 0x4b, 0xb3, 
+  0x68, 0xfc, 0x9b, 0x4f, 0x4f, 0xfa, 0xac, 0x96, 0xd7, 0x87, 0x66, 0x14, 0xca, 0x99, 0x46, 0x3e, 
+  0xc2, 0x5a, 0x48, 0xf4, 0x78, 0x9d, 0xcf, 0xa3, 0xed, 0xc7, 0xe3, 0x13, 0xed, 0x37, 0x25, 0xb4, 
+  0x6a, 0x6c, 0xdf, 0x12, 0x56, 0xd4, 0x4c, 0x72, 0x9c, 0xea, 0x4b, 0xbc, 0x5a, 0x48, 0x67, 0xdb, 
+  0xed, 0x29, 0x9f, 0xdb, 0xa6, 0xfe, 0xa8, 0x6a, 0xa0, 0x01, 0x16, 0x94, 0x1b, 0x34, 0x51, 0x99, 
+  0x64, 0x03, 0xdc, 0xd9, 0x3e, 0x42, 0x87, 0xeb, 0x34, 0xab, 0x4e, 0x87, 0x65, 0x9c, 0x93, 0xe1, 
+  0x63, 0xeb, 0x0d, 0xd0, 0x3a, 0xab, 0x9d, 0xc4, 0x04, 0x98, 0x83, 0x25, 0x8a, 0xff, 0xe6, 0xba, 
+  0x83, 0xd1, 0x3d, 0x85, 0x5b, 0x78, 0xfa, 0x98, 0x53, 0x32, 0x60, 0x83, 0xd0, 0xbf, 0x7f, 0x49, 
+  0x1f, 0xb9, 0x67, 0xfb, 0x4a, 0xcf, 0x1c, 0xfd, 0x7d, 0x22, 0x7f, 0x96, 0x52, 0xf6, 0x6d, 0xac, 
+  0xeb, 0xcc, 0xf1, 0x97, 0xbb, 0xff, 0x62, 0xce, 0x06, 0xe4, 0xe5, 0x8c, 0x25, 0xd5, 0x8d, 0x7a, 
+  0x1d, 0x5d, 0xff, 0xd6, 0xa6, 0x4e, 0xb2, 0xfb, 0xe0, 0xec, 0x8e, 0x2f, 0x01, 0x99, 0x01, 0x57, 
+  0x0e, 0x0d, 0xc7, 0x93, 0x4a, 0x82, 0x87, 0x9f, 0x24, 0xe7, 0x62, 0x97, 0xb7, 0xe6, 0xd4, 0x99, 
+  0x9b, 0x9b, 0x54, 0xa6, 0x3f, 0xa7, 0xee, 0x32, 0x9f, 0x99, 0x73, 0x87, 0x53, 0x9e, 0x22, 0xa0, 
+  0xd1, 0x60, 0x4b, 0x0a, 0x66, 0x98, 0x65, 0x6b, 0x64, 0x74, 0xf2, 0xad, 0x9c, 0x4c, 0x62, 0x75, 
+  0x5f, 0x59, 0xa7, 0x3f, 0x45, 0xce, 0x27, 0x3e, 0xd1, 0xa2, 0x14, 0xf9, 0x14, 0x88, 0x89, 0x43, 
+  0x04, 0x2d, 0x9f, 0xfe, 0xe0, 0x62, 0x21, 0x18, 0xbf, 0x88, 0x95, 0x14, 0x8a, 0x40, 0x6b, 0xa4, 
+  0x8b, 0xe8, 0x8c, 0xdb, 0xa9, 0x8d, 0xc8, 0x1d, 0x69, 0xc7, 0xb6, 0xcc, 0x9d, 0x6d, 0x49, 0x43, 
+  0x36, 0xef, 0xf0, 0x5f, 0xb2, 0xb3, 0x9e, 0x71, 0x2b, 0x95, 0x92, 0x23, 0xd1, 0x7e, 0x5a, 0x50, 
+  0x31, 0xcc, 0x2b, 0xed, 0x82, 0x7c, 0x73, 0xd6, 0xbd, 0x22, 0x70, 0x1f, 0x9d, 0xc5, 0xb1, 0x08, 
+  0x9e, 0x41, 0x3d, 0xc7, 0xdf, 0xe7, 0xb1, 0x7a, 0x81, 0xbf, 0x2f, 0x62, 0xd0, 0xc9, 0x15, 0x54, 
+  0xb1, 0x38, 0x20, 0x9f, 0x58, 0xd7, 0xc0, 0x6e, 0x1f, 0xce, 0x78, 0xb5, 0x4c, 0x92, 0x0b, 0x76, 
+  0x16, 0xaa, 0x3b, 0x75, 0x6d, 0xe1, 0x1a, 0x9e, 0x30, 0xcc, 0x14, 0xa6, 0xb2, 0x7b, 0x33, 0xeb, 
+  0x8d, 0x7b, 0xee, 0x6c, 0x5c, 0x0c, 0xca, 0x9b, 0xd6, 0x3a, 0x72, 0xc6, 0x80, 0xd6, 0x4c, 0x8d, 
+  0xd2, 0x56, 0xc3, 0x72, 0xe9, 0x7f, 0xc3, 0x2c, 0xfa, 0xbc, 0x66, 0x16, 0xfd, 0x59, 0x3d, 0x53, 
+  0x4f, 0xd5, 0x63, 0x75, 0x47, 0xbd, 0x57, 0xbf, 0xab, 0x77, 0xea, 0x17, 0xf5, 0x55, 0x3d, 0x51, 
+  0x7f, 0xa8, 0x3f, 0xd5, 0xaf, 0xea, 0x37, 0xf5, 0x4f, 0x63, 0x34, 0xad, 0x1c, 0x66, 0x12, 0xa0, 
+  0x42, 0xa7, 0x48, 0xe4, 0x86, 0x85, 0x1a, 0xe5, 0x74, 0x76, 0x26, 0x97, 0x3d, 0x92, 0xc7, 0xda, 
+  0x36, 0x34, 0x5a, 0x3f, 0x48, 0x48, 0x2c, 0xe2, 0x13, 0x31, 0xa5, 0x05, 0x71, 0xff, 0x91, 0x40, 
+  0x9f, 0x15, 0x2e, 0x02, 0xf6, 0x9b, 0xe4, 0xe4, 0xd1, 0x97, 0x8b, 0xc6, 0x4d, 0x40, 0x02, 0x34, 
+  0x6e, 0x89, 0x57, 0x51, 0xe3, 0xe6, 0x4b, 0xf6, 0x6d, 0x6d, 0xdc, 0xfc, 0x59, 0x5c, 0x5f, 0x6d, 
+  0x2e, 0x25, 0xc9, 0x97, 0x13, 0x15, 0x2d, 0xdc, 0x6d, 0x24, 0x77, 0xb6, 0x50, 0x03, 0x24, 0x28, 
+  0xaf, 0x90, 0x32, 0xab, 0x40, 0x74, 0x48, 0x1b, 0x12, 0xad, 0x0d, 0xda, 0xed, 0x22, 0x34, 0x8f, 
+  0xb2, 0xca, 0xda, 0xc5, 0x21, 0xe0, 0x00, 0xd7, 0xec, 0x54, 0xe1, 0x96, 0x39, 0x70, 0x97, 0x38, 
+  0x99, 0xbd, 0xfc, 0xf4, 0x34, 0x67, 0x81, 0xd6, 0x74, 0x02, 0x0a, 0x46, 0x09, 0xac, 0xa1, 0xe0, 
+  0x98, 0x53, 0x83, 0x86, 0x14, 0x71, 0xb9, 0x46, 0x1f, 0x55, 0x25, 0x37, 0xd6, 0x8a, 0x29, 0x93, 
+  0x2b, 0x2f, 0xe4, 0x2b, 0xed, 0x29, 0x2e, 0x17, 0x3a, 0x6a, 0x4d, 0x2e, 0x6c, 0xcf, 0x42, 0xb8, 
+  0x4e, 0x45, 0xa5, 0xab, 0x5c, 0xd2, 0x33, 0x19, 0x6a, 0xd5, 0x96, 0x49, 0xb7, 0x13, 0x1a, 0xea, 
+  0x80, 0xb0, 0xfa, 0x32, 0x18, 0x71, 0x45, 0xc1, 0x54, 0x18, 0x67, 0x61, 0x82, 0x50, 0x22, 0x2c, 
+  0x0c, 0x28, 0xbe, 0x63, 0x27, 0xcb, 0x45, 0x62, 0x18, 0xe4, 0xb3, 0xe4, 0x6a, 0x05, 0xd5, 0x11, 
+  0x5f, 0xb0, 0x9c, 0x8f, 0xcb, 0xaa, 0x64, 0x06, 0xa5, 0xe3, 0xf5, 0xfe, 0x0f, 0x3f, 0x72, 0xea, 
+  0x79, 0x07, 0x25, 0xab, 0x8e, 0x21, 0xc7, 0x10, 0x5a, 0xc6, 0x58, 0xb6, 0xaf, 0x76, 0xf6, 0xb5, 
+  0x93, 0x61, 0x69, 0x8c, 0x96, 0x7e, 0x32, 0x88, 0xbc, 0x0f, 0x99, 0xf2, 0x02, 0x1d, 0x8e, 0xf3, 
+  0x34, 0x30, 0xc8, 0x5e, 0x02, 0xda, 0x7b, 0x50, 0xb4, 0xc0, 0xa7, 0x63, 0x56, 0xf2, 0xd1, 0x12, 
+  0x99, 0xac, 0xe0, 0xd2, 0xb9, 0x92, 0xe1, 0x5e, 0x47, 0x71, 0xfd, 0xdd, 0xa8, 0xfe, 0xd3, 0x4f, 
+  0xd4, 0xbf, 0xb5, 0xac, 0xff, 0x83, 0x68, 0x0f, 0x99, 0x98, 0x25, 0xf2, 0x1c, 0x84, 0x4f, 0x3b, 
+  0x8b, 0x5c, 0xd3, 0xb7, 0x86, 0xa5, 0x56, 0x39, 0x9a, 0x5c, 0x1b, 0x34, 0xcf, 0xe1, 0xf5, 0x3a, 
+  0x3b, 0xcb, 0xf2, 0xcb, 0x0c, 0x0a, 0x08, 0xe7, 0x3e, 0x94, 0x9e, 0x39, 0x47, 0x37, 0x11, 0xf9, 
+  0x06, 0x48, 0x70, 0x9a, 0xad, 0x93, 0x8d, 0xc5, 0x89, 0xfc, 0xb7, 0xbf, 0xd9, 0x57, 0xf6, 0x73, 
+  0xb0, 0xb2, 0x92, 0xe3, 0x34, 0xb5, 0x9f, 0x41, 0xeb, 0x42, 0xdc, 0xd4, 0x1a, 0x95, 0x51, 0xe3, 
+  0x27, 0x80, 0xb5, 0xad, 0xa9, 0x86, 0x93, 0xf0, 0x5a, 0x6e, 0xd6, 0x3e, 0x6e, 0x9f, 0x36, 0xea, 
+  0x4f, 0x3f, 0xb4, 0xef, 0x06, 0x81, 0x69, 0x72, 0x64, 0x5a, 0x5a, 0xb9, 0x8d, 0x8d, 0xfd, 0x35, 
+  0x46, 0x0d, 0xe8, 0xd5, 0x32, 0xda, 0x8f, 0x41, 0xde, 0xfa, 0x77, 0x26, 0xeb, 0xc9, 0xde, 0x74, 
+  0xca, 0xee, 0x77, 0x32, 0x5f, 0x1c, 0x81, 0xe7, 0x57, 0xc9, 0xbe, 0xe3, 0x60, 0x40, 0xad, 0x57, 
+  0x53, 0xb4, 0x8a, 0x76, 0xf6, 0x55, 0x1c, 0x79, 0xbb, 0x5e, 0x10, 0xfe, 0x04, 0xa3, 0xf0, 0xfa, 
+  0xe6, 0x46, 0x16, 0x03, 0xfd, 0xf8, 0x3b, 0xbe, 0x77, 0x3d, 0x1e, 0x0c, 0xf2, 0xf0, 0xa7, 0x7d, 
+  0xf3, 0xec, 0xdf, 0xf4, 0x33, 0x2e, 0x33, 0xde, 0xd9, 0xc9, 0x65, 0x54, 0x8d, 0x7f, 0xe4, 0x8f, 
+  0x3f, 0xf5, 0xb9, 0xbb, 0x3f, 0xfe, 0xbd, 0xcf, 0xe5, 0x7c, 0x04, 0xa2, 0xba, 0xcb, 0x66, 0xa3, 
+  0xb1, 0xdc, 0xe2, 0x60, 0xc3, 0x9a, 0xc1, 0x86, 0xa9, 0xf9, 0x5d, 0x36, 0x8b, 0x97, 0xd8, 0xf0, 
+  0x8b, 0x9e, 0x04, 0x83, 0x9d, 0x26, 0xab, 0x64, 0xa5, 0x7a, 0xb3, 0x22, 0x9e, 0xe3, 0x6f, 0x5e, 
+  0xf0, 0xcf, 0xb3, 0x04, 0x00, 0x9b, 0x55, 0xd8, 0x6a, 0xa5, 0x71, 0x4c, 0x1c, 0x41, 0xfe, 0x6f, 
+  0xf5, 0x7c, 0xa4, 0xef, 0x04, 0x79, 0xee, 0x77, 0xc0, 0x5e, 0x27, 0x5f, 0x90, 0x12, 0xb8, 0x8a, 
+  0xac, 0x73, 0xa0, 0x1e, 0x6e, 0x69, 0xe1, 0x97, 0xef, 0x6a, 0x21, 0x4f, 0x5a, 0x09, 0x7e, 0x68, 
+  0x87, 0xec, 0x6b, 0x10, 0xf9, 0x06, 0x10, 0x38, 0x2f, 0xb0, 0x14, 0x50, 0x91, 0x1a, 0x21, 0x41, 
+  0x80, 0x10, 0x32, 0x3a, 0x11, 0xc0, 0xad, 0xd1, 0x9c, 0xec, 0xec, 0x14, 0x36, 0x9d, 0x44, 0x6a, 
+  0x20, 0xe6, 0xe1, 0xd1, 0x2d, 0x95, 0x8a, 0xc1, 0x60, 0x23, 0xd8, 0x26, 0x5b, 0x31, 0xe7, 0xe6, 
+  0xcb, 0x9c, 0x13, 0x1c, 0xcd, 0xf3, 0x73, 0x76, 0x9a, 0x28, 0xe3, 0x13, 0xe8, 0x40, 0x79, 0x15, 
+  0x84, 0x88, 0x8c, 0x74, 0x3e, 0x63, 0xe4, 0x78, 0x2e, 0x3a, 0x29, 0xb3, 0x92, 0x1a, 0xaf, 0x92, 
+  0xd4, 0x83, 0x80, 0xc7, 0x15, 0xb4, 0xfc, 0xb8, 0x96, 0x99, 0xc8, 0xfd, 0x52, 0x0c, 0x96, 0x73, 
+  0x55, 0x6f, 0x7f, 0x95, 0x48, 0xec, 0x8a, 0x89, 0xf8, 0xfe, 0x2e, 0x4d, 0xc5, 0x9f, 0xaa, 0x08, 
+  0xc6, 0x7f, 0x4e, 0x8a, 0x69, 0xf8, 0xc7, 0x28, 0x1f, 0xe7, 0x35, 0x3b, 0x4a, 0xe8, 0xd3, 0x41, 
+  0x89, 0x67, 0xda, 0xa5, 0xfe, 0x4d, 0x50, 0x7b, 0xdc, 0xc8, 0x67, 0xb8, 0x4e, 0x7c, 0x78, 0x86, 
+  0x22, 0x7f, 0x5b, 0x7a, 0xe2, 0x29, 0x30, 0x62, 0xae, 0xb2, 0xa9, 0x1c, 0xa3, 0x00, 0x70, 0xf2, 
+  0xa0, 0xfe, 0xca, 0x33, 0x8e, 0xf5, 0x9d, 0xd0, 0x10, 0x4c, 0x6b, 0x87, 0x85, 0x9c, 0x5b, 0x1b, 
+  0x08, 0x2e, 0xcc, 0x35, 0x4a, 0xe0, 0x42, 0xe3, 0x4c, 0xa9, 0x46, 0x51, 0xe0, 0x63, 0x48, 0xf0, 
+  0x58, 0x5d, 0x65, 0x73, 0x9a, 0xba, 0x2c, 0x5f, 0xaf, 0x82, 0xd1, 0xaf, 0xe8, 0xf3, 0x35, 0x93, 
+  0x7f, 0xc9, 0x40, 0x9d, 0xa8, 0xc7, 0x24, 0x6e, 0x4a, 0x82, 0xcc, 0x32, 0xe9, 0xe1, 0x9b, 0x54, 
+  0x4a, 0xe7, 0xfb, 0x38, 0xef, 0xb2, 0x7b, 0x05, 0xa1, 0x09, 0x8d, 0x71, 0xfd, 0xa9, 0x3b, 0x4b, 
+  0x72, 0xc6, 0xd1, 0x34, 0xaa, 0xe1, 0x9c, 0xac, 0x39, 0x36, 0x15, 0x96, 0x43, 0xc3, 0x5a, 0xf9, 
+  0x69, 0x94, 0x42, 0x4d, 0x4a, 0x5b, 0x9c, 0xbe, 0x1f, 0x8a, 0x70, 0x63, 0xd1, 0x0e, 0x4c, 0x3e, 
+  0x12, 0x49, 0xde, 0x61, 0x5d, 0x4d, 0x4a, 0xe6, 0xb5, 0x73, 0xb9, 0x11, 0x6b, 0x85, 0x40, 0x6e, 
+  0xad, 0xb5, 0x99, 0x31, 0x86, 0xd5, 0xec, 0x5b, 0xe3, 0x82, 0xc7, 0x4c, 0x70, 0x16, 0x39, 0x2b, 
+  0x18, 0xd0, 0x5b, 0x42, 0xa7, 0x3f, 0x9b, 0x00, 0x2e, 0xf9, 0x7f, 0xd0, 0x2e, 0x61, 0xa9, 0xa1, 
+  0x0f, 0xea, 0x76, 0xc1, 0xf9, 0x87, 0x9e, 0x73, 0xc7, 0x1e, 0x7d, 0x41, 0x08, 0x13, 0x34, 0xaa, 
+  0x41, 0x33, 0x30, 0x58, 0xcf, 0x59, 0x4f, 0x7f, 0x81, 0x68, 0xe1, 0x18, 0xaa, 0xf8, 0x4a, 0x74, 
+  0xdf, 0x0c, 0x99, 0x98, 0x66, 0x9f, 0xf3, 0x33, 0x86, 0x6f, 0x3e, 0x15, 0xe5, 0x1c, 0xa0, 0x29, 
+  0x94, 0x68, 0xeb, 0xae, 0xb4, 0xbe, 0x1c, 0x8f, 0x75, 0x0d, 0x67, 0xd6, 0x96, 0x57, 0x43, 0xc3, 
+  0x4f, 0xb8, 0x1d, 0xe6, 0x1b, 0xfa, 0xbb, 0x36, 0xcf, 0x27, 0xff, 0x84, 0xcb, 0x5b, 0x0e, 0xc7, 
+  0xad, 0xf9, 0x77, 0xbb, 0x8d, 0x25, 0xa8, 0x15, 0x45, 0xa8, 0x0c, 0xf5, 0xc3, 0xa3, 0xc5, 0x16, 
+  0xcb, 0xf6, 0x9c, 0xed, 0xc3, 0x09, 0xf1, 0xc0, 0xf2, 0xef, 0xf0, 0xf3, 0x6c, 0x53, 0x77, 0xf4, 
+  0x84, 0x31, 0x3a, 0xd7, 0x96, 0x6a, 0xe3, 0xa1, 0x5b, 0xd6, 0xdd, 0xc1, 0x72, 0x6b, 0xc8, 0x3e, 
+  0x74, 0x2a, 0xbd, 0xb4, 0x1e, 0xa0, 0xab, 0xd7, 0x6b, 0x62, 0x7e, 0x9d, 0x47, 0x8f, 0x16, 0x0d, 
+  0x6f, 0x52, 0xf6, 0x1e, 0x7b, 0x2e, 0xde, 0x60, 0xcf, 0x8d, 0xf7, 0xd8, 0x73, 0xe3, 0x3d, 0xf6, 
+  0xdc, 0x89, 0x47, 0x7a, 0x6e, 0x82, 0x91, 0xe8, 0x66, 0xba, 0x7a, 0x30, 0x07, 0xa8, 0x25, 0xee, 
+  0x7e, 0x8a, 0xed, 0xed, 0x6e, 0xdf, 0xd8, 0xe7, 0xda, 0x33, 0xb6, 0xab, 0x08, 0x9e, 0x8a, 0x27, 
+  0xec, 0xe5, 0xac, 0xd3, 0x74, 0xdb, 0x35, 0xc8, 0x63, 0xfa, 0x70, 0xd6, 0xea, 0x5e, 0x43, 0x57, 
+  0xcb, 0x9e, 0x5b, 0xa1, 0xc9, 0x48, 0x62, 0x1c, 0xbc, 0x36, 0x48, 0x84, 0xc2, 0xba, 0x7f, 0x51, 
+  0xf7, 0x4b, 0x5a, 0x42, 0xe3, 0xaf, 0x77, 0xd1, 0x18, 0x96, 0x4b, 0x76, 0xb2, 0xbd, 0x33, 0x6f, 
+  0x7a, 0xbc, 0xed, 0x75, 0xa0, 0x8c, 0xd5, 0x56, 0xea, 0x7b, 0x17, 0x44, 0xfc, 0x2c, 0x67, 0xae, 
+  0x55, 0x89, 0x31, 0x0a, 0x6b, 0x52, 0xfb, 0x32, 0xb2, 0x19, 0x2b, 0x06, 0x19, 0xcf, 0x91, 0xae, 
+  0xf5, 0x33, 0x11, 0x44, 0xd7, 0x63, 0x2d, 0x69, 0x28, 0xb5, 0x2b, 0xfc, 0xa4, 0xbd, 0x91, 0xf1, 
+  0x81, 0x28, 0x0f, 0xf6, 0xf7, 0xd8, 0x54, 0x4a, 0x4c, 0x82, 0xe3, 0x54, 0x21, 0x3e, 0x6b, 0xc2, 
+  0x20, 0x47, 0x5b, 0x32, 0xea, 0x62, 0x60, 0xee, 0xcc, 0x8d, 0x47, 0xdc, 0xf1, 0x5c, 0x3f, 0x26, 
+  0x69, 0x2e, 0xa9, 0xc8, 0x75, 0x74, 0x4d, 0x1d, 0x23, 0xce, 0x63, 0x3d, 0x2f, 0xf3, 0x22, 0x24, 
+  0x41, 0x05, 0x3c, 0xfe, 0x2d, 0x89, 0x8f, 0x2c, 0xab, 0xaa, 0xb4, 0x13, 0xcf, 0xd8, 0xe1, 0x57, 
+  0xd9, 0x77, 0x27, 0xac, 0xca, 0x98, 0xbc, 0x45, 0x2e, 0x4f, 0x6b, 0x70, 0x88, 0xa8, 0x1f, 0x75, 
+  0xec, 0x32, 0xd7, 0x1d, 0x49, 0x4f, 0x6a, 0xfd, 0x75, 0x41, 0xed, 0x55, 0xc9, 0x14, 0xb9, 0xb4, 
+  0xf4, 0xbc, 0x62, 0x20, 0x3c, 0x9e, 0xc9, 0xa0, 0xba, 0x41, 0xa2, 0x83, 0x1d, 0x23, 0xdc, 0xfe, 
+  0xdd, 0xd9, 0x92, 0x74, 0x84, 0x81, 0x70, 0x3a, 0xce, 0xcd, 0xd6, 0x21, 0x0c, 0xab, 0x82, 0xa3, 
+  0x70, 0xec, 0x9a, 0x7a, 0x12, 0x87, 0x26, 0xaa, 0x70, 0xd3, 0x54, 0x2f, 0xd7, 0x62, 0xcc, 0x58, 
+  0x94, 0x66, 0x1b, 0x3d, 0xfb, 0x07, 0x38, 0xc8, 0x70, 0x1d, 0x54, 0x1d, 0xb2, 0x28, 0xb4, 0x6e, 
+  0xcd, 0xf5, 0x6e, 0x0d, 0x84, 0x74, 0x84, 0x9e, 0xa7, 0x2b, 0x24, 0x03, 0x19, 0x03, 0x84, 0x97, 
+  0x23, 0xcc, 0x80, 0x3e, 0x82, 0x63, 0x52, 0x3f, 0x63, 0x3c, 0x27, 0xfe, 0x60, 0xb8, 0x55, 0x7a, 
+  0xfc, 0x91, 0xf8, 0xd4, 0x75, 0x74, 0xfd, 0xbc, 0x1e, 0xe2, 0xac, 0xe5, 0x21, 0x8b, 0xc0, 0x2a, 
+  0x92, 0xcc, 0x85, 0xc8, 0x38, 0xc6, 0x32, 0xc0, 0x68, 0xea, 0x02, 0x3d, 0x47, 0xa7, 0xf8, 0x43, 
+  0xc1, 0x1a, 0x7b, 0xc5, 0x85, 0x98, 0xe5, 0xf8, 0xf8, 0x71, 0xec, 0x22, 0x87, 0x7d, 0x1c, 0x1e, 
+  0x5b, 0xd3, 0xd8, 0x9f, 0xb3, 0x20, 0xd4, 0x20, 0x39, 0x48, 0x84, 0x72, 0xe2, 0x24, 0x42, 0x61, 
+  0x7c, 0x6d, 0xf1, 0x37, 0xf5, 0x38, 0xaf, 0xc8, 0xd6, 0x87, 0x43, 0x31, 0x0a, 0xa7, 0xc9, 0x62, 
+  0xac, 0x11, 0x51, 0x43, 0xcb, 0xbe, 0xf1, 0xa5, 0xb6, 0xee, 0x33, 0x48, 0x8f, 0xe9, 0x36, 0xd6, 
+  0x4b, 0x95, 0x5c, 0x85, 0x11, 0x36, 0xa9, 0x97, 0xeb, 0xe1, 0x73, 0x1a, 0x33, 0xdd, 0xbb, 0x49, 
+  0xe3, 0xf9, 0x34, 0xa0, 0xb5, 0xd3, 0xb0, 0xa0, 0xf7, 0xf4, 0x2b, 0xa0, 0x87, 0x6e, 0x67, 0x69, 
+  0xba, 0x7d, 0xfc, 0x3a, 0xd0, 0x96, 0x7d, 0x17, 0x29, 0xab, 0x3e, 0x50, 0x80, 0xcd, 0x52, 0xde, 
+  0xad, 0xc3, 0xcc, 0xce, 0xb4, 0x48, 0x78, 0x2b, 0x10, 0x72, 0xb7, 0xcf, 0x89, 0x45, 0x8f, 0x2d, 
+  0xd9, 0x89, 0x7e, 0xeb, 0x6b, 0x4b, 0x68, 0xf5, 0x6e, 0x6d, 0x49, 0x74, 0x7c, 0xd2, 0x58, 0x47, 
+  0x18, 0x75, 0x19, 0x02, 0x90, 0xdd, 0x75, 0xb3, 0xd0, 0x13, 0xe1, 0x79, 0x92, 0xf8, 0xd4, 0xa4, 
+  0x40, 0x85, 0xca, 0x14, 0xfa, 0xbe, 0x5a, 0x48, 0x20, 0x89, 0x2f, 0x92, 0x7b, 0xc8, 0x4e, 0x8b, 
+  0x9b, 0x83, 0x88, 0x44, 0x17, 0x46, 0x64, 0x43, 0x20, 0x78, 0x7d, 0xee, 0xf2, 0x69, 0x10, 0x48, 
+  0x26, 0x62, 0xd8, 0xdb, 0x0b, 0xb1, 0xe0, 0x21, 0x8b, 0x6e, 0x1a, 0xe5, 0x3a, 0xe5, 0x27, 0x72, 
+  0x6e, 0xd0, 0x2a, 0x20, 0xee, 0xa7, 0xd4, 0x10, 0x76, 0xc8, 0x05, 0x84, 0x64, 0xdd, 0x81, 0x80, 
+  0x98, 0xbb, 0x93, 0x1f, 0xa5, 0xea, 0xdf, 0x35, 0x18, 0xf1, 0x7b, 0xab, 0x02, 0xea, 0x34, 0xb5, 
+  0x34, 0xaa, 0x01, 0xa1, 0xb6, 0xe9, 0x7d, 0xe1, 0x24, 0x7d, 0x35, 0xb0, 0xf5, 0x25, 0x60, 0xeb, 
+  0xab, 0x39, 0xb1, 0xd8, 0x7e, 0xd2, 0x1a, 0x00, 0xc8, 0x32, 0x24, 0xf0, 0xe4, 0xa0, 0x8c, 0x75, 
+  0xd0, 0xfd, 0x8c, 0x0d, 0xf1, 0x12, 0x92, 0xa1, 0x78, 0x3c, 0xb6, 0x95, 0x63, 0x63, 0xbf, 0x53, 
+  0xf0, 0x8a, 0xcf, 0xd4, 0xf3, 0xc8, 0xff, 0x39, 0x9a, 0x78, 0x88, 0x0b, 0x07, 0xd2, 0x51, 0xbc, 
+  0xc4, 0x39, 0x2e, 0x40, 0x8b, 0xca, 0xd1, 0x58, 0x4c, 0xd5, 0xb3, 0x88, 0xb1, 0x96, 0x26, 0x77, 
+  0x3e, 0x02, 0x54, 0x69, 0x72, 0xe7, 0xc3, 0xe5, 0xf4, 0xfe, 0x8d, 0x3f, 0x1c, 0x04, 0xfe, 0x87, 
+  0xe1, 0x87, 0xd5, 0xfd, 0xfa, 0xfd, 0x0f, 0x93, 0xe1, 0xe0, 0x03, 0x4d, 0xc6, 0x9d, 0xdd, 0x54, 
+  0x3d, 0x8d, 0x44, 0x2d, 0xe5, 0x7b, 0x1f, 0x3c, 0x80, 0x35, 0xd1, 0xff, 0x0d, 0x6f, 0x26, 0xff, 
+  0xfa, 0xe0, 0x4d, 0x83, 0xfb, 0x1f, 0xbc, 0x9b, 0x7b, 0xce, 0xbd, 0x7b, 0x74, 0xeb, 0xde, 0xcd, 
+  0x7f, 0x3a, 0x77, 0xfe, 0x93, 0xee, 0xfc, 0xe7, 0xcd, 0xee, 0x87, 0x0f, 0xf7, 0xf1, 0xee, 0x7f, 
+  0xdd, 0x9f, 0xde, 0xd0, 0xcf, 0x01, 0xfd, 0xd8, 0x45, 0x6d, 0xfa, 0xb9, 0x7b, 0xb3, 0xbb, 0x3b, 
+  0xbc, 0xff, 0x21, 0xbb, 0xd9, 0x75, 0x6a, 0xd1, 0xc3, 0xc1, 0xee, 0xe5, 0x7d, 0xbc, 0xe5, 0xc3, 
+  0x2a, 0x54, 0xbb, 0xd3, 0xc9, 0xbf, 0xd4, 0x07, 0xef, 0xde, 0x7f, 0x5e, 0x6f, 0xfc, 0x60, 0x37, 
+  0x9c, 0x7c, 0xf8, 0x30, 0x9d, 0xde, 0xe7, 0x67, 0xcd, 0xbb, 0x52, 0x63, 0x4a, 0x9f, 0x7e, 0x42, 
+  0x13, 0xf3, 0x38, 0xda, 0x9d, 0xd0, 0x57, 0x78, 0xf7, 0x1e, 0xec, 0xfc, 0x93, 0x3e, 0x6e, 0x6f, 
+  0xe7, 0xef, 0x1f, 0xef, 0x20, 0x57, 0x92, 0xba, 0x13, 0x5d, 0xa7, 0x08, 0x07, 0x17, 0x72, 0x40, 
+  0x3f, 0x64, 0xdd, 0x87, 0xfb, 0x1b, 0x75, 0xfd, 0x26, 0x0e, 0x27, 0x53, 0xf5, 0x39, 0x0e, 0xdf, 
+  0xc3, 0x6a, 0xf4, 0xcf, 0x19, 0xd1, 0x60, 0xb5, 0x6e, 0xc6, 0x04, 0x36, 0x21, 0x08, 0x2d, 0x2a, 
+  0x58, 0x7f, 0x5d, 0x25, 0x96, 0x21, 0xda, 0xf7, 0x33, 0x11, 0x72, 0xa2, 0x16, 0x1a, 0x4d, 0xd6, 
+  0x97, 0x7c, 0x46, 0x05, 0xe3, 0x72, 0x15, 0x89, 0x4e, 0x72, 0x7b, 0xf7, 0x6e, 0x1f, 0xc0, 0x8a, 
+  0xce, 0x1d, 0x4e, 0x11, 0x91, 0x5a, 0x33, 0xee, 0x88, 0x76, 0xca, 0x7b, 0xa8, 0xba, 0x18, 0xab, 
+  0x11, 0x88, 0x06, 0x10, 0x53, 0xac, 0x27, 0xef, 0xcf, 0x40, 0x6b, 0xb4, 0x1b, 0x12, 0x31, 0x7e, 
+  0x5a, 0x93, 0xf0, 0x8c, 0x2d, 0x56, 0xc5, 0x64, 0x7f, 0x3a, 0xf6, 0x44, 0x74, 0xf3, 0xbd, 0x01, 
+  0x2e, 0x07, 0x5e, 0x80, 0x1f, 0x3f, 0x4c, 0xc3, 0x4c, 0x6c, 0x46, 0xb1, 0x9c, 0xd4, 0xde, 0x3d, 
+  0x6f, 0xd0, 0xce, 0xcf, 0x8e, 0x57, 0x8f, 0xdf, 0x73, 0xc2, 0xb2, 0x60, 0xe0, 0xdd, 0xab, 0x46, 
+  0xe2, 0xe3, 0xd7, 0xe0, 0x9a, 0xd3, 0x11, 0x44, 0x1f, 0xbf, 0x6e, 0x88, 0xd5, 0x5e, 0xb1, 0x81, 
+  0xda, 0x6b, 0xdb, 0x57, 0x18, 0x46, 0xa8, 0x47, 0x45, 0x00, 0x2d, 0x63, 0x5e, 0x94, 0xa0, 0x2d, 
+  0x4e, 0xbe, 0x21, 0x22, 0x0a, 0x0d, 0x7a, 0x8c, 0x7f, 0x56, 0x3a, 0x80, 0x19, 0x88, 0xe4, 0xbc, 
+  0xaf, 0x1e, 0xcc, 0x31, 0x26, 0x79, 0xb1, 0x52, 0xeb, 0xa8, 0xe4, 0xa3, 0x91, 0xba, 0xf7, 0x9a, 
+  0xb1, 0xca, 0xe1, 0xc8, 0xdd, 0x02, 0x96, 0x1f, 0xb3, 0xf6, 0x2c, 0x4c, 0x5c, 0x9f, 0x86, 0xba, 
+  0x7e, 0x9f, 0xe8, 0x09, 0x51, 0x0a, 0x62, 0x35, 0x90, 0xe0, 0x4f, 0xab, 0xa1, 0xcc, 0x2e, 0x86, 
+  0xf8, 0x55, 0x69, 0x87, 0x52, 0xdf, 0xd3, 0x21, 0x32, 0x2c, 0xe1, 0x7e, 0xe4, 0x3d, 0x08, 0x94, 
+  0x00, 0x8f, 0xbe, 0x3c, 0xd6, 0x5a, 0x2b, 0xe5, 0x05, 0xf6, 0xf3, 0xec, 0x9d, 0x8d, 0x7a, 0xba, 
+  0xd8, 0x9e, 0xc5, 0xae, 0xa9, 0x23, 0xd5, 0xe9, 0x2f, 0xd1, 0xa7, 0x5a, 0x62, 0x2d, 0xe3, 0x42, 
+  0xb1, 0x51, 0x77, 0x9a, 0x07, 0x95, 0x88, 0x83, 0x1c, 0x0f, 0xca, 0xb9, 0x46, 0xfa, 0x88, 0x1c, 
+  0xe1, 0xc4, 0x35, 0x29, 0x0e, 0x5e, 0xe2, 0x38, 0x44, 0xd1, 0x4c, 0x32, 0x3c, 0x9d, 0x15, 0x89, 
+  0x64, 0x3f, 0xdd, 0xf2, 0x39, 0x01, 0x8b, 0x29, 0xd9, 0x54, 0xfe, 0x65, 0x70, 0x38, 0x4d, 0x85, 
+  0x92, 0x2f, 0x2c, 0xcc, 0xd1, 0x5b, 0xdf, 0x24, 0x28, 0xad, 0x81, 0xa2, 0xcf, 0xb7, 0x3f, 0x36, 
+  0x33, 0x24, 0x37, 0x40, 0xb0, 0xd2, 0x05, 0x52, 0x99, 0x0b, 0x5e, 0xc9, 0xf0, 0x4d, 0x7c, 0x4b, 
+  0x55, 0xf6, 0x98, 0x95, 0xa5, 0xfa, 0x1c, 0x3d, 0x93, 0x00, 0xb9, 0xf3, 0xe1, 0x3f, 0x67, 0xb7, 
+  0x55, 0x2a, 0x92, 0xd7, 0xb2, 0x6f, 0xf4, 0x6e, 0xd3, 0x6f, 0x5a, 0xdf, 0x56, 0xe9, 0x63, 0x79, 
+  0x99, 0xbf, 0x8f, 0xaf, 0xea, 0x35, 0x3e, 0x9b, 0xbe, 0x01, 0x5a, 0xff, 0xd1, 0xed, 0x5f, 0xbe, 
+  0xa5, 0x88, 0x4e, 0xc6, 0x67, 0x54, 0x22, 0x76, 0xed, 0x3e, 0xcb, 0x88, 0x39, 0xd5, 0x78, 0xd1, 
+  0xd2, 0xb5, 0xdf, 0x39, 0x8d, 0xad, 0x81, 0xdc, 0x82, 0x06, 0x4b, 0xe3, 0x6c, 0xd1, 0xb4, 0x59, 
+  0x5c, 0x9d, 0x43, 0xd1, 0x0d, 0x21, 0xe7, 0xc3, 0xaa, 0x24, 0xa6, 0x09, 0x0c, 0x92, 0x7a, 0x17, 
+  0xfd, 0x3e, 0xde, 0xfd, 0x97, 0xae, 0x48, 0xa4, 0xfb, 0x2c, 0x07, 0xe9, 0x5c, 0x0d, 0x7c, 0xa4, 
+  0x83, 0x7b, 0x3b, 0x1d, 0x10, 0xf7, 0x4c, 0x77, 0xa5, 0xb5, 0x3b, 0xbb, 0x21, 0x15, 0xdd, 0x56, 
+  0x86, 0x48, 0xe1, 0x2f, 0x8d, 0xc6, 0x3e, 0xec, 0x9e, 0xe5, 0xad, 0xda, 0xfa, 0x26, 0x15, 0xff, 
+  0x1a, 0x5d, 0xaf, 0x97, 0x70, 0x30, 0xcb, 0x97, 0x0c, 0x6d, 0xfa, 0x44, 0x07, 0x91, 0x31, 0xc5, 
+  0x49, 0x16, 0x8f, 0xb2, 0x85, 0xee, 0x32, 0x31, 0x36, 0xf4, 0xa9, 0xa7, 0xd1, 0x75, 0x12, 0xc3, 
+  0x1d, 0xac, 0x82, 0xb9, 0xea, 0xcc, 0xaf, 0x81, 0x1d, 0x3b, 0xce, 0x65, 0xdf, 0x3a, 0x90, 0x58, 
+  0x1b, 0xf5, 0x28, 0x6e, 0x3a, 0x88, 0x70, 0x59, 0x07, 0x7f, 0x76, 0x8f, 0x88, 0x00, 0xcb, 0x10, 
+  0xa7, 0x4e, 0x45, 0xd6, 0x95, 0xeb, 0xfd, 0x55, 0x1e, 0x64, 0x2c, 0x55, 0xd5, 0xb3, 0x60, 0x22, 
+  0xb9, 0xba, 0x40, 0x74, 0x59, 0xb0, 0xbb, 0xee, 0x5c, 0x90, 0xf2, 0xbe, 0x6b, 0xb4, 0xff, 0x28, 
+  0xf6, 0x13, 0x37, 0x35, 0x49, 0x4d, 0x77, 0xa6, 0x0c, 0xa2, 0x57, 0x03, 0x93, 0x2b, 0x73, 0xf1, 
+  0xb3, 0x1a, 0xa9, 0x1a, 0x05, 0xda, 0xcb, 0xf6, 0x62, 0x1d, 0xeb, 0xb8, 0xf1, 0x77, 0xf3, 0x56, 
+  0x0c, 0xba, 0xa4, 0x13, 0xda, 0xda, 0x94, 0xaa, 0xf5, 0x05, 0xa3, 0x58, 0xa5, 0xd0, 0x19, 0x77, 
+  0x14, 0x76, 0x72, 0x80, 0x86, 0x49, 0x13, 0x31, 0x49, 0xfd, 0xde, 0x86, 0x82, 0xce, 0xc6, 0xdf, 
+  0xee, 0x43, 0x56, 0xef, 0x43, 0xed, 0x72, 0xfc, 0xad, 0xd2, 0xcd, 0x5e, 0x84, 0x18, 0xf1, 0x77, 
+  0x73, 0x3d, 0x22, 0x55, 0x7f, 0xbb, 0xd7, 0x83, 0x26, 0x94, 0xb5, 0x51, 0x20, 0x4a, 0x88, 0x74, 
+  0xa7, 0xee, 0x5b, 0x04, 0x26, 0xa6, 0x76, 0x8f, 0xf5, 0x64, 0xce, 0x78, 0x10, 0xd1, 0x6f, 0x24, 
+  0x49, 0xad, 0xab, 0x03, 0x1e, 0xe7, 0xc4, 0x55, 0x41, 0x2d, 0xc5, 0x91, 0x8c, 0x09, 0x14, 0xb9, 
+  0xb2, 0xe2, 0x15, 0xc2, 0xac, 0xa1, 0x11, 0xe0, 0xaa, 0x3d, 0x5e, 0x8c, 0x70, 0xdf, 0x44, 0xaa, 
+  0x92, 0x4a, 0x3a, 0xac, 0xda, 0xdd, 0x28, 0x57, 0xf3, 0xda, 0xf5, 0x55, 0x6c, 0xdf, 0x89, 0xf9, 
+  0xfb, 0xea, 0xf3, 0xab, 0xfb, 0xe8, 0x7e, 0x59, 0xe5, 0x33, 0xd5, 0xf8, 0xb6, 0x14, 0x92, 0xa3, 
+  0xf6, 0xf2, 0x11, 0x69, 0xae, 0x54, 0x4f, 0x3a, 0xbf, 0xc9, 0xf9, 0x16, 0x06, 0xe8, 0x43, 0x90, 
+  0x65, 0x2c, 0xfa, 0x68, 0xa8, 0x3e, 0x88, 0xa2, 0x65, 0x8e, 0xbe, 0x9a, 0x3f, 0xb7, 0xf3, 0x23, 
+  0x59, 0x89, 0x5c, 0x89, 0xc3, 0x55, 0x77, 0x36, 0xea, 0xe7, 0x05, 0x89, 0x60, 0xea, 0xdd, 0xa2, 
+  0x1b, 0x34, 0xae, 0x5b, 0x85, 0xaf, 0xb9, 0x99, 0x77, 0x35, 0xd0, 0x38, 0xf5, 0xa6, 0xe5, 0x39, 
+  0xf6, 0x75, 0x62, 0x44, 0xb6, 0x69, 0x35, 0x18, 0x4e, 0x1a, 0x5c, 0x46, 0xf6, 0x5b, 0xe4, 0xd7, 
+  0x1a, 0x5a, 0xde, 0xc1, 0xe4, 0x33, 0x88, 0x52, 0x02, 0x6a, 0xc5, 0x48, 0x86, 0xa5, 0xbb, 0x00, 
+  0xa4, 0x52, 0x61, 0xb2, 0x29, 0x67, 0x15, 0xb6, 0x1f, 0x6b, 0xfb, 0x8d, 0x5f, 0x43, 0x8c, 0xcc, 
+  0xd0, 0x9c, 0x70, 0x76, 0x9c, 0x45, 0x69, 0x58, 0x44, 0x00, 0x2b, 0x97, 0x92, 0xda, 0x92, 0xc0, 
+  0xb7, 0x82, 0xcd, 0x25, 0xb5, 0x9a, 0xf8, 0x0d, 0x9b, 0x83, 0x4e, 0x40, 0x58, 0x30, 0x69, 0x83, 
+  0xf3, 0x93, 0x4b, 0x5b, 0x24, 0x88, 0x30, 0x73, 0x83, 0x08, 0x8b, 0xe6, 0x8e, 0x02, 0x06, 0x8b, 
+  0x2a, 0x9a, 0x1b, 0x09, 0x77, 0xe9, 0x38, 0x97, 0x57, 0x96, 0xf5, 0x66, 0x03, 0x2b, 0xb0, 0x7c, 
+  0x4e, 0x8b, 0x72, 0x1d, 0x2f, 0x0d, 0x3a, 0x33, 0x93, 0xee, 0xa0, 0xf3, 0xd1, 0x30, 0x5e, 0x2e, 
+  0xf3, 0xcb, 0x64, 0xe1, 0x9e, 0x9c, 0xa7, 0xc3, 0x24, 0xde, 0x52, 0x3a, 0x39, 0xbf, 0x28, 0xaf, 
+  0x0c, 0xd2, 0x31, 0x28, 0xe8, 0x96, 0x72, 0xf2, 0x25, 0x0f, 0x8e, 0x75, 0xf6, 0x8d, 0xd3, 0xe1, 
+  0xef, 0xb3, 0x2d, 0x25, 0xc1, 0x26, 0xeb, 0x9c, 0x14, 0xa0, 0x0f, 0x5b, 0x4a, 0x91, 0x9c, 0x67, 
+  0xb2, 0x2c, 0x60, 0x18, 0x0a, 0xd1, 0x98, 0x20, 0x41, 0x18, 0x63, 0x3b, 0xc5, 0x2d, 0xd0, 0xa4, 
+  0xf3, 0x05, 0x60, 0xe6, 0x5d, 0xa7, 0x61, 0x14, 0xab, 0x94, 0x67, 0xea, 0x1a, 0xcb, 0xe5, 0x69, 
+  0x6c, 0x99, 0x8c, 0x2e, 0x9d, 0x8b, 0x93, 0xa2, 0x90, 0xb5, 0x06, 0xbd, 0xfd, 0xb0, 0x0e, 0x39, 
+  0x51, 0xd3, 0x87, 0xf8, 0x1e, 0x52, 0x90, 0xed, 0x48, 0x1a, 0x44, 0xd1, 0xe6, 0xb3, 0xb9, 0x43, 
+  0x2b, 0xc6, 0x81, 0x8e, 0xfd, 0x38, 0x2f, 0xe4, 0xb8, 0x0a, 0x58, 0x0a, 0xef, 0xfd, 0x2d, 0xb4, 
+  0x4c, 0xed, 0xe9, 0xf0, 0x67, 0x4e, 0x11, 0x53, 0x57, 0x6d, 0xb0, 0x8f, 0x55, 0x25, 0x78, 0xac, 
+  0x3a, 0xd5, 0x7b, 0xbe, 0x8e, 0xd1, 0x73, 0xca, 0x69, 0x80, 0x50, 0x56, 0xa0, 0x8a, 0xee, 0x8d, 
+  0x79, 0xb1, 0xc6, 0x63, 0x60, 0xe9, 0x24, 0x62, 0x0d, 0xa8, 0xb8, 0xeb, 0x74, 0xb8, 0x9a, 0xc3, 
+  0x3f, 0x95, 0x9e, 0xb1, 0x03, 0x69, 0xd5, 0xaa, 0xe5, 0x7e, 0xfe, 0x1f, 0xf4, 0x42, 0x5d, 0xd7, 
+  0x85, 0x03, 0x51, 0x11, 0x6f, 0xef, 0xd9, 0x5e, 0xad, 0x67, 0xab, 0x26, 0x2e, 0xcb, 0xf7, 0xcc, 
+  0xe1, 0x2d, 0xb3, 0xd7, 0x31, 0x3b, 0xef, 0x3a, 0x66, 0x47, 0x48, 0x23, 0x80, 0x31, 0x5a, 0x5f, 
+  0xd5, 0xc8, 0x0f, 0x48, 0x1b, 0xd9, 0x7a, 0xe4, 0xc1, 0xf4, 0xa6, 0xd7, 0x28, 0x87, 0xa5, 0x88, 
+  0x00, 0x59, 0xff, 0x7c, 0xa8, 0x4c, 0x98, 0x82, 0xf4, 0xfd, 0x34, 0xca, 0x91, 0x36, 0x49, 0x86, 
+  0x19, 0x42, 0x93, 0x07, 0x62, 0xee, 0xdf, 0x99, 0x0b, 0xa8, 0x44, 0x70, 0x2d, 0x97, 0xe8, 0x3d, 
+  0x4b, 0x59, 0x9a, 0xfe, 0x92, 0x40, 0x23, 0xac, 0x29, 0x75, 0xa0, 0x20, 0x81, 0x86, 0x68, 0x83, 
+  0x37, 0x5a, 0x45, 0xf5, 0xec, 0x5b, 0xa6, 0x11, 0x92, 0x70, 0xee, 0xe8, 0x64, 0x92, 0x9e, 0x5a, 
+  0xc3, 0x60, 0x85, 0x77, 0x46, 0x36, 0xd0, 0x82, 0x01, 0xf1, 0x5a, 0x69, 0x65, 0x91, 0xec, 0x6e, 
+  0xb5, 0x8a, 0x4f, 0x92, 0xc8, 0x7b, 0x97, 0x09, 0x4e, 0x49, 0xde, 0xe3, 0xb1, 0xe8, 0x69, 0xa1, 
+  0x61, 0x35, 0xfc, 0x90, 0x99, 0x71, 0x11, 0x93, 0x4e, 0x28, 0xd2, 0xe3, 0x87, 0xec, 0x85, 0x54, 
+  0x15, 0xcb, 0xa8, 0x6e, 0x07, 0x09, 0x69, 0x37, 0xb2, 0xa1, 0x87, 0xc6, 0x27, 0xc5, 0xa0, 0x75, 
+  0xc5, 0x42, 0x18, 0x8c, 0xbc, 0x58, 0xe4, 0x9f, 0xd3, 0x85, 0x10, 0x97, 0x93, 0xb8, 0x06, 0x94, 
+  0xe9, 0x06, 0x4f, 0x99, 0x83, 0x43, 0x2b, 0xa5, 0x8d, 0xf6, 0x73, 0xc6, 0x02, 0xd2, 0xf0, 0x05, 
+  0x5c, 0x7b, 0x69, 0x81, 0xbc, 0xd0, 0x51, 0x62, 0xc3, 0xb7, 0x70, 0xba, 0x6c, 0xe4, 0x23, 0xb0, 
+  0x40, 0x71, 0x58, 0x46, 0x06, 0x2a, 0xee, 0x8b, 0x85, 0x8a, 0x4b, 0x67, 0xd6, 0xf1, 0xe3, 0x88, 
+  0xa1, 0xe2, 0x86, 0x2f, 0x24, 0xde, 0x41, 0xc3, 0xa3, 0x15, 0x81, 0x82, 0x0b, 0xee, 0xf0, 0x05, 
+  0x2b, 0x98, 0x5f, 0x50, 0xf9, 0xba, 0x66, 0xfd, 0xd7, 0x19, 0x32, 0x6f, 0xd4, 0x33, 0x33, 0x6c, 
+  0x4d, 0x8a, 0x42, 0xc3, 0x63, 0x4b, 0x5e, 0xb8, 0xbe, 0xf4, 0xbe, 0xd3, 0x04, 0x80, 0xc8, 0xdc, 
+  0x2c, 0xc7, 0x4f, 0x63, 0x86, 0xe7, 0xf8, 0x15, 0xd6, 0xec, 0xce, 0x48, 0xbb, 0x8e, 0xe4, 0x2b, 
+  0x3e, 0x32, 0x83, 0x00, 0xb4, 0x71, 0x4b, 0x4e, 0xa7, 0xd8, 0x6f, 0x6e, 0xf5, 0x0a, 0xf8, 0x4d, 
+  0x89, 0xd5, 0xa6, 0xb2, 0x3a, 0xd7, 0x2d, 0x11, 0xb5, 0x64, 0x90, 0xa5, 0x9c, 0x92, 0x55, 0x06, 
+  0x95, 0xda, 0xd4, 0x33, 0x82, 0x6e, 0xa5, 0x46, 0x61, 0x3c, 0x74, 0x31, 0x7a, 0x72, 0x0e, 0x07, 
+  0x3a, 0xdf, 0x47, 0x81, 0x34, 0x59, 0x4f, 0x1d, 0xa9, 0x74, 0x74, 0x65, 0x8a, 0xc4, 0xe9, 0x1d, 
+  0xef, 0xdc, 0x7c, 0xa3, 0xfa, 0x5a, 0x52, 0xd7, 0x7e, 0x1c, 0x7e, 0x1a, 0x3e, 0x89, 0x19, 0xaa, 
+  0xe4, 0xd3, 0xf0, 0xc8, 0xb5, 0xdf, 0xd6, 0xf2, 0x8c, 0xc0, 0xeb, 0xa0, 0xc6, 0x7f, 0x8c, 0x38, 
+  0x65, 0xf1, 0xe9, 0xf0, 0x0d, 0x03, 0xa2, 0xf8, 0x05, 0xd6, 0x83, 0xf3, 0x55, 0xc3, 0xc6, 0xc1, 
+  0x23, 0x18, 0xdc, 0x44, 0x3d, 0xe7, 0x60, 0xa2, 0x19, 0x08, 0x35, 0x30, 0x42, 0xb7, 0x06, 0x8e, 
+  0xa1, 0x63, 0xc3, 0x41, 0xa9, 0xe5, 0x15, 0xd5, 0x3f, 0xd6, 0xec, 0x51, 0x19, 0x90, 0x98, 0xbf, 
+  0xe2, 0x7c, 0x0f, 0x55, 0x0f, 0xe7, 0xf4, 0xed, 0xb6, 0x8f, 0xb9, 0x32, 0x59, 0x43, 0x8e, 0x66, 
+  0x74, 0x7f, 0xa6, 0x90, 0x00, 0x05, 0x6a, 0xa5, 0x13, 0x66, 0xa2, 0xfa, 0x9a, 0x43, 0xed, 0x04, 
+  0xc0, 0x86, 0x5d, 0x96, 0x6d, 0xca, 0x76, 0x47, 0x5b, 0x00, 0xfe, 0x1e, 0x10, 0x39, 0x57, 0x0c, 
+  0x4f, 0x89, 0x9c, 0xb4, 0x74, 0xba, 0x99, 0x7c, 0xb4, 0x43, 0x86, 0x26, 0x38, 0x59, 0x00, 0x60, 
+  0x0c, 0x2d, 0x03, 0x8e, 0x7e, 0xa8, 0x29, 0x4d, 0x04, 0x55, 0xb6, 0x1b, 0x02, 0xec, 0x20, 0x70, 
+  0x23, 0x15, 0x9d, 0xf5, 0xf7, 0x8c, 0x1b, 0x6b, 0x61, 0x15, 0xc5, 0xc3, 0x8e, 0xa3, 0xe8, 0xe6, 
+  0xe6, 0x94, 0x48, 0x22, 0x10, 0x4b, 0x5b, 0xcb, 0xd8, 0xa7, 0xf6, 0xc6, 0xec, 0xbb, 0x15, 0x84, 
+  0x2b, 0x9d, 0x1e, 0x48, 0xa5, 0x02, 0xd2, 0x4f, 0xc2, 0xda, 0x67, 0x40, 0x8f, 0xd1, 0xbf, 0x8c, 
+  0x6f, 0x73, 0xc2, 0x17, 0x27, 0x53, 0xd8, 0x75, 0xf2, 0x8d, 0x4c, 0xc3, 0xf5, 0x32, 0x4c, 0x37, 
+  0xc1, 0x28, 0x47, 0x70, 0x1f, 0xc2, 0x79, 0xe8, 0x33, 0xd6, 0x1a, 0x27, 0x91, 0x33, 0xd1, 0xa9, 
+  0x65, 0x54, 0x3a, 0x46, 0xf8, 0xe3, 0x0e, 0x4f, 0x64, 0xbd, 0xff, 0xd6, 0xe3, 0xb5, 0x1f, 0x84, 
+  0xb9, 0xba, 0x00, 0x36, 0x40, 0xb4, 0xee, 0x02, 0x24, 0x68, 0xd7, 0xbd, 0xf0, 0xa9, 0x92, 0x64, 
+  0xaa, 0xe8, 0x92, 0xb1, 0x73, 0x40, 0x61, 0x8f, 0x8e, 0x31, 0x26, 0xd1, 0x96, 0xc7, 0x77, 0xef, 
+  0x5e, 0xf8, 0x0b, 0x36, 0x67, 0xa9, 0x63, 0xf8, 0x76, 0x74, 0x95, 0xe3, 0xb8, 0x95, 0x7c, 0x23, 
+  0x6b, 0x9c, 0x7f, 0x63, 0xf1, 0x7e, 0x72, 0xcc, 0x64, 0xa9, 0x3c, 0x53, 0x2d, 0x7f, 0x50, 0x7f, 
+  0x4f, 0xe5, 0x13, 0x7e, 0x36, 0x0d, 0x6a, 0xfe, 0x09, 0x65, 0x53, 0x7a, 0x4f, 0x81, 0x1f, 0x6c, 
+  0x74, 0x70, 0x09, 0xef, 0xa8, 0x87, 0x48, 0x92, 0xb7, 0x37, 0x0d, 0xb4, 0x6a, 0xea, 0xd3, 0x30, 
+  0x8f, 0xf5, 0xdb, 0xfd, 0x65, 0x84, 0xeb, 0x9f, 0xb1, 0x56, 0x4b, 0x79, 0xd6, 0xec, 0x4c, 0x1e, 
+  0xdf, 0xd2, 0x9b, 0x3c, 0xe6, 0xee, 0x24, 0xb2, 0x09, 0x9d, 0x8d, 0x0f, 0xd0, 0x06, 0x6a, 0x01, 
+  0x3e, 0x0e, 0xb4, 0x23, 0x2a, 0x7b, 0x62, 0x2d, 0x4a, 0xf6, 0x7a, 0xc3, 0x6a, 0xcb, 0x7a, 0x00, 
+  0x55, 0xe5, 0x5a, 0xd2, 0x2b, 0xb5, 0x74, 0xd2, 0xc7, 0x00, 0x57, 0x54, 0xad, 0x53, 0x37, 0x9c, 
+  0x31, 0xcd, 0x8f, 0xc1, 0x04, 0xc3, 0xa1, 0xc2, 0x12, 0x7e, 0xad, 0xc1, 0x94, 0x27, 0xaa, 0x29, 
+  0x29, 0x72, 0xbb, 0xf4, 0xc3, 0x89, 0xa7, 0x8a, 0x55, 0x13, 0x9e, 0x45, 0x3b, 0x1e, 0x91, 0xec, 
+  0x46, 0xfb, 0x32, 0x11, 0x31, 0x35, 0x07, 0x27, 0x0f, 0x89, 0xce, 0x6c, 0xd5, 0x0a, 0x57, 0x96, 
+  0x9e, 0x5f, 0xf5, 0x4e, 0xe3, 0xcf, 0x88, 0xef, 0x9c, 0x5f, 0x21, 0x1f, 0x73, 0x05, 0x20, 0x76, 
+  0x85, 0x23, 0xd8, 0xea, 0x3e, 0x7b, 0x5e, 0x40, 0x93, 0xe5, 0x4b, 0xb2, 0x2b, 0xa3, 0x38, 0xdd, 
+  0xd9, 0x81, 0x2b, 0xb4, 0x40, 0xa2, 0xc3, 0xff, 0x2f, 0x51, 0xcf, 0xe7, 0x61, 0x86, 0x71, 0xc4, 
+  0x28, 0x60, 0x9b, 0xc3, 0xc9, 0x65, 0xe3, 0xe7, 0x5d, 0xde, 0xd7, 0x95, 0xf0, 0xf6, 0x7c, 0xce, 
+  0x29, 0xa6, 0xd9, 0x0c, 0x4b, 0xbf, 0xd7, 0x1c, 0x8d, 0xc7, 0xc9, 0x5c, 0xa9, 0xd1, 0x91, 0x80, 
+  0xb4, 0x47, 0xa9, 0xe3, 0x09, 0xd6, 0x17, 0x59, 0x04, 0x49, 0x01, 0x5a, 0xe0, 0x34, 0xfa, 0x23, 
+  0x7b, 0xf7, 0xbc, 0x41, 0x31, 0xf0, 0xee, 0x19, 0x62, 0x35, 0x4b, 0x7a, 0x6b, 0xc6, 0xaa, 0x01, 
+  0x22, 0xbd, 0x96, 0x22, 0x0c, 0x5d, 0x5a, 0x69, 0xc8, 0xf9, 0x0e, 0x07, 0x05, 0x06, 0x55, 0xc7, 
+  0x21, 0xd9, 0xf6, 0x7a, 0xa6, 0x35, 0x87, 0xfc, 0x1a, 0xea, 0x58, 0x2d, 0x87, 0xcc, 0x65, 0xa9, 
+  0xa5, 0x2c, 0x76, 0x4e, 0x71, 0x4d, 0x54, 0xad, 0xc8, 0x97, 0xab, 0x8a, 0x3c, 0x1b, 0xb2, 0xce, 
+  0x73, 0x38, 0xef, 0xb7, 0x21, 0xf4, 0x5f, 0x18, 0xfa, 0x69, 0x29, 0xaa, 0xef, 0x0d, 0xe6, 0x03, 
+  0xaf, 0x47, 0x0b, 0xa7, 0xc7, 0x1f, 0x13, 0xf4, 0xe2, 0x82, 0xe6, 0xac, 0xb8, 0x62, 0x3f, 0x19, 
+  0xf6, 0x3f, 0xc0, 0x4b, 0x68, 0xca, 0xcc, 0x4b, 0xaa, 0xba, 0x3a, 0x9e, 0xb4, 0x46, 0x7e, 0x7b, 
+  0x0e, 0xf1, 0xd6, 0xb3, 0xef, 0xb0, 0x64, 0xd4, 0x22, 0xad, 0xd6, 0x53, 0x06, 0x25, 0xee, 0x24, 
+  0xdd, 0xf3, 0xa8, 0xc0, 0x7c, 0x76, 0x63, 0x0e, 0x36, 0x28, 0x6d, 0xd6, 0x35, 0x3a, 0x35, 0xfa, 
+  0xb9, 0x9d, 0x69, 0xbc, 0xe7, 0x30, 0x8d, 0x72, 0xc2, 0xdb, 0x49, 0xf5, 0xee, 0x61, 0x1c, 0xb0, 
+  0x30, 0x73, 0x9a, 0xfc, 0xc1, 0x3d, 0x97, 0x5f, 0xbc, 0x57, 0xe7, 0x17, 0x8d, 0x7f, 0xe2, 0xf5, 
+  0xea, 0x14, 0xb9, 0x09, 0x30, 0xfc, 0xce, 0x59, 0x19, 0xd2, 0xb1, 0xca, 0x76, 0x45, 0x75, 0xdb, 
+  0x89, 0x1a, 0xd2, 0x87, 0x2d, 0x1d, 0xde, 0x6a, 0x59, 0x63, 0x76, 0x30, 0xd1, 0xae, 0x8b, 0xf4, 
+  0xc7, 0xe1, 0x71, 0x3c, 0x4e, 0x42, 0xe1, 0x4b, 0x8f, 0xc1, 0xe4, 0x5d, 0xf1, 0xff, 0xb4, 0xe9, 
+  0xe3, 0xb3, 0x13, 0xc2, 0xed, 0x02, 0x05, 0x02, 0x8d, 0xc0, 0x3e, 0x41, 0x53, 0xab, 0x32, 0x2f, 
+  0xf4, 0x6a, 0x79, 0x96, 0x1d, 0xe7, 0x54, 0xe0, 0xa4, 0x2a, 0x80, 0xa1, 0x74, 0x60, 0xe2, 0x10, 
+  0x06, 0x7e, 0x8c, 0xdc, 0x71, 0x72, 0xd2, 0x5c, 0x0b, 0xb6, 0x22, 0x14, 0xb7, 0x26, 0x7b, 0xb0, 
+  0xfc, 0x3e, 0xbf, 0x00, 0x26, 0x1c, 0xe7, 0xa5, 0xea, 0x20, 0x4a, 0xdd, 0x7e, 0x4d, 0xc7, 0x7c, 
+  0x92, 0xa0, 0xe1, 0x73, 0xbc, 0x01, 0xdf, 0xe4, 0xfa, 0xa5, 0xb0, 0x65, 0xa2, 0x66, 0x24, 0xcb, 
+  0xed, 0xe6, 0x58, 0x8e, 0x81, 0x86, 0x3a, 0xb7, 0x99, 0x9e, 0x1d, 0xa5, 0x91, 0x98, 0xd1, 0xb5, 
+  0xec, 0xbd, 0x22, 0x2e, 0x5a, 0x2d, 0x38, 0x44, 0x92, 0x28, 0xe1, 0x6a, 0xb2, 0x98, 0x46, 0x19, 
+  0xfd, 0x83, 0x7c, 0x2c, 0xab, 0xe1, 0x1d, 0xd1, 0x40, 0xb2, 0x07, 0x35, 0x5d, 0x15, 0x79, 0x4e, 
+  0x5c, 0x02, 0xfd, 0x3a, 0xcb, 0xa3, 0x8f, 0xc8, 0x3b, 0xf5, 0x79, 0x1a, 0xc5, 0x6a, 0x3d, 0x2e, 
+  0xa3, 0x95, 0xac, 0x30, 0xae, 0x53, 0xc4, 0x97, 0xb0, 0x81, 0x13, 0xfb, 0xa5, 0xef, 0x82, 0xb1, 
+  0x28, 0xb8, 0xf1, 0x62, 0x8a, 0xdf, 0x29, 0xac, 0x3d, 0x2b, 0x86, 0xf1, 0x66, 0x0e, 0x9c, 0xcf, 
+  0xfb, 0x3e, 0xd0, 0xf6, 0xa8, 0xfb, 0x88, 0x3a, 0xc5, 0x9d, 0x40, 0x1e, 0x10, 0x0b, 0x70, 0xcc, 
+  0x55, 0x4f, 0xa6, 0xd1, 0x71, 0x60, 0x5a, 0xdc, 0x18, 0xf7, 0x69, 0xe6, 0x6a, 0xd7, 0x11, 0x30, 
+  0x83, 0xce, 0xd5, 0x9c, 0xce, 0xef, 0xab, 0x84, 0x48, 0xe0, 0xb2, 0x2b, 0xe6, 0x79, 0xce, 0xef, 
+  0x78, 0x89, 0x64, 0xab, 0xc7, 0x6c, 0x5a, 0x1e, 0xd6, 0x27, 0x72, 0xc4, 0xf7, 0x92, 0x2f, 0xc0, 
+  0xf6, 0x76, 0x9d, 0xaa, 0xc6, 0x39, 0x70, 0x33, 0xfc, 0x58, 0x5c, 0x58, 0xf2, 0x20, 0x60, 0x5c, 
+  0xa3, 0x98, 0xf9, 0x8e, 0x71, 0xdc, 0x86, 0xca, 0x66, 0xbd, 0x27, 0x0f, 0x0d, 0xa3, 0x48, 0x60, 
+  0xce, 0x1c, 0x3f, 0x4e, 0x6d, 0x6c, 0xc0, 0xa9, 0xa7, 0xd7, 0x7b, 0xe4, 0x42, 0xc1, 0x2b, 0x8b, 
+  0x60, 0x4e, 0x4b, 0x3b, 0xeb, 0xc2, 0x41, 0xc9, 0x84, 0x23, 0x25, 0xb1, 0x29, 0x0b, 0x86, 0xf1, 
+  0x8a, 0x69, 0xb4, 0xc1, 0xf8, 0xcc, 0x38, 0x92, 0x0d, 0x6c, 0xac, 0xfb, 0x02, 0x73, 0x88, 0x76, 
+  0xd3, 0xd6, 0xbe, 0x20, 0x31, 0xd9, 0xc5, 0x61, 0xb6, 0xce, 0xb9, 0xc4, 0x7f, 0x0a, 0x2a, 0x86, 
+  0xbb, 0x36, 0x01, 0x13, 0x81, 0x1c, 0x61, 0x70, 0x4b, 0x4a, 0xc7, 0x25, 0x62, 0xb6, 0xe0, 0x1e, 
+  0xb6, 0x69, 0x36, 0x50, 0xea, 0x06, 0x54, 0x13, 0x5c, 0x5c, 0x2f, 0x2a, 0xf3, 0xf9, 0xd0, 0x91, 
+  0xeb, 0x5b, 0xc4, 0xa9, 0x0b, 0xa1, 0x4a, 0xaa, 0x95, 0xe7, 0x97, 0xf6, 0x37, 0x03, 0x87, 0x54, 
+  0xd0, 0xbb, 0x55, 0xa1, 0xa1, 0x86, 0xc2, 0xf0, 0xed, 0x2d, 0x5e, 0x70, 0x05, 0x5b, 0x1a, 0x3a, 
+  0x26, 0x41, 0xc6, 0xcb, 0x1d, 0x78, 0x07, 0xb1, 0xf4, 0x5b, 0x03, 0xe0, 0xec, 0x9d, 0xa4, 0x8b, 
+  0x12, 0x97, 0x63, 0xc1, 0x48, 0x92, 0x57, 0xf3, 0xe6, 0x9d, 0x55, 0x49, 0xeb, 0xe0, 0xbf, 0x6c, 
+  0xfb, 0xf1, 0x76, 0xde, 0x52, 0x8e, 0xfd, 0x6a, 0x82, 0x84, 0x7f, 0x9d, 0x41, 0x30, 0xb5, 0x3f, 
+  0x87, 0x85, 0x88, 0x70, 0x7c, 0x04, 0x23, 0x6b, 0xb8, 0xd3, 0x4c, 0x51, 0xf7, 0x8a, 0xd4, 0xf8, 
+  0xd8, 0x5a, 0x06, 0x46, 0x3c, 0x5e, 0x5f, 0xff, 0xae, 0xe3, 0x8d, 0x1d, 0xe9, 0xbf, 0x3f, 0x73, 
+  0x7c, 0xb0, 0xdb, 0xe0, 0xcf, 0xed, 0x7e, 0x1d, 0xd9, 0x00, 0xa5, 0x2f, 0x73, 0x74, 0xac, 0xd5, 
+  0xa4, 0x6f, 0x1f, 0x1a, 0x0c, 0x76, 0x17, 0x0c, 0x1d, 0xbd, 0x56, 0x85, 0xb0, 0x8c, 0x4f, 0x62, 
+  0xe7, 0x9e, 0xb0, 0x85, 0x5a, 0xe2, 0x16, 0x21, 0x1f, 0xf7, 0xa2, 0xeb, 0xa3, 0xd0, 0x9b, 0x6b, 
+  0x7d, 0x22, 0xb6, 0x16, 0x5c, 0x76, 0x3c, 0x95, 0xc7, 0xa1, 0x57, 0x1d, 0xb5, 0xab, 0xea, 0xc1, 
+  0x36, 0xc0, 0x71, 0x28, 0x77, 0xac, 0xd2, 0xdb, 0x4a, 0x5a, 0x89, 0x48, 0x5a, 0xc1, 0xf0, 0x71, 
+  0xcc, 0x71, 0x74, 0x8f, 0x63, 0xeb, 0x25, 0x8d, 0x10, 0xbd, 0xd8, 0xe1, 0x6a, 0xb1, 0x23, 0x31, 
+  0x95, 0x4f, 0xe2, 0xad, 0xee, 0x7b, 0x95, 0xea, 0x82, 0x25, 0x66, 0x89, 0xfc, 0x8a, 0xa1, 0x59, 
+  0x78, 0x1c, 0x77, 0x42, 0xf3, 0x30, 0x82, 0x7f, 0x24, 0xa2, 0x6b, 0xc0, 0xb8, 0x47, 0x2f, 0x02, 
+  0x28, 0x20, 0x30, 0x11, 0x56, 0xdf, 0x4d, 0x37, 0xb4, 0xd7, 0x8d, 0xd3, 0xda, 0x7b, 0x28, 0x0c, 
+  0x78, 0xc0, 0xea, 0x8c, 0x4b, 0xc7, 0x98, 0xf4, 0x12, 0xe4, 0xb3, 0x6d, 0x24, 0x2c, 0x38, 0x46, 
+  0xf8, 0x80, 0xe5, 0x4f, 0x24, 0x1c, 0xb3, 0x87, 0x79, 0x80, 0x15, 0xfd, 0xe7, 0xd9, 0x2d, 0x9f, 
+  0x58, 0x8d, 0x5a, 0x95, 0xfa, 0xea, 0x05, 0x4b, 0x8f, 0x2f, 0x78, 0xec, 0x74, 0x5e, 0x06, 0x3e, 
+  0x39, 0xf8, 0x4f, 0x04, 0x27, 0xc6, 0xb0, 0x34, 0x5b, 0xa5, 0xe6, 0xd1, 0xc7, 0x87, 0xcc, 0x46, 
+  0x80, 0xc0, 0xde, 0x76, 0xb9, 0xf4, 0x76, 0x2b, 0x85, 0xb4, 0x9c, 0x8a, 0x5a, 0xc9, 0x6c, 0x9b, 
+  0x7f, 0xe6, 0x7e, 0x54, 0x0f, 0x59, 0xd0, 0xe2, 0x3e, 0xed, 0x02, 0x71, 0xd5, 0x5c, 0xc2, 0x8c, 
+  0x80, 0x26, 0xce, 0x16, 0xdb, 0x9a, 0xc8, 0x22, 0x14, 0xe2, 0xb7, 0x34, 0xc0, 0x9f, 0xab, 0x42, 
+  0x9d, 0x9e, 0xb4, 0xb1, 0x71, 0x28, 0x14, 0xa5, 0x15, 0xbc, 0x45, 0x42, 0x2d, 0x67, 0x26, 0x08, 
+  0x52, 0x62, 0x0a, 0x0f, 0xd0, 0x2a, 0xee, 0xc0, 0xeb, 0x66, 0xc2, 0x3b, 0x48, 0x15, 0xa5, 0xd3, 
+  0xf5, 0xbf, 0xd5, 0xae, 0x6f, 0x6e, 0x56, 0xfe, 0x92, 0x95, 0x53, 0x5c, 0x7b, 0xdd, 0xc6, 0x26, 
+  0xc2, 0xb1, 0x81, 0x8c, 0x8b, 0x97, 0xc9, 0xf0, 0xd3, 0x6f, 0xeb, 0xa4, 0xb8, 0xa2, 0xa5, 0x78, 
+  0x94, 0x44, 0xf6, 0x32, 0x50, 0x4d, 0xf7, 0xdb, 0x83, 0x1f, 0xa4, 0x96, 0xcf, 0x09, 0x66, 0x90, 
+  0x7a, 0xad, 0xb1, 0xb0, 0xce, 0xb4, 0xdf, 0xba, 0x55, 0x72, 0x13, 0xc7, 0x4b, 0xac, 0x5c, 0xcf, 
+  0x86, 0x56, 0x98, 0x8c, 0x30, 0x5c, 0x79, 0x44, 0x82, 0x8c, 0x18, 0xe6, 0xcc, 0x6d, 0x49, 0x2d, 
+  0xc5, 0x7e, 0xe7, 0x8b, 0xb1, 0xf1, 0x11, 0xe7, 0x68, 0x8d, 0x9b, 0x9b, 0xdb, 0x3f, 0xf7, 0x5b, 
+  0xfd, 0x10, 0xd3, 0x9f, 0xc5, 0xa7, 0xe9, 0x09, 0x8f, 0x09, 0x21, 0xe3, 0x2a, 0x5f, 0x13, 0xab, 
+  0x97, 0xd2, 0xa2, 0x3c, 0xa7, 0xb6, 0x96, 0xa3, 0xde, 0x2a, 0xa1, 0x95, 0xb3, 0xe8, 0x2c, 0x1b, 
+  0xf7, 0x1e, 0xbe, 0x7a, 0xa1, 0x77, 0xc0, 0x68, 0x8d, 0xf1, 0x05, 0x3b, 0x24, 0x23, 0x7c, 0xd8, 
+  0xe5, 0xa6, 0xde, 0x4f, 0xa4, 0xe3, 0x49, 0xa3, 0xe3, 0xd5, 0x35, 0x58, 0x10, 0x2c, 0x6b, 0x5f, 
+  0x0e, 0x9e, 0x87, 0xf3, 0x6d, 0xeb, 0xfb, 0x90, 0xe1, 0xa5, 0xc7, 0x89, 0x66, 0x9d, 0xae, 0x92, 
+  0x4d, 0x4d, 0x8f, 0xaa, 0x19, 0x43, 0x36, 0xfb, 0x1c, 0x07, 0xb5, 0x47, 0x36, 0x55, 0xf5, 0xa7, 
+  0x8e, 0xfb, 0x43, 0x07, 0x1a, 0xbc, 0x26, 0xa1, 0x77, 0x96, 0x25, 0x06, 0xb5, 0x7c, 0xad, 0xd1, 
+  0x5f, 0x1f, 0xc0, 0xa5, 0x5f, 0x27, 0x9f, 0xd6, 0x03, 0x2d, 0x4d, 0xfc, 0x6c, 0x2c, 0x44, 0xb5, 
+  0x39, 0x60, 0xdf, 0xb8, 0x79, 0xd7, 0x93, 0xa3, 0xbc, 0x91, 0xb9, 0xe9, 0x75, 0xdc, 0x51, 0xcc, 
+  0x2a, 0x8a, 0x8e, 0x72, 0x63, 0xb6, 0x4a, 0x66, 0xdd, 0xcd, 0x99, 0xe7, 0x67, 0x95, 0xc3, 0xbd, 
+  0x91, 0x15, 0x3c, 0x9e, 0x29, 0xe3, 0xd8, 0x4f, 0x03, 0xa9, 0xef, 0x3d, 0x9c, 0x03, 0x4a, 0x4c, 
+  0xfd, 0x09, 0xb5, 0xc1, 0xaf, 0xf8, 0xe7, 0xe3, 0x30, 0x8d, 0xb6, 0x26, 0x76, 0xfe, 0xae, 0x78, 
+  0x9b, 0x5f, 0x69, 0xef, 0x8e, 0x7f, 0x85, 0x7b, 0xd6, 0x1f, 0xa3, 0x6c, 0x4c, 0x04, 0x79, 0x31, 
+  0x6e, 0x49, 0xa6, 0xc0, 0x38, 0xab, 0x82, 0x57, 0x10, 0x0c, 0xd3, 0x11, 0x8f, 0xd2, 0x2e, 0xb4, 
+  0x4a, 0xb4, 0xf5, 0xfd, 0x41, 0xdd, 0xd8, 0xaa, 0x7d, 0x55, 0xf1, 0x52, 0x12, 0xdd, 0xe6, 0xe1, 
+  0x9a, 0x17, 0x89, 0x8d, 0x45, 0x91, 0x74, 0xc2, 0x3a, 0x00, 0x81, 0x4d, 0x59, 0x3c, 0xdc, 0x69, 
+  0xd0, 0xbc, 0x0b, 0x42, 0xca, 0x4f, 0xf0, 0xa3, 0xfd, 0x94, 0xe1, 0x33, 0x0e, 0x63, 0xf8, 0x95, 
+  0x3c, 0xb4, 0xfd, 0x92, 0xf2, 0x0f, 0xe6, 0xdd, 0x2a, 0xfc, 0x74, 0xbb, 0x03, 0xb4, 0xce, 0x4c, 
+  0x15, 0x3a, 0x8a, 0x1a, 0xa4, 0x4d, 0x64, 0x7b, 0xb3, 0xd8, 0x6f, 0x3c, 0x23, 0x1a, 0xb5, 0x0b, 
+  0x89, 0x6b, 0x98, 0x29, 0x25, 0x42, 0x93, 0x17, 0x42, 0x97, 0xe7, 0xeb, 0x13, 0x80, 0xb8, 0xbb, 
+  0xc0, 0x75, 0x38, 0x8b, 0xab, 0x07, 0x5d, 0x39, 0x1d, 0xab, 0x32, 0xce, 0xb3, 0x4e, 0xad, 0x3e, 
+  0x11, 0x4a, 0x93, 0x10, 0xd1, 0xa4, 0x34, 0x1c, 0xd7, 0xc4, 0xcb, 0xe6, 0xd3, 0x90, 0x13, 0x86, 
+  0xd6, 0x0e, 0x9c, 0x86, 0x2a, 0x1a, 0x64, 0xb9, 0xed, 0xc7, 0x3c, 0x2c, 0x48, 0x6a, 0x48, 0x8b, 
+  0x64, 0x5c, 0x20, 0xcd, 0xa7, 0xbd, 0xf2, 0x6b, 0x97, 0x81, 0x3f, 0xb1, 0x05, 0xe1, 0xbc, 0x12, 
+  0x26, 0xbe, 0xf7, 0x6e, 0x95, 0xac, 0x7a, 0xfa, 0x9e, 0xea, 0xcd, 0xd6, 0x38, 0xdf, 0x7b, 0x0f, 
+  0x5e, 0x3c, 0xd4, 0x91, 0x3d, 0xc8, 0x50, 0x04, 0x3f, 0x29, 0x50, 0x07, 0x44, 0x61, 0x95, 0x35, 
+  0xdb, 0x43, 0x87, 0x59, 0xc1, 0x8a, 0xfe, 0xad, 0x50, 0xa1, 0x7b, 0x6c, 0x0b, 0xba, 0xc7, 0x36, 
+  0x20, 0x3a, 0xa8, 0x65, 0x97, 0xb0, 0x08, 0x9a, 0x5a, 0xac, 0xf4, 0x76, 0x36, 0xcb, 0x66, 0x10, 
+  0x9e, 0x41, 0xa1, 0x9e, 0x73, 0x60, 0xd9, 0xba, 0x60, 0xd4, 0x16, 0xe6, 0x42, 0xd8, 0x8b, 0x81, 
+  0xf3, 0x5f, 0xa6, 0xc3, 0xd5, 0xac, 0x85, 0xb3, 0x5f, 0x75, 0x84, 0xdd, 0x17, 0xf1, 0x61, 0x26, 
+  0x59, 0xa1, 0x79, 0x3b, 0xc3, 0x73, 0x65, 0x1c, 0x47, 0x2c, 0x7b, 0x62, 0x35, 0xeb, 0x12, 0xa2, 
+  0xbf, 0x1b, 0xf3, 0x47, 0x1a, 0x59, 0x67, 0x1d, 0x5f, 0x67, 0xf7, 0x21, 0x43, 0x02, 0xc9, 0xae, 
+  0xf0, 0x4d, 0x8d, 0x47, 0x73, 0x26, 0x2b, 0x12, 0x3b, 0xd7, 0x44, 0xfa, 0xa8, 0xbe, 0x6f, 0x8c, 
+  0xba, 0xa1, 0xce, 0xe5, 0x53, 0x0b, 0xa5, 0x6b, 0xd8, 0x23, 0x8d, 0x57, 0x2b, 0x26, 0x8c, 0x8e, 
+  0x24, 0xc4, 0x54, 0xb8, 0x3d, 0xe9, 0xb7, 0xad, 0x97, 0xce, 0x9e, 0x0c, 0xae, 0x39, 0x60, 0x12, 
+  0x79, 0x6f, 0x90, 0x35, 0x50, 0xfc, 0x3d, 0x59, 0x71, 0x0a, 0x7c, 0xbd, 0x6c, 0x68, 0x76, 0x14, 
+  0x87, 0x61, 0xe2, 0x8c, 0x7c, 0x81, 0x23, 0x52, 0xad, 0xc6, 0x58, 0xad, 0xab, 0x86, 0x9c, 0x93, 
+  0x0e, 0xb3, 0xb9, 0x84, 0xfd, 0x1d, 0x99, 0x8d, 0xa8, 0x26, 0xf4, 0xd6, 0x7a, 0xd4, 0x5f, 0x6e, 
+  0x1b, 0x25, 0x89, 0x3f, 0xf5, 0x39, 0xac, 0x2e, 0x4c, 0x01, 0xfb, 0xc3, 0x8d, 0x66, 0x5b, 0x1b, 
+  0xfd, 0xdd, 0xbc, 0xbe, 0xb3, 0xd5, 0xc9, 0x7c, 0x5a, 0x6f, 0x0f, 0xdc, 0x53, 0xc1, 0x03, 0xb4, 
+  0xd1, 0x23, 0x68, 0x7a, 0xd5, 0x05, 0x4e, 0x95, 0x44, 0x8c, 0x5a, 0xdd, 0xde, 0x7b, 0x41, 0xe6, 
+  0x9b, 0x2c, 0xa8, 0x41, 0xc5, 0x6d, 0x97, 0xed, 0x40, 0xfb, 0xcc, 0xe6, 0x4f, 0x65, 0xe2, 0x43, 
+  0xa5, 0xa5, 0xe6, 0x92, 0x6a, 0xba, 0xb4, 0xc4, 0x69, 0x64, 0xa8, 0x55, 0x75, 0x01, 0x27, 0x70, 
+  0xb7, 0x97, 0x8a, 0x36, 0x35, 0x72, 0xd7, 0x6a, 0x97, 0x89, 0x71, 0xed, 0x65, 0xce, 0x83, 0x90, 
+  0x35, 0x10, 0xa5, 0x64, 0xeb, 0x96, 0x68, 0x6b, 0x37, 0x31, 0xa6, 0x9f, 0xd6, 0xba, 0xdc, 0xf1, 
+  0x69, 0x7a, 0xe5, 0x7c, 0x71, 0xf3, 0x7f, 0xff, 0x7c, 0xf5, 0x8c, 0x8d, 0x79, 0xc5, 0x18, 0x0d, 
+  0x14, 0x01, 0xd3, 0x11, 0x37, 0x38, 0x56, 0x77, 0xd2, 0x49, 0x14, 0x5a, 0x6a, 0x3e, 0x0d, 0x04, 
+  0x47, 0x5c, 0x76, 0x6d, 0x21, 0xbc, 0x8a, 0xed, 0xc4, 0xba, 0x1f, 0x4e, 0x11, 0xb3, 0x0a, 0x1c, 
+  0x63, 0xb2, 0x9e, 0x27, 0x3b, 0xd1, 0xad, 0x89, 0x6a, 0xe4, 0x04, 0xc5, 0x62, 0xae, 0xe1, 0x22, 
+  0x56, 0xea, 0xcd, 0xa0, 0xe8, 0xc2, 0x58, 0x86, 0xe4, 0x91, 0x71, 0x28, 0x67, 0x35, 0x2c, 0x1d, 
+  0x95, 0x69, 0x2d, 0x51, 0x7d, 0xfe, 0x53, 0x95, 0xb3, 0xa0, 0xf6, 0x8c, 0x0e, 0x76, 0x6d, 0x80, 
+  0xfe, 0xcc, 0xed, 0x51, 0xd1, 0x36, 0x5b, 0xf5, 0xa0, 0x34, 0x45, 0x03, 0x9e, 0xdd, 0x3a, 0x5c, 
+  0x7b, 0x2c, 0x4e, 0x76, 0xd5, 0x7e, 0x2a, 0x48, 0xfe, 0xaf, 0x46, 0xc6, 0xde, 0xaf, 0x86, 0x06, 
+  0x48, 0x0b, 0xbc, 0x40, 0x39, 0x76, 0x4c, 0xb4, 0x04, 0xf3, 0xc8, 0x13, 0xed, 0x50, 0xb5, 0x31, 
+  0x46, 0xcd, 0x83, 0xda, 0x10, 0x27, 0x39, 0x9b, 0xcd, 0x55, 0xfb, 0x40, 0x4f, 0x57, 0x6f, 0x2a, 
+  0x32, 0xa9, 0xa9, 0x63, 0xbb, 0x54, 0x45, 0xec, 0xbc, 0x06, 0xf1, 0x6b, 0x97, 0xd5, 0xee, 0x15, 
+  0x12, 0x6b, 0xea, 0x69, 0xca, 0x17, 0xb8, 0xcc, 0x88, 0x58, 0x21, 0xdc, 0x07, 0xf3, 0x05, 0x89, 
+  0x79, 0x7e, 0x50, 0x4f, 0xde, 0xb5, 0xd5, 0xf5, 0x26, 0x6a, 0x1b, 0x26, 0x0c, 0x63, 0xe1, 0x9c, 
+  0x14, 0xf0, 0xb0, 0x63, 0x03, 0x4c, 0x69, 0x83, 0xfa, 0xbd, 0x1d, 0x38, 0xf5, 0xd8, 0x3c, 0x3f, 
+  0xd8, 0x51, 0x7a, 0xe8, 0xf5, 0x1e, 0x98, 0xd2, 0x5a, 0xf0, 0xe8, 0x20, 0x11, 0xf3, 0x3f, 0x32, 
+  0x8e, 0x43, 0x9c, 0xd4, 0x1b, 0x0d, 0xbb, 0xcc, 0x32, 0x14, 0xe6, 0x28, 0x69, 0x0a, 0x57, 0x7a, 
+  0x65, 0x76, 0x79, 0xb3, 0xc1, 0x32, 0xbe, 0xdd, 0x9d, 0x48, 0xcc, 0xe8, 0xa9, 0x49, 0xec, 0x90, 
+  0x88, 0xb7, 0xbd, 0x1d, 0xd7, 0xda, 0xa9, 0x77, 0xef, 0xb0, 0x66, 0x18, 0xe8, 0x55, 0xc3, 0xef, 
+  0x59, 0xf5, 0x3b, 0x4e, 0xf2, 0xde, 0x7c, 0xbd, 0x2a, 0xf3, 0x73, 0xbb, 0x29, 0xad, 0xdf, 0x60, 
+  0xdc, 0xb3, 0x35, 0xee, 0x09, 0x3e, 0x05, 0x11, 0xff, 0x8c, 0x7a, 0x13, 0xa6, 0x8a, 0xa5, 0x1f, 
+  0xc7, 0x3d, 0xc8, 0x80, 0x2e, 0x03, 0x80, 0xb7, 0xee, 0x6c, 0x23, 0x25, 0x3d, 0xeb, 0xe7, 0x18, 
+  0x77, 0xba, 0x06, 0xc9, 0xe9, 0xd3, 0x76, 0x0d, 0x52, 0xb5, 0xb0, 0x01, 0xc9, 0x95, 0x5a, 0x98, 
+  0xac, 0xd6, 0x4f, 0xa1, 0x16, 0xec, 0xd4, 0x74, 0x23, 0xa2, 0xd4, 0x98, 0x26, 0x32, 0x8e, 0xcc, 
+  0x6e, 0x97, 0xaf, 0xd0, 0xe5, 0x19, 0xa9, 0xdb, 0x4c, 0x99, 0x68, 0x62, 0xd1, 0x84, 0x64, 0xc6, 
+  0xec, 0xb6, 0xf5, 0xce, 0xfd, 0x92, 0x95, 0x4b, 0x92, 0x35, 0x53, 0x7b, 0xf0, 0x3b, 0x70, 0xce, 
+  0x60, 0x85, 0xfc, 0x80, 0x4f, 0x75, 0xee, 0x41, 0x98, 0x6c, 0x02, 0xfb, 0x8e, 0xef, 0x62, 0x22, 
+  0x0a, 0xe5, 0x41, 0xf7, 0xcd, 0xc8, 0x40, 0x05, 0xab, 0xc1, 0x59, 0xf1, 0x6d, 0x8c, 0x20, 0xb8, 
+  0x11, 0x5e, 0x6f, 0x36, 0xac, 0x05, 0x08, 0x36, 0xa3, 0xa4, 0x5a, 0x05, 0x51, 0x31, 0x6e, 0x77, 
+  0x3a, 0xdf, 0x84, 0x79, 0x85, 0x99, 0x27, 0x24, 0x02, 0xb0, 0xd0, 0xb1, 0x75, 0xbb, 0x19, 0xc9, 
+  0x6a, 0xfe, 0x3b, 0x03, 0x27, 0x38, 0x6c, 0x19, 0x0f, 0x76, 0x75, 0xdd, 0x35, 0xe0, 0xe5, 0x16, 
+  0xb4, 0xe6, 0x40, 0x59, 0x87, 0xf8, 0x26, 0xb3, 0x8b, 0x78, 0x97, 0xad, 0x0f, 0x55, 0x1b, 0x87, 
+  0x31, 0x2a, 0x18, 0xfe, 0x5f, 0xe8, 0x80, 0x0b, 0xc4, 0x68, 0x27, 0x6e, 0xc3, 0x68, 0xcf, 0xea, 
+  0xb7, 0x68, 0x8f, 0x83, 0xea, 0xaa, 0xe1, 0xb8, 0x86, 0x04, 0x52, 0xcd, 0x63, 0xac, 0x64, 0xb1, 
+  0xad, 0x1c, 0x56, 0x67, 0x6d, 0x0d, 0x1d, 0x73, 0x40, 0x00, 0xeb, 0xb8, 0xea, 0xd1, 0x96, 0x28, 
+  0x72, 0x99, 0xa0, 0x39, 0xdb, 0x12, 0x8e, 0x39, 0x96, 0x74, 0x19, 0xd1, 0x16, 0x67, 0x4d, 0xa5, 
+  0xf1, 0x18, 0x50, 0xc7, 0xda, 0x0a, 0xb4, 0x84, 0x92, 0xad, 0x66, 0x24, 0x8f, 0x03, 0x07, 0x99, 
+  0x9f, 0x9d, 0xd3, 0xe3, 0xa0, 0x4a, 0xb4, 0x18, 0x2b, 0x0e, 0x38, 0xcb, 0x9b, 0x06, 0x4a, 0x56, 
+  0xe6, 0x47, 0xd5, 0xda, 0x1b, 0x75, 0x1d, 0xda, 0x89, 0x01, 0xb8, 0xd5, 0x56, 0x9a, 0x21, 0xb6, 
+  0xab, 0xc9, 0xdc, 0x8a, 0x6b, 0xd9, 0x8d, 0x41, 0xa0, 0xfa, 0x59, 0x9d, 0x45, 0x7e, 0x99, 0x57, 
+  0xbb, 0xbd, 0x87, 0x5a, 0x3d, 0x1b, 0xe7, 0x69, 0x71, 0x6b, 0xb5, 0xb5, 0x3e, 0xa6, 0xa1, 0x53, 
+  0x79, 0xb4, 0x8c, 0x06, 0x83, 0xdf, 0x46, 0x9a, 0x5a, 0x35, 0xc3, 0x74, 0x8e, 0x7d, 0xc0, 0x25, 
+  0x09, 0xc4, 0xd2, 0x1a, 0x28, 0x7c, 0x49, 0x13, 0x98, 0x44, 0x0e, 0xb3, 0xb9, 0x2b, 0x22, 0x64, 
+  0x24, 0x22, 0xd0, 0xcb, 0xfa, 0x5d, 0x9a, 0x28, 0x49, 0x4e, 0xaf, 0x99, 0x82, 0xad, 0xec, 0xbd, 
+  0x0e, 0x4f, 0x62, 0xc5, 0x11, 0xc9, 0x32, 0x56, 0xe2, 0xa3, 0x83, 0x3a, 0xd2, 0x92, 0x1b, 0xcb, 
+  0xab, 0xf0, 0x27, 0x15, 0x36, 0x9d, 0xdd, 0x0c, 0x63, 0x83, 0xc3, 0xdf, 0x9d, 0x5f, 0xd2, 0x2c, 
+  0x53, 0x7b, 0x92, 0x5a, 0x5c, 0xdc, 0x71, 0xa1, 0x11, 0xf6, 0xb8, 0x78, 0x58, 0x22, 0xdb, 0x77, 
+  0xa1, 0xae, 0x35, 0x29, 0x0d, 0x63, 0x6b, 0xa8, 0x93, 0x08, 0x8a, 0x05, 0x38, 0x8b, 0x28, 0xed, 
+  0x30, 0xdb, 0xd0, 0x2e, 0xbe, 0xee, 0xc8, 0x23, 0x97, 0x0c, 0xef, 0x54, 0xeb, 0x98, 0x4d, 0x1b, 
+  0xf6, 0xf2, 0xc8, 0x6d, 0x39, 0x5a, 0xc0, 0x90, 0xcb, 0x0c, 0xdf, 0x99, 0xab, 0x2d, 0x31, 0xea, 
+  0x5b, 0xda, 0xd3, 0xc7, 0x51, 0xdd, 0xc1, 0x22, 0x36, 0x0e, 0x16, 0x5b, 0xaa, 0x30, 0xe2, 0x35, 
+  0xbc, 0xdf, 0xa0, 0x6f, 0x41, 0x5a, 0x00, 0xc9, 0xed, 0x6b, 0xa8, 0x2a, 0x70, 0x64, 0xaf, 0xb7, 
+  0x1b, 0xc5, 0x41, 0xa9, 0x59, 0x21, 0x0b, 0xb3, 0xbe, 0xb3, 0x17, 0xfb, 0x82, 0xe4, 0x38, 0x47, 
+  0x4c, 0x3b, 0xb2, 0x5c, 0x87, 0x1e, 0xff, 0xc1, 0x19, 0xe7, 0x29, 0xda, 0xd5, 0xa1, 0x77, 0x5a, 
+  0x9e, 0x2f, 0xa1, 0x74, 0x71, 0x32, 0xdc, 0x2d, 0xa1, 0xce, 0xb8, 0x50, 0xa7, 0x38, 0xef, 0x8f, 
+  0x19, 0x04, 0xad, 0xbe, 0xa3, 0x91, 0x23, 0x12, 0x33, 0x10, 0x5b, 0xd7, 0x49, 0x65, 0x76, 0x20, 
+  0xc9, 0x98, 0x02, 0xa5, 0x5f, 0x8a, 0x0f, 0xaf, 0xef, 0xc5, 0x2b, 0xbd, 0x9e, 0x33, 0x73, 0xa7, 
+  0x6e, 0xdf, 0xa2, 0xa7, 0x54, 0x2d, 0x5e, 0x85, 0x34, 0xa3, 0xb5, 0x07, 0x21, 0xad, 0x94, 0x96, 
+  0x39, 0x2f, 0x3c, 0x8e, 0xfa, 0x80, 0x4d, 0x02, 0xdb, 0xa5, 0x17, 0xc5, 0x32, 0xf2, 0x89, 0xf7, 
+  0x2a, 0x38, 0x2d, 0x2d, 0xf0, 0xf0, 0xe4, 0x25, 0x73, 0x3d, 0xac, 0xaf, 0x32, 0x0f, 0x78, 0x62, 
+  0x4c, 0xf3, 0x8d, 0xf6, 0xbd, 0x6b, 0xbb, 0x27, 0xd6, 0xd4, 0x9a, 0x73, 0x08, 0x7a, 0xd4, 0x3f, 
+  0xed, 0x47, 0x7d, 0xc4, 0x10, 0xf6, 0xd7, 0xb4, 0x43, 0xe8, 0x8d, 0xb4, 0xbf, 0x56, 0x74, 0x36, 
+  0x2c, 0x19, 0xc2, 0xc3, 0x3a, 0xd2, 0xc4, 0x01, 0x1b, 0xee, 0xfc, 0x0b, 0x78, 0x8e, 0xd1, 0xe3, 
+  0x45, 0xc3, 0x2e, 0x19, 0x69, 0xc3, 0x28, 0x32, 0x01, 0x5c, 0x8c, 0xe3, 0xae, 0xa5, 0xd8, 0x6d, 
+  0x85, 0x0a, 0x73, 0xb5, 0x80, 0xfa, 0xe9, 0x1d, 0xe7, 0x7f, 0x1b, 0x57, 0xa9, 0x13, 0xb0, 0x20, 
+  0xe8, 0x49, 0xcc, 0x46, 0x32, 0xf3, 0x9c, 0x7a, 0xb0, 0x36, 0x3b, 0xae, 0xe5, 0x23, 0xc4, 0x98, 
+  0x9c, 0x24, 0xd0, 0x89, 0xc7, 0x1c, 0xef, 0x45, 0x81, 0x90, 0xa6, 0xc2, 0xeb, 0x20, 0x30, 0x2b, 
+  0x0e, 0x71, 0xf4, 0xbe, 0xa6, 0x90, 0x54, 0x69, 0x8e, 0xc2, 0x6c, 0xef, 0xd1, 0x8e, 0x4a, 0x01, 
+  0x00, 0x97, 0xb2, 0xba, 0x13, 0xc2, 0x77, 0xad, 0x49, 0x04, 0xb3, 0xb1, 0x3b, 0xcb, 0xbe, 0x5e, 
+  0xa0, 0xda, 0xb7, 0x05, 0xc7, 0x06, 0x12, 0xb3, 0x47, 0xd7, 0xe2, 0xb1, 0xe2, 0xae, 0xb0, 0x1a, 
+  0x13, 0x49, 0x94, 0xd4, 0xc7, 0x2c, 0x5e, 0x6f, 0x34, 0x50, 0x61, 0xd9, 0x84, 0xec, 0x33, 0x84, 
+  0xba, 0x5a, 0x6a, 0x96, 0xbd, 0x0c, 0x3d, 0x66, 0x61, 0xb2, 0xc8, 0x43, 0x06, 0xad, 0xf5, 0x05, 
+  0xd6, 0xfe, 0xea, 0x22, 0x9e, 0x27, 0xef, 0xde, 0x3c, 0x03, 0xff, 0x9f, 0x02, 0x85, 0x36, 0x63, 
+  0x24, 0xae, 0xd6, 0x73, 0xdf, 0x82, 0x50, 0xed, 0xc1, 0x1c, 0xa0, 0xfa, 0xcc, 0x42, 0x5a, 0x78, 
+  0xba, 0xd2, 0x04, 0x57, 0xb3, 0x80, 0x36, 0x4e, 0x75, 0xe0, 0x54, 0x15, 0xc8, 0xff, 0x96, 0x89, 
+  0x5e, 0xd8, 0x7a, 0xc0, 0x26, 0x46, 0x10, 0x58, 0x9d, 0xf7, 0xd2, 0x97, 0x03, 0x49, 0xf3, 0xb6, 
+  0x38, 0x68, 0xe7, 0xc9, 0x98, 0x18, 0xce, 0x79, 0xc2, 0xa8, 0x8a, 0xe3, 0xce, 0x06, 0x52, 0xd6, 
+  0x9e, 0x04, 0x21, 0xbb, 0x01, 0x52, 0x91, 0x95, 0x0b, 0x21, 0xf0, 0x56, 0xfc, 0xb9, 0xf1, 0x6e, 
+  0xf7, 0xbe, 0xb8, 0x8c, 0x2b, 0x0f, 0x27, 0x8e, 0x4e, 0x89, 0x81, 0x17, 0xff, 0x01, 0xbf, 0xc6, 
+  0x62, 0xec, 0x79, 0x21, 0x43, 0x46, 0x6f, 0xe4, 0x44, 0x3f, 0x4d, 0xe6, 0x67, 0x09, 0x36, 0x27, 
+  0xdc, 0xa9, 0xc2, 0x89, 0x46, 0x24, 0x50, 0x1e, 0xe6, 0xcc, 0x9b, 0xaa, 0x3a, 0x51, 0xc8, 0x55, 
+  0x5c, 0x3b, 0xe2, 0x13, 0x7b, 0xc4, 0xe7, 0xa6, 0x25, 0xda, 0x62, 0x6b, 0xf1, 0x67, 0xeb, 0x4b, 
+  0x36, 0x3f, 0x5e, 0xb7, 0x80, 0x2f, 0x5d, 0x6a, 0x0f, 0x02, 0x2c, 0xe5, 0xa0, 0x32, 0x5d, 0x41, 
+  0x3b, 0x1b, 0x73, 0x85, 0x63, 0x73, 0x36, 0x2c, 0xc6, 0x9c, 0x85, 0x82, 0x88, 0x43, 0x1a, 0x5d, 
+  0x8c, 0x52, 0x04, 0xf2, 0x5e, 0xd0, 0x20, 0x8c, 0x13, 0x8d, 0x3f, 0xf5, 0x2a, 0xe6, 0xec, 0x1b, 
+  0x00, 0x9f, 0xb2, 0x97, 0x29, 0xfc, 0xed, 0xc5, 0x96, 0xa3, 0x1f, 0xd3, 0x19, 0xbd, 0xc0, 0x97, 
+  0xff, 0x19, 0xb3, 0x45, 0x1e, 0xbe, 0x6a, 0x22, 0x34, 0xcf, 0x39, 0x34, 0x57, 0xd2, 0x08, 0xd1, 
+  0xc9, 0x9e, 0x98, 0xa8, 0x7d, 0x8e, 0x20, 0x1f, 0xde, 0xc1, 0x21, 0xb6, 0x52, 0x9e, 0xfe, 0x1e, 
+  0x4f, 0xfb, 0xcb, 0x6f, 0x04, 0xf8, 0x8d, 0x3d, 0x0c, 0xda, 0x9c, 0xe0, 0x8a, 0x49, 0x8f, 0xa9, 
+  0xa3, 0x73, 0x0a, 0x8e, 0x65, 0xbd, 0xae, 0x34, 0xb1, 0xaa, 0x3d, 0xa3, 0x8f, 0x1b, 0xeb, 0x4a, 
+  0x9f, 0xbb, 0x4a, 0x7f, 0x36, 0xc5, 0x72, 0x8d, 0x07, 0xc1, 0x90, 0xc3, 0xe0, 0xd4, 0x21, 0x83, 
+  0xa2, 0xa9, 0x59, 0xfe, 0x85, 0x26, 0x37, 0x1f, 0x72, 0x3c, 0xc6, 0x92, 0x88, 0x63, 0xbc, 0x48, 
+  0x73, 0x7b, 0x07, 0xe3, 0x49, 0x9b, 0x7b, 0x69, 0x25, 0x04, 0xc8, 0x78, 0x60, 0xc4, 0xcc, 0x1e, 
+  0x6a, 0x2a, 0x53, 0x88, 0xae, 0xf7, 0x91, 0xf7, 0xa2, 0x64, 0x19, 0x91, 0xd1, 0x52, 0x39, 0x97, 
+  0x04, 0xc8, 0xe4, 0xf2, 0xe6, 0xe6, 0x58, 0x5d, 0x44, 0xc7, 0xec, 0x88, 0x79, 0x95, 0x8c, 0x30, 
+  0x93, 0x39, 0xb3, 0x41, 0x68, 0xef, 0x98, 0x84, 0xd2, 0xf4, 0xaf, 0x75, 0x82, 0x3d, 0xc5, 0x2e, 
+  0x6a, 0xb4, 0x4c, 0x3a, 0x33, 0x32, 0xa9, 0xba, 0x0c, 0x91, 0x1b, 0x09, 0x82, 0xca, 0x7b, 0xf0, 
+  0xaa, 0x3b, 0xf3, 0x54, 0xd2, 0x4d, 0xb7, 0xf5, 0xce, 0x97, 0xa4, 0x89, 0xbc, 0xbe, 0x8e, 0x81, 
+  0x70, 0x6f, 0x16, 0xaf, 0x8d, 0xfe, 0x66, 0xc3, 0x2d, 0x96, 0x4a, 0x58, 0x3d, 0x9c, 0x1b, 0xe0, 
+  0x84, 0x71, 0xbf, 0x9f, 0x84, 0x6b, 0x8e, 0x04, 0x4e, 0x36, 0xb5, 0x5e, 0x60, 0xf6, 0x0d, 0x15, 
+  0xfb, 0x1c, 0xdb, 0x9a, 0xfd, 0x3d, 0x77, 0x8b, 0xf0, 0xc4, 0xb5, 0xa9, 0x98, 0xf6, 0x98, 0x10, 
+  0xd0, 0x03, 0x47, 0x8a, 0xd1, 0xdb, 0x0b, 0x07, 0xf1, 0x96, 0x4a, 0x95, 0xed, 0xf6, 0x70, 0xe6, 
+  0x57, 0x35, 0x25, 0xe7, 0xc5, 0x23, 0xd8, 0x35, 0x0d, 0x6a, 0xc5, 0x7c, 0xb5, 0xe2, 0xb7, 0x63, 
+  0x89, 0xb7, 0x6e, 0x46, 0x99, 0xb2, 0x15, 0x32, 0x59, 0xaa, 0xf2, 0xea, 0xae, 0x17, 0x67, 0x5d, 
+  0x34, 0x77, 0x54, 0x81, 0x39, 0xb4, 0x9d, 0x59, 0x4a, 0x59, 0x98, 0xb7, 0x91, 0x63, 0xf3, 0x7e, 
+  0x21, 0x46, 0x6c, 0x4f, 0xd1, 0x5f, 0xae, 0xbd, 0x14, 0x85, 0x2b, 0x94, 0x6e, 0x25, 0xec, 0xb6, 
+  0xf6, 0xcd, 0x21, 0xd1, 0xfc, 0x38, 0xdc, 0x65, 0x20, 0x39, 0xa0, 0x0e, 0x42, 0x37, 0x9b, 0x14, 
+  0xd2, 0x33, 0xcf, 0xa0, 0x4c, 0x07, 0x07, 0x60, 0xae, 0xd9, 0x69, 0xc0, 0x5c, 0x44, 0xd5, 0xa8, 
+  0xe8, 0x5b, 0x5b, 0xde, 0x5f, 0x75, 0xd0, 0xf4, 0x3c, 0xe9, 0x58, 0xca, 0xce, 0x2c, 0xdb, 0xaf, 
+  0xfa, 0xdc, 0x21, 0x14, 0x25, 0x8a, 0xe9, 0xa5, 0x5a, 0x9b, 0x21, 0xcf, 0xfd, 0x2d, 0xe7, 0x5b, 
+  0xda, 0x61, 0x82, 0x48, 0x65, 0xaf, 0x3e, 0xc5, 0xa1, 0xdd, 0x76, 0x08, 0xa5, 0x5d, 0x49, 0xad, 
+  0xe9, 0x9c, 0x79, 0x59, 0x15, 0x1e, 0x53, 0x18, 0xf9, 0xc8, 0x49, 0x78, 0xb5, 0x8a, 0xd6, 0xda, 
+  0x69, 0xa7, 0xb0, 0x6e, 0x38, 0x2b, 0xce, 0xa7, 0xa3, 0x45, 0xcc, 0x15, 0x1c, 0xf6, 0x0d, 0x8c, 
+  0x75, 0x7f, 0x4f, 0x96, 0x02, 0x04, 0x9b, 0x82, 0xbf, 0xeb, 0xa1, 0xe8, 0x95, 0xc6, 0xcd, 0x1b, 
+  0x3e, 0xc2, 0xeb, 0x64, 0x4c, 0x64, 0x25, 0x22, 0xe2, 0x89, 0x4f, 0x4f, 0x76, 0x36, 0xf7, 0xd3, 
+  0x81, 0xf7, 0xf3, 0x7a, 0xc6, 0xde, 0x7b, 0xdc, 0xdc, 0x1c, 0xf4, 0x66, 0x29, 0xb7, 0x04, 0x71, 
+  0x65, 0x55, 0xe6, 0x17, 0x90, 0xd0, 0xe3, 0x13, 0x9d, 0x82, 0xa2, 0x75, 0x8b, 0xb7, 0x52, 0x35, 
+  0xce, 0x88, 0xed, 0x8b, 0xe7, 0xa7, 0xd1, 0xf5, 0x6f, 0x8e, 0x11, 0x2e, 0xeb, 0xf2, 0x03, 0x17, 
+  0xba, 0x91, 0x71, 0xde, 0x20, 0x0c, 0xc9, 0x9d, 0x99, 0xe3, 0x5f, 0x87, 0x95, 0xae, 0x61, 0x5e, 
+  0xaa, 0x8c, 0x77, 0x16, 0xb8, 0xd2, 0x78, 0xe3, 0xa9, 0x6b, 0xfd, 0xba, 0x50, 0x1c, 0xd1, 0x14, 
+  0x18, 0x58, 0x38, 0x74, 0x35, 0x78, 0xd8, 0xb2, 0xe1, 0xcd, 0x45, 0x87, 0xe6, 0x7c, 0xb9, 0x5e, 
+  0x24, 0x0f, 0x25, 0xf3, 0x5c, 0xb2, 0x08, 0xa1, 0x08, 0xab, 0xdf, 0x52, 0x7c, 0xde, 0x3e, 0x58, 
+  0xe0, 0x99, 0xf9, 0xa9, 0x04, 0xbb, 0x57, 0x72, 0x8c, 0xd0, 0x7d, 0xf7, 0x52, 0xca, 0xbf, 0x61, 
+  0x06, 0xd8, 0x54, 0x91, 0x2b, 0x5d, 0xeb, 0x85, 0x5b, 0xe7, 0x85, 0xad, 0xa1, 0x6f, 0xdb, 0xdf, 
+  0x56, 0x78, 0x7a, 0x94, 0x9d, 0xa4, 0x19, 0xb4, 0x2c, 0x33, 0x00, 0xf9, 0xd2, 0xa6, 0xb5, 0x1f, 
+  0xbb, 0xb5, 0xcc, 0x66, 0xa3, 0x9a, 0x0b, 0xbc, 0x74, 0x3d, 0x21, 0xad, 0x28, 0x29, 0xa7, 0x40, 
+  0xe2, 0xce, 0xd8, 0xf0, 0xb7, 0xb9, 0x60, 0x5f, 0x75, 0xec, 0x3b, 0x03, 0xdf, 0xd0, 0xd5, 0x92, 
+  0xdd, 0x86, 0xad, 0xb6, 0x0c, 0x84, 0x9d, 0x61, 0x3e, 0xed, 0xda, 0xb0, 0x1c, 0x68, 0x75, 0x47, 
+  0x08, 0x39, 0x9d, 0xb6, 0xc7, 0xf9, 0x7c, 0xbd, 0x6a, 0xee, 0x53, 0x0d, 0x5c, 0xec, 0x70, 0x35, 
+  0xd0, 0xc2, 0x08, 0x99, 0x35, 0x75, 0x38, 0xf9, 0x09, 0xed, 0x4f, 0x23, 0x6c, 0x01, 0xa3, 0x84, 
+  0xf3, 0xc4, 0x18, 0x35, 0x0b, 0xab, 0x0e, 0x62, 0x06, 0x89, 0xd3, 0x2a, 0x4d, 0xf0, 0x9d, 0x16, 
+  0x0d, 0x05, 0xfb, 0x13, 0x81, 0xb4, 0xb5, 0x12, 0x95, 0x77, 0x2f, 0x1e, 0xc1, 0x3d, 0x63, 0x43, 
+  0x4b, 0x16, 0x48, 0x15, 0x1b, 0x20, 0xfa, 0x5a, 0x7e, 0xa4, 0x24, 0x42, 0xe2, 0x99, 0x9e, 0xd0, 
+  0x21, 0xc9, 0x9c, 0x4f, 0xa3, 0x83, 0xcf, 0x63, 0x9d, 0xcb, 0x18, 0x31, 0x35, 0xdb, 0xfa, 0xbe, 
+  0xbf, 0x31, 0xde, 0xe4, 0x95, 0x0f, 0x0c, 0xda, 0xca, 0xea, 0x77, 0xf6, 0xe5, 0x0c, 0x7a, 0x0a, 
+  0x7d, 0x99, 0x7e, 0x67, 0x69, 0xce, 0x6a, 0x73, 0x2b, 0xcd, 0xea, 0x37, 0x67, 0xcb, 0x75, 0xe1, 
+  0xa9, 0xac, 0x59, 0x2c, 0x5f, 0x97, 0x7c, 0x77, 0x6b, 0x6f, 0x01, 0xe7, 0x71, 0xcb, 0x59, 0xd0, 
+  0x77, 0xa8, 0xed, 0x28, 0xe9, 0xfe, 0x2e, 0xd0, 0xfd, 0x2d, 0xad, 0x47, 0xc8, 0x4a, 0x44, 0x8c, 
+  0x73, 0x32, 0xe4, 0x07, 0x4c, 0xb1, 0xd0, 0x53, 0x68, 0x4f, 0x98, 0xdc, 0x74, 0xd7, 0xc3, 0x93, 
+  0xda, 0xec, 0xf2, 0xe4, 0x98, 0x36, 0x94, 0x30, 0xad, 0xe8, 0xd8, 0xe3, 0x99, 0x30, 0x12, 0x13, 
+  0x3a, 0x7b, 0xc7, 0x76, 0x60, 0xc2, 0xea, 0xdb, 0xa7, 0x41, 0x50, 0x31, 0x16, 0x76, 0x01, 0x56, 
+  0x0b, 0xf2, 0x31, 0x5f, 0xbb, 0xab, 0xd3, 0x29, 0x2c, 0x0f, 0x9d, 0x99, 0xe7, 0x72, 0x24, 0xcb, 
+  0x37, 0x57, 0xb0, 0x0d, 0x5b, 0xfc, 0x86, 0xa0, 0xa6, 0xb6, 0x9c, 0x7a, 0xf1, 0x70, 0xc1, 0xae, 
+  0x57, 0xc2, 0xb8, 0x2c, 0xe9, 0x5c, 0x4d, 0x8f, 0x49, 0xa2, 0x92, 0x1f, 0x59, 0x4e, 0x53, 0x48, 
+  0x9b, 0x0a, 0x0b, 0x05, 0x77, 0x60, 0x85, 0xf2, 0x34, 0xf3, 0x7d, 0x4c, 0x44, 0xb3, 0xe3, 0xdc, 
+  0x6b, 0x6e, 0x69, 0xe0, 0x10, 0x9b, 0xdc, 0xd5, 0x5a, 0x14, 0x65, 0xfe, 0xfc, 0xbb, 0x95, 0x1d, 
+  0x78, 0x8b, 0xde, 0x79, 0xc7, 0x89, 0x5a, 0x24, 0x8a, 0x78, 0xde, 0xd3, 0x44, 0x7d, 0x4e, 0xa0, 
+  0x8c, 0xb0, 0x1b, 0xf7, 0x24, 0xa9, 0x4c, 0x01, 0x60, 0xc6, 0x80, 0x95, 0xe2, 0x82, 0x54, 0xa4, 
+  0x91, 0x90, 0x0a, 0x46, 0x7c, 0xce, 0x2b, 0xd0, 0x99, 0xdc, 0xa4, 0xa1, 0x8d, 0xa3, 0x64, 0x92, 
+  0x4f, 0x4d, 0x40, 0xc5, 0x77, 0xa9, 0x94, 0x59, 0x3b, 0x20, 0x2a, 0x92, 0x28, 0x9d, 0xc4, 0x7c, 
+  0x1e, 0x77, 0x08, 0xfb, 0x12, 0xd1, 0x10, 0x47, 0x2b, 0x9f, 0xdf, 0x20, 0x2e, 0x14, 0x35, 0x8d, 
+  0x5b, 0xec, 0xb8, 0x5e, 0xad, 0x9a, 0x11, 0x1b, 0xe9, 0xaa, 0x32, 0xde, 0x25, 0x4c, 0x95, 0x7b, 
+  0x8b, 0x3c, 0x59, 0xb9, 0xbe, 0x83, 0x6c, 0x8f, 0xb8, 0xe7, 0x0d, 0x62, 0xe8, 0xea, 0x8c, 0x2d, 
+  0x02, 0x73, 0x05, 0xf1, 0xb7, 0xac, 0xea, 0x03, 0x94, 0xd8, 0x7a, 0x02, 0x47, 0x70, 0xdb, 0xfa, 
+  0xf8, 0xb1, 0x2c, 0x3e, 0xc6, 0xe7, 0xb3, 0x32, 0x5b, 0x55, 0x9c, 0xb7, 0x09, 0x6e, 0x55, 0x26, 
+  0xb4, 0xd5, 0x3a, 0x46, 0xb5, 0x57, 0x5d, 0xcf, 0x46, 0xcb, 0x76, 0x47, 0x22, 0x03, 0x10, 0xa8, 
+  0xb7, 0x09, 0xe0, 0xc3, 0x0a, 0x8d, 0x24, 0x49, 0xc4, 0xcf, 0xf3, 0xcb, 0xa4, 0x38, 0x8c, 0x91, 
+  0x6b, 0x94, 0xba, 0x1b, 0x78, 0x44, 0x1f, 0x44, 0x69, 0xf2, 0x4b, 0xfc, 0x39, 0x7e, 0xcb, 0xce, 
+  0x29, 0x3a, 0x87, 0x4c, 0x5e, 0xfc, 0xbc, 0xcc, 0xe7, 0x67, 0x74, 0xc8, 0x0f, 0xca, 0xca, 0x55, 
+  0xe2, 0x3c, 0x71, 0x57, 0x99, 0xc4, 0xe9, 0x31, 0xab, 0x05, 0x25, 0x95, 0xcd, 0x7d, 0x47, 0x12, 
+  0x8f, 0xc9, 0x57, 0x47, 0xe2, 0xcd, 0x64, 0x4a, 0xa2, 0x81, 0xcd, 0xe3, 0x77, 0x6a, 0xc1, 0x49, 
+  0xd4, 0xe7, 0xe8, 0x74, 0xe7, 0xe2, 0xe6, 0x66, 0x5f, 0x9d, 0x44, 0x17, 0x83, 0xd3, 0xc1, 0x3e, 
+  0xaf, 0x17, 0x59, 0x22, 0x24, 0x7e, 0x62, 0x71, 0xe0, 0xc6, 0x3a, 0x5a, 0xa9, 0x85, 0x18, 0xd0, 
+  0xe0, 0xd4, 0x03, 0x41, 0x6c, 0xe9, 0x9f, 0xaa, 0x7c, 0xf0, 0x19, 0xf9, 0xf1, 0x8e, 0x11, 0x41, 
+  0xb5, 0x43, 0x84, 0x33, 0x3e, 0x88, 0xe6, 0xa3, 0x98, 0xea, 0xac, 0x10, 0x03, 0x1c, 0x8f, 0xf3, 
+  0x31, 0x4d, 0xf8, 0xce, 0x3e, 0x20, 0x52, 0xcb, 0x49, 0x4c, 0x3f, 0xc6, 0x6b, 0xfe, 0x13, 0x2e, 
+  0x7d, 0xfa, 0x31, 0xbd, 0xb9, 0x39, 0x51, 0x2b, 0xbe, 0x41, 0xbf, 0x82, 0xc1, 0x7e, 0x18, 0xd3, 
+  0x7f, 0xb9, 0xee, 0xc3, 0x12, 0x7d, 0x3e, 0xc6, 0x3f, 0x9f, 0x25, 0xbe, 0xea, 0x82, 0xde, 0x44, 
+  0xcb, 0xf5, 0xe6, 0x26, 0x1e, 0x05, 0xa7, 0xd1, 0x82, 0x56, 0x12, 0x35, 0x01, 0x78, 0xec, 0xbb, 
+  0x77, 0x4f, 0xe9, 0x05, 0x72, 0x03, 0xef, 0x38, 0x96, 0x8e, 0x2e, 0x27, 0xcb, 0x56, 0xc6, 0xc3, 
+  0xcc, 0x64, 0x3c, 0x9c, 0xec, 0xec, 0xc4, 0x53, 0x9d, 0xf6, 0x10, 0x0c, 0x40, 0x6e, 0x1b, 0xa1, 
+  0x16, 0xa8, 0xdd, 0xf1, 0xe7, 0xed, 0x8d, 0x14, 0xba, 0x91, 0x84, 0x1a, 0xc9, 0x4d, 0x23, 0x39, 
+  0x60, 0x49, 0xa9, 0x51, 0x45, 0xf7, 0x54, 0xaa, 0x53, 0x7e, 0x92, 0x0c, 0xaa, 0x63, 0x9f, 0x74, 
+  0x55, 0x8f, 0x16, 0x4d, 0xcc, 0x30, 0x6c, 0xb6, 0x23, 0xf1, 0x74, 0x13, 0xd4, 0x12, 0xeb, 0xfe, 
+  0x32, 0xf7, 0x3f, 0xab, 0x63, 0xd5, 0x4f, 0x87, 0x0b, 0x5a, 0x85, 0xcf, 0xd3, 0xf3, 0xb4, 0x04, 
+  0xf3, 0x02, 0x80, 0xf1, 0xbd, 0xfb, 0x17, 0x44, 0x86, 0x9c, 0x54, 0xb5, 0x76, 0x4d, 0xcc, 0x2c, 
+  0xae, 0xad, 0xb2, 0xc8, 0xbe, 0x34, 0x6a, 0x49, 0x33, 0xbe, 0xd1, 0x70, 0x86, 0x85, 0xca, 0xf9, 
+  0xb0, 0x7a, 0x07, 0xfb, 0x40, 0x19, 0x70, 0xd2, 0xcb, 0xd1, 0x9e, 0x8b, 0x86, 0xce, 0xea, 0x9a, 
+  0x39, 0x07, 0x90, 0xa9, 0xd4, 0xc4, 0x38, 0xa5, 0x9a, 0xe2, 0xc3, 0xd1, 0x01, 0x10, 0x7d, 0x36, 
+  0xce, 0x2b, 0x92, 0x2c, 0x6b, 0x27, 0x33, 0xae, 0x50, 0x49, 0x98, 0x25, 0x52, 0xc4, 0x75, 0x4b, 
+  0x11, 0x9f, 0x16, 0x3e, 0xab, 0x80, 0x4d, 0x7a, 0xa6, 0x3f, 0xc3, 0x58, 0xdd, 0xa1, 0x23, 0x8a, 
+  0xcd, 0x65, 0x09, 0xe3, 0x7c, 0x3a, 0x58, 0x86, 0x2d, 0x3a, 0x2b, 0xa6, 0x78, 0x0d, 0x46, 0xa8, 
+  0xe3, 0xdd, 0x5e, 0xb7, 0x1c, 0x75, 0x74, 0x6d, 0x4b, 0x13, 0xc0, 0xf3, 0xa7, 0x09, 0x9c, 0x8b, 
+  0x97, 0x57, 0x08, 0x1f, 0x7a, 0xfb, 0xe8, 0xf9, 0xa3, 0xc3, 0x23, 0x37, 0xcc, 0x8b, 0x23, 0x7c, 
+  0xf7, 0x2a, 0xfa, 0x18, 0x18, 0xc1, 0xab, 0x4a, 0x36, 0xfc, 0x5f, 0x3e, 0x69, 0xda, 0xc0, 0xa3, 
+  0x35, 0xdb, 0xdf, 0xf1, 0xcc, 0x2f, 0xcc, 0x77, 0x76, 0x27, 0x3c, 0x33, 0xa0, 0x84, 0x9b, 0xba, 
+  0x6b, 0x98, 0x6b, 0x53, 0xa8, 0x64, 0xd6, 0x51, 0xdb, 0x05, 0xb8, 0x10, 0xa7, 0xff, 0x4a, 0xce, 
+  0x2a, 0xc6, 0xc0, 0x3d, 0x0a, 0x1d, 0x64, 0xf6, 0xca, 0x4b, 0xea, 0xe2, 0xee, 0xdd, 0x79, 0x20, 
+  0xb8, 0x82, 0x9c, 0x74, 0x0f, 0x2c, 0x48, 0x5a, 0xd7, 0xcc, 0x30, 0xb8, 0x89, 0xa1, 0xd8, 0x0b, 
+  0x0b, 0xb9, 0xaf, 0x31, 0xcd, 0x8c, 0x46, 0x62, 0x21, 0x30, 0x86, 0x3a, 0x5c, 0x93, 0xd9, 0xaa, 
+  0x3f, 0x25, 0x78, 0x13, 0x5c, 0x11, 0x14, 0xca, 0x99, 0x59, 0x58, 0x35, 0x7e, 0xa2, 0x50, 0x26, 
+  0xad, 0xc7, 0x54, 0xeb, 0x9e, 0x62, 0xe2, 0x38, 0x4d, 0xf4, 0x30, 0xb2, 0x12, 0xf4, 0xa3, 0xc2, 
+  0xae, 0xd4, 0x78, 0x5c, 0x0c, 0x57, 0x73, 0x9a, 0x8e, 0xe5, 0x51, 0x7e, 0x21, 0x79, 0x07, 0xd7, 
+  0x8e, 0x80, 0x4f, 0xa4, 0xca, 0xed, 0xfc, 0x03, 0x84, 0x3a, 0xbe, 0xcb, 0x56, 0x49, 0xe9, 0xe9, 
+  0xec, 0x2c, 0x95, 0x16, 0x8a, 0xa8, 0xa7, 0x2e, 0xaa, 0x27, 0xe3, 0x59, 0x43, 0x70, 0x61, 0xb3, 
+  0x8f, 0x09, 0xa5, 0x62, 0xaa, 0x3a, 0x42, 0xa6, 0x9b, 0x78, 0x2c, 0x96, 0xb9, 0x17, 0x33, 0xb0, 
+  0x6a, 0x1a, 0xbb, 0x31, 0x44, 0x02, 0xf0, 0x3a, 0x9a, 0xe4, 0xdd, 0xbb, 0x0b, 0xe3, 0x84, 0x80, 
+  0x61, 0xb1, 0x73, 0x3e, 0x29, 0x9a, 0x48, 0xa5, 0xd4, 0xed, 0x35, 0xed, 0x41, 0xd1, 0x7b, 0x01, 
+  0xc9, 0xbf, 0xda, 0x97, 0xeb, 0x68, 0xb2, 0x9e, 0x42, 0x9f, 0xa5, 0x57, 0xce, 0xba, 0x6b, 0xc5, 
+  0x2c, 0x89, 0x2d, 0xd4, 0x69, 0x45, 0xb4, 0x26, 0x17, 0x4a, 0x48, 0x63, 0xb3, 0x33, 0xc9, 0xc7, 
+  0x61, 0x4f, 0xed, 0xeb, 0x21, 0xd0, 0x5d, 0x39, 0x8c, 0x05, 0xdd, 0x54, 0x67, 0x28, 0x81, 0xf6, 
+  0xd1, 0x0c, 0x66, 0x7d, 0x68, 0x6c, 0x41, 0xf8, 0xbe, 0xaf, 0xfb, 0x12, 0x0a, 0x70, 0x6c, 0x45, 
+  0xec, 0xcf, 0x89, 0xce, 0x40, 0x71, 0x01, 0x80, 0xf1, 0xa4, 0x26, 0xce, 0xd5, 0xdd, 0xe0, 0xf4, 
+  0xee, 0x92, 0x40, 0x5b, 0x86, 0xde, 0x8a, 0x32, 0x55, 0xef, 0xd4, 0x83, 0x4a, 0xe0, 0xf3, 0xba, 
+  0x33, 0x44, 0xd7, 0xfb, 0xd6, 0x28, 0x4f, 0x5f, 0xd0, 0xc8, 0xf9, 0x43, 0xe7, 0x55, 0x69, 0x38, 
+  0xd9, 0x5b, 0xaa, 0xea, 0xe5, 0xc8, 0x0b, 0x36, 0xa1, 0x4f, 0xfc, 0x9c, 0x30, 0x5d, 0x9a, 0x1a, 
+  0xf3, 0xff, 0x7c, 0x8e, 0xf8, 0x5e, 0xb5, 0xcd, 0x4d, 0xbf, 0x9a, 0xb3, 0x45, 0xd4, 0x9f, 0x23, 
+  0x5e, 0x6c, 0x6f, 0x6a, 0x27, 0x7a, 0x3c, 0x91, 0x45, 0xc0, 0x89, 0x68, 0xa7, 0x21, 0x9f, 0xcf, 
+  0x9c, 0xfe, 0xa9, 0x29, 0x5b, 0x69, 0xde, 0x40, 0x4b, 0x4d, 0xa6, 0xa3, 0x00, 0x1b, 0x8d, 0xb8, 
+  0x47, 0xbc, 0x75, 0x1e, 0x00, 0xab, 0x63, 0xdb, 0x04, 0x69, 0x8c, 0x50, 0x2a, 0x01, 0x3d, 0x2f, 
+  0x8c, 0xb9, 0x20, 0x1d, 0xf5, 0xd2, 0x5a, 0x33, 0x2b, 0x3a, 0x48, 0x5d, 0x5a, 0xa6, 0x3d, 0x63, 
+  0xcb, 0x4e, 0xbb, 0xc6, 0x11, 0x9b, 0xb6, 0x8c, 0xd0, 0xc3, 0x1d, 0x80, 0x16, 0x19, 0xe8, 0x0f, 
+  0x44, 0xed, 0xd6, 0x66, 0x78, 0x1d, 0xda, 0x3f, 0x1f, 0x7f, 0x9b, 0xa8, 0x84, 0xd8, 0x4c, 0x55, 
+  0x1c, 0x90, 0x6f, 0xb0, 0xdb, 0x0e, 0xcc, 0xcd, 0xb0, 0x7a, 0xda, 0xde, 0x60, 0xe3, 0x6f, 0x6e, 
+  0xac, 0x3e, 0xce, 0xf8, 0xbd, 0xa9, 0x6d, 0x85, 0x21, 0x64, 0x1b, 0xa5, 0x74, 0xf6, 0xcd, 0xc7, 
+  0x00, 0x84, 0xb6, 0xe9, 0x94, 0xf4, 0x94, 0x7f, 0xe6, 0x90, 0x55, 0x3a, 0x8b, 0x7f, 0xd8, 0x3b, 
+  0x60, 0xf6, 0x2a, 0x9e, 0xad, 0xfc, 0xd5, 0x8e, 0x43, 0x81, 0x18, 0xdd, 0xa9, 0xba, 0x8c, 0x56, 
+  0x46, 0x7d, 0x53, 0x81, 0xf2, 0x56, 0xe1, 0x56, 0xfc, 0xc0, 0xbc, 0xfc, 0x95, 0x39, 0xe9, 0x8c, 
+  0x39, 0x42, 0xd7, 0x00, 0x9a, 0xab, 0x08, 0xf3, 0x2d, 0x9b, 0x84, 0xe6, 0x01, 0x45, 0xec, 0xcc, 
+  0x6c, 0x6f, 0xdb, 0x31, 0xee, 0x05, 0xeb, 0x82, 0x74, 0x1e, 0x2c, 0x44, 0x90, 0x57, 0x1e, 0x78, 
+  0xab, 0x9f, 0xaf, 0x8e, 0xc4, 0xd5, 0xc8, 0x59, 0x5c, 0x75, 0x9b, 0xb1, 0xe9, 0xa1, 0xd1, 0x90, 
+  0x6b, 0x02, 0xc6, 0x70, 0xd7, 0x46, 0x4e, 0x87, 0xa6, 0xce, 0x6b, 0x7c, 0x8a, 0xa7, 0x24, 0x41, 
+  0x67, 0xa7, 0xe4, 0x55, 0x3b, 0xbe, 0xbb, 0x4f, 0x6f, 0x03, 0xfe, 0xff, 0xdd, 0x87, 0x77, 0x53, 
+  0x87, 0xca, 0xe1, 0x87, 0x76, 0x2e, 0xa0, 0x51, 0x6d, 0x21, 0x1c, 0x57, 0xdb, 0x54, 0x86, 0x26, 
+  0xf9, 0xaf, 0x0c, 0x8d, 0x06, 0x1e, 0x34, 0x07, 0x5e, 0xa6, 0xec, 0xc0, 0x8c, 0xaa, 0x51, 0xeb, 
+  0x47, 0xa5, 0x34, 0xfe, 0xa7, 0xc6, 0xb0, 0x83, 0x1e, 0xbb, 0x5a, 0x20, 0x45, 0x25, 0x23, 0x37, 
+  0x57, 0x82, 0x16, 0x95, 0x57, 0xe5, 0x55, 0x97, 0xd6, 0xb6, 0xe8, 0xd0, 0x67, 0xb3, 0xff, 0xd6, 
+  0x16, 0x1b, 0x22, 0x94, 0xa5, 0x9a, 0xa6, 0x57, 0xfa, 0xeb, 0xc0, 0x80, 0x18, 0xd3, 0x69, 0xbc, 
+  0x6f, 0x61, 0x9c, 0x01, 0x66, 0x7c, 0x94, 0x04, 0x47, 0x80, 0x0c, 0x85, 0x32, 0x5d, 0xf2, 0x89, 
+  0x98, 0x03, 0x7f, 0xf7, 0x5f, 0x3b, 0x3b, 0xbb, 0x92, 0x6a, 0x05, 0x80, 0x7b, 0xd2, 0x3f, 0x9d, 
+  0x53, 0x8b, 0xa5, 0xc3, 0xaa, 0xf8, 0x35, 0xd2, 0xdc, 0x14, 0x09, 0x09, 0x5f, 0xf3, 0xc4, 0xdf, 
+  0xdd, 0xf1, 0x3f, 0x5c, 0x06, 0xbb, 0x27, 0xdd, 0x60, 0x32, 0x30, 0x16, 0xbe, 0xbb, 0xb8, 0x30, 
+  0xa2, 0xd1, 0xc6, 0xcc, 0xa6, 0x6e, 0x7f, 0x92, 0x4c, 0x47, 0x7e, 0xf5, 0x3b, 0x2a, 0x03, 0x51, 
+  0x70, 0x54, 0xb7, 0xfa, 0xb8, 0x4c, 0x57, 0x2f, 0x63, 0x04, 0x8c, 0xb2, 0x93, 0x53, 0x55, 0x78, 
+  0xe0, 0x5d, 0x7c, 0xf1, 0x58, 0x9b, 0x2a, 0x9b, 0x71, 0xb5, 0x9e, 0x11, 0x5f, 0xdd, 0xa5, 0x0c, 
+  0x03, 0x11, 0xcf, 0xb7, 0xe6, 0xbf, 0xf6, 0x83, 0x36, 0x9e, 0x80, 0xa4, 0x67, 0x86, 0xd7, 0x78, 
+  0xdc, 0x93, 0x76, 0xed, 0x8a, 0xe5, 0x4c, 0x16, 0x1c, 0xc7, 0x63, 0xdb, 0x72, 0xd4, 0x4b, 0x52, 
+  0xd8, 0xeb, 0x54, 0x70, 0xd3, 0x9b, 0x58, 0x6f, 0x06, 0x45, 0x35, 0xcb, 0xda, 0xb9, 0x51, 0x63, 
+  0xff, 0xaf, 0x69, 0xab, 0xed, 0x60, 0x70, 0x9c, 0xeb, 0xff, 0xba, 0x56, 0xe5, 0xc1, 0xac, 0xd2, 
+  0xaa, 0x68, 0x4d, 0x06, 0xbf, 0x88, 0x16, 0xb5, 0xf3, 0x16, 0x1a, 0xe7, 0x4b, 0x89, 0x09, 0xcb, 
+  0xe2, 0xcf, 0xe9, 0x09, 0x64, 0x5e, 0x0d, 0x8a, 0xa2, 0x16, 0x70, 0xd1, 0x50, 0x9f, 0x55, 0xd2, 
+  0x4c, 0xd4, 0x90, 0x18, 0x77, 0x48, 0x16, 0xb2, 0x1e, 0x2f, 0xf3, 0x98, 0x16, 0xe2, 0x64, 0x7f, 
+  0x8a, 0x2c, 0x07, 0x91, 0xdb, 0xd2, 0x70, 0xbd, 0x4a, 0x8a, 0x07, 0x27, 0xd0, 0x50, 0xfa, 0xc7, 
+  0x78, 0x82, 0xe5, 0x19, 0xf3, 0xdb, 0xf8, 0xd7, 0x10, 0x72, 0x14, 0xeb, 0xde, 0xb9, 0xa5, 0x67, 
+  0x74, 0xbe, 0x36, 0x1f, 0xc1, 0x28, 0x45, 0x6b, 0xe9, 0x73, 0x44, 0x02, 0x96, 0xc6, 0x1f, 0xdc, 
+  0x7d, 0xb4, 0x38, 0x49, 0xfe, 0x6f, 0x6f, 0xd7, 0xda, 0xdc, 0xb6, 0x91, 0x6c, 0xbf, 0xef, 0xaf, 
+  0xa0, 0xb8, 0x2e, 0x19, 0x08, 0xc7, 0xb4, 0x9d, 0x64, 0xab, 0x76, 0x41, 0x61, 0x59, 0x7e, 0xc6, 
+  0x8e, 0xe3, 0xd8, 0x15, 0x29, 0xeb, 0x38, 0x34, 0x57, 0x05, 0x91, 0xa0, 0x04, 0x8b, 0x02, 0x64, 
+  0x00, 0x94, 0xa5, 0x48, 0xdc, 0xdf, 0x7e, 0xfb, 0x74, 0xcf, 0x0c, 0x06, 0x0f, 0x52, 0x76, 0x76, 
+  0xeb, 0x56, 0x25, 0x32, 0x88, 0x19, 0xcc, 0x7b, 0x7a, 0x7a, 0xfa, 0x71, 0xfa, 0xc3, 0x7d, 0x6f, 
+  0xf2, 0xef, 0xde, 0x74, 0xe0, 0xdf, 0xb9, 0xcf, 0x39, 0x9c, 0xe4, 0x27, 0xb4, 0x40, 0xce, 0xaa, 
+  0x0c, 0xf7, 0xb9, 0x80, 0xb9, 0x5b, 0xc0, 0xbf, 0xa4, 0x6c, 0x9b, 0xa5, 0xb7, 0x1f, 0x2d, 0xa2, 
+  0x3c, 0x91, 0x92, 0xbc, 0x73, 0x37, 0xeb, 0xf3, 0x24, 0x27, 0xd6, 0xe9, 0xd2, 0x2d, 0x0d, 0x79, 
+  0x4e, 0x04, 0xca, 0xbc, 0x56, 0xef, 0xeb, 0xfd, 0x97, 0xcf, 0x7a, 0xcd, 0x6c, 0x4e, 0x7a, 0x7e, 
+  0x11, 0x20, 0xd5, 0xd7, 0xc9, 0x00, 0xd8, 0xf9, 0xfb, 0x5e, 0x48, 0x84, 0xef, 0x64, 0xef, 0xe1, 
+  0x03, 0xbf, 0x52, 0xa0, 0xc8, 0xc9, 0x94, 0x38, 0xcf, 0x59, 0xd8, 0x1d, 0xaa, 0xb3, 0x2e, 0xd1, 
+  0x1d, 0xc1, 0xa4, 0x4a, 0x28, 0x9d, 0x81, 0x97, 0x4c, 0x98, 0xbe, 0x30, 0x5b, 0x77, 0x1c, 0x76, 
+  0x89, 0x38, 0x1b, 0xa2, 0xc6, 0x51, 0xf5, 0x31, 0x04, 0x59, 0x3a, 0x86, 0xa1, 0x09, 0xb9, 0x94, 
+  0x5b, 0xad, 0x37, 0x1f, 0x76, 0x42, 0x2d, 0xa9, 0x40, 0x73, 0xea, 0x65, 0xbe, 0xa4, 0x1a, 0x28, 
+  0x7c, 0x60, 0x0f, 0x30, 0x2a, 0x01, 0x2f, 0xbc, 0x97, 0xe9, 0xf9, 0xaa, 0xb5, 0xcc, 0xc5, 0x7f, 
+  0xb6, 0x26, 0xfe, 0x36, 0xeb, 0xf7, 0x85, 0xd1, 0xe9, 0xd5, 0xfc, 0x17, 0xe0, 0x91, 0x0b, 0x4f, 
+  0x05, 0x89, 0x47, 0x1f, 0x35, 0xa3, 0xf6, 0x66, 0xea, 0x7b, 0xbf, 0x76, 0x47, 0x23, 0xb6, 0xc7, 
+  0x8d, 0xfd, 0x1b, 0xc1, 0xc4, 0x04, 0x01, 0x33, 0x75, 0x28, 0x6c, 0x5d, 0xd0, 0x08, 0x1c, 0x74, 
+  0xcc, 0xac, 0x6a, 0x6c, 0x0e, 0x54, 0x3e, 0xb2, 0x55, 0xdf, 0x36, 0x1d, 0x0a, 0x62, 0xdf, 0x20, 
+  0x0b, 0x80, 0x4b, 0xd6, 0x6d, 0x98, 0x85, 0xff, 0xd0, 0xc0, 0xf6, 0xe3, 0x24, 0xc8, 0xe8, 0x0e, 
+  0x43, 0x0c, 0x37, 0x83, 0xe5, 0xf4, 0x4f, 0xe3, 0x2b, 0x86, 0x25, 0xc6, 0xc8, 0x28, 0x9a, 0xe4, 
+  0x87, 0xfc, 0xd6, 0x60, 0x3e, 0xb7, 0x78, 0x05, 0x9a, 0x5a, 0xba, 0x37, 0x68, 0x76, 0x8c, 0x7d, 
+  0x06, 0x4d, 0x56, 0x9c, 0x80, 0x37, 0x37, 0xec, 0x53, 0xe2, 0xab, 0xbf, 0x87, 0x58, 0x33, 0x9e, 
+  0x94, 0xbf, 0x3a, 0xe7, 0xc2, 0xe5, 0xc7, 0x9c, 0xe6, 0x52, 0x66, 0xe1, 0x98, 0x32, 0x00, 0x9e, 
+  0x6f, 0xc6, 0x49, 0xf3, 0x3c, 0x3a, 0x66, 0xa0, 0x46, 0x5a, 0x0e, 0xca, 0xdb, 0x21, 0xa6, 0xeb, 
+  0x1f, 0xb4, 0xee, 0x18, 0x53, 0xa7, 0x9f, 0x48, 0xd7, 0x28, 0xe3, 0x7c, 0xef, 0x6f, 0x74, 0x3c, 
+  0x5b, 0xcf, 0xab, 0xd0, 0x5c, 0xe9, 0x53, 0x7f, 0xec, 0xb9, 0xe5, 0x27, 0x5c, 0xe6, 0x79, 0x54, 
+  0xc0, 0xdf, 0x43, 0x7e, 0xcc, 0x50, 0x04, 0xac, 0x7b, 0x16, 0xd4, 0xc9, 0x71, 0x3d, 0x73, 0x70, 
+  0xbe, 0xf7, 0x3d, 0x17, 0xf0, 0xf4, 0xcd, 0xeb, 0x47, 0xab, 0x32, 0x73, 0xbc, 0xb5, 0x6d, 0xe3, 
+  0xe6, 0xd4, 0xcf, 0xea, 0xb7, 0x3c, 0xfb, 0xc1, 0x85, 0xcb, 0x2d, 0xc0, 0x39, 0x85, 0xbd, 0x29, 
+  0xdb, 0x4d, 0xa9, 0x96, 0x1f, 0x7e, 0x89, 0x2e, 0x20, 0xab, 0xeb, 0xf2, 0xad, 0xb1, 0x88, 0x39, 
+  0x78, 0xf3, 0xba, 0xea, 0xb9, 0x11, 0x47, 0xa0, 0xd0, 0x27, 0x32, 0x74, 0xf7, 0xc5, 0xb8, 0xb1, 
+  0xc4, 0x62, 0x5a, 0x62, 0x81, 0x9e, 0x7c, 0x4d, 0xff, 0x97, 0x20, 0xaa, 0xa9, 0x09, 0x3e, 0xc0, 
+  0x4b, 0xa0, 0x5a, 0x20, 0x8e, 0x34, 0xc6, 0x38, 0x35, 0x33, 0xb3, 0x51, 0xed, 0x09, 0xcd, 0x66, 
+  0xe0, 0x45, 0x22, 0x9b, 0xa4, 0x82, 0x4e, 0x6b, 0xc3, 0xff, 0x7a, 0xf5, 0x25, 0x09, 0x8b, 0x61, 
+  0xe1, 0x63, 0x2b, 0x4b, 0x88, 0x0e, 0xa1, 0xb8, 0x18, 0x73, 0x7b, 0xd6, 0xf6, 0xa5, 0x7f, 0x9a, 
+  0x1d, 0xca, 0x07, 0x87, 0xfd, 0x41, 0x6f, 0x30, 0x68, 0x98, 0x52, 0x7c, 0x9a, 0x8f, 0xb4, 0xd9, 
+  0x0e, 0x7b, 0xd4, 0xe8, 0x83, 0xaa, 0x96, 0x41, 0x9b, 0xe5, 0x42, 0xe9, 0x70, 0xbc, 0x45, 0x0a, 
+  0xcf, 0xf2, 0xd1, 0xca, 0x29, 0x9c, 0xef, 0x95, 0x30, 0xd9, 0xa3, 0x61, 0xcb, 0xd8, 0x2c, 0x2f, 
+  0xad, 0xcc, 0xf8, 0x5a, 0x06, 0x7a, 0xdd, 0xf6, 0x7c, 0x6c, 0x35, 0xb1, 0xc1, 0xe8, 0x32, 0xfb, 
+  0x53, 0x22, 0x7e, 0xe9, 0x84, 0x9e, 0x07, 0x99, 0xc6, 0xaf, 0xbf, 0x05, 0x88, 0x41, 0xbd, 0xd9, 
+  0x34, 0x74, 0x6c, 0xea, 0xcd, 0x15, 0x86, 0x99, 0xa0, 0xb5, 0x71, 0xc8, 0x58, 0x6d, 0x3d, 0xb3, 
+  0x63, 0x17, 0xb4, 0x36, 0x9e, 0x31, 0x2f, 0xcc, 0x3a, 0x9d, 0x58, 0x19, 0x0c, 0x51, 0x39, 0xf7, 
+  0xa6, 0xc6, 0x9a, 0x27, 0xdc, 0x15, 0x0b, 0xbd, 0xcc, 0x80, 0xb4, 0x89, 0x30, 0xcd, 0x2d, 0x2d, 
+  0x7e, 0xc4, 0x96, 0x84, 0x80, 0xa0, 0x34, 0xc2, 0x41, 0x98, 0x54, 0x6a, 0x9d, 0xf4, 0x05, 0x73, 
+  0x9f, 0x23, 0x83, 0x87, 0xe6, 0xb0, 0x04, 0x52, 0x24, 0x17, 0x3f, 0x72, 0x6f, 0x2f, 0xfa, 0xc2, 
+  0x0c, 0x06, 0xaa, 0xba, 0x71, 0x68, 0x93, 0x2d, 0x10, 0xfa, 0x1d, 0x7d, 0x24, 0x72, 0x47, 0x79, 
+  0xa6, 0x4c, 0x9f, 0xe8, 0x77, 0xb6, 0x58, 0xf4, 0xb1, 0x89, 0x23, 0x22, 0x01, 0xc6, 0x74, 0xf2, 
+  0xe6, 0x26, 0x85, 0x9a, 0xf4, 0x0c, 0xa6, 0x1f, 0x3a, 0x19, 0x3f, 0x1b, 0x79, 0xe0, 0xcc, 0xa1, 
+  0xe3, 0x12, 0xa9, 0x26, 0xf1, 0x34, 0x27, 0x14, 0x9f, 0x47, 0x1b, 0x09, 0xab, 0x7f, 0x0d, 0x56, 
+  0x7e, 0xed, 0x1c, 0x5d, 0x5a, 0xa5, 0x55, 0xcf, 0xf1, 0xd0, 0xcd, 0x21, 0x64, 0xc4, 0xcd, 0xb0, 
+  0xbb, 0xbb, 0xf4, 0x18, 0x81, 0x4c, 0xee, 0x29, 0x65, 0xc7, 0x45, 0x64, 0xc9, 0x9b, 0xe6, 0x80, 
+  0x91, 0x3f, 0x78, 0xf9, 0xf0, 0x32, 0x2f, 0xeb, 0x83, 0x6b, 0x86, 0x51, 0x35, 0xe8, 0xca, 0x52, 
+  0x01, 0x19, 0xb5, 0x0a, 0x4b, 0x09, 0xab, 0xbd, 0xbf, 0xf9, 0x55, 0x93, 0xf4, 0xd5, 0x65, 0xc6, 
+  0x91, 0x76, 0x17, 0xc9, 0x32, 0xee, 0x1b, 0xa2, 0x38, 0xde, 0x60, 0xb2, 0x64, 0x89, 0x9c, 0xc8, 
+  0x9f, 0x8c, 0x44, 0x8a, 0x43, 0xba, 0xc4, 0x63, 0x43, 0xaf, 0xfa, 0xfd, 0x40, 0x44, 0x05, 0x4b, 
+  0x7f, 0x1d, 0x6c, 0x29, 0xc9, 0x5d, 0x01, 0x9a, 0x72, 0xae, 0x88, 0x1c, 0x73, 0x9c, 0xcb, 0x46, 
+  0x57, 0x66, 0xd4, 0x95, 0x80, 0x3d, 0x67, 0x1c, 0xd2, 0x6a, 0x2e, 0x9b, 0x30, 0x23, 0x1f, 0x7b, 
+  0xe5, 0x46, 0xa9, 0xa0, 0x11, 0x80, 0x48, 0x8f, 0x55, 0x29, 0x0d, 0x37, 0x55, 0xc3, 0x66, 0x54, 
+  0x1a, 0x0b, 0x53, 0x1f, 0x93, 0x51, 0x20, 0x1b, 0x32, 0xaa, 0xd8, 0x25, 0xb5, 0x1a, 0xce, 0x3d, 
+  0x86, 0x75, 0xd0, 0xb5, 0x6b, 0x49, 0x85, 0x68, 0xf4, 0x6d, 0xce, 0xd9, 0xbf, 0xae, 0x88, 0xb3, 
+  0x0c, 0x8d, 0x21, 0x08, 0x09, 0xfc, 0xdf, 0xbf, 0xd4, 0x6e, 0x88, 0xee, 0xbc, 0x44, 0xb1, 0x52, 
+  0x0e, 0x80, 0xac, 0xaf, 0x66, 0x70, 0x3f, 0x58, 0x46, 0x57, 0xb8, 0xff, 0xee, 0x00, 0x2d, 0xba, 
+  0xf6, 0x16, 0x13, 0x00, 0x41, 0x6c, 0x2e, 0x51, 0x73, 0xea, 0x49, 0x5c, 0x90, 0xb9, 0x27, 0x9c, 
+  0x24, 0xf3, 0x79, 0x9c, 0x6e, 0x31, 0x1f, 0xd2, 0x0d, 0xfd, 0x4a, 0xfb, 0x21, 0x36, 0x7f, 0xbb, 
+  0x5d, 0x8f, 0x6a, 0x4d, 0x8d, 0xd8, 0xc2, 0xc2, 0x8d, 0xe8, 0xde, 0x16, 0x77, 0x54, 0xf1, 0x8b, 
+  0x63, 0x5d, 0x3c, 0x04, 0xb3, 0xb0, 0x7c, 0xab, 0xec, 0x26, 0x66, 0x35, 0xe8, 0x67, 0x79, 0xe3, 
+  0xa2, 0xd6, 0xb0, 0x10, 0xd0, 0x18, 0xc5, 0xef, 0x67, 0xab, 0x7c, 0x16, 0xd7, 0x61, 0x67, 0x9c, 
+  0x6b, 0xe0, 0x1b, 0xba, 0x2d, 0xe4, 0xc9, 0x3c, 0xee, 0x75, 0x7d, 0xd5, 0xf7, 0x5b, 0x85, 0x6f, 
+  0xd7, 0xf7, 0xdd, 0x5e, 0xcd, 0xf6, 0xef, 0x3b, 0x2a, 0x3c, 0x8b, 0x4e, 0xe3, 0x4d, 0x7d, 0xa9, 
+  0xa4, 0x31, 0x4d, 0xe7, 0x0f, 0x0b, 0xd0, 0xcc, 0x71, 0x58, 0x2e, 0x63, 0xbf, 0xe9, 0xb8, 0x29, 
+  0xae, 0x6f, 0x4d, 0xd7, 0x0f, 0xd7, 0x7d, 0xd3, 0x6a, 0x6e, 0x2b, 0xff, 0xcd, 0xb8, 0x81, 0xe6, 
+  0xf4, 0x78, 0xf8, 0x14, 0xa1, 0x9d, 0xc5, 0x7f, 0x2d, 0x76, 0x00, 0x45, 0x6a, 0xd1, 0x5d, 0xfd, 
+  0xc6, 0x37, 0x09, 0x87, 0x60, 0xe8, 0xf4, 0x01, 0xb1, 0x75, 0x1a, 0x77, 0xd0, 0xd8, 0xbf, 0x65, 
+  0x7a, 0xc3, 0x4d, 0xb0, 0x3c, 0x3a, 0x78, 0x79, 0xc7, 0xf8, 0x09, 0x42, 0x2f, 0x27, 0x76, 0x4d, 
+  0xba, 0x2d, 0xa8, 0x55, 0x73, 0x52, 0x98, 0x9c, 0x12, 0x2b, 0xa4, 0x8c, 0xd3, 0xce, 0x60, 0x88, 
+  0x62, 0x8a, 0xcd, 0xb7, 0x2c, 0x50, 0xa7, 0xfa, 0x47, 0x6c, 0xf9, 0xb1, 0xb9, 0x65, 0xa5, 0xcf, 
+  0x46, 0x5b, 0x08, 0x0a, 0x69, 0x2b, 0xe9, 0x77, 0x0d, 0x02, 0xbb, 0x9b, 0x6d, 0x18, 0x05, 0x98, 
+  0x39, 0x96, 0xf0, 0x0a, 0xdc, 0x5c, 0x4f, 0xea, 0x4b, 0x24, 0x12, 0x36, 0xff, 0x97, 0x27, 0x0e, 
+  0x38, 0xd6, 0xae, 0x5c, 0x70, 0xb7, 0x25, 0x4c, 0x5f, 0xcd, 0xc2, 0xaa, 0xcf, 0x8d, 0x62, 0x87, 
+  0xcc, 0x59, 0xe8, 0x2d, 0xe2, 0xf0, 0xbe, 0xb7, 0xe7, 0x4d, 0x10, 0x81, 0x6a, 0xf0, 0x61, 0xfe, 
+  0x8d, 0xaf, 0x83, 0x95, 0x8c, 0x77, 0x2c, 0xc6, 0xf6, 0x87, 0xe2, 0x9b, 0x90, 0xfe, 0xf7, 0x27, 
+  0x12, 0xc8, 0xe9, 0xc3, 0xbd, 0x29, 0x25, 0x07, 0x21, 0x32, 0xf6, 0x39, 0x18, 0x15, 0x62, 0x51, 
+  0x7d, 0xb8, 0x4b, 0x8f, 0x77, 0xe9, 0xf1, 0xee, 0xcd, 0xe4, 0xdf, 0xff, 0x9c, 0x7e, 0xe3, 0xfb, 
+  0x63, 0xff, 0x1b, 0x2a, 0xc8, 0x6f, 0x16, 0xe3, 0x4d, 0xfa, 0x77, 0xa7, 0xbe, 0x0e, 0x86, 0xf2, 
+  0xcd, 0xd8, 0xff, 0xf0, 0xdd, 0xfd, 0xe3, 0x44, 0xcd, 0xa9, 0x19, 0x6e, 0x58, 0x95, 0x0f, 0x47, 
+  0x9c, 0xd5, 0x66, 0x32, 0x61, 0x51, 0xee, 0x1f, 0xab, 0xeb, 0xcf, 0xf3, 0x16, 0x8f, 0x5c, 0x76, 
+  0x4d, 0x32, 0x0f, 0x17, 0x4d, 0x5a, 0x73, 0xd4, 0x1b, 0xf1, 0x20, 0x2b, 0xcc, 0xf2, 0xd9, 0xf0, 
+  0xd5, 0x5c, 0xc3, 0x6e, 0xc0, 0x29, 0xe1, 0x55, 0xad, 0x9e, 0xcc, 0xd1, 0x0e, 0x1a, 0xf9, 0xda, 
+  0xa2, 0x89, 0x06, 0x54, 0xa3, 0x9f, 0xc7, 0xc0, 0x40, 0xc5, 0xcb, 0x8c, 0x48, 0xaf, 0xfd, 0x66, 
+  0x1e, 0x77, 0x4b, 0xe3, 0x8e, 0xa1, 0x50, 0x36, 0x31, 0x69, 0x7a, 0xa7, 0x59, 0x4f, 0xc7, 0xa4, 
+  0x51, 0xfd, 0xbf, 0xea, 0xb0, 0x0f, 0x7d, 0x2e, 0x68, 0xad, 0xdc, 0x40, 0x1c, 0x75, 0x7a, 0x1d, 
+  0x11, 0x3b, 0xe6, 0x18, 0x8c, 0xd7, 0xae, 0xfd, 0x6e, 0x6c, 0x0a, 0x86, 0xb9, 0xc6, 0x3e, 0x67, 
+  0xce, 0xbe, 0x66, 0x20, 0x01, 0x58, 0x4f, 0x88, 0x14, 0xf8, 0x0c, 0xcd, 0x45, 0x9c, 0x6c, 0x22, 
+  0x12, 0x39, 0xa6, 0x1b, 0xec, 0xf0, 0x3b, 0x1b, 0x2e, 0xe7, 0x0d, 0x67, 0xde, 0xc7, 0x82, 0xac, 
+  0x42, 0x14, 0xa6, 0x29, 0x43, 0xe2, 0x35, 0xfd, 0x34, 0x6c, 0xbb, 0xf2, 0x4a, 0xc2, 0x51, 0x68, 
+  0x60, 0x42, 0xb0, 0x09, 0xc7, 0x0f, 0x83, 0xda, 0xc5, 0xb4, 0x1c, 0x7f, 0x1b, 0x54, 0xe8, 0x1f, 
+  0xcc, 0x66, 0x58, 0x8c, 0x0f, 0x0b, 0xb9, 0x61, 0x30, 0x3f, 0x2c, 0xf0, 0xce, 0x77, 0xc1, 0xf7, 
+  0x6b, 0xdd, 0x1a, 0x67, 0x0f, 0xd6, 0x31, 0xf6, 0xcc, 0x01, 0x66, 0xf7, 0xfe, 0xd3, 0xa3, 0xb1, 
+  0xf0, 0xb2, 0xc1, 0xb7, 0xee, 0x2b, 0x61, 0x7b, 0x03, 0xe2, 0xf0, 0xd3, 0x38, 0x87, 0x47, 0x71, 
+  0x7f, 0xb4, 0x21, 0x82, 0xa9, 0x91, 0xae, 0xf2, 0x97, 0x10, 0xa2, 0x6a, 0x9b, 0x78, 0x93, 0x6f, 
+  0xf2, 0x60, 0x3a, 0x72, 0x8a, 0x01, 0x67, 0xa6, 0x6d, 0xa2, 0xe4, 0x13, 0xb8, 0x58, 0xd8, 0x8f, 
+  0xc3, 0x72, 0x3d, 0xaa, 0xc6, 0x8b, 0x85, 0x43, 0x83, 0xfe, 0x21, 0xfc, 0xc0, 0xeb, 0x9d, 0x62, 
+  0x58, 0xc5, 0xc6, 0x88, 0xb3, 0x6d, 0xec, 0x86, 0xd6, 0x39, 0x32, 0x23, 0x5d, 0x29, 0x4e, 0x89, 
+  0x4a, 0x96, 0x53, 0xbd, 0xad, 0xbc, 0x41, 0x59, 0xe0, 0x37, 0x6a, 0x88, 0xad, 0x5a, 0x2d, 0x49, 
+  0xd9, 0x9b, 0xad, 0x8d, 0xcd, 0xca, 0x05, 0x6e, 0x1a, 0xb3, 0x6b, 0xb7, 0x8f, 0x82, 0xf1, 0x95, 
+  0xb3, 0x68, 0x5d, 0xc1, 0x56, 0xf1, 0xe3, 0x11, 0x71, 0x93, 0xdf, 0x39, 0xb3, 0x61, 0xe7, 0x3a, 
+  0xf8, 0xde, 0x7d, 0x1b, 0x5c, 0x39, 0x27, 0x1d, 0x20, 0xe9, 0x86, 0x27, 0x73, 0xbe, 0xe2, 0x73, 
+  0x0e, 0x4d, 0x36, 0x19, 0x2d, 0x11, 0x15, 0xfd, 0x34, 0xe7, 0x70, 0x3c, 0x35, 0x71, 0x98, 0x3e, 
+  0x5f, 0xc4, 0x89, 0xaa, 0x5f, 0x17, 0x6e, 0xe5, 0xea, 0xfa, 0xe3, 0x51, 0x90, 0xaa, 0x93, 0x39, 
+  0x9b, 0x19, 0x21, 0xa8, 0x68, 0x3b, 0xd9, 0x9d, 0x65, 0x89, 0x1e, 0x8b, 0x83, 0x33, 0xac, 0x03, 
+  0xac, 0xc8, 0x46, 0x30, 0x89, 0x4e, 0x94, 0x58, 0x7b, 0x3c, 0xb7, 0x92, 0x86, 0x4e, 0xfc, 0xd8, 
+  0x50, 0x12, 0xdb, 0x79, 0x9a, 0x2b, 0x7b, 0xdb, 0x60, 0xbb, 0x80, 0x6a, 0x7a, 0xb2, 0x65, 0xc4, 
+  0x2b, 0x3e, 0xee, 0xe3, 0x4c, 0x03, 0xce, 0xd1, 0xe3, 0x11, 0xf3, 0xaa, 0xf4, 0x06, 0xcf, 0x43, 
+  0xbb, 0x7a, 0x71, 0xf4, 0x7c, 0x9c, 0xad, 0x5b, 0xeb, 0x06, 0x83, 0x31, 0xeb, 0x18, 0x0c, 0xe7, 
+  0x30, 0x92, 0x23, 0x8d, 0x09, 0xc9, 0x63, 0xbf, 0x33, 0x69, 0x38, 0xcf, 0xce, 0x8c, 0x75, 0xab, 
+  0xec, 0xe2, 0x0d, 0xf9, 0x22, 0x62, 0x9a, 0xaf, 0xce, 0xb2, 0x55, 0x51, 0xc1, 0x92, 0xc8, 0xd8, 
+  0xf8, 0x0d, 0xb0, 0x01, 0x37, 0xde, 0x80, 0x63, 0xca, 0xc1, 0x26, 0x28, 0x65, 0x0b, 0x5e, 0xbe, 
+  0x64, 0x64, 0x6a, 0x2f, 0x27, 0x9a, 0x05, 0xb1, 0xcf, 0xc8, 0x67, 0x0d, 0x50, 0x07, 0x0a, 0xbd, 
+  0x23, 0x7f, 0x9c, 0x5b, 0xe6, 0x2e, 0xae, 0x0d, 0x77, 0x12, 0xc6, 0x50, 0x6a, 0x23, 0x1c, 0x78, 
+  0x5c, 0x85, 0x83, 0x87, 0xda, 0xc1, 0x09, 0xea, 0xa4, 0xba, 0x80, 0xd4, 0xdb, 0xa0, 0xfa, 0x62, 
+  0xdd, 0x97, 0xb3, 0xd3, 0x64, 0x37, 0xad, 0x87, 0x2e, 0x22, 0xa1, 0xf1, 0xa8, 0xe2, 0x63, 0x59, 
+  0x50, 0x75, 0xec, 0x10, 0x0e, 0x6e, 0xc4, 0x74, 0xde, 0x4b, 0xc2, 0x9c, 0xda, 0x45, 0x87, 0xa4, 
+  0xa8, 0xb7, 0x33, 0x16, 0xd2, 0xe4, 0x93, 0xbc, 0x6a, 0x23, 0xdd, 0xd9, 0x7d, 0xd1, 0xa0, 0x59, 
+  0xc3, 0xa3, 0x9d, 0xc4, 0x84, 0x47, 0x4c, 0xf8, 0x6e, 0x17, 0x8b, 0x8e, 0x32, 0x41, 0xb0, 0x3b, 
+  0xfd, 0xa8, 0x34, 0xbe, 0xf4, 0xaf, 0x91, 0x30, 0x2d, 0xeb, 0x66, 0x73, 0x05, 0xdd, 0x6e, 0x33, 
+  0x6a, 0x1a, 0xae, 0x7d, 0xab, 0x19, 0x4b, 0x75, 0x00, 0x18, 0xf0, 0x27, 0xbe, 0xa6, 0xc3, 0xf0, 
+  0x08, 0xd3, 0x81, 0x70, 0x63, 0xeb, 0x5a, 0x6b, 0xd6, 0x35, 0x50, 0x26, 0xe7, 0x5c, 0xb7, 0x27, 
+  0x47, 0x1c, 0x54, 0x06, 0x49, 0x63, 0xcc, 0x9c, 0x84, 0x3e, 0x72, 0x23, 0x3a, 0x54, 0xc7, 0x3d, 
+  0x07, 0x84, 0xd7, 0x46, 0x2a, 0x59, 0x08, 0xb0, 0xe9, 0x15, 0x07, 0x03, 0x4c, 0x05, 0xdb, 0xa1, 
+  0x46, 0x60, 0x58, 0xb4, 0x53, 0xe7, 0xc7, 0x6e, 0x6e, 0x66, 0x1a, 0xce, 0x62, 0x36, 0xfc, 0x3c, 
+  0xa7, 0x53, 0x37, 0xc2, 0xe0, 0x35, 0x3d, 0x06, 0x88, 0x68, 0x45, 0x0d, 0xbe, 0xd7, 0x33, 0xe6, 
+  0x67, 0xbe, 0xa3, 0x5b, 0xaf, 0xb4, 0xab, 0x2d, 0x9f, 0x03, 0x36, 0x87, 0xe8, 0x86, 0xd3, 0x3b, 
+  0x68, 0x98, 0x7b, 0xb2, 0x1a, 0xcd, 0x04, 0x90, 0xa0, 0xff, 0xe0, 0xb3, 0x05, 0xfc, 0x6a, 0x03, 
+  0x8e, 0x07, 0xd5, 0xaf, 0xc6, 0xfa, 0xca, 0x38, 0x94, 0x86, 0x46, 0xfa, 0xd2, 0x4c, 0x8e, 0x0d, 
+  0xfc, 0x13, 0x68, 0xe7, 0x50, 0x46, 0xd1, 0xcb, 0x60, 0x54, 0xeb, 0xc4, 0xb5, 0xd5, 0x99, 0x19, 
+  0xcb, 0x2d, 0xd0, 0xd6, 0x6f, 0x9d, 0x19, 0x93, 0xe3, 0x34, 0xcb, 0xe3, 0x03, 0x22, 0x27, 0x71, 
+  0x29, 0xb9, 0xeb, 0xe1, 0x61, 0x3b, 0xef, 0x24, 0x32, 0x56, 0x70, 0xf6, 0xd6, 0xd0, 0x33, 0x06, 
+  0x46, 0x01, 0xe6, 0x21, 0xac, 0xec, 0x50, 0x89, 0xeb, 0xd9, 0x60, 0x2d, 0xee, 0x6a, 0xee, 0x0e, 
+  0x62, 0x90, 0x42, 0xb9, 0x27, 0xf4, 0x1e, 0xa1, 0x5e, 0x58, 0x27, 0xd8, 0x9f, 0x4e, 0x69, 0x86, 
+  0x9a, 0x9d, 0x0d, 0x45, 0x19, 0xc3, 0x0e, 0xae, 0xb1, 0x75, 0x70, 0x4d, 0x1b, 0x81, 0x39, 0x94, 
+  0x1b, 0xf2, 0x83, 0xc3, 0x47, 0x12, 0xd7, 0x15, 0x74, 0xc2, 0x47, 0xb2, 0x89, 0x21, 0x80, 0x27, 
+  0x58, 0x66, 0x47, 0x27, 0x6d, 0xdc, 0x0a, 0xa1, 0x1e, 0xef, 0x88, 0x26, 0xd9, 0x6b, 0xc0, 0x5e, 
+  0xcf, 0x9a, 0x88, 0xa0, 0xf5, 0x35, 0x27, 0x13, 0x9c, 0xa4, 0x27, 0x31, 0x31, 0xc6, 0xbd, 0x45, 
+  0x9e, 0x9d, 0x71, 0x78, 0xf5, 0xfa, 0x3d, 0x01, 0xf0, 0xe2, 0x82, 0x41, 0xe8, 0x54, 0xab, 0xd7, 
+  0x1c, 0x3c, 0xb5, 0x81, 0x60, 0xe2, 0xe9, 0xc5, 0xef, 0xb7, 0x17, 0xb5, 0xdf, 0xc6, 0x53, 0xdf, 
+  0x8f, 0x11, 0xd6, 0xac, 0x69, 0x5b, 0x2c, 0xa6, 0x4a, 0x36, 0xce, 0x7b, 0x7d, 0x91, 0x4b, 0x68, 
+  0x9d, 0x28, 0x8c, 0x68, 0xec, 0x9b, 0x03, 0x6e, 0x2c, 0x2f, 0x8b, 0x70, 0xe5, 0x65, 0x8e, 0x49, 
+  0x67, 0x87, 0x01, 0x26, 0xd0, 0x7f, 0x5b, 0xc0, 0xe0, 0x79, 0x05, 0x0c, 0xae, 0x67, 0xba, 0xfa, 
+  0x73, 0xdd, 0xe1, 0x29, 0xce, 0x22, 0xc5, 0x32, 0x3c, 0x81, 0x00, 0xca, 0x00, 0x13, 0xc3, 0x40, 
+  0xed, 0x9c, 0x5d, 0x55, 0x25, 0x72, 0xac, 0xaa, 0x2d, 0x6b, 0x3a, 0x7d, 0x01, 0x56, 0x8d, 0xf6, 
+  0x85, 0x2c, 0xb3, 0x92, 0xb2, 0x3b, 0x4d, 0x34, 0x0b, 0x6d, 0x30, 0xf6, 0xcb, 0x11, 0x51, 0x78, 
+  0x80, 0x8e, 0x14, 0x10, 0x15, 0xd7, 0x0b, 0x1b, 0x17, 0xce, 0x71, 0x11, 0x14, 0x6b, 0x17, 0xd4, 
+  0xae, 0xc1, 0xfb, 0x83, 0x1b, 0x3f, 0x9a, 0xe9, 0xf9, 0x8a, 0xeb, 0xcd, 0xf2, 0xe5, 0x34, 0x7e, 
+  0x5b, 0x0b, 0xd5, 0x5e, 0x9a, 0x79, 0x6d, 0x5a, 0x28, 0x56, 0x06, 0x83, 0x33, 0x2d, 0x6e, 0x9b, 
+  0xc0, 0x5b, 0x7f, 0x45, 0xf9, 0x0b, 0x55, 0x4e, 0x2d, 0x88, 0x6f, 0xd6, 0x8a, 0xbe, 0xa2, 0xe3, 
+  0xc9, 0x80, 0xd1, 0x9a, 0xb5, 0xb6, 0x5b, 0xed, 0xa7, 0x88, 0xef, 0x67, 0x61, 0x9d, 0xcc, 0xea, 
+  0xe8, 0x2d, 0xb3, 0xb0, 0xd3, 0xcb, 0x3d, 0x56, 0xd0, 0x26, 0x2c, 0x9b, 0x3a, 0x84, 0xa4, 0xe9, 
+  0x20, 0xd5, 0x8d, 0xca, 0xc0, 0x56, 0xc4, 0xd0, 0xdd, 0xe0, 0x34, 0x9c, 0x2c, 0x07, 0x7d, 0x36, 
+  0x45, 0xea, 0xc3, 0xce, 0x61, 0x6d, 0x4d, 0x21, 0x4e, 0xd8, 0x92, 0x74, 0x66, 0xd7, 0x16, 0x66, 
+  0xba, 0x4d, 0x8e, 0xe8, 0x20, 0x98, 0x41, 0xc8, 0x65, 0x44, 0xeb, 0x20, 0x15, 0x6a, 0x11, 0xb2, 
+  0x3c, 0x21, 0x69, 0x39, 0x63, 0xe1, 0x6c, 0x32, 0xa6, 0x49, 0x5a, 0xc1, 0xf0, 0x22, 0x21, 0x92, 
+  0x6a, 0x33, 0xd0, 0x76, 0x6e, 0x7f, 0xc5, 0x2e, 0xcb, 0x37, 0x37, 0x49, 0xcd, 0xb0, 0x8f, 0x57, 
+  0xcc, 0x1b, 0x96, 0xeb, 0x6f, 0x5b, 0xfc, 0xc6, 0xf4, 0x84, 0x6d, 0x8e, 0xad, 0x89, 0x63, 0x5c, 
+  0x99, 0xcb, 0xc5, 0x21, 0x22, 0x59, 0x30, 0xb0, 0x7a, 0x6c, 0xcc, 0x1c, 0x3b, 0x2f, 0xc9, 0x5f, 
+  0x66, 0xe3, 0x48, 0x44, 0xcf, 0x73, 0xb5, 0x60, 0x19, 0x8d, 0x67, 0xea, 0x31, 0x48, 0x8f, 0x3f, 
+  0x32, 0x88, 0x3d, 0x15, 0x8e, 0x85, 0x5b, 0x4f, 0xca, 0x06, 0x9d, 0xf6, 0xe3, 0x3e, 0x9f, 0x3c, 
+  0x4f, 0xb4, 0xec, 0xbf, 0x62, 0x4d, 0x97, 0x88, 0x5f, 0xa1, 0x31, 0x70, 0xa2, 0x6e, 0x1d, 0xfa, 
+  0xc8, 0xf5, 0xec, 0xea, 0xd4, 0x8f, 0xb5, 0xfc, 0x3f, 0xbb, 0x44, 0x72, 0x29, 0x74, 0x16, 0x8c, 
+  0xc1, 0x52, 0x85, 0x21, 0xb5, 0x90, 0x61, 0x72, 0x14, 0x0a, 0x5e, 0x18, 0x87, 0x10, 0x94, 0x5b, 
+  0x35, 0x03, 0x93, 0x2b, 0x50, 0xf7, 0xb4, 0x4e, 0x85, 0xef, 0xc2, 0x7a, 0x45, 0x7f, 0xd5, 0x93, 
+  0x35, 0xe0, 0x58, 0xac, 0x50, 0x4b, 0x93, 0x54, 0xd1, 0xf9, 0x9a, 0xde, 0xcb, 0x8e, 0x8a, 0x38, 
+  0xbf, 0xe0, 0x90, 0x0b, 0x3c, 0x02, 0x43, 0x0d, 0xdf, 0x94, 0x87, 0x38, 0xc4, 0xb5, 0x65, 0x63, 
+  0x45, 0x09, 0x24, 0x8c, 0x91, 0x61, 0xe7, 0xc1, 0x94, 0xc0, 0x1a, 0x87, 0xbb, 0xf6, 0xdb, 0x91, 
+  0xd1, 0x3c, 0x08, 0x83, 0xce, 0xbe, 0xeb, 0x0c, 0xde, 0xe0, 0x8a, 0xf5, 0xa4, 0xd9, 0xc6, 0x67, 
+  0x5d, 0xe0, 0x5a, 0x1e, 0xec, 0x79, 0xe9, 0xe6, 0xd8, 0xae, 0x8d, 0xe3, 0xe5, 0x91, 0x61, 0xc1, 
+  0x2b, 0xea, 0xae, 0xe3, 0x9f, 0x5b, 0x58, 0x4a, 0x9b, 0xa0, 0xef, 0x6e, 0xbd, 0xcf, 0x11, 0xd0, 
+  0x29, 0x39, 0x38, 0x18, 0x0c, 0x7d, 0xdd, 0xf6, 0x6e, 0x68, 0xdc, 0x9f, 0xb7, 0x90, 0xa9, 0x29, 
+  0x27, 0x21, 0x9b, 0x1e, 0xa5, 0x10, 0xf6, 0x0b, 0x3a, 0x7f, 0x0b, 0x15, 0xd0, 0x9a, 0x6b, 0x65, 
+  0x08, 0x86, 0x17, 0x5e, 0xaf, 0x03, 0xa2, 0xdf, 0x25, 0x2f, 0x03, 0x05, 0x67, 0xa5, 0x84, 0x9d, 
+  0x3a, 0x2d, 0x48, 0x4f, 0x39, 0x4c, 0x16, 0x02, 0xda, 0xa1, 0x1d, 0x98, 0x6c, 0xfa, 0x4e, 0x95, 
+  0x81, 0xde, 0xc3, 0xca, 0xd8, 0xea, 0x14, 0x91, 0x67, 0x8c, 0x3e, 0xbf, 0x9d, 0x7b, 0xd9, 0xcd, 
+  0x4d, 0x8c, 0xcf, 0x4b, 0x43, 0x10, 0x78, 0x01, 0xc9, 0x81, 0x12, 0xa4, 0x63, 0x2a, 0x28, 0x51, 
+  0x8c, 0x65, 0x5b, 0x95, 0xdc, 0xad, 0x0d, 0x15, 0xcf, 0xd1, 0xeb, 0x2f, 0x75, 0x1d, 0xdd, 0x70, 
+  0xc6, 0x09, 0xdc, 0x10, 0x1d, 0x1e, 0xd2, 0x2e, 0x46, 0x37, 0x90, 0xa0, 0xb0, 0xbc, 0xfe, 0x69, 
+  0x97, 0xe5, 0xca, 0xab, 0xdf, 0xd6, 0x23, 0xbf, 0xdb, 0x4e, 0x98, 0xf6, 0x39, 0x7b, 0xf7, 0x7b, 
+  0xf5, 0xbb, 0x74, 0x44, 0x77, 0x08, 0x10, 0xb3, 0x8f, 0x11, 0x13, 0x3b, 0xf6, 0x40, 0xb8, 0x8a, 
+  0x03, 0xd7, 0xc1, 0xb2, 0x6c, 0xcb, 0x48, 0x5d, 0x4c, 0x6f, 0xcf, 0x71, 0xb9, 0xf2, 0xab, 0x80, 
+  0x45, 0xd8, 0x17, 0x3a, 0xac, 0x38, 0xe8, 0xec, 0xd9, 0xf0, 0x05, 0xeb, 0xe6, 0x18, 0x9c, 0x42, 
+  0x87, 0xa0, 0xfd, 0x42, 0x07, 0xa7, 0xa8, 0xb5, 0xa2, 0x29, 0x9d, 0x48, 0x9c, 0x0e, 0x58, 0xd3, 
+  0xf2, 0x73, 0x72, 0x6c, 0xae, 0x74, 0xc3, 0x69, 0x28, 0x3d, 0x7d, 0x63, 0x85, 0xaa, 0xac, 0x25, 
+  0x84, 0x8d, 0x0d, 0x4a, 0x71, 0x83, 0xe3, 0x61, 0x8e, 0x4b, 0xc6, 0xeb, 0xc7, 0x59, 0x37, 0xa0, 
+  0x91, 0x1c, 0xd5, 0xaa, 0x18, 0x39, 0x17, 0x4d, 0x8c, 0xb3, 0xde, 0x9b, 0x12, 0xc7, 0x14, 0x91, 
+  0x4b, 0xbd, 0x1d, 0x58, 0xec, 0xed, 0x71, 0x90, 0x08, 0xf8, 0x9b, 0x25, 0x53, 0x7f, 0x34, 0x18, 
+  0x24, 0x12, 0x96, 0x0d, 0x5e, 0x47, 0x45, 0x58, 0x4e, 0xb2, 0x29, 0xbd, 0xcb, 0x00, 0x52, 0x69, 
+  0xf4, 0x60, 0x21, 0x5d, 0x18, 0xc5, 0x96, 0xe1, 0x3a, 0x1a, 0xe2, 0xa4, 0x99, 0x87, 0x85, 0xe0, 
+  0x9f, 0xa8, 0x42, 0xff, 0x8e, 0xf4, 0x6f, 0x03, 0xdd, 0x40, 0x27, 0xe3, 0x43, 0x2c, 0x1c, 0x14, 
+  0xca, 0xec, 0xf9, 0x3a, 0x1f, 0x84, 0x99, 0x8e, 0xeb, 0xf9, 0xe6, 0x68, 0x33, 0xb6, 0x7a, 0xff, 
+  0x28, 0xcb, 0x96, 0x71, 0xe4, 0xe2, 0x33, 0x8e, 0xaf, 0xeb, 0x9e, 0x38, 0x41, 0xba, 0x0e, 0xf8, 
+  0x36, 0xa5, 0x04, 0x32, 0x0f, 0x61, 0x1f, 0xb4, 0x99, 0xb2, 0x68, 0x4a, 0xaa, 0x17, 0x63, 0xed, 
+  0xac, 0xd5, 0x8f, 0xe6, 0x20, 0x2b, 0xb4, 0x6d, 0x18, 0xa9, 0x75, 0x0e, 0xbf, 0xd0, 0xe0, 0x8c, 
+  0x23, 0x30, 0x3b, 0xef, 0x4c, 0xae, 0xd4, 0x48, 0x27, 0x56, 0x65, 0xb2, 0x2c, 0x18, 0xed, 0x88, 
+  0x88, 0x2b, 0x43, 0x55, 0xb0, 0x84, 0x02, 0x3d, 0xf0, 0xd5, 0x79, 0xec, 0x1c, 0x35, 0x27, 0x71, 
+  0xcd, 0xaa, 0x18, 0xcc, 0x51, 0xd8, 0x84, 0x62, 0x6d, 0xb8, 0xfa, 0x62, 0xf3, 0x10, 0x33, 0x73, 
+  0xfd, 0x28, 0x0a, 0x28, 0xf9, 0x88, 0x76, 0x54, 0x11, 0x79, 0x67, 0x83, 0x01, 0x55, 0xae, 0xbd, 
+  0x9f, 0x68, 0xda, 0x69, 0xef, 0x3f, 0x31, 0x3f, 0x6a, 0x9c, 0x14, 0x3e, 0x3d, 0x07, 0x78, 0xcb, 
+  0x19, 0x5d, 0x75, 0x67, 0xc3, 0xf4, 0x08, 0xe7, 0xe9, 0xee, 0xee, 0xa5, 0xfd, 0x12, 0xef, 0xb8, 
+  0x38, 0x73, 0xd7, 0x9d, 0x0d, 0xdf, 0x43, 0xa1, 0x7a, 0xd1, 0x2e, 0x6e, 0xe5, 0x19, 0x58, 0xae, 
+  0xd2, 0xc6, 0xf3, 0x46, 0x10, 0x6d, 0xd8, 0x47, 0xd9, 0x20, 0xda, 0x31, 0x07, 0xd1, 0xd6, 0xf6, 
+  0xcb, 0x93, 0x7c, 0x4a, 0xa5, 0xd5, 0xd1, 0xf1, 0x20, 0xf4, 0xe2, 0x84, 0x47, 0x11, 0x38, 0x4a, 
+  0xcb, 0x59, 0x34, 0x27, 0xa9, 0xe2, 0x30, 0xf2, 0x30, 0xb7, 0x57, 0x65, 0x0d, 0xf0, 0xa4, 0xce, 
+  0x5d, 0x49, 0x14, 0x8d, 0x31, 0x0d, 0x41, 0xb8, 0x73, 0x2e, 0x4e, 0x68, 0xc7, 0xd4, 0xa6, 0x33, 
+  0xfa, 0x9f, 0x23, 0x37, 0x5e, 0xe1, 0xcf, 0x67, 0xfc, 0xb9, 0xc4, 0x9f, 0x27, 0xf8, 0x73, 0x80, 
+  0xe8, 0xbc, 0x0b, 0xef, 0x44, 0x37, 0x93, 0x81, 0xc0, 0xec, 0x11, 0x46, 0xe4, 0xeb, 0x7c, 0x77, 
+  0xf7, 0x7c, 0x78, 0x38, 0xcb, 0x56, 0x69, 0xf9, 0x2e, 0x62, 0x2d, 0xce, 0xf3, 0x2c, 0x17, 0xe6, 
+  0x49, 0xb6, 0xd2, 0xa9, 0x71, 0x24, 0x39, 0xef, 0x76, 0x04, 0x7a, 0x14, 0x21, 0xae, 0x5c, 0x28, 
+  0x4b, 0xc0, 0x3b, 0x45, 0xf4, 0xd3, 0xc6, 0xda, 0xcc, 0x1b, 0x6e, 0x63, 0x4a, 0x5c, 0xd1, 0x98, 
+  0x92, 0x32, 0x4b, 0xf8, 0x4c, 0xed, 0xab, 0x9f, 0x59, 0xc6, 0x74, 0x4a, 0xad, 0x7d, 0x16, 0x66, 
+  0x93, 0xd3, 0xe9, 0xe8, 0x14, 0x4e, 0x7b, 0x72, 0x83, 0xde, 0x0f, 0x9f, 0xc9, 0x9e, 0x52, 0x3f, 
+  0xd3, 0x93, 0xec, 0xaa, 0x67, 0x43, 0x71, 0x60, 0xd3, 0xf7, 0x6a, 0xb3, 0x60, 0x03, 0x76, 0x96, 
+  0x3a, 0xde, 0xfb, 0x79, 0xe4, 0x17, 0xde, 0x31, 0x15, 0x31, 0xda, 0xd7, 0x32, 0x3a, 0xcf, 0xc3, 
+  0xea, 0x38, 0xa6, 0x31, 0xbf, 0x43, 0x3f, 0x66, 0xc3, 0x3b, 0x4c, 0x73, 0xe9, 0x5f, 0x5c, 0xc2, 
+  0xea, 0x0b, 0xa2, 0x9a, 0x95, 0xbc, 0xc6, 0x4d, 0xc2, 0xff, 0xc5, 0x2e, 0xa6, 0x83, 0xc1, 0x80, 
+  0xbe, 0x7e, 0x14, 0x51, 0xf1, 0x27, 0xf1, 0x58, 0x18, 0xf3, 0xe0, 0xb3, 0x49, 0xa6, 0x92, 0x77, 
+  0x77, 0x25, 0x3c, 0xa6, 0x46, 0x75, 0x38, 0xa2, 0xdc, 0xef, 0x71, 0xc0, 0x51, 0xab, 0xdc, 0xbb, 
+  0xbb, 0x6c, 0x30, 0x69, 0xf7, 0x99, 0xdb, 0x6e, 0xb6, 0x12, 0x18, 0x7b, 0x57, 0x52, 0xe4, 0x85, 
+  0x21, 0x5d, 0xaa, 0xf0, 0xf6, 0xe9, 0xb0, 0x89, 0xbc, 0x67, 0xc6, 0x98, 0x4a, 0x7f, 0x5a, 0xf9, 
+  0x87, 0xe9, 0x12, 0x2e, 0x36, 0xcc, 0x6b, 0x78, 0xe0, 0xca, 0x23, 0xe1, 0xbb, 0x7b, 0x81, 0x38, 
+  0x91, 0xb9, 0x8b, 0x56, 0x70, 0x69, 0x8c, 0x3a, 0x8e, 0x54, 0x7d, 0x0c, 0xc6, 0x87, 0x74, 0xca, 
+  0x07, 0x6e, 0xbc, 0x7a, 0xb1, 0x0a, 0x9e, 0xd3, 0xf1, 0x5f, 0xf7, 0x12, 0xd9, 0xe0, 0x5b, 0x0f, 
+  0xad, 0xea, 0x95, 0x4b, 0x87, 0x47, 0x34, 0xeb, 0x57, 0x43, 0x71, 0xd2, 0xf1, 0x7d, 0x5c, 0xd7, 
+  0x47, 0x42, 0x7d, 0x67, 0xe1, 0x05, 0x2d, 0x04, 0xba, 0x2e, 0xd0, 0x9b, 0xd3, 0x11, 0xa8, 0xaf, 
+  0xb7, 0xa0, 0x57, 0xf7, 0xee, 0x9d, 0xd2, 0x4e, 0x03, 0x12, 0xa5, 0x15, 0x20, 0x2e, 0xc3, 0xc5, 
+  0x64, 0x51, 0x49, 0xe4, 0x34, 0x79, 0x65, 0x04, 0x45, 0x5a, 0x50, 0xc7, 0x44, 0x0c, 0xde, 0x43, 
+  0xcf, 0xb0, 0x0c, 0x8f, 0x55, 0xcc, 0x3b, 0x16, 0x31, 0x9c, 0xa9, 0xeb, 0xc7, 0x08, 0xf0, 0xa5, 
+  0xd7, 0x9d, 0xba, 0xea, 0x08, 0xe8, 0x29, 0x4d, 0xe0, 0xb5, 0x28, 0x4d, 0x1a, 0xbe, 0x17, 0x48, 
+  0x54, 0xed, 0x3e, 0x3d, 0x53, 0xda, 0xcd, 0x11, 0x2b, 0x81, 0x88, 0x19, 0x28, 0x0c, 0x7b, 0xa7, 
+  0x38, 0xb5, 0x5e, 0x85, 0xc7, 0xb5, 0x78, 0xd9, 0xa6, 0x15, 0xc7, 0x98, 0x60, 0x09, 0xb7, 0x61, 
+  0x1b, 0x33, 0xda, 0x99, 0x0d, 0x9f, 0x22, 0xcc, 0x3b, 0x24, 0x8f, 0x1e, 0x17, 0x8a, 0x25, 0xc9, 
+  0xc5, 0x2a, 0x24, 0x81, 0x27, 0x5b, 0x72, 0xc9, 0xf4, 0x7f, 0xd5, 0x63, 0xe9, 0x05, 0x7b, 0x43, 
+  0x6c, 0x99, 0x84, 0x9d, 0x70, 0x0e, 0x87, 0x2f, 0xe3, 0x37, 0xbf, 0x6a, 0x2c, 0x6f, 0xf5, 0xd9, 
+  0x57, 0xd8, 0x80, 0xa7, 0x7b, 0x9f, 0xcd, 0x52, 0x1a, 0x0c, 0x4e, 0xfd, 0xcf, 0x34, 0x02, 0x58, 
+  0xe7, 0x27, 0x31, 0xc0, 0xb5, 0x1d, 0xec, 0x8a, 0x4b, 0x29, 0xc2, 0xe2, 0x65, 0x3c, 0xa9, 0x9f, 
+  0x11, 0xed, 0x30, 0xd7, 0xcf, 0xf3, 0xec, 0x8c, 0x8f, 0x8c, 0xd7, 0xb4, 0x25, 0x74, 0xac, 0x04, 
+  0x1c, 0x0b, 0x7c, 0xca, 0xb7, 0xc3, 0x5e, 0x77, 0x2b, 0x99, 0x19, 0xa2, 0x80, 0x31, 0x30, 0x9a, 
+  0x6a, 0x81, 0x59, 0xd4, 0x78, 0xdf, 0xd0, 0x09, 0x1c, 0xb5, 0xd2, 0xb7, 0x5b, 0x54, 0x34, 0xe3, 
+  0xe1, 0x08, 0x43, 0xf7, 0x6e, 0xef, 0x1f, 0x30, 0xe8, 0x12, 0x9e, 0x5b, 0x18, 0x26, 0xfd, 0x83, 
+  0x56, 0xef, 0xb8, 0xc2, 0xbb, 0x5e, 0x66, 0x29, 0x6f, 0x0f, 0x8f, 0x2e, 0x13, 0x2e, 0xfa, 0x75, 
+  0x00, 0xe2, 0xaf, 0x75, 0x2d, 0xca, 0x80, 0xf8, 0xab, 0x5c, 0xec, 0x75, 0x18, 0xd9, 0x43, 0x77, 
+  0x87, 0x9b, 0x1b, 0xcf, 0x3c, 0xfd, 0x56, 0xb3, 0x42, 0x69, 0x84, 0x09, 0x6d, 0xf3, 0x4a, 0x47, 
+  0x51, 0x43, 0xd1, 0xf8, 0x7b, 0xd4, 0xd4, 0x31, 0xe9, 0x48, 0xcd, 0x3f, 0xcc, 0x1b, 0x2a, 0x90, 
+  0x9d, 0x03, 0x5c, 0x53, 0x0f, 0xa8, 0x51, 0x54, 0xa8, 0xb9, 0x27, 0x3f, 0xe0, 0x5d, 0x0d, 0x05, 
+  0xc9, 0x5e, 0xa8, 0x93, 0x80, 0xff, 0x2b, 0x0f, 0x19, 0xf1, 0xc3, 0x0e, 0x90, 0x5a, 0x05, 0xfc, 
+  0x76, 0x78, 0xd8, 0xb7, 0x37, 0xed, 0x6f, 0x9d, 0x3d, 0x6f, 0xd8, 0xd2, 0xb5, 0xa7, 0xd5, 0x99, 
+  0x5f, 0x38, 0xf2, 0x10, 0xe3, 0xe3, 0x44, 0xbc, 0x24, 0x76, 0x20, 0x14, 0x06, 0x27, 0xdb, 0xfb, 
+  0xb6, 0x15, 0xdd, 0x35, 0xef, 0x69, 0xdb, 0x78, 0x88, 0x60, 0x25, 0x74, 0x0b, 0x37, 0x14, 0x28, 
+  0xf8, 0x65, 0x96, 0xf5, 0xb2, 0xe5, 0x7c, 0xd8, 0x7b, 0x4b, 0x3c, 0x14, 0x5d, 0x4b, 0x57, 0xe7, 
+  0xc7, 0x79, 0x34, 0xe7, 0x48, 0x7d, 0x6e, 0xce, 0x87, 0xc3, 0x07, 0xc3, 0x07, 0xe7, 0x79, 0xdc, 
+  0xcb, 0xf2, 0x1e, 0x9a, 0x94, 0x0f, 0x2d, 0x26, 0xa8, 0x31, 0x1e, 0xa0, 0x54, 0xf0, 0x3d, 0xc9, 
+  0x52, 0x6e, 0x63, 0x1a, 0xe0, 0x9a, 0x2e, 0x92, 0x89, 0x9d, 0x50, 0x98, 0x92, 0x11, 0xf7, 0x8f, 
+  0x01, 0xb3, 0x32, 0x68, 0xbe, 0x3f, 0x5d, 0x5f, 0x9f, 0x66, 0x87, 0x6c, 0x70, 0x72, 0x27, 0xa1, 
+  0xa4, 0xe1, 0x69, 0xf6, 0xb8, 0x16, 0xc3, 0x6f, 0xbd, 0xee, 0x0f, 0x92, 0x01, 0x65, 0xbb, 0xaf, 
+  0xf3, 0xd1, 0x8b, 0xca, 0x6c, 0xc1, 0xad, 0x99, 0x4d, 0x96, 0x89, 0x5b, 0xd0, 0x91, 0xbf, 0xe8, 
+  0x16, 0x84, 0xea, 0x34, 0x3d, 0xba, 0x6e, 0x96, 0x8b, 0x50, 0x63, 0x15, 0x88, 0xbd, 0xf6, 0xe2, 
+  0xf1, 0x71, 0x39, 0xd1, 0x93, 0xaa, 0x83, 0xeb, 0xfa, 0x38, 0xa5, 0xa8, 0x84, 0x83, 0xcc, 0xcb, 
+  0x9b, 0xfe, 0x7d, 0xf3, 0xe4, 0x02, 0xbe, 0x70, 0xf4, 0xc1, 0x42, 0x83, 0xd7, 0x16, 0x50, 0x62, 
+  0x53, 0xc9, 0x3c, 0x95, 0x5f, 0x6a, 0x39, 0x64, 0x99, 0x06, 0x19, 0x8c, 0x19, 0xed, 0x86, 0x9e, 
+  0xe7, 0xc8, 0x62, 0x7a, 0xd7, 0x46, 0xa0, 0x2e, 0x11, 0x0c, 0x80, 0x50, 0xe0, 0xf7, 0x68, 0x1c, 
+  0x74, 0x3d, 0x74, 0x50, 0x76, 0x9a, 0x85, 0xf8, 0xd7, 0x97, 0xf1, 0x90, 0xed, 0x17, 0xbc, 0xfe, 
+  0x9e, 0xa8, 0xc8, 0xd9, 0xcc, 0x26, 0xbc, 0x8b, 0x01, 0xb8, 0x0f, 0x80, 0x8e, 0xbb, 0xbd, 0x64, 
+  0x1e, 0x6a, 0xe0, 0xd4, 0x7f, 0x72, 0x9c, 0x86, 0xbd, 0x0f, 0xf7, 0x25, 0xeb, 0x3f, 0x61, 0x84, 
+  0xf2, 0x60, 0x2f, 0xe3, 0xc8, 0x3f, 0xd5, 0x32, 0xd7, 0x0d, 0x0c, 0xaf, 0xb1, 0xd4, 0x03, 0x5a, 
+  0xd7, 0x72, 0x0a, 0xdf, 0x79, 0xd8, 0xbb, 0xb9, 0xe9, 0xdd, 0xbd, 0xeb, 0x8f, 0xa8, 0x55, 0x8d, 
+  0xfc, 0x98, 0x35, 0x93, 0x5f, 0xc2, 0x98, 0x3f, 0xa4, 0x3e, 0xf5, 0x15, 0x51, 0x02, 0x62, 0x76, 
+  0xfa, 0xeb, 0x5e, 0x5f, 0x84, 0x8a, 0xbf, 0x6f, 0xa0, 0x5c, 0xbf, 0x6f, 0xa6, 0x5c, 0xbf, 0x47, 
+  0xc6, 0x38, 0x9f, 0xb3, 0xd3, 0x4f, 0x68, 0x5f, 0x7e, 0x60, 0x3c, 0xbd, 0x78, 0xe6, 0x99, 0x40, 
+  0x35, 0x1f, 0x3f, 0x61, 0x3d, 0x1f, 0x50, 0x9b, 0xda, 0xf4, 0xe1, 0x77, 0xd6, 0xf5, 0xad, 0xbb, 
+  0xe2, 0xaf, 0x89, 0x1c, 0x82, 0x4e, 0x06, 0xfe, 0x77, 0x18, 0x9d, 0xcd, 0xc7, 0xf2, 0xe8, 0x4d, 
+  0xfa, 0x72, 0x01, 0x86, 0xa9, 0xaf, 0x0e, 0xa2, 0xd1, 0x9f, 0x02, 0x5d, 0xb1, 0x02, 0x26, 0x0b, 
+  0x89, 0xdc, 0xa7, 0x5a, 0x92, 0xe1, 0x88, 0xe6, 0xe5, 0xb3, 0xb1, 0x93, 0x16, 0x18, 0x77, 0x70, 
+  0x9d, 0xc6, 0xf7, 0xe1, 0x5b, 0x8a, 0x39, 0xcb, 0xe6, 0xab, 0x65, 0xdc, 0x59, 0x8a, 0x24, 0x21, 
+  0x1a, 0x90, 0x7e, 0xd4, 0x81, 0x08, 0x0b, 0xba, 0x91, 0xeb, 0x0a, 0x82, 0x18, 0xbe, 0x33, 0xa7, 
+  0x08, 0xe7, 0x50, 0xd7, 0x73, 0xc6, 0x9b, 0x40, 0xf3, 0x75, 0x1f, 0x6f, 0x6f, 0xd8, 0xff, 0x5f, 
+  0xff, 0xfc, 0xd8, 0xd3, 0xad, 0xf2, 0xfa, 0x74, 0x6b, 0x9f, 0x9d, 0x02, 0xc6, 0xc6, 0x57, 0xa6, 
+  0x92, 0x6d, 0x28, 0xfe, 0xed, 0x79, 0xf5, 0xed, 0xbc, 0xda, 0xa2, 0x94, 0x9d, 0xe2, 0xa9, 0x8a, 
+  0xab, 0xab, 0x41, 0x57, 0x6b, 0x4f, 0x33, 0x4d, 0x78, 0xb1, 0x0a, 0x35, 0xf1, 0x7d, 0xa5, 0xcb, 
+  0x01, 0xa5, 0xd5, 0xed, 0x9c, 0xab, 0xde, 0xb9, 0x90, 0xda, 0x38, 0x2d, 0x56, 0x44, 0x51, 0x13, 
+  0x4e, 0x95, 0x90, 0x56, 0x46, 0x97, 0x81, 0x5f, 0x1c, 0x11, 0x16, 0xa2, 0x86, 0x33, 0x61, 0x07, 
+  0xe8, 0xb3, 0xd5, 0xf1, 0xbd, 0x04, 0x0e, 0x69, 0xb1, 0x77, 0x9a, 0xa9, 0xd3, 0x6c, 0xa8, 0x53, 
+  0x78, 0x06, 0xd7, 0x15, 0xad, 0x78, 0xac, 0x5e, 0xfa, 0xd7, 0x8f, 0x6d, 0xea, 0x4b, 0xde, 0x1d, 
+  0x2f, 0xd4, 0x73, 0xb5, 0x02, 0x7f, 0x74, 0x27, 0xec, 0x33, 0x8e, 0x90, 0x4e, 0xa6, 0x33, 0x49, 
+  0xcd, 0xc2, 0xc7, 0x43, 0x13, 0x24, 0xb8, 0x7c, 0x63, 0x65, 0x87, 0x40, 0x9e, 0x41, 0x88, 0x64, 
+  0x1d, 0x46, 0x80, 0x06, 0x43, 0x24, 0x63, 0xf4, 0x70, 0x1a, 0x5f, 0xf5, 0x6b, 0xd2, 0xd5, 0x39, 
+  0x0d, 0xd0, 0x3b, 0xd0, 0x3d, 0x96, 0x95, 0xb2, 0xec, 0x39, 0x98, 0xf4, 0x8d, 0x50, 0x17, 0x16, 
+  0xf0, 0x2c, 0xf5, 0x86, 0xdf, 0xf4, 0x2c, 0x3b, 0xbf, 0xc2, 0xbf, 0x22, 0xa4, 0xc4, 0xab, 0xb5, 
+  0x2a, 0xc2, 0xd8, 0x41, 0xfb, 0xf5, 0x84, 0x9d, 0xd4, 0x28, 0xb8, 0x38, 0xeb, 0x2a, 0x2b, 0x04, 
+  0x48, 0x8f, 0x0c, 0x16, 0x4a, 0x15, 0xc3, 0x39, 0xb9, 0x77, 0x6f, 0xe4, 0x0b, 0x47, 0xeb, 0xa5, 
+  0x61, 0x0e, 0x39, 0x85, 0x61, 0xd2, 0x62, 0x24, 0x65, 0x93, 0x32, 0x44, 0xc0, 0x94, 0x29, 0x9d, 
+  0x47, 0xf4, 0x3c, 0x0d, 0x1f, 0x2a, 0x1d, 0xa4, 0xb9, 0xac, 0xc0, 0x3c, 0xa2, 0xea, 0x82, 0xbb, 
+  0x70, 0x44, 0xbc, 0x16, 0x91, 0x07, 0x1a, 0xa0, 0x9e, 0x04, 0xe3, 0x68, 0xa0, 0xeb, 0x78, 0x39, 
+  0xdc, 0xa6, 0x10, 0xbc, 0x98, 0xc5, 0xb8, 0x2f, 0x71, 0x19, 0x85, 0x96, 0xd4, 0x8b, 0xf1, 0x0e, 
+  0xb0, 0xb8, 0x78, 0xa0, 0x15, 0xcf, 0x23, 0x06, 0x5f, 0x1d, 0x08, 0xfb, 0xb4, 0xd4, 0x10, 0xbf, 
+  0xfc, 0x05, 0x67, 0x55, 0x5c, 0x46, 0x15, 0x19, 0x3d, 0x09, 0xf5, 0x17, 0xb4, 0x45, 0x1a, 0x85, 
+  0xda, 0xc2, 0x6a, 0x49, 0xfa, 0x7b, 0x04, 0x46, 0x4d, 0xc6, 0x4b, 0xa7, 0xcc, 0x00, 0x7f, 0x1d, 
+  0xc5, 0xf5, 0xbf, 0x5c, 0x19, 0x76, 0x65, 0xb5, 0xb1, 0x60, 0xe3, 0x68, 0xb5, 0xf0, 0x24, 0x98, 
+  0x6a, 0xcb, 0x30, 0xc1, 0x0c, 0x45, 0x1a, 0xfe, 0xcb, 0xc3, 0x64, 0xe3, 0x4a, 0x6e, 0x43, 0x47, 
+  0x3f, 0x1c, 0xc1, 0x37, 0x7b, 0x94, 0xdf, 0xbb, 0x67, 0x8c, 0x16, 0x10, 0xcf, 0x79, 0x94, 0xd2, 
+  0x6c, 0x40, 0xe6, 0x38, 0xe9, 0xf7, 0xa7, 0x8e, 0x0a, 0x4d, 0x00, 0x8b, 0x00, 0x78, 0x85, 0x04, 
+  0xac, 0x61, 0xc5, 0x4f, 0x94, 0x3b, 0xc4, 0x27, 0xca, 0xc6, 0xc8, 0xa1, 0xc9, 0x5c, 0x57, 0x58, 
+  0x78, 0x5e, 0x3a, 0x94, 0xb5, 0x14, 0x9e, 0x43, 0x30, 0xca, 0x8f, 0xca, 0xbc, 0xf3, 0xf1, 0x24, 
+  0xcb, 0x4f, 0x92, 0xe5, 0xb9, 0x7a, 0x8b, 0x0c, 0x58, 0x80, 0x9c, 0x8a, 0x07, 0xfd, 0x1b, 0xef, 
+  0xf5, 0x82, 0xe4, 0x24, 0xfd, 0x5c, 0xbd, 0xf5, 0x7d, 0xe5, 0x54, 0x6c, 0x1e, 0x55, 0xd1, 0x59, 
+  0xb1, 0x7d, 0x46, 0x7a, 0xab, 0x62, 0x79, 0x50, 0x45, 0x47, 0xc5, 0xf6, 0x99, 0x52, 0x4d, 0xc5, 
+  0x94, 0x01, 0x7b, 0x35, 0x9e, 0xeb, 0xd5, 0x96, 0xc4, 0xf0, 0x67, 0x6b, 0xbe, 0x12, 0x6b, 0x27, 
+  0x14, 0x99, 0x34, 0x72, 0x36, 0x5f, 0x49, 0xce, 0x86, 0x31, 0x82, 0x15, 0x59, 0x54, 0xfa, 0x9d, 
+  0x31, 0xb1, 0x51, 0xd3, 0xa0, 0x5a, 0xb2, 0xce, 0x02, 0xf4, 0x2b, 0x91, 0x8c, 0xcd, 0x5f, 0x8e, 
+  0xcb, 0x4d, 0xf9, 0x4b, 0xf1, 0x6a, 0x80, 0x25, 0x85, 0x7a, 0x3c, 0x94, 0xfb, 0x0f, 0x67, 0xfb, 
+  0x81, 0x2e, 0x41, 0x49, 0x41, 0xf7, 0x96, 0x99, 0x40, 0x99, 0x15, 0x12, 0x7a, 0x8b, 0x38, 0x63, 
+  0xc6, 0xdf, 0xb3, 0x4d, 0xfc, 0xd5, 0x2b, 0x2a, 0xdf, 0xe9, 0x4e, 0x5a, 0x35, 0xea, 0x7c, 0xdb, 
+  0x92, 0x1a, 0x1a, 0x36, 0xb9, 0x7e, 0x88, 0xd9, 0xb3, 0x49, 0xac, 0xbb, 0x62, 0xab, 0x2c, 0x41, 
+  0x94, 0x92, 0x38, 0xd7, 0x2c, 0x1b, 0x15, 0xa3, 0x10, 0xd1, 0xe5, 0x9c, 0xa8, 0x36, 0x6c, 0x0c, 
+  0x1e, 0x8e, 0x5a, 0xe9, 0x06, 0xf6, 0x2b, 0x0a, 0x67, 0xba, 0x46, 0x0b, 0x14, 0x7f, 0x73, 0x03, 
+  0x5e, 0xd8, 0xb9, 0x75, 0xd8, 0xe8, 0x13, 0x5f, 0xd3, 0x9f, 0x99, 0x56, 0x2c, 0x3e, 0x1e, 0x26, 
+  0xc5, 0x3b, 0x30, 0x75, 0x78, 0x5b, 0xa5, 0xe3, 0x52, 0xde, 0xfd, 0x61, 0xac, 0xbb, 0x34, 0xdb, 
+  0x18, 0xd4, 0x22, 0xa3, 0xe6, 0xd5, 0x26, 0x47, 0xae, 0xbd, 0x2f, 0x89, 0x3b, 0xa6, 0xd1, 0x2f, 
+  0xc5, 0xac, 0xc2, 0x57, 0x36, 0xd2, 0x83, 0x1b, 0xe6, 0x41, 0x47, 0xc1, 0x48, 0xeb, 0xf1, 0x2f, 
+  0xcc, 0x9e, 0x65, 0x65, 0x5e, 0x63, 0xa4, 0x58, 0xbc, 0x65, 0x06, 0x67, 0xc5, 0xb2, 0xa4, 0xc3, 
+  0xcf, 0x39, 0xd6, 0x74, 0x1e, 0x1a, 0xc0, 0xc0, 0xa7, 0x6f, 0xc2, 0x52, 0xe5, 0x6b, 0xf6, 0xc1, 
+  0x14, 0x62, 0x0d, 0x6c, 0xf3, 0x68, 0xad, 0x3a, 0xbb, 0x38, 0x5c, 0xa4, 0x74, 0xf3, 0x5f, 0xa4, 
+  0x94, 0x8a, 0xdb, 0xc0, 0xaa, 0x8c, 0xe7, 0x1b, 0x86, 0x56, 0x9b, 0x39, 0x55, 0x21, 0x3f, 0xba, 
+  0x87, 0xac, 0xbc, 0xb5, 0x24, 0x77, 0x17, 0xfd, 0x68, 0x96, 0x98, 0x2b, 0x0f, 0x4d, 0xac, 0x96, 
+  0x74, 0x94, 0xef, 0x25, 0x2c, 0x0f, 0xc5, 0x8d, 0x12, 0x6e, 0xe0, 0x29, 0x1f, 0x08, 0x4c, 0xa9, 
+  0x11, 0x30, 0xc6, 0x2c, 0x13, 0x6b, 0x7f, 0x58, 0x53, 0x64, 0x9f, 0xb8, 0xc7, 0x91, 0x4b, 0x0a, 
+  0x43, 0xf6, 0xe8, 0x57, 0x35, 0x7e, 0xc4, 0xd9, 0x78, 0xa9, 0x59, 0xd0, 0x76, 0xdb, 0xad, 0x52, 
+  0x8c, 0xb2, 0xb3, 0x62, 0x52, 0x67, 0x9b, 0xfd, 0xd1, 0xdd, 0x07, 0x0f, 0x6b, 0x74, 0xc3, 0xe7, 
+  0x95, 0xf6, 0xc4, 0xf6, 0x50, 0xdf, 0xa6, 0xd1, 0x35, 0x96, 0xad, 0x7a, 0x19, 0x15, 0xe9, 0x76, 
+  0x32, 0x5b, 0xb7, 0x18, 0xa5, 0x77, 0x27, 0x71, 0x6a, 0x2d, 0x38, 0x88, 0xb3, 0x11, 0x46, 0xe3, 
+  0x1b, 0xc5, 0x38, 0x71, 0xc4, 0x6c, 0x98, 0xf8, 0x71, 0xac, 0xf4, 0x63, 0x5f, 0x85, 0x8c, 0xba, 
+  0xbc, 0xd3, 0x77, 0x1a, 0xff, 0x43, 0x8d, 0x8c, 0xd5, 0x56, 0xf2, 0xeb, 0xe8, 0xdc, 0xdb, 0xd2, 
+  0x83, 0xce, 0x80, 0x26, 0x63, 0x19, 0x73, 0x84, 0x6d, 0xa9, 0xea, 0xf8, 0xad, 0xf2, 0xbd, 0xe8, 
+  0x3a, 0x97, 0x7d, 0xbf, 0x3a, 0x1f, 0x1f, 0x8c, 0xd2, 0x4a, 0xe6, 0x98, 0xd2, 0xb0, 0x94, 0xf0, 
+  0x83, 0x62, 0x7e, 0xb4, 0xc6, 0x4f, 0xc4, 0x7e, 0xdc, 0xc9, 0x4c, 0x40, 0x5f, 0x69, 0xeb, 0x7d, 
+  0xaf, 0x99, 0x72, 0xa3, 0x37, 0xf7, 0x8d, 0xc7, 0x81, 0x36, 0xee, 0x75, 0xdb, 0x60, 0xd0, 0xa4, 
+  0x2a, 0xf2, 0x46, 0x87, 0x6c, 0xd5, 0x5c, 0x07, 0x97, 0xee, 0x95, 0x13, 0x40, 0x14, 0xe1, 0x8c, 
+  0x2a, 0x23, 0xf3, 0xfb, 0xff, 0xb9, 0x7f, 0xac, 0xfa, 0xff, 0xf9, 0x4f, 0xdf, 0x79, 0xf5, 0x61, 
+  0xc2, 0xef, 0x26, 0xee, 0xbb, 0x29, 0xbf, 0x9a, 0xd6, 0xb2, 0x0d, 0xf9, 0xdd, 0xb0, 0xdf, 0xf0, 
+  0xc3, 0x96, 0xe5, 0x44, 0x6c, 0x5f, 0x02, 0x7e, 0x8d, 0xaf, 0xac, 0x45, 0x74, 0x11, 0x77, 0x3a, 
+  0x99, 0xd7, 0x26, 0xef, 0xa5, 0x96, 0x9e, 0x00, 0x3d, 0x03, 0x0c, 0x46, 0x3a, 0x4e, 0x10, 0x2a, 
+  0xbc, 0x0c, 0x88, 0x64, 0x30, 0x51, 0x80, 0x46, 0xd1, 0xf2, 0x72, 0xfa, 0x36, 0x4c, 0xc3, 0xd1, 
+  0xe1, 0x02, 0xbf, 0xb9, 0x5c, 0x23, 0xd6, 0xd9, 0xa3, 0x63, 0x2c, 0x01, 0xd0, 0x96, 0x46, 0x30, 
+  0xaf, 0xfa, 0x70, 0xe1, 0xd5, 0x2d, 0x5b, 0x74, 0x99, 0x1a, 0xf3, 0x21, 0xae, 0xa4, 0x39, 0x65, 
+  0xd8, 0xbf, 0x73, 0xe7, 0x4e, 0x5f, 0x87, 0x38, 0xcc, 0xa9, 0x30, 0x7b, 0x06, 0x34, 0x27, 0x9a, 
+  0x51, 0x2f, 0x52, 0x89, 0x77, 0xac, 0x90, 0x33, 0x84, 0xee, 0x7a, 0x2d, 0x43, 0x45, 0x4c, 0xd9, 
+  0xa6, 0x51, 0x42, 0xf5, 0xfc, 0x5e, 0x7b, 0x1b, 0x74, 0x76, 0xd9, 0x10, 0x12, 0x4f, 0xbc, 0x80, 
+  0x40, 0x84, 0xd7, 0x2f, 0xe9, 0xd8, 0x78, 0xcd, 0x8c, 0xc3, 0x96, 0xd1, 0xe9, 0xd8, 0x21, 0x0e, 
+  0xcd, 0x29, 0x27, 0x77, 0x88, 0x5f, 0x7f, 0x39, 0x84, 0xd1, 0xd7, 0x8f, 0xfb, 0x4d, 0x7b, 0xb2, 
+  0x07, 0x5d, 0x36, 0xe3, 0xb7, 0xee, 0x76, 0x29, 0x8b, 0x2e, 0x46, 0x51, 0x21, 0xe1, 0x7e, 0x75, 
+  0xe4, 0xad, 0xab, 0x6c, 0x45, 0x1b, 0x1e, 0x61, 0xe2, 0x10, 0x9b, 0x26, 0xbd, 0xa0, 0x41, 0x83, 
+  0xdc, 0xc9, 0xc0, 0x47, 0x13, 0xa9, 0x02, 0xbc, 0xa0, 0xf7, 0x02, 0xcb, 0xea, 0x39, 0x0f, 0xe3, 
+  0x05, 0x1d, 0x53, 0x83, 0x81, 0xfa, 0xb6, 0xa3, 0x19, 0xd0, 0x60, 0x3a, 0xa6, 0xe8, 0xd4, 0x8d, 
+  0x71, 0x1a, 0xba, 0x6f, 0x82, 0xb2, 0xf6, 0xd3, 0x57, 0xdf, 0x75, 0x97, 0x52, 0xcf, 0xa6, 0xdc, 
+  0x42, 0xbe, 0x9d, 0x4a, 0xec, 0x8d, 0x92, 0xd8, 0x63, 0x6a, 0x1d, 0xd5, 0xe1, 0x1b, 0x5e, 0xc2, 
+  0x81, 0x18, 0x10, 0xec, 0x47, 0x58, 0x4c, 0xcd, 0x94, 0x75, 0xd9, 0xea, 0x22, 0x28, 0x1b, 0x67, 
+  0x04, 0x51, 0x02, 0x67, 0xe1, 0x0c, 0xf2, 0x34, 0x90, 0xd8, 0x6a, 0x5a, 0x3d, 0x83, 0xef, 0x99, 
+  0x6c, 0x9e, 0xce, 0xc8, 0xa7, 0x76, 0x8d, 0x56, 0xd4, 0xc4, 0x44, 0xad, 0x44, 0xc5, 0xb4, 0x0c, 
+  0xaf, 0x39, 0x66, 0x70, 0xa1, 0xc4, 0x28, 0x04, 0x61, 0x06, 0xb4, 0xe7, 0xc0, 0x22, 0x6c, 0xb3, 
+  0x0a, 0x2b, 0x3e, 0xbb, 0xf0, 0x57, 0x8b, 0xb7, 0x5c, 0xd3, 0xb8, 0xe7, 0x3a, 0xbb, 0x7c, 0xde, 
+  0x15, 0x8d, 0x9b, 0xd8, 0xb9, 0x17, 0x6d, 0x4f, 0xc3, 0xde, 0xc6, 0x06, 0xb7, 0xf1, 0xff, 0xc7, 
+  0x4e, 0xdd, 0x9e, 0x34, 0x9d, 0xb1, 0x1b, 0xd9, 0x7c, 0x41, 0x77, 0x61, 0xa9, 0x0d, 0x5c, 0x54, 
+  0x71, 0x9a, 0x9c, 0x07, 0xef, 0xd6, 0x7e, 0xf0, 0x15, 0x1f, 0x31, 0x8a, 0xb7, 0xc6, 0x43, 0xdb, 
+  0xda, 0x7f, 0x39, 0xa8, 0x36, 0xf7, 0xff, 0xa4, 0x93, 0xc0, 0x49, 0xed, 0xe5, 0xc6, 0x26, 0x97, 
+  0x6c, 0x1c, 0x16, 0x6c, 0xd9, 0x91, 0xeb, 0x8a, 0x77, 0xe9, 0xe6, 0x04, 0x85, 0x97, 0x1d, 0x66, 
+  0x0e, 0x0b, 0xe8, 0x2b, 0xa7, 0xc9, 0x38, 0xf8, 0xb9, 0x85, 0x17, 0xe1, 0x73, 0xa6, 0x0f, 0x05, 
+  0x1b, 0x30, 0x5d, 0x98, 0x43, 0xfa, 0x62, 0xc4, 0xa2, 0x65, 0x59, 0x60, 0xda, 0x6e, 0xe0, 0x18, 
+  0x1b, 0xed, 0x0c, 0x06, 0xbb, 0x9d, 0xa1, 0x51, 0xe3, 0xf5, 0xc8, 0x19, 0x19, 0x3a, 0xb5, 0xa9, 
+  0x05, 0x47, 0xa1, 0xf9, 0x81, 0x0f, 0x1f, 0x80, 0x11, 0x49, 0x8a, 0xda, 0x62, 0xa4, 0x0d, 0x4c, 
+  0x6c, 0xf1, 0x63, 0xa7, 0xa5, 0x3c, 0xc5, 0xde, 0x84, 0xf6, 0x8e, 0xbe, 0xe5, 0x34, 0x61, 0xe8, 
+  0xec, 0x38, 0x6e, 0x08, 0x54, 0xb3, 0xc1, 0xf2, 0x0c, 0xc1, 0xfe, 0xec, 0xb8, 0x45, 0x06, 0x25, 
+  0xb2, 0x93, 0x66, 0x1e, 0x09, 0x56, 0xd6, 0x5a, 0x45, 0xb5, 0x26, 0x3c, 0x5a, 0x2e, 0x3b, 0x08, 
+  0xe7, 0x0f, 0x1c, 0x52, 0xfe, 0x0b, 0x0a, 0x86, 0x67, 0x7a, 0xf7, 0x21, 0x54, 0xaa, 0x56, 0x8d, 
+  0xda, 0x74, 0xef, 0x7f, 0xdd, 0x6b, 0x2d, 0x91, 0xf9, 0xc2, 0x6e, 0xeb, 0x46, 0x7c, 0x59, 0xbf, 
+  0x37, 0x17, 0xfd, 0x55, 0x1d, 0xd7, 0x49, 0x9d, 0x15, 0x22, 0x32, 0xc8, 0x11, 0x20, 0xc0, 0x5d, 
+  0x80, 0xfc, 0x0d, 0x05, 0xa7, 0x4e, 0x99, 0x3f, 0x74, 0x1f, 0x8e, 0x54, 0xdc, 0xa4, 0x51, 0x2d, 
+  0xa5, 0x4e, 0xab, 0xef, 0x9e, 0x30, 0xb5, 0x68, 0x9e, 0x72, 0xdc, 0x9d, 0xf6, 0x77, 0xed, 0x83, 
+  0xee, 0xe0, 0x24, 0xce, 0x63, 0x1b, 0x69, 0x18, 0x41, 0x87, 0x53, 0x73, 0xb6, 0xb1, 0xb6, 0xc3, 
+  0x70, 0xb7, 0xe5, 0x49, 0x24, 0xa7, 0x9d, 0x0d, 0xb9, 0x66, 0xf4, 0x2b, 0xd4, 0x6c, 0xcf, 0x1f, 
+  0xc3, 0x71, 0x37, 0x60, 0xe7, 0x8d, 0xf3, 0x0a, 0x91, 0xe3, 0x84, 0x8d, 0x5e, 0x47, 0x9b, 0xaf, 
+  0x82, 0x63, 0xb0, 0x9c, 0x74, 0xaa, 0xa5, 0x6b, 0x3b, 0x45, 0x9a, 0x4d, 0x52, 0xa5, 0x36, 0x51, 
+  0xbd, 0xa2, 0x31, 0xdd, 0x72, 0x50, 0xd0, 0x58, 0x0f, 0x8b, 0x2c, 0x87, 0x2e, 0xee, 0x33, 0xe5, 
+  0x2c, 0x30, 0xdd, 0x67, 0xbb, 0xbb, 0x9f, 0xf5, 0x4b, 0x2e, 0xe2, 0x52, 0x3d, 0x51, 0x07, 0xea, 
+  0xd4, 0x4e, 0x6f, 0xcd, 0xf8, 0xc5, 0xbb, 0x82, 0xda, 0xf4, 0x19, 0xe4, 0x74, 0xfb, 0xe1, 0x96, 
+  0xe3, 0x4c, 0xfd, 0xcc, 0x8e, 0x7f, 0xb8, 0x3f, 0x83, 0x3b, 0xbe, 0xa4, 0x7b, 0xc7, 0x93, 0x70, 
+  0xdf, 0xb0, 0xcf, 0x97, 0x7b, 0x4f, 0x46, 0x97, 0xb8, 0x59, 0x80, 0x40, 0x59, 0x2b, 0x91, 0x03, 
+  0x5a, 0x04, 0xfb, 0x13, 0x80, 0x6f, 0xde, 0xdc, 0x1c, 0xf4, 0x5a, 0x92, 0x25, 0xff, 0xfa, 0x10, 
+  0x77, 0x74, 0x51, 0x76, 0xff, 0x3c, 0x39, 0x98, 0x86, 0xc8, 0xcc, 0xc7, 0xdd, 0x23, 0xf5, 0x54, 
+  0xbd, 0x01, 0x2d, 0xfb, 0x18, 0xba, 0xf5, 0x9d, 0xb6, 0xea, 0x43, 0xe6, 0x4f, 0xa3, 0x83, 0xf0, 
+  0x94, 0xbe, 0xe4, 0xce, 0xbe, 0x0e, 0x67, 0x83, 0xfe, 0xa4, 0x3f, 0x78, 0xe5, 0x5d, 0xfa, 0x83, 
+  0xfe, 0xb4, 0x6f, 0xbc, 0x18, 0x0e, 0xea, 0xf6, 0x16, 0xda, 0x6a, 0xe1, 0x51, 0x78, 0x38, 0xa6, 
+  0x9a, 0xc5, 0x12, 0x61, 0x1a, 0xfc, 0xb1, 0xed, 0x40, 0x57, 0x3a, 0x1b, 0x96, 0xf7, 0xa7, 0x30, 
+  0xd3, 0xfd, 0x54, 0x8f, 0x98, 0x53, 0x88, 0xd4, 0x6b, 0xdc, 0xc0, 0x17, 0x50, 0xa1, 0x79, 0x9f, 
+  0x36, 0x0f, 0xe4, 0x27, 0xba, 0x0b, 0x3e, 0x0d, 0x7f, 0xdc, 0x5a, 0xcf, 0x23, 0xf5, 0x0c, 0x35, 
+  0x84, 0xe1, 0xbb, 0xf1, 0xc7, 0xc1, 0x20, 0x78, 0x33, 0x79, 0x7a, 0xef, 0xe3, 0x34, 0xfc, 0xa4, 
+  0x9e, 0x4d, 0x9e, 0x4e, 0x5b, 0x1e, 0x16, 0x1a, 0xfc, 0xf8, 0xbf, 0xe8, 0xc9, 0x1f, 0xc4, 0xee, 
+  0x38, 0x2f, 0x32, 0xef, 0x53, 0xbd, 0x4f, 0x5f, 0xd4, 0xdc, 0x37, 0x68, 0x5b, 0x67, 0x13, 0xad, 
+  0x65, 0x4b, 0xb3, 0xa6, 0xf5, 0xb1, 0x46, 0x72, 0x66, 0x08, 0x82, 0xc0, 0x4c, 0x90, 0x82, 0x7e, 
+  0x31, 0xf8, 0x44, 0xf4, 0x26, 0xf2, 0xde, 0xc8, 0x81, 0xa8, 0xcf, 0x2b, 0x57, 0x98, 0xbd, 0xbb, 
+  0x5b, 0xa3, 0x29, 0xcf, 0xb3, 0xfc, 0x59, 0x44, 0xb3, 0x7c, 0x5c, 0xbb, 0x29, 0xb6, 0xbe, 0xf2, 
+  0x62, 0xc1, 0x3b, 0x50, 0xf1, 0x10, 0xb5, 0xf8, 0xeb, 0x0a, 0x24, 0xfd, 0x3d, 0x58, 0x36, 0xb1, 
+  0x8b, 0x8d, 0xb6, 0x71, 0x66, 0x92, 0x69, 0x61, 0x36, 0xf9, 0x4f, 0xe1, 0xdc, 0x73, 0x8c, 0xc7, 
+  0x71, 0xa4, 0xff, 0x44, 0xfb, 0xfe, 0x27, 0x9a, 0xe6, 0x9f, 0xd6, 0x9a, 0x1a, 0xe8, 0xd4, 0x13, 
+  0xca, 0x18, 0xd1, 0x26, 0xd2, 0xaf, 0xd9, 0x5e, 0x4f, 0x04, 0x26, 0xcf, 0xe5, 0xaa, 0x50, 0x00, 
+  0xca, 0xc5, 0xf9, 0x20, 0x1a, 0xfd, 0xe6, 0x15, 0x1d, 0x98, 0x24, 0x33, 0x63, 0x09, 0x47, 0x2b, 
+  0x7d, 0x88, 0x95, 0x4e, 0xa4, 0xe7, 0x95, 0x06, 0x0e, 0xb8, 0x07, 0x93, 0xf4, 0x4e, 0x72, 0xbb, 
+  0x32, 0x02, 0x51, 0xba, 0x83, 0xdd, 0x92, 0x91, 0x85, 0x9f, 0xa5, 0xf4, 0xd4, 0xdc, 0x52, 0x77, 
+  0x2a, 0x21, 0x5c, 0x01, 0xb1, 0xa2, 0x2b, 0x2a, 0xaf, 0xf8, 0x61, 0x9d, 0xf4, 0x60, 0x6f, 0x65, 
+  0x84, 0xa3, 0x96, 0x2b, 0xdf, 0x56, 0xa1, 0x11, 0xa9, 0x56, 0x66, 0xee, 0x1c, 0xef, 0x0d, 0xa5, 
+  0xb1, 0xf8, 0x52, 0xda, 0x54, 0x93, 0x91, 0xe2, 0x2e, 0x06, 0xc8, 0x64, 0xa1, 0xb4, 0x9a, 0x41, 
+  0xd2, 0x26, 0x68, 0xc4, 0xc0, 0xe3, 0x4b, 0xfe, 0x7c, 0x85, 0xd8, 0x91, 0x1c, 0x78, 0x10, 0xa2, 
+  0xc1, 0x9b, 0x9b, 0x9c, 0x3d, 0x54, 0xff, 0x37, 0xed, 0xdb, 0xb8, 0x4c, 0x12, 0xff, 0xb6, 0x66, 
+  0x6f, 0x3a, 0x13, 0x50, 0xae, 0x3f, 0xf6, 0x92, 0xad, 0x65, 0x23, 0x93, 0x07, 0x97, 0xc5, 0x64, 
+  0x77, 0x97, 0x9f, 0x39, 0x0c, 0x5f, 0x12, 0x5a, 0xca, 0x8b, 0x97, 0xe3, 0x24, 0xb8, 0xad, 0x8c, 
+  0x90, 0xfe, 0x5d, 0xb5, 0xe4, 0xd4, 0xd2, 0x44, 0xd9, 0x18, 0x76, 0x1a, 0xcc, 0x4e, 0xd1, 0xd4, 
+  0xd4, 0x99, 0x71, 0x5f, 0x53, 0x54, 0xcb, 0xf2, 0x04, 0x51, 0x48, 0x8b, 0x78, 0xbc, 0xa9, 0x87, 
+  0x05, 0x75, 0xaf, 0xf0, 0x4e, 0xf0, 0xa1, 0x2a, 0xfc, 0x00, 0x0f, 0x41, 0x31, 0xaa, 0xfb, 0x7b, 
+  0x61, 0x52, 0xdf, 0x62, 0xa2, 0x36, 0x0e, 0x93, 0x9d, 0x88, 0xb7, 0x5c, 0x19, 0xf6, 0x51, 0xb0, 
+  0x8d, 0x48, 0x45, 0xde, 0x5b, 0x5f, 0xbd, 0xe5, 0xd5, 0xf2, 0x4b, 0xc8, 0x54, 0xfa, 0xdc, 0xd3, 
+  0x8e, 0x47, 0x72, 0x7c, 0xe3, 0xf3, 0x8a, 0xc1, 0xdd, 0x7a, 0xb1, 0x53, 0xbc, 0x7b, 0x23, 0x4f, 
+  0x36, 0xef, 0x2f, 0x76, 0x49, 0xd8, 0x43, 0x5c, 0x22, 0x96, 0x96, 0xe1, 0x9c, 0x75, 0x57, 0xe0, 
+  0xce, 0xd9, 0xcb, 0x34, 0xf5, 0xd5, 0xce, 0xbd, 0x7b, 0x99, 0x18, 0x8d, 0xbd, 0xb0, 0xd6, 0x6e, 
+  0xfa, 0x36, 0xf8, 0x62, 0x78, 0x9e, 0x71, 0x9b, 0xd8, 0x74, 0x0a, 0x12, 0x13, 0xc8, 0x57, 0x87, 
+  0xe0, 0x58, 0xca, 0x72, 0x19, 0x3b, 0x22, 0xec, 0xa4, 0xe3, 0xa5, 0xd5, 0xbf, 0xe4, 0x74, 0x75, 
+  0xa4, 0x8b, 0x23, 0xfe, 0x51, 0x1c, 0x8c, 0xb8, 0x12, 0x7b, 0x30, 0xef, 0x03, 0x8d, 0x61, 0xbc, 
+  0xae, 0xe4, 0x03, 0x6f, 0x7e, 0xee, 0x60, 0xe3, 0x98, 0x35, 0x70, 0xb4, 0xf9, 0x05, 0xec, 0x7f, 
+  0xb5, 0x83, 0xa9, 0x55, 0xf3, 0x3d, 0xa8, 0x84, 0x0e, 0x93, 0x07, 0xd5, 0x66, 0x60, 0xdb, 0xc8, 
+  0x1f, 0x0b, 0x2e, 0xce, 0xd6, 0xe2, 0x06, 0x1f, 0x86, 0x3c, 0xe4, 0xe5, 0xb0, 0xcc, 0x6a, 0xb2, 
+  0x09, 0x2d, 0xb4, 0x2b, 0x6e, 0x6e, 0x5e, 0x12, 0x77, 0x0e, 0xd3, 0x2b, 0x59, 0x0a, 0xda, 0xe2, 
+  0x83, 0xc6, 0xe3, 0xcf, 0x09, 0x2e, 0xb4, 0x0e, 0x95, 0xab, 0xfb, 0x62, 0xf1, 0x45, 0x25, 0x3d, 
+  0xac, 0x13, 0x37, 0xa3, 0x49, 0x6a, 0x57, 0xeb, 0xd4, 0x34, 0x6f, 0x34, 0x5c, 0x7f, 0xd4, 0x2b, 
+  0x4e, 0xb2, 0xd5, 0x72, 0xce, 0x8e, 0x20, 0xda, 0xdf, 0x72, 0x7b, 0x55, 0x5a, 0x29, 0xf5, 0x95, 
+  0x75, 0xc9, 0x57, 0x5f, 0x5b, 0x19, 0xab, 0xb9, 0xbe, 0xae, 0x26, 0x7c, 0xb2, 0xa1, 0x1a, 0x1b, 
+  0xa5, 0x85, 0xfd, 0xef, 0x21, 0x62, 0xa1, 0xf9, 0x06, 0x90, 0x51, 0xc9, 0x91, 0x79, 0xbb, 0x1d, 
+  0x8f, 0xb6, 0xdd, 0xa4, 0x9d, 0x25, 0x53, 0x5b, 0xae, 0xc6, 0xca, 0x4a, 0x36, 0x90, 0x64, 0x10, 
+  0xa0, 0xdc, 0x46, 0xa1, 0xa2, 0xc7, 0x4d, 0x16, 0x57, 0xbc, 0x2e, 0x13, 0x8d, 0x22, 0xf3, 0xb2, 
+  0xd1, 0xab, 0xa6, 0x59, 0x19, 0x1d, 0x13, 0xad, 0x05, 0x67, 0x36, 0x7b, 0x31, 0x2a, 0x6a, 0x80, 
+  0x0f, 0x28, 0xad, 0x63, 0xdd, 0x86, 0x35, 0x3c, 0x32, 0xab, 0x77, 0x8f, 0xcd, 0x44, 0xc9, 0xce, 
+  0xf2, 0xe8, 0xd6, 0xad, 0xb5, 0xef, 0xb1, 0x5e, 0x2e, 0x55, 0x02, 0x2b, 0xe3, 0x63, 0x1e, 0xef, 
+  0xea, 0xa5, 0xd1, 0xcc, 0xc7, 0xf6, 0x18, 0x33, 0x49, 0xbc, 0xb5, 0xf5, 0xcc, 0xb6, 0x7c, 0x49, 
+  0x37, 0xe8, 0xd4, 0xb4, 0x3b, 0xbb, 0x6b, 0xb3, 0x13, 0x86, 0x4f, 0x11, 0xc4, 0x59, 0x4b, 0xaa, 
+  0xd9, 0xa6, 0x60, 0xd4, 0x91, 0x89, 0x09, 0x85, 0xc9, 0x25, 0x4b, 0xcb, 0x3a, 0x2c, 0xda, 0xe2, 
+  0xd7, 0xb5, 0xe9, 0x77, 0xe7, 0xcf, 0x06, 0xb3, 0x9b, 0x8d, 0xbc, 0x55, 0xb8, 0x12, 0x3f, 0x53, 
+  0xce, 0x1a, 0xcf, 0xe5, 0x8e, 0x80, 0x60, 0x73, 0xf5, 0x17, 0x37, 0x37, 0x2c, 0x46, 0x1c, 0x89, 
+  0x54, 0x6c, 0x9b, 0x48, 0x14, 0x73, 0xf8, 0x1e, 0xb0, 0x62, 0x66, 0xce, 0xa8, 0xc6, 0x95, 0x71, 
+  0xaa, 0x82, 0xc3, 0xd7, 0x68, 0x45, 0x4b, 0x74, 0xa5, 0x96, 0xbc, 0x44, 0x5b, 0xa9, 0x08, 0x8d, 
+  0xd9, 0x21, 0xf2, 0x5b, 0xfa, 0xe3, 0xc9, 0x34, 0xa0, 0xbb, 0x50, 0xb3, 0x61, 0x46, 0xde, 0x3b, 
+  0xf3, 0xb5, 0x58, 0xce, 0x2d, 0xcd, 0xac, 0xc8, 0xdf, 0xbc, 0x65, 0x07, 0x47, 0x67, 0xb8, 0xb7, 
+  0x1d, 0xc3, 0xa4, 0x01, 0x23, 0xef, 0x4b, 0x18, 0x39, 0x7d, 0xd1, 0x5c, 0xc2, 0x4e, 0x17, 0x61, 
+  0xbc, 0x9d, 0x1a, 0x37, 0x05, 0xca, 0x66, 0x89, 0x51, 0x6d, 0xc6, 0xea, 0xf6, 0x09, 0x12, 0x17, 
+  0x35, 0x1f, 0x84, 0x72, 0x8b, 0x4a, 0xf9, 0x16, 0x05, 0xab, 0x4f, 0xfd, 0x76, 0x88, 0xd8, 0xb8, 
+  0x83, 0xf0, 0x15, 0xc3, 0xd8, 0xe7, 0x6b, 0x6f, 0xa1, 0x96, 0xb0, 0x32, 0xf8, 0x02, 0x7e, 0x72, 
+  0x3b, 0x8f, 0x65, 0xf4, 0xf1, 0xa6, 0x57, 0x79, 0x88, 0x79, 0x41, 0xaf, 0xec, 0x0e, 0xcf, 0x5b, 
+  0xbc, 0x0a, 0x92, 0x13, 0x78, 0x18, 0x41, 0x73, 0xad, 0xd5, 0x5a, 0x79, 0x8b, 0xe9, 0x42, 0xae, 
+  0x0c, 0x41, 0x46, 0x29, 0x57, 0x37, 0xdf, 0x6a, 0x17, 0xc9, 0x7a, 0xbd, 0x6e, 0xb1, 0x38, 0x5b, 
+  0x34, 0x73, 0x86, 0xf9, 0xd1, 0xbb, 0x2a, 0x90, 0xbb, 0x25, 0x97, 0x2f, 0xcf, 0x8e, 0x65, 0x94, 
+  0xa8, 0x9d, 0x5b, 0xab, 0x86, 0x91, 0x79, 0xfd, 0xd1, 0x0c, 0x9c, 0x96, 0x93, 0xbd, 0xd6, 0xbc, 
+  0xc8, 0x1f, 0x47, 0x41, 0x8d, 0x86, 0xa6, 0xbc, 0x77, 0x1a, 0x6c, 0x13, 0x97, 0x51, 0x50, 0x5a, 
+  0x6d, 0x1d, 0xaf, 0x01, 0xef, 0x33, 0xc3, 0x9f, 0xc7, 0xd4, 0x22, 0x1b, 0x20, 0xdd, 0x39, 0xde, 
+  0x45, 0xde, 0xd8, 0x86, 0x74, 0x69, 0xd3, 0xbf, 0xdd, 0x5d, 0xe1, 0x31, 0x77, 0xc2, 0x1a, 0xf5, 
+  0x1b, 0xbb, 0x3f, 0x6a, 0xf0, 0x7b, 0x4a, 0xb0, 0x59, 0x46, 0xe5, 0x70, 0x11, 0xd3, 0xa8, 0xc2, 
+  0xdc, 0x16, 0x32, 0xc6, 0x3b, 0xe2, 0x0c, 0xc2, 0x82, 0xb8, 0x32, 0xfe, 0x35, 0x5f, 0x36, 0xcc, 
+  0xdb, 0x9c, 0x93, 0x47, 0x18, 0x08, 0xad, 0x47, 0xe9, 0x7f, 0x2c, 0x00, 0xf8, 0x3d, 0x8c, 0x96, 
+  0x9f, 0x21, 0xbb, 0x70, 0x2d, 0xae, 0x9d, 0x0a, 0x10, 0xd6, 0xd4, 0x63, 0x89, 0xd5, 0x93, 0x2c, 
+  0x5d, 0x24, 0xc7, 0x1d, 0x7d, 0x0e, 0x75, 0x34, 0x2e, 0x2d, 0x6c, 0xde, 0x30, 0x32, 0xbe, 0xf2, 
+  0x36, 0x96, 0x50, 0xa3, 0x84, 0x8d, 0x5c, 0xfe, 0xad, 0x83, 0x2b, 0xc3, 0xa2, 0xfe, 0x27, 0x63, 
+  0x2c, 0x5a, 0xa8, 0xae, 0xf1, 0x15, 0x4b, 0xe5, 0xaf, 0x19, 0x62, 0x55, 0x0e, 0xcf, 0x3e, 0x95, 
+  0xe5, 0x21, 0xb7, 0x7f, 0x96, 0x2d, 0x0f, 0x25, 0x7e, 0xa9, 0xd7, 0x52, 0x81, 0xf6, 0x6b, 0xd9, 
+  0x60, 0x5f, 0x6b, 0xbe, 0xcc, 0xf2, 0xf2, 0xb6, 0xaf, 0x28, 0x8b, 0xf3, 0x45, 0x1e, 0x63, 0x2a, 
+  0x0e, 0x57, 0x69, 0xb4, 0x2a, 0x4f, 0xb2, 0x3c, 0xf9, 0x23, 0x9e, 0xdf, 0x52, 0x40, 0xc7, 0x17, 
+  0x7d, 0xc6, 0x4b, 0xbb, 0xa5, 0x91, 0xf0, 0x2f, 0xa8, 0xbd, 0xa2, 0x0a, 0x6a, 0xbf, 0xff, 0xc4, 
+  0x12, 0xdb, 0x67, 0xa9, 0xc5, 0x7f, 0xb1, 0xc4, 0x36, 0x16, 0x50, 0x5b, 0x61, 0x8d, 0x5c, 0xa3, 
+  0xbf, 0xdc, 0xbf, 0xff, 0xd7, 0x5e, 0xc1, 0x76, 0xe7, 0xda, 0x1b, 0xe1, 0xd7, 0x5f, 0x7e, 0x0a, 
+  0x97, 0xc9, 0xd1, 0xf0, 0x23, 0x90, 0xe5, 0xce, 0xff, 0xf2, 0x7f, 0xdb, 0x8c, 0x5c, 0x5b, 0x43, 
+  0xac, 0x02, 0x00, 0x00 };
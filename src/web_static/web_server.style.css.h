@@ -1,2 +1,122 @@
-static const char CONTENT_STYLE_CSS[] PROGMEM = 
-  "body{font-family:sans-serif;color:#333;font:14px Helvetica,sans-serif;box-sizing:border-box}#page,body{background-color:#fff}#page{margin:20px}iframe{max-width:100%}table{width:100%;border-collapse:collapse}th{background-color:#777;color:#fff;border:1px solid #f1f1f1}td,th{padding:8px}td{color:#777;border:1px solid #e1e1e1}tr{background-color:#fff}tr:nth-child(2n+2){background-color:#f3f3f3}.wifiselected td{background-color:teal;color:#fff}.header{padding:20px}.header h1{padding-bottom:.3em;color:teal;font-size:45px;font-weight:400;text-align:left;margin:0}.header h1,.header h1 span{font-family:Garmond,\"sans-serif\"}.header h1 span{font-weight:700;color:#000}h2{padding-bottom:.2em;border-bottom:1px solid #eee;margin-top:2px}.header h3{padding-top:-5px;padding-left:50px;font-weight:700;font-family:Arial,\"sans-serif\";font-size:17px;color:#b6b6b6;margin:-25px 0 -5px}.box{padding:20px;border:1px solid #ddd;border-radius:1em 1em 1em 1em;box-shadow:1px 7px 7px 1px rgba(0,0,0,.4);background:#fff;margin-bottom:20px}.box-full{margin:20px;width:840px}.box380,.box-half{margin:20px;width:380px}.box380{padding:20px;border:1px solid #ddd;border-radius:1em 1em 1em 1em;box-shadow:1px 7px 7px 1px rgba(0,0,0,.4);background:#fff}.left{float:left;clear:left}.right{float:right;clear:right}@media (max-width:494px){#page{width:inherit;margin:5px auto}#content{padding:1px}.box380,.box-full{margin:8px 8px 12px;padding:10px;width:inherit;float:none}}@media (min-width:494px) and (max-width:980px){#page{width:465px;margin:0 auto}.box-full{width:380px}}@media (min-width:980px){#page{width:930px;margin:0 auto}}button{background-color:teal;border-radius:5px;box-shadow:0 2px 2px 0 rgba(0,0,0,.4);border:none;color:#fff;padding:10px 28px;text-align:center;text-decoration:none;display:inline-block;font-size:1em;margin:4px 2px;cursor:pointer;outline:none}button:disabled{background-color:#eee;color:#ccc}button.on{background-color:#f1f1f1;color:#000}input[type=date],input[type=file],input[type=number],input[type=password],input[type=text],input[type=time],select{box-sizing:border-box;border:1px solid #ddd;border-radius:4px;margin-top:10px;width:100%;padding:5px}input:optional{border-color:#ddd}input:required{border-color:#19a6ff}input:required:valid{border-color:#249c4a}input:required:valid+.validMessage{display:none}input:required+.validMessage{display:block;margin:5px 0}.setup input[type=time],input[type=time]{width:110px}.setup input[type=date]{width:164px}@media screen and (max-width:420px){input[type=file],input[type=number],input[type=password],input[type=text],select{width:240px}input[type=time]{width:85px}input[type=date]{width:174px}}#update{background-color:red}.container{height:inherit;padding-bottom:20px}.tabs{padding-bottom:4px;overflow:hidden}.tabs:after{content:\" \";display:block;height:0;clear:both}.tabs input[type=radio]{display:none}.tabs label{background:teal;border-radius:5px;box-shadow:0 2px 2px 0 rgba(0,0,0,.4);color:#fff;cursor:pointer;display:block;float:left;font-size:1em;height:2.5em;line-height:2.5em;margin-right:.25em;padding:0 1.5em;text-align:center}.tabs input:hover+label{background:#e1e1e1;color:#000}.tabs input:checked+label{background:#f1f1f1;color:#000}#content{background:#e1e1e1;border-radius:.5em .5em .5em .5em;box-shadow:1px 7px 7px 1px rgba(0,0,0,.4);display:block}#content:after{content:\" \";display:block;height:0;clear:both}#footer{font-size:15px;text-align:center;margin-bottom:0}.small-text{font-size:10px;word-wrap:break-word}.saved{border-color:#3c763d!important;border-left-width:5px!important}.warning{border-left-color:#aa6708;border-left-width:5px}.warning h4{color:#aa6708;margin-top:0;margin-bottom:5px}.error{border-left-color:#a94442;border-left-width:5px}.error h4{margin-top:0;margin-bottom:5px}.error h4,.error td{color:#a94442}.error td:first-child{border-left-color:#a94442;border-left-width:5px}.switch{position:relative;display:inline-block;width:40px;height:24px;vertical-align:-40%}.switch input{display:none}.slider{cursor:pointer;top:0;left:0;right:0;bottom:0;background-color:#ccc}.slider,.slider:before{position:absolute;-webkit-transition:.4s;transition:.4s}.slider:before{content:\"\";height:16px;width:16px;left:4px;bottom:4px;background-color:#fff}input:checked+.slider{background-color:teal}input:focus+.slider{box-shadow:0 0 1px teal}input:checked+.slider:before{-webkit-transform:translateX(16px);-ms-transform:translateX(16px);transform:translateX(16px)}.slider.round{border-radius:12px}.slider.round:before{border-radius:50%}.info{background-color:teal;border-radius:100%;color:#fff;display:inline-block;font-family:serif;font-size:12px;font-style:italic;height:16px;margin-left:16px;text-align:center;width:16px;vertical-align:20%}.info:before{content:\"i\"}span.selected{color:teal}.ready{border-color:#01c40e;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(1,196,14,.3)}.connected{border-color:#d5ff70;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(213,255,112,.4)}.charging{border-color:#0092f7;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(0,146,247,.4)}.sleeping{border-color:#9200f7;border-left-width:5px;box-shadow:1px 7px 7px 1px rgba(146,0,247,.4)}hr{height:1px;color:#eee;background-color:#eee;border:none}.updateBad{color:red}.updateGood{color:#32c832}.updateSlow{color:#f0b414}.updateSlower{color:#ff7d14}#progressBack{width:100%;border:1px solid #19a6ff;border-radius:4px}#progressBar{width:1%;height:30px;background-color:teal}#wifiList{display:inline-block;width:100%;max-height:230px;overflow:auto}.list-group{display:flex;flex-direction:column;padding-left:0;margin-bottom:0}.list-group-item{position:relative;display:flex;padding:.75rem 1.25rem;margin-bottom:-1px;background-color:#fff;border:1px solid rgba(0,0,0,.125);justify-content:space-between;align-items:center}.list-group-item.active{z-index:2;color:#fff;background-color:teal;border-color:teal}.list-group-item:first-child{border-top-left-radius:.25rem;border-top-right-radius:.25rem}.list-group-item:last-child{margin-bottom:0;border-bottom-right-radius:.25rem;border-bottom-left-radius:.25rem}.protocol select{width:80px}.protocol input{width:295px}@media screen and (max-width:420px){.protocol input{width:155px}}.divert select{width:110px}.divert input{width:265px}@media screen and (max-width:420px){.divert input{width:115px}}\n";
+static const char CONTENT_STYLE_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xc5, 0x58, 0xcd, 0x6f, 0xeb, 0xb8, 
+  0x11, 0xbf, 0xf7, 0xaf, 0x50, 0x13, 0x2c, 0xf0, 0x82, 0x67, 0x09, 0x92, 0x2c, 0xdb, 0xb1, 0x84, 
+  0x02, 0xed, 0x5e, 0xb6, 0x87, 0xf6, 0xd4, 0x4b, 0x81, 0x62, 0x0f, 0xb4, 0x44, 0x45, 0x6c, 0x68, 
+  0x51, 0xa5, 0xe8, 0x38, 0x59, 0x43, 0xff, 0x7b, 0x87, 0x5f, 0x12, 0x29, 0xc9, 0xaf, 0xd9, 0xb7, 
+  0x0b, 0x14, 0x86, 0x13, 0x99, 0x1c, 0xce, 0xf7, 0xfc, 0x66, 0xa8, 0x13, 0xab, 0x3e, 0x6e, 0x35, 
+  0x6b, 0x45, 0x58, 0xa3, 0x33, 0xa1, 0x1f, 0x79, 0x8f, 0xda, 0x3e, 0xec, 0x31, 0x27, 0x75, 0x51, 
+  0x32, 0xca, 0x78, 0xfe, 0xb8, 0xdd, 0x6e, 0x0b, 0x49, 0x91, 0x27, 0x59, 0xf7, 0x1e, 0xfc, 0x15, 
+  0xd3, 0x37, 0x2c, 0x48, 0x89, 0x36, 0x0e, 0xe5, 0x89, 0xbd, 0x87, 0x3d, 0xf9, 0x85, 0xb4, 0x2f, 
+  0xf9, 0x89, 0xf1, 0x0a, 0xf3, 0x10, 0x56, 0x86, 0xc7, 0x0e, 0xbd, 0xe0, 0xcd, 0x49, 0x4a, 0x38, 
+  0xa1, 0xf2, 0xf5, 0x85, 0xb3, 0x4b, 0x5b, 0x85, 0x86, 0x6b, 0x5d, 0xd7, 0x9a, 0xe0, 0x76, 0x46, 
+  0xfc, 0x85, 0xb4, 0x79, 0x1a, 0x77, 0xef, 0x03, 0xa9, 0x39, 0x3a, 0xcb, 0xa5, 0xf7, 0xf0, 0x4a, 
+  0x2a, 0xd1, 0xe4, 0x49, 0x1c, 0xff, 0x30, 0x08, 0x74, 0xa2, 0xf8, 0x36, 0x2d, 0x14, 0x46, 0x08, 
+  0xb0, 0xa2, 0xa8, 0xeb, 0x71, 0x6e, 0x1f, 0x06, 0xd1, 0xac, 0x88, 0x3a, 0x1c, 0x0e, 0xc5, 0x24, 
+  0xd5, 0x1c, 0xce, 0x13, 0x30, 0xa6, 0x67, 0x94, 0x54, 0xc1, 0x63, 0x9d, 0xc8, 0xcf, 0x20, 0xaa, 
+  0x0d, 0x9c, 0xef, 0x50, 0x55, 0x49, 0x43, 0x9e, 0x41, 0x1d, 0x51, 0xdd, 0x1c, 0x1e, 0xcb, 0x83, 
+  0x38, 0x91, 0x9f, 0x41, 0xf0, 0x3b, 0x06, 0x0a, 0x9e, 0xb7, 0xa2, 0x09, 0xcb, 0x86, 0xd0, 0xea, 
+  0x4b, 0xda, 0x7e, 0x4d, 0x9f, 0xd6, 0x08, 0xb7, 0xf2, 0x33, 0x44, 0x57, 0x52, 0x93, 0x1e, 0x53, 
+  0x5c, 0x0a, 0x5c, 0x05, 0x20, 0x79, 0x41, 0x29, 0x30, 0xa2, 0x8e, 0x21, 0x43, 0xd4, 0x60, 0x04, 
+  0x0a, 0x8d, 0x1a, 0x2b, 0x0f, 0x9a, 0xc5, 0xa0, 0x49, 0xec, 0x3a, 0xc4, 0x42, 0x08, 0x76, 0xce, 
+  0xa3, 0x2d, 0x3e, 0x17, 0x0e, 0x27, 0x15, 0x75, 0x88, 0x1a, 0xce, 0xb3, 0x5d, 0xf7, 0xae, 0x7f, 
+  0x5e, 0x31, 0x79, 0x69, 0x44, 0x9e, 0xc5, 0x71, 0x21, 0xf0, 0xbb, 0x08, 0x11, 0x25, 0x2f, 0x6d, 
+  0x4e, 0x71, 0x2d, 0x0a, 0x13, 0xa6, 0xd8, 0x91, 0xb0, 0x99, 0x1e, 0x83, 0xbe, 0x43, 0xad, 0x97, 
+  0x48, 0x3f, 0x21, 0x7e, 0x66, 0x6d, 0xb5, 0x79, 0x98, 0xf2, 0xe4, 0x61, 0x58, 0x3d, 0x60, 0x84, 
+  0x1e, 0x40, 0xa8, 0xb1, 0x2e, 0x8e, 0xe3, 0xa1, 0x49, 0x17, 0x06, 0xa4, 0x60, 0xc0, 0x98, 0x5f, 
+  0x6a, 0xc9, 0x8d, 0x05, 0xc6, 0x46, 0xc7, 0x50, 0xb0, 0x2e, 0x4f, 0x5d, 0x5f, 0x6c, 0x47, 0x56, 
+  0x72, 0x2b, 0x94, 0xe6, 0xda, 0x05, 0x69, 0x5b, 0xbe, 0x8b, 0x67, 0x0e, 0x90, 0xba, 0xb8, 0xc6, 
+  0xfc, 0x85, 0x13, 0x44, 0x3d, 0x53, 0x1c, 0xf7, 0x25, 0x07, 0x38, 0x6d, 0x34, 0x3f, 0xed, 0xe5, 
+  0xc7, 0x3a, 0x2b, 0x4c, 0x41, 0x54, 0x10, 0x07, 0x52, 0xe2, 0x10, 0x41, 0x4d, 0x78, 0xb1, 0x5a, 
+  0x49, 0xa8, 0xaa, 0xaa, 0xac, 0x85, 0x1c, 0x55, 0xe4, 0xd2, 0xe7, 0x09, 0x3e, 0x07, 0xce, 0x57, 
+  0x97, 0x5a, 0x83, 0x2a, 0x76, 0x55, 0xe7, 0x0e, 0xe6, 0x2b, 0x9f, 0xf9, 0xcb, 0x09, 0x7d, 0x89, 
+  0x37, 0xf2, 0x13, 0x65, 0x4f, 0xc5, 0x94, 0x3f, 0x3a, 0xef, 0x8d, 0x73, 0x8c, 0xe7, 0x74, 0xb2, 
+  0x48, 0x6e, 0xf5, 0x85, 0x52, 0xb7, 0x08, 0x0b, 0x5d, 0x68, 0xcf, 0x99, 0xa5, 0xd8, 0x3e, 0x03, 
+  0x43, 0x49, 0xd9, 0x20, 0x5a, 0xaf, 0x50, 0xc2, 0xfe, 0x44, 0xf9, 0x7f, 0xb4, 0x70, 0x88, 0x64, 
+  0x30, 0x6f, 0x35, 0x65, 0x48, 0xe8, 0x9c, 0x2d, 0x29, 0x46, 0x5c, 0x3d, 0x0e, 0x11, 0x97, 0x81, 
+  0x35, 0x9b, 0xea, 0xd9, 0xec, 0xaa, 0xe7, 0xe1, 0xcf, 0x67, 0x5c, 0x11, 0x14, 0x7c, 0x99, 0x90, 
+  0x27, 0x3b, 0x02, 0xdc, 0x3d, 0xdd, 0x34, 0x46, 0xe9, 0x25, 0xd2, 0x36, 0x10, 0xfb, 0xb1, 0x14, 
+  0x64, 0x6c, 0xd1, 0x45, 0xb0, 0xe1, 0xb1, 0x84, 0x5c, 0xc0, 0xad, 0x18, 0x6d, 0x4f, 0xe6, 0x9e, 
+  0x73, 0x7d, 0x0c, 0xc0, 0x12, 0xc8, 0x6f, 0x92, 0x4e, 0x69, 0x08, 0xb0, 0x36, 0xba, 0xd3, 0x4a, 
+  0xd1, 0xaa, 0xb6, 0xac, 0xc5, 0xc3, 0xa4, 0x1e, 0x04, 0xd0, 0x55, 0x2f, 0x40, 0x6d, 0xe5, 0x2a, 
+  0x7d, 0x94, 0xa1, 0xf0, 0x95, 0xce, 0xf6, 0x32, 0xdd, 0x6d, 0xf5, 0x6a, 0x85, 0x27, 0x9d, 0xdc, 
+  0x08, 0xae, 0x48, 0x59, 0xe1, 0x77, 0xdc, 0xc6, 0x0b, 0x7e, 0xc3, 0xe9, 0x02, 0x49, 0xd5, 0xde, 
+  0x81, 0x2c, 0x3f, 0xdc, 0x3b, 0x95, 0x16, 0x63, 0x88, 0xe3, 0x00, 0xdc, 0xa0, 0xbe, 0xf1, 0x22, 
+  0xbc, 0x3a, 0x79, 0xa4, 0x07, 0x5c, 0xfc, 0x76, 0x5d, 0x16, 0xa4, 0xe0, 0x49, 0x17, 0xaa, 0x4a, 
+  0x08, 0x03, 0xe6, 0x7a, 0xa5, 0xc2, 0x25, 0xe3, 0x48, 0x10, 0xd6, 0x6a, 0x1e, 0x15, 0xe9, 0x3b, 
+  0x8a, 0x3e, 0xc0, 0xc1, 0x94, 0xb4, 0x38, 0x3c, 0x51, 0x56, 0xbe, 0xba, 0x65, 0x0c, 0xb9, 0x67, 
+  0xcc, 0xca, 0xb4, 0x4a, 0x45, 0x79, 0xe1, 0x3d, 0x88, 0xed, 0x18, 0x51, 0x5c, 0xd9, 0x45, 0xc8, 
+  0x93, 0x3a, 0x26, 0xda, 0xe4, 0x1c, 0x98, 0xca, 0xee, 0xb4, 0x02, 0xd7, 0x0a, 0x91, 0xcc, 0x63, 
+  0x59, 0x96, 0xe6, 0x40, 0xb4, 0xe6, 0x26, 0xd3, 0x81, 0x5c, 0xf8, 0x23, 0x6d, 0x77, 0x11, 0xff, 
+  0x12, 0x1f, 0x1d, 0xfe, 0x53, 0x85, 0x04, 0xfe, 0x79, 0xe3, 0x2c, 0xd4, 0x84, 0xfa, 0x0b, 0xed, 
+  0xe5, 0x7c, 0xc2, 0xdc, 0x5b, 0xea, 0x50, 0xdf, 0x5f, 0xc1, 0x81, 0xde, 0xa2, 0x74, 0x8b, 0xbf, 
+  0x40, 0xce, 0xc0, 0x49, 0x77, 0x9d, 0xdb, 0x6a, 0x17, 0xff, 0x54, 0x09, 0x67, 0x63, 0x46, 0x28, 
+  0x80, 0x75, 0x92, 0x59, 0xb5, 0x6b, 0x1b, 0x31, 0x89, 0x82, 0x4a, 0x78, 0xce, 0x3a, 0x19, 0x16, 
+  0x44, 0x6f, 0x53, 0x27, 0x97, 0x86, 0x03, 0x67, 0x43, 0xc0, 0xf1, 0x7f, 0x2e, 0x84, 0x4b, 0xb7, 
+  0x7a, 0x04, 0xc9, 0x11, 0xed, 0xa1, 0xd0, 0x7d, 0x9a, 0xfc, 0x0d, 0x62, 0x3f, 0xa7, 0x4c, 0xb3, 
+  0x63, 0x99, 0xa1, 0x55, 0xca, 0xaf, 0x91, 0xfa, 0xf7, 0x77, 0xdc, 0xf7, 0x32, 0xad, 0x6d, 0x5a, 
+  0xa8, 0xa8, 0xfa, 0xf4, 0x77, 0x28, 0x75, 0xe6, 0x38, 0x28, 0x00, 0x4d, 0xb1, 0xc7, 0xe2, 0xd2, 
+  0x05, 0x0b, 0xd7, 0xce, 0x17, 0xec, 0x14, 0x93, 0x28, 0xc8, 0x5c, 0x1c, 0x52, 0xa1, 0xb6, 0x34, 
+  0x7b, 0x70, 0xab, 0xad, 0xc9, 0xbe, 0xe4, 0x18, 0xb7, 0xf3, 0x72, 0xcf, 0x52, 0x55, 0x9e, 0xbf, 
+  0x5f, 0x6a, 0x98, 0x4c, 0xd0, 0xdc, 0x53, 0xd5, 0x01, 0xee, 0x58, 0xf0, 0xbc, 0xf3, 0xf7, 0x3c, 
+  0xcd, 0x0f, 0x52, 0xf3, 0xe1, 0xf1, 0xd2, 0xc9, 0xd5, 0x65, 0xba, 0x83, 0x67, 0x87, 0x48, 0x62, 
+  0x26, 0x82, 0x6a, 0xe2, 0xb7, 0x46, 0xf7, 0x5c, 0x8b, 0x7b, 0xb3, 0xae, 0xaf, 0x1b, 0x15, 0x8c, 
+  0x80, 0xfd, 0x7c, 0x1e, 0x90, 0x59, 0xc7, 0xde, 0x30, 0x07, 0xa0, 0xbc, 0xe6, 0x0d, 0xa9, 0x2a, 
+  0xdc, 0x6a, 0xc2, 0x1c, 0xd5, 0x50, 0xae, 0x37, 0x83, 0xca, 0xf9, 0x43, 0xf0, 0x50, 0xf8, 0xa1, 
+  0x33, 0x12, 0x63, 0xd3, 0x02, 0x80, 0x5f, 0xa3, 0x4f, 0xba, 0xb1, 0x90, 0xb9, 0xcd, 0x7e, 0xf6, 
+  0xd3, 0x43, 0x13, 0x51, 0x74, 0xc2, 0xd4, 0x31, 0xeb, 0xb7, 0xc1, 0x9c, 0x03, 0x6d, 0x33, 0xbc, 
+  0xf1, 0x95, 0x76, 0xfa, 0x9a, 0x0f, 0x5a, 0xc6, 0x9a, 0x34, 0xda, 0xc1, 0x0f, 0x05, 0x6d, 0xde, 
+  0x8a, 0x29, 0x4c, 0xd5, 0xe7, 0x60, 0x86, 0x92, 0x4b, 0xb6, 0x20, 0xe3, 0x20, 0x51, 0x24, 0x0b, 
+  0x00, 0x75, 0xbd, 0x91, 0x37, 0xd2, 0xc9, 0x5f, 0x17, 0x46, 0x9b, 0xe9, 0xd7, 0x05, 0x2d, 0xf7, 
+  0x54, 0xd9, 0xe0, 0xf2, 0x15, 0x4a, 0x68, 0x79, 0x6e, 0x09, 0x76, 0x63, 0x03, 0x5d, 0x61, 0xef, 
+  0xbb, 0x55, 0xaa, 0x1b, 0xf8, 0x7f, 0x7e, 0xc5, 0xc0, 0xe0, 0x39, 0x74, 0x94, 0xfa, 0x5d, 0xe9, 
+  0xf2, 0x58, 0x33, 0x26, 0x4f, 0x39, 0xa1, 0xd8, 0xad, 0xb6, 0x22, 0x7f, 0xec, 0x92, 0x48, 0x71, 
+  0x46, 0x94, 0x86, 0x92, 0xd0, 0x3d, 0xac, 0x20, 0x13, 0x4c, 0x0d, 0xaf, 0x1c, 0x75, 0xf9, 0x89, 
+  0x63, 0xf4, 0x1a, 0xca, 0xdf, 0x40, 0x8f, 0xde, 0x16, 0x38, 0xb8, 0x2d, 0x0f, 0xfb, 0x6d, 0xf5, 
+  0x47, 0x72, 0xee, 0x18, 0x17, 0xa8, 0x15, 0xd6, 0x4b, 0x32, 0x3b, 0x0c, 0x36, 0x80, 0x36, 0xd3, 
+  0x3e, 0xdc, 0x2e, 0x10, 0x6f, 0x21, 0xe4, 0x37, 0x97, 0xd0, 0x30, 0x43, 0x68, 0x7f, 0x88, 0x9f, 
+  0xd7, 0x59, 0x8c, 0x07, 0x83, 0x26, 0xbb, 0xf9, 0xf4, 0x0e, 0xe0, 0xc7, 0x33, 0x2b, 0xd5, 0x41, 
+  0xcc, 0x39, 0xe3, 0xab, 0xf2, 0x8e, 0x59, 0x96, 0xa5, 0xf7, 0xe4, 0xa9, 0x63, 0x52, 0xda, 0xa7, 
+  0xf8, 0x03, 0xe1, 0xc6, 0x3c, 0x4d, 0x97, 0x35, 0x2d, 0x60, 0x18, 0xd7, 0xf3, 0x9a, 0xf0, 0x5e, 
+  0xe8, 0x6b, 0xd8, 0xaf, 0x57, 0xa8, 0xbf, 0x12, 0x51, 0xc2, 0xbd, 0x90, 0xf5, 0x44, 0xcd, 0x12, 
+  0x1c, 0x53, 0x18, 0x2a, 0xde, 0xee, 0xcc, 0x13, 0x06, 0x98, 0x65, 0x38, 0x6d, 0x15, 0x4a, 0x9c, 
+  0x82, 0x0a, 0x92, 0x97, 0x66, 0x6a, 0x72, 0x23, 0xcc, 0xe0, 0x5a, 0x6b, 0x38, 0xeb, 0x7a, 0x99, 
+  0xe1, 0x4c, 0x0f, 0x6d, 0x47, 0xe6, 0xa4, 0x0f, 0x08, 0xda, 0x17, 0xea, 0xca, 0x12, 0x17, 0xdc, 
+  0x24, 0xa5, 0xcd, 0xac, 0x62, 0x39, 0x56, 0xc8, 0xb1, 0xc3, 0xb0, 0xda, 0x98, 0xff, 0xf9, 0x09, 
+  0xd7, 0x8c, 0xe3, 0xc9, 0x1c, 0xa8, 0x58, 0x46, 0x2f, 0x02, 0x17, 0x70, 0xf7, 0x39, 0xbd, 0x12, 
+  0x11, 0x0a, 0x0e, 0xb7, 0x1c, 0xbd, 0x17, 0x65, 0x7d, 0xe1, 0xff, 0x1c, 0x66, 0x6c, 0xc6, 0xa2, 
+  0x79, 0xb0, 0xe6, 0x26, 0xfb, 0xa9, 0xf9, 0xcb, 0x47, 0xa5, 0x6d, 0xa6, 0xd0, 0x70, 0x44, 0xed, 
+  0xf5, 0xdb, 0xb2, 0x8f, 0x1b, 0xd6, 0x05, 0xab, 0x33, 0xa5, 0xa1, 0xad, 0x59, 0x79, 0xe9, 0x27, 
+  0x4a, 0x17, 0x6e, 0x63, 0x55, 0xff, 0x0e, 0xed, 0x8c, 0xaf, 0x35, 0xc0, 0xb3, 0x1a, 0x56, 0xce, 
+  0xb9, 0x7a, 0x82, 0x10, 0xe3, 0x7f, 0x7e, 0x91, 0x06, 0x3c, 0x15, 0xe1, 0xb9, 0xff, 0xd6, 0xf6, 
+  0xfd, 0x2d, 0xeb, 0xac, 0x48, 0xa9, 0x7f, 0x9b, 0x5d, 0x7b, 0xd4, 0x0d, 0xd5, 0x25, 0xb0, 0x2a, 
+  0xcd, 0x1a, 0x89, 0xcc, 0x14, 0xd2, 0xd6, 0xec, 0x53, 0xd3, 0xb5, 0x9a, 0xb7, 0x9c, 0x8e, 0x72, 
+  0x7f, 0xe6, 0xb5, 0xef, 0x7b, 0xd4, 0x0b, 0x1c, 0x07, 0x88, 0x52, 0x7b, 0x15, 0xee, 0xc5, 0x07, 
+  0xc5, 0x39, 0x11, 0x90, 0xb1, 0xa5, 0x17, 0x5c, 0x53, 0x8b, 0x2a, 0xb0, 0x6a, 0x61, 0x09, 0x7a, 
+  0x4e, 0xfc, 0x67, 0x99, 0x9f, 0x5a, 0x73, 0x16, 0x19, 0x44, 0x1e, 0x06, 0xf9, 0x4e, 0x20, 0xb2, 
+  0xef, 0x40, 0x6e, 0x4e, 0xb8, 0x23, 0xc0, 0x43, 0xf9, 0x1a, 0xc9, 0x03, 0xc1, 0x38, 0x29, 0xb3, 
+  0x18, 0xaf, 0x97, 0xed, 0xff, 0x6c, 0x0a, 0xc9, 0x26, 0x39, 0xee, 0x37, 0x09, 0xa0, 0xc7, 0xf6, 
+  0x49, 0x0d, 0x23, 0xad, 0x16, 0x3a, 0x1b, 0x48, 0x77, 0x75, 0x7d, 0x88, 0xbf, 0x53, 0x44, 0x9a, 
+  0x6c, 0x37, 0xe9, 0x6e, 0xb7, 0x49, 0x92, 0x54, 0x76, 0x1f, 0x90, 0xd2, 0x28, 0xcf, 0xbd, 0xcc, 
+  0xed, 0x88, 0x8f, 0x69, 0x7d, 0xf8, 0x4e, 0x21, 0x31, 0xd8, 0xb0, 0xdf, 0xa4, 0xd9, 0x41, 0x8b, 
+  0xe8, 0x29, 0xc6, 0xdd, 0x52, 0xc4, 0x31, 0x8d, 0xe3, 0xef, 0x16, 0x21, 0x05, 0xc4, 0xa3, 0x88, 
+  0x66, 0x1c, 0xd8, 0x92, 0xe9, 0xb5, 0x87, 0xbc, 0xea, 0xac, 0x5f, 0x80, 0x9c, 0x4b, 0xdc, 0x10, 
+  0xe9, 0x81, 0xf0, 0x47, 0x64, 0x63, 0xab, 0x06, 0x41, 0xbd, 0xf8, 0x13, 0x63, 0x23, 0x7e, 0x6f, 
+  0xd3, 0xf2, 0x79, 0x9b, 0xda, 0x9d, 0x7f, 0xc0, 0x78, 0x67, 0x77, 0xea, 0xf8, 0x94, 0x25, 0x99, 
+  0xbb, 0xa3, 0x1a, 0xb7, 0x49, 0xf7, 0x43, 0x05, 0x7b, 0x8f, 0x1d, 0x67, 0x2f, 0x1c, 0x26, 0xf6, 
+  0x1f, 0x41, 0x9f, 0xe5, 0x4b, 0x43, 0xf7, 0x22, 0xa3, 0x6f, 0x13, 0xcb, 0xbb, 0x8c, 0xcb, 0x83, 
+  0x5b, 0x16, 0x3f, 0xd8, 0x1a, 0x50, 0xf7, 0xdf, 0x75, 0x54, 0x7a, 0x94, 0xef, 0xf0, 0xfe, 0x46, 
+  0xfa, 0x09, 0xcd, 0x57, 0x7a, 0x83, 0x52, 0x46, 0xce, 0xf0, 0xb6, 0x3f, 0x28, 0x86, 0xe3, 0x20, 
+  0xab, 0x2f, 0xe8, 0x14, 0x98, 0x84, 0x52, 0x40, 0x37, 0xb2, 0xaa, 0x29, 0x86, 0xca, 0x84, 0x3f, 
+  0x61, 0x05, 0x77, 0x93, 0x52, 0x21, 0x32, 0xc8, 0xbe, 0x9c, 0x5b, 0xff, 0x65, 0x56, 0xbc, 0x1c, 
+  0x39, 0x26, 0x6e, 0x21, 0x11, 0xf8, 0xfc, 0x8d, 0x5e, 0xa6, 0x84, 0xd8, 0xf1, 0x30, 0x3a, 0xec, 
+  0xb8, 0x7c, 0x29, 0x03, 0x43, 0x23, 0x9f, 0x06, 0x49, 0xc3, 0x36, 0x4c, 0xee, 0x01, 0xf9, 0xd2, 
+  0xd3, 0xee, 0x18, 0x96, 0xa4, 0xbb, 0xa7, 0xe2, 0xdf, 0x97, 0x5e, 0x90, 0xfa, 0x23, 0xb4, 0xc5, 
+  0x0f, 0x85, 0x5f, 0x82, 0x97, 0xb0, 0xb8, 0xc2, 0x2d, 0xa7, 0x50, 0x48, 0xa1, 0x34, 0xed, 0xc7, 
+  0x79, 0x74, 0x66, 0x42, 0x84, 0x4a, 0xa9, 0xf7, 0xed, 0x97, 0x90, 0xb4, 0x15, 0x7e, 0xcf, 0x53, 
+  0xef, 0x0d, 0xef, 0xb7, 0x80, 0xd2, 0x45, 0x95, 0x19, 0xd3, 0xb5, 0x39, 0x01, 0x5a, 0xae, 0xae, 
+  0x17, 0x3b, 0x80, 0x6a, 0x5f, 0x38, 0xbb, 0xaa, 0x0f, 0xfb, 0xdb, 0x4b, 0xce, 0x14, 0x8d, 0x8c, 
+  0x67, 0xd1, 0xf1, 0xdf, 0x68, 0xae, 0x71, 0x9b, 0x51, 0x2c, 0xb5, 0x19, 0x22, 0xc8, 0x57, 0xc1, 
+  0xc0, 0xb2, 0xc0, 0xbb, 0xc0, 0xe9, 0xf7, 0x72, 0xe3, 0x9e, 0x9e, 0x33, 0xcc, 0xdd, 0xee, 0xb8, 
+  0xfb, 0xe4, 0xe5, 0x72, 0xfd, 0x7c, 0xb2, 0x93, 0xe7, 0x87, 0xa8, 0x22, 0x12, 0xdf, 0x7d, 0xb1, 
+  0xe6, 0x72, 0x6b, 0xb6, 0x3c, 0xa9, 0xfb, 0x4f, 0x4b, 0x5d, 0x39, 0x9d, 0x24, 0x4a, 0xe6, 0x1f, 
+  0xfe, 0x0b, 0xbf, 0xae, 0xed, 0x2d, 0xb4, 0x18, 0x00, 0x00, 0x00 };
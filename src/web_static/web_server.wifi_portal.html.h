@@ -1,2 +1,89 @@
-static const char CONTENT_WIFI_PORTAL_HTML[] PROGMEM = 
-  "<!doctype html> <html lang=\"en\"> <head> <meta charset=\"utf-8\"> <title>OpenEVSE</title> <meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"> <meta name=\"viewport\" content=\"width=device-width,user-scalable=no\"> <meta name=\"description\" content=\"OpenEVSE\"> <meta name=\"author\" content=\"OpenEVSE\"> <meta name=\"theme-color\" content=\"#000000\"> <link rel=\"stylesheet\" type=\"text/css\" href=\"style.css\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-32x32.png\" sizes=\"32x32\"> <link rel=\"icon\" type=\"image/png\" href=\"favicon-16x16.png\" sizes=\"16x16\"> </head> <body> <div id=\"page\"> <div class=\"header\"> <h1>Open<span>EVSE</span></h1> <h3>WiFi</h3> </div> <div class=\"container\"> <div class=\"box\" data-bind=\"visible: wifi.canConfigure() &amp;&amp; !wifi.wifiConnecting()\"> <h2>WiFi Setup</h2> <p><b>Mode:</b> <span id=\"mode\" data-bind=\"text: status.fullMode\"></span></p> <p>Connect to network:</p> <div id=\"wifiList\"> <ul class=\"list-group\" data-bind=\"foreach: scan.filteredResults, visible: 0 != scan.results().length\"> <li class=\"list-group-item\" data-bind=\"click: $root.wifi.select, css: { active: $root.wifi.selectedNet() === $data }\"> <span data-bind=\"text: ssid\"></span> <img width=\"24px\" height=\"24px\" data-bind=\"attr:{src: 'wifi_signal_'+strength()+'.svg'}\"> </li> </ul> </div> <div data-bind=\"visible: 0 == scan.results().length\"> Scanning... </div> <p> <b>SSID:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: config.ssid\"> </p> <p> <b>Passkey:</b><br> <input type=\"text\" autocapitalize=\"none\" data-bind=\"textInput: wifiPassword.value, attr: { type: wifiPassword.show() ? 'text' : 'password' }\"><br> </p><div> <input id=\"wifipassword\" type=\"checkbox\" data-bind=\"checked: wifiPassword.show\"> <label for=\"wifipassword\">Show password</label> </div> <p></p> <p> <button data-bind=\"click: wifi.saveNetwork, text: (wifi.saveNetworkFetching() ? 'Saving' : (wifi.saveNetworkSuccess() ? 'Saved' : 'Connect')), disable: wifi.saveNetworkFetching\">Connect</button> </p> <p>Connecting to a local WiFi network is not essential. OpenEVSE can be configured and controlled while in standalone WiFi AP (Access Point) mode:</p> <div> <button onclick=\"window.location.href='/home.html'\">WiFi Standalone Mode</button> </div> <p><i><span class=\"small-text\">Note: remote logging features e.g Emoncms will not work while in AP standalone mode</span></i></p> </div> <div class=\"box\" data-bind=\"visible: wifi.wifiConnecting() || !wifi.canConfigure()\"> <h2>Connecting to <span data-bind=\"text: config.ssid\"></span> ...</h2> <p>Please connect this device to <span data-bind=\"text: config.ssid\"></span> and navigate to the IP address displayed on your OpenEVSE display.</p> <p>Alternatively you can use <a data-bind=\"attr: { href: 'http://' + config.hostname() + '.local/' }, text: 'http://' + config.hostname() + '.local/'\"></a> or <a data-bind=\"attr: { href: 'http://' + config.hostname() + '/' }, text: 'http://' + config.hostname() + '/'\"></a></p> <div id=\"client-view\" data-bind=\"visible: status.isWifiClient\"> <button id=\"apoff\" data-bind=\"click: wifi.turnOffAccessPoint, disable: wifi.turnOffAccessPointFetching\">Continue</button> </div> </div> <div id=\"footer\"> <br><b> Powered by <a href=\"http://www.openevse.com\">OpenEVSE</a> and <a href=\"https://openenergymonitor.org\">OpenEnergyMonitor</a></b> <br> <b>Version: </b>V<span data-bind=\"text: config.version\"></span> </div> </div> </div> <script src=\"lib.js\"></script> <script src=\"wifi_portal.js\"></script> </body> </html> \n";
+static const char CONTENT_WIFI_PORTAL_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xad, 0x57, 0x51, 0x8f, 0xdb, 0x36, 
+  0x0c, 0x7e, 0xdf, 0xaf, 0x60, 0xbd, 0x62, 0xb9, 0xe0, 0x2e, 0x4e, 0xef, 0x6e, 0x28, 0x86, 0x2c, 
+  0xc9, 0x50, 0x6c, 0x2d, 0x50, 0x60, 0x6d, 0x0f, 0x0b, 0xd0, 0x3e, 0x16, 0x8a, 0xcd, 0xd8, 0xda, 
+  0xc9, 0x92, 0x21, 0xc9, 0xc9, 0x65, 0x6d, 0xff, 0xfb, 0x48, 0xc9, 0x4e, 0xe2, 0x24, 0xed, 0xd6, 
+  0x6e, 0xf7, 0x10, 0x9f, 0x25, 0x8a, 0xa4, 0xc8, 0x8f, 0x1f, 0xe9, 0xe9, 0xa3, 0xdc, 0x64, 0x7e, 
+  0x5b, 0x23, 0x94, 0xbe, 0x52, 0x73, 0x98, 0xf2, 0x03, 0x94, 0xd0, 0xc5, 0x2c, 0x41, 0x9d, 0xf0, 
+  0x02, 0x8a, 0x9c, 0x1e, 0x15, 0x7a, 0x01, 0x59, 0x29, 0xac, 0x43, 0x3f, 0x4b, 0x1a, 0xbf, 0x1a, 
+  0xfd, 0xc4, 0xbb, 0x5e, 0x7a, 0x85, 0xf3, 0x37, 0x35, 0xea, 0xe7, 0x6f, 0x17, 0xcf, 0xa7, 0xe3, 
+  0xf8, 0xde, 0x8a, 0x6b, 0x51, 0xe1, 0x2c, 0x59, 0x4b, 0xdc, 0xd4, 0xc6, 0xfa, 0x04, 0x32, 0xa3, 
+  0x3d, 0x6a, 0x3a, 0xbe, 0x91, 0xb9, 0x2f, 0x67, 0x39, 0xae, 0x65, 0x86, 0xa3, 0xf0, 0x72, 0x25, 
+  0xb5, 0xf4, 0x52, 0xa8, 0x91, 0xcb, 0x84, 0xc2, 0xd9, 0x75, 0xf2, 0x2d, 0x3a, 0x1a, 0x87, 0x36, 
+  0x28, 0x10, 0x4b, 0xd2, 0xa1, 0xcd, 0x91, 0x92, 0x1c, 0x5d, 0x66, 0x65, 0xed, 0xa5, 0xd1, 0x07, 
+  0x7a, 0x3a, 0xdf, 0x8f, 0x84, 0x45, 0xe3, 0x4b, 0x63, 0xff, 0x59, 0xce, 0x97, 0x58, 0xe1, 0x28, 
+  0x33, 0xaa, 0x27, 0xfc, 0xfd, 0x93, 0xf0, 0xc7, 0xb2, 0x4a, 0xea, 0x7b, 0xb0, 0xa8, 0x66, 0x89, 
+  0xf3, 0x5b, 0x85, 0xae, 0x44, 0xa4, 0x6b, 0x70, 0xc8, 0xe9, 0x30, 0x3e, 0xf8, 0x71, 0xe6, 0x5c, 
+  0x02, 0xa5, 0xc5, 0x55, 0x2b, 0x91, 0xf2, 0x42, 0xef, 0xa0, 0xcc, 0xd8, 0xe3, 0x78, 0x44, 0x56, 
+  0xa2, 0xc0, 0x71, 0xad, 0x8b, 0xee, 0xcc, 0x4a, 0xac, 0x79, 0x7f, 0x74, 0x7b, 0xf3, 0x70, 0x7b, 
+  0x93, 0x86, 0x0d, 0x27, 0xff, 0x42, 0x37, 0x4b, 0xc2, 0xca, 0x37, 0x68, 0xba, 0x7e, 0xfa, 0x70, 
+  0xfd, 0xb4, 0xa7, 0x29, 0xac, 0xb0, 0xa6, 0x71, 0x8b, 0x86, 0xa5, 0xc9, 0xb7, 0xf4, 0xc8, 0xe5, 
+  0x1a, 0x64, 0x3e, 0x4b, 0x6a, 0xd2, 0x94, 0xb4, 0xef, 0x99, 0x12, 0x8e, 0x8e, 0xb0, 0x20, 0xda, 
+  0x00, 0xa0, 0xeb, 0x80, 0x8f, 0xa9, 0xab, 0x85, 0x9e, 0x47, 0x94, 0x84, 0x7f, 0x49, 0xd9, 0x35, 
+  0x6f, 0xdf, 0xce, 0xdf, 0xc9, 0x17, 0x92, 0xde, 0x6e, 0xd9, 0x00, 0xa9, 0xe8, 0x2b, 0xe2, 0x98, 
+  0x0a, 0xa9, 0xa3, 0xae, 0x83, 0xf5, 0xa5, 0x79, 0x48, 0x20, 0x17, 0x5e, 0x8c, 0x96, 0x52, 0xe7, 
+  0x0c, 0x11, 0x27, 0x29, 0xed, 0x13, 0xd8, 0xc8, 0x95, 0x4c, 0x33, 0xa1, 0x7f, 0x35, 0x7a, 0x25, 
+  0x8b, 0xc6, 0xe2, 0xc5, 0x10, 0x7e, 0x10, 0x55, 0xfd, 0x73, 0xf8, 0x81, 0x47, 0x61, 0x9f, 0x7f, 
+  0x48, 0x40, 0x63, 0xe6, 0xa5, 0x2e, 0x2e, 0x86, 0xc1, 0xd1, 0x9b, 0xe0, 0x09, 0x2c, 0xd0, 0x37, 
+  0x35, 0xf9, 0x73, 0x43, 0x6b, 0xf5, 0x7c, 0xba, 0x9c, 0xbf, 0x32, 0x39, 0x4e, 0xa6, 0xe3, 0x25, 
+  0xbd, 0xb3, 0xe7, 0xe1, 0xca, 0x15, 0xad, 0xf5, 0xec, 0x73, 0x2e, 0x27, 0xe0, 0xbc, 0xf0, 0x8d, 
+  0x4b, 0x57, 0x8d, 0x52, 0x7c, 0x2a, 0x99, 0xef, 0x2e, 0x5b, 0x07, 0x6d, 0xad, 0x4d, 0xf0, 0x06, 
+  0x34, 0xfa, 0x8d, 0xb1, 0xf7, 0x93, 0xb8, 0xd5, 0x85, 0x92, 0x1d, 0xfb, 0x5d, 0x3a, 0xcf, 0x0e, 
+  0x35, 0xaa, 0xbb, 0xac, 0xa2, 0x95, 0x51, 0x61, 0x4d, 0x53, 0xf7, 0x6c, 0xae, 0x8c, 0x45, 0x91, 
+  0x95, 0x64, 0x96, 0xee, 0x9b, 0xae, 0xa4, 0xf2, 0x68, 0x31, 0xff, 0x03, 0x5d, 0xa3, 0xbc, 0xbb, 
+  0x82, 0x5d, 0x48, 0x9e, 0xc0, 0xa3, 0x59, 0x94, 0xb1, 0x71, 0xef, 0x62, 0x98, 0x2a, 0xd4, 0x85, 
+  0x2f, 0x23, 0x3c, 0x4e, 0xcd, 0x8c, 0xa4, 0xc7, 0xaa, 0x67, 0x2b, 0x53, 0x32, 0xbb, 0x9f, 0xc0, 
+  0x63, 0x6b, 0x8c, 0x0f, 0xe1, 0x4b, 0x1d, 0x2a, 0xba, 0xca, 0x15, 0x10, 0x5e, 0x27, 0xf0, 0x01, 
+  0x04, 0x85, 0x72, 0x8d, 0x67, 0x24, 0x30, 0x7f, 0x8d, 0x9e, 0x92, 0x30, 0x9b, 0xcd, 0xe0, 0x31, 
+  0x6b, 0x84, 0x4f, 0x49, 0x17, 0xca, 0xd3, 0x00, 0x3a, 0x99, 0xef, 0xa2, 0x06, 0x53, 0x59, 0x15, 
+  0x10, 0x2b, 0x3d, 0xb9, 0xf9, 0xb1, 0xa6, 0x8c, 0x97, 0x28, 0x8b, 0xd2, 0x77, 0x6f, 0x07, 0xc7, 
+  0x85, 0xf7, 0x76, 0xf2, 0xc1, 0xd9, 0x6c, 0x02, 0x03, 0x36, 0xfe, 0xde, 0xc9, 0x42, 0x0b, 0xf5, 
+  0x7e, 0x70, 0xe9, 0xbc, 0x0d, 0x77, 0xbd, 0x18, 0x5e, 0x0e, 0x52, 0xb7, 0x2e, 0x06, 0xc1, 0xfc, 
+  0x58, 0x49, 0xfe, 0x6d, 0x54, 0x1f, 0x75, 0xe7, 0x10, 0xf5, 0x84, 0x5c, 0xff, 0x6c, 0xf8, 0x16, 
+  0xb4, 0xae, 0x09, 0x43, 0x69, 0x9a, 0xee, 0x14, 0x71, 0x42, 0x97, 0xf3, 0xc5, 0xe2, 0xe5, 0x6f, 
+  0x01, 0x36, 0xd3, 0xa5, 0xe5, 0xab, 0xe8, 0xba, 0xf1, 0x07, 0x85, 0x9f, 0x00, 0x71, 0x8c, 0xc9, 
+  0x44, 0x2d, 0xbd, 0x50, 0x54, 0x67, 0xb3, 0x44, 0x1b, 0x7d, 0x8a, 0xa9, 0x97, 0x7c, 0x6c, 0xc2, 
+  0xd4, 0x42, 0x68, 0x4e, 0x63, 0x78, 0xa0, 0x83, 0x13, 0x9b, 0xb9, 0xa3, 0xd4, 0xdd, 0xe3, 0xf6, 
+  0x7f, 0xb3, 0xc4, 0xc1, 0x63, 0x9d, 0x04, 0xce, 0x3c, 0x5d, 0x0b, 0xd5, 0xe0, 0x15, 0x84, 0xe0, 
+  0x52, 0x8e, 0x59, 0xe7, 0x91, 0x84, 0x2b, 0xcd, 0x86, 0x92, 0xfb, 0x0b, 0x0c, 0x58, 0xc7, 0x00, 
+  0x28, 0xfc, 0x75, 0xbb, 0x37, 0xe0, 0x44, 0x47, 0x97, 0xc8, 0xdf, 0x69, 0x8c, 0x4d, 0x74, 0xae, 
+  0x83, 0x7a, 0x27, 0xda, 0x91, 0x52, 0x56, 0x62, 0x76, 0x7f, 0x5c, 0xda, 0x61, 0x11, 0xf3, 0x33, 
+  0x86, 0x03, 0x7c, 0xc5, 0x12, 0x15, 0x50, 0x29, 0x1c, 0x69, 0x9c, 0x2f, 0x48, 0x00, 0xba, 0x57, 
+  0xca, 0x37, 0xcb, 0xcd, 0x0f, 0x72, 0x74, 0x10, 0xc4, 0xc6, 0x7b, 0xa3, 0xcf, 0xa0, 0x3d, 0xa2, 
+  0x58, 0xac, 0xf1, 0x75, 0x2c, 0xd6, 0x2b, 0x88, 0x28, 0xbd, 0x38, 0xde, 0x78, 0x81, 0x3e, 0x2b, 
+  0x03, 0x93, 0x70, 0x24, 0x16, 0xc4, 0xa4, 0xba, 0xe0, 0x58, 0x9c, 0x08, 0x2e, 0x9a, 0x2c, 0x43, 
+  0xe7, 0x76, 0x72, 0x98, 0x87, 0x90, 0xb5, 0xbc, 0x30, 0x18, 0x0e, 0xaf, 0x20, 0x97, 0x4e, 0xec, 
+  0x99, 0xec, 0x8c, 0x91, 0xa4, 0xa3, 0x11, 0x4a, 0x79, 0xf0, 0x7c, 0x0f, 0x88, 0x3d, 0xa7, 0x31, 
+  0xc5, 0x08, 0x50, 0x94, 0x76, 0x05, 0x81, 0xd6, 0x5a, 0xbe, 0x01, 0xe9, 0x40, 0x1b, 0x0f, 0xe4, 
+  0x04, 0xb5, 0x2a, 0x6a, 0xb9, 0x29, 0x74, 0xad, 0x0d, 0x08, 0xca, 0xb0, 0xc4, 0x16, 0x6b, 0xc4, 
+  0x9c, 0x39, 0x08, 0x9d, 0x87, 0xae, 0x66, 0x8d, 0x52, 0xf4, 0xba, 0x29, 0xa5, 0x42, 0x90, 0x9a, 
+  0x79, 0x4e, 0xe7, 0x42, 0x11, 0x8c, 0xa2, 0xf2, 0x67, 0x77, 0x70, 0xf1, 0x2c, 0xdc, 0x0c, 0xee, 
+  0x8c, 0xd4, 0x7e, 0x08, 0x55, 0x24, 0xcd, 0x96, 0xdb, 0xf6, 0x41, 0x36, 0x3a, 0xc4, 0x96, 0x93, 
+  0xa5, 0x73, 0xb3, 0x49, 0xd9, 0x43, 0x6e, 0xc9, 0x69, 0x68, 0x42, 0x83, 0x71, 0x69, 0x2a, 0x4c, 
+  0x79, 0x0a, 0x19, 0x24, 0x2d, 0x1d, 0xef, 0x4d, 0x31, 0xa5, 0x1e, 0xde, 0x79, 0x97, 0x49, 0x39, 
+  0x8f, 0x74, 0xd2, 0xf2, 0x98, 0xab, 0x84, 0x52, 0xa3, 0x00, 0xfd, 0xf9, 0x6b, 0xe3, 0x29, 0x94, 
+  0x16, 0x2b, 0x7a, 0x52, 0x38, 0x8a, 0x82, 0x63, 0xb3, 0x42, 0xa2, 0x69, 0x2a, 0x66, 0xc0, 0xb4, 
+  0x80, 0xe7, 0x15, 0xf9, 0x54, 0x39, 0x0a, 0xb7, 0x52, 0x21, 0x34, 0x21, 0x4c, 0xbb, 0xab, 0xd2, 
+  0xd5, 0x0e, 0x6e, 0x5b, 0x05, 0x17, 0x5a, 0x4e, 0x97, 0x2d, 0x86, 0x4e, 0xbb, 0xd6, 0x97, 0xbb, 
+  0xd3, 0x71, 0xf7, 0x81, 0x8f, 0x1f, 0xdb, 0xbe, 0xd4, 0xef, 0x5b, 0x6d, 0x57, 0xea, 0x27, 0xf5, 
+  0x33, 0xc4, 0xd9, 0x23, 0x88, 0x8e, 0x3f, 0x89, 0x94, 0x76, 0x8d, 0xec, 0x4e, 0xa1, 0x70, 0x21, 
+  0xb9, 0xb1, 0x03, 0x95, 0x04, 0x84, 0x38, 0x3e, 0x7d, 0xad, 0x56, 0x06, 0x85, 0x26, 0x88, 0x17, 
+  0xc2, 0x87, 0xb3, 0x34, 0x03, 0xc1, 0xcb, 0x3b, 0x10, 0x79, 0x6e, 0x19, 0x00, 0x84, 0xdf, 0x5a, 
+  0x89, 0x2d, 0xc1, 0x85, 0xd2, 0xbd, 0x35, 0x8d, 0xdd, 0x03, 0xac, 0xdd, 0x4a, 0x3b, 0xb8, 0x3e, 
+  0xe3, 0x8e, 0xa5, 0x05, 0x37, 0x0e, 0xb5, 0x65, 0xd9, 0x00, 0x41, 0x9a, 0xe3, 0x60, 0x2a, 0x4e, 
+  0xc8, 0x9d, 0xf8, 0x87, 0x31, 0x42, 0xd5, 0x52, 0x7a, 0x5f, 0x4f, 0xc6, 0xe3, 0x01, 0x5c, 0x76, 
+  0x0e, 0x96, 0xc6, 0x79, 0x1e, 0xc8, 0x28, 0x96, 0x97, 0x30, 0x08, 0xa0, 0x52, 0xb4, 0xff, 0xa9, 
+  0x2b, 0xd8, 0x7f, 0x7d, 0x84, 0x6f, 0x29, 0xe6, 0x60, 0xec, 0x7f, 0xf3, 0xe0, 0xab, 0x6c, 0x77, 
+  0x56, 0xfb, 0x93, 0x00, 0x95, 0x09, 0x15, 0xe8, 0x88, 0x47, 0xdf, 0xf3, 0x50, 0x6a, 0x67, 0x0d, 
+  0xe9, 0xde, 0x31, 0x9c, 0x82, 0x74, 0xb2, 0xaf, 0x33, 0x56, 0x21, 0x6a, 0xb3, 0x5a, 0x25, 0x9f, 
+  0xe3, 0x35, 0xaa, 0x00, 0xfd, 0x66, 0xb5, 0x8a, 0x65, 0x1b, 0xaa, 0xf6, 0x98, 0x7b, 0x4e, 0x25, 
+  0x7a, 0x14, 0x44, 0x88, 0x6c, 0xce, 0xd4, 0xe3, 0x41, 0x35, 0xc8, 0x30, 0xa4, 0x50, 0xe5, 0x85, 
+  0xe9, 0x8d, 0x3a, 0x01, 0xf5, 0x2b, 0x22, 0x88, 0x0d, 0x8f, 0x29, 0xb0, 0xdc, 0x72, 0x8c, 0xe3, 
+  0xec, 0xd9, 0x86, 0x68, 0xb3, 0xd9, 0xa4, 0x86, 0xc0, 0x82, 0x6b, 0x47, 0x73, 0xb0, 0xa9, 0x92, 
+  0x83, 0x4f, 0x0b, 0x11, 0x81, 0xd7, 0x3b, 0xe2, 0xe8, 0x4c, 0x90, 0xa7, 0xf9, 0xb0, 0xd8, 0x52, 
+  0x1d, 0x4b, 0x6f, 0x6c, 0x6a, 0x6c, 0xd1, 0x1e, 0x0c, 0xcb, 0xaf, 0xe2, 0x72, 0x8c, 0xf0, 0x32, 
+  0xfa, 0xc1, 0x8d, 0xf3, 0x2d, 0x5a, 0x47, 0xc4, 0x33, 0x01, 0x5e, 0x7d, 0xfb, 0xe5, 0x02, 0x58, 
+  0x47, 0xd9, 0x83, 0xc9, 0xa4, 0x7f, 0xd9, 0xf6, 0x11, 0x3f, 0x30, 0x80, 0xa6, 0x10, 0x1e, 0xa6, 
+  0x96, 0xe9, 0x9f, 0x2e, 0x9c, 0x08, 0xab, 0x47, 0xdb, 0x61, 0x46, 0xe1, 0x6f, 0x1a, 0x62, 0xe0, 
+  0x23, 0xb1, 0x71, 0x3b, 0x5e, 0x8f, 0xe3, 0x37, 0xd9, 0x77, 0x7f, 0x03, 0x89, 0x47, 0xcc, 0x99, 
+  0xa5, 0x0d, 0x00, 0x00, 0x00 };
@@ -1,3 +1,37 @@
-static const char CONTENT_WIFI_PORTAL_JS[] PROGMEM = 
-  "\"use strict\";function WiFiPortalViewModel(i,n){var e=this;e.baseHost=ko.observable(\"\"!==i?i:\"openevse.local\"),e.basePort=ko.observable(n),e.baseEndpoint=ko.pureComputed(function(){var i=\"//\"+e.baseHost();return 80!==e.basePort()&&(i+=\":\"+e.basePort()),i}),e.config=new ConfigViewModel(e.baseEndpoint),e.status=new StatusViewModel(e.baseEndpoint),e.scan=new WiFiScanViewModel(e.baseEndpoint),e.wifi=new WiFiConfigViewModel(e.baseEndpoint,e.config,e.status,e.scan),e.initialised=ko.observable(!1),e.updating=ko.observable(!1),e.wifi.selectedNet.subscribe(function(i){!1!==i&&e.config.ssid(i.ssid())}),e.config.ssid.subscribe(function(i){e.wifi.setSsid(i)}),e.wifiPassword=new PasswordViewModel(e.config.pass);var t=null;e.start=function(){e.updating(!0),e.config.update(function(){e.status.update(function(){e.initialised(!0),t=setTimeout(e.update,5e3),e.updating(!1)})})},e.update=function(){e.updating()||(e.updating(!0),null!==t&&(clearTimeout(t),t=null),e.status.update(function(){t=setTimeout(e.update,5e3),e.updating(!1)}))}}function scaleString(i,n,e){return(parseInt(i)/n).toFixed(e)}!function(){var n=window.location.hostname,e=window.location.port;$(function(){var i=new WiFiPortalViewModel(n,e);ko.applyBindings(i),i.start()})}();\n"
-  "//# sourceMappingURL=wifi_portal.js.map\n";
+static const char CONTENT_WIFI_PORTAL_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x95, 0x54, 0xef, 0x6b, 0xdb, 0x30, 
+  0x10, 0xfd, 0xde, 0xbf, 0xc2, 0xf1, 0x46, 0x90, 0xa8, 0x71, 0x5a, 0xc6, 0x60, 0xd4, 0x98, 0xc1, 
+  0xca, 0xca, 0x06, 0xeb, 0x28, 0xcb, 0x7e, 0x7c, 0x1c, 0x8a, 0x7d, 0x69, 0x6f, 0x53, 0x24, 0x21, 
+  0xc9, 0xf5, 0x46, 0x9a, 0xff, 0x7d, 0x27, 0x39, 0x8e, 0xdd, 0x34, 0x0d, 0x0c, 0x7f, 0xb0, 0x7d, 
+  0xf7, 0x74, 0xf7, 0xf4, 0x74, 0x4f, 0x69, 0xe3, 0x20, 0x71, 0xde, 0x62, 0xe5, 0xd3, 0x62, 0xd9, 
+  0xa8, 0xca, 0xa3, 0x56, 0xc9, 0x0f, 0xbc, 0xc2, 0x1b, 0x6d, 0xbd, 0x90, 0xdf, 0x11, 0xda, 0x6b, 
+  0x5d, 0x83, 0x64, 0x98, 0x29, 0xbe, 0xbe, 0x17, 0x36, 0x81, 0xd2, 0xdf, 0xa1, 0x2b, 0x20, 0x5f, 
+  0x08, 0x07, 0x1f, 0xb4, 0xf3, 0xe5, 0x6f, 0x9d, 0xeb, 0x85, 0x03, 0x7b, 0x2f, 0x16, 0x12, 0x58, 
+  0x9a, 0x4e, 0xca, 0x12, 0xdf, 0xe2, 0x45, 0xaa, 0x0d, 0x28, 0xb8, 0x77, 0x90, 0x4b, 0x5d, 0x09, 
+  0x99, 0xf2, 0xac, 0x5b, 0x13, 0x2a, 0xef, 0xad, 0x51, 0x7d, 0xee, 0xbd, 0xaa, 0x8d, 0x46, 0x15, 
+  0xf3, 0xa6, 0xb1, 0x70, 0xa9, 0x57, 0xa6, 0xf1, 0x50, 0xb3, 0x9e, 0x1b, 0xeb, 0x48, 0x60, 0x99, 
+  0xce, 0x66, 0xe9, 0xe9, 0x40, 0x82, 0xf1, 0xc2, 0x82, 0x6f, 0xac, 0x4a, 0xde, 0x9c, 0x51, 0xff, 
+  0xa1, 0x13, 0xe3, 0xd3, 0x29, 0xc3, 0xd3, 0x32, 0xbd, 0xe8, 0xe1, 0x5d, 0x94, 0x67, 0xb8, 0x09, 
+  0x5d, 0x2b, 0xad, 0x96, 0x78, 0x5b, 0x2a, 0x68, 0x93, 0xcb, 0xf8, 0x39, 0x6c, 0xf9, 0x31, 0xa5, 
+  0x00, 0x76, 0x5e, 0xf8, 0xc6, 0x45, 0xf0, 0x3c, 0x7e, 0x1e, 0x05, 0x57, 0x42, 0x45, 0x68, 0x90, 
+  0x73, 0x4e, 0x3f, 0xc7, 0xc0, 0x2d, 0x2e, 0x71, 0x07, 0x3e, 0x4e, 0x64, 0x47, 0x7a, 0x47, 0x68, 
+  0xdb, 0x2c, 0xd4, 0x41, 0x85, 0x1e, 0x85, 0x44, 0x07, 0xf5, 0x9e, 0xc6, 0x93, 0xf3, 0x90, 0x6f, 
+  0x4c, 0x2d, 0x3c, 0xaa, 0xdb, 0x83, 0xc9, 0x40, 0x22, 0x77, 0x20, 0xa1, 0x22, 0xc9, 0x3f, 0x83, 
+  0xcf, 0x5d, 0xb3, 0x70, 0x95, 0xc5, 0x05, 0x0c, 0xfa, 0x23, 0x5f, 0x4f, 0xce, 0xc3, 0x09, 0x4f, 
+  0xa7, 0x3d, 0x8f, 0xdc, 0x39, 0xac, 0x19, 0x76, 0x2f, 0xce, 0x47, 0xb2, 0xc6, 0xd0, 0x33, 0x55, 
+  0x76, 0xed, 0xfc, 0x3c, 0x2e, 0xef, 0xd6, 0x85, 0xd8, 0x8d, 0x70, 0xae, 0xd5, 0xb6, 0x8e, 0x7a, 
+  0xf4, 0x3f, 0x63, 0x35, 0xb6, 0xc5, 0x0d, 0xa5, 0x78, 0x11, 0xc6, 0xc1, 0x97, 0xaa, 0x91, 0xb2, 
+  0x88, 0x7a, 0xd0, 0x70, 0x8d, 0x86, 0x65, 0xd8, 0x31, 0x9b, 0x9c, 0x8d, 0x88, 0xc5, 0x28, 0xb0, 
+  0x47, 0xc8, 0x4e, 0xcc, 0x83, 0xa9, 0x91, 0xac, 0xb1, 0x8e, 0x2f, 0x89, 0xf7, 0x57, 0x5c, 0x81, 
+  0x6e, 0x3c, 0xdb, 0xf6, 0x80, 0xec, 0x35, 0xbc, 0x1a, 0x6b, 0x1c, 0x54, 0xdd, 0x84, 0xa7, 0x8f, 
+  0xc1, 0x33, 0xcc, 0xf8, 0xc3, 0x03, 0xdb, 0x23, 0x1a, 0xf6, 0x43, 0x2a, 0x7b, 0x1a, 0xde, 0x4a, 
+  0x82, 0xb0, 0x7d, 0x2f, 0x1f, 0x7a, 0x87, 0xe4, 0x30, 0x8e, 0x07, 0x08, 0xff, 0x07, 0x3d, 0xbe, 
+  0xd9, 0xec, 0x7c, 0x4f, 0x43, 0x24, 0x61, 0x4e, 0xb7, 0x01, 0x25, 0xc9, 0xef, 0x19, 0xf0, 0x75, 
+  0x67, 0x2a, 0x66, 0x84, 0x75, 0xf0, 0x51, 0x79, 0x3a, 0xa6, 0x99, 0xe2, 0xb9, 0xd7, 0x57, 0xf8, 
+  0x87, 0xa4, 0x00, 0xbe, 0x99, 0xec, 0x39, 0x53, 0x95, 0x2d, 0xaa, 0x5a, 0xb7, 0xd1, 0xf4, 0x21, 
+  0x9e, 0xdf, 0x91, 0x3d, 0x95, 0x58, 0x41, 0x06, 0x4f, 0x52, 0x86, 0xac, 0x58, 0xbc, 0x7c, 0x6a, 
+  0xee, 0xde, 0x08, 0xfb, 0x97, 0x50, 0xa0, 0x54, 0xd0, 0xe4, 0x0a, 0x63, 0xe4, 0xdf, 0x77, 0x54, 
+  0x8c, 0x98, 0x3a, 0xe2, 0x94, 0x61, 0x77, 0xf2, 0x2c, 0xa8, 0x4d, 0x57, 0xc1, 0xc9, 0x6c, 0xf6, 
+  0x22, 0x71, 0xba, 0xb1, 0x15, 0x5c, 0x13, 0x96, 0x50, 0xdf, 0xbe, 0x7c, 0x2a, 0xc3, 0x6c, 0xfd, 
+  0x34, 0xb1, 0x64, 0xfe, 0xcb, 0xe5, 0x2b, 0x61, 0x4e, 0xfe, 0x01, 0x06, 0x72, 0xf0, 0xc2, 0x00, 
+  0x05, 0x00, 0x00, 0x00 };
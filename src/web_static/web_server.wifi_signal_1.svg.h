@@ -1,68 +1,66 @@
-static const char CONTENT_WIFI_SIGNAL_1_SVG[] PROGMEM = 
-  "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
-  "<svg\n"
-  "   xmlns:dc=\"http://purl.org/dc/elements/1.1/\"\n"
-  "   xmlns:cc=\"http://creativecommons.org/ns#\"\n"
-  "   xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"\n"
-  "   xmlns:svg=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns:sodipodi=\"http://sodipodi.sourceforge.net/DTD/sodipodi-0.dtd\"\n"
-  "   xmlns:inkscape=\"http://www.inkscape.org/namespaces/inkscape\"\n"
-  "   width=\"24\"\n"
-  "   height=\"24\"\n"
-  "   viewBox=\"0 0 24 24\"\n"
-  "   version=\"1.1\"\n"
-  "   id=\"svg865\"\n"
-  "   sodipodi:docname=\"wifi_signal_1.svg\"\n"
-  "   inkscape:version=\"0.92.3 (2405546, 2018-03-11)\">\n"
-  "  <metadata\n"
-  "     id=\"metadata871\">\n"
-  "    <rdf:RDF>\n"
-  "      <cc:Work\n"
-  "         rdf:about=\"\">\n"
-  "        <dc:format>image/svg+xml</dc:format>\n"
-  "        <dc:type\n"
-  "           rdf:resource=\"http://purl.org/dc/dcmitype/StillImage\" />\n"
-  "        <dc:title></dc:title>\n"
-  "      </cc:Work>\n"
-  "    </rdf:RDF>\n"
-  "  </metadata>\n"
-  "  <defs\n"
-  "     id=\"defs869\" />\n"
-  "  <sodipodi:namedview\n"
-  "     pagecolor=\"#ffffff\"\n"
-  "     bordercolor=\"#666666\"\n"
-  "     borderopacity=\"1\"\n"
-  "     objecttolerance=\"10\"\n"
-  "     gridtolerance=\"10\"\n"
-  "     guidetolerance=\"10\"\n"
-  "     inkscape:pageopacity=\"0\"\n"
-  "     inkscape:pageshadow=\"2\"\n"
-  "     inkscape:window-width=\"2560\"\n"
-  "     inkscape:window-height=\"1320\"\n"
-  "     id=\"namedview867\"\n"
-  "     showgrid=\"false\"\n"
-  "     inkscape:zoom=\"47.458333\"\n"
-  "     inkscape:cx=\"12\"\n"
-  "     inkscape:cy=\"12\"\n"
-  "     inkscape:window-x=\"2560\"\n"
-  "     inkscape:window-y=\"27\"\n"
-  "     inkscape:window-maximized=\"1\"\n"
-  "     inkscape:current-layer=\"svg865\" />\n"
-  "  <path\n"
-  "     d=\"M 4.504,13.572 2.999,12.083 C 5.2,9.278 8.412,7.5 12,7.5 c 3.588,0 6.8,1.779 9,4.583 l -1.504,1.489 C 17.661,11.234 14.984,9.75 12,9.75 c -2.984,0 -5.661,1.484 -7.496,3.822 z\"\n"
-  "     id=\"path898\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "  <path\n"
-  "     d=\"m 12,14.25 c 1.791,0 3.397,0.891 4.498,2.293 L 18,15.055 C 16.533,13.186 14.392,12 12,12 9.608,12 7.467,13.186 6,15.055 l 1.502,1.488 C 8.603,15.141 10.209,14.25 12,14.25 Z\"\n"
-  "     id=\"path896\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "  <path\n"
-  "     d=\"m 12,16.5 c -1.196,0 -2.258,0.602 -2.99,1.536 L 12,21 14.99,18.037 C 14.258,17.102 13.196,16.5 12,16.5 Z\"\n"
-  "     id=\"path894\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "  <path\n"
-  "     d=\"m 12,5.25 c 4.179,0 7.927,2.078 10.495,5.351 L 24,9.11 C 21.065,5.371 16.783,3 12,3 7.217,3 2.935,5.371 0,9.11 l 1.505,1.491 C 4.073,7.328 7.821,5.25 12,5.25 Z\"\n"
-  "     id=\"path863\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "</svg>\n";
+static const char CONTENT_WIFI_SIGNAL_1_SVG[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9d, 0x56, 0xdb, 0x8e, 0xa3, 0x46, 
+  0x10, 0x7d, 0x9f, 0xaf, 0x68, 0x31, 0x2f, 0x89, 0x02, 0x4d, 0xdf, 0x80, 0x6e, 0xcb, 0x78, 0xa5, 
+  0x64, 0xb4, 0x52, 0xa4, 0xe4, 0x25, 0xd9, 0x28, 0x52, 0x5e, 0x56, 0x4c, 0xd3, 0xb6, 0xc9, 0x02, 
+  0x6d, 0x01, 0x1e, 0xdb, 0xf3, 0xf5, 0xa9, 0x6e, 0x2e, 0x9e, 0x8b, 0x37, 0x89, 0x16, 0xc9, 0xc2, 
+  0x5d, 0x75, 0xaa, 0xea, 0x9c, 0xaa, 0x02, 0x7b, 0xfd, 0xe1, 0xdc, 0xd4, 0xe8, 0xc9, 0x74, 0x7d, 
+  0x65, 0xdb, 0x3c, 0xa0, 0x98, 0x04, 0xc8, 0xb4, 0xda, 0x96, 0x55, 0xbb, 0xcb, 0x83, 0x3f, 0x3e, 
+  0x7d, 0x8c, 0x64, 0x80, 0xfa, 0xa1, 0x68, 0xcb, 0xa2, 0xb6, 0xad, 0xc9, 0x83, 0xd6, 0x06, 0x1f, 
+  0x36, 0x77, 0xeb, 0xfe, 0x69, 0x77, 0x87, 0x10, 0x82, 0xe0, 0xb6, 0x5f, 0x95, 0x3a, 0x0f, 0xf6, 
+  0xc3, 0x70, 0x58, 0xc5, 0xf1, 0xe1, 0xd8, 0xd5, 0xd8, 0x76, 0xbb, 0xb8, 0xd4, 0xb1, 0xa9, 0x4d, 
+  0x63, 0xda, 0xa1, 0x8f, 0x29, 0xa6, 0x71, 0x70, 0x85, 0xeb, 0x2b, 0x5c, 0x77, 0xa6, 0x18, 0xaa, 
+  0x27, 0xa3, 0x6d, 0xd3, 0xd8, 0xb6, 0xf7, 0x91, 0x6d, 0x7f, 0xff, 0x02, 0xdc, 0x95, 0xdb, 0x05, 
+  0x7d, 0x3a, 0x9d, 0xf0, 0x89, 0x7b, 0x10, 0x55, 0x4a, 0xc5, 0x84, 0xc5, 0x8c, 0x45, 0x80, 0x88, 
+  0xfa, 0x4b, 0x3b, 0x14, 0xe7, 0xe8, 0x75, 0x28, 0x70, 0xbc, 0x15, 0xca, 0x08, 0x21, 0x31, 0xf8, 
+  0xae, 0xc8, 0xff, 0x87, 0x5a, 0xf5, 0xd0, 0x95, 0x03, 0x7c, 0x16, 0xf8, 0x6c, 0xc0, 0xbd, 0x3d, 
+  0x76, 0xda, 0x6c, 0x21, 0xce, 0xe0, 0xd6, 0x0c, 0xf1, 0xc3, 0xa7, 0x87, 0xc5, 0x19, 0x11, 0x5c, 
+  0x0e, 0xe5, 0x8b, 0x34, 0x55, 0xfb, 0xa5, 0xd7, 0xc5, 0xc1, 0xbc, 0xaa, 0x3a, 0x1b, 0xc7, 0x0e, 
+  0x14, 0x8d, 0xe9, 0x0f, 0x85, 0x36, 0x7d, 0x3c, 0xdb, 0x7d, 0xfc, 0xa9, 0x2a, 0x87, 0x7d, 0x1e, 
+  0x30, 0xe1, 0x4f, 0x7b, 0x53, 0xed, 0xf6, 0xc3, 0x72, 0x7c, 0xaa, 0xcc, 0xe9, 0x47, 0x7b, 0xce, 
+  0x03, 0x82, 0x08, 0x62, 0x02, 0xcd, 0xe6, 0xeb, 0x68, 0xa9, 0x37, 0x54, 0x65, 0x1e, 0x80, 0x2e, 
+  0x99, 0x26, 0xfe, 0x38, 0xd3, 0x5c, 0x95, 0x56, 0xbb, 0xba, 0x79, 0x70, 0xaa, 0xb6, 0xd5, 0xe7, 
+  0xbe, 0xda, 0xb5, 0x45, 0xfd, 0x99, 0xe2, 0xb9, 0x05, 0x33, 0x91, 0xd5, 0x92, 0x90, 0x60, 0xc5, 
+  0x30, 0x47, 0xdf, 0x31, 0x41, 0x92, 0x44, 0xa4, 0x21, 0x62, 0x84, 0xca, 0x88, 0xf0, 0x88, 0xd2, 
+  0xef, 0x83, 0x0d, 0xc4, 0xac, 0x1b, 0x33, 0x14, 0x65, 0x31, 0x14, 0x2e, 0x7e, 0x2c, 0x3c, 0x5b, 
+  0x64, 0x46, 0x3d, 0x04, 0x40, 0x30, 0xbe, 0xd5, 0x6f, 0x0f, 0x1f, 0xc7, 0x13, 0x9c, 0xb5, 0x5e, 
+  0xfd, 0x69, 0xbb, 0x2f, 0xd3, 0x11, 0x2e, 0x07, 0x28, 0x1e, 0xed, 0x11, 0xa4, 0x06, 0x9b, 0xc5, 
+  0xbc, 0x2e, 0xf5, 0x0a, 0x1a, 0xde, 0x14, 0xc3, 0xa6, 0x6a, 0x8a, 0x9d, 0x71, 0xb3, 0xfa, 0x01, 
+  0x1a, 0xbc, 0x8e, 0xaf, 0x8e, 0x57, 0xe0, 0xe1, 0x72, 0x30, 0xd7, 0xa4, 0x63, 0xda, 0xce, 0x8c, 
+  0x93, 0xbb, 0xb9, 0xbe, 0xa5, 0x6e, 0x2a, 0x17, 0x14, 0xff, 0x3e, 0x54, 0x75, 0xfd, 0xb3, 0x2b, 
+  0x12, 0xa0, 0xf8, 0x4d, 0xd2, 0x6a, 0xa8, 0xcd, 0xc6, 0xd7, 0x1c, 0xbf, 0xce, 0x2a, 0xe2, 0x49, 
+  0xc6, 0x24, 0x32, 0x7e, 0xa1, 0x72, 0x1d, 0xcf, 0x5d, 0xf0, 0xa7, 0xd2, 0x6c, 0xfb, 0x6b, 0x83, 
+  0xdc, 0x49, 0xa6, 0x6a, 0x2a, 0xb4, 0x5e, 0xa6, 0xe3, 0x46, 0x53, 0xba, 0x11, 0x8f, 0xd0, 0x03, 
+  0x90, 0xd1, 0xb6, 0xb6, 0x5d, 0x1e, 0xdc, 0x6f, 0xfd, 0x15, 0x8c, 0x8e, 0x47, 0xdb, 0x95, 0xa6, 
+  0x9b, 0x5d, 0xa9, 0xbf, 0x5e, 0xb9, 0x2c, 0xec, 0x15, 0xc8, 0x82, 0x7d, 0x98, 0xcc, 0xf6, 0xf1, 
+  0x6f, 0xa3, 0x87, 0xc1, 0xd6, 0xa6, 0x2b, 0x5a, 0xd7, 0x0a, 0x4a, 0x26, 0xcf, 0xae, 0x83, 0x7d, 
+  0xbb, 0x65, 0x3f, 0x56, 0xa5, 0xb9, 0xe5, 0x58, 0x76, 0xc4, 0xd1, 0x5b, 0x0a, 0xdd, 0xf4, 0xf6, 
+  0xfb, 0xa2, 0xb4, 0x27, 0x58, 0xde, 0xb7, 0xce, 0x53, 0xd5, 0x82, 0x23, 0x9a, 0x57, 0x3d, 0x49, 
+  0xc9, 0x57, 0x10, 0xf3, 0xfa, 0x53, 0xce, 0x16, 0x08, 0x34, 0x70, 0x69, 0x94, 0x4c, 0xb3, 0xc9, 
+  0xdc, 0xef, 0xed, 0xc9, 0x69, 0xc9, 0x83, 0x6d, 0x51, 0xf7, 0xe6, 0x6d, 0xbe, 0x67, 0x6b, 0x9b, 
+  0x3c, 0x10, 0x19, 0x16, 0x89, 0xe4, 0x9c, 0xbf, 0x75, 0x6b, 0x78, 0xa4, 0xe8, 0x3b, 0x9a, 0xfa, 
+  0x72, 0xcb, 0x3a, 0x51, 0x3b, 0xff, 0x2b, 0x71, 0x88, 0x64, 0xd9, 0x57, 0x7c, 0x4d, 0x71, 0xae, 
+  0x9a, 0xea, 0xd9, 0x94, 0xd7, 0xf9, 0x5c, 0x4b, 0x1e, 0xbb, 0x0e, 0x5e, 0xa7, 0x51, 0x5d, 0x5c, 
+  0x4c, 0xb7, 0x3c, 0xc3, 0xd3, 0xa2, 0x1c, 0x8a, 0x61, 0x3f, 0xe2, 0x21, 0xf4, 0x57, 0x24, 0x70, 
+  0x42, 0x44, 0x48, 0x39, 0x4e, 0x32, 0x86, 0x18, 0x86, 0x97, 0x65, 0x48, 0x19, 0x26, 0x92, 0xa3, 
+  0x9f, 0x50, 0x82, 0x59, 0xa8, 0x30, 0xcb, 0x24, 0x92, 0x58, 0x50, 0x16, 0x66, 0x38, 0x41, 0xd3, 
+  0x4d, 0x23, 0x88, 0x90, 0x32, 0x24, 0x28, 0xc5, 0x32, 0xa4, 0x38, 0xcb, 0x14, 0x52, 0x21, 0x24, 
+  0x83, 0xc0, 0x1a, 0x45, 0x74, 0xcc, 0x8a, 0x85, 0x54, 0x90, 0x87, 0x66, 0x38, 0x4d, 0x69, 0x48, 
+  0x29, 0x66, 0x5c, 0x20, 0x2a, 0xb0, 0x92, 0x02, 0x12, 0x67, 0x3e, 0x9b, 0xbf, 0x6b, 0x14, 0x31, 
+  0x6f, 0x25, 0x28, 0x4a, 0x46, 0x30, 0xc4, 0x0a, 0x14, 0x41, 0xaf, 0x55, 0x1a, 0x72, 0x2c, 0x19, 
+  0x43, 0xcf, 0x2f, 0x86, 0xe7, 0x54, 0x48, 0x25, 0xe7, 0xb9, 0x0d, 0x97, 0x1a, 0xd6, 0x6b, 0x0b, 
+  0x4f, 0xdf, 0xea, 0x5e, 0xfb, 0xeb, 0xa6, 0xdc, 0xc6, 0x15, 0x84, 0xfa, 0xcc, 0x55, 0x04, 0xd2, 
+  0x8a, 0x42, 0x41, 0x8e, 0xb9, 0xca, 0x42, 0x82, 0xa5, 0xa2, 0xd0, 0x0d, 0xa1, 0x64, 0xc8, 0x30, 
+  0x53, 0x1c, 0xfd, 0x82, 0x28, 0x28, 0x4b, 0x30, 0xbc, 0xb3, 0x9c, 0x86, 0x14, 0x27, 0x9c, 0xbb, 
+  0x46, 0x51, 0x99, 0x3a, 0x0d, 0x5c, 0x41, 0x2a, 0xe6, 0x13, 0x32, 0xa4, 0x70, 0x4a, 0xa4, 0xfb, 
+  0x02, 0x7c, 0xd3, 0x6c, 0x46, 0xa5, 0x73, 0x78, 0x8d, 0x5c, 0x43, 0x98, 0x17, 0x25, 0x21, 0x99, 
+  0x04, 0x38, 0x77, 0x4e, 0x2a, 0x28, 0xa2, 0x04, 0x33, 0xa2, 0x26, 0x5a, 0x0b, 0xbf, 0xbf, 0xde, 
+  0x89, 0x4d, 0xbf, 0x49, 0x6c, 0xea, 0x87, 0x05, 0x03, 0xa1, 0xd0, 0x47, 0xe2, 0xda, 0xcc, 0x12, 
+  0x18, 0x1b, 0x10, 0x60, 0xbe, 0xe7, 0x50, 0x18, 0x84, 0xa5, 0x4e, 0x2d, 0x0b, 0x19, 0xf5, 0xd3, 
+  0x01, 0x9b, 0xc4, 0x84, 0x67, 0x4e, 0xb6, 0xf0, 0x78, 0x98, 0x20, 0x85, 0x00, 0xa7, 0x0b, 0xd2, 
+  0xf8, 0xa4, 0x73, 0xf2, 0xf7, 0x44, 0xc5, 0xb7, 0x10, 0x4d, 0xc6, 0xa1, 0x08, 0x4c, 0x33, 0x05, 
+  0x3c, 0x33, 0xf8, 0xc9, 0xc8, 0x60, 0x10, 0x04, 0x96, 0x0f, 0x1a, 0x24, 0x54, 0x02, 0x08, 0x9e, 
+  0x50, 0xe0, 0xc9, 0xdc, 0xee, 0x50, 0x0a, 0xe4, 0x18, 0xfc, 0x09, 0x49, 0xbd, 0x23, 0xa3, 0x6e, 
+  0x40, 0x99, 0xe4, 0x21, 0x77, 0xc9, 0x38, 0xc4, 0x33, 0x9a, 0xc1, 0x1d, 0x14, 0xf2, 0x19, 0x41, 
+  0xc6, 0xb8, 0x71, 0x18, 0x89, 0x1b, 0x86, 0x72, 0x59, 0x04, 0x14, 0xe1, 0xb0, 0xd4, 0x9c, 0x49, 
+  0x08, 0x93, 0x8c, 0x8e, 0x5c, 0x66, 0x4e, 0xef, 0xf4, 0xa5, 0xfc, 0x3f, 0xf4, 0xad, 0xdd, 0x2f, 
+  0xcc, 0xe6, 0xee, 0x1f, 0xed, 0x66, 0xc9, 0xab, 0x31, 0x09, 0x00, 0x00, 0x00 };
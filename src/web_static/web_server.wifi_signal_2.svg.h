@@ -1,67 +1,66 @@
-static const char CONTENT_WIFI_SIGNAL_2_SVG[] PROGMEM = 
-  "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
-  "<svg\n"
-  "   xmlns:dc=\"http://purl.org/dc/elements/1.1/\"\n"
-  "   xmlns:cc=\"http://creativecommons.org/ns#\"\n"
-  "   xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"\n"
-  "   xmlns:svg=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns:sodipodi=\"http://sodipodi.sourceforge.net/DTD/sodipodi-0.dtd\"\n"
-  "   xmlns:inkscape=\"http://www.inkscape.org/namespaces/inkscape\"\n"
-  "   width=\"24\"\n"
-  "   height=\"24\"\n"
-  "   viewBox=\"0 0 24 24\"\n"
-  "   version=\"1.1\"\n"
-  "   id=\"svg865\"\n"
-  "   sodipodi:docname=\"wifi_signal_2.svg\"\n"
-  "   inkscape:version=\"0.92.3 (2405546, 2018-03-11)\">\n"
-  "  <metadata\n"
-  "     id=\"metadata871\">\n"
-  "    <rdf:RDF>\n"
-  "      <cc:Work\n"
-  "         rdf:about=\"\">\n"
-  "        <dc:format>image/svg+xml</dc:format>\n"
-  "        <dc:type\n"
-  "           rdf:resource=\"http://purl.org/dc/dcmitype/StillImage\" />\n"
-  "        <dc:title></dc:title>\n"
-  "      </cc:Work>\n"
-  "    </rdf:RDF>\n"
-  "  </metadata>\n"
-  "  <defs\n"
-  "     id=\"defs869\" />\n"
-  "  <sodipodi:namedview\n"
-  "     pagecolor=\"#ffffff\"\n"
-  "     bordercolor=\"#666666\"\n"
-  "     borderopacity=\"1\"\n"
-  "     objecttolerance=\"10\"\n"
-  "     gridtolerance=\"10\"\n"
-  "     guidetolerance=\"10\"\n"
-  "     inkscape:pageopacity=\"0\"\n"
-  "     inkscape:pageshadow=\"2\"\n"
-  "     inkscape:window-width=\"2560\"\n"
-  "     inkscape:window-height=\"1320\"\n"
-  "     id=\"namedview867\"\n"
-  "     showgrid=\"false\"\n"
-  "     inkscape:zoom=\"47.458333\"\n"
-  "     inkscape:cx=\"12\"\n"
-  "     inkscape:cy=\"12\"\n"
-  "     inkscape:window-x=\"2560\"\n"
-  "     inkscape:window-y=\"27\"\n"
-  "     inkscape:window-maximized=\"1\"\n"
-  "     inkscape:current-layer=\"svg865\" />\n"
-  "  <path\n"
-  "     d=\"M 4.504,13.572 2.999,12.083 C 5.2,9.278 8.412,7.5 12,7.5 c 3.588,0 6.8,1.779 9,4.583 l -1.504,1.489 C 17.661,11.234 14.984,9.75 12,9.75 c -2.984,0 -5.661,1.484 -7.496,3.822 z\"\n"
-  "     id=\"path898\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "  <path\n"
-  "     d=\"m 12,14.25 c 1.791,0 3.397,0.891 4.498,2.293 L 18,15.055 C 16.533,13.186 14.392,12 12,12 9.608,12 7.467,13.186 6,15.055 l 1.502,1.488 C 8.603,15.141 10.209,14.25 12,14.25 Z\"\n"
-  "     id=\"path896\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "  <path\n"
-  "     d=\"m 12,16.5 c -1.196,0 -2.258,0.602 -2.99,1.536 L 12,21 14.99,18.037 C 14.258,17.102 13.196,16.5 12,16.5 Z\"\n"
-  "     id=\"path894\" />\n"
-  "  <path\n"
-  "     d=\"m 12,5.25 c 4.179,0 7.927,2.078 10.495,5.351 L 24,9.11 C 21.065,5.371 16.783,3 12,3 7.217,3 2.935,5.371 0,9.11 l 1.505,1.491 C 4.073,7.328 7.821,5.25 12,5.25 Z\"\n"
-  "     id=\"path863\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "</svg>\n";
+static const char CONTENT_WIFI_SIGNAL_2_SVG[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9d, 0x56, 0xdb, 0x8e, 0xa3, 0x46, 
+  0x10, 0x7d, 0x9f, 0xaf, 0x68, 0x31, 0x2f, 0x89, 0x02, 0x4d, 0xdf, 0x80, 0x6e, 0xcb, 0x78, 0xa5, 
+  0x64, 0xb4, 0x52, 0xa4, 0xcd, 0x4b, 0xb2, 0xab, 0x95, 0xf2, 0xb2, 0x62, 0x9a, 0xb6, 0x4d, 0x16, 
+  0x68, 0x0b, 0xf0, 0x78, 0x3c, 0x5f, 0x9f, 0xea, 0xe6, 0xe2, 0xb9, 0x78, 0x92, 0x28, 0x48, 0x16, 
+  0xee, 0xaa, 0x53, 0x97, 0x73, 0xaa, 0xc0, 0x5e, 0x7f, 0x78, 0x6c, 0x6a, 0xf4, 0x60, 0xba, 0xbe, 
+  0xb2, 0x6d, 0x1e, 0x50, 0x4c, 0x02, 0x64, 0x5a, 0x6d, 0xcb, 0xaa, 0xdd, 0xe5, 0xc1, 0x97, 0xcf, 
+  0x1f, 0x23, 0x19, 0xa0, 0x7e, 0x28, 0xda, 0xb2, 0xa8, 0x6d, 0x6b, 0xf2, 0xa0, 0xb5, 0xc1, 0x87, 
+  0xcd, 0xcd, 0xba, 0x7f, 0xd8, 0xdd, 0x20, 0x84, 0x20, 0xb8, 0xed, 0x57, 0xa5, 0xce, 0x83, 0xfd, 
+  0x30, 0x1c, 0x56, 0x71, 0x7c, 0x38, 0x76, 0x35, 0xb6, 0xdd, 0x2e, 0x2e, 0x75, 0x6c, 0x6a, 0xd3, 
+  0x98, 0x76, 0xe8, 0x63, 0x8a, 0x69, 0x1c, 0x5c, 0xe0, 0xfa, 0x02, 0xd7, 0x9d, 0x29, 0x86, 0xea, 
+  0xc1, 0x68, 0xdb, 0x34, 0xb6, 0xed, 0x7d, 0x64, 0xdb, 0xdf, 0x3e, 0x03, 0x77, 0xe5, 0x76, 0x41, 
+  0x9f, 0x4e, 0x27, 0x7c, 0xe2, 0x1e, 0x44, 0x95, 0x52, 0x31, 0x61, 0x31, 0x63, 0x11, 0x20, 0xa2, 
+  0xfe, 0xdc, 0x0e, 0xc5, 0x63, 0xf4, 0x32, 0x14, 0x7a, 0xbc, 0x16, 0xca, 0x08, 0x21, 0x31, 0xf8, 
+  0x2e, 0xc8, 0xff, 0x86, 0x5a, 0xf5, 0xa0, 0xca, 0x01, 0x3e, 0x0b, 0x7c, 0x36, 0xe0, 0xde, 0x1e, 
+  0x3b, 0x6d, 0xb6, 0x10, 0x67, 0x70, 0x6b, 0x86, 0xf8, 0xee, 0xf3, 0xdd, 0xe2, 0x8c, 0x08, 0x2e, 
+  0x87, 0xf2, 0x59, 0x9a, 0xaa, 0xfd, 0xde, 0xeb, 0xe2, 0x60, 0x5e, 0x54, 0x9d, 0x8d, 0xa3, 0x02, 
+  0x45, 0x63, 0xfa, 0x43, 0xa1, 0x4d, 0x1f, 0xcf, 0x76, 0x1f, 0x7f, 0xaa, 0xca, 0x61, 0x9f, 0x07, 
+  0x4c, 0xf8, 0xd3, 0xde, 0x54, 0xbb, 0xfd, 0xb0, 0x1c, 0x1f, 0x2a, 0x73, 0xfa, 0xd9, 0x3e, 0xe6, 
+  0x01, 0x41, 0x04, 0x31, 0x81, 0x66, 0xf3, 0x65, 0xb4, 0xd4, 0x1b, 0xaa, 0x32, 0x0f, 0x80, 0x97, 
+  0x4c, 0x13, 0x7f, 0x9c, 0xdb, 0x5c, 0x95, 0x56, 0xbb, 0xba, 0x79, 0x70, 0xaa, 0xb6, 0xd5, 0xb7, 
+  0xbe, 0xda, 0xb5, 0x45, 0xfd, 0x8d, 0xe1, 0x59, 0x82, 0xb9, 0x91, 0xd5, 0x92, 0x90, 0x60, 0xc5, 
+  0x30, 0x47, 0x3f, 0x30, 0x41, 0x92, 0x44, 0xa4, 0x21, 0x62, 0x84, 0xca, 0x88, 0xf0, 0x88, 0xd2, 
+  0x1f, 0x83, 0x0d, 0xc4, 0xac, 0x1b, 0x33, 0x14, 0x65, 0x31, 0x14, 0x2e, 0x7e, 0x2c, 0x3c, 0x5b, 
+  0x64, 0x46, 0x3d, 0x04, 0x40, 0x30, 0xbe, 0xd5, 0xef, 0x77, 0x1f, 0xc7, 0x13, 0x9c, 0xb5, 0x5e, 
+  0x7d, 0xb5, 0xdd, 0xf7, 0xe9, 0x08, 0x97, 0x03, 0x14, 0xf7, 0xf6, 0x08, 0x54, 0x83, 0xcd, 0x62, 
+  0x5e, 0x97, 0x7a, 0x05, 0x82, 0x37, 0xc5, 0xb0, 0xa9, 0x9a, 0x62, 0x67, 0xdc, 0xac, 0x7e, 0x02, 
+  0x81, 0xd7, 0xf1, 0xc5, 0xf1, 0x02, 0x3c, 0x9c, 0x0f, 0xe6, 0x92, 0x74, 0x4c, 0xdb, 0x99, 0x71, 
+  0x72, 0x57, 0xd7, 0xb7, 0xd4, 0x4d, 0xe5, 0x82, 0xe2, 0x3f, 0x86, 0xaa, 0xae, 0x7f, 0x75, 0x45, 
+  0x02, 0x14, 0xbf, 0x4a, 0x5a, 0x0d, 0xb5, 0xd9, 0xf8, 0x9a, 0xe3, 0xd7, 0x99, 0x45, 0x3c, 0xd1, 
+  0x98, 0x48, 0xc6, 0xcf, 0x58, 0xae, 0xe3, 0x59, 0x05, 0x7f, 0x2a, 0xcd, 0xb6, 0xbf, 0x08, 0xe4, 
+  0x4e, 0x32, 0x55, 0x53, 0xa1, 0xf5, 0x32, 0x1d, 0x37, 0x9a, 0xd2, 0x8d, 0x78, 0x84, 0x1e, 0xa0, 
+  0x19, 0x6d, 0x6b, 0xdb, 0xe5, 0xc1, 0xed, 0xd6, 0x5f, 0xc1, 0xe8, 0xb8, 0xb7, 0x5d, 0x69, 0xba, 
+  0xd9, 0x95, 0xfa, 0xeb, 0x85, 0xcb, 0xc2, 0x5e, 0x01, 0x2d, 0xd8, 0x87, 0xc9, 0x6c, 0xef, 0xff, 
+  0x32, 0x7a, 0x18, 0x6c, 0x6d, 0xba, 0xa2, 0x75, 0x52, 0x50, 0x32, 0x79, 0x76, 0x1d, 0xec, 0xdb, 
+  0x35, 0xfb, 0xb1, 0x2a, 0xcd, 0x35, 0xc7, 0xb2, 0x23, 0xae, 0xbd, 0xa5, 0xd0, 0x55, 0x6f, 0xbf, 
+  0x2f, 0x4a, 0x7b, 0x82, 0xe5, 0x7d, 0xed, 0x3c, 0x55, 0x2d, 0x38, 0xa2, 0x79, 0xd5, 0x93, 0x94, 
+  0xbc, 0x83, 0x98, 0xd7, 0x9f, 0x72, 0xb6, 0x40, 0x40, 0xc0, 0x45, 0x28, 0x99, 0x66, 0x93, 0xb9, 
+  0xdf, 0xdb, 0x93, 0xe3, 0x92, 0x07, 0xdb, 0xa2, 0xee, 0xcd, 0xeb, 0x7c, 0x4f, 0xd6, 0x36, 0x79, 
+  0x20, 0x32, 0x2c, 0x12, 0xc9, 0x39, 0x7f, 0xed, 0xd6, 0xf0, 0x48, 0xd1, 0x37, 0x6d, 0xea, 0xf3, 
+  0x35, 0xeb, 0xd4, 0xda, 0xe3, 0x3f, 0x36, 0x0e, 0x91, 0x2c, 0x7b, 0xc7, 0xd7, 0x14, 0x8f, 0x55, 
+  0x53, 0x3d, 0x99, 0xf2, 0x32, 0x9f, 0x4b, 0xc9, 0x63, 0xd7, 0xc1, 0xeb, 0x34, 0xaa, 0x8b, 0xb3, 
+  0xe9, 0x96, 0x67, 0x78, 0x5a, 0x94, 0x43, 0x31, 0xec, 0x47, 0x3c, 0x84, 0xfe, 0x86, 0x04, 0x4e, 
+  0x88, 0x08, 0x29, 0xc7, 0x49, 0xc6, 0x10, 0xc3, 0xf0, 0xb2, 0x0c, 0x29, 0xc3, 0x44, 0x72, 0xf4, 
+  0x0b, 0x4a, 0x30, 0x0b, 0x15, 0x66, 0x99, 0x44, 0x12, 0x0b, 0xca, 0xc2, 0x0c, 0x27, 0x68, 0xba, 
+  0x69, 0x04, 0x11, 0x52, 0x86, 0x04, 0xa5, 0x58, 0x86, 0x14, 0x67, 0x99, 0x42, 0x2a, 0x84, 0x64, 
+  0x10, 0x58, 0xa3, 0x88, 0x8e, 0x59, 0xb1, 0x90, 0x0a, 0xf2, 0xd0, 0x0c, 0xa7, 0x29, 0x0d, 0x29, 
+  0xc5, 0x8c, 0x0b, 0x44, 0x05, 0x56, 0x52, 0x40, 0xe2, 0xcc, 0x67, 0xf3, 0x77, 0x8d, 0x22, 0xe6, 
+  0xad, 0x04, 0x45, 0xc9, 0x08, 0x86, 0x58, 0x81, 0x22, 0xd0, 0x5a, 0xa5, 0x21, 0xc7, 0x92, 0x31, 
+  0xf4, 0xf4, 0x6c, 0x78, 0x8e, 0x85, 0x54, 0x72, 0x9e, 0xdb, 0x70, 0xae, 0x61, 0xbd, 0xb6, 0xf0, 
+  0xf4, 0xad, 0x6e, 0xb5, 0xbf, 0xae, 0xd2, 0x6d, 0x5c, 0x41, 0xa8, 0xcf, 0x5c, 0x45, 0x68, 0x5a, 
+  0x51, 0x28, 0xc8, 0x31, 0x57, 0x59, 0x48, 0xb0, 0x54, 0x14, 0xd4, 0x10, 0x4a, 0x86, 0x0c, 0x33, 
+  0xc5, 0xd1, 0x27, 0x44, 0x81, 0x59, 0x82, 0xe1, 0x9d, 0xe5, 0x38, 0xa4, 0x38, 0xe1, 0xdc, 0x09, 
+  0x45, 0x65, 0xea, 0x38, 0x70, 0x05, 0xa9, 0x98, 0x4f, 0xc8, 0x90, 0xc2, 0x29, 0x91, 0xee, 0x0b, 
+  0xf4, 0x9b, 0x66, 0x33, 0x2a, 0x9d, 0xc3, 0x6b, 0xe4, 0x04, 0x61, 0x9e, 0x94, 0x84, 0x64, 0x12, 
+  0xe0, 0xdc, 0x39, 0xa9, 0xa0, 0x88, 0x12, 0xcc, 0x88, 0x9a, 0xda, 0x5a, 0xfa, 0xfb, 0xf3, 0x0d, 
+  0xd9, 0xf4, 0x7f, 0x91, 0x4d, 0xfd, 0xb0, 0x60, 0x20, 0x14, 0x74, 0x24, 0x4e, 0x66, 0x96, 0xc0, 
+  0xd8, 0xa0, 0x01, 0xe6, 0x35, 0x87, 0xc2, 0x40, 0x2c, 0x75, 0x6c, 0x59, 0xc8, 0xa8, 0x9f, 0x0e, 
+  0xd8, 0x24, 0x26, 0x3c, 0x73, 0xb4, 0x85, 0xc7, 0xc3, 0x04, 0x29, 0x04, 0x38, 0x5e, 0x90, 0xc6, 
+  0x27, 0x9d, 0x93, 0xbf, 0x6d, 0x54, 0xbc, 0xdf, 0x4e, 0x32, 0x4a, 0x2f, 0x30, 0xcd, 0x14, 0x74, 
+  0x93, 0xc1, 0x0f, 0x43, 0x06, 0x72, 0x13, 0x58, 0x31, 0x90, 0x41, 0xa8, 0x04, 0x10, 0x3c, 0xa1, 
+  0xd0, 0x0d, 0x73, 0x1b, 0x42, 0x29, 0xb4, 0xc0, 0xe0, 0xaf, 0x46, 0xea, 0x1d, 0x19, 0x75, 0x63, 
+  0xc8, 0x24, 0x0f, 0xb9, 0x4b, 0xc6, 0x21, 0x9e, 0xd1, 0x0c, 0xee, 0xc0, 0x83, 0xcf, 0x08, 0x32, 
+  0xc6, 0x8d, 0x92, 0x27, 0x4e, 0x72, 0xe5, 0xb2, 0x08, 0x28, 0xc2, 0x61, 0x75, 0x39, 0x93, 0x10, 
+  0x26, 0x19, 0x1d, 0x7b, 0x99, 0x7b, 0x7a, 0xc3, 0x22, 0xe5, 0xff, 0x22, 0xf7, 0xda, 0xfd, 0x8e, 
+  0x6c, 0x6e, 0xfe, 0x06, 0xc3, 0x0a, 0x0d, 0x23, 0x17, 0x09, 0x00, 0x00, 0x00 };
@@ -1,66 +1,66 @@
-static const char CONTENT_WIFI_SIGNAL_3_SVG[] PROGMEM = 
-  "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
-  "<svg\n"
-  "   xmlns:dc=\"http://purl.org/dc/elements/1.1/\"\n"
-  "   xmlns:cc=\"http://creativecommons.org/ns#\"\n"
-  "   xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"\n"
-  "   xmlns:svg=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns:sodipodi=\"http://sodipodi.sourceforge.net/DTD/sodipodi-0.dtd\"\n"
-  "   xmlns:inkscape=\"http://www.inkscape.org/namespaces/inkscape\"\n"
-  "   width=\"24\"\n"
-  "   height=\"24\"\n"
-  "   viewBox=\"0 0 24 24\"\n"
-  "   version=\"1.1\"\n"
-  "   id=\"svg865\"\n"
-  "   sodipodi:docname=\"wifi_signal_3.svg\"\n"
-  "   inkscape:version=\"0.92.3 (2405546, 2018-03-11)\">\n"
-  "  <metadata\n"
-  "     id=\"metadata871\">\n"
-  "    <rdf:RDF>\n"
-  "      <cc:Work\n"
-  "         rdf:about=\"\">\n"
-  "        <dc:format>image/svg+xml</dc:format>\n"
-  "        <dc:type\n"
-  "           rdf:resource=\"http://purl.org/dc/dcmitype/StillImage\" />\n"
-  "        <dc:title></dc:title>\n"
-  "      </cc:Work>\n"
-  "    </rdf:RDF>\n"
-  "  </metadata>\n"
-  "  <defs\n"
-  "     id=\"defs869\" />\n"
-  "  <sodipodi:namedview\n"
-  "     pagecolor=\"#ffffff\"\n"
-  "     bordercolor=\"#666666\"\n"
-  "     borderopacity=\"1\"\n"
-  "     objecttolerance=\"10\"\n"
-  "     gridtolerance=\"10\"\n"
-  "     guidetolerance=\"10\"\n"
-  "     inkscape:pageopacity=\"0\"\n"
-  "     inkscape:pageshadow=\"2\"\n"
-  "     inkscape:window-width=\"2560\"\n"
-  "     inkscape:window-height=\"1320\"\n"
-  "     id=\"namedview867\"\n"
-  "     showgrid=\"false\"\n"
-  "     inkscape:zoom=\"47.458333\"\n"
-  "     inkscape:cx=\"12\"\n"
-  "     inkscape:cy=\"12\"\n"
-  "     inkscape:window-x=\"2560\"\n"
-  "     inkscape:window-y=\"27\"\n"
-  "     inkscape:window-maximized=\"1\"\n"
-  "     inkscape:current-layer=\"svg865\" />\n"
-  "  <path\n"
-  "     d=\"M 4.504,13.572 2.999,12.083 C 5.2,9.278 8.412,7.5 12,7.5 c 3.588,0 6.8,1.779 9,4.583 l -1.504,1.489 C 17.661,11.234 14.984,9.75 12,9.75 c -2.984,0 -5.661,1.484 -7.496,3.822 z\"\n"
-  "     id=\"path898\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "  <path\n"
-  "     d=\"m 12,14.25 c 1.791,0 3.397,0.891 4.498,2.293 L 18,15.055 C 16.533,13.186 14.392,12 12,12 9.608,12 7.467,13.186 6,15.055 l 1.502,1.488 C 8.603,15.141 10.209,14.25 12,14.25 Z\"\n"
-  "     id=\"path896\" />\n"
-  "  <path\n"
-  "     d=\"m 12,16.5 c -1.196,0 -2.258,0.602 -2.99,1.536 L 12,21 14.99,18.037 C 14.258,17.102 13.196,16.5 12,16.5 Z\"\n"
-  "     id=\"path894\" />\n"
-  "  <path\n"
-  "     d=\"m 12,5.25 c 4.179,0 7.927,2.078 10.495,5.351 L 24,9.11 C 21.065,5.371 16.783,3 12,3 7.217,3 2.935,5.371 0,9.11 l 1.505,1.491 C 4.073,7.328 7.821,5.25 12,5.25 Z\"\n"
-  "     id=\"path863\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "</svg>\n";
+static const char CONTENT_WIFI_SIGNAL_3_SVG[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8d, 0x56, 0xdb, 0x8e, 0xa3, 0x46, 
+  0x10, 0x7d, 0x9f, 0xaf, 0x68, 0x31, 0x2f, 0x89, 0x02, 0x4d, 0xdf, 0x80, 0x6e, 0xcb, 0x78, 0xa5, 
+  0x64, 0xb4, 0x52, 0xa4, 0xcd, 0x4b, 0xb2, 0xab, 0x95, 0xf2, 0xb2, 0x62, 0x9a, 0xb6, 0x4d, 0x16, 
+  0x68, 0x0b, 0xf0, 0x78, 0x3c, 0x5f, 0x9f, 0xea, 0xe6, 0xe2, 0xb9, 0x78, 0x36, 0x41, 0xb2, 0x70, 
+  0x57, 0x9d, 0xaa, 0x3a, 0x75, 0xaa, 0xc0, 0x5e, 0x7f, 0x78, 0x6c, 0x6a, 0xf4, 0x60, 0xba, 0xbe, 
+  0xb2, 0x6d, 0x1e, 0x50, 0x4c, 0x02, 0x64, 0x5a, 0x6d, 0xcb, 0xaa, 0xdd, 0xe5, 0xc1, 0x97, 0xcf, 
+  0x1f, 0x23, 0x19, 0xa0, 0x7e, 0x28, 0xda, 0xb2, 0xa8, 0x6d, 0x6b, 0xf2, 0xa0, 0xb5, 0xc1, 0x87, 
+  0xcd, 0xcd, 0xba, 0x7f, 0xd8, 0xdd, 0x20, 0x84, 0x20, 0xb8, 0xed, 0x57, 0xa5, 0xce, 0x83, 0xfd, 
+  0x30, 0x1c, 0x56, 0x71, 0x7c, 0x38, 0x76, 0x35, 0xb6, 0xdd, 0x2e, 0x2e, 0x75, 0x6c, 0x6a, 0xd3, 
+  0x98, 0x76, 0xe8, 0x63, 0x8a, 0x69, 0x1c, 0x5c, 0xe0, 0xfa, 0x02, 0xd7, 0x9d, 0x29, 0x86, 0xea, 
+  0xc1, 0x68, 0xdb, 0x34, 0xb6, 0xed, 0x7d, 0x64, 0xdb, 0xdf, 0x3e, 0x03, 0x77, 0xe5, 0x76, 0x41, 
+  0x9f, 0x4e, 0x27, 0x7c, 0xe2, 0x1e, 0x44, 0x95, 0x52, 0x31, 0x61, 0x31, 0x63, 0x11, 0x20, 0xa2, 
+  0xfe, 0xdc, 0x0e, 0xc5, 0x63, 0xf4, 0x32, 0x14, 0x38, 0x5e, 0x0b, 0x65, 0x84, 0x90, 0x18, 0x7c, 
+  0x17, 0xe4, 0xff, 0x43, 0xad, 0x7a, 0x50, 0xe5, 0x00, 0x9f, 0x05, 0x3e, 0x1b, 0x70, 0x6f, 0x8f, 
+  0x9d, 0x36, 0x5b, 0x88, 0x33, 0xb8, 0x35, 0x43, 0x7c, 0xf7, 0xf9, 0x6e, 0x71, 0x46, 0x04, 0x97, 
+  0x43, 0xf9, 0x2c, 0x4d, 0xd5, 0x7e, 0xef, 0x75, 0x71, 0x30, 0x2f, 0xaa, 0xce, 0xc6, 0x51, 0x81, 
+  0xa2, 0x31, 0xfd, 0xa1, 0xd0, 0xa6, 0x8f, 0x67, 0xbb, 0x8f, 0x3f, 0x55, 0xe5, 0xb0, 0xcf, 0x03, 
+  0x26, 0xfc, 0x69, 0x6f, 0xaa, 0xdd, 0x7e, 0x58, 0x8e, 0x0f, 0x95, 0x39, 0xfd, 0x6a, 0x1f, 0xf3, 
+  0x80, 0x20, 0x82, 0x98, 0x40, 0xb3, 0xf9, 0x32, 0x5a, 0xea, 0x0d, 0x55, 0x99, 0x07, 0xd0, 0x97, 
+  0x4c, 0x13, 0x7f, 0x9c, 0x69, 0xae, 0x4a, 0xab, 0x5d, 0xdd, 0x3c, 0x38, 0x55, 0xdb, 0xea, 0x5b, 
+  0x5f, 0xed, 0xda, 0xa2, 0xfe, 0xc6, 0xf1, 0x2c, 0xc1, 0x4c, 0x64, 0xb5, 0x24, 0x24, 0x58, 0x31, 
+  0xcc, 0xd1, 0x4f, 0x4c, 0x90, 0x24, 0x11, 0x69, 0x88, 0x18, 0xa1, 0x32, 0x22, 0x3c, 0xa2, 0xf4, 
+  0xe7, 0x60, 0x03, 0x31, 0xeb, 0xc6, 0x0c, 0x45, 0x59, 0x0c, 0x85, 0x8b, 0x1f, 0x0b, 0xcf, 0x16, 
+  0x99, 0x51, 0x0f, 0x01, 0x10, 0x8c, 0x6f, 0xf5, 0xe7, 0xdd, 0xc7, 0xf1, 0x04, 0x67, 0xad, 0x57, 
+  0x5f, 0x6d, 0xf7, 0x7d, 0x3a, 0xc2, 0xe5, 0x00, 0xc5, 0xbd, 0x3d, 0x42, 0xab, 0xc1, 0x66, 0x31, 
+  0xaf, 0x4b, 0xbd, 0x02, 0xc1, 0x9b, 0x62, 0xd8, 0x54, 0x4d, 0xb1, 0x33, 0x6e, 0x56, 0xbf, 0x80, 
+  0xc0, 0xeb, 0xf8, 0xe2, 0x78, 0x01, 0x1e, 0xce, 0x07, 0x73, 0x49, 0x3a, 0xa6, 0xed, 0xcc, 0x38, 
+  0xb9, 0xab, 0xeb, 0x5b, 0xea, 0xa6, 0x72, 0x41, 0xf1, 0x5f, 0x43, 0x55, 0xd7, 0xbf, 0xbb, 0x22, 
+  0x01, 0x8a, 0x5f, 0x25, 0xad, 0x86, 0xda, 0x6c, 0x7c, 0xcd, 0xf1, 0xeb, 0xdc, 0x45, 0x3c, 0xb5, 
+  0x31, 0x35, 0x19, 0x3f, 0xeb, 0x72, 0x1d, 0xcf, 0x2a, 0xf8, 0x53, 0x69, 0xb6, 0xfd, 0x45, 0x20, 
+  0x77, 0x92, 0xa9, 0x9a, 0x0a, 0xad, 0x97, 0xe9, 0xb8, 0xd1, 0x94, 0x6e, 0xc4, 0x23, 0xf4, 0x00, 
+  0x64, 0xb4, 0xad, 0x6d, 0x97, 0x07, 0xb7, 0x5b, 0x7f, 0x05, 0xa3, 0xe3, 0xde, 0x76, 0xa5, 0xe9, 
+  0x66, 0x57, 0xea, 0xaf, 0x17, 0x2e, 0x0b, 0x7b, 0x05, 0x6d, 0xc1, 0x3e, 0x4c, 0x66, 0x7b, 0xff, 
+  0x8f, 0xd1, 0xc3, 0x60, 0x6b, 0xd3, 0x15, 0xad, 0x93, 0x82, 0x92, 0xc9, 0xb3, 0xeb, 0x60, 0xdf, 
+  0xae, 0xd9, 0x8f, 0x55, 0x69, 0xae, 0x39, 0x96, 0x1d, 0x71, 0xf4, 0x96, 0x42, 0x57, 0xbd, 0xfd, 
+  0xbe, 0x28, 0xed, 0x09, 0x96, 0xf7, 0xb5, 0xf3, 0x54, 0xb5, 0xe0, 0x88, 0xe6, 0x55, 0x4f, 0x52, 
+  0xf2, 0x0e, 0x62, 0x5e, 0x7f, 0xca, 0xd9, 0x02, 0x01, 0x01, 0x17, 0xa1, 0x64, 0x9a, 0x4d, 0xe6, 
+  0x7e, 0x6f, 0x4f, 0xae, 0x97, 0x3c, 0xd8, 0x16, 0x75, 0x6f, 0x5e, 0xe7, 0x7b, 0xb2, 0xb6, 0xc9, 
+  0x03, 0x91, 0x61, 0x91, 0x48, 0xce, 0xf9, 0x6b, 0xb7, 0x86, 0x47, 0x8a, 0xbe, 0xa1, 0xa9, 0xcf, 
+  0xd7, 0xac, 0x13, 0xb5, 0xc7, 0x1f, 0x12, 0x87, 0x48, 0x96, 0xbd, 0xe3, 0x6b, 0x8a, 0xc7, 0xaa, 
+  0xa9, 0x9e, 0x4c, 0x79, 0x99, 0xcf, 0xa5, 0xe4, 0xb1, 0xeb, 0xe0, 0x75, 0x1a, 0xd5, 0xc5, 0xd9, 
+  0x74, 0xcb, 0x33, 0x3c, 0x2d, 0xca, 0xa1, 0x18, 0xf6, 0x23, 0x1e, 0x42, 0xff, 0x40, 0x02, 0x27, 
+  0x44, 0x84, 0x94, 0xe3, 0x24, 0x63, 0x88, 0x61, 0x78, 0x59, 0x86, 0x94, 0x61, 0x22, 0x39, 0xfa, 
+  0x0d, 0x25, 0x98, 0x85, 0x0a, 0xb3, 0x4c, 0x22, 0x89, 0x05, 0x65, 0x61, 0x86, 0x13, 0x34, 0xdd, 
+  0x34, 0x82, 0x08, 0x29, 0x43, 0x82, 0x52, 0x2c, 0x43, 0x8a, 0xb3, 0x4c, 0x21, 0x15, 0x42, 0x32, 
+  0x08, 0xac, 0x51, 0x44, 0xc7, 0xac, 0x58, 0x48, 0x05, 0x79, 0x68, 0x86, 0xd3, 0x94, 0x86, 0x94, 
+  0x62, 0xc6, 0x05, 0xa2, 0x02, 0x2b, 0x29, 0x20, 0x71, 0xe6, 0xb3, 0xf9, 0xbb, 0x46, 0x11, 0xf3, 
+  0x56, 0x82, 0xa2, 0x64, 0x04, 0x43, 0xac, 0x40, 0x11, 0x68, 0xad, 0xd2, 0x90, 0x63, 0xc9, 0x18, 
+  0x7a, 0x7a, 0x36, 0x3c, 0xd7, 0x85, 0x54, 0x72, 0x9e, 0xdb, 0x70, 0xae, 0x61, 0xbd, 0xb6, 0xf0, 
+  0xf4, 0xad, 0x6e, 0xb5, 0xbf, 0xae, 0xb6, 0xdb, 0xb8, 0x82, 0x50, 0x9f, 0xb9, 0x8a, 0x40, 0x5a, 
+  0x51, 0x28, 0xc8, 0x31, 0x57, 0x59, 0x48, 0xb0, 0x54, 0x14, 0xd4, 0x10, 0x4a, 0x86, 0x0c, 0x33, 
+  0xc5, 0xd1, 0x27, 0x44, 0xa1, 0xb3, 0x04, 0xc3, 0x3b, 0xcb, 0xf5, 0x90, 0xe2, 0x84, 0x73, 0x27, 
+  0x14, 0x95, 0xa9, 0xeb, 0x81, 0x2b, 0x48, 0xc5, 0x7c, 0x42, 0x86, 0x14, 0x4e, 0x89, 0x74, 0x5f, 
+  0x80, 0x6f, 0x9a, 0xcd, 0xa8, 0x74, 0x0e, 0xaf, 0x91, 0x13, 0x84, 0xf9, 0xa6, 0x24, 0x24, 0x93, 
+  0x00, 0xe7, 0xce, 0x49, 0x05, 0x45, 0x94, 0x60, 0x46, 0xd4, 0x44, 0x6b, 0xe1, 0xf7, 0xf7, 0x9b, 
+  0x66, 0xd3, 0x1f, 0xb4, 0x94, 0xfa, 0x91, 0x80, 0xec, 0x14, 0xd4, 0x22, 0x4e, 0x4c, 0x96, 0xc0, 
+  0x70, 0xa0, 0x0c, 0xf3, 0xca, 0x42, 0x7a, 0xa0, 0x9f, 0xba, 0x9e, 0x58, 0xc8, 0xa8, 0x9f, 0x01, 
+  0xd8, 0x24, 0x26, 0x3c, 0x73, 0xcd, 0x09, 0x8f, 0x87, 0x39, 0x51, 0x08, 0x70, 0xec, 0x21, 0x8d, 
+  0x4f, 0x3a, 0x27, 0x7f, 0x4b, 0x47, 0xbc, 0x4f, 0x27, 0x19, 0x05, 0x16, 0x98, 0x66, 0x0a, 0xd8, 
+  0x64, 0xf0, 0xfa, 0xcf, 0x40, 0x54, 0x02, 0x8b, 0x04, 0xcd, 0x0a, 0x95, 0x00, 0x82, 0x27, 0x14, 
+  0xd8, 0x30, 0xb7, 0x07, 0x94, 0x02, 0x05, 0x06, 0x7f, 0x28, 0x52, 0xef, 0xc8, 0xa8, 0x13, 0x3b, 
+  0x93, 0x3c, 0xe4, 0x2e, 0x19, 0x87, 0x78, 0x46, 0x33, 0xb8, 0x43, 0x1f, 0x7c, 0x46, 0x90, 0x31, 
+  0x6e, 0x14, 0x36, 0x71, 0xc2, 0x2a, 0x97, 0x45, 0x40, 0x11, 0x0e, 0x0b, 0xca, 0x99, 0x84, 0x30, 
+  0xc9, 0xe8, 0xc8, 0x65, 0xe6, 0xf4, 0xa6, 0x8b, 0x94, 0xff, 0xc7, 0x06, 0xad, 0xdd, 0xaf, 0xc5, 
+  0xe6, 0xe6, 0x5f, 0x9a, 0x9f, 0x4a, 0x88, 0xfd, 0x08, 0x00, 0x00, 0x00 };
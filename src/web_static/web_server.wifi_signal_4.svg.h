@@ -1,65 +1,66 @@
-static const char CONTENT_WIFI_SIGNAL_4_SVG[] PROGMEM = 
-  "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
-  "<svg\n"
-  "   xmlns:dc=\"http://purl.org/dc/elements/1.1/\"\n"
-  "   xmlns:cc=\"http://creativecommons.org/ns#\"\n"
-  "   xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"\n"
-  "   xmlns:svg=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns:sodipodi=\"http://sodipodi.sourceforge.net/DTD/sodipodi-0.dtd\"\n"
-  "   xmlns:inkscape=\"http://www.inkscape.org/namespaces/inkscape\"\n"
-  "   width=\"24\"\n"
-  "   height=\"24\"\n"
-  "   viewBox=\"0 0 24 24\"\n"
-  "   version=\"1.1\"\n"
-  "   id=\"svg865\"\n"
-  "   sodipodi:docname=\"wifi_signal_4.svg\"\n"
-  "   inkscape:version=\"0.92.3 (2405546, 2018-03-11)\">\n"
-  "  <metadata\n"
-  "     id=\"metadata871\">\n"
-  "    <rdf:RDF>\n"
-  "      <cc:Work\n"
-  "         rdf:about=\"\">\n"
-  "        <dc:format>image/svg+xml</dc:format>\n"
-  "        <dc:type\n"
-  "           rdf:resource=\"http://purl.org/dc/dcmitype/StillImage\" />\n"
-  "        <dc:title></dc:title>\n"
-  "      </cc:Work>\n"
-  "    </rdf:RDF>\n"
-  "  </metadata>\n"
-  "  <defs\n"
-  "     id=\"defs869\" />\n"
-  "  <sodipodi:namedview\n"
-  "     pagecolor=\"#ffffff\"\n"
-  "     bordercolor=\"#666666\"\n"
-  "     borderopacity=\"1\"\n"
-  "     objecttolerance=\"10\"\n"
-  "     gridtolerance=\"10\"\n"
-  "     guidetolerance=\"10\"\n"
-  "     inkscape:pageopacity=\"0\"\n"
-  "     inkscape:pageshadow=\"2\"\n"
-  "     inkscape:window-width=\"2560\"\n"
-  "     inkscape:window-height=\"1320\"\n"
-  "     id=\"namedview867\"\n"
-  "     showgrid=\"false\"\n"
-  "     inkscape:zoom=\"47.458333\"\n"
-  "     inkscape:cx=\"12\"\n"
-  "     inkscape:cy=\"12\"\n"
-  "     inkscape:window-x=\"2560\"\n"
-  "     inkscape:window-y=\"27\"\n"
-  "     inkscape:window-maximized=\"1\"\n"
-  "     inkscape:current-layer=\"svg865\" />\n"
-  "  <path\n"
-  "     d=\"M 4.504,13.572 2.999,12.083 C 5.2,9.278 8.412,7.5 12,7.5 c 3.588,0 6.8,1.779 9,4.583 l -1.504,1.489 C 17.661,11.234 14.984,9.75 12,9.75 c -2.984,0 -5.661,1.484 -7.496,3.822 z\"\n"
-  "     id=\"path898\" />\n"
-  "  <path\n"
-  "     d=\"m 12,14.25 c 1.791,0 3.397,0.891 4.498,2.293 L 18,15.055 C 16.533,13.186 14.392,12 12,12 9.608,12 7.467,13.186 6,15.055 l 1.502,1.488 C 8.603,15.141 10.209,14.25 12,14.25 Z\"\n"
-  "     id=\"path896\" />\n"
-  "  <path\n"
-  "     d=\"m 12,16.5 c -1.196,0 -2.258,0.602 -2.99,1.536 L 12,21 14.99,18.037 C 14.258,17.102 13.196,16.5 12,16.5 Z\"\n"
-  "     id=\"path894\" />\n"
-  "  <path\n"
-  "     d=\"m 12,5.25 c 4.179,0 7.927,2.078 10.495,5.351 L 24,9.11 C 21.065,5.371 16.783,3 12,3 7.217,3 2.935,5.371 0,9.11 l 1.505,1.491 C 4.073,7.328 7.821,5.25 12,5.25 Z\"\n"
-  "     id=\"path863\"\n"
-  "     style=\"fill:#cccccc\" />\n"
-  "</svg>\n";
+static const char CONTENT_WIFI_SIGNAL_4_SVG[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8d, 0x56, 0xdb, 0x6e, 0xe3, 0x36, 
+  0x10, 0x7d, 0xcf, 0x57, 0x10, 0xca, 0x4b, 0x8b, 0x4a, 0x14, 0x6f, 0x92, 0x48, 0xc3, 0xf2, 0x02, 
+  0x6d, 0xb0, 0x40, 0x81, 0xf6, 0xa5, 0xdd, 0xa2, 0x40, 0x5f, 0x16, 0x0a, 0x45, 0xdb, 0xea, 0x4a, 
+  0xa2, 0x21, 0xc9, 0xb1, 0x9d, 0xaf, 0xef, 0x90, 0xba, 0x38, 0x17, 0x67, 0x51, 0x01, 0x81, 0xcd, 
+  0x99, 0x33, 0x87, 0x67, 0xce, 0x50, 0x74, 0xd6, 0x9f, 0xce, 0x4d, 0x8d, 0x9e, 0x4c, 0xd7, 0x57, 
+  0xb6, 0xcd, 0x03, 0x8a, 0x49, 0x80, 0x4c, 0xab, 0x6d, 0x59, 0xb5, 0xbb, 0x3c, 0xf8, 0xeb, 0xcb, 
+  0xe7, 0x48, 0x06, 0xa8, 0x1f, 0x8a, 0xb6, 0x2c, 0x6a, 0xdb, 0x9a, 0x3c, 0x68, 0x6d, 0xf0, 0x69, 
+  0x73, 0xb7, 0xee, 0x9f, 0x76, 0x77, 0x08, 0x21, 0x28, 0x6e, 0xfb, 0x55, 0xa9, 0xf3, 0x60, 0x3f, 
+  0x0c, 0x87, 0x55, 0x1c, 0x1f, 0x8e, 0x5d, 0x8d, 0x6d, 0xb7, 0x8b, 0x4b, 0x1d, 0x9b, 0xda, 0x34, 
+  0xa6, 0x1d, 0xfa, 0x98, 0x62, 0x1a, 0x07, 0x57, 0xb8, 0xbe, 0xc2, 0x75, 0x67, 0x8a, 0xa1, 0x7a, 
+  0x32, 0xda, 0x36, 0x8d, 0x6d, 0x7b, 0x5f, 0xd9, 0xf6, 0xf7, 0x2f, 0xc0, 0x5d, 0xb9, 0x5d, 0xd0, 
+  0xa7, 0xd3, 0x09, 0x9f, 0xb8, 0x07, 0x51, 0xa5, 0x54, 0x4c, 0x58, 0xcc, 0x58, 0x04, 0x88, 0xa8, 
+  0xbf, 0xb4, 0x43, 0x71, 0x8e, 0x5e, 0x97, 0x82, 0xc6, 0x5b, 0xa5, 0x8c, 0x10, 0x12, 0x43, 0xee, 
+  0x8a, 0xfc, 0x7f, 0xa8, 0x55, 0x0f, 0xae, 0x1c, 0xe0, 0x6f, 0x81, 0xcf, 0x01, 0xdc, 0xdb, 0x63, 
+  0xa7, 0xcd, 0x16, 0xea, 0x0c, 0x6e, 0xcd, 0x10, 0x3f, 0x7c, 0x79, 0x58, 0x92, 0x11, 0xc1, 0xe5, 
+  0x50, 0xbe, 0xa0, 0xa9, 0xda, 0x6f, 0xbd, 0x2e, 0x0e, 0xe6, 0xd5, 0xae, 0x73, 0x70, 0x74, 0xa0, 
+  0x68, 0x4c, 0x7f, 0x28, 0xb4, 0xe9, 0xe3, 0x39, 0xee, 0xeb, 0x4f, 0x55, 0x39, 0xec, 0xf3, 0x80, 
+  0x09, 0xbf, 0xda, 0x9b, 0x6a, 0xb7, 0x1f, 0x96, 0xe5, 0x53, 0x65, 0x4e, 0x3f, 0xdb, 0x73, 0x1e, 
+  0x10, 0x44, 0x10, 0x13, 0x68, 0x0e, 0x5f, 0x47, 0x4b, 0x7d, 0xa0, 0x2a, 0xf3, 0x00, 0xfa, 0x92, 
+  0x69, 0xe2, 0x97, 0xb3, 0xcc, 0x55, 0x69, 0xb5, 0xdb, 0x37, 0x0f, 0x4e, 0xd5, 0xb6, 0xfa, 0xda, 
+  0x57, 0xbb, 0xb6, 0xa8, 0xbf, 0x0a, 0x3c, 0x5b, 0x30, 0x0b, 0x59, 0x2d, 0x84, 0x04, 0x2b, 0x86, 
+  0x39, 0xfa, 0x81, 0x09, 0x92, 0x24, 0x22, 0x0d, 0x11, 0x23, 0x54, 0x46, 0x84, 0x47, 0x94, 0xfe, 
+  0x18, 0x6c, 0xa0, 0x66, 0xdd, 0x98, 0xa1, 0x28, 0x8b, 0xa1, 0x70, 0xf5, 0xe3, 0xc6, 0x73, 0x44, 
+  0x66, 0xd4, 0x43, 0x00, 0x04, 0xe3, 0x5b, 0xfd, 0xf1, 0xf0, 0x79, 0x5c, 0xc1, 0x5a, 0xeb, 0xd5, 
+  0xdf, 0xb6, 0xfb, 0x36, 0x2d, 0xe1, 0x71, 0x80, 0xe2, 0xd1, 0x1e, 0xa1, 0xd5, 0x60, 0xb3, 0x84, 
+  0xd7, 0xa5, 0x5e, 0x81, 0xe1, 0x4d, 0x31, 0x6c, 0xaa, 0xa6, 0xd8, 0x19, 0x37, 0xab, 0x9f, 0xc0, 
+  0xe0, 0x75, 0x7c, 0x4d, 0xbc, 0x02, 0x0f, 0x97, 0x83, 0xb9, 0x92, 0x8e, 0xb4, 0x9d, 0x19, 0x27, 
+  0x77, 0xf3, 0xf8, 0x96, 0xba, 0xa9, 0x5c, 0x51, 0xfc, 0xe7, 0x50, 0xd5, 0xf5, 0xaf, 0x6e, 0x93, 
+  0x00, 0xc5, 0x6f, 0x48, 0xab, 0xa1, 0x36, 0x1b, 0xbf, 0xe7, 0xf8, 0x75, 0xee, 0x22, 0x9e, 0xda, 
+  0x98, 0x9a, 0x8c, 0x5f, 0x74, 0xb9, 0x8e, 0x67, 0x17, 0xfc, 0xaa, 0x34, 0xdb, 0xfe, 0x6a, 0x90, 
+  0x5b, 0xc9, 0x54, 0x4d, 0x1b, 0xad, 0x97, 0xe9, 0xb8, 0xd1, 0x94, 0x6e, 0xc4, 0x23, 0xf4, 0x00, 
+  0x62, 0xb4, 0xad, 0x6d, 0x97, 0x07, 0xf7, 0x5b, 0xff, 0x04, 0x63, 0xe2, 0xd1, 0x76, 0xa5, 0xe9, 
+  0xe6, 0x54, 0xea, 0x9f, 0x57, 0x29, 0x0b, 0xe7, 0x0a, 0xda, 0x82, 0xf3, 0x30, 0x85, 0xed, 0xe3, 
+  0xbf, 0x46, 0x0f, 0x83, 0xad, 0x4d, 0x57, 0xb4, 0xce, 0x0a, 0x4a, 0xa6, 0xcc, 0xae, 0x83, 0xf3, 
+  0x76, 0x2b, 0x7e, 0xac, 0x4a, 0x73, 0x2b, 0xb1, 0x9c, 0x11, 0x27, 0x6f, 0xd9, 0xe8, 0x66, 0xb6, 
+  0xdf, 0x17, 0xa5, 0x3d, 0xc1, 0xe1, 0x7d, 0x9b, 0x3c, 0x55, 0x2d, 0x24, 0xa2, 0xf9, 0xa8, 0x27, 
+  0x29, 0xf9, 0x00, 0x31, 0x1f, 0x7f, 0xca, 0xd9, 0x02, 0x01, 0x03, 0x17, 0xa3, 0x64, 0x9a, 0x4d, 
+  0xe1, 0x7e, 0x6f, 0x4f, 0xae, 0x97, 0x3c, 0xd8, 0x16, 0x75, 0x6f, 0xde, 0xf2, 0x3d, 0x5b, 0xdb, 
+  0xe4, 0x81, 0xc8, 0xb0, 0x48, 0x24, 0xe7, 0xfc, 0x6d, 0x5a, 0xc3, 0x2b, 0x45, 0xdf, 0xc9, 0xd4, 
+  0x97, 0x5b, 0xd1, 0x49, 0xda, 0xf9, 0xbb, 0xc2, 0xa1, 0x92, 0x65, 0x1f, 0xe4, 0x9a, 0xe2, 0x5c, 
+  0x35, 0xd5, 0xb3, 0x29, 0xaf, 0xf3, 0xb9, 0x6e, 0x79, 0xec, 0x3a, 0xb8, 0x4e, 0xa3, 0xba, 0xb8, 
+  0x98, 0x6e, 0x79, 0x87, 0xa7, 0x83, 0x72, 0x28, 0x86, 0xfd, 0x88, 0x87, 0xd2, 0xdf, 0x91, 0xc0, 
+  0x09, 0x11, 0x21, 0xe5, 0x38, 0xc9, 0x18, 0x62, 0x18, 0x2e, 0xcb, 0x90, 0x32, 0x4c, 0x24, 0x47, 
+  0xbf, 0xa0, 0x04, 0xb3, 0x50, 0x61, 0x96, 0x49, 0x24, 0xb1, 0xa0, 0x2c, 0xcc, 0x70, 0x82, 0xa6, 
+  0x0f, 0x8d, 0xa0, 0x42, 0xca, 0x90, 0xa0, 0x14, 0xcb, 0x90, 0xe2, 0x2c, 0x53, 0x48, 0x85, 0x40, 
+  0x06, 0x85, 0x35, 0x8a, 0xe8, 0xc8, 0x8a, 0x85, 0x54, 0xc0, 0x43, 0x33, 0x9c, 0xa6, 0x34, 0xa4, 
+  0x14, 0x33, 0x2e, 0x10, 0x15, 0x58, 0x49, 0x01, 0xc4, 0x99, 0x67, 0xf3, 0x9f, 0x1a, 0x45, 0xcc, 
+  0x47, 0x09, 0x8a, 0x92, 0x11, 0x0c, 0xb5, 0x02, 0x45, 0xe0, 0xb5, 0x4a, 0x43, 0x8e, 0x25, 0x63, 
+  0xe8, 0xf9, 0xc5, 0xf0, 0x5c, 0x17, 0x52, 0xc9, 0x9b, 0x4d, 0x35, 0x8e, 0x16, 0x76, 0x61, 0x8e, 
+  0x17, 0xa4, 0x29, 0x0a, 0xb4, 0x1c, 0x73, 0x95, 0x85, 0x04, 0x4b, 0x45, 0xa1, 0x67, 0xa1, 0x64, 
+  0xc8, 0x30, 0x53, 0x1c, 0xfd, 0x86, 0x28, 0xe8, 0x4f, 0x30, 0xdc, 0x4c, 0x4e, 0x69, 0x8a, 0x13, 
+  0xce, 0x9d, 0x1d, 0x54, 0xa6, 0x4e, 0x29, 0x57, 0x40, 0xc5, 0x3c, 0x21, 0x43, 0x0a, 0xa7, 0x44, 
+  0xba, 0x2f, 0xa0, 0x2a, 0xcd, 0x66, 0x54, 0x3a, 0x97, 0xd7, 0xc8, 0xb5, 0xcd, 0xbc, 0x74, 0x09, 
+  0x64, 0x12, 0xe0, 0xdc, 0x25, 0xa9, 0xa0, 0x88, 0x12, 0xcc, 0x88, 0x9a, 0x64, 0x2d, 0xfa, 0xfe, 
+  0x79, 0xd7, 0x52, 0xfa, 0x9d, 0x96, 0x52, 0x6f, 0x3c, 0x98, 0x4b, 0xc1, 0x13, 0xe2, 0x2c, 0x63, 
+  0x09, 0x8c, 0x00, 0xb6, 0x61, 0xde, 0x3f, 0xa0, 0x07, 0xf9, 0xa9, 0xeb, 0x89, 0x85, 0x8c, 0x7a, 
+  0xa7, 0x21, 0x26, 0x31, 0xe1, 0x99, 0x6b, 0x4e, 0x78, 0x3c, 0x4c, 0x83, 0x42, 0x81, 0x53, 0x0f, 
+  0x34, 0x9e, 0x74, 0x26, 0x7f, 0x2f, 0x47, 0x7c, 0x2c, 0x27, 0x19, 0x0d, 0x16, 0x98, 0x66, 0x0a, 
+  0xd4, 0x64, 0x70, 0xc9, 0x67, 0x60, 0x2a, 0x81, 0xe3, 0x02, 0xcd, 0x0a, 0x95, 0x00, 0x82, 0x27, 
+  0x14, 0xd4, 0x30, 0x37, 0x6d, 0x4a, 0x41, 0x02, 0x83, 0x7f, 0x1b, 0x52, 0x9f, 0xc8, 0xa8, 0x33, 
+  0x3b, 0x93, 0x3c, 0xe4, 0x8e, 0x8c, 0x43, 0x3d, 0xa3, 0x19, 0x7c, 0x42, 0x1f, 0x7c, 0x46, 0x90, 
+  0xb1, 0x6e, 0x34, 0x36, 0x71, 0xc6, 0x2a, 0xc7, 0x22, 0x60, 0x13, 0x0e, 0xc7, 0x90, 0x33, 0x09, 
+  0x65, 0x92, 0xd1, 0x51, 0xcb, 0xac, 0xe9, 0x5d, 0x17, 0xe9, 0xfc, 0xaa, 0xf6, 0xc3, 0xa5, 0x86, 
+  0x6b, 0x68, 0x0b, 0xb7, 0xf4, 0xea, 0x5e, 0xfb, 0xc7, 0xf7, 0xb7, 0x76, 0xbf, 0x09, 0x9b, 0xbb, 
+  0xff, 0x00, 0x40, 0x4a, 0x3c, 0xd7, 0xe3, 0x08, 0x00, 0x00, 0x00 };
@@ -1,55 +1,62 @@
-static const char CONTENT_WIFI_SIGNAL_5_SVG[] PROGMEM = 
-  "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
-  "<svg\n"
-  "   xmlns:dc=\"http://purl.org/dc/elements/1.1/\"\n"
-  "   xmlns:cc=\"http://creativecommons.org/ns#\"\n"
-  "   xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"\n"
-  "   xmlns:svg=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns=\"http://www.w3.org/2000/svg\"\n"
-  "   xmlns:sodipodi=\"http://sodipodi.sourceforge.net/DTD/sodipodi-0.dtd\"\n"
-  "   xmlns:inkscape=\"http://www.inkscape.org/namespaces/inkscape\"\n"
-  "   width=\"24\"\n"
-  "   height=\"24\"\n"
-  "   viewBox=\"0 0 24 24\"\n"
-  "   version=\"1.1\"\n"
-  "   id=\"svg865\"\n"
-  "   sodipodi:docname=\"wifi_signal_5.svg\"\n"
-  "   inkscape:version=\"0.92.3 (2405546, 2018-03-11)\">\n"
-  "  <metadata\n"
-  "     id=\"metadata871\">\n"
-  "    <rdf:RDF>\n"
-  "      <cc:Work\n"
-  "         rdf:about=\"\">\n"
-  "        <dc:format>image/svg+xml</dc:format>\n"
-  "        <dc:type\n"
-  "           rdf:resource=\"http://purl.org/dc/dcmitype/StillImage\" />\n"
-  "        <dc:title></dc:title>\n"
-  "      </cc:Work>\n"
-  "    </rdf:RDF>\n"
-  "  </metadata>\n"
-  "  <defs\n"
-  "     id=\"defs869\" />\n"
-  "  <sodipodi:namedview\n"
-  "     pagecolor=\"#ffffff\"\n"
-  "     bordercolor=\"#666666\"\n"
-  "     borderopacity=\"1\"\n"
-  "     objecttolerance=\"10\"\n"
-  "     gridtolerance=\"10\"\n"
-  "     guidetolerance=\"10\"\n"
-  "     inkscape:pageopacity=\"0\"\n"
-  "     inkscape:pageshadow=\"2\"\n"
-  "     inkscape:window-width=\"2560\"\n"
-  "     inkscape:window-height=\"1320\"\n"
-  "     id=\"namedview867\"\n"
-  "     showgrid=\"false\"\n"
-  "     inkscape:zoom=\"47.458333\"\n"
-  "     inkscape:cx=\"12\"\n"
-  "     inkscape:cy=\"12\"\n"
-  "     inkscape:window-x=\"2560\"\n"
-  "     inkscape:window-y=\"27\"\n"
-  "     inkscape:window-maximized=\"1\"\n"
-  "     inkscape:current-layer=\"svg865\" />\n"
-  "  <path\n"
-  "     d=\"M4.504 13.572l-1.505-1.489c2.201-2.805 5.413-4.583 9.001-4.583s6.8 1.779 9 4.583l-1.504 1.489c-1.835-2.338-4.512-3.822-7.496-3.822s-5.661 1.484-7.496 3.822zm7.496.678c1.791 0 3.397.891 4.498 2.293l1.502-1.488c-1.467-1.869-3.608-3.055-6-3.055s-4.533 1.186-6 3.055l1.502 1.488c1.101-1.402 2.707-2.293 4.498-2.293zm0 2.25c-1.196 0-2.258.602-2.99 1.536l2.99 2.964 2.99-2.963c-.732-.935-1.794-1.537-2.99-1.537zm0-11.25c4.179 0 7.927 2.078 10.495 5.351l1.505-1.491c-2.935-3.739-7.217-6.11-12-6.11s-9.065 2.371-12 6.11l1.505 1.491c2.568-3.273 6.316-5.351 10.495-5.351z\"\n"
-  "     id=\"path863\" />\n"
-  "</svg>\n";
+static const char CONTENT_WIFI_SIGNAL_5_SVG[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8d, 0x54, 0xcb, 0x6e, 0xe3, 0x36, 
+  0x14, 0xdd, 0xcf, 0x57, 0x10, 0x9a, 0x4d, 0x8b, 0x96, 0x14, 0x1f, 0x12, 0x45, 0x1a, 0x96, 0x07, 
+  0x28, 0x82, 0x01, 0xba, 0xe8, 0xa6, 0x9d, 0xa2, 0xcb, 0x81, 0x42, 0xd1, 0xb6, 0x3a, 0x92, 0x68, 
+  0x88, 0x4a, 0x9c, 0xe4, 0xeb, 0x7b, 0x49, 0x5a, 0x72, 0x92, 0x7a, 0x8a, 0x0a, 0xb0, 0xcc, 0xfb, 
+  0x3a, 0xe7, 0xbe, 0xc4, 0xed, 0xa7, 0xa7, 0xa1, 0x47, 0x8f, 0x76, 0xf2, 0x9d, 0x1b, 0xeb, 0x8c, 
+  0x11, 0x9a, 0x21, 0x3b, 0x1a, 0xd7, 0x76, 0xe3, 0xa1, 0xce, 0xfe, 0xfc, 0xf2, 0x19, 0xab, 0x0c, 
+  0xf9, 0xb9, 0x19, 0xdb, 0xa6, 0x77, 0xa3, 0xad, 0xb3, 0xd1, 0x65, 0x9f, 0x76, 0x1f, 0xb6, 0xfe, 
+  0xf1, 0xf0, 0x01, 0x21, 0x04, 0xc1, 0xa3, 0xdf, 0xb4, 0xa6, 0xce, 0x8e, 0xf3, 0x7c, 0xda, 0xe4, 
+  0xf9, 0xe9, 0x61, 0xea, 0x89, 0x9b, 0x0e, 0x79, 0x6b, 0x72, 0xdb, 0xdb, 0xc1, 0x8e, 0xb3, 0xcf, 
+  0x19, 0x61, 0x79, 0x76, 0x75, 0x37, 0x57, 0x77, 0x33, 0xd9, 0x66, 0xee, 0x1e, 0xad, 0x71, 0xc3, 
+  0xe0, 0x46, 0x1f, 0x23, 0x47, 0xff, 0xf1, 0x95, 0xf3, 0xd4, 0xee, 0x57, 0xef, 0xf3, 0xf9, 0x4c, 
+  0xce, 0x22, 0x3a, 0x31, 0xad, 0x75, 0x4e, 0x79, 0xce, 0x39, 0x06, 0x0f, 0xec, 0x9f, 0xc7, 0xb9, 
+  0x79, 0xc2, 0x6f, 0x43, 0x21, 0xc7, 0x5b, 0xa1, 0x9c, 0x52, 0x9a, 0x83, 0xed, 0xea, 0xf9, 0xff, 
+  0xbc, 0x36, 0x1e, 0xba, 0x72, 0x82, 0xdf, 0xea, 0xbe, 0x28, 0x88, 0x77, 0x0f, 0x93, 0xb1, 0x7b, 
+  0x88, 0xb3, 0x64, 0xb4, 0x73, 0x7e, 0xf7, 0xe5, 0x6e, 0x35, 0x62, 0x4a, 0xda, 0xb9, 0x7d, 0x05, 
+  0xd3, 0x8d, 0xdf, 0xbc, 0x69, 0x4e, 0xf6, 0x0d, 0xeb, 0xa2, 0x4c, 0x1d, 0x68, 0x06, 0xeb, 0x4f, 
+  0x8d, 0xb1, 0x3e, 0x5f, 0xf4, 0x31, 0xfe, 0xdc, 0xb5, 0xf3, 0xb1, 0xce, 0x78, 0x11, 0xa5, 0xa3, 
+  0xed, 0x0e, 0xc7, 0x79, 0x15, 0x1f, 0x3b, 0x7b, 0xfe, 0xc5, 0x3d, 0xd5, 0x19, 0x45, 0x14, 0xf1, 
+  0x02, 0x2d, 0xea, 0xeb, 0x68, 0x59, 0x54, 0x74, 0x6d, 0x9d, 0x41, 0x5d, 0x4a, 0x96, 0x51, 0x5c, 
+  0xd2, 0xdc, 0xb4, 0xce, 0x04, 0xde, 0x3a, 0x3b, 0x77, 0xfb, 0xee, 0xab, 0xef, 0x0e, 0x63, 0xd3, 
+  0x7f, 0x2d, 0xc9, 0xd2, 0x82, 0x25, 0x91, 0xcd, 0x0a, 0x48, 0x89, 0xe6, 0x44, 0xa0, 0x1f, 0x78, 
+  0x41, 0xcb, 0xb2, 0x90, 0x3f, 0x23, 0x4e, 0x99, 0xc2, 0x54, 0x60, 0xc6, 0x7e, 0xcc, 0x76, 0x10, 
+  0xb3, 0x1d, 0xec, 0xdc, 0xb4, 0xcd, 0xdc, 0x84, 0xf8, 0x44, 0xbc, 0x68, 0x54, 0xc5, 0xa2, 0x0b, 
+  0x38, 0xc1, 0xf8, 0x36, 0xbf, 0xdf, 0x7d, 0x4e, 0x12, 0xc8, 0xc6, 0x6c, 0xfe, 0x72, 0xd3, 0xb7, 
+  0x8b, 0x08, 0x4f, 0x70, 0x68, 0xee, 0xdd, 0x03, 0x94, 0x9a, 0xed, 0x56, 0xf5, 0xb6, 0x35, 0x1b, 
+  0x68, 0xf8, 0xd0, 0xcc, 0xbb, 0x6e, 0x68, 0x0e, 0x36, 0xcc, 0xea, 0x27, 0x68, 0xf0, 0x36, 0xbf, 
+  0x1a, 0xde, 0x38, 0xcf, 0xcf, 0x27, 0x7b, 0x05, 0x4d, 0xb0, 0x93, 0x4d, 0x93, 0xbb, 0xb9, 0xbe, 
+  0xad, 0x19, 0xba, 0x10, 0x94, 0xff, 0x31, 0x77, 0x7d, 0xff, 0x6b, 0x20, 0xc9, 0x50, 0xfe, 0x0e, 
+  0xb4, 0x9b, 0x7b, 0xbb, 0x8b, 0x9c, 0xe9, 0xb8, 0x54, 0x91, 0x5f, 0xca, 0xb8, 0x14, 0x99, 0xbf, 
+  0xaa, 0x72, 0x9b, 0x2f, 0x5d, 0x88, 0x52, 0x6b, 0xf7, 0xfe, 0xda, 0xa0, 0x20, 0x29, 0xa9, 0x2f, 
+  0x44, 0xdb, 0x75, 0x3a, 0x61, 0x34, 0x6d, 0x18, 0x71, 0x72, 0x3d, 0x41, 0x32, 0xc6, 0xf5, 0x6e, 
+  0xaa, 0xb3, 0x8f, 0xfb, 0xf8, 0x64, 0xc9, 0x70, 0xef, 0xa6, 0xd6, 0x4e, 0x8b, 0x49, 0xc6, 0xe7, 
+  0x8d, 0xc9, 0xc1, 0x5e, 0x41, 0x59, 0xb0, 0x0f, 0x17, 0xb5, 0xbb, 0xff, 0xdb, 0x9a, 0x79, 0x76, 
+  0xbd, 0x9d, 0x9a, 0x31, 0xb4, 0x82, 0xd1, 0x8b, 0xe5, 0x30, 0xc1, 0xbe, 0xdd, 0xd2, 0x3f, 0x74, 
+  0xad, 0xbd, 0x65, 0x58, 0x77, 0x24, 0xa4, 0xb7, 0x12, 0xdd, 0xb4, 0xfa, 0x63, 0xd3, 0xba, 0x33, 
+  0x2c, 0xef, 0x7b, 0xe3, 0xb9, 0x1b, 0xc1, 0x80, 0x97, 0x55, 0x2f, 0x25, 0xfd, 0x8e, 0xc7, 0xb2, 
+  0xfe, 0x4c, 0xf0, 0xd5, 0x05, 0x1a, 0xb8, 0x36, 0x4a, 0xc9, 0xea, 0xa2, 0xf6, 0x47, 0x77, 0x0e, 
+  0xb5, 0xd4, 0xd9, 0xbe, 0xe9, 0xbd, 0x7d, 0x8f, 0xf7, 0xe2, 0xdc, 0x50, 0x67, 0x45, 0x45, 0x8a, 
+  0x52, 0x09, 0x21, 0xde, 0x9b, 0x0d, 0x7c, 0x52, 0xec, 0x5f, 0x69, 0x9a, 0xe7, 0x5b, 0xda, 0x4b, 
+  0x6a, 0x4f, 0xff, 0x99, 0x38, 0x44, 0xf2, 0xea, 0x3b, 0xb6, 0xa1, 0x79, 0xea, 0x86, 0xee, 0xc5, 
+  0xb6, 0xd7, 0xf9, 0x5c, 0x29, 0x1f, 0xa6, 0x09, 0xae, 0x53, 0xdc, 0x37, 0xcf, 0x76, 0x5a, 0xbf, 
+  0xe1, 0xcb, 0xa2, 0x9c, 0x9a, 0xf9, 0x98, 0xfc, 0x21, 0xf4, 0xb7, 0x82, 0x94, 0xb4, 0x40, 0x4c, 
+  0x90, 0xb2, 0xe2, 0x3d, 0x66, 0x20, 0x95, 0xf0, 0x2e, 0x94, 0x36, 0x9c, 0xc0, 0x57, 0x8a, 0x39, 
+  0x51, 0xb4, 0x44, 0x25, 0x29, 0x98, 0xc0, 0xe0, 0xab, 0x04, 0xd2, 0x84, 0x82, 0x3e, 0x9e, 0xbd, 
+  0x24, 0x0a, 0x31, 0x52, 0x55, 0x1a, 0x69, 0x14, 0x35, 0x09, 0x02, 0x00, 0x23, 0x04, 0x08, 0x4a, 
+  0x94, 0x80, 0x21, 0x84, 0x0a, 0x11, 0x8c, 0x63, 0x41, 0x14, 0x5c, 0xc4, 0xd0, 0x41, 0x2d, 0xd3, 
+  0xd9, 0xe3, 0x92, 0x48, 0xc9, 0x62, 0x44, 0x91, 0x0c, 0x28, 0x1a, 0x5e, 0x86, 0x28, 0x10, 0x59, 
+  0x29, 0x03, 0x1c, 0x9a, 0xc1, 0x65, 0x25, 0x88, 0xd0, 0x15, 0x51, 0x70, 0x2e, 0xc0, 0xa6, 0x10, 
+  0xe4, 0xa8, 0x45, 0x1f, 0x28, 0x79, 0xcc, 0x5a, 0x05, 0xca, 0x42, 0x56, 0x81, 0x58, 0x6a, 0x20, 
+  0x90, 0x54, 0xc1, 0x1b, 0x6e, 0x1d, 0x2c, 0xd3, 0xbf, 0x0f, 0x79, 0x08, 0x01, 0x74, 0x4c, 0x49, 
+  0x1c, 0xa8, 0x40, 0x99, 0x10, 0x50, 0x42, 0x00, 0x0b, 0xd4, 0x07, 0x67, 0xd0, 0x70, 0x52, 0xd1, 
+  0x0a, 0x47, 0x96, 0xc4, 0x98, 0xce, 0x2f, 0x03, 0x0d, 0xd4, 0x65, 0x60, 0x63, 0x90, 0x2f, 0x0d, 
+  0xea, 0x52, 0x01, 0x1b, 0x87, 0x93, 0xd6, 0x80, 0x54, 0x0a, 0xd9, 0xc7, 0x23, 0xbc, 0x64, 0x11, 
+  0xde, 0x3a, 0x98, 0xa4, 0x30, 0x98, 0x54, 0x82, 0x63, 0xa2, 0x45, 0x68, 0x74, 0xa5, 0x8b, 0xd0, 
+  0x31, 0x51, 0xc5, 0xb8, 0x74, 0x04, 0x74, 0xb8, 0x18, 0x03, 0x7c, 0x41, 0x18, 0xb4, 0x96, 0xa2, 
+  0x0a, 0xee, 0xcf, 0x0a, 0x30, 0x68, 0x05, 0xed, 0xa6, 0x90, 0x47, 0x98, 0x88, 0x28, 0x59, 0xbf, 
+  0xce, 0x4b, 0x33, 0x13, 0x10, 0x00, 0x53, 0x00, 0xbc, 0x86, 0x3e, 0x72, 0x56, 0x61, 0x49, 0x18, 
+  0x54, 0xc2, 0xe3, 0xbf, 0xc7, 0x30, 0x38, 0x59, 0x02, 0x8a, 0xa8, 0x82, 0x12, 0x05, 0x65, 0x02, 
+  0x40, 0x09, 0x80, 0x93, 0x52, 0x86, 0x6e, 0xf1, 0x4a, 0x80, 0x51, 0x30, 0x89, 0x23, 0xc9, 0x85, 
+  0x31, 0x09, 0x2f, 0xaf, 0xbe, 0x9f, 0xb0, 0x48, 0x4a, 0x8a, 0xb8, 0x57, 0xdb, 0x70, 0xa9, 0xee, 
+  0x3e, 0xfc, 0x03, 0x2f, 0xb4, 0x39, 0xeb, 0x24, 0x08, 0x00, 0x00, 0x00 };
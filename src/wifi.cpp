@@ -2,6 +2,7 @@
 #include "wifi.h"
 #include "app_config.h"
 #include "lcd.h"
+#include "event.h"
 
 #include <ESP8266WiFi.h>              // Connect to Wifi
 #include <ESP8266mDNS.h>              // Resolve URL for update server etc.
@@ -98,6 +99,7 @@ startAP() {
   char tmpStr[40];
   sprintf(tmpStr, "%d.%d.%d.%d", myIP[0], myIP[1], myIP[2], myIP[3]);
   ipaddress = tmpStr;
+  state_changed();
   DEBUG.print("AP IP Address: ");
   DEBUG.println(tmpStr);
   lcd_display(F("SSID: OpenEVSE"), 0, 0, 0, LCD_CLEAR_LINE);
@@ -149,6 +151,7 @@ void wifi_onStationModeGotIP(const WiFiEventStationModeGotIP &event)
   char tmpStr[40];
   sprintf(tmpStr, "%d.%d.%d.%d", myAddress[0], myAddress[1], myAddress[2], myAddress[3]);
   ipaddress = tmpStr;
+  state_changed();
   DEBUG.print("Connected, IP: ");
   DEBUG.println(tmpStr);
   lcd_display(F("IP Address"), 0, 0, 0, LCD_CLEAR_LINE);
@@ -325,6 +328,7 @@ wifi_loop()
   // Remain in AP mode for 5 Minutes before resetting
   if(isApOnly && 0 == apClients && client_retry && millis() > client_retry_time) {
     DEBUG.println("client re-try, resetting");
+    config_flush();
     delay(50);
     ESP.reset();
   }
@@ -0,0 +1,191 @@
+#ifndef _FAKE_ARDUINO_H
+#define _FAKE_ARDUINO_H
+
+// -------------------------------------------------------------------
+// Minimal stand in for the Arduino core so modules can be built on the
+// host by the native environment. Only what the tested modules use is
+// provided.
+// -------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <functional>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// -------------------------------------------------------------------
+// PROGMEM, flash is just normal memory on the host
+// -------------------------------------------------------------------
+class __FlashStringHelper;
+
+#define PROGMEM
+#define PGM_P               const char *
+#define PSTR(s)             (s)
+#define F(s)                (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+#define FPSTR(p)            (reinterpret_cast<const __FlashStringHelper *>(p))
+
+#define pgm_read_byte(addr)   (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr)   (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr)  (*reinterpret_cast<const uint32_t *>(addr))
+#define pgm_read_ptr(addr)    (*(const void * const *)(addr))
+
+#define memcpy_P    memcpy
+#define strcpy_P    strcpy
+#define strncpy_P   strncpy
+#define strcmp_P    strcmp
+#define strncmp_P   strncmp
+#define strlen_P    strlen
+
+// -------------------------------------------------------------------
+// Time, driven by the tests with fake_millis_advance()
+// -------------------------------------------------------------------
+inline uint32_t &fake_millis_now() {
+  static uint32_t now = 0;
+  return now;
+}
+
+inline unsigned long millis() {
+  return fake_millis_now();
+}
+
+inline unsigned long micros() {
+  return fake_millis_now() * 1000;
+}
+
+inline void fake_millis_advance(uint32_t ms) {
+  fake_millis_now() += ms;
+}
+
+inline void yield() {
+}
+
+inline void delay(unsigned long ms) {
+  fake_millis_advance(ms);
+}
+
+// -------------------------------------------------------------------
+// String
+// -------------------------------------------------------------------
+class String
+{
+  private:
+    std::string _str;
+
+  public:
+    String() {}
+    String(const char *str) : _str(str ? str : "") {}
+    String(const __FlashStringHelper *str) : _str(str ? reinterpret_cast<const char *>(str) : "") {}
+    String(const std::string &str) : _str(str) {}
+    explicit String(char c) : _str(1, c) {}
+    explicit String(int value) : _str(std::to_string(value)) {}
+    explicit String(unsigned int value) : _str(std::to_string(value)) {}
+    explicit String(long value) : _str(std::to_string(value)) {}
+    explicit String(unsigned long value) : _str(std::to_string(value)) {}
+
+    const char *c_str() const {
+      return _str.c_str();
+    }
+    unsigned int length() const {
+      return _str.length();
+    }
+    bool reserve(unsigned int size) {
+      _str.reserve(size);
+      return true;
+    }
+
+    bool concat(const char *str) {
+      _str += str;
+      return true;
+    }
+    bool concat(const String &str) {
+      _str += str._str;
+      return true;
+    }
+    bool concat(char c) {
+      _str += c;
+      return true;
+    }
+
+    String &operator += (const char *str) {
+      concat(str);
+      return *this;
+    }
+    String &operator += (const String &str) {
+      concat(str);
+      return *this;
+    }
+    String &operator += (char c) {
+      concat(c);
+      return *this;
+    }
+
+    bool equals(const char *str) const {
+      return _str == str;
+    }
+    bool operator == (const String &str) const {
+      return _str == str._str;
+    }
+    bool operator == (const char *str) const {
+      return _str == str;
+    }
+    bool operator != (const String &str) const {
+      return _str != str._str;
+    }
+    bool operator != (const char *str) const {
+      return _str != str;
+    }
+
+    char operator [] (unsigned int index) const {
+      return index < _str.length() ? _str[index] : '\0';
+    }
+    char charAt(unsigned int index) const {
+      return (*this)[index];
+    }
+
+    bool startsWith(const String &prefix) const {
+      return 0 == _str.compare(0, prefix._str.length(), prefix._str);
+    }
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t pos = _str.find(c, from);
+      return std::string::npos == pos ? -1 : (int)pos;
+    }
+    String substring(unsigned int from) const {
+      return from < _str.length() ? String(_str.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const {
+      return from < to && from < _str.length() ? String(_str.substr(from, to - from)) : String();
+    }
+
+    long toInt() const {
+      return atol(_str.c_str());
+    }
+    float toFloat() const {
+      return atof(_str.c_str());
+    }
+};
+
+// Result of concatenation, a separate type as in the Arduino core
+class StringSumHelper : public String
+{
+  public:
+    StringSumHelper(const String &str) : String(str) {}
+};
+
+inline String operator + (const String &lhs, const String &rhs) {
+  String ret(lhs);
+  ret += rhs;
+  return ret;
+}
+
+inline String operator + (const String &lhs, const char *rhs) {
+  String ret(lhs);
+  ret += rhs;
+  return ret;
+}
+
+#endif // _FAKE_ARDUINO_H
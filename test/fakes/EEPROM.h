@@ -0,0 +1,65 @@
+#ifndef _FAKE_EEPROM_H
+#define _FAKE_EEPROM_H
+
+// -------------------------------------------------------------------
+// Stand in for the ESP8266 EEPROM emulation, backed by a RAM buffer
+// that keeps its contents between begin()/end() like the flash would
+// -------------------------------------------------------------------
+
+#include <Arduino.h>
+
+#ifndef FAKE_EEPROM_SIZE
+#define FAKE_EEPROM_SIZE 4096
+#endif
+
+class EEPROMClass
+{
+  private:
+    uint8_t _data[FAKE_EEPROM_SIZE];
+    size_t _size;
+
+  public:
+    EEPROMClass() : _size(0) {
+      memset(_data, 0xff, sizeof(_data));
+    }
+
+    void begin(size_t size) {
+      _size = size < sizeof(_data) ? size : sizeof(_data);
+    }
+
+    uint8_t read(int address) {
+      return address >= 0 && (size_t)address < _size ? _data[address] : 0;
+    }
+
+    void write(int address, uint8_t value) {
+      if(address >= 0 && (size_t)address < _size) {
+        _data[address] = value;
+      }
+    }
+
+    bool commit() {
+      return _size > 0;
+    }
+
+    void end() {
+      _size = 0;
+    }
+
+    size_t length() {
+      return _size;
+    }
+
+    // Wipe back to erased flash
+    void fake_erase() {
+      memset(_data, 0xff, sizeof(_data));
+    }
+};
+
+inline EEPROMClass &fake_eeprom() {
+  static EEPROMClass eeprom;
+  return eeprom;
+}
+
+#define EEPROM fake_eeprom()
+
+#endif // _FAKE_EEPROM_H
@@ -0,0 +1,6 @@
+#ifndef _FAKE_ESP_ASYNC_TCP_H
+#define _FAKE_ESP_ASYNC_TCP_H
+
+// Included by web_server_auth.h, nothing is used on the host
+
+#endif // _FAKE_ESP_ASYNC_TCP_H
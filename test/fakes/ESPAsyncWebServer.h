@@ -0,0 +1,12 @@
+#ifndef _FAKE_ESP_ASYNC_WEB_SERVER_H
+#define _FAKE_ESP_ASYNC_WEB_SERVER_H
+
+// Only the types are needed by the modules built on the host, the web
+// server itself is not
+
+#include <Arduino.h>
+
+class AsyncWebServerRequest;
+class AsyncWebServerResponse;
+
+#endif // _FAKE_ESP_ASYNC_WEB_SERVER_H
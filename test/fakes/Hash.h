@@ -0,0 +1,6 @@
+#ifndef _FAKE_HASH_H
+#define _FAKE_HASH_H
+
+// Included by web_server_auth.h, nothing is used on the host
+
+#endif // _FAKE_HASH_H
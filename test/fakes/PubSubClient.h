@@ -0,0 +1,98 @@
+#ifndef _FAKE_PUB_SUB_CLIENT_H
+#define _FAKE_PUB_SUB_CLIENT_H
+
+// -------------------------------------------------------------------
+// Stand in for the PubSubClient MQTT client. connect() succeeds if the
+// test has set fake_broker_up, publishes and subscriptions are recorded
+// and messages can be delivered with fake_receive().
+// -------------------------------------------------------------------
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <functional>
+#include <vector>
+
+#define MQTT_CONNECTION_TIMEOUT     -4
+#define MQTT_CONNECTION_LOST        -3
+#define MQTT_CONNECT_FAILED         -2
+#define MQTT_DISCONNECTED           -1
+#define MQTT_CONNECTED               0
+
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char *, uint8_t *, unsigned int)> callback
+
+class PubSubClient
+{
+  private:
+    MQTT_CALLBACK_SIGNATURE;
+    bool _connected;
+
+  public:
+    bool fake_broker_up;
+    uint32_t fake_connects;
+    std::vector<String> published;
+    std::vector<String> subscribed;
+
+    PubSubClient(WiFiClient &client) :
+      callback(nullptr), _connected(false), fake_broker_up(false), fake_connects(0) {
+    }
+
+    PubSubClient &setServer(const char *domain, uint16_t port) {
+      return *this;
+    }
+
+    PubSubClient &setCallback(MQTT_CALLBACK_SIGNATURE) {
+      this->callback = callback;
+      return *this;
+    }
+
+    bool connect(const char *id, const char *user, const char *pass, const char *willTopic, uint8_t willQos, bool willRetain, const char *willMessage)
+    {
+      fake_connects++;
+      _connected = fake_broker_up;
+      return _connected;
+    }
+
+    void disconnect() {
+      _connected = false;
+    }
+
+    bool connected() {
+      return _connected;
+    }
+
+    int state() {
+      return _connected ? MQTT_CONNECTED : MQTT_DISCONNECTED;
+    }
+
+    bool publish(const char *topic, const char *payload)
+    {
+      if(false == _connected) {
+        return false;
+      }
+      published.push_back(String(topic) + " " + payload);
+      return true;
+    }
+
+    bool subscribe(const char *topic)
+    {
+      if(false == _connected) {
+        return false;
+      }
+      subscribed.push_back(String(topic));
+      return true;
+    }
+
+    bool loop() {
+      return _connected;
+    }
+
+    // Deliver a message to the subscriber callback
+    void fake_receive(const char *topic, const char *payload)
+    {
+      if(callback) {
+        callback(const_cast<char *>(topic), (uint8_t *)payload, strlen(payload));
+      }
+    }
+};
+
+#endif // _FAKE_PUB_SUB_CLIENT_H
@@ -0,0 +1,132 @@
+#ifndef _FAKE_RAPI_SENDER_H
+#define _FAKE_RAPI_SENDER_H
+
+// -------------------------------------------------------------------
+// Stand in for the OpenEVSE library RapiSender. Commands are recorded
+// rather than written to a serial port and are completed by the test
+// calling fake_complete(), which runs the callbacks in the order the
+// commands were sent as the OpenEVSE would.
+// -------------------------------------------------------------------
+
+#include <Arduino.h>
+#include <functional>
+#include <deque>
+#include <vector>
+
+#define RAPI_RESPONSE_QUEUE_FULL          -7
+#define RAPI_RESPONSE_BUFFER_OVERFLOW     -6
+#define RAPI_RESPONSE_BAD_SEQUENCE_ID     -5
+#define RAPI_RESPONSE_BAD_CHECKSUM        -4
+#define RAPI_RESPONSE_INVALID_RESPONSE    -3
+#define RAPI_RESPONSE_TIMEOUT             -2
+#define RAPI_RESPONSE_NK                  -1
+#define RAPI_RESPONSE_OK                   0
+#define RAPI_RESPONSE_ASYNC_EVENT          1
+#define RAPI_RESPONSE_CMD_TOO_LONG         2
+
+#define RAPI_MAX_TOKENS                   20
+
+typedef std::function<void(int ret)> RapiCommandCompleteHandler;
+
+class RapiSender
+{
+  private:
+    struct Pending {
+      String cmd;
+      RapiCommandCompleteHandler callback;
+    };
+
+    std::deque<Pending> _pending;
+    std::vector<String> _tokens;
+    String _response;
+    size_t _maxPending;
+
+  public:
+    // Every command sent, oldest first
+    std::vector<String> sent;
+
+    RapiSender(void *stream = NULL) : _maxPending(SIZE_MAX) {
+    }
+
+    int sendCmd(const char *cmd, RapiCommandCompleteHandler callback, unsigned long timeout = 0)
+    {
+      if(_pending.size() >= _maxPending) {
+        return RAPI_RESPONSE_QUEUE_FULL;
+      }
+      Pending pending = { String(cmd), callback };
+      _pending.push_back(pending);
+      sent.push_back(String(cmd));
+      return RAPI_RESPONSE_OK;
+    }
+
+    void loop() {
+    }
+
+    bool isConnected() {
+      return true;
+    }
+
+    int getTokenCnt() {
+      return _tokens.size();
+    }
+    const char *getToken(int index) {
+      return index < (int)_tokens.size() ? _tokens[index].c_str() : "";
+    }
+    const char *getResponse() {
+      return _response.c_str();
+    }
+
+    // -------------------------------------------------------------------
+    // Test controls
+    // -------------------------------------------------------------------
+
+    // Limit the commands accepted before sendCmd() reports the queue full
+    void fake_set_max_pending(size_t max) {
+      _maxPending = max;
+    }
+
+    size_t fake_pending() {
+      return _pending.size();
+    }
+
+    // Complete the oldest command, response is the full response line
+    // eg. "$OK 3 0"
+    bool fake_complete(int ret, const char *response = "$OK")
+    {
+      if(_pending.empty()) {
+        return false;
+      }
+
+      Pending pending = _pending.front();
+      _pending.pop_front();
+
+      _response = response;
+      _tokens.clear();
+      const char *start = response;
+      while(*start)
+      {
+        const char *end = strchr(start, ' ');
+        if(NULL == end) {
+          end = start + strlen(start);
+        }
+        _tokens.push_back(String(std::string(start, end - start)));
+        start = *end ? end + 1 : end;
+      }
+
+      if(pending.callback) {
+        pending.callback(ret);
+      }
+      return true;
+    }
+
+    void fake_reset()
+    {
+      _pending.clear();
+      _tokens.clear();
+      _response = "";
+      _maxPending = SIZE_MAX;
+      sent.clear();
+    }
+};
+
+#endif // _FAKE_RAPI_SENDER_H
@@ -0,0 +1,8 @@
+#ifndef _FAKE_WSTRING_H
+#define _FAKE_WSTRING_H
+
+// ArduinoJson includes this for its String support
+
+#include <Arduino.h>
+
+#endif // _FAKE_WSTRING_H
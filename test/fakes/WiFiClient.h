@@ -0,0 +1,21 @@
+#ifndef _FAKE_WIFI_CLIENT_H
+#define _FAKE_WIFI_CLIENT_H
+
+// Network clients are never connected on the host
+
+#include <Arduino.h>
+
+class WiFiClient
+{
+  public:
+    int connect(const char *host, uint16_t port) {
+      return 0;
+    }
+    uint8_t connected() {
+      return 0;
+    }
+    void stop() {
+    }
+};
+
+#endif // _FAKE_WIFI_CLIENT_H
@@ -0,0 +1,6 @@
+#ifndef _FAKE_CORE_VERSION_H
+#define _FAKE_CORE_VERSION_H
+
+// Host builds are not any release of the ESP8266 core
+
+#endif // _FAKE_CORE_VERSION_H
@@ -0,0 +1,30 @@
+#ifndef _FAKE_ESPAL_H
+#define _FAKE_ESPAL_H
+
+// Stand in for the ESPAL hardware abstraction
+
+#include <Arduino.h>
+
+class EspalClass
+{
+  public:
+    void begin() {
+    }
+
+    String getShortId() {
+      return String("0a1b2c");
+    }
+
+    uint32_t getFreeHeap() {
+      return 40 * 1024;
+    }
+};
+
+inline EspalClass &fake_espal() {
+  static EspalClass espal;
+  return espal;
+}
+
+#define ESPAL fake_espal()
+
+#endif // _FAKE_ESPAL_H
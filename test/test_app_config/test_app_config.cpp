@@ -0,0 +1,158 @@
+// Host tests for the config change notifications
+//
+// Built in the native_config environment with app_config.cpp and the
+// config parser, the modules they notify are replaced below.
+
+#include <unity.h>
+
+#include "app_config.h"
+#include "app_config_parser.h"
+#include "app_config_store.h"
+
+// -------------------------------------------------------------------
+// Stand ins for the subscribers and the flash store
+// -------------------------------------------------------------------
+static int mqtt_restarts = 0;
+static int divert_updates = 0;
+static int session_clears = 0;
+
+void mqtt_restart() {
+  mqtt_restarts++;
+}
+
+boolean mqtt_connected() {
+  return config_mqtt_enabled();
+}
+
+boolean emoncms_connected = false;
+boolean emoncms_updated = false;
+
+void divertmode_update(byte mode) {
+  divert_updates++;
+}
+
+void web_session_clear() {
+  session_clears++;
+}
+
+uint32_t state_generation = 0;
+
+static int store_saves = 0;
+
+bool config_store_load() {
+  return false;
+}
+
+int config_store_save() {
+  store_saves++;
+  return CONFIG_STORE_WRITTEN;
+}
+
+bool config_store_valid() {
+  return true;
+}
+
+void config_store_erase() {
+}
+
+void config_load_v1_settings() {
+}
+
+// -------------------------------------------------------------------
+// Tests
+// -------------------------------------------------------------------
+
+void setUp()
+{
+  config_load_settings();
+  config_flush();
+  mqtt_restarts = 0;
+  divert_updates = 0;
+  session_clears = 0;
+  store_saves = 0;
+}
+
+void tearDown()
+{
+}
+
+static void save_mqtt(const char *server)
+{
+  config_save_mqtt(true, server, 1883, "openevse", "user", "pass", "solar", "grid_ie");
+}
+
+static void test_save_mqtt_restarts_once()
+{
+  save_mqtt("broker");
+  TEST_ASSERT_EQUAL(1, mqtt_restarts);
+
+  // The deferred write does not notify again
+  fake_millis_advance(60 * 1000);
+  config_loop();
+  TEST_ASSERT_EQUAL(1, mqtt_restarts);
+  TEST_ASSERT_EQUAL(1, store_saves);
+}
+
+static void test_unchanged_save_does_not_restart()
+{
+  save_mqtt("broker");
+  mqtt_restarts = 0;
+
+  save_mqtt("broker");
+  TEST_ASSERT_EQUAL(0, mqtt_restarts);
+}
+
+static void test_each_commit_restarts_once()
+{
+  save_mqtt("broker");
+  save_mqtt("broker2");
+  TEST_ASSERT_EQUAL(2, mqtt_restarts);
+}
+
+static void test_set_without_commit_does_not_restart()
+{
+  config_set("mqtt_server", String("broker3"));
+  config_set("mqtt_port", (uint32_t)1884);
+  TEST_ASSERT_EQUAL(0, mqtt_restarts);
+
+  config_commit();
+  TEST_ASSERT_EQUAL(1, mqtt_restarts);
+}
+
+static void test_staged_post_restarts_once()
+{
+  const char *body = "{\"mqtt_server\":\"broker4\",\"mqtt_port\":1885,\"mqtt_user\":\"admin\",\"divert_enabled\":true}";
+  size_t len = strlen(body);
+
+  ConfigParser *parser = ConfigParser::create(len);
+  TEST_ASSERT_TRUE(parser->parse((const uint8_t *)body, len));
+  TEST_ASSERT_EQUAL(CONFIG_PARSER_OK, parser->end());
+  TEST_ASSERT_EQUAL(0, mqtt_restarts);
+
+  parser->apply();
+  config_commit();
+  free(parser);
+
+  TEST_ASSERT_EQUAL(1, mqtt_restarts);
+  TEST_ASSERT_EQUAL(1, divert_updates);
+  TEST_ASSERT_EQUAL(0, session_clears);
+}
+
+static void test_other_options_do_not_restart()
+{
+  config_save_admin("admin", "secret");
+  TEST_ASSERT_EQUAL(0, mqtt_restarts);
+  TEST_ASSERT_EQUAL(1, session_clears);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_save_mqtt_restarts_once);
+  RUN_TEST(test_unchanged_save_does_not_restart);
+  RUN_TEST(test_each_commit_restarts_once);
+  RUN_TEST(test_set_without_commit_does_not_restart);
+  RUN_TEST(test_staged_post_restarts_once);
+  RUN_TEST(test_other_options_do_not_restart);
+  return UNITY_END();
+}
@@ -0,0 +1,165 @@
+// Host benchmarks for the control paths that run on every update
+//
+// Prints the time per operation and the heap allocations per operation,
+// compare with baseline.txt to spot regressions. The times are only
+// meaningful relative to other runs on the same machine, the allocation
+// counts should match on any host.
+
+#include <unity.h>
+#include <chrono>
+#include <new>
+
+#include "divert_calc.h"
+#include "rapi_queue.h"
+
+RapiSender rapiSender;
+
+#ifndef BENCHMARK_ITERATIONS
+#define BENCHMARK_ITERATIONS 100000
+#endif
+
+// -------------------------------------------------------------------
+// Count every allocation made through operator new
+// -------------------------------------------------------------------
+static size_t allocations = 0;
+
+void *operator new(size_t size)
+{
+  allocations++;
+  void *ptr = malloc(size ? size : 1);
+  if(NULL == ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete(void *ptr, size_t size) noexcept
+{
+  free(ptr);
+}
+
+struct BenchmarkResult
+{
+  double ns_per_op;
+  double allocs_per_op;
+};
+
+template <typename F>
+static BenchmarkResult benchmark(const char *name, F op)
+{
+  // Warm up, lets any one off allocations happen
+  for(int i = 0; i < 100; i++) {
+    op(i);
+  }
+
+  size_t start_allocations = allocations;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+    op(i);
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  BenchmarkResult result;
+  result.ns_per_op = std::chrono::duration<double, std::nano>(end - start).count() / BENCHMARK_ITERATIONS;
+  result.allocs_per_op = (double)(allocations - start_allocations) / BENCHMARK_ITERATIONS;
+
+  printf("%-24s %10.1f ns/op %8.2f allocs/op\n", name, result.ns_per_op, result.allocs_per_op);
+  return result;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+static void benchmark_divert_calculate()
+{
+  DivertCalcInput in;
+  DivertCalcState state = { 0, 0 };
+  DivertCalcResult result;
+
+  in.feed = DIVERT_FEED_SOLAR;
+  in.grid_ie = 0;
+  in.voltage = 240;
+  in.ev_amps = 0;
+  in.attack_smoothing_factor = 0.4;
+  in.decay_smoothing_factor = 0.05;
+  in.min_charge_current = 6;
+  in.max_charge_current = 32;
+  in.current_charge_rate = 6;
+  in.sleeping = true;
+  in.divert_active = false;
+  in.min_charge_time_elapsed = true;
+
+  BenchmarkResult bench = benchmark("divert_calculate", [&](int i)
+  {
+    // Ramp the solar up and down so every branch is taken
+    in.solar = (i % 80) * 100;
+    divert_calculate(in, state, result);
+    if(result.set_rate) {
+      in.current_charge_rate = result.charge_rate;
+    }
+    if(result.start) {
+      in.sleeping = false;
+      in.divert_active = true;
+    }
+    if(result.stop) {
+      in.sleeping = true;
+      in.divert_active = false;
+    }
+  });
+
+  // Runs on every solar/grid update, must not touch the heap
+  TEST_ASSERT_EQUAL(0, bench.allocs_per_op);
+}
+
+static void benchmark_rapi_queue_round_trip()
+{
+  int completed = 0;
+  benchmark("rapi_queue round trip", [&](int i)
+  {
+    rapi_queue_send("$GS", RAPI_PRIORITY_POLL, [&completed](int ret) {
+      completed++;
+    });
+    rapi_queue_loop();
+    rapiSender.fake_complete(RAPI_RESPONSE_OK, "$OK 1 0");
+  });
+
+  TEST_ASSERT_EQUAL(BENCHMARK_ITERATIONS + 100, completed);
+  TEST_ASSERT_EQUAL(0, rapi_queue_length());
+}
+
+static void benchmark_rapi_queue_batch()
+{
+  const char *cmds[] = { "$SC 10", "$FE", "$GS" };
+  size_t completed = 0;
+  benchmark("rapi_queue_batch x3", [&](int i)
+  {
+    rapi_queue_batch(cmds, 3, RAPI_PRIORITY_USER, [&completed](size_t index, int ret) {
+      completed++;
+    });
+    while(rapi_queue_length() > 0) {
+      rapi_queue_loop();
+      rapiSender.fake_complete(RAPI_RESPONSE_OK);
+    }
+  });
+
+  TEST_ASSERT_EQUAL(3 * (BENCHMARK_ITERATIONS + 100), completed);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(benchmark_divert_calculate);
+  RUN_TEST(benchmark_rapi_queue_round_trip);
+  RUN_TEST(benchmark_rapi_queue_batch);
+  return UNITY_END();
+}
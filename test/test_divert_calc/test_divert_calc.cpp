@@ -0,0 +1,210 @@
+// Host tests for the Eco mode charge rate calculation
+
+#include <unity.h>
+
+#include "divert_calc.h"
+
+static DivertCalcInput in;
+static DivertCalcState state;
+static DivertCalcResult result;
+
+void setUp()
+{
+  in.feed = DIVERT_FEED_SOLAR;
+  in.solar = 0;
+  in.grid_ie = 0;
+  in.voltage = 240;
+  in.ev_amps = 0;
+  in.attack_smoothing_factor = 0.4;
+  in.decay_smoothing_factor = 0.05;
+  in.min_charge_current = 6;
+  in.max_charge_current = 32;
+  in.current_charge_rate = 6;
+  in.sleeping = true;
+  in.divert_active = false;
+  in.min_charge_time_elapsed = false;
+
+  state.available_current = 0;
+  state.smoothed_available_current = 0;
+}
+
+void tearDown()
+{
+}
+
+static void test_solar_below_min_does_not_start()
+{
+  in.solar = 1000;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_EQUAL_INT(4, result.charge_rate);
+  TEST_ASSERT_FALSE(result.set_rate);
+  TEST_ASSERT_FALSE(result.start);
+  TEST_ASSERT_FALSE(result.stop);
+  TEST_ASSERT_DOUBLE_WITHIN(0.001, 1000.0 / 240, state.available_current);
+  TEST_ASSERT_DOUBLE_WITHIN(0.001, 0.4 * 1000.0 / 240, state.smoothed_available_current);
+}
+
+static void test_solar_above_min_starts()
+{
+  in.solar = 7200;
+  state.smoothed_available_current = 6;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_EQUAL_INT(30, result.charge_rate);
+  TEST_ASSERT_TRUE(result.set_rate);
+  TEST_ASSERT_TRUE(result.start);
+  TEST_ASSERT_FALSE(result.stop);
+  TEST_ASSERT_DOUBLE_WITHIN(0.001, 15.6, state.smoothed_available_current);
+}
+
+static void test_rate_capped_at_max()
+{
+  in.solar = 9600;
+  in.sleeping = false;
+  in.current_charge_rate = 32;
+  state.smoothed_available_current = 40;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_EQUAL_INT(32, result.charge_rate);
+  TEST_ASSERT_FALSE(result.set_rate);
+  TEST_ASSERT_FALSE(result.start);
+  TEST_ASSERT_FALSE(result.stop);
+}
+
+static void test_grid_export_keeps_reserve()
+{
+  in.feed = DIVERT_FEED_GRID_IE;
+  in.grid_ie = -2400;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_DOUBLE_WITHIN(0.001, 10 - GRID_IE_RESERVE_POWER / 240, state.available_current);
+  TEST_ASSERT_EQUAL_INT(9, result.charge_rate);
+}
+
+static void test_grid_export_includes_ev()
+{
+  // Exporting 1200 W while the EV uses 10 A, so 15 A is available
+  in.feed = DIVERT_FEED_GRID_IE;
+  in.grid_ie = -1200;
+  in.ev_amps = 10;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_DOUBLE_WITHIN(0.001, 15 - GRID_IE_RESERVE_POWER / 240, state.available_current);
+}
+
+static void test_grid_import_no_current()
+{
+  in.feed = DIVERT_FEED_GRID_IE;
+  in.grid_ie = 500;
+  state.available_current = 10;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_DOUBLE_WITHIN(0.001, 0, state.available_current);
+  TEST_ASSERT_EQUAL_INT(0, result.charge_rate);
+  TEST_ASSERT_FALSE(result.start);
+}
+
+static void test_awake_keeps_min_current()
+{
+  in.solar = 0;
+  in.sleeping = false;
+  in.divert_active = true;
+  state.smoothed_available_current = 2;
+  divert_calculate(in, state, result);
+
+  // Not stopped until the minimum charge time has passed
+  TEST_ASSERT_EQUAL_INT(6, result.charge_rate);
+  TEST_ASSERT_FALSE(result.stop);
+  TEST_ASSERT_DOUBLE_WITHIN(0.001, 1.9, state.smoothed_available_current);
+}
+
+static void test_stops_after_min_charge_time()
+{
+  in.solar = 0;
+  in.sleeping = false;
+  in.divert_active = true;
+  in.min_charge_time_elapsed = true;
+  state.smoothed_available_current = 2;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_TRUE(result.stop);
+  TEST_ASSERT_FALSE(result.set_rate);
+  TEST_ASSERT_FALSE(result.start);
+}
+
+static void test_not_stopped_if_not_started_by_divert()
+{
+  in.solar = 0;
+  in.sleeping = false;
+  in.divert_active = false;
+  in.min_charge_time_elapsed = true;
+  divert_calculate(in, state, result);
+
+  TEST_ASSERT_FALSE(result.stop);
+}
+
+// Replay a sequence of solar readings, feeding the actions back in as the
+// divert state machine would, and check the $SC/$FE/$FS decisions
+static void test_replay_solar_sequence()
+{
+  struct {
+    int solar;
+    int charge_rate;
+    bool set_rate;
+    bool start;
+    bool stop;
+  } steps[] = {
+    {    0,  0, false, false, false },
+    { 1000,  4, false, false, false },
+    { 2400, 10, true,  true,  false },    // $SC 10, $FE
+    { 3600, 15, true,  false, false },    // $SC 15
+    { 3600, 15, false, false, false },
+    { 1200,  6, false, false, true  },    // $FS
+    {    0,  0, false, false, false },
+  };
+
+  // No smoothing so each step only depends on its reading
+  in.attack_smoothing_factor = 1;
+  in.decay_smoothing_factor = 1;
+  in.min_charge_time_elapsed = true;
+
+  for(size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++)
+  {
+    in.solar = steps[i].solar;
+    divert_calculate(in, state, result);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(steps[i].charge_rate, result.charge_rate, "charge_rate");
+    TEST_ASSERT_EQUAL_MESSAGE(steps[i].set_rate, result.set_rate, "set_rate");
+    TEST_ASSERT_EQUAL_MESSAGE(steps[i].start, result.start, "start");
+    TEST_ASSERT_EQUAL_MESSAGE(steps[i].stop, result.stop, "stop");
+
+    if(result.set_rate) {
+      in.current_charge_rate = result.charge_rate;
+    }
+    if(result.start) {
+      in.sleeping = false;
+      in.divert_active = true;
+    }
+    if(result.stop) {
+      in.sleeping = true;
+      in.divert_active = false;
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_solar_below_min_does_not_start);
+  RUN_TEST(test_solar_above_min_starts);
+  RUN_TEST(test_rate_capped_at_max);
+  RUN_TEST(test_grid_export_keeps_reserve);
+  RUN_TEST(test_grid_export_includes_ev);
+  RUN_TEST(test_grid_import_no_current);
+  RUN_TEST(test_awake_keeps_min_current);
+  RUN_TEST(test_stops_after_min_charge_time);
+  RUN_TEST(test_not_stopped_if_not_started_by_divert);
+  RUN_TEST(test_replay_solar_sequence);
+  return UNITY_END();
+}
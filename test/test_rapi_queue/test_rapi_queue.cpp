@@ -0,0 +1,226 @@
+// Host tests for the prioritised RAPI command queue
+
+#include <unity.h>
+
+#include "rapi_queue.h"
+
+RapiSender rapiSender;
+
+// Empty the queue left by the previous test
+static void drain()
+{
+  fake_millis_advance(RAPI_QUEUE_DEFAULT_DEADLINE + 1);
+  rapi_queue_loop();
+  while(rapiSender.fake_complete(RAPI_RESPONSE_TIMEOUT)) {
+  }
+}
+
+void setUp()
+{
+  drain();
+  rapiSender.fake_reset();
+  rapi_queue_dropped = 0;
+  rapi_queue_expired = 0;
+}
+
+void tearDown()
+{
+}
+
+static void test_sent_in_priority_order()
+{
+  rapi_queue_send("$GS", RAPI_PRIORITY_POLL);
+  rapi_queue_send("$FP 0 0 Hello", RAPI_PRIORITY_LCD);
+  rapi_queue_send("$SC 10", RAPI_PRIORITY_CONTROL);
+  rapi_queue_send("$GE", RAPI_PRIORITY_POLL);
+  TEST_ASSERT_EQUAL(4, rapi_queue_length());
+
+  for(int i = 0; i < 4; i++) {
+    rapi_queue_loop();
+    rapiSender.fake_complete(RAPI_RESPONSE_OK);
+  }
+
+  TEST_ASSERT_EQUAL(4, rapiSender.sent.size());
+  TEST_ASSERT_EQUAL_STRING("$SC 10", rapiSender.sent[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("$GS", rapiSender.sent[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("$GE", rapiSender.sent[2].c_str());
+  TEST_ASSERT_EQUAL_STRING("$FP 0 0 Hello", rapiSender.sent[3].c_str());
+  TEST_ASSERT_EQUAL(0, rapi_queue_length());
+}
+
+static void test_safety_promoted()
+{
+  rapi_queue_send("$SC 10", RAPI_PRIORITY_CONTROL);
+  rapi_queue_send("$FS", RAPI_PRIORITY_USER);
+
+  rapi_queue_loop();
+  TEST_ASSERT_EQUAL_STRING("$FS", rapiSender.sent[0].c_str());
+}
+
+static void test_in_flight_limited()
+{
+  for(int i = 0; i < RAPI_QUEUE_IN_FLIGHT + 2; i++) {
+    rapi_queue_send("$GS", RAPI_PRIORITY_POLL);
+  }
+
+  rapi_queue_loop();
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_IN_FLIGHT, rapiSender.fake_pending());
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_IN_FLIGHT + 2, rapi_queue_length());
+
+  rapiSender.fake_complete(RAPI_RESPONSE_OK);
+  rapi_queue_loop();
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_IN_FLIGHT, rapiSender.fake_pending());
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_IN_FLIGHT + 1, rapi_queue_length());
+}
+
+static void test_sender_full_keeps_command()
+{
+  rapiSender.fake_set_max_pending(0);
+  rapi_queue_send("$GS", RAPI_PRIORITY_POLL);
+  rapi_queue_loop();
+  TEST_ASSERT_EQUAL(0, rapiSender.sent.size());
+  TEST_ASSERT_EQUAL(1, rapi_queue_length());
+
+  rapiSender.fake_set_max_pending(1);
+  rapi_queue_loop();
+  TEST_ASSERT_EQUAL(1, rapiSender.sent.size());
+}
+
+static int dropped = 0;
+
+static void test_full_drops_lower_priority()
+{
+  dropped = 0;
+  for(int i = 0; i < RAPI_QUEUE_SIZE; i++) {
+    TEST_ASSERT_TRUE(rapi_queue_send("$GS", RAPI_PRIORITY_POLL, [](int ret) {
+      if(RAPI_RESPONSE_QUEUE_FULL == ret) {
+        dropped++;
+      }
+    }));
+  }
+
+  // Same priority can not make room
+  TEST_ASSERT_FALSE(rapi_queue_send("$GE", RAPI_PRIORITY_POLL));
+  TEST_ASSERT_EQUAL(0, dropped);
+
+  TEST_ASSERT_TRUE(rapi_queue_send("$SC 10", RAPI_PRIORITY_CONTROL));
+  TEST_ASSERT_EQUAL(1, dropped);
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_SIZE, rapi_queue_length());
+  TEST_ASSERT_EQUAL(2, rapi_queue_dropped);
+}
+
+static void test_expired_commands_time_out()
+{
+  int ret = RAPI_RESPONSE_OK;
+  rapiSender.fake_set_max_pending(0);
+  rapi_queue_send("$GS", RAPI_PRIORITY_POLL, [&ret](int r) { ret = r; }, 1000);
+
+  fake_millis_advance(500);
+  rapi_queue_loop();
+  TEST_ASSERT_EQUAL(1, rapi_queue_length());
+
+  fake_millis_advance(501);
+  rapi_queue_loop();
+  TEST_ASSERT_EQUAL(0, rapi_queue_length());
+  TEST_ASSERT_EQUAL(RAPI_RESPONSE_TIMEOUT, ret);
+  TEST_ASSERT_EQUAL(1, rapi_queue_expired);
+}
+
+static void test_batch_all_or_nothing()
+{
+  for(int i = 0; i < RAPI_QUEUE_SIZE - 1; i++) {
+    rapi_queue_send("$GS", RAPI_PRIORITY_USER);
+  }
+
+  const char *cmds[] = { "$SC 10", "$FE" };
+  TEST_ASSERT_FALSE(rapi_queue_batch(cmds, 2, RAPI_PRIORITY_USER, nullptr));
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_SIZE - 1, rapi_queue_length());
+
+  TEST_ASSERT_TRUE(rapi_queue_batch(cmds, 1, RAPI_PRIORITY_USER, nullptr));
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_SIZE, rapi_queue_length());
+}
+
+static void test_batch_reports_index()
+{
+  size_t order[2] = { 99, 99 };
+  size_t completed = 0;
+  const char *cmds[] = { "$SC 10", "$FE" };
+  TEST_ASSERT_TRUE(rapi_queue_batch(cmds, 2, RAPI_PRIORITY_USER, [&order, &completed](size_t index, int ret) {
+    order[completed++] = index;
+  }));
+
+  rapi_queue_loop();
+  rapiSender.fake_complete(RAPI_RESPONSE_OK);
+  rapiSender.fake_complete(RAPI_RESPONSE_OK);
+
+  TEST_ASSERT_EQUAL(2, completed);
+  TEST_ASSERT_EQUAL(0, order[0]);
+  TEST_ASSERT_EQUAL(1, order[1]);
+}
+
+static void test_batch_safety_promoted()
+{
+  rapi_queue_send("$SC 10", RAPI_PRIORITY_CONTROL);
+
+  const char *cmds[] = { "$GS", "$FD" };
+  TEST_ASSERT_TRUE(rapi_queue_batch(cmds, 2, RAPI_PRIORITY_USER, nullptr));
+
+  for(int i = 0; i < 3; i++) {
+    rapi_queue_loop();
+    rapiSender.fake_complete(RAPI_RESPONSE_OK);
+  }
+
+  TEST_ASSERT_EQUAL_STRING("$FD", rapiSender.sent[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("$SC 10", rapiSender.sent[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("$GS", rapiSender.sent[2].c_str());
+}
+
+static void test_batch_of_safety_fits_full_queue()
+{
+  for(int i = 0; i < RAPI_QUEUE_SIZE; i++) {
+    rapi_queue_send("$SC 10", RAPI_PRIORITY_CONTROL);
+  }
+
+  const char *cmds[] = { "$FS", "$GS" };
+  TEST_ASSERT_FALSE(rapi_queue_batch(cmds, 2, RAPI_PRIORITY_USER, nullptr));
+  TEST_ASSERT_TRUE(rapi_queue_batch(cmds, 1, RAPI_PRIORITY_USER, nullptr));
+  TEST_ASSERT_EQUAL(RAPI_QUEUE_SIZE, rapi_queue_length());
+}
+
+static void test_empty_rejected()
+{
+  const char *cmds[] = { "$GS", "" };
+  TEST_ASSERT_FALSE(rapi_queue_batch(cmds, 2, RAPI_PRIORITY_USER, nullptr));
+  TEST_ASSERT_EQUAL(0, rapi_queue_length());
+}
+
+static void test_too_long_rejected()
+{
+  char cmd[RAPI_QUEUE_CMD_LEN + 2];
+  memset(cmd, 'A', sizeof(cmd) - 1);
+  cmd[sizeof(cmd) - 1] = '\0';
+
+  TEST_ASSERT_FALSE(rapi_queue_send(cmd, RAPI_PRIORITY_USER));
+
+  const char *cmds[] = { "$GS", cmd };
+  TEST_ASSERT_FALSE(rapi_queue_batch(cmds, 2, RAPI_PRIORITY_USER, nullptr));
+  TEST_ASSERT_EQUAL(0, rapi_queue_length());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_sent_in_priority_order);
+  RUN_TEST(test_safety_promoted);
+  RUN_TEST(test_in_flight_limited);
+  RUN_TEST(test_sender_full_keeps_command);
+  RUN_TEST(test_full_drops_lower_priority);
+  RUN_TEST(test_expired_commands_time_out);
+  RUN_TEST(test_batch_all_or_nothing);
+  RUN_TEST(test_batch_reports_index);
+  RUN_TEST(test_batch_safety_promoted);
+  RUN_TEST(test_batch_of_safety_fits_full_queue);
+  RUN_TEST(test_empty_rejected);
+  RUN_TEST(test_too_long_rejected);
+  return UNITY_END();
+}